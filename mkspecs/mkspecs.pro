@@ -0,0 +1,5 @@
+TEMPLATE = aux
+
+prf.files = features/qtopcua_nodeset.prf
+prf.path = $$[QT_HOST_DATA]/mkspecs/features
+INSTALLS += prf
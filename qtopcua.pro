@@ -4,3 +4,5 @@ requires(!wasm)
 
 DEFINES  += QT_FEATURE_opensslv11
 load(qt_parts)
+
+SUBDIRS += mkspecs
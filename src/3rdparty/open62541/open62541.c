@@ -6229,6 +6229,10 @@ struct UA_Server {
 #ifdef UA_ENABLE_PUBSUB
     UA_PubSubManager pubSubManager;
 #endif
+
+    /* Qt patch: Services which are not part of this build */
+    const UA_Server_CustomService *customServices;
+    size_t customServicesSize;
 };
 
 /*****************/
@@ -21160,6 +21164,14 @@ cleanup:
 /********************/
 
 /* The server needs to be stopped before it can be deleted */
+/* Qt patch: Custom services */
+void
+UA_Server_setCustomServices(UA_Server *server, const UA_Server_CustomService *services,
+                            size_t servicesSize) {
+    server->customServices = services;
+    server->customServicesSize = servicesSize;
+}
+
 void UA_Server_delete(UA_Server *server) {
     /* Delete all internal data */
     UA_SecureChannelManager_deleteMembers(&server->secureChannelManager);
@@ -23309,7 +23321,8 @@ sendResponse(UA_SecureChannel *channel, UA_UInt32 requestId, UA_UInt32 requestHa
 
 static UA_StatusCode
 processMSGDecoded(UA_Server *server, UA_SecureChannel *channel, UA_UInt32 requestId,
-                  UA_Service service, const UA_RequestHeader *requestHeader,
+                  UA_Service service, const UA_Server_CustomService *customService,
+                  const UA_RequestHeader *requestHeader,
                   const UA_DataType *requestType, UA_ResponseHeader *responseHeader,
                   const UA_DataType *responseType, UA_Boolean sessionRequired) {
     /* CreateSession doesn't need a session */
@@ -23412,7 +23425,11 @@ processMSGDecoded(UA_Server *server, UA_SecureChannel *channel, UA_UInt32 reques
 #endif
 
     /* Dispatch the synchronous service call and send the response */
-    service(server, session, requestHeader, responseHeader);
+    if(customService)
+        customService->service(server, &session->sessionId, customService->serviceContext,
+                               requestHeader, responseHeader);
+    else
+        service(server, session, requestHeader, responseHeader);
     return sendResponse(channel, requestId, requestHeader->requestHandle,
                         responseHeader, responseType);
 }
@@ -23439,6 +23456,17 @@ processMSG(UA_Server *server, UA_SecureChannel *channel,
     const UA_DataType *responseType = NULL;
     getServicePointers(requestTypeId.identifier.numeric, &requestType,
                        &responseType, &service, &sessionRequired);
+
+    /* Qt patch: Look for a custom service if the request type is unknown */
+    const UA_Server_CustomService *customService = NULL;
+    for(size_t i = 0; !requestType && i < server->customServicesSize; ++i) {
+        if(server->customServices[i].requestEncodingId != requestTypeId.identifier.numeric)
+            continue;
+        customService = &server->customServices[i];
+        requestType = customService->requestType;
+        responseType = customService->responseType;
+    }
+
     if(!requestType) {
         if(requestTypeId.identifier.numeric == 787) {
             UA_LOG_INFO_CHANNEL(&server->config.logger, channel,
@@ -23493,7 +23521,8 @@ processMSG(UA_Server *server, UA_SecureChannel *channel,
     UA_init(response, responseType);
 
     /* Continue with the decoded Request */
-    retval = processMSGDecoded(server, channel, requestId, service, requestHeader, requestType,
+    retval = processMSGDecoded(server, channel, requestId, service, customService,
+                               requestHeader, requestType,
                                responseHeader, responseType, sessionRequired);
 
     /* Clean up */
@@ -22265,6 +22265,30 @@ UA_Server_run_iterate(UA_Server *server, UA_Boolean waitInternal);
 UA_StatusCode UA_EXPORT
 UA_Server_run_shutdown(UA_Server *server);
 
+/* Qt patch: Custom services
+ *
+ * Lets the Qt OPC UA test server answer requests for services which are not
+ * part of this build, e.g. HistoryRead without UA_ENABLE_HISTORIZING. Custom
+ * services are only consulted for request types that are unknown to the
+ * server. The array of services must outlive the server. */
+#define UA_QT_ENABLE_CUSTOM_SERVICES
+
+typedef void (*UA_Server_customServiceCallback)(UA_Server *server, const UA_NodeId *sessionId,
+                                                void *serviceContext, const void *request,
+                                                void *response);
+
+typedef struct {
+    UA_UInt32 requestEncodingId; /* Numeric id of the default binary encoding */
+    const UA_DataType *requestType;
+    const UA_DataType *responseType;
+    UA_Server_customServiceCallback service;
+    void *serviceContext;
+} UA_Server_CustomService;
+
+void UA_EXPORT
+UA_Server_setCustomServices(UA_Server *server, const UA_Server_CustomService *services,
+                            size_t servicesSize);
+
 /**
  * Timed Callbacks
  * --------------- */
@@ -30,6 +30,9 @@ SOURCES += \
     opcuafilterelement.cpp \
     opcuaeventfilter.cpp \
     opcuaoperandbase.cpp \
+    opcuaupdatecoalescer.cpp \
+    opcuanoderegistry.cpp \
+    opcuatagmodel.cpp \
 
 HEADERS += \
     opcua_plugin.h \
@@ -61,6 +64,9 @@ HEADERS += \
     opcuafilterelement.h \
     opcuaeventfilter.h \
     opcuaoperandbase.h \
+    opcuaupdatecoalescer.h \
+    opcuanoderegistry.h \
+    opcuatagmodel.h \
 
 load(qml_plugin)
 
@@ -57,6 +57,7 @@
 #include "opcuaattributeoperand.h"
 #include "opcuafilterelement.h"
 #include "opcuaeventfilter.h"
+#include "opcuatagmodel.h"
 #include <QLoggingCategory>
 #include <QOpcUaUserTokenPolicy>
 
@@ -160,6 +161,11 @@ void OpcUaPlugin::registerTypes(const char *uri)
     qmlRegisterType<OpcUaFilterElement>(uri, major, minor, "FilterElement");
     qmlRegisterType<OpcUaEventFilter>(uri, major, minor, "EventFilter");
 
+    // Register the 5.15 types
+    major = 5;
+    minor = 15;
+    qmlRegisterType<OpcUaTagModel>(uri, major, minor, "TagModel");
+
     // insert new versions here
 
     // Register the latest Qt version as QML type version
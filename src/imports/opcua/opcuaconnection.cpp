@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "opcuaconnection.h"
+#include "opcuanoderegistry.h"
 #include "opcuareadresult.h"
 #include "opcuawriteitem.h"
 #include "opcuawriteresult.h"
@@ -257,7 +258,8 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
 OpcUaConnection* OpcUaConnection::m_defaultConnection = nullptr;
 
 OpcUaConnection::OpcUaConnection(QObject *parent):
-    QObject(parent)
+    QObject(parent),
+    m_nodeRegistry(new OpcUaNodeRegistry(this))
 {
 }
 
@@ -367,6 +369,10 @@ void OpcUaConnection::setDefaultConnection(bool defaultConnection)
 
 void OpcUaConnection::clientStateHandler(QOpcUaClient::ClientState state)
 {
+    // Nodes of a lost connection must not be shared with nodes of the next one
+    if (state != QOpcUaClient::ClientState::Connected)
+        m_nodeRegistry->invalidate();
+
     if (m_connected) {
         // don't immediately send the state; we have to wait for the namespace
         // array to be updated
@@ -640,6 +646,8 @@ void OpcUaConnection::handleWriteNodeAttributesFinished(const QVector<QOpcUaWrit
 
 void OpcUaConnection::removeConnection()
 {
+    m_nodeRegistry->invalidate();
+
     if (m_client) {
         m_client->disconnect(this);
         m_client->disconnectFromEndpoint();
@@ -47,6 +47,7 @@ QT_BEGIN_NAMESPACE
 
 class QOpcUaReadResult;
 class OpcUaEndpointDiscovery;
+class OpcUaNodeRegistry;
 
 class OpcUaConnection : public QObject
 {
@@ -112,6 +113,7 @@ private:
     void setupConnection();
 
     QOpcUaClient *m_client = nullptr;
+    OpcUaNodeRegistry *m_nodeRegistry = nullptr;
     bool m_connected = false;
     static OpcUaConnection* m_defaultConnection;
 
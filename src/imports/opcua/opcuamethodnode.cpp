@@ -216,6 +216,8 @@ void OpcUaMethodNode::handleObjectNodeIdChanged()
 {
     m_objectNode->deleteLater();
     m_objectNode = new OpcUaNode(this);
+    // Results of method calls are reported by the object node, which must not report the calls of other method nodes
+    m_objectNode->setNodeSharingEnabled(false);
     m_objectNode->setNodeId(m_objectNodeId);
     connect(m_objectNode, &OpcUaNode::readyToUseChanged, this, [this](){
         connect(m_objectNode->node(), &QOpcUaNode::methodCallFinished, this, &OpcUaMethodNode::handleMethodCallFinished, Qt::UniqueConnection);
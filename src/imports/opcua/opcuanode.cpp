@@ -39,6 +39,7 @@
 #include "opcuarelativenodeid.h"
 #include "opcuapathresolver.h"
 #include "opcuaattributevalue.h"
+#include "opcuanoderegistry.h"
 #include <qopcuatype.h>
 #include <QOpcUaNode>
 #include <QOpcUaClient>
@@ -63,6 +64,10 @@ QT_BEGIN_NAMESPACE
         connection: myConnection
     }
     \endcode
+
+    Since QtOpcUa 5.15, all nodes of a connection which refer to the same node on the server share
+    the attributes read from the server and, for value nodes, one monitored item. Nodes with an event filter
+    or a data change filter use their own monitored item.
 */
 
 /*!
@@ -195,7 +200,7 @@ OpcUaNode::OpcUaNode(QObject *parent):
 
 OpcUaNode::~OpcUaNode()
 {
-    delete m_node;
+    releaseNode();
 }
 
 OpcUaNodeIdType *OpcUaNode::nodeId() const
@@ -330,10 +335,7 @@ void OpcUaNode::setupNode(const QString &absoluteNodePath)
     m_attributeCache.invalidate();
     m_absoluteNodePath = absoluteNodePath;
 
-    if (m_node) {
-        m_node->deleteLater();
-        m_node = nullptr;
-    }
+    releaseNode();
 
     if (m_absoluteNodePath.isEmpty())
         return;
@@ -345,15 +347,22 @@ void OpcUaNode::setupNode(const QString &absoluteNodePath)
     if (!conn->connected())
         return;
 
-    m_node = conn->m_client->node(m_absoluteNodePath);
+    // QML nodes with the same node id share one QOpcUaNode, its attributes and its monitored items
+    m_nodeRegistry = conn->m_nodeRegistry;
+    m_node = m_nodeRegistry->acquire(conn->m_client, m_absoluteNodePath, canShareNode());
     if (!m_node) {
         qCWarning(QT_OPCUA_PLUGINS_QML) << "Invalid node:" << m_absoluteNodePath;
         return;
     }
 
     connect(m_node, &QOpcUaNode::attributeUpdated, &m_attributeCache, &OpcUaAttributeCache::setAttributeValue);
-    connect(m_node, &QOpcUaNode::attributeRead, this, [this](){
-        setReadyToUse(true);
+    connect(m_node, &QOpcUaNode::attributeRead, this, [this](QOpcUa::NodeAttributes attributes){
+        // A shared node also reports the attributes read for other QML nodes
+        if (!(m_pendingAttributes & attributes))
+            return;
+        m_pendingAttributes &= ~attributes;
+        if (!m_pendingAttributes)
+            setReadyToUse(true);
     });
 
     connect(m_node, &QOpcUaNode::enableMonitoringFinished, this, [this](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode){
@@ -395,12 +404,31 @@ void OpcUaNode::setupNode(const QString &absoluteNodePath)
     connect (m_node, &QOpcUaNode::eventOccurred, this, &OpcUaNode::eventOccurred);
 
 
-    // Read mandatory attributes
-    if (!m_node->readAttributes(m_attributesToRead)) {
+    // Read mandatory attributes, attributes already read for another QML node are taken from the shared node
+    bool readDispatched = true;
+    const QOpcUa::NodeAttributes availableAttributes = m_nodeRegistry->readAttributes(m_node, m_attributesToRead, &readDispatched);
+    m_pendingAttributes = m_attributesToRead & ~availableAttributes;
+    if (!readDispatched) {
         qCWarning(QT_OPCUA_PLUGINS_QML) << "Reading attributes" << m_node->nodeId() << "failed";
         setStatus(Status::FailedToReadAttributes);
     }
 
+    if (availableAttributes) {
+        for (uint i = 1; i <= static_cast<uint>(QOpcUa::NodeAttribute::UserExecutable); i <<= 1) {
+            const auto attribute = static_cast<QOpcUa::NodeAttribute>(i);
+            if (availableAttributes & attribute)
+                m_attributeCache.setAttributeValue(attribute, m_node->attribute(attribute));
+        }
+
+        // Let derived classes finish their setup before the node becomes ready
+        if (!m_pendingAttributes) {
+            QMetaObject::invokeMethod(this, [this]() {
+                if (m_node && !m_pendingAttributes)
+                    setReadyToUse(true);
+            }, Qt::QueuedConnection);
+        }
+    }
+
     updateEventFilter();
 }
 
@@ -430,6 +458,8 @@ void OpcUaNode::setEventFilter(OpcUaEventFilter *eventFilter)
 
     if (changed)
         emit eventFilterChanged();
+
+    updateNodeSharing();
 }
 
 
@@ -522,6 +552,63 @@ QOpcUaNode *OpcUaNode::node() const
     return m_node;
 }
 
+/*!
+    \internal
+
+    Enables or disables sharing the underlying node with other QML nodes which have the same node id.
+    Sharing is enabled by default.
+*/
+void OpcUaNode::setNodeSharingEnabled(bool enabled)
+{
+    if (m_nodeSharingEnabled == enabled)
+        return;
+
+    m_nodeSharingEnabled = enabled;
+    updateNodeSharing();
+}
+
+/*!
+    \internal
+
+    Returns \c true if the underlying node may be shared with other QML nodes.
+    A node with an event filter needs a monitored item of its own.
+*/
+bool OpcUaNode::canShareNode() const
+{
+    return m_nodeSharingEnabled && !m_eventFilter;
+}
+
+/*!
+    \internal
+
+    Sets up the node again if it is shared but must not be shared anymore.
+*/
+void OpcUaNode::updateNodeSharing()
+{
+    if (m_node && m_nodeRegistry && m_nodeRegistry->isShared(m_node) && !canShareNode())
+        updateNode();
+}
+
+/*!
+    \internal
+
+    Releases the underlying node, it is deleted when no other QML node uses it.
+*/
+void OpcUaNode::releaseNode()
+{
+    m_pendingAttributes = QOpcUa::NodeAttributes();
+    m_eventFilterActive = false;
+
+    if (!m_node)
+        return;
+
+    m_node->disconnect(this);
+    m_node->disconnect(&m_attributeCache);
+    if (m_nodeRegistry)
+        m_nodeRegistry->release(m_node);
+    m_node = nullptr;
+}
+
 void OpcUaNode::setAttributesToRead(QOpcUa::NodeAttributes attributes)
 {
     m_attributesToRead = attributes;
@@ -46,9 +46,12 @@
 
 #include <QDateTime>
 #include <QObject>
+#include <QPointer>
 
 QT_BEGIN_NAMESPACE
 
+class OpcUaNodeRegistry;
+
 class OpcUaNode : public QObject
 {
     Q_OBJECT
@@ -119,6 +122,9 @@ public:
     // This function is not exposed to QML
     QOpcUaNode* node() const;
 
+    // This function is not exposed to QML
+    void setNodeSharingEnabled(bool enabled);
+
 public slots:
     void setNodeId(OpcUaNodeIdType *nodeId);
     void setConnection(OpcUaConnection *);
@@ -149,9 +155,15 @@ protected:
     void retrieveAbsoluteNodePath(OpcUaNodeIdType *, std::function<void (const QString &)>);
     void setReadyToUse(bool value = true);
     virtual bool checkValidity();
+    virtual bool canShareNode() const;
+    void releaseNode();
+    void updateNodeSharing();
 
     OpcUaNodeIdType *m_nodeId = nullptr;
-    QOpcUaNode *m_node = nullptr;
+    QPointer<QOpcUaNode> m_node;
+    QPointer<OpcUaNodeRegistry> m_nodeRegistry;
+    bool m_nodeSharingEnabled = true;
+    QOpcUa::NodeAttributes m_pendingAttributes;
     OpcUaConnection *m_connection = nullptr;
     QString m_absoluteNodePath; // not exposed
     bool m_readyToUse = false;
@@ -0,0 +1,280 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuanoderegistry.h"
+
+#include <QOpcUaClient>
+#include <QOpcUaNode>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class OpcUaNodeRegistry
+    \inqmlmodule QtOpcUa
+    \brief Shares one QOpcUaNode between all QML nodes of a connection with the same node id.
+    \internal
+
+    This class is just for internal use in the declarative backend and not exposed to users.
+
+    Each connection owns a registry. QML nodes acquire their QOpcUaNode from the registry instead of
+    creating it from the client. All QML nodes which resolve to the same node id share one QOpcUaNode,
+    which is deleted when the last of them releases it. The signals of the shared node are delivered to
+    all QML nodes using it.
+
+    Attributes are read only once for all users of a shared node. Monitoring is reference counted per
+    attribute, so all users of a shared node share one monitored item. Its parameters are set by the
+    first user and modifications apply to all users.
+
+    QML nodes which need a monitored item of their own, for example because of a filter, acquire
+    a node which is not shared.
+
+    \sa OpcUaNode, OpcUaConnection
+*/
+
+OpcUaNodeRegistry::OpcUaNodeRegistry(QObject *parent)
+    : QObject(parent)
+{
+}
+
+OpcUaNodeRegistry::~OpcUaNodeRegistry()
+{
+    // QML nodes which are still alive hold a QPointer to their node
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it)
+        delete it.key();
+}
+
+/*!
+    Returns the shared node for \a nodeId if \a shared is \c true and creates it using \a client
+    if it does not exist yet. If \a shared is \c false, a new node is always created.
+    Every node returned by this function must be released using \l release().
+*/
+QOpcUaNode *OpcUaNodeRegistry::acquire(QOpcUaClient *client, const QString &nodeId, bool shared)
+{
+    if (shared) {
+        QOpcUaNode *node = m_sharedNodes.value(nodeId);
+        if (node) {
+            ++m_entries[node].references;
+            return node;
+        }
+    }
+
+    QOpcUaNode *node = client->node(nodeId);
+    if (!node)
+        return nullptr;
+
+    Entry entry;
+    entry.nodeId = nodeId;
+    entry.shared = shared;
+    entry.references = 1;
+    m_entries.insert(node, entry);
+    if (shared)
+        m_sharedNodes.insert(nodeId, node);
+
+    connect(node, &QOpcUaNode::attributeRead, this, [this, node](QOpcUa::NodeAttributes attributes) {
+        auto it = m_entries.find(node);
+        if (it == m_entries.end())
+            return;
+        it->readAttributes |= attributes;
+        it->pendingAttributes &= ~attributes;
+    });
+    connect(node, &QOpcUaNode::enableMonitoringFinished, this, [this, node](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode) {
+        auto it = m_entries.find(node);
+        if (it == m_entries.end() || !it->monitoring.contains(attr))
+            return;
+        Monitoring &monitoring = it->monitoring[attr];
+        if (!monitoring.pending)
+            return;
+        monitoring.pending = false;
+        monitoring.active = (statusCode == QOpcUa::Good);
+        // All users waiting for the monitored item drop their reference when it has failed,
+        // the next user requests a new monitored item.
+        if (!monitoring.active)
+            it->monitoring.remove(attr);
+    });
+
+    return node;
+}
+
+/*!
+    Releases \a node. The node is deleted when it has been released by all users.
+    Deleting the node also disables all monitoring.
+*/
+void OpcUaNodeRegistry::release(QOpcUaNode *node)
+{
+    auto it = m_entries.find(node);
+    if (it == m_entries.end())
+        return;
+
+    if (--it->references > 0)
+        return;
+
+    if (it->shared && m_sharedNodes.value(it->nodeId) == node)
+        m_sharedNodes.remove(it->nodeId);
+    m_entries.erase(it);
+
+    node->disconnect(this);
+    // This may be called from a signal of the node
+    node->deleteLater();
+}
+
+bool OpcUaNodeRegistry::isShared(QOpcUaNode *node) const
+{
+    return m_entries.value(node).shared;
+}
+
+int OpcUaNodeRegistry::sharedNodeCount() const
+{
+    return m_sharedNodes.size();
+}
+
+/*!
+    Returns the number of read requests dispatched for all nodes of the registry.
+*/
+int OpcUaNodeRegistry::readRequestCount() const
+{
+    return m_readRequestCount;
+}
+
+/*!
+    Returns the number of monitored items requested for all nodes of the registry.
+*/
+int OpcUaNodeRegistry::monitoringRequestCount() const
+{
+    return m_monitoringRequestCount;
+}
+
+/*!
+    Reads those of \a attributes of \a node which have neither been read nor are being read by another user.
+    Returns the attributes which are already available from the node's attribute cache.
+    The remaining attributes are reported by the attributeRead() signal of the node.
+
+    \a ok is set to \c false if the read request could not be dispatched.
+*/
+QOpcUa::NodeAttributes OpcUaNodeRegistry::readAttributes(QOpcUaNode *node, QOpcUa::NodeAttributes attributes, bool *ok)
+{
+    *ok = true;
+
+    auto it = m_entries.find(node);
+    if (it == m_entries.end()) {
+        *ok = false;
+        return QOpcUa::NodeAttributes();
+    }
+
+    const QOpcUa::NodeAttributes missing = attributes & ~(it->readAttributes | it->pendingAttributes);
+    if (missing) {
+        if (node->readAttributes(missing)) {
+            it->pendingAttributes |= missing;
+            ++m_readRequestCount;
+        } else {
+            *ok = false;
+        }
+    }
+
+    return attributes & it->readAttributes;
+}
+
+/*!
+    Adds a user to the monitored item for \a attr of \a node and creates it with \a parameters
+    if it is the first user.
+
+    Returns \c Active if the monitored item already exists, \c Pending if it is being created by
+    another user and \c Requested if it has been requested for this user. In the latter two cases,
+    the enableMonitoringFinished() signal of the node reports the result. If it reports an error,
+    the references of all users waiting for the monitored item are dropped.
+*/
+OpcUaNodeRegistry::MonitoringState OpcUaNodeRegistry::acquireMonitoring(QOpcUaNode *node, QOpcUa::NodeAttribute attr,
+                                                                        const QOpcUaMonitoringParameters &parameters)
+{
+    auto it = m_entries.find(node);
+    if (it == m_entries.end())
+        return MonitoringState::Failed;
+
+    Monitoring &monitoring = it->monitoring[attr];
+    if (monitoring.active) {
+        ++monitoring.references;
+        return MonitoringState::Active;
+    }
+    if (monitoring.pending) {
+        ++monitoring.references;
+        return MonitoringState::Pending;
+    }
+
+    if (!node->enableMonitoring(attr, parameters)) {
+        // Don't keep an entry without users
+        if (!monitoring.references)
+            it->monitoring.remove(attr);
+        return MonitoringState::Failed;
+    }
+
+    ++m_monitoringRequestCount;
+    ++monitoring.references;
+    monitoring.pending = true;
+    return MonitoringState::Requested;
+}
+
+/*!
+    Removes a user from the monitored item for \a attr of \a node and disables monitoring if it was the last one.
+    Returns \c true if monitoring is being disabled and the disableMonitoringFinished() signal of the node will
+    report the result.
+*/
+bool OpcUaNodeRegistry::releaseMonitoring(QOpcUaNode *node, QOpcUa::NodeAttribute attr)
+{
+    auto it = m_entries.find(node);
+    if (it == m_entries.end() || !it->monitoring.contains(attr))
+        return false;
+
+    Monitoring &monitoring = it->monitoring[attr];
+    if (--monitoring.references > 0)
+        return false;
+
+    const bool enabled = monitoring.active || monitoring.pending;
+    it->monitoring.remove(attr);
+
+    return enabled && node->disableMonitoring(attr);
+}
+
+/*!
+    Stops sharing the existing nodes, for example after the connection to the server has been lost.
+    Nodes acquired afterwards are created from scratch, the existing ones are deleted when they are released.
+*/
+void OpcUaNodeRegistry::invalidate()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        it->shared = false;
+    m_sharedNodes.clear();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QOpcUaMonitoringParameters>
+#include <qopcuatype.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClient;
+class QOpcUaNode;
+
+class OpcUaNodeRegistry : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(OpcUaNodeRegistry)
+    // Statistics for the auto tests
+    Q_PROPERTY(int sharedNodeCount READ sharedNodeCount)
+    Q_PROPERTY(int readRequestCount READ readRequestCount)
+    Q_PROPERTY(int monitoringRequestCount READ monitoringRequestCount)
+
+public:
+    enum class MonitoringState {
+        Requested,
+        Pending,
+        Active,
+        Failed
+    };
+
+    explicit OpcUaNodeRegistry(QObject *parent = nullptr);
+    ~OpcUaNodeRegistry();
+
+    QOpcUaNode *acquire(QOpcUaClient *client, const QString &nodeId, bool shared);
+    void release(QOpcUaNode *node);
+    bool isShared(QOpcUaNode *node) const;
+    int sharedNodeCount() const;
+    int readRequestCount() const;
+    int monitoringRequestCount() const;
+
+    QOpcUa::NodeAttributes readAttributes(QOpcUaNode *node, QOpcUa::NodeAttributes attributes, bool *ok);
+
+    MonitoringState acquireMonitoring(QOpcUaNode *node, QOpcUa::NodeAttribute attr,
+                                      const QOpcUaMonitoringParameters &parameters);
+    bool releaseMonitoring(QOpcUaNode *node, QOpcUa::NodeAttribute attr);
+
+    void invalidate();
+
+private:
+    struct Monitoring {
+        int references = 0;
+        bool pending = false;
+        bool active = false;
+    };
+
+    struct Entry {
+        QString nodeId;
+        bool shared = false;
+        int references = 0;
+        QOpcUa::NodeAttributes readAttributes;
+        QOpcUa::NodeAttributes pendingAttributes;
+        QHash<QOpcUa::NodeAttribute, Monitoring> monitoring;
+    };
+
+    QHash<QOpcUaNode *, Entry> m_entries;
+    QHash<QString, QOpcUaNode *> m_sharedNodes;
+    int m_readRequestCount = 0;
+    int m_monitoringRequestCount = 0;
+};
+
+QT_END_NAMESPACE
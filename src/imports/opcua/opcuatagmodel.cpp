@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuatagmodel.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \qmltype TagModel
+    \inqmlmodule QtOpcUa
+    \brief A list model which shows the current values of a list of nodes.
+    \since QtOpcUa 5.15
+
+    The model monitors the value attribute of every node in \l nodeIds and provides one row per node.
+    The monitored items of all nodes are created with a single request after the connection has been
+    established. Value changes are reported once per iteration of the event loop, changed rows which
+    are adjacent are reported together.
+
+    The roles \c nodeId, \c value, \c statusCode, \c sourceTimestamp and \c serverTimestamp are available
+    to delegates. The \c statusCode role contains a \l Status.
+
+    \code
+    import QtOpcUa 5.15 as QtOpcUa
+
+    ListView {
+        model: QtOpcUa.TagModel {
+            connection: myConnection
+            publishingInterval: 250
+            nodeIds: [ "ns=2;s=Tank1.Level", "ns=2;s=Tank2.Level" ]
+        }
+        delegate: Text { text: nodeId + ": " + value }
+    }
+    \endcode
+
+    This is a QML wrapper around QOpcUaTagModel.
+*/
+
+/*!
+    \qmlproperty list<string> TagModel::nodeIds
+
+    The ids of the nodes shown by the model, one row per node.
+*/
+
+/*!
+    \qmlproperty int TagModel::count
+
+    The number of rows in the model.
+*/
+
+/*!
+    \qmlproperty Connection TagModel::connection
+
+    The connection to be used for monitoring the nodes.
+
+    If this property is not set, the default connection will be used, if any.
+
+    \sa Connection, Connection::defaultConnection
+*/
+
+/*!
+    \qmlproperty double TagModel::publishingInterval
+
+    The publishing interval in milliseconds used for the monitored items. The default is 100.
+*/
+
+OpcUaTagModel::OpcUaTagModel(QObject *parent)
+    : QOpcUaTagModel(parent)
+{
+}
+
+OpcUaTagModel::~OpcUaTagModel() = default;
+
+void OpcUaTagModel::setConnection(OpcUaConnection *connection)
+{
+    if (connection == m_connection || !connection)
+        return;
+
+    if (m_connection)
+        disconnect(m_connection, &OpcUaConnection::connectedChanged, this, &OpcUaTagModel::updateClient);
+
+    m_connection = connection;
+
+    connect(m_connection, &OpcUaConnection::connectedChanged, this, &OpcUaTagModel::updateClient);
+    updateClient();
+    emit connectionChanged(connection);
+}
+
+OpcUaConnection *OpcUaTagModel::connection()
+{
+    if (!m_connection)
+        setConnection(OpcUaConnection::defaultConnection());
+
+    return m_connection;
+}
+
+double OpcUaTagModel::publishingInterval() const
+{
+    return monitoringParameters().publishingInterval();
+}
+
+void OpcUaTagModel::setPublishingInterval(double publishingInterval)
+{
+    if (qFuzzyCompare(publishingInterval, this->publishingInterval()))
+        return;
+
+    QOpcUaMonitoringParameters parameters = monitoringParameters();
+    parameters.setPublishingInterval(publishingInterval);
+    setMonitoringParameters(parameters);
+    emit publishingIntervalChanged();
+}
+
+QVariant OpcUaTagModel::data(const QModelIndex &index, int role) const
+{
+    if (role == StatusCodeRole && index.isValid())
+        return QVariant::fromValue(OpcUaStatus(QOpcUaTagModel::data(index, role).value<QOpcUa::UaStatusCode>()));
+
+    return QOpcUaTagModel::data(index, role);
+}
+
+void OpcUaTagModel::classBegin()
+{
+}
+
+void OpcUaTagModel::componentComplete()
+{
+    // Falls back to the default connection if none has been set
+    connection();
+}
+
+void OpcUaTagModel::updateClient()
+{
+    // The model keeps its client after a disconnect and restores the monitored items when it reconnects
+    if (m_connection && m_connection->connected())
+        setClient(m_connection->connection());
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef OPCUATAGMODEL_H
+#define OPCUATAGMODEL_H
+
+#include "opcuaconnection.h"
+#include "opcuastatus.h"
+
+#include <QOpcUaTagModel>
+#include <QQmlParserStatus>
+
+QT_BEGIN_NAMESPACE
+
+class OpcUaTagModel : public QOpcUaTagModel, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(OpcUaConnection* connection READ connection WRITE setConnection NOTIFY connectionChanged)
+    Q_PROPERTY(double publishingInterval READ publishingInterval WRITE setPublishingInterval NOTIFY publishingIntervalChanged)
+
+public:
+    OpcUaTagModel(QObject *parent = nullptr);
+    ~OpcUaTagModel();
+
+    void setConnection(OpcUaConnection *connection);
+    OpcUaConnection *connection();
+
+    double publishingInterval() const;
+    void setPublishingInterval(double publishingInterval);
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    void classBegin() override;
+    void componentComplete() override;
+
+signals:
+    void connectionChanged(OpcUaConnection *);
+    void publishingIntervalChanged();
+
+private slots:
+    void updateClient();
+
+private:
+    OpcUaConnection *m_connection = nullptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // OPCUATAGMODEL_H
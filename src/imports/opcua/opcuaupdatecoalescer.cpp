@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "opcuaupdatecoalescer.h"
+#include "opcuavaluenode.h"
+
+#include <QCoreApplication>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class OpcUaUpdateCoalescer
+    \inqmlmodule QtOpcUa
+    \brief Delivers the coalesced value changes of value nodes once per frame.
+    \internal
+
+    This class is just for internal use in the declarative backend and not exposed to users.
+
+    Value nodes with \l {ValueNode::updateMode}{updateMode} \c ValueNode.Coalesced schedule themselves
+    when their value changes. The coalescer is an animation without end which only runs while nodes are
+    scheduled. It is advanced by the animation driver of the Qt Quick render loop, which ticks once per
+    frame in sync with the frame swap of the window. On every tick, all scheduled nodes whose maximum
+    update rate allows it emit their latest value. Nodes which are not due yet stay scheduled.
+
+    \sa OpcUaValueNode
+*/
+
+OpcUaUpdateCoalescer::OpcUaUpdateCoalescer(QObject *parent)
+    : QAbstractAnimation(parent)
+{
+    m_clock.start();
+}
+
+/*!
+    Returns the coalescer of the application, which lives in the GUI thread like all QML nodes.
+*/
+OpcUaUpdateCoalescer *OpcUaUpdateCoalescer::instance()
+{
+    static QPointer<OpcUaUpdateCoalescer> coalescer;
+    if (!coalescer)
+        coalescer = new OpcUaUpdateCoalescer(QCoreApplication::instance());
+    return coalescer;
+}
+
+void OpcUaUpdateCoalescer::schedule(OpcUaValueNode *node)
+{
+    m_pendingNodes.insert(node);
+    if (state() != QAbstractAnimation::Running)
+        start();
+}
+
+void OpcUaUpdateCoalescer::unschedule(OpcUaValueNode *node)
+{
+    m_pendingNodes.remove(node);
+}
+
+/*!
+    Returns the milliseconds since the coalescer has been created.
+*/
+qint64 OpcUaUpdateCoalescer::elapsed() const
+{
+    return m_clock.elapsed();
+}
+
+int OpcUaUpdateCoalescer::duration() const
+{
+    return -1;
+}
+
+void OpcUaUpdateCoalescer::updateCurrentTime(int currentTime)
+{
+    Q_UNUSED(currentTime);
+
+    if (m_pendingNodes.isEmpty()) {
+        stop();
+        return;
+    }
+
+    // Bindings evaluated by the signals may create, destroy or schedule nodes
+    m_flushing.clear();
+    m_flushing.reserve(m_pendingNodes.size());
+    for (OpcUaValueNode *node : qAsConst(m_pendingNodes))
+        m_flushing.push_back(node);
+    m_pendingNodes.clear();
+
+    const qint64 now = m_clock.elapsed();
+    for (const auto &node : qAsConst(m_flushing)) {
+        if (node && !node->flushPendingValue(now))
+            m_pendingNodes.insert(node);
+    }
+    m_flushing.clear();
+
+    if (m_pendingNodes.isEmpty())
+        stop();
+}
+
+QT_END_NAMESPACE
@@ -38,6 +38,8 @@
 #include "opcuaconnection.h"
 #include "opcuanodeid.h"
 #include "opcuaattributevalue.h"
+#include "opcuanoderegistry.h"
+#include "opcuaupdatecoalescer.h"
 #include <QLoggingCategory>
 #include <QMetaEnum>
 
@@ -96,17 +98,60 @@ QT_BEGIN_NAMESPACE
     Server timestamp of the value attribute.
 */
 
+/*!
+    \qmlproperty enumeration ValueNode::updateMode
+    \since QtOpcUa 5.15
+
+    Determines when \l valueChanged is emitted for value changes received from the server.
+
+    \value ValueNode.Immediate
+           \c valueChanged is emitted for every value change. This is the default.
+    \value ValueNode.Coalesced
+           Value changes are coalesced and \c valueChanged is emitted at most once per frame
+           with the latest value. The frames are synchronized with the animation driver of the
+           Qt Quick render loop. This reduces the number of binding evaluations if values change
+           faster than the display is refreshed.
+
+    \code
+    QtOpcUa.ValueNode {
+        updateMode: QtOpcUa.ValueNode.Coalesced
+        maximumUpdateRate: 10
+        ...
+    }
+    \endcode
+
+    \sa maximumUpdateRate
+*/
+
+/*!
+    \qmlproperty double ValueNode::maximumUpdateRate
+    \since QtOpcUa 5.15
+
+    The maximum number of value updates per second delivered to the user interface if \l updateMode
+    is \c ValueNode.Coalesced. Changes in between are coalesced, the latest value is delivered.
+    The default value \c 0 delivers at most one update per frame.
+
+    \sa updateMode
+*/
+
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_QML)
 
 OpcUaValueNode::OpcUaValueNode(QObject *parent):
     OpcUaNode(parent)
 {
-    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::Value), &OpcUaAttributeValue::changed, this, &OpcUaValueNode::valueChanged);
+    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::Value), &OpcUaAttributeValue::changed, this, &OpcUaValueNode::handleValueChanged);
     connect(this, &OpcUaValueNode::filterChanged, this, &OpcUaValueNode::updateFilters);
+    connect(m_attributeCache.attribute(QOpcUa::NodeAttribute::DataType), &OpcUaAttributeValue::changed, this, [this](const QVariant &value) {
+        if (m_valueType == QOpcUa::Types::Undefined && value.isValid())
+            m_valueType = QOpcUa::opcUaDataTypeToQOpcUaType(value.toString());
+    });
 }
 
 OpcUaValueNode::~OpcUaValueNode()
 {
+    releaseMonitoring();
+    if (m_valuePending)
+        OpcUaUpdateCoalescer::instance()->unschedule(this);
 }
 
 void OpcUaValueNode::setValue(const QVariant &value)
@@ -127,6 +172,12 @@ template<typename T> QString enumToString(T value) {
 
 void OpcUaValueNode::setupNode(const QString &absolutePath)
 {
+    releaseMonitoring();
+    if (m_monitoredState) {
+        m_monitoredState = false;
+        emit monitoredChanged(m_monitoredState);
+    }
+
     // Additionally read the value attribute
     setAttributesToRead(attributesToRead()
                         | QOpcUa::NodeAttribute::Value
@@ -148,28 +199,24 @@ void OpcUaValueNode::setupNode(const QString &absolutePath)
       });
 
 
-    connect(m_node, &QOpcUaNode::attributeUpdated, this, [this](QOpcUa::NodeAttribute attr, QVariant value) {
-        if (attr == QOpcUa::NodeAttribute::DataType && m_valueType == QOpcUa::Types::Undefined) {
-            const auto valueType = QOpcUa::opcUaDataTypeToQOpcUaType(value.toString());
-            m_valueType = valueType;
-        }
-    });
-
     connect(m_node, &QOpcUaNode::enableMonitoringFinished, this, [this](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode){
-        if (attr != QOpcUa::NodeAttribute::Value)
+        // The monitored item of a shared node may have been requested by another QML node
+        if (attr != QOpcUa::NodeAttribute::Value || !m_monitoringReference)
             return;
         if (statusCode == QOpcUa::Good) {
             m_monitoredState = true;
             emit monitoredChanged(m_monitoredState);
+            syncPublishingInterval();
             qCDebug(QT_OPCUA_PLUGINS_QML) << "Monitoring was enabled for node" << resolvedNode().fullNodeId();
             updateFilters();
         } else {
             qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed to enable monitoring for node" << resolvedNode().fullNodeId();
+            m_monitoringReference = false;
             setStatus(Status::FailedToSetupMonitoring);
         }
     });
     connect(m_node, &QOpcUaNode::disableMonitoringFinished, this, [this](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode){
-        if (attr != QOpcUa::NodeAttribute::Value)
+        if (attr != QOpcUa::NodeAttribute::Value || m_monitoringReference || !m_monitoredState)
             return;
         if (statusCode == QOpcUa::Good) {
             m_monitoredState = false;
@@ -188,12 +235,8 @@ void OpcUaValueNode::setupNode(const QString &absolutePath)
            setStatus(Status::FailedToModifyMonitoring);
            qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed to modify monitoring";
        } else {
-           if (items & QOpcUaMonitoringParameters::Parameter::PublishingInterval) {
-               if (m_publishingInterval != m_node->monitoringStatus(QOpcUa::NodeAttribute::Value).publishingInterval()) {
-                   m_publishingInterval = m_node->monitoringStatus(QOpcUa::NodeAttribute::Value).publishingInterval();
-                   emit publishingIntervalChanged(m_publishingInterval);
-               }
-           }
+           if (items & QOpcUaMonitoringParameters::Parameter::PublishingInterval)
+               syncPublishingInterval();
        }
     });
 
@@ -258,14 +301,78 @@ void OpcUaValueNode::updateSubscription()
     if (m_filter)
         parameters.setFilter(m_filter->filter());
 
-    if (m_monitoredState != m_monitored) {
-        if (m_monitored) {
-            m_node->enableMonitoring(QOpcUa::NodeAttribute::Value, parameters);
-        } else {
-            m_node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    if (m_monitored && !m_monitoringReference) {
+        // All QML nodes sharing the node share one monitored item
+        m_monitoringReference = true;
+        switch (m_nodeRegistry->acquireMonitoring(m_node, QOpcUa::NodeAttribute::Value, parameters)) {
+        case OpcUaNodeRegistry::MonitoringState::Active:
+            if (!m_monitoredState) {
+                m_monitoredState = true;
+                emit monitoredChanged(m_monitoredState);
+            }
+            // The existing monitored item keeps the publishing interval it was created with
+            syncPublishingInterval();
+            break;
+        case OpcUaNodeRegistry::MonitoringState::Requested:
+        case OpcUaNodeRegistry::MonitoringState::Pending:
+            break;
+        case OpcUaNodeRegistry::MonitoringState::Failed:
+            m_monitoringReference = false;
+            qCWarning(QT_OPCUA_PLUGINS_QML) << "Failed to enable monitoring for node" << resolvedNode().fullNodeId();
+            setStatus(Status::FailedToSetupMonitoring);
+            break;
         }
+    } else if (!m_monitored && m_monitoringReference) {
+        releaseMonitoring();
+    }
+}
+
+/*!
+    \internal
+
+    Takes the publishing interval from the monitored item, which may have been
+    created or modified by another QML node sharing the node.
+*/
+void OpcUaValueNode::syncPublishingInterval()
+{
+    const double publishingInterval = m_node->monitoringStatus(QOpcUa::NodeAttribute::Value).publishingInterval();
+    if (qFuzzyCompare(m_publishingInterval, publishingInterval))
+        return;
+
+    m_publishingInterval = publishingInterval;
+    emit publishingIntervalChanged(m_publishingInterval);
+}
+
+/*!
+    \internal
+
+    Releases the reference to the monitored item. If other QML nodes still use it,
+    monitoring is disabled for this node right away.
+*/
+void OpcUaValueNode::releaseMonitoring()
+{
+    if (!m_monitoringReference)
+        return;
+
+    m_monitoringReference = false;
+    if (m_node && m_nodeRegistry && m_nodeRegistry->releaseMonitoring(m_node, QOpcUa::NodeAttribute::Value))
+        return; // disableMonitoringFinished reports the new state
+
+    if (m_monitoredState) {
+        m_monitoredState = false;
+        emit monitoredChanged(m_monitoredState);
     }
 }
+
+/*!
+    \internal
+
+    A node with a data change filter needs a monitored item of its own.
+*/
+bool OpcUaValueNode::canShareNode() const
+{
+    return OpcUaNode::canShareNode() && !m_filter;
+}
 void OpcUaValueNode::setMonitored(bool monitored)
 {
     m_monitored = monitored;
@@ -304,6 +411,8 @@ void OpcUaValueNode::setFilter(OpcUaDataChangeFilter *filter)
 
     if (changed)
         emit filterChanged();
+
+    updateNodeSharing();
 }
 
 void OpcUaValueNode::setPublishingInterval(double publishingInterval)
@@ -326,4 +435,76 @@ void OpcUaValueNode::setValueType(QOpcUa::Types valueType)
     m_valueType = valueType;
 }
 
+OpcUaValueNode::UpdateMode OpcUaValueNode::updateMode() const
+{
+    return m_updateMode;
+}
+
+void OpcUaValueNode::setUpdateMode(UpdateMode updateMode)
+{
+    if (m_updateMode == updateMode)
+        return;
+
+    m_updateMode = updateMode;
+
+    // Deliver a coalesced value right away instead of waiting for the next frame
+    if (m_updateMode == UpdateMode::Immediate && m_valuePending) {
+        OpcUaUpdateCoalescer::instance()->unschedule(this);
+        m_valuePending = false;
+        emit valueChanged(m_attributeCache.attributeValue(QOpcUa::NodeAttribute::Value));
+    }
+
+    emit updateModeChanged(m_updateMode);
+}
+
+double OpcUaValueNode::maximumUpdateRate() const
+{
+    return m_maximumUpdateRate;
+}
+
+void OpcUaValueNode::setMaximumUpdateRate(double maximumUpdateRate)
+{
+    if (maximumUpdateRate < 0)
+        maximumUpdateRate = 0;
+    if (qFuzzyCompare(m_maximumUpdateRate, maximumUpdateRate))
+        return;
+
+    m_maximumUpdateRate = maximumUpdateRate;
+    emit maximumUpdateRateChanged(m_maximumUpdateRate);
+}
+
+void OpcUaValueNode::handleValueChanged(const QVariant &value)
+{
+    if (m_updateMode == UpdateMode::Immediate) {
+        emit valueChanged(value);
+        return;
+    }
+
+    if (!m_valuePending) {
+        m_valuePending = true;
+        OpcUaUpdateCoalescer::instance()->schedule(this);
+    }
+}
+
+/*!
+    \internal
+
+    Emits the latest value if a value change is pending and the maximum update rate allows it at \a now.
+    Returns \c false if the value is still pending.
+*/
+bool OpcUaValueNode::flushPendingValue(qint64 now)
+{
+    if (!m_valuePending)
+        return true;
+
+    if (m_maximumUpdateRate > 0 && m_lastValueUpdate >= 0
+            && now - m_lastValueUpdate < qint64(1000 / m_maximumUpdateRate))
+        return false;
+
+    m_valuePending = false;
+    m_lastValueUpdate = now;
+    emit valueChanged(m_attributeCache.attributeValue(QOpcUa::NodeAttribute::Value));
+    return true;
+}
+
 QT_END_NAMESPACE
@@ -53,8 +53,16 @@ class OpcUaValueNode : public OpcUaNode
     Q_PROPERTY(bool monitored READ monitored WRITE setMonitored NOTIFY monitoredChanged)
     Q_PROPERTY(double publishingInterval READ publishingInterval WRITE setPublishingInterval NOTIFY publishingIntervalChanged)
     Q_PROPERTY(OpcUaDataChangeFilter *filter READ filter WRITE setFilter NOTIFY filterChanged)
+    Q_PROPERTY(UpdateMode updateMode READ updateMode WRITE setUpdateMode NOTIFY updateModeChanged)
+    Q_PROPERTY(double maximumUpdateRate READ maximumUpdateRate WRITE setMaximumUpdateRate NOTIFY maximumUpdateRateChanged)
 
 public:
+    enum class UpdateMode {
+        Immediate,
+        Coalesced
+    };
+    Q_ENUM(UpdateMode)
+
     OpcUaValueNode(QObject *parent = nullptr);
     ~OpcUaValueNode();
     QVariant value() const;
@@ -66,12 +74,18 @@ public:
     QOpcUa::Types valueType() const;
     OpcUaDataChangeFilter *filter() const;
     void setFilter(OpcUaDataChangeFilter *filter);
+    UpdateMode updateMode() const;
+    double maximumUpdateRate() const;
+
+    bool flushPendingValue(qint64 now);
 
 public slots:
     void setValue(const QVariant &);
     void setMonitored(bool monitored);
     void setPublishingInterval(double publishingInterval);
     void setValueType(QOpcUa::Types valueType);
+    void setUpdateMode(UpdateMode updateMode);
+    void setMaximumUpdateRate(double maximumUpdateRate);
 
 
 signals:
@@ -80,19 +94,31 @@ signals:
     void publishingIntervalChanged(double publishingInterval);
     void dataChangeOccurred(const QVariant &value);
     void filterChanged();
+    void updateModeChanged(UpdateMode updateMode);
+    void maximumUpdateRateChanged(double maximumUpdateRate);
 
 private slots:
     void setupNode(const QString &absolutePath) override;
     void updateSubscription();
     void updateFilters() const;
+    void handleValueChanged(const QVariant &value);
 
 private:
     bool checkValidity() override;
+    bool canShareNode() const override;
+    void releaseMonitoring();
+    void syncPublishingInterval();
+
     bool m_monitored = true;
     bool m_monitoredState = false;
+    bool m_monitoringReference = false;
     double m_publishingInterval = 100;
     QOpcUa::Types m_valueType = QOpcUa::Types::Undefined;
     OpcUaDataChangeFilter *m_filter = nullptr;
+    UpdateMode m_updateMode = UpdateMode::Immediate;
+    double m_maximumUpdateRate = 0;
+    bool m_valuePending = false;
+    qint64 m_lastValueUpdate = -1;
 };
 
 QT_END_NAMESPACE
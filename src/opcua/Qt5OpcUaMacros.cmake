@@ -0,0 +1,73 @@
+#=============================================================================
+# Copyright (C) 2019 The Qt Company Ltd.
+# Contact: http://www.qt.io/licensing/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the copyright
+#    notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived
+#    from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#=============================================================================
+
+# qt5_opcua_generate_nodeset(outfiles nodeset1.xml [nodeset2.xml ...] [NAMESPACE name])
+#
+# Runs qtopcua-nodesetgenerator for each NodeSet2 XML file and appends the
+# generated headers to outfiles. Machine.NodeSet2.xml generates machine_nodeset.h
+# in the current binary directory. The C++ namespace is passed with -n, it is
+# NAMESPACE if given and the base name of the XML file (Machine) otherwise.
+
+include(CMakeParseArguments)
+
+if (NOT TARGET Qt5::qtopcua-nodesetgenerator)
+    get_target_property(_qt5_opcua_qmake_location Qt5::qmake IMPORTED_LOCATION)
+    get_filename_component(_qt5_opcua_bin_dir "${_qt5_opcua_qmake_location}" DIRECTORY)
+    add_executable(Qt5::qtopcua-nodesetgenerator IMPORTED)
+    set_target_properties(Qt5::qtopcua-nodesetgenerator PROPERTIES
+        IMPORTED_LOCATION "${_qt5_opcua_bin_dir}/qtopcua-nodesetgenerator${CMAKE_EXECUTABLE_SUFFIX}")
+    unset(_qt5_opcua_qmake_location)
+    unset(_qt5_opcua_bin_dir)
+endif()
+
+function(QT5_OPCUA_GENERATE_NODESET outfiles)
+    cmake_parse_arguments(_nodeset "" "NAMESPACE" "" ${ARGN})
+    foreach(nodeset ${_nodeset_UNPARSED_ARGUMENTS})
+        get_filename_component(infile "${nodeset}" ABSOLUTE)
+        get_filename_component(name "${nodeset}" NAME)
+        string(REGEX REPLACE "\\..*$" "" basename "${name}")
+        string(TOLOWER "${basename}" lowername)
+        if (_nodeset_NAMESPACE)
+            set(cppnamespace "${_nodeset_NAMESPACE}")
+        else()
+            set(cppnamespace "${basename}")
+        endif()
+        set(outfile "${CMAKE_CURRENT_BINARY_DIR}/${lowername}_nodeset.h")
+        add_custom_command(OUTPUT "${outfile}"
+                           COMMAND Qt5::qtopcua-nodesetgenerator -i "${infile}" -o "${outfile}" -n "${cppnamespace}"
+                           DEPENDS "${infile}" Qt5::qtopcua-nodesetgenerator
+                           COMMENT "Generating ${lowername}_nodeset.h from ${name}"
+                           VERBATIM)
+        list(APPEND ${outfiles} "${outfile}")
+    endforeach()
+    set(${outfiles} ${${outfiles}} PARENT_SCOPE)
+endfunction()
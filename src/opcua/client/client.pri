@@ -20,13 +20,18 @@ SOURCES += \
     client/qopcuabackend.cpp \
     client/qopcuabinarydataencoding.cpp \
     client/qopcuabrowsepathtarget.cpp \
+    client/qopcuabrowseresult.cpp \
     client/qopcuabrowserequest.cpp \
     client/qopcuaclient.cpp \
     client/qopcuaclientimpl.cpp \
     client/qopcuaclientprivate.cpp \
+    client/qopcuaclientsidefilterstage.cpp \
     client/qopcuacomplexnumber.cpp \
+    client/qopcuaconditioncache.cpp \
     client/qopcuacontentfilterelement.cpp \
     client/qopcuacontentfilterelementresult.cpp \
+    client/qopcuadatachangequeue.cpp \
+    client/qopcuadatavalue.cpp \
     client/qopcuadeletereferenceitem.cpp \
     client/qopcuadoublecomplexnumber.cpp \
     client/qopcuaelementoperand.cpp \
@@ -34,17 +39,23 @@ SOURCES += \
     client/qopcuaerrorstate.cpp \
     client/qopcuaeuinformation.cpp \
     client/qopcuaeventfilterresult.cpp \
+    client/qopcuaeventrecord.cpp \
     client/qopcuaexpandednodeid.cpp \
     client/qopcuaextensionobject.cpp \
+    client/qopcuaextensionobjectdecoderregistry.cpp \
+    client/qopcuahistorydata.cpp \
+    client/qopcuahistoryreaditem.cpp \
     client/qopcualiteraloperand.cpp \
     client/qopcualocalizedtext.cpp \
     client/qopcuamonitoringparameters.cpp \
     client/qopcuamultidimensionalarray.cpp \
+    client/qopcuamultidimensionalarrayview.cpp \
     client/qopcuanode.cpp \
     client/qopcuanodecreationattributes.cpp \
     client/qopcuanodeids.cpp \
     client/qopcuanodeimpl.cpp \
     client/qopcuapkiconfiguration.cpp \
+    client/qopcuaprocessedhistorydata.cpp \
     client/qopcuaqualifiedname.cpp \
     client/qopcuarange.cpp \
     client/qopcuareaditem.cpp \
@@ -52,6 +63,9 @@ SOURCES += \
     client/qopcuareferencedescription.cpp \
     client/qopcuarelativepathelement.cpp \
     client/qopcuasimpleattributeoperand.cpp \
+    client/qopcuastringpool.cpp \
+    client/qopcuastructurecodec.cpp \
+    client/qopcuatagmodel.cpp \
     client/qopcuatype.cpp \
     client/qopcuausertokenpolicy.cpp \
     client/qopcuawriteitem.cpp \
@@ -71,12 +85,19 @@ HEADERS += \
     client/qopcuabackend_p.h \
     client/qopcuabinarydataencoding.h \
     client/qopcuabrowsepathtarget.h \
+    client/qopcuabrowseresult.h \
+    client/qopcuabrowseresult_p.h \
     client/qopcuabrowserequest.h \
     client/qopcuaclient_p.h \
     client/qopcuaclientimpl_p.h \
+    client/qopcuaclientsidefilterstage_p.h \
     client/qopcuacomplexnumber.h \
+    client/qopcuaconditioncache.h \
+    client/qopcuaconditioncache_p.h \
     client/qopcuacontentfilterelement.h \
     client/qopcuacontentfilterelementresult.h \
+    client/qopcuadatachangequeue_p.h \
+    client/qopcuadatavalue.h \
     client/qopcuadeletereferenceitem.h \
     client/qopcuadoublecomplexnumber.h \
     client/qopcuaelementoperand.h \
@@ -84,19 +105,28 @@ HEADERS += \
     client/qopcuaerrorstate.h \
     client/qopcuaeuinformation.h \
     client/qopcuaeventfilterresult.h \
+    client/qopcuaeventrecord.h \
+    client/qopcuaeventrecord_p.h \
     client/qopcuaexpandednodeid.h \
     client/qopcuaextensionobject.h \
+    client/qopcuaextensionobjectdecoderregistry.h \
+    client/qopcuahistorydata.h \
+    client/qopcuahistoryreaditem.h \
     client/qopcualiteraloperand.h \
     client/qopcualocalizedtext.h \
+    client/qopcuamethodcallitem_p.h \
     client/qopcuamonitoringparameters.h \
     client/qopcuamonitoringparameters_p.h \
     client/qopcuamultidimensionalarray.h \
+    client/qopcuamultidimensionalarrayview.h \
     client/qopcuanode_p.h \
     client/qopcuanodecreationattributes.h \
     client/qopcuanodecreationattributes_p.h \
     client/qopcuanodeids.h \
+    client/qopcuanodeids_p.h \
     client/qopcuanodeimpl_p.h \
     client/qopcuapkiconfiguration.h \
+    client/qopcuaprocessedhistorydata.h \
     client/qopcuaqualifiedname.h \
     client/qopcuarange.h \
     client/qopcuareaditem.h \
@@ -104,6 +134,10 @@ HEADERS += \
     client/qopcuareferencedescription.h \
     client/qopcuarelativepathelement.h \
     client/qopcuasimpleattributeoperand.h \
+    client/qopcuastringpool_p.h \
+    client/qopcuastructurecodec.h \
+    client/qopcuatagmodel.h \
+    client/qopcuatagmodel_p.h \
     client/qopcuausertokenpolicy.h \
     client/qopcuawriteitem.h \
     client/qopcuawriteresult.h \
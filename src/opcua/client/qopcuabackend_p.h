@@ -85,12 +85,16 @@ Q_SIGNALS:
     void attributeWritten(quint64 hande, QOpcUa::NodeAttribute attribute, QVariant value, QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
 
-    void dataChangeOccurred(quint64 handle, QOpcUaReadResult res);
-    void eventOccurred(quint64 handle, QVariantList fields);
+    void dataChangeOccurred(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaDataValue value);
+    void dataChangesQueued();
+    void eventsOccurred(quint64 handle, QVector<QOpcUaEventRecord> events);
     void monitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
-    void browseFinished(quint64 handle, QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void setTriggeringFinished(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove,
+                               QVector<QOpcUa::UaStatusCode> addResults, QVector<QOpcUa::UaStatusCode> removeResults,
+                               QOpcUa::UaStatusCode statusCode);
+    void browseFinished(quint64 handle, QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode);
 
     void resolveBrowsePathFinished(quint64 handle, const QVector<QOpcUaBrowsePathTarget> &targets,
                                      const QVector<QOpcUaRelativePathElement> &path, QOpcUa::UaStatusCode statusCode);
@@ -105,6 +109,17 @@ Q_SIGNALS:
                               QOpcUa::UaStatusCode statusCode);
     void deleteReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUaExpandedNodeId targetNodeId, bool isForwardReference,
                               QOpcUa::UaStatusCode statusCode);
+    void addNodesFinished(QVector<QOpcUaAddNodeItem> nodesToAdd, QStringList assignedNodeIds,
+                          QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void deleteNodesFinished(QStringList nodeIds, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void addReferencesFinished(QVector<QOpcUaAddReferenceItem> referencesToAdd, QVector<QOpcUa::UaStatusCode> results,
+                               QOpcUa::UaStatusCode serviceResult);
+    void deleteReferencesFinished(QVector<QOpcUaDeleteReferenceItem> referencesToDelete, QVector<QOpcUa::UaStatusCode> results,
+                                  QOpcUa::UaStatusCode serviceResult);
+    void historyDataAvailable(QVector<QOpcUaHistoryData> data);
+    void processedHistoryDataAvailable(QVector<QOpcUaProcessedHistoryData> data);
+    void readHistoryDataFinished(QVector<QOpcUaHistoryReadItem> nodesToRead, QOpcUa::UaStatusCode serviceResult);
+    void callMethodsFinished(quint64 requestId, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
     void connectError(QOpcUaErrorState *errorState);
     void passwordForPrivateKeyRequired(QString keyFilePath, QString *password, bool previousTryWasInvalid);
 
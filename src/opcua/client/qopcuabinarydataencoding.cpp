@@ -180,6 +180,48 @@ QT_BEGIN_NAMESPACE
     \sa encode()
 */
 
+/*!
+    \fn template<typename T, QOpcUa::Types OVERLAY> qint64 QOpcUaBinaryDataEncoding::encodedSize(const T &src)
+    \since QtOpcUa 5.15
+
+    Returns the number of bytes \l encode() appends to the data buffer when encoding \a src.
+    Returns \c -1 if \a src can't be encoded.
+
+    This can be used to reserve the required space in the target buffer before encoding.
+
+    \sa encodedArraySize()
+*/
+
+/*!
+    \class QOpcUaBinaryDataEncoding::hasEncodedSize
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+
+    \brief Indicates whether \c T has an encodedSize() specialization.
+
+    \l encodeArray() reserves the space for the whole array before encoding the elements
+    if this trait is \c true for the element type. It is \c true for arithmetic types and
+    all types with a built-in encodedSize() specialization.
+
+    Types with a user provided \l encode() specialization only need an encodedSize()
+    specialization if they also specialize this trait:
+
+    \code
+    template <>
+    struct QOpcUaBinaryDataEncoding::hasEncodedSize<MyType> : std::true_type {};
+    \endcode
+*/
+
+/*!
+    \fn template<typename T, QOpcUa::Types OVERLAY> qint64 QOpcUaBinaryDataEncoding::encodedArraySize(const QVector<T> &src)
+    \since QtOpcUa 5.15
+
+    Returns the number of bytes \l encodeArray() appends to the data buffer when encoding \a src.
+    Returns \c -1 if \a src can't be encoded.
+
+    \sa encodedSize()
+*/
+
 /*!
     Constructs a binary data encoding object for the data buffer \a buffer.
     \a buffer must not be deleted as long as this binary data encoding object is used.
@@ -203,7 +245,141 @@ bool QOpcUaBinaryDataEncoding::enoughData(int requiredSize)
 {
     if (!m_data)
         return false;
-    return (m_data->size() + m_offset) >= requiredSize;
+    return (m_data->size() - m_offset) >= requiredSize;
+}
+
+// Returns the length of the UTF-8 representation of src as produced by QString::toUtf8()
+qint64 QOpcUaBinaryDataEncoding::utf8Length(const QString &src)
+{
+    qint64 length = 0;
+    const int size = src.size();
+    for (int i = 0; i < size; ++i) {
+        const ushort c = src.at(i).unicode();
+        if (c < 0x80) {
+            length += 1;
+        } else if (c < 0x800) {
+            length += 2;
+        } else if (QChar::isHighSurrogate(c) && i + 1 < size && QChar::isLowSurrogate(src.at(i + 1).unicode())) {
+            length += 4;
+            ++i;
+        } else if (QChar::isSurrogate(c)) {
+            length += 1; // Unpaired surrogates are replaced by '?'
+        } else {
+            length += 3;
+        }
+    }
+    return length;
+}
+
+bool QOpcUaBinaryDataEncoding::prepareNodeIdEncoding(const QString &nodeId, NodeIdEncoding &target)
+{
+    QString identifier;
+    char type;
+    if (!QOpcUa::nodeIdStringSplit(nodeId, &target.namespaceIndex, &identifier, &type))
+        return false;
+
+    switch (type) {
+    case 'i': {
+        bool isNumber;
+        const uint integerIdentifier = identifier.toUInt(&isNumber);
+        if (!isNumber || integerIdentifier > upperBound<quint32>())
+            return false;
+
+        target.numericIdentifier = integerIdentifier;
+        if (integerIdentifier <= 255 && target.namespaceIndex == 0) {
+            // encodingType 0x00 does not transfer the namespace index, it has to be zero
+            // Part 6, Chapter 5.2.2.9, Section "Two Byte NodeId Binary DataEncoding"
+            target.encodingType = 0x00; // 8 bit numeric
+        } else if (integerIdentifier <= 65535 && target.namespaceIndex <= 255) {
+            // encodingType 0x01 transfers only one byte namespace index, has to be in range 0-255
+            // Part 6, Chapter 5.2.2.9, Section "Four Byte NodeId Binary DataEncoding"
+            target.encodingType = 0x01; // 16 bit numeric
+        } else {
+            target.encodingType = 0x02; // 32 bit numeric
+        }
+        return true;
+    }
+    case 's':
+        if (identifier.isEmpty())
+            return false;
+        target.stringIdentifier = identifier;
+        target.encodingType = 0x03; // String
+        return true;
+    case 'g':
+        target.guidIdentifier = QUuid(identifier);
+        if (target.guidIdentifier.isNull())
+            return false;
+        target.encodingType = 0x04; // GUID
+        return true;
+    case 'b':
+        target.byteStringIdentifier = QByteArray::fromBase64(identifier.toLatin1());
+        if (target.byteStringIdentifier.isEmpty())
+            return false;
+        target.encodingType = 0x05; // ByteString
+        return true;
+    default:
+        return false;
+    }
+}
+
+qint64 QOpcUaBinaryDataEncoding::encodedNodeIdSize(const NodeIdEncoding &nodeId)
+{
+    switch (nodeId.encodingType) {
+    case 0x00:
+        return sizeof(quint8) + sizeof(quint8);
+    case 0x01:
+        return sizeof(quint8) + sizeof(quint8) + sizeof(quint16);
+    case 0x02:
+        return sizeof(quint8) + sizeof(quint16) + sizeof(quint32);
+    case 0x03:
+        return sumOfSizes({sizeof(quint8) + sizeof(quint16), encodedSize<QString>(nodeId.stringIdentifier)});
+    case 0x04:
+        return sizeof(quint8) + sizeof(quint16) + encodedSize<QUuid>(nodeId.guidIdentifier);
+    case 0x05:
+        return sumOfSizes({sizeof(quint8) + sizeof(quint16), encodedSize<QByteArray>(nodeId.byteStringIdentifier)});
+    default:
+        return -1;
+    }
+}
+
+bool QOpcUaBinaryDataEncoding::encodeNodeId(const NodeIdEncoding &nodeId)
+{
+    const int oldSize = m_data->size();
+
+    if (!encode<quint8>(nodeId.encodingType))
+        return false;
+
+    bool success = false;
+    switch (nodeId.encodingType) {
+    case 0x00:
+        // encodingType == 0x00 skips namespace completely, defaults to zero
+        // Part 6, Chapter 5.2.2.9, Section "Two Byte NodeId Binary DataEncoding"
+        success = encode<quint8>(static_cast<quint8>(nodeId.numericIdentifier));
+        break;
+    case 0x01:
+        success = encode<quint8>(static_cast<quint8>(nodeId.namespaceIndex))
+                && encode<quint16>(static_cast<quint16>(nodeId.numericIdentifier));
+        break;
+    case 0x02:
+        success = encode<quint16>(nodeId.namespaceIndex) && encode<quint32>(nodeId.numericIdentifier);
+        break;
+    case 0x03:
+        success = encode<quint16>(nodeId.namespaceIndex) && encode<QString>(nodeId.stringIdentifier);
+        break;
+    case 0x04:
+        success = encode<quint16>(nodeId.namespaceIndex) && encode<QUuid>(nodeId.guidIdentifier);
+        break;
+    case 0x05:
+        success = encode<quint16>(nodeId.namespaceIndex) && encode<QByteArray>(nodeId.byteStringIdentifier);
+        break;
+    default:
+        break;
+    }
+
+    if (!success)
+        m_data->resize(oldSize);
+
+    return success;
 }
 
 /*!
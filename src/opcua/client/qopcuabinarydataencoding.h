@@ -57,7 +57,9 @@
 #include <QtCore/qendian.h>
 #include <QtCore/qvector.h>
 
+#include <initializer_list>
 #include <limits>
+#include <type_traits>
 
 QT_BEGIN_NAMESPACE
 
@@ -79,6 +81,14 @@ public:
     template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
     bool encodeArray(const QVector<T> &src);
 
+    template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
+    static qint64 encodedSize(const T &src);
+    template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
+    static qint64 encodedArraySize(const QVector<T> &src);
+
+    // Types with an encodedSize() specialization, encodeArray() reserves the buffer for them in advance
+    template <typename T, QOpcUa::Types OVERLAY = QOpcUa::Types::Undefined>
+    struct hasEncodedSize : std::integral_constant<bool, std::is_arithmetic<T>::value && OVERLAY == QOpcUa::Types::Undefined> {};
 
     int offset() const;
     void setOffset(int offset);
@@ -87,12 +97,84 @@ public:
 private:
     bool enoughData(int requiredSize);
     template <typename T>
-    T upperBound();
+    static T upperBound();
+
+    static qint64 sumOfSizes(std::initializer_list<qint64> sizes);
+    static qint64 utf8Length(const QString &src);
+
+    // The parts of a node id string which are written by the encoder
+    struct NodeIdEncoding {
+        quint8 encodingType{0};
+        quint16 namespaceIndex{0};
+        quint32 numericIdentifier{0};
+        QString stringIdentifier;
+        QUuid guidIdentifier;
+        QByteArray byteStringIdentifier;
+    };
+    static bool prepareNodeIdEncoding(const QString &nodeId, NodeIdEncoding &target);
+    static qint64 encodedNodeIdSize(const NodeIdEncoding &nodeId);
+    bool encodeNodeId(const NodeIdEncoding &nodeId);
+
+    // Arithmetic types without overlay have the same representation in memory and on the wire,
+    // apart from the byte order. Arrays of these types are copied as a block.
+    template <typename T, QOpcUa::Types OVERLAY>
+    using isBlockCopyable = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value
+                                                         && OVERLAY == QOpcUa::Types::Undefined>;
+
+    template <typename T, QOpcUa::Types OVERLAY>
+    QVector<T> decodeArrayElements(int size, bool &success, std::false_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    QVector<T> decodeArrayElements(int size, bool &success, std::true_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool reserveArray(const QVector<T> &src, std::false_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool reserveArray(const QVector<T> &src, std::true_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool encodeArrayElements(const QVector<T> &src, std::false_type);
+    template <typename T, QOpcUa::Types OVERLAY>
+    bool encodeArrayElements(const QVector<T> &src, std::true_type);
 
     QByteArray *m_data{nullptr};
     int m_offset{0};
 };
 
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QString> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QByteArray> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QUuid> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QDateTime> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUa::UaStatusCode> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaQualifiedName> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaLocalizedText> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaRange> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaEUInformation> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaComplexNumber> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaDoubleComplexNumber> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaAxisInformation> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaXValue> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QString, QOpcUa::Types::NodeId> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaExpandedNodeId> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaExtensionObject> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaArgument> : std::true_type {};
+template <>
+struct QOpcUaBinaryDataEncoding::hasEncodedSize<QOpcUaApplicationRecordDataType> : std::true_type {};
+
 template<typename T>
 T QOpcUaBinaryDataEncoding::upperBound()
 {
@@ -100,6 +182,17 @@ T QOpcUaBinaryDataEncoding::upperBound()
     return (std::numeric_limits<T>::max)();
 }
 
+inline qint64 QOpcUaBinaryDataEncoding::sumOfSizes(std::initializer_list<qint64> sizes)
+{
+    qint64 sum = 0;
+    for (const auto size : sizes) {
+        if (size < 0)
+            return -1;
+        sum += size;
+    }
+    return sum;
+}
+
 template<typename T, QOpcUa::Types OVERLAY>
 inline T QOpcUaBinaryDataEncoding::decode(bool &success)
 {
@@ -577,6 +670,175 @@ inline QOpcUaArgument QOpcUaBinaryDataEncoding::decode<QOpcUaArgument>(bool &suc
     return temp;
 }
 
+template<typename T, QOpcUa::Types OVERLAY>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize(const T &src)
+{
+    static_assert(OVERLAY == QOpcUa::Types::Undefined, "Ambiguous types are only permitted for template specializations");
+    static_assert(std::is_arithmetic<T>::value == true, "Non-numeric types are only permitted for template specializations");
+
+    Q_UNUSED(src);
+    return sizeof(T);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<bool>(const bool &src)
+{
+    Q_UNUSED(src);
+    return sizeof(quint8);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QString>(const QString &src)
+{
+    if (src.size() > upperBound<qint32>())
+        return -1;
+    return sizeof(qint32) + utf8Length(src);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QByteArray>(const QByteArray &src)
+{
+    if (src.size() > upperBound<qint32>())
+        return -1;
+    return sizeof(qint32) + src.size();
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QUuid>(const QUuid &src)
+{
+    Q_UNUSED(src);
+    return 16;
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QDateTime>(const QDateTime &src)
+{
+    Q_UNUSED(src);
+    return sizeof(qint64);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUa::UaStatusCode>(const QOpcUa::UaStatusCode &src)
+{
+    Q_UNUSED(src);
+    return sizeof(quint32);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaQualifiedName>(const QOpcUaQualifiedName &src)
+{
+    return sumOfSizes({sizeof(quint16), encodedSize<QString>(src.name())});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaLocalizedText>(const QOpcUaLocalizedText &src)
+{
+    return sumOfSizes({sizeof(quint8),
+                       src.locale().length() ? encodedSize<QString>(src.locale()) : 0,
+                       src.text().length() ? encodedSize<QString>(src.text()) : 0});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaRange>(const QOpcUaRange &src)
+{
+    Q_UNUSED(src);
+    return 2 * sizeof(double);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaEUInformation>(const QOpcUaEUInformation &src)
+{
+    return sumOfSizes({encodedSize<QString>(src.namespaceUri()),
+                       sizeof(qint32),
+                       encodedSize<QOpcUaLocalizedText>(src.displayName()),
+                       encodedSize<QOpcUaLocalizedText>(src.description())});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaComplexNumber>(const QOpcUaComplexNumber &src)
+{
+    Q_UNUSED(src);
+    return 2 * sizeof(float);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaDoubleComplexNumber>(const QOpcUaDoubleComplexNumber &src)
+{
+    Q_UNUSED(src);
+    return 2 * sizeof(double);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaAxisInformation>(const QOpcUaAxisInformation &src)
+{
+    return sumOfSizes({encodedSize<QOpcUaEUInformation>(src.engineeringUnits()),
+                       encodedSize<QOpcUaRange>(src.eURange()),
+                       encodedSize<QOpcUaLocalizedText>(src.title()),
+                       sizeof(quint32),
+                       encodedArraySize<double>(src.axisSteps())});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaXValue>(const QOpcUaXValue &src)
+{
+    Q_UNUSED(src);
+    return sizeof(double) + sizeof(float);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QString, QOpcUa::Types::NodeId>(const QString &src)
+{
+    NodeIdEncoding nodeId;
+    if (!prepareNodeIdEncoding(src, nodeId))
+        return -1;
+    return encodedNodeIdSize(nodeId);
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaExpandedNodeId>(const QOpcUaExpandedNodeId &src)
+{
+    return sumOfSizes({encodedSize<QString, QOpcUa::Types::NodeId>(src.nodeId()),
+                       src.namespaceUri().isEmpty() ? 0 : encodedSize<QString>(src.namespaceUri()),
+                       src.serverIndex() != 0 ? static_cast<qint64>(sizeof(quint32)) : 0});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaExtensionObject>(const QOpcUaExtensionObject &src)
+{
+    return sumOfSizes({encodedSize<QString, QOpcUa::Types::NodeId>(src.encodingTypeId()),
+                       sizeof(quint8),
+                       src.encoding() != QOpcUaExtensionObject::Encoding::NoBody ? encodedSize<QByteArray>(src.encodedBody()) : 0});
+}
+
+template<>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaArgument>(const QOpcUaArgument &src)
+{
+    return sumOfSizes({encodedSize<QString>(src.name()),
+                       encodedSize<QString, QOpcUa::Types::NodeId>(src.dataTypeId()),
+                       sizeof(qint32),
+                       encodedArraySize<quint32>(src.arrayDimensions()),
+                       encodedSize<QOpcUaLocalizedText>(src.description())});
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline qint64 QOpcUaBinaryDataEncoding::encodedArraySize(const QVector<T> &src)
+{
+    if (src.size() > upperBound<qint32>())
+        return -1;
+
+    if (isBlockCopyable<T, OVERLAY>::value)
+        return sizeof(qint32) + static_cast<qint64>(src.size()) * sizeof(T);
+
+    qint64 size = sizeof(qint32);
+    for (const auto &element : src) {
+        const qint64 elementSize = encodedSize<T, OVERLAY>(element);
+        if (elementSize < 0)
+            return -1;
+        size += elementSize;
+    }
+    return size;
+}
+
 template<typename T, QOpcUa::Types OVERLAY>
 inline bool QOpcUaBinaryDataEncoding::encode(const T &src)
 {
@@ -744,7 +1006,7 @@ inline bool QOpcUaBinaryDataEncoding::encode<QByteArray>(const QByteArray &src)
 
     if (!encode<qint32>(src.isNull() ? -1 : src.size()))
         return false;
-    if (src.size() > 1)
+    if (src.size() > 0)
         m_data->append(src);
     return true;
 }
@@ -755,108 +1017,11 @@ inline bool QOpcUaBinaryDataEncoding::encode<QString, QOpcUa::Types::NodeId>(con
     if (!m_data)
         return false;
 
-    quint16 index;
-    QString identifier;
-    char type;
-    if (!QOpcUa::nodeIdStringSplit(src, &index, &identifier, &type))
-        return false;
-
-    qint32 identifierType;
-    switch (type) {
-    case 'i':
-        identifierType = 0;
-        break;
-    case 's':
-        identifierType = 1;
-        break;
-    case 'g':
-        identifierType = 2;
-        break;
-    case 'b':
-        identifierType = 3;
-        break;
-    default:
-        return false;
-    }
-
-    QByteArray encodedIdentifier;
-    QOpcUaBinaryDataEncoding encoder(&encodedIdentifier);
-    quint8 encodingType = 0;
-
-    switch (identifierType) {
-    case 0: {
-        bool isNumber;
-        uint integerIdentifier = identifier.toUInt(&isNumber);
-        if (!isNumber || integerIdentifier > upperBound<quint32>())
-            return false;
-
-        if (integerIdentifier <= 255 && index == 0) {
-            // encodingType 0x00 does not transfer the namespace index, it has to be zero
-            // Part 6, Chapter 5.2.2.9, Section "Two Byte NodeId Binary DataEncoding"
-            if (!encoder.encode<quint8>(integerIdentifier))
-                return false;
-            encodingType = 0x00; // 8 bit numeric
-            break;
-        } else if (integerIdentifier <= 65535 && index <= 255) {
-            // encodingType 0x01 transfers only one byte namespace index, has to be in range 0-255
-            // Part 6, Chapter 5.2.2.9, Section "Four Byte NodeId Binary DataEncoding"
-            if (!encoder.encode<quint16>(integerIdentifier))
-                return false;
-            encodingType = 0x01; // 16 bit numeric
-            break;
-        } else {
-            if (!encoder.encode<quint32>(integerIdentifier))
-                return false;
-            encodingType = 0x02; // 32 bit numeric
-            break;
-        }
-    }
-    case 1: {
-        if (identifier.isEmpty())
-            return false;
-        if (!encoder.encode<QString>(identifier))
-            return false;
-        encodingType = 0x03; // String
-        break;
-    }
-    case 2: {
-        QUuid uuid(identifier);
-        if (uuid.isNull())
-            return false;
-        if (!encoder.encode<QUuid>(uuid))
-            return false;
-        encodingType = 0x04; // GUID
-        break;
-    }
-    case 3: {
-        const QByteArray temp = QByteArray::fromBase64(identifier.toLatin1());
-        if (temp.isEmpty())
-            return false;
-        if (!encoder.encode<QByteArray>(temp))
-            return false;
-        encodingType = 0x05; // ByteString
-        break;
-    }
-    default:
-        return false;
-    }
-
-    if (!encode<quint8>(encodingType))
+    NodeIdEncoding nodeId;
+    if (!prepareNodeIdEncoding(src, nodeId))
         return false;
 
-    if (encodingType == 0x00) {
-        // encodingType == 0x00 skips namespace completely, defaults to zero
-        // Part 6, Chapter 5.2.2.9, Section "Two Byte NodeId Binary DataEncoding"
-    } else if (encodingType == 0x01) {
-        if (!encode<quint8>(index))
-            return false;
-    } else {
-        if (!encode<quint16>(index))
-            return false;
-    }
-
-    m_data->append(encodedIdentifier);
-    return true;
+    return encodeNodeId(nodeId);
 }
 
 template <>
@@ -865,28 +1030,30 @@ inline bool QOpcUaBinaryDataEncoding::encode<QOpcUaExpandedNodeId>(const QOpcUaE
     if (!m_data)
         return false;
 
-    QByteArray temp;
-    QOpcUaBinaryDataEncoding encoder(&temp);
-    if (!encoder.encode<QString, QOpcUa::Types::NodeId>(src.nodeId()))
+    // The flags for the optional fields are added to the encoding mask of the node id after it has been written
+    const int position = m_data->size();
+    if (!encode<QString, QOpcUa::Types::NodeId>(src.nodeId()))
         return false;
 
-    quint8 mask = temp.at(0);
+    quint8 mask = m_data->at(position);
 
     if (!src.namespaceUri().isEmpty()) {
         mask |= 0x80;
-        if (!encoder.encode<QString>(src.namespaceUri()))
+        if (!encode<QString>(src.namespaceUri())) {
+            m_data->resize(position);
             return false;
+        }
     }
 
     if (src.serverIndex() != 0) {
         mask |= 0x40;
-        if (!encoder.encode<quint32>(src.serverIndex()))
+        if (!encode<quint32>(src.serverIndex())) {
+            m_data->resize(position);
             return false;
+        }
     }
 
-    temp[0] = mask;
-
-    m_data->append(temp);
+    (*m_data)[position] = static_cast<char>(mask);
     return true;
 }
 
@@ -943,32 +1110,42 @@ inline bool QOpcUaBinaryDataEncoding::encode<QOpcUaArgument>(const QOpcUaArgumen
     if (!m_data)
         return false;
 
-    QByteArray temp;
-    QOpcUaBinaryDataEncoding encoder(&temp);
-    if (!encoder.encode<QString>(src.name()))
-        return false;
-    if (!encoder.encode<QString, QOpcUa::Types::NodeId>(src.dataTypeId()))
-        return false;
+    // Remove the already written fields if one of the fields can't be encoded
+    const int oldSize = m_data->size();
+    const bool success = encode<QString>(src.name())
+            && encode<QString, QOpcUa::Types::NodeId>(src.dataTypeId())
+            && encode<qint32>(src.valueRank())
+            && encodeArray<quint32>(src.arrayDimensions())
+            && encode<QOpcUaLocalizedText>(src.description());
 
-    if (!encoder.encode<qint32>(src.valueRank()))
-        return false;
-    if (!encoder.encodeArray<quint32>(src.arrayDimensions()))
-        return false;
-    if (!encoder.encode<QOpcUaLocalizedText>(src.description()))
-        return false;
-    m_data->append(temp);
+    if (!success)
+        m_data->resize(oldSize);
 
-    return true;
+    return success;
 }
 
 template<typename T, QOpcUa::Types OVERLAY>
 inline QVector<T> QOpcUaBinaryDataEncoding::decodeArray(bool &success)
 {
-    QVector<T> temp;
-
     qint32 size = decode<qint32>(success);
-    if (!success)
-        return temp;
+    if (!success || size <= 0)
+        return QVector<T>();
+
+    // Each element occupies at least one byte, reject sizes which exceed the remaining data
+    // before memory for the elements is allocated.
+    if (!enoughData(size)) {
+        success = false;
+        return QVector<T>();
+    }
+
+    return decodeArrayElements<T, OVERLAY>(size, success, isBlockCopyable<T, OVERLAY>());
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline QVector<T> QOpcUaBinaryDataEncoding::decodeArrayElements(int size, bool &success, std::false_type)
+{
+    QVector<T> temp;
+    temp.reserve(size);
 
     for (int i = 0; i < size; ++i) {
         temp.push_back(decode<T, OVERLAY>(success));
@@ -979,6 +1156,24 @@ inline QVector<T> QOpcUaBinaryDataEncoding::decodeArray(bool &success)
     return temp;
 }
 
+template<typename T, QOpcUa::Types OVERLAY>
+inline QVector<T> QOpcUaBinaryDataEncoding::decodeArrayElements(int size, bool &success, std::true_type)
+{
+    const qint64 byteCount = static_cast<qint64>(size) * sizeof(T);
+    if (byteCount > upperBound<int>() || !enoughData(static_cast<int>(byteCount))) {
+        success = false;
+        return QVector<T>();
+    }
+
+    QVector<T> temp(size);
+    // Copies the data on little endian hosts and swaps the byte order of all elements otherwise
+    qFromLittleEndian<T>(m_data->constData() + m_offset, size, temp.data());
+    m_offset += static_cast<int>(byteCount);
+
+    success = true;
+    return temp;
+}
+
 template<typename T, QOpcUa::Types OVERLAY>
 inline bool QOpcUaBinaryDataEncoding::encodeArray(const QVector<T> &src)
 {
@@ -987,6 +1182,39 @@ inline bool QOpcUaBinaryDataEncoding::encodeArray(const QVector<T> &src)
 
     if (!encode<qint32>(src.size()))
         return false;
+
+    return encodeArrayElements<T, OVERLAY>(src, isBlockCopyable<T, OVERLAY>());
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::reserveArray(const QVector<T> &src, std::false_type)
+{
+    // The size of types without encodedSize() specialization is unknown, the buffer grows while encoding
+    Q_UNUSED(src);
+    return true;
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::reserveArray(const QVector<T> &src, std::true_type)
+{
+    // Make sure the buffer grows only once for the whole array
+    const qint64 size = encodedArraySize<T, OVERLAY>(src) - static_cast<qint64>(sizeof(qint32));
+    if (size < 0 || size > upperBound<int>() - m_data->size())
+        return false;
+    if (m_data->capacity() - m_data->size() < size)
+        m_data->reserve(m_data->size() + static_cast<int>(size));
+    return true;
+}
+
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::encodeArrayElements(const QVector<T> &src, std::false_type)
+{
+    if (!m_data)
+        return false;
+
+    if (!reserveArray<T, OVERLAY>(src, hasEncodedSize<T, OVERLAY>()))
+        return false;
+
     for (const auto &element : src) {
         if (!encode<T, OVERLAY>(element))
             return false;
@@ -994,6 +1222,22 @@ inline bool QOpcUaBinaryDataEncoding::encodeArray(const QVector<T> &src)
     return true;
 }
 
+template<typename T, QOpcUa::Types OVERLAY>
+inline bool QOpcUaBinaryDataEncoding::encodeArrayElements(const QVector<T> &src, std::true_type)
+{
+    if (!m_data)
+        return false;
+
+    const qint64 byteCount = static_cast<qint64>(src.size()) * sizeof(T);
+    if (byteCount > upperBound<int>() - m_data->size())
+        return false;
+
+    const int oldSize = m_data->size();
+    m_data->resize(oldSize + static_cast<int>(byteCount));
+    qToLittleEndian<T>(src.constData(), src.size(), m_data->data() + oldSize);
+    return true;
+}
+
 template <>
 inline QOpcUaApplicationRecordDataType QOpcUaBinaryDataEncoding::decode<QOpcUaApplicationRecordDataType>(bool &success)
 {
@@ -1030,6 +1274,18 @@ inline QOpcUaApplicationRecordDataType QOpcUaBinaryDataEncoding::decode<QOpcUaAp
     return temp;
 }
 
+template <>
+inline qint64 QOpcUaBinaryDataEncoding::encodedSize<QOpcUaApplicationRecordDataType>(const QOpcUaApplicationRecordDataType &src)
+{
+    return sumOfSizes({encodedSize<QString, QOpcUa::Types::NodeId>(src.applicationId()),
+                       encodedSize<QString>(src.applicationUri()),
+                       sizeof(quint32),
+                       encodedArraySize<QOpcUaLocalizedText>(src.applicationNames()),
+                       encodedSize<QString>(src.productUri()),
+                       encodedArraySize<QString>(src.discoveryUrls()),
+                       encodedArraySize<QString>(src.serverCapabilityIdentifiers())});
+}
+
 template <>
 inline bool QOpcUaBinaryDataEncoding::encode<QOpcUaApplicationRecordDataType>(const QOpcUaApplicationRecordDataType &src)
 {
@@ -0,0 +1,396 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuabrowseresult.h"
+#include "qopcuabrowseresult_p.h"
+
+#include <QtOpcUa/qopcuaexpandednodeid.h>
+#include <QtOpcUa/qopcualocalizedtext.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+#include <QtOpcUa/qopcuareferencedescription.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaBrowseResult
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief Contains the references returned by a browse operation in a compact form.
+
+    QOpcUaBrowseResult stores the fields of all references in separate arrays instead of creating
+    a \l QOpcUaReferenceDescription for each reference. Node ids are stored in binary form and all
+    names share one string buffer. This makes browsing nodes with a large number of references much
+    cheaper in terms of allocations and memory.
+
+    The fields of a reference are returned by the accessors which take the index of the reference.
+    \l at() and \l toReferenceDescriptions() convert references to \l QOpcUaReferenceDescription
+    when they are needed.
+
+    \code
+    QObject::connect(node, &QOpcUaNode::columnarBrowseFinished, [](QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode) {
+        for (int i = 0; i < result.size(); ++i) {
+            if (result.nodeClass(i) == QOpcUa::NodeClass::Variable)
+                qDebug() << result.browseName(i).name();
+        }
+    });
+    \endcode
+
+    \sa QOpcUaNode::columnarBrowseFinished()
+*/
+
+QOpcUaBrowseResultPrivate::Span QOpcUaBrowseResultPrivate::appendUtf8(const char *data, int size)
+{
+    Span span;
+    span.offset = strings.size();
+    if (size <= 0)
+        return span;
+
+    bool isAscii = true;
+    for (int i = 0; i < size && isAscii; ++i)
+        isAscii = static_cast<uchar>(data[i]) < 0x80;
+
+    // Avoid the temporary string of fromUtf8() for the common case of ASCII names
+    if (isAscii)
+        strings.append(QLatin1String(data, size));
+    else
+        strings.append(QString::fromUtf8(data, size));
+
+    span.length = strings.size() - span.offset;
+    return span;
+}
+
+QOpcUaBrowseResultPrivate::Span QOpcUaBrowseResultPrivate::appendLatin1(const char *data, int size)
+{
+    Span span;
+    span.offset = strings.size();
+    if (size > 0) {
+        strings.append(QLatin1String(data, size));
+        span.length = size;
+    }
+    return span;
+}
+
+QOpcUaBrowseResultPrivate::Span QOpcUaBrowseResultPrivate::appendString(const QString &value)
+{
+    Span span;
+    span.offset = strings.size();
+    span.length = value.size();
+    strings.append(value);
+    return span;
+}
+
+QOpcUaBrowseResultPrivate::NodeId QOpcUaBrowseResultPrivate::appendNodeId(const QString &nodeId)
+{
+    NodeId result;
+    QString identifier;
+    if (!QOpcUa::nodeIdStringSplit(nodeId, &result.namespaceIndex, &identifier, &result.identifierType)) {
+        result.identifierType = 0;
+        result.identifier = appendString(nodeId);
+        return result;
+    }
+
+    if (result.identifierType == 'i') {
+        bool ok = false;
+        result.numericIdentifier = identifier.toUInt(&ok);
+        if (ok)
+            return result;
+        // Keep the original string for malformed numeric identifiers
+        result.identifierType = 0;
+        result.identifier = appendString(nodeId);
+        return result;
+    }
+
+    result.identifier = appendString(identifier);
+    return result;
+}
+
+int QOpcUaBrowseResultPrivate::appendPooledString(const QString &value)
+{
+    // Strings from the pool share their data, the data pointer identifies them
+    const auto it = pooledStringIndices.constFind(value.constData());
+    if (it != pooledStringIndices.constEnd())
+        return it.value();
+
+    const int index = pooledStrings.size();
+    pooledStrings.push_back(value);
+    pooledStringIndices.insert(value.constData(), index);
+    return index;
+}
+
+QString QOpcUaBrowseResultPrivate::string(Span span) const
+{
+    if (!span.length)
+        return QString();
+    return QString(strings.constData() + span.offset, span.length);
+}
+
+QString QOpcUaBrowseResultPrivate::nodeIdString(const NodeId &nodeId) const
+{
+    if (nodeId.pooledString >= 0)
+        return pooledStrings.at(nodeId.pooledString);
+
+    if (!nodeId.identifierType)
+        return string(nodeId.identifier);
+
+    QString result = QLatin1String("ns=") + QString::number(nodeId.namespaceIndex) + QLatin1Char(';')
+            + QLatin1Char(nodeId.identifierType) + QLatin1Char('=');
+    if (nodeId.identifierType == 'i')
+        result.append(QString::number(nodeId.numericIdentifier));
+    else
+        result.append(strings.constData() + nodeId.identifier.offset, nodeId.identifier.length);
+    return result;
+}
+
+QOpcUaExpandedNodeId QOpcUaBrowseResultPrivate::expandedNodeId(const ExpandedNodeId &nodeId) const
+{
+    return QOpcUaExpandedNodeId(string(nodeId.namespaceUri), nodeIdString(nodeId.nodeId), nodeId.serverIndex);
+}
+
+void QOpcUaBrowseResultPrivate::reserve(int size)
+{
+    targetNodeIds.reserve(size);
+    typeDefinitions.reserve(size);
+    refTypeIds.reserve(size);
+    browseNameNamespaces.reserve(size);
+    browseNames.reserve(size);
+    displayNameLocales.reserve(size);
+    displayNameTexts.reserve(size);
+    nodeClasses.reserve(size);
+    isForwardReferences.reserve(size);
+}
+
+void QOpcUaBrowseResultPrivate::clear()
+{
+    strings.clear();
+    pooledStrings.clear();
+    pooledStringIndices.clear();
+    targetNodeIds.clear();
+    typeDefinitions.clear();
+    refTypeIds.clear();
+    browseNameNamespaces.clear();
+    browseNames.clear();
+    displayNameLocales.clear();
+    displayNameTexts.clear();
+    nodeClasses.clear();
+    isForwardReferences.clear();
+}
+
+/*!
+    Constructs an empty browse result.
+*/
+QOpcUaBrowseResult::QOpcUaBrowseResult()
+    : d_ptr(new QOpcUaBrowseResultPrivate())
+{
+}
+
+/*!
+    Constructs a browse result from \a other.
+*/
+QOpcUaBrowseResult::QOpcUaBrowseResult(const QOpcUaBrowseResult &other)
+    : d_ptr(other.d_ptr)
+{
+}
+
+/*!
+    Sets the values from \a other in this browse result.
+*/
+QOpcUaBrowseResult &QOpcUaBrowseResult::operator=(const QOpcUaBrowseResult &other)
+{
+    if (this != &other)
+        d_ptr = other.d_ptr;
+    return *this;
+}
+
+QOpcUaBrowseResult::~QOpcUaBrowseResult()
+{
+}
+
+/*!
+    Returns the number of references in this browse result.
+*/
+int QOpcUaBrowseResult::size() const
+{
+    return d_ptr->nodeClasses.size();
+}
+
+/*!
+    Returns \c true if this browse result contains no references.
+*/
+bool QOpcUaBrowseResult::isEmpty() const
+{
+    return d_ptr->nodeClasses.isEmpty();
+}
+
+/*!
+    Reserves space for \a size references.
+*/
+void QOpcUaBrowseResult::reserve(int size)
+{
+    d_ptr->reserve(size);
+}
+
+/*!
+    Removes all references from this browse result.
+*/
+void QOpcUaBrowseResult::clear()
+{
+    d_ptr->clear();
+}
+
+/*!
+    Appends the content of \a reference to this browse result.
+*/
+void QOpcUaBrowseResult::append(const QOpcUaReferenceDescription &reference)
+{
+    QOpcUaBrowseResultPrivate *d = d_ptr.data();
+
+    QOpcUaBrowseResultPrivate::ExpandedNodeId target;
+    target.nodeId = d->appendNodeId(reference.targetNodeId().nodeId());
+    target.namespaceUri = d->appendString(reference.targetNodeId().namespaceUri());
+    target.serverIndex = reference.targetNodeId().serverIndex();
+    d->targetNodeIds.push_back(target);
+
+    QOpcUaBrowseResultPrivate::ExpandedNodeId typeDefinition;
+    typeDefinition.nodeId = d->appendNodeId(reference.typeDefinition().nodeId());
+    typeDefinition.namespaceUri = d->appendString(reference.typeDefinition().namespaceUri());
+    typeDefinition.serverIndex = reference.typeDefinition().serverIndex();
+    d->typeDefinitions.push_back(typeDefinition);
+
+    d->refTypeIds.push_back(d->appendNodeId(reference.refTypeId()));
+    d->browseNameNamespaces.push_back(reference.browseName().namespaceIndex());
+    d->browseNames.push_back(d->appendString(reference.browseName().name()));
+    d->displayNameLocales.push_back(d->appendString(reference.displayName().locale()));
+    d->displayNameTexts.push_back(d->appendString(reference.displayName().text()));
+    d->nodeClasses.push_back(static_cast<quint8>(reference.nodeClass()));
+    d->isForwardReferences.push_back(reference.isForwardReference());
+}
+
+/*!
+    Returns the reference type id of the reference at \a index.
+*/
+QString QOpcUaBrowseResult::refTypeId(int index) const
+{
+    return d_ptr->nodeIdString(d_ptr->refTypeIds.at(index));
+}
+
+/*!
+    Returns the node id of the target node of the reference at \a index.
+*/
+QOpcUaExpandedNodeId QOpcUaBrowseResult::targetNodeId(int index) const
+{
+    return d_ptr->expandedNodeId(d_ptr->targetNodeIds.at(index));
+}
+
+/*!
+    Returns the type definition of the target node of the reference at \a index.
+*/
+QOpcUaExpandedNodeId QOpcUaBrowseResult::typeDefinition(int index) const
+{
+    return d_ptr->expandedNodeId(d_ptr->typeDefinitions.at(index));
+}
+
+/*!
+    Returns the browse name of the target node of the reference at \a index.
+*/
+QOpcUaQualifiedName QOpcUaBrowseResult::browseName(int index) const
+{
+    return QOpcUaQualifiedName(d_ptr->browseNameNamespaces.at(index), d_ptr->string(d_ptr->browseNames.at(index)));
+}
+
+/*!
+    Returns the display name of the target node of the reference at \a index.
+*/
+QOpcUaLocalizedText QOpcUaBrowseResult::displayName(int index) const
+{
+    return QOpcUaLocalizedText(d_ptr->string(d_ptr->displayNameLocales.at(index)),
+                               d_ptr->string(d_ptr->displayNameTexts.at(index)));
+}
+
+/*!
+    Returns the node class of the target node of the reference at \a index.
+*/
+QOpcUa::NodeClass QOpcUaBrowseResult::nodeClass(int index) const
+{
+    return static_cast<QOpcUa::NodeClass>(d_ptr->nodeClasses.at(index));
+}
+
+/*!
+    Returns \c true if the reference at \a index is a forward reference.
+*/
+bool QOpcUaBrowseResult::isForwardReference(int index) const
+{
+    return d_ptr->isForwardReferences.at(index);
+}
+
+/*!
+    Returns the reference at \a index as \l QOpcUaReferenceDescription.
+*/
+QOpcUaReferenceDescription QOpcUaBrowseResult::at(int index) const
+{
+    QOpcUaReferenceDescription temp;
+    temp.setRefTypeId(refTypeId(index));
+    temp.setTargetNodeId(targetNodeId(index));
+    temp.setTypeDefinition(typeDefinition(index));
+    temp.setBrowseName(browseName(index));
+    temp.setDisplayName(displayName(index));
+    temp.setNodeClass(nodeClass(index));
+    temp.setIsForwardReference(isForwardReference(index));
+    return temp;
+}
+
+/*!
+    Returns all references of this browse result as \l QOpcUaReferenceDescription.
+*/
+QVector<QOpcUaReferenceDescription> QOpcUaBrowseResult::toReferenceDescriptions() const
+{
+    QVector<QOpcUaReferenceDescription> result;
+    result.reserve(size());
+    for (int i = 0; i < size(); ++i)
+        result.push_back(at(i));
+    return result;
+}
+
+/*!
+    \typedef QOpcUaBrowseResult::DataPtr
+    \internal
+*/
+
+/*!
+    \fn QOpcUaBrowseResult::DataPtr &QOpcUaBrowseResult::data_ptr()
+    \internal
+*/
+
+QT_END_NAMESPACE
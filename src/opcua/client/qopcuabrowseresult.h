@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUABROWSERESULT_H
+#define QOPCUABROWSERESULT_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaExpandedNodeId;
+class QOpcUaQualifiedName;
+class QOpcUaLocalizedText;
+class QOpcUaReferenceDescription;
+
+class QOpcUaBrowseResultPrivate;
+class Q_OPCUA_EXPORT QOpcUaBrowseResult
+{
+public:
+    QOpcUaBrowseResult();
+    QOpcUaBrowseResult(const QOpcUaBrowseResult &other);
+    QOpcUaBrowseResult &operator=(const QOpcUaBrowseResult &other);
+    ~QOpcUaBrowseResult();
+
+    int size() const;
+    bool isEmpty() const;
+    void reserve(int size);
+    void clear();
+
+    void append(const QOpcUaReferenceDescription &reference);
+
+    QString refTypeId(int index) const;
+    QOpcUaExpandedNodeId targetNodeId(int index) const;
+    QOpcUaExpandedNodeId typeDefinition(int index) const;
+    QOpcUaQualifiedName browseName(int index) const;
+    QOpcUaLocalizedText displayName(int index) const;
+    QOpcUa::NodeClass nodeClass(int index) const;
+    bool isForwardReference(int index) const;
+
+    QOpcUaReferenceDescription at(int index) const;
+    QVector<QOpcUaReferenceDescription> toReferenceDescriptions() const;
+
+    typedef QSharedDataPointer<QOpcUaBrowseResultPrivate> DataPtr;
+    inline DataPtr &data_ptr() { return d_ptr; }
+
+private:
+    QSharedDataPointer<QOpcUaBrowseResultPrivate> d_ptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaBrowseResult, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaBrowseResult)
+
+#endif // QOPCUABROWSERESULT_H
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUABROWSERESULT_P_H
+#define QOPCUABROWSERESULT_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuabrowseresult.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Stores the references in one vector per field. All strings are kept in one arena,
+// node ids are stored binary and converted to strings when they are requested.
+class Q_OPCUA_EXPORT QOpcUaBrowseResultPrivate : public QSharedData
+{
+public:
+    struct Span {
+        int offset = 0;
+        int length = 0;
+    };
+
+    struct NodeId {
+        quint32 numericIdentifier = 0;
+        Span identifier; // Non-numeric identifiers in the form used by node id strings
+        int pooledString = -1; // Index in pooledStrings if the backend interned the node id string
+        quint16 namespaceIndex = 0;
+        char identifierType = 'i'; // 0 if the node id string could not be split
+    };
+
+    struct ExpandedNodeId {
+        NodeId nodeId;
+        Span namespaceUri;
+        quint32 serverIndex = 0;
+    };
+
+    Span appendUtf8(const char *data, int size);
+    Span appendLatin1(const char *data, int size);
+    Span appendString(const QString &value);
+    NodeId appendNodeId(const QString &nodeId);
+    int appendPooledString(const QString &value);
+
+    QString string(Span span) const;
+    QString nodeIdString(const NodeId &nodeId) const;
+    QOpcUaExpandedNodeId expandedNodeId(const ExpandedNodeId &nodeId) const;
+
+    void reserve(int size);
+    void clear();
+
+    QString strings;
+    // Interned strings are kept as QString to share their data with the string pool of the backend
+    QVector<QString> pooledStrings;
+    QHash<const QChar *, int> pooledStringIndices;
+    QVector<ExpandedNodeId> targetNodeIds;
+    QVector<ExpandedNodeId> typeDefinitions;
+    QVector<NodeId> refTypeIds;
+    QVector<quint16> browseNameNamespaces;
+    QVector<Span> browseNames;
+    QVector<Span> displayNameLocales;
+    QVector<Span> displayNameTexts;
+    QVector<quint8> nodeClasses;
+    QVector<quint8> isForwardReferences;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaBrowseResultPrivate::Span, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QOpcUaBrowseResultPrivate::NodeId, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QOpcUaBrowseResultPrivate::ExpandedNodeId, Q_PRIMITIVE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUABROWSERESULT_P_H
@@ -40,6 +40,8 @@
 #include "qopcuaqualifiedname.h"
 
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuadatachangequeue_p.h>
+#include <private/qopcuanode_p.h>
 
 #include <QtCore/qloggingcategory.h>
 
@@ -140,6 +142,23 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
            The given type or data of authentication information is not supported.
 */
 
+/*!
+    \enum QOpcUaClient::DataChangeOverflowPolicy
+    \since QtOpcUa 5.15
+
+    This enum type specifies how data changes are handled if the number of data changes waiting
+    to be delivered to the client thread has reached the \l dataChangeQueueLimit().
+
+    \value DropOldest
+           The oldest pending data change is discarded.
+    \value KeepLatest
+           The pending value of the same monitored item is replaced by the new value.
+           If there is no pending value for the monitored item, the oldest pending data change is discarded.
+    \value Block
+           The backend waits until the client thread has taken the pending data changes.
+           No values are lost, but the server may discard notifications if the client stops publishing.
+*/
+
 /*!
     \property QOpcUaClient::error
     \brief Specifies the current error state of the client.
@@ -293,6 +312,89 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     \a statusCode contains the result of the operation.
 */
 
+/*!
+    \fn void QOpcUaClient::addNodesFinished(QVector<QOpcUaAddNodeItem> nodesToAdd, QStringList assignedNodeIds, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after an \l addNodes() operation has finished.
+
+    \a nodesToAdd contains the items from the \l addNodes() call. \a assignedNodeIds and \a results have the same
+    order as \a nodesToAdd and contain the node id assigned by the server and the status code for each item.
+    If the status code of an item is not \l {QOpcUa::UaStatusCode} {Good}, the assigned node id is empty.
+
+    \a serviceResult is \l {QOpcUa::UaStatusCode} {Good} if all AddNodes requests have been successful,
+    otherwise it contains the service result of the first failed request.
+
+    \sa addNodes()
+*/
+
+/*!
+    \fn void QOpcUaClient::deleteNodesFinished(QStringList nodeIds, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after a \l deleteNodes() operation has finished.
+    \a nodeIds contains the node ids from the \l deleteNodes() call, \a results contains the status code for each node.
+    \a serviceResult contains the result of the DeleteNodes service.
+
+    \sa deleteNodes()
+*/
+
+/*!
+    \fn void QOpcUaClient::addReferencesFinished(QVector<QOpcUaAddReferenceItem> referencesToAdd, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after an \l addReferences() operation has finished.
+    \a referencesToAdd contains the items from the \l addReferences() call, \a results contains the status code for each item.
+    \a serviceResult contains the result of the AddReferences service.
+
+    \sa addReferences()
+*/
+
+/*!
+    \fn void QOpcUaClient::deleteReferencesFinished(QVector<QOpcUaDeleteReferenceItem> referencesToDelete, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after a \l deleteReferences() operation has finished.
+    \a referencesToDelete contains the items from the \l deleteReferences() call, \a results contains the status code for each item.
+    \a serviceResult contains the result of the DeleteReferences service.
+
+    \sa deleteReferences()
+*/
+
+/*!
+    \fn void QOpcUaClient::historyDataAvailable(QVector<QOpcUaHistoryData> data)
+    \since QtOpcUa 5.15
+
+    This signal is emitted for every chunk of historical values received as part of a
+    \l readHistoryData() or \l readModifiedHistoryData() operation.
+    \a data contains one entry for each node which was part of the HistoryRead request.
+
+    \sa readHistoryData() readHistoryDataFinished()
+*/
+
+/*!
+    \fn void QOpcUaClient::processedHistoryDataAvailable(QVector<QOpcUaProcessedHistoryData> data)
+    \since QtOpcUa 5.15
+
+    This signal is emitted for every chunk of aggregated values received as part of a
+    \l readHistoryProcessed() operation.
+    \a data contains one entry for each node which was part of the HistoryRead request.
+
+    \sa readHistoryProcessed() readHistoryDataFinished()
+*/
+
+/*!
+    \fn void QOpcUaClient::readHistoryDataFinished(QVector<QOpcUaHistoryReadItem> nodesToRead, QOpcUa::UaStatusCode serviceResult)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after all chunks of a \l readHistoryData(), \l readModifiedHistoryData() or
+    \l readHistoryProcessed() operation have been delivered by \l historyDataAvailable() or
+    \l processedHistoryDataAvailable().
+    \a nodesToRead contains the items from the request, \a serviceResult contains the result of the last HistoryRead service call.
+
+    \sa readHistoryData() historyDataAvailable()
+*/
+
 /*!
     \internal QOpcUaClientImpl is an opaque type (as seen from the public API).
     This prevents users of the public API to use this constructor (eventhough
@@ -456,6 +558,25 @@ QOpcUaNode *QOpcUaClient::node(const QOpcUaExpandedNodeId &expandedNodeId)
         return nullptr;
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Returns a \l QOpcUaNode object associated with the namespace 0 node identified
+    by \a id. The caller becomes owner of the node object.
+
+    The backends create the node from the numeric identifier without parsing a node id string.
+
+    If the client is not connected, \c nullptr is returned.
+*/
+QOpcUaNode *QOpcUaClient::node(QOpcUa::NodeIds::Namespace0 id)
+{
+    if (state() != QOpcUaClient::Connected)
+       return nullptr;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->node(id);
+}
+
 /*!
     Requests an update of the namespace array from the server.
     Returns \c true if the operation has been successfully dispatched.
@@ -699,6 +820,267 @@ bool QOpcUaClient::deleteReference(const QOpcUaDeleteReferenceItem &referenceToD
     return d->m_impl->deleteReference(referenceToDelete);
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Adds all nodes described by \a nodesToAdd on the server.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    All items are sent to the server in a single AddNodes request. If the server limits the number of
+    items per request (MaxNodesPerNodeManagement), the items are split into the minimum number of requests
+    allowed by the server. The results for all items are returned in a single \l addNodesFinished() signal.
+
+    This is the preferred way to create a large number of nodes because it avoids one round trip per node.
+
+    \sa addNode() deleteNodes() addNodesFinished()
+*/
+bool QOpcUaClient::addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->addNodes(nodesToAdd);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Deletes all nodes in \a nodeIds from the server.
+    If \a deleteTargetReferences is \c false, only the references with one of the nodes as source are deleted.
+    If \a deleteTargetReferences is \c true, references with one of the nodes as target are deleted too.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The nodes are deleted using as few DeleteNodes requests as the server's operation limits allow.
+    The results are returned in the \l deleteNodesFinished() signal.
+
+    \sa deleteNode() addNodes() deleteNodesFinished()
+*/
+bool QOpcUaClient::deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->deleteNodes(nodeIds, deleteTargetReferences);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Adds all references described by \a referencesToAdd to the server.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The references are added using as few AddReferences requests as the server's operation limits allow.
+    The results are returned in the \l addReferencesFinished() signal.
+
+    \sa addReference() deleteReferences() addReferencesFinished()
+*/
+bool QOpcUaClient::addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->addReferences(referencesToAdd);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Deletes all references described by \a referencesToDelete from the server.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The references are deleted using as few DeleteReferences requests as the server's operation limits allow.
+    The results are returned in the \l deleteReferencesFinished() signal.
+
+    \sa deleteReference() addReferences() deleteReferencesFinished()
+*/
+bool QOpcUaClient::deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->deleteReferences(referencesToDelete);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Starts a read of the raw historical values of \a nodesToRead between \a startTime and \a endTime.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    \a numValuesPerNode limits the number of values the server returns per node in a single response.
+    Continuation points returned by the server are followed automatically and each response is delivered
+    in the \l historyDataAvailable() signal as soon as it arrives, so the complete history never has to be
+    kept in memory. A value of \c 0 leaves the chunk size to the server.
+    If \a returnBounds is \c true, the bounding values are returned as well.
+
+    The \l readHistoryDataFinished() signal is emitted after the last chunk has been delivered.
+
+    \sa readModifiedHistoryData() historyDataAvailable() readHistoryDataFinished()
+*/
+bool QOpcUaClient::readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                   const QDateTime &endTime, quint32 numValuesPerNode, bool returnBounds)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->readHistoryData(nodesToRead, startTime, endTime, numValuesPerNode, returnBounds, false);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Starts a read of the modified historical values of \a nodesToRead between \a startTime and \a endTime.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    This method behaves like \l readHistoryData() but requests the values which have been replaced or deleted
+    in the history instead of the current historical values. \a numValuesPerNode limits the number of values
+    the server returns per node in a single response.
+
+    \sa readHistoryData() historyDataAvailable() readHistoryDataFinished()
+*/
+bool QOpcUaClient::readModifiedHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                           const QDateTime &endTime, quint32 numValuesPerNode)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->readHistoryData(nodesToRead, startTime, endTime, numValuesPerNode, false, true);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Starts a read of aggregated historical values of \a nodesToRead between \a startTime and \a endTime.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The server divides the time range into intervals of \a processingInterval milliseconds and calculates
+    one value per interval using the aggregate function set by \l QOpcUaHistoryReadItem::setAggregateType().
+    A \a processingInterval of \c 0 requests a single value for the complete time range.
+    The aggregate configuration of the server is used.
+
+    The results are delivered in the \l processedHistoryDataAvailable() signal. Each \l QOpcUaProcessedHistoryData
+    stores timestamps, values and status codes in separate arrays, so long trends can be handed to plotting
+    or statistics code without converting each value from a \l QVariant.
+    The \l readHistoryDataFinished() signal is emitted after the last chunk has been delivered.
+
+    \sa readHistoryData() processedHistoryDataAvailable() readHistoryDataFinished()
+*/
+bool QOpcUaClient::readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                        const QDateTime &endTime, double processingInterval)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->readHistoryProcessed(nodesToRead, startTime, endTime, processingInterval);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Creates monitored items for the attribute \a attr of all \a nodes using the parameters \a settings.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+
+    Enabling the monitoring of many nodes with \l QOpcUaNode::enableMonitoring() requires one service call
+    per node. This method adds the monitored items with one CreateMonitoredItems request per subscription.
+    If the server limits the number of monitored items per call, the items are split into several requests.
+
+    After the call has finished, \l QOpcUaNode::enableMonitoringFinished() is emitted for each of the \a nodes.
+
+    \code
+    QVector<QOpcUaNode *> screen; // All nodes shown on the current screen
+    m_client->enableMonitoring(screen, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    \endcode
+
+    Nodes which have not been created by this client are ignored. Backends without support for batched requests
+    create the items one by one.
+
+    \sa QOpcUaNode::enableMonitoring(), modifyMonitoring()
+*/
+bool QOpcUaClient::enableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attr,
+                                    const QOpcUaMonitoringParameters &settings)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    QVector<quint64> handles;
+    QStringList nodeIds;
+    handles.reserve(nodes.size());
+    nodeIds.reserve(nodes.size());
+    for (QOpcUaNode *node : nodes) {
+        if (node && node->client() == this && node->d_func()->m_impl) {
+            handles.append(node->d_func()->m_impl->handle());
+            nodeIds.append(node->nodeId());
+        }
+    }
+
+    if (handles.isEmpty())
+        return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->enableMonitoring(handles, nodeIds, attr, settings);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Sets the parameter \a item of the monitored items for the attribute \a attr of all \a nodes to \a value.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+
+    Changing the monitoring mode, the sampling interval, the queue size, the discard policy or the filter
+    of many monitored items with \l QOpcUaNode::modifyMonitoring() requires one service call per item.
+    This method sends one request per subscription instead. Parameters of a subscription are modified once for
+    each subscription the items belong to.
+
+    After the call has finished, \l QOpcUaNode::monitoringStatusChanged() is emitted for each of the \a nodes.
+
+    \code
+    QVector<QOpcUaNode *> previousScreen; // Stop reporting for the nodes of the screen which is hidden
+    m_client->modifyMonitoring(previousScreen, QOpcUa::NodeAttribute::Value,
+                               QOpcUaMonitoringParameters::Parameter::MonitoringMode,
+                               QVariant::fromValue(QOpcUaMonitoringParameters::MonitoringMode::Disabled));
+    \endcode
+
+    Nodes which have not been created by this client are ignored. Backends without support for batched requests
+    modify the items one by one.
+
+    \sa QOpcUaNode::modifyMonitoring()
+*/
+bool QOpcUaClient::modifyMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attr,
+                                    QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    QVector<quint64> handles;
+    handles.reserve(nodes.size());
+    for (const QOpcUaNode *node : nodes) {
+        if (node && node->client() == this && node->d_func()->m_impl)
+            handles.append(node->d_func()->m_impl->handle());
+    }
+
+    if (handles.isEmpty())
+        return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->modifyMonitoring(handles, attr, item, value);
+}
+
 /*!
     Starts an asynchronous \c GetEndpoints request to read a list of available endpoints
     from the server at \a url.
@@ -883,6 +1265,78 @@ int QOpcUaClient::namespaceAutoupdateInterval() const
     return d->m_namespaceArrayUpdateInterval;
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Sets the maximum number of data changes waiting to be delivered to the thread of this client to \a limit.
+
+    Data changes received by the backend are queued until the event loop of the client thread processes them.
+    If the client thread is blocked, for example by a modal dialog, this queue grows with every notification.
+    If \a limit is reached, the \l dataChangeOverflowPolicy() determines which values are kept.
+
+    A limit of \c 0 disables the limit, which is the default.
+
+    \sa setDataChangeOverflowPolicy() dataChangeOverflowCount()
+*/
+void QOpcUaClient::setDataChangeQueueLimit(int limit)
+{
+    Q_D(QOpcUaClient);
+    d->m_impl->m_dataChangeQueue->setLimit(limit);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the maximum number of data changes waiting to be delivered to the thread of this client.
+
+    \sa setDataChangeQueueLimit()
+*/
+int QOpcUaClient::dataChangeQueueLimit() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_dataChangeQueue->limit();
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Sets the policy which is applied if the \l dataChangeQueueLimit() has been reached to \a policy.
+    The default is \l {QOpcUaClient::DataChangeOverflowPolicy} {DropOldest}.
+
+    \sa setDataChangeQueueLimit()
+*/
+void QOpcUaClient::setDataChangeOverflowPolicy(QOpcUaClient::DataChangeOverflowPolicy policy)
+{
+    Q_D(QOpcUaClient);
+    d->m_impl->m_dataChangeQueue->setOverflowPolicy(policy);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the policy which is applied if the \l dataChangeQueueLimit() has been reached.
+*/
+QOpcUaClient::DataChangeOverflowPolicy QOpcUaClient::dataChangeOverflowPolicy() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_dataChangeQueue->overflowPolicy();
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the number of times the \l dataChangeQueueLimit() has been exceeded since this client was created.
+
+    For \l {QOpcUaClient::DataChangeOverflowPolicy} {DropOldest} and \l {QOpcUaClient::DataChangeOverflowPolicy} {KeepLatest},
+    this is the number of values which have been discarded. For \l {QOpcUaClient::DataChangeOverflowPolicy} {Block},
+    this is the number of times the backend had to wait for the client thread.
+*/
+quint64 QOpcUaClient::dataChangeOverflowCount() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_dataChangeQueue->overflowCount();
+}
+
 /*!
     Sets the authentication information of this client to \a authenticationInformation.
 
@@ -49,6 +49,9 @@
 #include <QtOpcUa/qopcuaaddreferenceitem.h>
 #include <QtOpcUa/qopcuadeletereferenceitem.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuahistoryreaditem.h>
+#include <QtOpcUa/qopcuaprocessedhistorydata.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qurl.h>
@@ -90,6 +93,13 @@ public:
     };
     Q_ENUM(ClientError)
 
+    enum class DataChangeOverflowPolicy {
+        DropOldest,
+        KeepLatest,
+        Block
+    };
+    Q_ENUM(DataChangeOverflowPolicy)
+
     explicit QOpcUaClient(QOpcUaClientImpl *impl, QObject *parent = nullptr);
     ~QOpcUaClient();
 
@@ -103,6 +113,7 @@ public:
     Q_INVOKABLE void disconnectFromEndpoint();
     QOpcUaNode *node(const QString &nodeId);
     QOpcUaNode *node(const QOpcUaExpandedNodeId &expandedNodeId);
+    QOpcUaNode *node(QOpcUa::NodeIds::Namespace0 id);
 
     bool updateNamespaceArray();
     QStringList namespaceArray() const;
@@ -123,6 +134,23 @@ public:
     bool addReference(const QOpcUaAddReferenceItem &referenceToAdd);
     bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete);
 
+    bool addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd);
+    bool deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences = true);
+    bool addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd);
+    bool deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete);
+
+    bool readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                         const QDateTime &endTime, quint32 numValuesPerNode = 0, bool returnBounds = false);
+    bool readModifiedHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                 const QDateTime &endTime, quint32 numValuesPerNode = 0);
+    bool readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                              const QDateTime &endTime, double processingInterval);
+
+    bool enableMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attr,
+                          const QOpcUaMonitoringParameters &settings);
+    bool modifyMonitoring(const QVector<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attr,
+                          QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+
     QOpcUaEndpointDescription endpoint() const;
 
     ClientState state() const;
@@ -135,6 +163,12 @@ public:
     void setNamespaceAutoupdateInterval(int interval);
     int namespaceAutoupdateInterval() const;
 
+    void setDataChangeQueueLimit(int limit);
+    int dataChangeQueueLimit() const;
+    void setDataChangeOverflowPolicy(DataChangeOverflowPolicy policy);
+    DataChangeOverflowPolicy dataChangeOverflowPolicy() const;
+    quint64 dataChangeOverflowCount() const;
+
     void setAuthenticationInformation(const QOpcUaAuthenticationInformation &authenticationInformation);
     const QOpcUaAuthenticationInformation &authenticationInformation() const;
 
@@ -159,6 +193,16 @@ Q_SIGNALS:
                               QOpcUa::UaStatusCode statusCode);
     void deleteReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUaExpandedNodeId targetNodeId, bool isForwardReference,
                               QOpcUa::UaStatusCode statusCode);
+    void addNodesFinished(QVector<QOpcUaAddNodeItem> nodesToAdd, QStringList assignedNodeIds,
+                          QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void deleteNodesFinished(QStringList nodeIds, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void addReferencesFinished(QVector<QOpcUaAddReferenceItem> referencesToAdd, QVector<QOpcUa::UaStatusCode> results,
+                               QOpcUa::UaStatusCode serviceResult);
+    void deleteReferencesFinished(QVector<QOpcUaDeleteReferenceItem> referencesToDelete, QVector<QOpcUa::UaStatusCode> results,
+                                  QOpcUa::UaStatusCode serviceResult);
+    void historyDataAvailable(QVector<QOpcUaHistoryData> data);
+    void processedHistoryDataAvailable(QVector<QOpcUaProcessedHistoryData> data);
+    void readHistoryDataFinished(QVector<QOpcUaHistoryReadItem> nodesToRead, QOpcUa::UaStatusCode serviceResult);
     void passwordForPrivateKeyRequired(QString keyFilePath, QString *password, bool previousTryWasInvalid);
 
 private:
@@ -36,35 +36,74 @@
 
 #include <private/qopcuabackend_p.h>
 #include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuaclientsidefilterstage_p.h>
+#include <private/qopcuadatachangequeue_p.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include "qopcuaclient_p.h"
 #include "qopcuaerrorstate.h"
 
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qtimer.h>
+
 QT_BEGIN_NAMESPACE
 
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+namespace {
+
+// A timer may only be used in the thread it lives in, calls from other threads are queued
+template <typename Functor>
+void runInThreadOf(QObject *object, Functor functor)
+{
+    if (QThread::currentThread() == object->thread())
+        functor();
+    else
+        QMetaObject::invokeMethod(object, functor, Qt::QueuedConnection);
+}
+
+} // namespace
+
 QOpcUaClientImpl::QOpcUaClientImpl(QObject *parent)
     : QObject(parent)
     , m_client(nullptr)
+    , m_dataChangeQueue(new QOpcUaDataChangeQueue)
     , m_handleCounter(0)
 {}
 
 QOpcUaClientImpl::~QOpcUaClientImpl()
+{
+    // Release a backend thread which is waiting for free space in the queue
+    m_dataChangeQueue->close();
+}
+
+QOpcUaMonitoredItemReceiver::~QOpcUaMonitoredItemReceiver()
 {}
 
-bool QOpcUaClientImpl::registerNode(QPointer<QOpcUaNodeImpl> obj)
+/*
+    Advances m_handleCounter to a handle which is neither used by a node nor by a receiver.
+    Returns false if all handles are in use.
+*/
+bool QOpcUaClientImpl::nextFreeHandle()
 {
-    if (m_handles.count() == (std::numeric_limits<int>::max)())
+    if (m_handles.count() + m_receivers.count() >= (std::numeric_limits<int>::max)())
         return false;
 
-    while (true) {
+    do {
         ++m_handleCounter;
+    } while (!m_handleCounter || m_handles.contains(m_handleCounter) || m_receivers.contains(m_handleCounter));
 
-        if (!m_handles.contains(m_handleCounter)) {
-            obj->setHandle(m_handleCounter);
-            m_handles[m_handleCounter] = obj;
-            return true;
-        }
-    }
+    return true;
+}
+
+bool QOpcUaClientImpl::registerNode(QPointer<QOpcUaNodeImpl> obj)
+{
+    if (!nextFreeHandle())
+        return false;
+
+    obj->setHandle(m_handleCounter);
+    m_handles[m_handleCounter] = obj;
+    return true;
 }
 
 void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
@@ -72,18 +111,199 @@ void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
     m_handles.remove(obj->handle());
 }
 
+/*
+    Registers a handle for a monitored item without a node. The monitoring results and data changes
+    for the handle are passed to \a receiver, which must unregister the handle before it is destroyed.
+
+    Returns the handle or 0 if all handles are in use.
+*/
+quint64 QOpcUaClientImpl::registerMonitoredItem(QOpcUaMonitoredItemReceiver *receiver)
+{
+    if (!receiver || !nextFreeHandle())
+        return 0;
+
+    m_receivers.insert(m_handleCounter, receiver);
+    return m_handleCounter;
+}
+
+void QOpcUaClientImpl::unregisterMonitoredItem(quint64 handle)
+{
+    m_receivers.remove(handle);
+}
+
+QOpcUaNode *QOpcUaClientImpl::node(QOpcUa::NodeIds::Namespace0 id)
+{
+    return node(QOpcUa::namespace0Id(id));
+}
+
+bool QOpcUaClientImpl::addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd)
+{
+    Q_UNUSED(nodesToAdd);
+    qCWarning(QT_OPCUA) << "Adding multiple nodes in one request is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences)
+{
+    Q_UNUSED(nodeIds);
+    Q_UNUSED(deleteTargetReferences);
+    qCWarning(QT_OPCUA) << "Deleting multiple nodes in one request is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd)
+{
+    Q_UNUSED(referencesToAdd);
+    qCWarning(QT_OPCUA) << "Adding multiple references in one request is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete)
+{
+    Q_UNUSED(referencesToDelete);
+    qCWarning(QT_OPCUA) << "Deleting multiple references in one request is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                       const QDateTime &endTime, quint32 numValuesPerNode, bool returnBounds, bool isReadModified)
+{
+    Q_UNUSED(nodesToRead);
+    Q_UNUSED(startTime);
+    Q_UNUSED(endTime);
+    Q_UNUSED(numValuesPerNode);
+    Q_UNUSED(returnBounds);
+    Q_UNUSED(isReadModified);
+    qCWarning(QT_OPCUA) << "Reading history data is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                            const QDateTime &endTime, double processingInterval)
+{
+    Q_UNUSED(nodesToRead);
+    Q_UNUSED(startTime);
+    Q_UNUSED(endTime);
+    Q_UNUSED(processingInterval);
+    qCWarning(QT_OPCUA) << "Reading processed history data is not supported by the backend";
+    return false;
+}
+
+bool QOpcUaClientImpl::enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                                        const QOpcUaMonitoringParameters &settings)
+{
+    // Backends without support for batched requests create the monitored items one by one
+    Q_UNUSED(nodeIds);
+    bool dispatched = true;
+    for (const quint64 handle : handles) {
+        const auto it = m_handles.constFind(handle);
+        if (it == m_handles.constEnd() || it->isNull() || !(*it)->enableMonitoring(attr, settings))
+            dispatched = false;
+    }
+    return dispatched;
+}
+
+bool QOpcUaClientImpl::disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr)
+{
+    // Backends without support for batched requests disable the monitored items of the nodes one by one
+    bool dispatched = true;
+    for (const quint64 handle : handles) {
+        const auto it = m_handles.constFind(handle);
+        if (it == m_handles.constEnd() || it->isNull() || !(*it)->disableMonitoring(attr))
+            dispatched = false;
+    }
+    return dispatched;
+}
+
+bool QOpcUaClientImpl::modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                        QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    // Backends without support for batched requests modify the monitored items one by one
+    bool dispatched = true;
+    for (const quint64 handle : handles) {
+        const auto it = m_handles.constFind(handle);
+        if (it == m_handles.constEnd() || it->isNull() || !(*it)->modifyMonitoring(attr, item, value))
+            dispatched = false;
+    }
+    return dispatched;
+}
+
+bool QOpcUaClientImpl::callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls)
+{
+    // Backends without support for batched method calls return false, the caller must call the methods one by one
+    Q_UNUSED(requestId);
+    Q_UNUSED(calls);
+    return false;
+}
+
 void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
 {
     connect(backend, &QOpcUaBackend::attributesRead, this, &QOpcUaClientImpl::handleAttributesRead);
     connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
     connect(backend, &QOpcUaBackend::attributeWritten, this, &QOpcUaClientImpl::handleAttributeWritten);
-    connect(backend, &QOpcUaBackend::dataChangeOccurred, this, &QOpcUaClientImpl::handleDataChangeOccurred);
+    // Data changes are passed through a bounded queue instead of one queued metacall per value.
+    // The lambda runs in the backend thread and keeps the queue alive as long as the connection exists.
+    const QSharedPointer<QOpcUaDataChangeQueue> queue = m_dataChangeQueue;
+    // Client-side filters are evaluated in the thread emitting the data changes before they are queued.
+    // This is the backend thread or, for the uacpp backend, a thread of the SDK, the filter stage is thread-safe.
+    // The timer is a child of the backend and moves to the backend thread together with it.
+    const QSharedPointer<QOpcUaClientSideFilterStage> filterStage = QSharedPointer<QOpcUaClientSideFilterStage>::create();
+    QTimer *filterTimer = new QTimer(backend);
+    filterTimer->setSingleShot(true);
+    const auto scheduleFilterTimer = [filterStage, filterTimer]() {
+        runInThreadOf(filterTimer, [filterStage, filterTimer]() {
+            const qint64 due = filterStage->nextDue();
+            if (due < 0)
+                filterTimer->stop();
+            else
+                filterTimer->start(static_cast<int>(qMax<qint64>(0, due - filterStage->elapsed())));
+        });
+    };
+    connect(backend, &QOpcUaBackend::monitoringEnableDisable, backend,
+            [filterStage, scheduleFilterTimer](quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, const QOpcUaMonitoringParameters &status) {
+        if (subscribe && status.statusCode() == QOpcUa::UaStatusCode::Good
+                && status.clientSideFilter().canConvert<QOpcUaMonitoringParameters::ClientSideFilter>())
+            filterStage->setFilter(handle, attr, status.clientSideFilter().value<QOpcUaMonitoringParameters::ClientSideFilter>());
+        else
+            filterStage->removeFilter(handle, attr);
+        scheduleFilterTimer();
+    }, Qt::DirectConnection);
+    connect(backend, &QOpcUaBackend::dataChangeOccurred, backend,
+            [backend, queue, filterStage, filterTimer](quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value) {
+        if (!filterStage->isEmpty()) {
+            const qint64 now = filterStage->elapsed();
+            if (!filterStage->process(handle, attr, value, now)) {
+                // Only start the timer earlier if the held back value is due before the next scheduled timeout
+                const qint64 due = filterStage->nextDue(handle, attr);
+                if (due < 0)
+                    return;
+                runInThreadOf(filterTimer, [filterStage, filterTimer, due]() {
+                    const qint64 current = filterStage->elapsed();
+                    if (!filterTimer->isActive() || current + filterTimer->remainingTime() > due)
+                        filterTimer->start(static_cast<int>(qMax<qint64>(0, due - current)));
+                });
+                return;
+            }
+        }
+        if (queue->enqueue(handle, attr, value))
+            emit backend->dataChangesQueued();
+    }, Qt::DirectConnection);
+    connect(filterTimer, &QTimer::timeout, backend, [backend, queue, filterStage, scheduleFilterTimer]() {
+        const auto entries = filterStage->takeDue(filterStage->elapsed());
+        for (const auto &entry : entries) {
+            if (queue->enqueue(entry.handle, entry.attribute, entry.value))
+                emit backend->dataChangesQueued();
+        }
+        scheduleFilterTimer();
+    });
+    connect(backend, &QOpcUaBackend::dataChangesQueued, this, &QOpcUaClientImpl::handleQueuedDataChanges, Qt::QueuedConnection);
     connect(backend, &QOpcUaBackend::monitoringEnableDisable, this, &QOpcUaClientImpl::handleMonitoringEnableDisable);
     connect(backend, &QOpcUaBackend::monitoringStatusChanged, this, &QOpcUaClientImpl::handleMonitoringStatusChanged);
+    connect(backend, &QOpcUaBackend::setTriggeringFinished, this, &QOpcUaClientImpl::handleSetTriggeringFinished);
     connect(backend, &QOpcUaBackend::methodCallFinished, this, &QOpcUaClientImpl::handleMethodCallFinished);
     connect(backend, &QOpcUaBackend::browseFinished, this, &QOpcUaClientImpl::handleBrowseFinished);
     connect(backend, &QOpcUaBackend::resolveBrowsePathFinished, this, &QOpcUaClientImpl::handleResolveBrowsePathFinished);
-    connect(backend, &QOpcUaBackend::eventOccurred, this, &QOpcUaClientImpl::handleNewEvent);
+    connect(backend, &QOpcUaBackend::eventsOccurred, this, &QOpcUaClientImpl::handleNewEvents);
     connect(backend, &QOpcUaBackend::endpointsRequestFinished, this, &QOpcUaClientImpl::endpointsRequestFinished);
     connect(backend, &QOpcUaBackend::findServersFinished, this, &QOpcUaClientImpl::findServersFinished);
     connect(backend, &QOpcUaBackend::readNodeAttributesFinished, this, &QOpcUaClientImpl::readNodeAttributesFinished);
@@ -92,6 +312,14 @@ void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
     connect(backend, &QOpcUaBackend::deleteNodeFinished, this, &QOpcUaClientImpl::deleteNodeFinished);
     connect(backend, &QOpcUaBackend::addReferenceFinished, this, &QOpcUaClientImpl::addReferenceFinished);
     connect(backend, &QOpcUaBackend::deleteReferenceFinished, this, &QOpcUaClientImpl::deleteReferenceFinished);
+    connect(backend, &QOpcUaBackend::addNodesFinished, this, &QOpcUaClientImpl::addNodesFinished);
+    connect(backend, &QOpcUaBackend::deleteNodesFinished, this, &QOpcUaClientImpl::deleteNodesFinished);
+    connect(backend, &QOpcUaBackend::addReferencesFinished, this, &QOpcUaClientImpl::addReferencesFinished);
+    connect(backend, &QOpcUaBackend::deleteReferencesFinished, this, &QOpcUaClientImpl::deleteReferencesFinished);
+    connect(backend, &QOpcUaBackend::historyDataAvailable, this, &QOpcUaClientImpl::historyDataAvailable);
+    connect(backend, &QOpcUaBackend::processedHistoryDataAvailable, this, &QOpcUaClientImpl::processedHistoryDataAvailable);
+    connect(backend, &QOpcUaBackend::readHistoryDataFinished, this, &QOpcUaClientImpl::readHistoryDataFinished);
+    connect(backend, &QOpcUaBackend::callMethodsFinished, this, &QOpcUaClientImpl::callMethodsFinished);
     // This needs to be blocking queued because it is called from another thread, which needs to wait for a result.
     connect(backend, &QOpcUaBackend::connectError, this, &QOpcUaClientImpl::connectError, Qt::BlockingQueuedConnection);
     connect(backend, &QOpcUaBackend::passwordForPrivateKeyRequired, this, &QOpcUaClientImpl::passwordForPrivateKeyRequired, Qt::BlockingQueuedConnection);
@@ -111,18 +339,39 @@ void QOpcUaClientImpl::handleAttributeWritten(quint64 handle, QOpcUa::NodeAttrib
         emit (*it)->attributeWritten(attr, value, statusCode);
 }
 
-void QOpcUaClientImpl::handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value)
+void QOpcUaClientImpl::handleDataChangeOccurred(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value)
 {
     auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->dataChangeOccurred(value.attribute(), value);
+    if (it != m_handles.constEnd()) {
+        if (!it->isNull())
+            emit (*it)->dataChangeOccurred(attr, value);
+        return;
+    }
+
+    QOpcUaMonitoredItemReceiver *receiver = m_receivers.value(handle);
+    if (receiver)
+        receiver->monitoredItemDataChanged(handle, attr, value);
+}
+
+void QOpcUaClientImpl::handleQueuedDataChanges()
+{
+    const auto entries = m_dataChangeQueue->takeAll();
+    for (const auto &entry : entries)
+        handleDataChangeOccurred(entry.handle, entry.attribute, entry.value);
 }
 
 void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
 {
     auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->monitoringEnableDisable(attr, subscribe, status);
+    if (it != m_handles.constEnd()) {
+        if (!it->isNull())
+            emit (*it)->monitoringEnableDisable(attr, subscribe, status);
+        return;
+    }
+
+    QOpcUaMonitoredItemReceiver *receiver = m_receivers.value(handle);
+    if (receiver)
+        receiver->monitoredItemEnableDisable(handle, attr, subscribe, status);
 }
 
 void QOpcUaClientImpl::handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items, QOpcUaMonitoringParameters param)
@@ -132,6 +381,15 @@ void QOpcUaClientImpl::handleMonitoringStatusChanged(quint64 handle, QOpcUa::Nod
         emit (*it)->monitoringStatusChanged(attr, items, param);
 }
 
+void QOpcUaClientImpl::handleSetTriggeringFinished(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd,
+                                                   QVector<quint32> linksToRemove, QVector<QOpcUa::UaStatusCode> addResults,
+                                                   QVector<QOpcUa::UaStatusCode> removeResults, QOpcUa::UaStatusCode statusCode)
+{
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull())
+        emit (*it)->setTriggeringFinished(attr, linksToAdd, linksToRemove, addResults, removeResults, statusCode);
+}
+
 void QOpcUaClientImpl::handleMethodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode)
 {
     auto it = m_handles.constFind(handle);
@@ -139,11 +397,11 @@ void QOpcUaClientImpl::handleMethodCallFinished(quint64 handle, QString methodNo
         emit (*it)->methodCallFinished(methodNodeId, result, statusCode);
 }
 
-void QOpcUaClientImpl::handleBrowseFinished(quint64 handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode)
+void QOpcUaClientImpl::handleBrowseFinished(quint64 handle, const QOpcUaBrowseResult &result, QOpcUa::UaStatusCode statusCode)
 {
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->browseFinished(children, statusCode);
+        emit (*it)->browseFinished(result, statusCode);
 }
 
 void QOpcUaClientImpl::handleResolveBrowsePathFinished(quint64 handle, QVector<QOpcUaBrowsePathTarget> targets,
@@ -154,11 +412,11 @@ void QOpcUaClientImpl::handleResolveBrowsePathFinished(quint64 handle, QVector<Q
         emit (*it)->resolveBrowsePathFinished(targets, path, status);
 }
 
-void QOpcUaClientImpl::handleNewEvent(quint64 handle, QVariantList eventFields)
+void QOpcUaClientImpl::handleNewEvents(quint64 handle, QVector<QOpcUaEventRecord> events)
 {
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
-        emit (*it)->eventOccurred(eventFields);
+        emit (*it)->eventsOccurred(events);
 }
 
 QT_END_NAMESPACE
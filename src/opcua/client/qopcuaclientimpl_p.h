@@ -51,19 +51,33 @@
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
+#include <private/qopcuamethodcallitem_p.h>
 #include <private/qopcuanodeimpl_p.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qset.h>
+#include <QtCore/qsharedpointer.h>
 
 QT_BEGIN_NAMESPACE
 
 class QOpcUaNode;
 class QOpcUaClient;
 class QOpcUaBackend;
+class QOpcUaDataChangeQueue;
 class QOpcUaMonitoringParameters;
 
+// Receives the monitoring results and data changes for handles which don't belong to a node
+class Q_OPCUA_EXPORT QOpcUaMonitoredItemReceiver
+{
+public:
+    virtual ~QOpcUaMonitoredItemReceiver();
+
+    virtual void monitoredItemDataChanged(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value) = 0;
+    virtual void monitoredItemEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe,
+                                            const QOpcUaMonitoringParameters &status) = 0;
+};
+
 class Q_OPCUA_EXPORT QOpcUaClientImpl : public QObject
 {
     Q_OBJECT
@@ -75,6 +89,7 @@ public:
     virtual void connectToEndpoint(const QOpcUaEndpointDescription &endpoint) = 0;
     virtual void disconnectFromEndpoint() = 0;
     virtual QOpcUaNode *node(const QString &nodeId) = 0;
+    virtual QOpcUaNode *node(QOpcUa::NodeIds::Namespace0 id);
     virtual QString backend() const = 0;
     virtual bool requestEndpoints(const QUrl &url) = 0;
     virtual bool findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris) = 0;
@@ -84,33 +99,56 @@ public:
     bool registerNode(QPointer<QOpcUaNodeImpl> obj);
     void unregisterNode(QPointer<QOpcUaNodeImpl> obj);
 
+    quint64 registerMonitoredItem(QOpcUaMonitoredItemReceiver *receiver);
+    void unregisterMonitoredItem(quint64 handle);
+
     virtual bool addNode(const QOpcUaAddNodeItem &nodeToAdd) = 0;
     virtual bool deleteNode(const QString &nodeId, bool deleteTargetReferences) = 0;
 
     virtual bool addReference(const QOpcUaAddReferenceItem &referenceToAdd) = 0;
     virtual bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete) = 0;
 
+    virtual bool addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd);
+    virtual bool deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences);
+    virtual bool addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd);
+    virtual bool deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete);
+    virtual bool readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                 const QDateTime &endTime, quint32 numValuesPerNode, bool returnBounds, bool isReadModified);
+    virtual bool readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                      const QDateTime &endTime, double processingInterval);
+    virtual bool enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                                  const QOpcUaMonitoringParameters &settings);
+    virtual bool disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr);
+    virtual bool modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                  QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+    virtual bool callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls);
+
     void connectBackendWithClient(QOpcUaBackend *backend);
 
     virtual QStringList supportedSecurityPolicies() const = 0;
     virtual QVector<QOpcUaUserTokenPolicy::TokenType> supportedUserTokenTypes() const = 0;
 
     QOpcUaClient *m_client;
+    QSharedPointer<QOpcUaDataChangeQueue> m_dataChangeQueue;
 
 private Q_SLOTS:
     void handleAttributesRead(quint64 handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
-    void handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value);
+    void handleDataChangeOccurred(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value);
+    void handleQueuedDataChanges();
     void handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                                  QOpcUaMonitoringParameters param);
+    void handleSetTriggeringFinished(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd,
+                                     QVector<quint32> linksToRemove, QVector<QOpcUa::UaStatusCode> addResults,
+                                     QVector<QOpcUa::UaStatusCode> removeResults, QOpcUa::UaStatusCode statusCode);
     void handleMethodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
-    void handleBrowseFinished(quint64 handle, const QVector<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode);
+    void handleBrowseFinished(quint64 handle, const QOpcUaBrowseResult &result, QOpcUa::UaStatusCode statusCode);
 
     void handleResolveBrowsePathFinished(quint64 handle, QVector<QOpcUaBrowsePathTarget> targets,
                                            QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode status);
 
-    void handleNewEvent(quint64 handle, QVariantList eventFields);
+    void handleNewEvents(quint64 handle, QVector<QOpcUaEventRecord> events);
 
 signals:
     void connected();
@@ -127,12 +165,27 @@ signals:
                               QOpcUa::UaStatusCode statusCode);
     void deleteReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUaExpandedNodeId targetNodeId, bool isForwardReference,
                               QOpcUa::UaStatusCode statusCode);
+    void addNodesFinished(QVector<QOpcUaAddNodeItem> nodesToAdd, QStringList assignedNodeIds,
+                          QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void deleteNodesFinished(QStringList nodeIds, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
+    void addReferencesFinished(QVector<QOpcUaAddReferenceItem> referencesToAdd, QVector<QOpcUa::UaStatusCode> results,
+                               QOpcUa::UaStatusCode serviceResult);
+    void deleteReferencesFinished(QVector<QOpcUaDeleteReferenceItem> referencesToDelete, QVector<QOpcUa::UaStatusCode> results,
+                                  QOpcUa::UaStatusCode serviceResult);
+    void historyDataAvailable(QVector<QOpcUaHistoryData> data);
+    void processedHistoryDataAvailable(QVector<QOpcUaProcessedHistoryData> data);
+    void readHistoryDataFinished(QVector<QOpcUaHistoryReadItem> nodesToRead, QOpcUa::UaStatusCode serviceResult);
+    void callMethodsFinished(quint64 requestId, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult);
     void connectError(QOpcUaErrorState *errorState);
     void passwordForPrivateKeyRequired(const QString keyFilePath, QString *password, bool previousTryWasInvalid);
 
 private:
     Q_DISABLE_COPY(QOpcUaClientImpl)
+    bool nextFreeHandle();
+
     QHash<quint64, QPointer<QOpcUaNodeImpl>> m_handles;
+    // Handles registered without a node, for example by QOpcUaTagModel
+    QHash<quint64, QOpcUaMonitoredItemReceiver *> m_receivers;
     quint64 m_handleCounter;
 };
 
@@ -108,6 +108,46 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
         emit q->deleteReferenceFinished(sourceNodeId, referenceTypeId, targetNodeId, isForwardReference, statusCode);
     });
 
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::addNodesFinished, [this](const QVector<QOpcUaAddNodeItem> &nodesToAdd,
+                     const QStringList &assignedNodeIds, const QVector<QOpcUa::UaStatusCode> &results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->addNodesFinished(nodesToAdd, assignedNodeIds, results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::deleteNodesFinished, [this](const QStringList &nodeIds,
+                     const QVector<QOpcUa::UaStatusCode> &results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->deleteNodesFinished(nodeIds, results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::addReferencesFinished, [this](const QVector<QOpcUaAddReferenceItem> &referencesToAdd,
+                     const QVector<QOpcUa::UaStatusCode> &results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->addReferencesFinished(referencesToAdd, results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::deleteReferencesFinished, [this](const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete,
+                     const QVector<QOpcUa::UaStatusCode> &results, QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->deleteReferencesFinished(referencesToDelete, results, serviceResult);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::historyDataAvailable, [this](const QVector<QOpcUaHistoryData> &data) {
+        Q_Q(QOpcUaClient);
+        emit q->historyDataAvailable(data);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::processedHistoryDataAvailable, [this](const QVector<QOpcUaProcessedHistoryData> &data) {
+        Q_Q(QOpcUaClient);
+        emit q->processedHistoryDataAvailable(data);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::readHistoryDataFinished, [this](const QVector<QOpcUaHistoryReadItem> &nodesToRead,
+                     QOpcUa::UaStatusCode serviceResult) {
+        Q_Q(QOpcUaClient);
+        emit q->readHistoryDataFinished(nodesToRead, serviceResult);
+    });
+
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::connectError, [this](QOpcUaErrorState *errorState) {
         Q_Q(QOpcUaClient);
         emit q->connectError(errorState);
@@ -199,7 +239,7 @@ bool QOpcUaClientPrivate::updateNamespaceArray()
         return false;
 
     if (!m_namespaceArrayNode) {
-        m_namespaceArrayNode.reset(m_impl->node(QStringLiteral("ns=0;i=2255")));
+        m_namespaceArrayNode.reset(m_impl->node(QOpcUa::NodeIds::Namespace0::Server_NamespaceArray));
         if (!m_namespaceArrayNode)
             return false;
         QObjectPrivate::connect(m_namespaceArrayNode.data(), &QOpcUaNode::attributeRead, this, &QOpcUaClientPrivate::namespaceArrayUpdated);
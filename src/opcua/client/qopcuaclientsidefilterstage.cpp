@@ -0,0 +1,369 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaclientsidefilterstage_p.h"
+
+#include <QtOpcUa/qopcuamultidimensionalarray.h>
+
+#include <QtCore/qmath.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QOpcUaClientSideFilterStage applies the client-side filters of the monitored items to the data changes
+    in the backend thread before they are added to the data change queue.
+
+    A data change is compared to the last reported value of the monitored item. Changes inside the deadband
+    are dropped, changes which occur before the minimum reporting interval has elapsed are kept as pending value
+    and are returned by takeDue() once the interval has elapsed.
+
+    Times are passed in milliseconds from elapsed() to keep the stage testable without waiting.
+
+    All functions are thread-safe, the data changes of some backends are processed in a thread of the SDK.
+*/
+
+namespace {
+
+// Elements are compared in fixed size blocks. The inner loop has no early exit and only
+// contains a subtraction, an absolute value and a maximum, which allows the compiler to vectorize it.
+// The comparison is left as soon as a block contains a change exceeding the deadband.
+const quint32 comparisonBlockSize = 64;
+
+template <typename T>
+bool arrayExceedsDeadband(const T *last, const T *current, quint32 length, double threshold)
+{
+    for (quint32 blockStart = 0; blockStart < length; blockStart += comparisonBlockSize) {
+        const quint32 blockEnd = qMin(length, blockStart + comparisonBlockSize);
+        double maxDifference = 0;
+        for (quint32 i = blockStart; i < blockEnd; ++i) {
+            const double difference = qAbs(static_cast<double>(current[i]) - static_cast<double>(last[i]));
+            maxDifference = difference > maxDifference ? difference : maxDifference;
+        }
+        if (maxDifference > threshold)
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool typedArrayChanged(const QOpcUaMultiDimensionalArray &last, const QOpcUaMultiDimensionalArray &current,
+                       quint32 length, double threshold)
+{
+    // Without deadband, every modified element is a change and comparing the memory is sufficient
+    if (threshold <= 0)
+        return std::memcmp(last.constData(), current.constData(), length * sizeof(T)) != 0;
+    return arrayExceedsDeadband(last.typedData<T>(), current.typedData<T>(), length, threshold);
+}
+
+bool multiDimensionalArrayChanged(const QOpcUaMultiDimensionalArray &last, const QOpcUaMultiDimensionalArray &current,
+                                  double threshold)
+{
+    if (!last.hasTypedStorage() || !current.hasTypedStorage()) {
+        if (last.hasTypedStorage() != current.hasTypedStorage() || last.arrayDimensions() != current.arrayDimensions())
+            return true;
+        return QOpcUaClientSideFilterStage::valueChanged(last.valueArray(), current.valueArray(), threshold);
+    }
+
+    if (last.elementType() != current.elementType() || last.arrayDimensions() != current.arrayDimensions()
+            || !last.isValid() || !current.isValid())
+        return true;
+
+    quint32 length = 1;
+    for (const quint32 dimension : current.arrayDimensions())
+        length *= dimension;
+
+    switch (current.elementType()) {
+    case QOpcUa::Types::Boolean:
+        return typedArrayChanged<bool>(last, current, length, threshold);
+    case QOpcUa::Types::SByte:
+        return typedArrayChanged<qint8>(last, current, length, threshold);
+    case QOpcUa::Types::Byte:
+        return typedArrayChanged<quint8>(last, current, length, threshold);
+    case QOpcUa::Types::Int16:
+        return typedArrayChanged<qint16>(last, current, length, threshold);
+    case QOpcUa::Types::UInt16:
+        return typedArrayChanged<quint16>(last, current, length, threshold);
+    case QOpcUa::Types::Int32:
+        return typedArrayChanged<qint32>(last, current, length, threshold);
+    case QOpcUa::Types::UInt32:
+        return typedArrayChanged<quint32>(last, current, length, threshold);
+    case QOpcUa::Types::Int64:
+        return typedArrayChanged<qint64>(last, current, length, threshold);
+    case QOpcUa::Types::UInt64:
+        return typedArrayChanged<quint64>(last, current, length, threshold);
+    case QOpcUa::Types::Float:
+        return typedArrayChanged<float>(last, current, length, threshold);
+    case QOpcUa::Types::Double:
+        return typedArrayChanged<double>(last, current, length, threshold);
+    default:
+        return true;
+    }
+}
+
+bool isNumeric(const QVariant &value)
+{
+    switch (static_cast<QMetaType::Type>(value.userType())) {
+    case QMetaType::Double:
+    case QMetaType::Float:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::ULong:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::UChar:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+QOpcUaClientSideFilterStage::QOpcUaClientSideFilterStage()
+{
+    m_clock.start();
+}
+
+/*
+    Sets \a filter as client-side filter for the monitored item identified by \a handle and \a attribute.
+    The state of a previous filter for the same monitored item is discarded.
+*/
+void QOpcUaClientSideFilterStage::setFilter(quint64 handle, QOpcUa::NodeAttribute attribute,
+                                            const QOpcUaMonitoringParameters::ClientSideFilter &filter)
+{
+    Item item;
+    item.filter = filter;
+    QMutexLocker locker(&m_mutex);
+    m_items.insert(Key(handle, attribute), item);
+}
+
+void QOpcUaClientSideFilterStage::removeFilter(quint64 handle, QOpcUa::NodeAttribute attribute)
+{
+    QMutexLocker locker(&m_mutex);
+    m_items.remove(Key(handle, attribute));
+}
+
+bool QOpcUaClientSideFilterStage::isEmpty() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_items.isEmpty();
+}
+
+/*
+    Returns true if \a value must be reported now for the monitored item identified by \a handle and \a attribute.
+    Data changes for monitored items without a client-side filter are always reported.
+*/
+bool QOpcUaClientSideFilterStage::process(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value, qint64 now)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_items.find(Key(handle, attribute));
+    if (it == m_items.end())
+        return true;
+
+    Item &item = it.value();
+
+    if (!item.hasReported) {
+        report(item, value, now);
+        return true;
+    }
+
+    if (!isChange(item, value)) {
+        // The value has returned into the deadband of the last report, a pending change is obsolete
+        item.hasPending = false;
+        item.pending = QOpcUaDataValue();
+        return false;
+    }
+
+    const double interval = item.filter.minimumReportingInterval();
+    if (interval > 0 && now - item.lastReportTime < interval) {
+        item.pending = value;
+        item.hasPending = true;
+        return false;
+    }
+
+    report(item, value, now);
+    return true;
+}
+
+/*
+    Returns the pending data changes whose minimum reporting interval has elapsed at \a now.
+*/
+QVector<QOpcUaDataChangeQueue::Entry> QOpcUaClientSideFilterStage::takeDue(qint64 now)
+{
+    QVector<QOpcUaDataChangeQueue::Entry> result;
+
+    QMutexLocker locker(&m_mutex);
+    for (auto it = m_items.begin(); it != m_items.end(); ++it) {
+        Item &item = it.value();
+        if (!item.hasPending || now - item.lastReportTime < item.filter.minimumReportingInterval())
+            continue;
+
+        result.push_back({it.key().first, it.key().second, item.pending});
+        report(item, item.pending, now);
+    }
+
+    return result;
+}
+
+/*
+    Returns the time at which the next pending data change is due or -1 if there is no pending data change.
+*/
+qint64 QOpcUaClientSideFilterStage::nextDue() const
+{
+    qint64 result = -1;
+
+    QMutexLocker locker(&m_mutex);
+    for (const auto &item : m_items) {
+        if (!item.hasPending)
+            continue;
+        const qint64 due = dueTime(item);
+        if (result < 0 || due < result)
+            result = due;
+    }
+
+    return result;
+}
+
+/*
+    Returns the time at which the pending data change of the monitored item identified by \a handle and \a attribute
+    is due or -1 if there is no pending data change for this monitored item.
+*/
+qint64 QOpcUaClientSideFilterStage::nextDue(quint64 handle, QOpcUa::NodeAttribute attribute) const
+{
+    QMutexLocker locker(&m_mutex);
+    const auto it = m_items.constFind(Key(handle, attribute));
+    if (it == m_items.constEnd() || !it->hasPending)
+        return -1;
+    return dueTime(it.value());
+}
+
+qint64 QOpcUaClientSideFilterStage::elapsed() const
+{
+    return m_clock.elapsed();
+}
+
+/*
+    Returns true if \a current differs from \a last by more than \a threshold.
+    Numeric scalars, lists and multi dimensional arrays of numeric values are compared elementwise,
+    all other values are compared for equality.
+*/
+bool QOpcUaClientSideFilterStage::valueChanged(const QVariant &last, const QVariant &current, double threshold)
+{
+    if (isNumeric(last) && isNumeric(current)) {
+        const double lastValue = last.toDouble();
+        const double currentValue = current.toDouble();
+        if (threshold <= 0)
+            return lastValue != currentValue;
+        return qAbs(currentValue - lastValue) > threshold;
+    }
+
+    if (last.userType() == QMetaType::QVariantList && current.userType() == QMetaType::QVariantList) {
+        const QVariantList lastList = last.toList();
+        const QVariantList currentList = current.toList();
+        if (lastList.size() != currentList.size())
+            return true;
+        for (int i = 0; i < currentList.size(); ++i) {
+            if (valueChanged(lastList.at(i), currentList.at(i), threshold))
+                return true;
+        }
+        return false;
+    }
+
+    const int arrayType = qMetaTypeId<QOpcUaMultiDimensionalArray>();
+    if (last.userType() == arrayType && current.userType() == arrayType)
+        return multiDimensionalArrayChanged(last.value<QOpcUaMultiDimensionalArray>(),
+                                            current.value<QOpcUaMultiDimensionalArray>(), threshold);
+
+    return last != current;
+}
+
+double QOpcUaClientSideFilterStage::threshold(const QOpcUaMonitoringParameters::ClientSideFilter &filter)
+{
+    switch (filter.deadbandType()) {
+    case QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute:
+        return filter.deadbandValue();
+    case QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Percent: {
+        // A percent deadband without a valid EURange degrades to plain change detection
+        const QOpcUaRange range = filter.euRange();
+        if (range.high() <= range.low())
+            return 0;
+        return filter.deadbandValue() / 100.0 * (range.high() - range.low());
+    }
+    default:
+        return 0;
+    }
+}
+
+bool QOpcUaClientSideFilterStage::isChange(const Item &item, const QOpcUaDataValue &value)
+{
+    const QOpcUaDataValue &last = item.lastReported;
+
+    if (last.statusCode() != value.statusCode())
+        return true;
+
+    const auto trigger = item.filter.trigger();
+    if (trigger == QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::Status)
+        return false;
+
+    if (trigger == QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::StatusOrValueOrTimestamp
+            && last.sourceTimestampTicks() != value.sourceTimestampTicks())
+        return true;
+
+    return valueChanged(last.value(), value.value(), threshold(item.filter));
+}
+
+qint64 QOpcUaClientSideFilterStage::dueTime(const Item &item)
+{
+    return item.lastReportTime + qCeil(item.filter.minimumReportingInterval());
+}
+
+void QOpcUaClientSideFilterStage::report(Item &item, const QOpcUaDataValue &value, qint64 now)
+{
+    item.lastReported = value;
+    item.lastReportTime = now;
+    item.hasReported = true;
+    item.hasPending = false;
+    item.pending = QOpcUaDataValue();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACLIENTSIDEFILTERSTAGE_P_H
+#define QOPCUACLIENTSIDEFILTERSTAGE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qopcuadatachangequeue_p.h>
+
+#include <QtOpcUa/qopcuadatavalue.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaClientSideFilterStage
+{
+public:
+    QOpcUaClientSideFilterStage();
+
+    void setFilter(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaMonitoringParameters::ClientSideFilter &filter);
+    void removeFilter(quint64 handle, QOpcUa::NodeAttribute attribute);
+    bool isEmpty() const;
+
+    bool process(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value, qint64 now);
+    QVector<QOpcUaDataChangeQueue::Entry> takeDue(qint64 now);
+    qint64 nextDue() const;
+    qint64 nextDue(quint64 handle, QOpcUa::NodeAttribute attribute) const;
+
+    qint64 elapsed() const;
+
+    static bool valueChanged(const QVariant &last, const QVariant &current, double threshold);
+
+private:
+    typedef QPair<quint64, QOpcUa::NodeAttribute> Key;
+
+    struct Item {
+        QOpcUaMonitoringParameters::ClientSideFilter filter;
+        QOpcUaDataValue lastReported;
+        qint64 lastReportTime = 0;
+        bool hasReported = false;
+        QOpcUaDataValue pending;
+        bool hasPending = false;
+    };
+
+    static double threshold(const QOpcUaMonitoringParameters::ClientSideFilter &filter);
+    static bool isChange(const Item &item, const QOpcUaDataValue &value);
+    static qint64 dueTime(const Item &item);
+    static void report(Item &item, const QOpcUaDataValue &value, qint64 now);
+
+    // The uacpp backend emits data changes from a thread of the SDK, all other calls are made in the backend thread
+    mutable QMutex m_mutex;
+    QHash<Key, Item> m_items;
+    QElapsedTimer m_clock;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUACLIENTSIDEFILTERSTAGE_P_H
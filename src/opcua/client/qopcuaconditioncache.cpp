@@ -0,0 +1,754 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaconditioncache.h"
+#include "qopcuaconditioncache_p.h"
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+#include <private/qopcuaclient_p.h>
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qtimer.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaConditionCache
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief Keeps a local copy of the active conditions of an event notifier.
+
+    QOpcUaConditionCache monitors the events of a notifier node, by default the Server object,
+    and keeps the latest state of every condition which has its Retain flag set. After monitoring
+    has been enabled and after every reconnect, the cache calls the ConditionRefresh method so the
+    server resends the state of all retained conditions. The cache recognizes the RefreshStartEvent
+    and RefreshEndEvent which enclose the refreshed conditions and removes all conditions which
+    were not part of the refresh. A RefreshRequiredEvent sent by the server starts a new refresh.
+
+    Changes are reported by \l conditionsChanged() once for every batch of events received from
+    the server, regardless of the number of conditions in the batch.
+
+    Each condition is stored as a \l QOpcUaEventRecord which contains the fields of the select clause
+    returned by \l selectClauses(). The fields can be accessed by name, for example
+    \c EventId, \c Message, \c Severity, \c {#NodeId} for the ConditionId, \c Retain,
+    \c {EnabledState/Id}, \c {AckedState/Id}, \c {ConfirmedState/Id} and \c {ActiveState/Id}.
+    Additional fields can be selected using \l setAdditionalSelectClauses().
+
+    \l acknowledge() and \l confirm() call the corresponding method of the condition using the
+    EventId of the cached condition. Calls made in the same iteration of the event loop are sent
+    to the server in a single Call service request if the backend supports it.
+
+    Branches of conditions are not cached, events with a non-null BranchId are ignored.
+
+    \code
+    QOpcUaConditionCache *cache = new QOpcUaConditionCache(client);
+    QObject::connect(cache, &QOpcUaConditionCache::conditionsChanged,
+                     [cache](const QStringList &added, const QStringList &changed, const QStringList &removed) {
+        for (const auto &id : added + changed)
+            qDebug() << id << cache->condition(id).field(QStringLiteral("Severity")).toUInt();
+        for (const auto &id : removed)
+            qDebug() << id << "is no longer retained";
+    });
+    cache->enable();
+    \endcode
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::enableFinished(QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after enabling the event monitoring of the notifier node has finished
+    with status \a statusCode. If \a statusCode is bad, the cache is disabled.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::refreshStarted()
+
+    This signal is emitted when the server has started to resend the conditions.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::refreshFinished()
+
+    This signal is emitted when the server has finished resending the conditions.
+    All conditions which were not part of the refresh have been removed.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::refreshCallFinished(QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after the ConditionRefresh method call has finished with status \a statusCode.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::conditionsChanged(QStringList added, QStringList changed, QStringList removed)
+
+    This signal is emitted once for every batch of events which changed the cache.
+    \a added, \a changed and \a removed contain the ids of the affected conditions.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::acknowledgeFinished(QString conditionId, QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after the Acknowledge call for the condition \a conditionId
+    has finished with status \a statusCode.
+*/
+
+/*!
+    \fn void QOpcUaConditionCache::confirmFinished(QString conditionId, QOpcUa::UaStatusCode statusCode)
+
+    This signal is emitted after the Confirm call for the condition \a conditionId
+    has finished with status \a statusCode.
+*/
+
+namespace {
+const QString conditionTypeId = QStringLiteral("ns=0;i=2782");
+const QString acknowledgeableConditionTypeId = QStringLiteral("ns=0;i=2881");
+const QString alarmConditionTypeId = QStringLiteral("ns=0;i=2915");
+const QString conditionRefreshMethodId = QStringLiteral("ns=0;i=3875");
+const QString acknowledgeMethodId = QStringLiteral("ns=0;i=9111");
+const QString confirmMethodId = QStringLiteral("ns=0;i=9113");
+const QString refreshStartEventTypeId = QStringLiteral("ns=0;i=2787");
+const QString refreshEndEventTypeId = QStringLiteral("ns=0;i=2788");
+const QString refreshRequiredEventTypeId = QStringLiteral("ns=0;i=2789");
+
+QOpcUaSimpleAttributeOperand stateIdOperand(const QString &state, const QString &typeId)
+{
+    QOpcUaSimpleAttributeOperand operand;
+    operand.setTypeId(typeId);
+    operand.setBrowsePath({QOpcUaQualifiedName(0, state), QOpcUaQualifiedName(0, QStringLiteral("Id"))});
+    return operand;
+}
+
+bool isNullNodeId(const QVariant &nodeId)
+{
+    const QString id = nodeId.toString();
+    return id.isEmpty() || id == QLatin1String("ns=0;i=0") || id == QLatin1String("i=0");
+}
+}
+
+QOpcUaConditionCachePrivate::QOpcUaConditionCachePrivate(QOpcUaClient *client, const QString &notifierNodeId)
+    : m_client(client)
+    , m_notifierNodeId(notifierNodeId)
+{
+}
+
+void QOpcUaConditionCachePrivate::init()
+{
+    Q_Q(QOpcUaConditionCache);
+
+    m_callTimer = new QTimer(q);
+    m_callTimer->setSingleShot(true);
+    m_callTimer->setInterval(0);
+    QObject::connect(m_callTimer, &QTimer::timeout, q, [this]() { flushCalls(); });
+
+    if (!m_client)
+        return;
+
+    QObject::connect(m_client, &QOpcUaClient::stateChanged, q, [this](QOpcUaClient::ClientState state) {
+        handleStateChanged(state);
+    });
+
+    if (QOpcUaClientImpl *impl = clientImpl()) {
+        QObject::connect(impl, &QOpcUaClientImpl::callMethodsFinished, q,
+                         [this](quint64 requestId, QVector<QOpcUa::UaStatusCode> results, QOpcUa::UaStatusCode serviceResult) {
+            handleCallMethodsFinished(requestId, results, serviceResult);
+        });
+    }
+}
+
+QVector<QOpcUaSimpleAttributeOperand> QOpcUaConditionCachePrivate::selectClauses() const
+{
+    QVector<QOpcUaSimpleAttributeOperand> clauses;
+    clauses.reserve(FieldCount + m_additionalSelectClauses.size());
+
+    // The order must match QOpcUaConditionCachePrivate::Field
+    clauses << QOpcUaSimpleAttributeOperand(QStringLiteral("EventId"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("EventType"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("SourceNode"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("SourceName"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("Time"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("Message"))
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("Severity"))
+            << QOpcUaSimpleAttributeOperand(QOpcUa::NodeAttribute::NodeId, conditionTypeId)
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("ConditionName"), 0, conditionTypeId)
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("BranchId"), 0, conditionTypeId)
+            << QOpcUaSimpleAttributeOperand(QStringLiteral("Retain"), 0, conditionTypeId)
+            << stateIdOperand(QStringLiteral("EnabledState"), conditionTypeId)
+            << stateIdOperand(QStringLiteral("AckedState"), acknowledgeableConditionTypeId)
+            << stateIdOperand(QStringLiteral("ConfirmedState"), acknowledgeableConditionTypeId)
+            << stateIdOperand(QStringLiteral("ActiveState"), alarmConditionTypeId);
+
+    clauses << m_additionalSelectClauses;
+    return clauses;
+}
+
+bool QOpcUaConditionCachePrivate::createNode()
+{
+    Q_Q(QOpcUaConditionCache);
+
+    if (!m_client)
+        return false;
+
+    m_node = m_client->node(m_notifierNodeId);
+    if (!m_node)
+        return false;
+
+    m_node->setParent(q);
+
+    QObject::connect(m_node, &QOpcUaNode::eventsOccurred, q, [this](const QVector<QOpcUaEventRecord> &events) {
+        processEvents(events);
+    });
+    QObject::connect(m_node, &QOpcUaNode::enableMonitoringFinished, q,
+                     [this](QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode) {
+        handleEnableMonitoringFinished(attr, statusCode);
+    });
+
+    QOpcUaMonitoringParameters parameters = m_parameters;
+    QOpcUaMonitoringParameters::EventFilter filter;
+    filter.setSelectClauses(selectClauses());
+    parameters.setFilter(filter);
+
+    if (!m_node->enableMonitoring(QOpcUa::NodeAttribute::EventNotifier, parameters)) {
+        resetNode();
+        return false;
+    }
+
+    return true;
+}
+
+void QOpcUaConditionCachePrivate::resetNode()
+{
+    Q_Q(QOpcUaConditionCache);
+
+    // Deleting the node also disables the monitoring. This may be called from a signal of the node.
+    if (m_node) {
+        QObject::disconnect(m_node, nullptr, q, nullptr);
+        m_node->deleteLater();
+        m_node = nullptr;
+    }
+    m_refreshing = false;
+}
+
+void QOpcUaConditionCachePrivate::processEvents(const QVector<QOpcUaEventRecord> &events)
+{
+    Q_Q(QOpcUaConditionCache);
+
+    for (const QOpcUaEventRecord &event : events) {
+        const QString eventType = event.field(EventType).toString();
+
+        if (eventType == refreshStartEventTypeId) {
+            // Report the changes from before the refresh separately
+            flushChanges();
+            m_refreshing = true;
+            ++m_generation;
+            emit q->refreshStarted();
+            continue;
+        }
+
+        if (eventType == refreshEndEventTypeId) {
+            if (m_refreshing) {
+                QStringList stale;
+                for (auto it = m_conditions.constBegin(); it != m_conditions.constEnd(); ++it) {
+                    if (it.value().generation != m_generation)
+                        stale.push_back(it.key());
+                }
+                for (const QString &conditionId : qAsConst(stale))
+                    removeCondition(conditionId);
+                m_refreshing = false;
+            }
+            flushChanges();
+            emit q->refreshFinished();
+            continue;
+        }
+
+        if (eventType == refreshRequiredEventTypeId) {
+            q->refresh();
+            continue;
+        }
+
+        const QString conditionId = event.field(ConditionId).toString();
+        if (conditionId.isEmpty())
+            continue;
+
+        if (!isNullNodeId(event.field(BranchId)))
+            continue;
+
+        if (event.field(Retain).toBool())
+            updateCondition(conditionId, event);
+        else
+            removeCondition(conditionId);
+    }
+
+    flushChanges();
+}
+
+void QOpcUaConditionCachePrivate::updateCondition(const QString &conditionId, const QOpcUaEventRecord &record)
+{
+    auto it = m_conditions.find(conditionId);
+    if (it == m_conditions.end()) {
+        Entry entry;
+        entry.record = record;
+        entry.generation = m_generation;
+        m_conditions.insert(conditionId, entry);
+        recordChange(conditionId, ChangeKind::Added);
+    } else {
+        it->record = record;
+        it->generation = m_generation;
+        recordChange(conditionId, ChangeKind::Changed);
+    }
+}
+
+void QOpcUaConditionCachePrivate::removeCondition(const QString &conditionId)
+{
+    if (m_conditions.remove(conditionId))
+        recordChange(conditionId, ChangeKind::Removed);
+}
+
+/*
+    Merges \a kind with a change already recorded for \a conditionId in the current batch,
+    so each condition is reported at most once per batch.
+*/
+void QOpcUaConditionCachePrivate::recordChange(const QString &conditionId, ChangeKind kind)
+{
+    auto it = m_pendingChanges.find(conditionId);
+    if (it == m_pendingChanges.end()) {
+        m_pendingChanges.insert(conditionId, kind);
+        return;
+    }
+
+    switch (it.value()) {
+    case ChangeKind::Added:
+        if (kind == ChangeKind::Removed)
+            m_pendingChanges.erase(it);
+        break;
+    case ChangeKind::Changed:
+        if (kind == ChangeKind::Removed)
+            it.value() = ChangeKind::Removed;
+        break;
+    case ChangeKind::Removed:
+        if (kind == ChangeKind::Added)
+            it.value() = ChangeKind::Changed;
+        break;
+    }
+}
+
+void QOpcUaConditionCachePrivate::flushChanges()
+{
+    Q_Q(QOpcUaConditionCache);
+
+    if (m_pendingChanges.isEmpty())
+        return;
+
+    QStringList added;
+    QStringList changed;
+    QStringList removed;
+
+    for (auto it = m_pendingChanges.constBegin(); it != m_pendingChanges.constEnd(); ++it) {
+        switch (it.value()) {
+        case ChangeKind::Added:
+            added.push_back(it.key());
+            break;
+        case ChangeKind::Changed:
+            changed.push_back(it.key());
+            break;
+        case ChangeKind::Removed:
+            removed.push_back(it.key());
+            break;
+        }
+    }
+
+    m_pendingChanges.clear();
+    emit q->conditionsChanged(added, changed, removed);
+}
+
+void QOpcUaConditionCachePrivate::clear()
+{
+    for (auto it = m_conditions.constBegin(); it != m_conditions.constEnd(); ++it)
+        recordChange(it.key(), ChangeKind::Removed);
+    m_conditions.clear();
+    flushChanges();
+}
+
+void QOpcUaConditionCachePrivate::handleEnableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode)
+{
+    Q_Q(QOpcUaConditionCache);
+
+    if (attr != QOpcUa::NodeAttribute::EventNotifier)
+        return;
+
+    if (statusCode == QOpcUa::UaStatusCode::Good) {
+        q->refresh();
+    } else {
+        // The cache must be enabled again by the user, a reconnect doesn't retry
+        m_enabled = false;
+        resetNode();
+    }
+
+    emit q->enableFinished(statusCode);
+}
+
+void QOpcUaConditionCachePrivate::handleStateChanged(QOpcUaClient::ClientState state)
+{
+    if (!m_enabled)
+        return;
+
+    // The cached conditions are kept across a reconnect, the refresh after enabling
+    // the monitoring again removes the conditions which are no longer retained.
+    if (state == QOpcUaClient::ClientState::Disconnected)
+        resetNode();
+    else if (state == QOpcUaClient::ClientState::Connected && !m_node)
+        createNode();
+}
+
+bool QOpcUaConditionCachePrivate::queueConditionCall(CallKind kind, const QString &conditionId,
+                                                     const QString &methodId, const QOpcUaLocalizedText &comment)
+{
+    if (!m_client)
+        return false;
+
+    auto it = m_conditions.constFind(conditionId);
+    if (it == m_conditions.constEnd())
+        return false;
+
+    PendingCall call;
+    call.kind = kind;
+    call.conditionId = conditionId;
+    call.item.objectId = conditionId;
+    call.item.methodId = methodId;
+    call.item.inputArguments.push_back(QOpcUa::TypedVariant(it->record.field(EventId), QOpcUa::Types::ByteString));
+    call.item.inputArguments.push_back(QOpcUa::TypedVariant(QVariant::fromValue(comment), QOpcUa::Types::LocalizedText));
+    queueCall(call);
+    return true;
+}
+
+void QOpcUaConditionCachePrivate::queueCall(const PendingCall &call)
+{
+    m_queuedCalls.push_back(call);
+    if (!m_callTimer->isActive())
+        m_callTimer->start();
+}
+
+/*
+    Sends all calls queued in the current iteration of the event loop in one Call service request.
+    Backends without support for this fall back to one request per call.
+*/
+void QOpcUaConditionCachePrivate::flushCalls()
+{
+    Q_Q(QOpcUaConditionCache);
+
+    if (m_queuedCalls.isEmpty())
+        return;
+
+    QVector<PendingCall> calls;
+    calls.swap(m_queuedCalls);
+
+    QOpcUaClientImpl *impl = clientImpl();
+    if (!impl) {
+        for (const PendingCall &call : qAsConst(calls))
+            finishCall(call, QOpcUa::UaStatusCode::BadDisconnect);
+        return;
+    }
+
+    static QAtomicInteger<quint64> nextRequestId(0);
+    const quint64 requestId = ++nextRequestId;
+
+    QVector<QOpcUaMethodCallItem> items;
+    items.reserve(calls.size());
+    for (const PendingCall &call : qAsConst(calls))
+        items.push_back(call.item);
+
+    m_runningCalls.insert(requestId, calls);
+    if (impl->callMethods(requestId, items))
+        return;
+
+    m_runningCalls.remove(requestId);
+
+    for (const PendingCall &call : qAsConst(calls)) {
+        QOpcUaNode *object = m_client->node(call.item.objectId);
+        if (!object) {
+            finishCall(call, QOpcUa::UaStatusCode::BadNodeIdInvalid);
+            continue;
+        }
+        object->setParent(q);
+        QObject::connect(object, &QOpcUaNode::methodCallFinished, q,
+                         [this, call, object](const QString &methodNodeId, const QVariant &result, QOpcUa::UaStatusCode statusCode) {
+            Q_UNUSED(methodNodeId);
+            Q_UNUSED(result);
+            object->deleteLater();
+            finishCall(call, statusCode);
+        });
+        if (!object->callMethod(call.item.methodId, call.item.inputArguments)) {
+            delete object;
+            finishCall(call, QOpcUa::UaStatusCode::BadInternalError);
+        }
+    }
+}
+
+void QOpcUaConditionCachePrivate::handleCallMethodsFinished(quint64 requestId, const QVector<QOpcUa::UaStatusCode> &results,
+                                                            QOpcUa::UaStatusCode serviceResult)
+{
+    const QVector<PendingCall> calls = m_runningCalls.take(requestId);
+
+    for (int i = 0; i < calls.size(); ++i) {
+        const QOpcUa::UaStatusCode statusCode = serviceResult != QOpcUa::UaStatusCode::Good
+                ? serviceResult : results.value(i, QOpcUa::UaStatusCode::BadInternalError);
+        finishCall(calls.at(i), statusCode);
+    }
+}
+
+void QOpcUaConditionCachePrivate::finishCall(const PendingCall &call, QOpcUa::UaStatusCode statusCode)
+{
+    Q_Q(QOpcUaConditionCache);
+
+    switch (call.kind) {
+    case CallKind::Refresh:
+        emit q->refreshCallFinished(statusCode);
+        break;
+    case CallKind::Acknowledge:
+        emit q->acknowledgeFinished(call.conditionId, statusCode);
+        break;
+    case CallKind::Confirm:
+        emit q->confirmFinished(call.conditionId, statusCode);
+        break;
+    }
+}
+
+QOpcUaClientImpl *QOpcUaConditionCachePrivate::clientImpl() const
+{
+    if (!m_client)
+        return nullptr;
+    return static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client.data()))->m_impl.data();
+}
+
+/*!
+    Constructs a condition cache for the events of the notifier node \a notifierNodeId on the server \a client
+    is connected to. The default notifier is the Server object.
+*/
+QOpcUaConditionCache::QOpcUaConditionCache(QOpcUaClient *client, const QString &notifierNodeId, QObject *parent)
+    : QObject(*(new QOpcUaConditionCachePrivate(client, notifierNodeId)), parent)
+{
+    Q_D(QOpcUaConditionCache);
+    d->init();
+}
+
+/*!
+    Destroys the condition cache and disables the event monitoring.
+*/
+QOpcUaConditionCache::~QOpcUaConditionCache()
+{
+    Q_D(QOpcUaConditionCache);
+    d->resetNode();
+}
+
+/*!
+    Returns the node id of the monitored notifier node.
+*/
+QString QOpcUaConditionCache::notifierNodeId() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_notifierNodeId;
+}
+
+/*!
+    Sets \a selectClauses to be appended to the fixed select clauses of the event filter.
+    The new select clauses are used the next time monitoring is enabled.
+
+    \sa selectClauses()
+*/
+void QOpcUaConditionCache::setAdditionalSelectClauses(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses)
+{
+    Q_D(QOpcUaConditionCache);
+    d->m_additionalSelectClauses = selectClauses;
+}
+
+/*!
+    Returns the complete select clause of the event filter used by the cache.
+    The fields of the cached conditions are bound to this select clause.
+*/
+QVector<QOpcUaSimpleAttributeOperand> QOpcUaConditionCache::selectClauses() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->selectClauses();
+}
+
+/*!
+    Enables the event monitoring of the notifier node using \a parameters and calls ConditionRefresh
+    after the monitored item has been created. The filter of \a parameters is replaced by the event filter of the cache.
+
+    Returns \c true if the request has been dispatched to the backend.
+
+    \sa enableFinished() disable()
+*/
+bool QOpcUaConditionCache::enable(const QOpcUaMonitoringParameters &parameters)
+{
+    Q_D(QOpcUaConditionCache);
+
+    if (d->m_enabled)
+        return false;
+
+    d->m_parameters = parameters;
+    if (!d->createNode())
+        return false;
+
+    d->m_enabled = true;
+    return true;
+}
+
+/*!
+    Disables the event monitoring and removes all conditions from the cache.
+*/
+void QOpcUaConditionCache::disable()
+{
+    Q_D(QOpcUaConditionCache);
+
+    d->m_enabled = false;
+    d->resetNode();
+    d->clear();
+}
+
+/*!
+    Returns \c true if the cache is enabled.
+*/
+bool QOpcUaConditionCache::isEnabled() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_enabled;
+}
+
+/*!
+    Calls the ConditionRefresh method for the subscription of the monitored item.
+    This happens automatically after monitoring has been enabled and after reconnecting.
+
+    Returns \c true if the call has been queued.
+
+    \sa refreshCallFinished() refreshStarted() refreshFinished()
+*/
+bool QOpcUaConditionCache::refresh()
+{
+    Q_D(QOpcUaConditionCache);
+
+    if (!d->m_node)
+        return false;
+
+    const quint32 subscriptionId = d->m_node->monitoringStatus(QOpcUa::NodeAttribute::EventNotifier).subscriptionId();
+    if (!subscriptionId)
+        return false;
+
+    QOpcUaConditionCachePrivate::PendingCall call;
+    call.kind = QOpcUaConditionCachePrivate::CallKind::Refresh;
+    call.item.objectId = conditionTypeId;
+    call.item.methodId = conditionRefreshMethodId;
+    call.item.inputArguments.push_back(QOpcUa::TypedVariant(subscriptionId, QOpcUa::Types::UInt32));
+    d->queueCall(call);
+    return true;
+}
+
+/*!
+    Returns \c true if the server is resending the conditions.
+*/
+bool QOpcUaConditionCache::isRefreshing() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_refreshing;
+}
+
+/*!
+    Returns the number of cached conditions.
+*/
+int QOpcUaConditionCache::size() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_conditions.size();
+}
+
+/*!
+    Returns \c true if the condition \a conditionId is cached.
+*/
+bool QOpcUaConditionCache::contains(const QString &conditionId) const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_conditions.contains(conditionId);
+}
+
+/*!
+    Returns the ids of all cached conditions.
+*/
+QStringList QOpcUaConditionCache::conditionIds() const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_conditions.keys();
+}
+
+/*!
+    Returns the latest event of the condition \a conditionId or an empty record if the condition is not cached.
+*/
+QOpcUaEventRecord QOpcUaConditionCache::condition(const QString &conditionId) const
+{
+    Q_D(const QOpcUaConditionCache);
+    return d->m_conditions.value(conditionId).record;
+}
+
+/*!
+    Calls the Acknowledge method of the cached condition \a conditionId with \a comment.
+
+    Returns \c true if the call has been queued.
+
+    \sa acknowledgeFinished()
+*/
+bool QOpcUaConditionCache::acknowledge(const QString &conditionId, const QOpcUaLocalizedText &comment)
+{
+    Q_D(QOpcUaConditionCache);
+    return d->queueConditionCall(QOpcUaConditionCachePrivate::CallKind::Acknowledge, conditionId,
+                                 acknowledgeMethodId, comment);
+}
+
+/*!
+    Calls the Confirm method of the cached condition \a conditionId with \a comment.
+
+    Returns \c true if the call has been queued.
+
+    \sa confirmFinished()
+*/
+bool QOpcUaConditionCache::confirm(const QString &conditionId, const QOpcUaLocalizedText &comment)
+{
+    Q_D(QOpcUaConditionCache);
+    return d->queueConditionCall(QOpcUaConditionCachePrivate::CallKind::Confirm, conditionId,
+                                 confirmMethodId, comment);
+}
+
+QT_END_NAMESPACE
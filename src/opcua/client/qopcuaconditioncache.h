@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACONDITIONCACHE_H
+#define QOPCUACONDITIONCACHE_H
+
+#include <QtOpcUa/qopcuaeventrecord.h>
+#include <QtOpcUa/qopcualocalizedtext.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClient;
+class QOpcUaConditionCachePrivate;
+
+class Q_OPCUA_EXPORT QOpcUaConditionCache : public QObject
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QOpcUaConditionCache)
+
+public:
+    explicit QOpcUaConditionCache(QOpcUaClient *client,
+                                  const QString &notifierNodeId = QStringLiteral("ns=0;i=2253"), // Server
+                                  QObject *parent = nullptr);
+    ~QOpcUaConditionCache();
+
+    QString notifierNodeId() const;
+
+    void setAdditionalSelectClauses(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses);
+    QVector<QOpcUaSimpleAttributeOperand> selectClauses() const;
+
+    bool enable(const QOpcUaMonitoringParameters &parameters = QOpcUaMonitoringParameters(100));
+    void disable();
+    bool isEnabled() const;
+
+    bool refresh();
+    bool isRefreshing() const;
+
+    int size() const;
+    bool contains(const QString &conditionId) const;
+    QStringList conditionIds() const;
+    QOpcUaEventRecord condition(const QString &conditionId) const;
+
+    bool acknowledge(const QString &conditionId, const QOpcUaLocalizedText &comment);
+    bool confirm(const QString &conditionId, const QOpcUaLocalizedText &comment);
+
+Q_SIGNALS:
+    void enableFinished(QOpcUa::UaStatusCode statusCode);
+    void refreshStarted();
+    void refreshFinished();
+    void refreshCallFinished(QOpcUa::UaStatusCode statusCode);
+    void conditionsChanged(QStringList added, QStringList changed, QStringList removed);
+    void acknowledgeFinished(QString conditionId, QOpcUa::UaStatusCode statusCode);
+    void confirmFinished(QString conditionId, QOpcUa::UaStatusCode statusCode);
+
+private:
+    Q_DISABLE_COPY(QOpcUaConditionCache)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUACONDITIONCACHE_H
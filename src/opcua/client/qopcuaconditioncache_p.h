@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUACONDITIONCACHE_P_H
+#define QOPCUACONDITIONCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuaconditioncache.h>
+#include <private/qopcuamethodcallitem_p.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qpointer.h>
+#include <private/qobject_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClientImpl;
+class QOpcUaNode;
+class QTimer;
+
+class Q_OPCUA_EXPORT QOpcUaConditionCachePrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QOpcUaConditionCache)
+
+public:
+    // Indices of the fixed part of the select clauses
+    enum Field {
+        EventId,
+        EventType,
+        SourceNode,
+        SourceName,
+        Time,
+        Message,
+        Severity,
+        ConditionId,
+        ConditionName,
+        BranchId,
+        Retain,
+        EnabledState,
+        AckedState,
+        ConfirmedState,
+        ActiveState,
+        FieldCount
+    };
+
+    enum class ChangeKind {
+        Added,
+        Changed,
+        Removed
+    };
+
+    enum class CallKind {
+        Refresh,
+        Acknowledge,
+        Confirm
+    };
+
+    struct Entry {
+        QOpcUaEventRecord record;
+        quint32 generation = 0;
+    };
+
+    struct PendingCall {
+        CallKind kind;
+        QString conditionId;
+        QOpcUaMethodCallItem item;
+    };
+
+    QOpcUaConditionCachePrivate(QOpcUaClient *client, const QString &notifierNodeId);
+
+    static QOpcUaConditionCachePrivate *get(QOpcUaConditionCache *cache) { return cache->d_func(); }
+
+    void init();
+
+    QVector<QOpcUaSimpleAttributeOperand> selectClauses() const;
+
+    bool createNode();
+    void resetNode();
+
+    void processEvents(const QVector<QOpcUaEventRecord> &events);
+    void updateCondition(const QString &conditionId, const QOpcUaEventRecord &record);
+    void removeCondition(const QString &conditionId);
+    void recordChange(const QString &conditionId, ChangeKind kind);
+    void flushChanges();
+    void clear();
+
+    void handleEnableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode);
+    void handleStateChanged(QOpcUaClient::ClientState state);
+
+    bool queueConditionCall(CallKind kind, const QString &conditionId, const QString &methodId,
+                            const QOpcUaLocalizedText &comment);
+    void queueCall(const PendingCall &call);
+    void flushCalls();
+    void handleCallMethodsFinished(quint64 requestId, const QVector<QOpcUa::UaStatusCode> &results,
+                                   QOpcUa::UaStatusCode serviceResult);
+    void finishCall(const PendingCall &call, QOpcUa::UaStatusCode statusCode);
+
+    QOpcUaClientImpl *clientImpl() const;
+
+    QPointer<QOpcUaClient> m_client;
+    QString m_notifierNodeId;
+    QVector<QOpcUaSimpleAttributeOperand> m_additionalSelectClauses;
+    QOpcUaMonitoringParameters m_parameters;
+    QOpcUaNode *m_node = nullptr;
+    bool m_enabled = false;
+    bool m_refreshing = false;
+
+    // Conditions seen since the last RefreshStartEvent carry the current generation,
+    // all others are removed when the RefreshEndEvent arrives.
+    quint32 m_generation = 0;
+    QHash<QString, Entry> m_conditions;
+    QHash<QString, ChangeKind> m_pendingChanges;
+
+    QVector<PendingCall> m_queuedCalls;
+    QHash<quint64, QVector<PendingCall>> m_runningCalls;
+    QTimer *m_callTimer = nullptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaConditionCachePrivate::Entry, Q_MOVABLE_TYPE);
+Q_DECLARE_TYPEINFO(QOpcUaConditionCachePrivate::PendingCall, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUACONDITIONCACHE_P_H
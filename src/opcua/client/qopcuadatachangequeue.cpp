@@ -0,0 +1,258 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuadatachangequeue_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QOpcUaDataChangeQueue transports data changes from the backend thread to the thread of the client.
+
+    Instead of posting one metacall per data change, the backend appends to this queue and the client
+    is only notified if there is no notification pending. The client then takes all pending entries at once.
+    If the client thread stalls, the number of pending entries is limited according to the overflow policy
+    and every value which is not delivered increments the overflow counter.
+
+    Adding an entry takes amortized constant time while the mutex is locked, the ring buffer only
+    has to grow until it holds the limit. takeAll() and close() swap the pending entries out and
+    reorder or destroy them after unlocking the mutex.
+*/
+
+QOpcUaDataChangeQueue::QOpcUaDataChangeQueue()
+    : m_head(0)
+    , m_size(0)
+    , m_firstSequence(0)
+    , m_limit(0)
+    , m_policy(QOpcUaClient::DataChangeOverflowPolicy::DropOldest)
+    , m_overflowCount(0)
+    , m_notificationPending(false)
+    , m_closed(false)
+{
+}
+
+/*
+    Adds a data change for the monitored item identified by \a handle and \a attribute.
+    Returns true if the consumer must be notified because there is no notification pending.
+*/
+bool QOpcUaDataChangeQueue::enqueue(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_closed)
+        return false;
+
+    if (m_limit > 0 && size() >= m_limit) {
+        switch (m_policy) {
+        case QOpcUaClient::DataChangeOverflowPolicy::KeepLatest: {
+            ++m_overflowCount;
+            auto it = m_latest.constFind(Key(handle, attribute));
+            if (it != m_latest.constEnd()) {
+                entryAt(it.value()).value = value;
+                return false;
+            }
+            // There is no pending value for this item which could be replaced
+            dropOldest();
+            break;
+        }
+        case QOpcUaClient::DataChangeOverflowPolicy::DropOldest:
+            ++m_overflowCount;
+            dropOldest();
+            break;
+        case QOpcUaClient::DataChangeOverflowPolicy::Block:
+            ++m_overflowCount;
+            while (!m_closed && m_policy == QOpcUaClient::DataChangeOverflowPolicy::Block && m_limit > 0 && size() >= m_limit)
+                m_notFull.wait(&m_mutex);
+            if (m_closed)
+                return false;
+            break;
+        }
+    }
+
+    append(handle, attribute, value);
+
+    if (m_notificationPending)
+        return false;
+    m_notificationPending = true;
+    return true;
+}
+
+/*
+    Removes all pending entries from the queue and returns them in the order they were added.
+*/
+QVector<QOpcUaDataChangeQueue::Entry> QOpcUaDataChangeQueue::takeAll()
+{
+    QMutexLocker locker(&m_mutex);
+
+    QVector<Entry> entries;
+    entries.swap(m_entries);
+    QHash<Key, quint64> latest;
+    latest.swap(m_latest);
+    const int head = m_head;
+    const int size = m_size;
+
+    m_firstSequence += m_size;
+    m_head = 0;
+    m_size = 0;
+    m_notificationPending = false;
+
+    m_notFull.wakeAll();
+    locker.unlock();
+
+    // Unused slots of the ring buffer only contain empty values
+    if (head == 0) {
+        entries.resize(size);
+        return entries;
+    }
+
+    QVector<Entry> result;
+    result.reserve(size);
+    for (int i = 0; i < size; ++i)
+        result.push_back(std::move(entries[(head + i) % entries.size()]));
+    return result;
+}
+
+/*
+    Discards all pending entries and releases a producer waiting for free space.
+    Data changes added after this call are ignored.
+*/
+void QOpcUaDataChangeQueue::close()
+{
+    QMutexLocker locker(&m_mutex);
+    m_closed = true;
+
+    // The entries are destroyed after unlocking the mutex
+    QVector<Entry> entries;
+    entries.swap(m_entries);
+    QHash<Key, quint64> latest;
+    latest.swap(m_latest);
+
+    m_firstSequence += m_size;
+    m_head = 0;
+    m_size = 0;
+    m_notFull.wakeAll();
+    locker.unlock();
+}
+
+/*
+    Sets the maximum number of pending entries to \a limit. A limit of 0 disables the limit.
+*/
+void QOpcUaDataChangeQueue::setLimit(int limit)
+{
+    QMutexLocker locker(&m_mutex);
+    m_limit = qMax(0, limit);
+    m_notFull.wakeAll();
+}
+
+int QOpcUaDataChangeQueue::limit() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_limit;
+}
+
+void QOpcUaDataChangeQueue::setOverflowPolicy(QOpcUaClient::DataChangeOverflowPolicy policy)
+{
+    QMutexLocker locker(&m_mutex);
+    m_policy = policy;
+    m_notFull.wakeAll();
+}
+
+QOpcUaClient::DataChangeOverflowPolicy QOpcUaDataChangeQueue::overflowPolicy() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_policy;
+}
+
+quint64 QOpcUaDataChangeQueue::overflowCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_overflowCount;
+}
+
+int QOpcUaDataChangeQueue::pendingCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return size();
+}
+
+int QOpcUaDataChangeQueue::size() const
+{
+    return m_size;
+}
+
+QOpcUaDataChangeQueue::Entry &QOpcUaDataChangeQueue::entryAt(quint64 sequence)
+{
+    return m_entries[(m_head + static_cast<int>(sequence - m_firstSequence)) % m_entries.size()];
+}
+
+void QOpcUaDataChangeQueue::dropOldest()
+{
+    Entry &oldest = m_entries[m_head];
+    auto it = m_latest.find(Key(oldest.handle, oldest.attribute));
+    if (it != m_latest.end() && it.value() == m_firstSequence)
+        m_latest.erase(it);
+    oldest.value = QOpcUaDataValue();
+
+    m_head = (m_head + 1) % m_entries.size();
+    --m_size;
+    ++m_firstSequence;
+}
+
+void QOpcUaDataChangeQueue::append(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value)
+{
+    if (m_size == m_entries.size())
+        grow();
+
+    const quint64 sequence = m_firstSequence + m_size;
+    ++m_size;
+    entryAt(sequence) = {handle, attribute, value};
+    if (m_policy == QOpcUaClient::DataChangeOverflowPolicy::KeepLatest)
+        m_latest[Key(handle, attribute)] = sequence;
+}
+
+/*
+    Doubles the capacity of the ring buffer and moves the pending entries to its beginning.
+    The sequence numbers in m_latest stay valid.
+*/
+void QOpcUaDataChangeQueue::grow()
+{
+    QVector<Entry> entries(qMax(16, 2 * m_entries.size()));
+    for (int i = 0; i < m_size; ++i)
+        entries[i] = std::move(m_entries[(m_head + i) % m_entries.size()]);
+    m_entries.swap(entries);
+    m_head = 0;
+}
+
+QT_END_NAMESPACE
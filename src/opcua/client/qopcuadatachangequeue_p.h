@@ -0,0 +1,116 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUADATACHANGEQUEUE_P_H
+#define QOPCUADATACHANGEQUEUE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuadatavalue.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qwaitcondition.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaDataChangeQueue
+{
+public:
+    struct Entry {
+        quint64 handle;
+        QOpcUa::NodeAttribute attribute;
+        QOpcUaDataValue value;
+    };
+
+    QOpcUaDataChangeQueue();
+
+    bool enqueue(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value);
+    QVector<Entry> takeAll();
+    void close();
+
+    void setLimit(int limit);
+    int limit() const;
+    void setOverflowPolicy(QOpcUaClient::DataChangeOverflowPolicy policy);
+    QOpcUaClient::DataChangeOverflowPolicy overflowPolicy() const;
+    quint64 overflowCount() const;
+    int pendingCount() const;
+
+private:
+    typedef QPair<quint64, QOpcUa::NodeAttribute> Key;
+
+    int size() const;
+    Entry &entryAt(quint64 sequence);
+    void dropOldest();
+    void append(quint64 handle, QOpcUa::NodeAttribute attribute, const QOpcUaDataValue &value);
+    void grow();
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_notFull;
+
+    // Ring buffer of the pending entries, m_head is the index of the oldest one
+    QVector<Entry> m_entries;
+    int m_head;
+    int m_size;
+    // Sequence number of the oldest pending entry, the numbers are never reused
+    quint64 m_firstSequence;
+    // Sequence number of the most recent pending entry for each monitored item, used by KeepLatest
+    QHash<Key, quint64> m_latest;
+
+    int m_limit;
+    QOpcUaClient::DataChangeOverflowPolicy m_policy;
+    quint64 m_overflowCount;
+    bool m_notificationPending;
+    bool m_closed;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaDataChangeQueue::Entry, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUADATACHANGEQUEUE_P_H
@@ -0,0 +1,213 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuadatavalue.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaDataValue
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief This class stores a value together with its status code and timestamps.
+
+    This is the Qt OPC UA representation of the OPC UA DataValue type.
+    Objects of this class are delivered for data changes of monitored attributes
+    and as part of \l QOpcUaHistoryData.
+
+    As data values are created for every sample received from the server, the class stores
+    its members directly instead of in a shared data object and keeps the timestamps
+    as OPC UA DateTime ticks. A tick is an interval of 100 nanoseconds since January 1, 1601 UTC
+    (OPC-UA part 6, 5.2.2.5). The full resolution of the server timestamps is available from
+    \l sourceTimestampTicks() and \l serverTimestampTicks(), a \l QDateTime with millisecond
+    resolution is only created when \l sourceTimestamp() or \l serverTimestamp() is called.
+
+    A tick value of \c 0 marks a timestamp which has not been sent by the server.
+
+    \sa QOpcUaHistoryData
+*/
+
+// Offset between the OPC UA epoch (1601-01-01) and the Unix epoch (1970-01-01) in ticks
+static const qint64 unixEpochTicks = Q_INT64_C(116444736000000000);
+static const qint64 ticksPerMSec = 10000;
+
+/*!
+    Constructs a data value with status code \l {QOpcUa::UaStatusCode} {Good} and without value and timestamps.
+*/
+QOpcUaDataValue::QOpcUaDataValue()
+    : m_sourceTimestamp(0)
+    , m_serverTimestamp(0)
+    , m_statusCode(QOpcUa::UaStatusCode::Good)
+{
+}
+
+/*!
+    Returns the value.
+*/
+QVariant QOpcUaDataValue::value() const
+{
+    return m_value;
+}
+
+/*!
+    Sets the value to \a value.
+*/
+void QOpcUaDataValue::setValue(const QVariant &value)
+{
+    m_value = value;
+}
+
+/*!
+    Returns the status code for the value.
+*/
+QOpcUa::UaStatusCode QOpcUaDataValue::statusCode() const
+{
+    return m_statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaDataValue::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    m_statusCode = statusCode;
+}
+
+/*!
+    Returns the source timestamp for \l value().
+
+    An invalid \l QDateTime is returned if there is no source timestamp.
+
+    \sa sourceTimestampTicks()
+*/
+QDateTime QOpcUaDataValue::sourceTimestamp() const
+{
+    return ticksToDateTime(m_sourceTimestamp);
+}
+
+/*!
+    Sets the source timestamp to \a sourceTimestamp.
+*/
+void QOpcUaDataValue::setSourceTimestamp(const QDateTime &sourceTimestamp)
+{
+    m_sourceTimestamp = dateTimeToTicks(sourceTimestamp);
+}
+
+/*!
+    Returns the source timestamp for \l value() in OPC UA DateTime ticks.
+*/
+qint64 QOpcUaDataValue::sourceTimestampTicks() const
+{
+    return m_sourceTimestamp;
+}
+
+/*!
+    Sets the source timestamp to \a ticks.
+*/
+void QOpcUaDataValue::setSourceTimestampTicks(qint64 ticks)
+{
+    m_sourceTimestamp = ticks;
+}
+
+/*!
+    Returns the server timestamp for \l value().
+
+    An invalid \l QDateTime is returned if there is no server timestamp.
+
+    \sa serverTimestampTicks()
+*/
+QDateTime QOpcUaDataValue::serverTimestamp() const
+{
+    return ticksToDateTime(m_serverTimestamp);
+}
+
+/*!
+    Sets the server timestamp to \a serverTimestamp.
+*/
+void QOpcUaDataValue::setServerTimestamp(const QDateTime &serverTimestamp)
+{
+    m_serverTimestamp = dateTimeToTicks(serverTimestamp);
+}
+
+/*!
+    Returns the server timestamp for \l value() in OPC UA DateTime ticks.
+*/
+qint64 QOpcUaDataValue::serverTimestampTicks() const
+{
+    return m_serverTimestamp;
+}
+
+/*!
+    Sets the server timestamp to \a ticks.
+*/
+void QOpcUaDataValue::setServerTimestampTicks(qint64 ticks)
+{
+    m_serverTimestamp = ticks;
+}
+
+/*!
+    Converts the OPC UA DateTime \a ticks to a \l QDateTime in local time.
+    The sub-millisecond part of \a ticks is truncated.
+
+    An invalid \l QDateTime is returned for \c 0.
+*/
+QDateTime QOpcUaDataValue::ticksToDateTime(qint64 ticks)
+{
+    if (ticks == 0)
+        return QDateTime();
+
+    // Integer division truncates towards zero, round towards negative infinity for dates before 1970
+    qint64 msecs = (ticks - unixEpochTicks) / ticksPerMSec;
+    if (ticks < unixEpochTicks && (ticks - unixEpochTicks) % ticksPerMSec)
+        --msecs;
+
+    return QDateTime::fromMSecsSinceEpoch(msecs);
+}
+
+/*!
+    Converts \a dateTime to OPC UA DateTime ticks.
+
+    \c 0 is returned for an invalid \a dateTime.
+*/
+qint64 QOpcUaDataValue::dateTimeToTicks(const QDateTime &dateTime)
+{
+    if (!dateTime.isValid())
+        return 0;
+
+    return dateTime.toMSecsSinceEpoch() * ticksPerMSec + unixEpochTicks;
+}
+
+QT_END_NAMESPACE
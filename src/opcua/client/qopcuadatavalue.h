@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUADATAVALUE_H
+#define QOPCUADATAVALUE_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaDataValue
+{
+public:
+    QOpcUaDataValue();
+
+    QVariant value() const;
+    void setValue(const QVariant &value);
+
+    QOpcUa::UaStatusCode statusCode() const;
+    void setStatusCode(QOpcUa::UaStatusCode statusCode);
+
+    QDateTime sourceTimestamp() const;
+    void setSourceTimestamp(const QDateTime &sourceTimestamp);
+    qint64 sourceTimestampTicks() const;
+    void setSourceTimestampTicks(qint64 ticks);
+
+    QDateTime serverTimestamp() const;
+    void setServerTimestamp(const QDateTime &serverTimestamp);
+    qint64 serverTimestampTicks() const;
+    void setServerTimestampTicks(qint64 ticks);
+
+    static QDateTime ticksToDateTime(qint64 ticks);
+    static qint64 dateTimeToTicks(const QDateTime &dateTime);
+
+private:
+    QVariant m_value;
+    qint64 m_sourceTimestamp;
+    qint64 m_serverTimestamp;
+    QOpcUa::UaStatusCode m_statusCode;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaDataValue, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaDataValue)
+
+#endif // QOPCUADATAVALUE_H
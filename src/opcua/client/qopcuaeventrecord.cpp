@@ -0,0 +1,351 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaeventrecord.h"
+#include "qopcuaeventrecord_p.h"
+
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+
+#include <QtCore/qmetaobject.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaEventRecord
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief The fields of an event bound to the select clause of the event filter.
+
+    A QOpcUaEventRecord is delivered by \l QOpcUaNode::eventsOccurred() for every event
+    received for a monitored \l {QOpcUa::NodeAttribute} {EventNotifier} attribute.
+    Each field belongs to the select clause element at the same index of the
+    \l QOpcUaMonitoringParameters::EventFilter used for the monitored item.
+
+    Fields can be accessed by index or by name. The name of a field is determined by \l fieldName()
+    from its select clause element, the index of a name is looked up in a table which is shared by all
+    events of the monitored item.
+
+    The fields are kept in the representation of the backend and are only converted when they are
+    accessed for the first time. Fields that are never accessed are never converted.
+
+    \code
+    QObject::connect(node, &QOpcUaNode::eventsOccurred, [](const QVector<QOpcUaEventRecord> &events) {
+        for (const auto &event : events) {
+            const auto severity = event.field(QStringLiteral("Severity")).toUInt();
+            if (severity >= 700)
+                qDebug() << event.field(QStringLiteral("Message")).value<QOpcUaLocalizedText>().text();
+        }
+    });
+    \endcode
+*/
+
+QOpcUaEventFieldSource::~QOpcUaEventFieldSource()
+{
+}
+
+QOpcUaEventRecordLayout::QOpcUaEventRecordLayout(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses)
+    : selectClauses(selectClauses)
+{
+    names.reserve(selectClauses.size());
+    indices.reserve(selectClauses.size());
+    for (int i = 0; i < selectClauses.size(); ++i) {
+        names.push_back(QOpcUaEventRecord::fieldName(selectClauses.at(i)));
+        // If the same name is selected more than once, the first occurrence is found by name
+        if (!indices.contains(names.last()))
+            indices.insert(names.last(), i);
+    }
+}
+
+/*
+    Returns the layout for the select clause of \a filter or a null pointer if \a filter is not an event filter.
+*/
+QSharedPointer<const QOpcUaEventRecordLayout> QOpcUaEventRecordLayout::fromFilter(const QVariant &filter)
+{
+    if (!filter.canConvert<QOpcUaMonitoringParameters::EventFilter>())
+        return QSharedPointer<const QOpcUaEventRecordLayout>();
+
+    return QSharedPointer<const QOpcUaEventRecordLayout>::create(
+                filter.value<QOpcUaMonitoringParameters::EventFilter>().selectClauses());
+}
+
+QOpcUaEventRecordPrivate::QOpcUaEventRecordPrivate()
+    : size(0)
+{
+}
+
+QOpcUaEventRecordPrivate::QOpcUaEventRecordPrivate(const QOpcUaEventRecordPrivate &other)
+    : QSharedData(other)
+    , layout(other.layout)
+    , source(other.source)
+    , size(other.size)
+{
+    QMutexLocker locker(&other.mutex);
+    fields = other.fields;
+    converted = other.converted;
+}
+
+/*
+    Creates an event record for the fields provided by \a source, the record takes ownership of \a source.
+*/
+QOpcUaEventRecord QOpcUaEventRecordPrivate::create(const QSharedPointer<const QOpcUaEventRecordLayout> &layout,
+                                                   QOpcUaEventFieldSource *source)
+{
+    QOpcUaEventRecord result;
+    QOpcUaEventRecordPrivate *d = result.d_ptr.data();
+    d->layout = layout;
+    d->source.reset(source);
+    d->size = source ? source->size() : 0;
+    d->fields.reserve(d->size);
+    for (int i = 0; i < d->size; ++i)
+        d->fields.append(QVariant());
+    d->converted.fill(false, d->size);
+    return result;
+}
+
+/*
+    Creates an event record for the already converted \a fields.
+*/
+QOpcUaEventRecord QOpcUaEventRecordPrivate::create(const QSharedPointer<const QOpcUaEventRecordLayout> &layout,
+                                                   const QVariantList &fields)
+{
+    QOpcUaEventRecord result;
+    QOpcUaEventRecordPrivate *d = result.d_ptr.data();
+    d->layout = layout;
+    d->size = fields.size();
+    d->fields = fields;
+    return result;
+}
+
+QVariant QOpcUaEventRecordPrivate::field(int index) const
+{
+    if (index < 0 || index >= size)
+        return QVariant();
+
+    // Without a source, all fields have been converted on construction and are never modified
+    if (!source)
+        return fields.at(index);
+
+    QMutexLocker locker(&mutex);
+    if (!converted.at(index)) {
+        fields[index] = source->field(index);
+        converted[index] = true;
+    }
+    return fields.at(index);
+}
+
+/*!
+    Constructs an empty event record.
+*/
+QOpcUaEventRecord::QOpcUaEventRecord()
+    : d_ptr(new QOpcUaEventRecordPrivate)
+{
+}
+
+/*!
+    Constructs an event record with the values \a fields for the elements of \a selectClauses.
+*/
+QOpcUaEventRecord::QOpcUaEventRecord(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses, const QVariantList &fields)
+    : QOpcUaEventRecord(QOpcUaEventRecordPrivate::create(
+                            QSharedPointer<const QOpcUaEventRecordLayout>::create(selectClauses), fields))
+{
+}
+
+/*!
+    Constructs an event record from \a other.
+*/
+QOpcUaEventRecord::QOpcUaEventRecord(const QOpcUaEventRecord &other)
+    : d_ptr(other.d_ptr)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this event record.
+*/
+QOpcUaEventRecord &QOpcUaEventRecord::operator=(const QOpcUaEventRecord &rhs)
+{
+    if (this != &rhs)
+        d_ptr = rhs.d_ptr;
+    return *this;
+}
+
+QOpcUaEventRecord::~QOpcUaEventRecord()
+{
+}
+
+/*!
+    Returns the number of fields in this event record.
+*/
+int QOpcUaEventRecord::size() const
+{
+    return d_ptr->size;
+}
+
+/*!
+    Returns \c true if this event record has no fields.
+*/
+bool QOpcUaEventRecord::isEmpty() const
+{
+    return d_ptr->size == 0;
+}
+
+/*!
+    Returns the select clause elements the fields of this event record belong to.
+*/
+QVector<QOpcUaSimpleAttributeOperand> QOpcUaEventRecord::selectClauses() const
+{
+    return d_ptr->layout ? d_ptr->layout->selectClauses : QVector<QOpcUaSimpleAttributeOperand>();
+}
+
+/*!
+    Returns the names of the fields in the order of the select clause.
+
+    \sa fieldName()
+*/
+QStringList QOpcUaEventRecord::fieldNames() const
+{
+    return d_ptr->layout ? d_ptr->layout->names : QStringList();
+}
+
+/*!
+    Returns the index of the field named \a name or \c -1 if there is no such field.
+    If more than one field has the name \a name, the index of the first one is returned.
+
+    \sa fieldName()
+*/
+int QOpcUaEventRecord::indexOf(const QString &name) const
+{
+    if (!d_ptr->layout)
+        return -1;
+    return d_ptr->layout->indices.value(name, -1);
+}
+
+/*!
+    Returns \c true if this event record has a field named \a name.
+*/
+bool QOpcUaEventRecord::contains(const QString &name) const
+{
+    const int index = indexOf(name);
+    return index >= 0 && index < d_ptr->size;
+}
+
+/*!
+    Returns the value of the field at \a index.
+    An invalid \l QVariant is returned if \a index is out of range.
+
+    The field is converted when it is accessed for the first time.
+*/
+QVariant QOpcUaEventRecord::field(int index) const
+{
+    return d_ptr->field(index);
+}
+
+/*!
+    Returns the value of the field named \a name.
+    An invalid \l QVariant is returned if there is no such field.
+
+    \sa fieldName()
+*/
+QVariant QOpcUaEventRecord::field(const QString &name) const
+{
+    return d_ptr->field(indexOf(name));
+}
+
+/*!
+    Converts all fields and returns them as a list in the order of the select clause.
+*/
+QVariantList QOpcUaEventRecord::toVariantList() const
+{
+    if (!d_ptr->source)
+        return d_ptr->fields;
+
+    QVariantList result;
+    result.reserve(d_ptr->size);
+    for (int i = 0; i < d_ptr->size; ++i)
+        result.append(d_ptr->field(i));
+    return result;
+}
+
+/*!
+    Converts this event record to \l QVariant.
+*/
+QOpcUaEventRecord::operator QVariant() const
+{
+    return QVariant::fromValue(*this);
+}
+
+/*!
+    Returns the name of the field for the select clause element \a selectClause.
+
+    The name consists of the names of the browse path elements, separated by \c /.
+    If the attribute of the select clause element is not \l {QOpcUa::NodeAttribute} {Value},
+    the name of the attribute is appended after \c #.
+
+    \table
+    \header
+        \li Select clause element
+        \li Field name
+    \row
+        \li \c {QOpcUaSimpleAttributeOperand("Message")}
+        \li \c Message
+    \row
+        \li Browse path \c EnabledState, \c Id
+        \li \c EnabledState/Id
+    \row
+        \li \c {QOpcUaSimpleAttributeOperand(QOpcUa::NodeAttribute::NodeId, "ns=0;i=2782")}
+        \li \c #NodeId
+    \endtable
+*/
+QString QOpcUaEventRecord::fieldName(const QOpcUaSimpleAttributeOperand &selectClause)
+{
+    QString result;
+    const auto browsePath = selectClause.browsePath();
+    for (int i = 0; i < browsePath.size(); ++i) {
+        if (i > 0)
+            result.append(QLatin1Char('/'));
+        result.append(browsePath.at(i).name());
+    }
+
+    if (selectClause.attributeId() != QOpcUa::NodeAttribute::Value) {
+        result.append(QLatin1Char('#'));
+        result.append(QLatin1String(QMetaEnum::fromType<QOpcUa::NodeAttribute>().valueToKey(
+                                        static_cast<int>(selectClause.attributeId()))));
+    }
+
+    return result;
+}
+
+QT_END_NAMESPACE
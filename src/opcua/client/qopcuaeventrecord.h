@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAEVENTRECORD_H
+#define QOPCUAEVENTRECORD_H
+
+#include <QtOpcUa/qopcuasimpleattributeoperand.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaEventRecordPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaEventRecord
+{
+public:
+    QOpcUaEventRecord();
+    QOpcUaEventRecord(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses, const QVariantList &fields);
+    QOpcUaEventRecord(const QOpcUaEventRecord &other);
+    QOpcUaEventRecord &operator=(const QOpcUaEventRecord &rhs);
+    ~QOpcUaEventRecord();
+
+    int size() const;
+    bool isEmpty() const;
+
+    QVector<QOpcUaSimpleAttributeOperand> selectClauses() const;
+    QStringList fieldNames() const;
+    int indexOf(const QString &name) const;
+    bool contains(const QString &name) const;
+
+    QVariant field(int index) const;
+    QVariant field(const QString &name) const;
+
+    QVariantList toVariantList() const;
+
+    operator QVariant() const;
+
+    static QString fieldName(const QOpcUaSimpleAttributeOperand &selectClause);
+
+private:
+    friend class QOpcUaEventRecordPrivate;
+    QSharedDataPointer<QOpcUaEventRecordPrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaEventRecord)
+
+#endif // QOPCUAEVENTRECORD_H
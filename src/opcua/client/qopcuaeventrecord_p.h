@@ -0,0 +1,109 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAEVENTRECORD_P_H
+#define QOPCUAEVENTRECORD_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaeventrecord.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qsharedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+// Provides the fields of an event in the backend's native representation.
+// field() is called at most once per index and may be called from any thread.
+class Q_OPCUA_EXPORT QOpcUaEventFieldSource
+{
+public:
+    virtual ~QOpcUaEventFieldSource();
+
+    virtual int size() const = 0;
+    virtual QVariant field(int index) const = 0;
+};
+
+// The names of the fields of all events of a monitored item, created once per event filter
+class Q_OPCUA_EXPORT QOpcUaEventRecordLayout
+{
+public:
+    explicit QOpcUaEventRecordLayout(const QVector<QOpcUaSimpleAttributeOperand> &selectClauses);
+
+    static QSharedPointer<const QOpcUaEventRecordLayout> fromFilter(const QVariant &filter);
+
+    QVector<QOpcUaSimpleAttributeOperand> selectClauses;
+    QStringList names;
+    QHash<QString, int> indices;
+};
+
+class Q_OPCUA_EXPORT QOpcUaEventRecordPrivate : public QSharedData
+{
+public:
+    QOpcUaEventRecordPrivate();
+    QOpcUaEventRecordPrivate(const QOpcUaEventRecordPrivate &other);
+
+    static QOpcUaEventRecord create(const QSharedPointer<const QOpcUaEventRecordLayout> &layout,
+                                    QOpcUaEventFieldSource *source);
+    static QOpcUaEventRecord create(const QSharedPointer<const QOpcUaEventRecordLayout> &layout,
+                                    const QVariantList &fields);
+
+    QVariant field(int index) const;
+
+    QSharedPointer<const QOpcUaEventRecordLayout> layout;
+    QSharedPointer<QOpcUaEventFieldSource> source;
+    int size;
+
+    // Fields are converted from the source on first access
+    mutable QMutex mutex;
+    mutable QVariantList fields;
+    mutable QVector<bool> converted;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAEVENTRECORD_P_H
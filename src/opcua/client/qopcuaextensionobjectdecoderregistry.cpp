@@ -0,0 +1,187 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaextensionobjectdecoderregistry.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qglobal.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qreadwritelock.h>
+#include <QtCore/qsharedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaExtensionObjectDecoderRegistry
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief QOpcUaExtensionObjectDecoderRegistry holds decoders for extension objects with custom data types.
+
+    Extension objects with a binary encoded body of a data type not known to Qt OPC UA are delivered as
+    \l QOpcUaExtensionObject and must be decoded by the application. If a decoder is registered for the
+    encoding id of such an extension object, the backend calls the decoder directly on the received body
+    and delivers the returned value instead of the extension object.
+
+    The decoders are called in the thread of the backend and must be thread-safe. The decoder gets a
+    \l QOpcUaBinaryDataEncoding which reads from the buffer of the response without copying it.
+    The buffer is only valid during the call, data must be copied if it is needed afterwards.
+
+    \code
+    QOpcUaExtensionObjectDecoderRegistry::registerDecoder(QLatin1String("ns=2;i=5001"),
+        [](QOpcUaBinaryDataEncoding &decoder, bool &success) {
+            MyStructure result;
+            result.name = decoder.decode<QString>(success);
+            if (success)
+                result.value = decoder.decode<double>(success);
+            return QVariant::fromValue(result);
+        });
+    \endcode
+
+    The registry applies to all clients in the process. A decoder registered for an encoding id of
+    namespace 0 replaces the built-in decoding of this type.
+*/
+
+/*!
+    \typealias QOpcUaExtensionObjectDecoderRegistry::Decoder
+
+    A function which decodes the body of an extension object from the data buffer of a \l QOpcUaBinaryDataEncoding
+    and returns the decoded value. The second parameter must be set to \c true if decoding was successful.
+*/
+
+/*!
+    \fn template <typename T> void QOpcUaExtensionObjectDecoderRegistry::registerType(const QString &encodingId)
+
+    Registers a decoder for \a encodingId which decodes the body using the \l QOpcUaBinaryDataEncoding::decode()
+    specialization for \c T.
+*/
+
+namespace {
+struct DecoderRegistry {
+    QReadWriteLock lock;
+    QHash<QString, QSharedPointer<const QOpcUaExtensionObjectDecoderRegistry::Decoder>> decoders;
+    QAtomicInt count; // Allows checking for registered decoders without taking the lock
+};
+}
+
+Q_GLOBAL_STATIC(DecoderRegistry, decoderRegistry)
+
+/*!
+    Registers \a decoder for extension objects with the encoding id \a encodingId.
+    An existing decoder for \a encodingId is replaced.
+*/
+void QOpcUaExtensionObjectDecoderRegistry::registerDecoder(const QString &encodingId, const Decoder &decoder)
+{
+    if (!decoder)
+        return;
+
+    auto registry = decoderRegistry();
+    QWriteLocker locker(&registry->lock);
+    registry->decoders.insert(encodingId, QSharedPointer<const Decoder>(new Decoder(decoder)));
+    registry->count.storeRelease(registry->decoders.size());
+}
+
+/*!
+    Removes the decoder for \a encodingId.
+
+    Returns \c true if a decoder has been removed.
+*/
+bool QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(const QString &encodingId)
+{
+    auto registry = decoderRegistry();
+    QWriteLocker locker(&registry->lock);
+    const bool removed = registry->decoders.remove(encodingId) > 0;
+    registry->count.storeRelease(registry->decoders.size());
+    return removed;
+}
+
+/*!
+    Returns \c true if a decoder is registered for \a encodingId.
+*/
+bool QOpcUaExtensionObjectDecoderRegistry::hasDecoder(const QString &encodingId)
+{
+    auto registry = decoderRegistry();
+    QReadLocker locker(&registry->lock);
+    return registry->decoders.contains(encodingId);
+}
+
+/*!
+    Returns \c true if no decoder is registered.
+*/
+bool QOpcUaExtensionObjectDecoderRegistry::isEmpty()
+{
+    return decoderRegistry()->count.loadAcquire() == 0;
+}
+
+/*!
+    Decodes \a body using the decoder registered for \a encodingId.
+
+    If \a success is not \c nullptr, it is set to \c true if a decoder is registered and the decoding was successful.
+*/
+QVariant QOpcUaExtensionObjectDecoderRegistry::decode(const QString &encodingId, const QByteArray &body, bool *success)
+{
+    if (success)
+        *success = false;
+
+    QSharedPointer<const Decoder> decoder;
+    {
+        auto registry = decoderRegistry();
+        QReadLocker locker(&registry->lock);
+        decoder = registry->decoders.value(encodingId);
+    }
+
+    // The decoder is called without holding the lock, it may register further decoders
+    if (!decoder)
+        return QVariant();
+
+    QByteArray buffer = body;
+    QOpcUaBinaryDataEncoding encoding(&buffer);
+    bool result = false;
+    const QVariant value = (*decoder)(encoding, result);
+
+    if (!result) {
+        qCWarning(QT_OPCUA) << "Failed to decode extension object with encoding id" << encodingId;
+        return QVariant();
+    }
+
+    if (success)
+        *success = true;
+    return value;
+}
+
+QT_END_NAMESPACE
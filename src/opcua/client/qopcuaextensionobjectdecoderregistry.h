@@ -0,0 +1,70 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAEXTENSIONOBJECTDECODERREGISTRY_H
+#define QOPCUAEXTENSIONOBJECTDECODERREGISTRY_H
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+
+#include <QtCore/qvariant.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaExtensionObjectDecoderRegistry
+{
+public:
+    using Decoder = std::function<QVariant(QOpcUaBinaryDataEncoding &decoder, bool &success)>;
+
+    static void registerDecoder(const QString &encodingId, const Decoder &decoder);
+    template <typename T>
+    static void registerType(const QString &encodingId)
+    {
+        registerDecoder(encodingId, [](QOpcUaBinaryDataEncoding &decoder, bool &success) {
+            return QVariant::fromValue(decoder.decode<T>(success));
+        });
+    }
+    static bool unregisterDecoder(const QString &encodingId);
+    static bool hasDecoder(const QString &encodingId);
+    static bool isEmpty();
+
+    static QVariant decode(const QString &encodingId, const QByteArray &body, bool *success = nullptr);
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAEXTENSIONOBJECTDECODERREGISTRY_H
@@ -859,7 +859,7 @@ void QOpcUaGdsClientPrivate::resolveDirectoryNode()
     }
 
     delete m_directoryNode;
-    m_directoryNode = m_client->node(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder)); // ns=0;i=85
+    m_directoryNode = m_client->node(QOpcUa::NodeIds::Namespace0::ObjectsFolder); // ns=0;i=85
     if (!m_directoryNode) {
         qCWarning(QT_OPCUA_GDSCLIENT) << "Root node not found";
         setError(QOpcUaGdsClient::Error::DirectoryNodeNotFound);
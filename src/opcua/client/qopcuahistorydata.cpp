@@ -0,0 +1,162 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuahistorydata.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaHistoryData
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief This class stores a chunk of historical values of a node.
+
+    A history read operation returns the historical values of a node in one or more chunks
+    which are delivered by the \l QOpcUaClient::historyDataAvailable() signal as they arrive from the server.
+    Each object of this class contains the values of one node from one chunk.
+
+    \sa QOpcUaClient::readHistoryData() QOpcUaHistoryReadItem QOpcUaDataValue
+*/
+
+class QOpcUaHistoryDataData : public QSharedData
+{
+public:
+    QString nodeId;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QVector<QOpcUaDataValue> result;
+};
+
+QOpcUaHistoryData::QOpcUaHistoryData()
+    : data(new QOpcUaHistoryDataData)
+{
+}
+
+/*!
+    Constructs history data from \a other.
+*/
+QOpcUaHistoryData::QOpcUaHistoryData(const QOpcUaHistoryData &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs empty history data for the node \a nodeId.
+*/
+QOpcUaHistoryData::QOpcUaHistoryData(const QString &nodeId)
+    : data(new QOpcUaHistoryDataData)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Sets the values from \a rhs in this history data.
+*/
+QOpcUaHistoryData &QOpcUaHistoryData::operator=(const QOpcUaHistoryData &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaHistoryData::~QOpcUaHistoryData()
+{
+}
+
+/*!
+    Returns the node id of the node the values belong to.
+*/
+QString QOpcUaHistoryData::nodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaHistoryData::setNodeId(const QString &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the status code of the history read for this node.
+*/
+QOpcUa::UaStatusCode QOpcUaHistoryData::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaHistoryData::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the values of this chunk.
+*/
+QVector<QOpcUaDataValue> QOpcUaHistoryData::result() const
+{
+    return data->result;
+}
+
+/*!
+    Returns a reference to the values of this chunk.
+*/
+QVector<QOpcUaDataValue> &QOpcUaHistoryData::resultRef()
+{
+    return data->result;
+}
+
+/*!
+    Sets the values of this chunk to \a result.
+*/
+void QOpcUaHistoryData::setResult(const QVector<QOpcUaDataValue> &result)
+{
+    data->result = result;
+}
+
+/*!
+    Returns the number of values in this chunk.
+*/
+int QOpcUaHistoryData::count() const
+{
+    return data->result.size();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuahistoryreaditem.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaHistoryReadItem
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief This class stores the node id and index range of a history read operation.
+
+    One or multiple objects of this class make up the request of a \l QOpcUaClient::readHistoryData()
+    or \l QOpcUaClient::readHistoryProcessed() operation.
+    For processed reads, the aggregate which is calculated by the server for the node must be set using
+    \l setAggregateType().
+
+    \sa QOpcUaClient::readHistoryData() QOpcUaClient::readHistoryProcessed() QOpcUaHistoryData
+*/
+
+class QOpcUaHistoryReadItemData : public QSharedData
+{
+public:
+    QString nodeId;
+    QString indexRange;
+    QString aggregateType;
+};
+
+QOpcUaHistoryReadItem::QOpcUaHistoryReadItem()
+    : data(new QOpcUaHistoryReadItemData)
+{
+}
+
+/*!
+    Constructs a history read item from \a other.
+*/
+QOpcUaHistoryReadItem::QOpcUaHistoryReadItem(const QOpcUaHistoryReadItem &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs a history read item for the index range \a indexRange of the value history of node \a nodeId.
+*/
+QOpcUaHistoryReadItem::QOpcUaHistoryReadItem(const QString &nodeId, const QString &indexRange)
+    : data(new QOpcUaHistoryReadItemData)
+{
+    setNodeId(nodeId);
+    setIndexRange(indexRange);
+}
+
+/*!
+    Sets the values from \a rhs in this history read item.
+*/
+QOpcUaHistoryReadItem &QOpcUaHistoryReadItem::operator=(const QOpcUaHistoryReadItem &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaHistoryReadItem::~QOpcUaHistoryReadItem()
+{
+}
+
+/*!
+    Returns the node id.
+*/
+QString QOpcUaHistoryReadItem::nodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaHistoryReadItem::setNodeId(const QString &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the index range.
+*/
+QString QOpcUaHistoryReadItem::indexRange() const
+{
+    return data->indexRange;
+}
+
+/*!
+    Sets the index range to \a indexRange.
+*/
+void QOpcUaHistoryReadItem::setIndexRange(const QString &indexRange)
+{
+    data->indexRange = indexRange;
+}
+
+/*!
+    Returns the node id of the aggregate function used for processed history reads.
+*/
+QString QOpcUaHistoryReadItem::aggregateType() const
+{
+    return data->aggregateType;
+}
+
+/*!
+    Sets the node id of the aggregate function used for processed history reads to \a aggregateType.
+
+    The standard aggregate functions are located in namespace 0, for example
+    \c {QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average)}.
+    This value is ignored for raw and modified history reads.
+*/
+void QOpcUaHistoryReadItem::setAggregateType(const QString &aggregateType)
+{
+    data->aggregateType = aggregateType;
+}
+
+QT_END_NAMESPACE
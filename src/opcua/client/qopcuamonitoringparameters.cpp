@@ -135,6 +135,14 @@ QT_BEGIN_NAMESPACE
     \li MaxNotificationsPerPublish
     \li X
     \li X
+    \row
+    \li TriggeredItemIds
+    \li X
+    \li X
+    \row
+    \li ClientSideFilter
+    \li X
+    \li X
     \endtable
 */
 
@@ -253,6 +261,31 @@ void QOpcUaMonitoringParameters::setIndexRange(const QString &indexRange)
     d_ptr->indexRange = indexRange;
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the ids of the monitored items which are linked to this monitored item
+    by \l QOpcUaNode::setTriggering().
+
+    Only links that have been successfully added by the node this monitored item belongs to are contained.
+*/
+QVector<quint32> QOpcUaMonitoringParameters::triggeredItemIds() const
+{
+    return d_ptr->triggeredItemIds;
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Sets the ids of the triggered monitored items to \a triggeredItemIds.
+
+    Setting this value as a client has no effect, links are created using \l QOpcUaNode::setTriggering().
+*/
+void QOpcUaMonitoringParameters::setTriggeredItemIds(const QVector<quint32> &triggeredItemIds)
+{
+    d_ptr->triggeredItemIds = triggeredItemIds;
+}
+
 /*!
     Returns the status code of the monitored item creation.
 */
@@ -498,6 +531,46 @@ void QOpcUaMonitoringParameters::clearFilter()
     d_ptr->filter.clear();
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the current client-side filter.
+    \sa setClientSideFilter()
+*/
+QVariant QOpcUaMonitoringParameters::clientSideFilter() const
+{
+    return d_ptr->clientSideFilter;
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Sets \l ClientSideFilter \a clientSideFilter as client-side filter for the monitored item.
+
+    The client-side filter is evaluated in the backend thread for every data change received
+    from the server before it is passed to the thread of the client. It is useful for servers
+    which do not support a \l DataChangeFilter with deadband. The filter is not sent to the server
+    and is ignored for event monitoring.
+
+    \sa clientSideFilter() clearClientSideFilter()
+*/
+void QOpcUaMonitoringParameters::setClientSideFilter(const QOpcUaMonitoringParameters::ClientSideFilter &clientSideFilter)
+{
+    d_ptr->clientSideFilter = QVariant::fromValue(clientSideFilter);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Removes the current client-side filter from the monitoring parameters.
+
+    \sa clientSideFilter() setClientSideFilter()
+*/
+void QOpcUaMonitoringParameters::clearClientSideFilter()
+{
+    d_ptr->clientSideFilter.clear();
+}
+
 /*!
     Returns the filter result.
 
@@ -704,6 +777,202 @@ QOpcUaMonitoringParameters::DataChangeFilter::operator QVariant() const
     return QVariant::fromValue(*this);
 }
 
+/*!
+    \class QOpcUaMonitoringParameters::ClientSideFilter
+    \inmodule QtOpcUa
+    \inheaderfile QOpcUaMonitoringParameters
+    \since QtOpcUa 5.15
+    \brief Defines a filter for data changes which is evaluated by the client.
+
+    This class mirrors \l DataChangeFilter, but the filter is applied by Qt OPC UA to the data changes
+    received from the server instead of being sent to the server. The filter is evaluated in the backend
+    thread, so data changes which are dropped never reach the thread of the client.
+
+    Numeric scalars and arrays of numeric values are compared elementwise against the last reported value.
+    For \l {QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType} {Percent}, the deadband is relative
+    to the EURange which must be set using \l setEuRange(). If no valid EURange is set, every change of the value
+    is reported. Values of other types are reported if they differ from the last reported value.
+
+    If a minimum reporting interval is set, a change which occurs less than the interval after the
+    previous report is held back and reported when the interval has elapsed. A newer change replaces
+    the held back value.
+
+    \code
+    QOpcUaMonitoringParameters::ClientSideFilter filter(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::StatusOrValue,
+                                                        QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute, 0.5, 1000);
+    QOpcUaMonitoringParameters p(100);
+    p.setClientSideFilter(filter);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    \endcode
+*/
+
+class QOpcUaMonitoringParameters::ClientSideFilterData : public QSharedData
+{
+public:
+    ClientSideFilterData()
+        : trigger(DataChangeFilter::DataChangeTrigger::StatusOrValue)
+        , deadbandType(DataChangeFilter::DeadbandType::None)
+        , deadbandValue(0)
+        , minimumReportingInterval(0)
+    {}
+
+    DataChangeFilter::DataChangeTrigger trigger;
+    DataChangeFilter::DeadbandType deadbandType;
+    double deadbandValue;
+    QOpcUaRange euRange;
+    double minimumReportingInterval;
+};
+
+/*!
+    Constructs a client-side filter with trigger on \c {status or value}, deadband type \c none,
+    deadband value \c 0 and no minimum reporting interval.
+*/
+QOpcUaMonitoringParameters::ClientSideFilter::ClientSideFilter()
+    : data(new QOpcUaMonitoringParameters::ClientSideFilterData)
+{
+}
+
+/*!
+    Constructs a client-side filter from \a rhs.
+*/
+QOpcUaMonitoringParameters::ClientSideFilter::ClientSideFilter(const ClientSideFilter &rhs)
+    : data(rhs.data)
+{
+}
+
+/*!
+    Constructs a client-side filter with trigger \a trigger, deadband type \a deadbandType, deadband value \a deadbandValue
+    and minimum reporting interval \a minimumReportingInterval.
+*/
+QOpcUaMonitoringParameters::ClientSideFilter::ClientSideFilter(DataChangeFilter::DataChangeTrigger trigger,
+                                                               DataChangeFilter::DeadbandType deadbandType,
+                                                               double deadbandValue, double minimumReportingInterval)
+    : data(new QOpcUaMonitoringParameters::ClientSideFilterData)
+{
+    data->trigger = trigger;
+    data->deadbandType = deadbandType;
+    data->deadbandValue = deadbandValue;
+    data->minimumReportingInterval = minimumReportingInterval;
+}
+
+/*!
+    Sets the values from \a rhs in this client-side filter.
+*/
+QOpcUaMonitoringParameters::ClientSideFilter &QOpcUaMonitoringParameters::ClientSideFilter::operator=(const ClientSideFilter &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+/*!
+    Returns \c true if this client-side filter has the same value as \a rhs.
+*/
+bool QOpcUaMonitoringParameters::ClientSideFilter::operator==(const QOpcUaMonitoringParameters::ClientSideFilter &rhs) const
+{
+    return data->trigger == rhs.trigger() &&
+            data->deadbandType == rhs.deadbandType() &&
+            data->deadbandValue == rhs.deadbandValue() &&
+            data->euRange == rhs.euRange() &&
+            data->minimumReportingInterval == rhs.minimumReportingInterval();
+}
+
+QOpcUaMonitoringParameters::ClientSideFilter::~ClientSideFilter()
+{
+}
+
+/*!
+    Returns the trigger.
+*/
+QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger QOpcUaMonitoringParameters::ClientSideFilter::trigger() const
+{
+    return data->trigger;
+}
+
+/*!
+    Sets the trigger to \a trigger.
+*/
+void QOpcUaMonitoringParameters::ClientSideFilter::setTrigger(DataChangeFilter::DataChangeTrigger trigger)
+{
+    data->trigger = trigger;
+}
+
+/*!
+    Returns the deadband type.
+*/
+QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType QOpcUaMonitoringParameters::ClientSideFilter::deadbandType() const
+{
+    return data->deadbandType;
+}
+
+/*!
+    Sets the deadband type to \a deadbandType.
+*/
+void QOpcUaMonitoringParameters::ClientSideFilter::setDeadbandType(DataChangeFilter::DeadbandType deadbandType)
+{
+    data->deadbandType = deadbandType;
+}
+
+/*!
+    Returns the deadband value.
+*/
+double QOpcUaMonitoringParameters::ClientSideFilter::deadbandValue() const
+{
+    return data->deadbandValue;
+}
+
+/*!
+    Sets the deadband value to \a deadbandValue.
+*/
+void QOpcUaMonitoringParameters::ClientSideFilter::setDeadbandValue(double deadbandValue)
+{
+    data->deadbandValue = deadbandValue;
+}
+
+/*!
+    Returns the EURange used for a percent deadband.
+*/
+QOpcUaRange QOpcUaMonitoringParameters::ClientSideFilter::euRange() const
+{
+    return data->euRange;
+}
+
+/*!
+    Sets the EURange used for a percent deadband to \a euRange.
+
+    The value of the EURange property of an AnalogItem can be read using \l QOpcUaNode::readValueAttribute()
+    on the property node.
+*/
+void QOpcUaMonitoringParameters::ClientSideFilter::setEuRange(const QOpcUaRange &euRange)
+{
+    data->euRange = euRange;
+}
+
+/*!
+    Returns the minimum interval between two reports in milliseconds.
+*/
+double QOpcUaMonitoringParameters::ClientSideFilter::minimumReportingInterval() const
+{
+    return data->minimumReportingInterval;
+}
+
+/*!
+    Sets the minimum interval between two reports to \a minimumReportingInterval milliseconds.
+    A value of \c 0 disables the limit.
+*/
+void QOpcUaMonitoringParameters::ClientSideFilter::setMinimumReportingInterval(double minimumReportingInterval)
+{
+    data->minimumReportingInterval = minimumReportingInterval;
+}
+
+/*!
+    Converts this client-side filter to \l QVariant.
+*/
+QOpcUaMonitoringParameters::ClientSideFilter::operator QVariant() const
+{
+    return QVariant::fromValue(*this);
+}
+
 /*!
     \class QOpcUaMonitoringParameters::EventFilter
     \inmodule QtOpcUa
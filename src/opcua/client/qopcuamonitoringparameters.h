@@ -38,6 +38,7 @@
 #define QOPCUAMONITORINGPARAMETERS_H
 
 #include <QtOpcUa/qopcuacontentfilterelement.h>
+#include <QtOpcUa/qopcuarange.h>
 #include <QtOpcUa/qopcuasimpleattributeoperand.h>
 
 #include <QtCore/qshareddata.h>
@@ -119,6 +120,38 @@ public:
         QSharedDataPointer<DataChangeFilterData> data;
     };
 
+    class ClientSideFilterData;
+    class Q_OPCUA_EXPORT ClientSideFilter
+    {
+    public:
+        ClientSideFilter();
+        ClientSideFilter(const ClientSideFilter &);
+        ClientSideFilter(DataChangeFilter::DataChangeTrigger trigger, DataChangeFilter::DeadbandType deadbandType,
+                         double deadbandValue, double minimumReportingInterval = 0);
+        ClientSideFilter &operator=(const ClientSideFilter &);
+        bool operator==(const ClientSideFilter &rhs) const;
+        operator QVariant() const;
+        ~ClientSideFilter();
+
+        DataChangeFilter::DataChangeTrigger trigger() const;
+        void setTrigger(DataChangeFilter::DataChangeTrigger trigger);
+
+        DataChangeFilter::DeadbandType deadbandType() const;
+        void setDeadbandType(DataChangeFilter::DeadbandType deadbandType);
+
+        double deadbandValue() const;
+        void setDeadbandValue(double deadbandValue);
+
+        QOpcUaRange euRange() const;
+        void setEuRange(const QOpcUaRange &euRange);
+
+        double minimumReportingInterval() const;
+        void setMinimumReportingInterval(double minimumReportingInterval);
+
+    private:
+        QSharedDataPointer<ClientSideFilterData> data;
+    };
+
     class EventFilterData;
     class Q_OPCUA_EXPORT EventFilter
     {
@@ -156,6 +189,9 @@ public:
     void setFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter);
     void setFilter(const QOpcUaMonitoringParameters::EventFilter &eventFilter);
     void clearFilter();
+    QVariant clientSideFilter() const;
+    void setClientSideFilter(const QOpcUaMonitoringParameters::ClientSideFilter &clientSideFilter);
+    void clearClientSideFilter();
     QVariant filterResult() const;
     void setFilterResult(const QOpcUaEventFilterResult &eventFilterResult);
     void clearFilterResult();
@@ -187,6 +223,8 @@ public:
     void setSubscriptionType(SubscriptionType subscriptionType);
     QString indexRange() const;
     void setIndexRange(const QString &indexRange);
+    QVector<quint32> triggeredItemIds() const;
+    void setTriggeredItemIds(const QVector<quint32> &triggeredItemIds);
 
 private:
     QSharedDataPointer<QOpcUaMonitoringParametersPrivate> d_ptr;
@@ -204,6 +242,7 @@ Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::SubscriptionType)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType)
+Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::ClientSideFilter)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::Parameter)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::Parameters)
 Q_DECLARE_METATYPE(QOpcUaMonitoringParameters::MonitoringMode)
@@ -51,6 +51,7 @@
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 
 #include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -83,6 +84,10 @@ public:
     bool discardOldest;
     QOpcUaMonitoringParameters::MonitoringMode monitoringMode;
     QString indexRange;
+    QVector<quint32> triggeredItemIds;
+
+    // Client side
+    QVariant clientSideFilter;
 
     // Subscription
     quint32 subscriptionId;
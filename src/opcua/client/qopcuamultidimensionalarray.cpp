@@ -35,6 +35,13 @@
 ****************************************************************************/
 
 #include "qopcuamultidimensionalarray.h"
+#include "qopcuamultidimensionalarrayview.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
 
 QT_BEGIN_NAMESPACE
 
@@ -52,6 +59,10 @@ QT_BEGIN_NAMESPACE
       Depending on the number of dimensions, there could be lots of nested QVariantLists
       which would require a huge effort when calculating the array dimensions for conversions
       between QVariantList and the sdk specific variant type.
+
+    Arrays of Boolean and numeric types can also be stored as one contiguous block of the native
+    type. This avoids one QVariant per element for large matrices and allows the backends to pass
+    the data they received from the server without converting each element.
 */
 
 /*!
@@ -62,18 +73,133 @@ QT_BEGIN_NAMESPACE
     This class manages arrays of Qt OPC UA types with associated array dimensions information.
     It is returned as value when a multidimensional array is received from the server. It can also
     be used as a write value or as parameter for filters and method calls.
+
+    Since QtOpcUa 5.15, arrays of the types Boolean, SByte, Byte, Int16, UInt16, Int32, UInt32,
+    Int64, UInt64, Float and Double can use typed storage. The elements are then stored in row-major
+    order as contiguous array of the corresponding C++ type which is accessible using \l constData()
+    and \l typedData(). Multidimensional arrays of these types received from the server use typed
+    storage. The value list is only created if \l valueArray() or \l valueArrayRef() is called.
+
+    \code
+    const QOpcUaMultiDimensionalArray matrix = node->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUaMultiDimensionalArray>();
+    if (matrix.isValid() && matrix.elementType() == QOpcUa::Types::Float) {
+        const float *values = matrix.typedData<float>();
+        ...
+    }
+    \endcode
+
+    \l view() returns a \l QOpcUaMultiDimensionalArrayView which allows slicing the array without
+    copying the elements.
+*/
+
+/*!
+    \typedef QOpcUaMultiDimensionalArray::CleanupFunction
+    \since QtOpcUa 5.15
+
+    A function with the signature \c {void cleanup(void *info)} which is called to release
+    external data passed to the constructor of a multidimensional array.
 */
 
 class QOpcUaMultiDimensionalArrayData : public QSharedData
 {
 public:
+    QOpcUaMultiDimensionalArrayData() = default;
+    QOpcUaMultiDimensionalArrayData(const QOpcUaMultiDimensionalArrayData &other);
+    ~QOpcUaMultiDimensionalArrayData();
+
+    bool allocateTypedStorage(QOpcUa::Types type, quint32 length);
+    void releaseTypedStorage();
+
     QVariantList value;
     QVector<quint32> arrayDimensions;
     quint32 expectedArrayLength{0};
+
+    // Contiguous storage for arrays of Boolean and numeric types
+    QOpcUa::Types elementType{QOpcUa::Types::Undefined};
+    void *typedData{nullptr};
+    quint32 typedLength{0};
+    QOpcUaMultiDimensionalArray::CleanupFunction cleanupFunction{nullptr};
+    void *cleanupInfo{nullptr};
 };
 
+static void freeTypedData(void *info)
+{
+    std::free(info);
+}
+
+QOpcUaMultiDimensionalArrayData::QOpcUaMultiDimensionalArrayData(const QOpcUaMultiDimensionalArrayData &other)
+    : QSharedData(other)
+    , value(other.value)
+    , arrayDimensions(other.arrayDimensions)
+    , expectedArrayLength(other.expectedArrayLength)
+{
+    // Detaching always creates an owned copy, even if the original uses external data
+    if (other.elementType != QOpcUa::Types::Undefined && allocateTypedStorage(other.elementType, other.typedLength)
+            && typedLength)
+        std::memcpy(typedData, other.typedData, typedLength * QOpcUaMultiDimensionalArray::elementSize(elementType));
+}
+
+QOpcUaMultiDimensionalArrayData::~QOpcUaMultiDimensionalArrayData()
+{
+    releaseTypedStorage();
+}
+
+bool QOpcUaMultiDimensionalArrayData::allocateTypedStorage(QOpcUa::Types type, quint32 length)
+{
+    releaseTypedStorage();
+
+    const size_t size = QOpcUaMultiDimensionalArray::elementSize(type);
+    if (!size || length > (std::numeric_limits<size_t>::max)() / size)
+        return false;
+
+    if (length) {
+        typedData = std::calloc(length, size);
+        Q_CHECK_PTR(typedData);
+        cleanupFunction = &freeTypedData;
+        cleanupInfo = typedData;
+    }
+
+    elementType = type;
+    typedLength = length;
+    return true;
+}
+
+void QOpcUaMultiDimensionalArrayData::releaseTypedStorage()
+{
+    if (cleanupFunction)
+        cleanupFunction(cleanupInfo);
+
+    elementType = QOpcUa::Types::Undefined;
+    typedData = nullptr;
+    typedLength = 0;
+    cleanupFunction = nullptr;
+    cleanupInfo = nullptr;
+}
+
+template <typename T>
+static QVariant typedElementToVariant(const void *data, quint32 index)
+{
+    return QVariant::fromValue(static_cast<const T *>(data)[index]);
+}
+
+template <typename T>
+static bool typedElementFromVariant(void *data, quint32 index, const QVariant &value)
+{
+    if (!value.canConvert<T>())
+        return false;
+    static_cast<T *>(data)[index] = value.value<T>();
+    return true;
+}
+
+template <typename T>
+static bool typedElementsEqual(const void *first, const void *second, quint32 length)
+{
+    return std::equal(static_cast<const T *>(first), static_cast<const T *>(first) + length,
+                      static_cast<const T *>(second));
+}
+
 QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray()
-    : data(new QOpcUaMultiDimensionalArrayData)
+    : d_ptr(new QOpcUaMultiDimensionalArrayData)
 {
 }
 
@@ -81,7 +207,7 @@ QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray()
     Constructs a multidimensional array from \a other.
 */
 QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(const QOpcUaMultiDimensionalArray &other)
-    : data(other.data)
+    : d_ptr(other.d_ptr)
 {
 }
 
@@ -91,7 +217,7 @@ QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(const QOpcUaMultiDimens
 QOpcUaMultiDimensionalArray &QOpcUaMultiDimensionalArray::operator=(const QOpcUaMultiDimensionalArray &rhs)
 {
     if (this != &rhs)
-        data.operator=(rhs.data);
+        d_ptr.operator=(rhs.d_ptr);
     return *this;
 }
 
@@ -99,7 +225,7 @@ QOpcUaMultiDimensionalArray &QOpcUaMultiDimensionalArray::operator=(const QOpcUa
     Constructs a multidimensional array with value \a value and array dimensions \a arrayDimensions.
 */
 QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(const QVariantList &value, const QVector<quint32> &arrayDimensions)
-    : data(new QOpcUaMultiDimensionalArrayData)
+    : d_ptr(new QOpcUaMultiDimensionalArrayData)
 {
     setValueArray(value);
     setArrayDimensions(arrayDimensions);
@@ -109,14 +235,72 @@ QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(const QVariantList &val
     Creates a multidimensional array with preallocated data fitting \a arrayDimensions.
 */
 QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(const QVector<quint32> &arrayDimensions)
-    : data(new QOpcUaMultiDimensionalArrayData)
+    : d_ptr(new QOpcUaMultiDimensionalArrayData)
+{
+    setArrayDimensions(arrayDimensions);
+    if (d_ptr->expectedArrayLength) {
+        d_ptr->value.reserve(d_ptr->expectedArrayLength);
+        for (size_t i = 0; i < d_ptr->expectedArrayLength; ++i)
+            d_ptr->value.append(QVariant());
+    }
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Creates a multidimensional array with typed storage for elements of type \a elementType
+    fitting \a arrayDimensions. All elements are initialized to zero.
+
+    If typed storage is not supported for \a elementType, the array is created with a
+    preallocated value list.
+
+    \sa isTypedStorageSupported()
+*/
+QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(QOpcUa::Types elementType, const QVector<quint32> &arrayDimensions)
+    : d_ptr(new QOpcUaMultiDimensionalArrayData)
 {
     setArrayDimensions(arrayDimensions);
-    if (data->expectedArrayLength) {
-        data->value.reserve(data->expectedArrayLength);
-        for (size_t i = 0; i < data->expectedArrayLength; ++i)
-            data->value.append(QVariant());
+    if (d_ptr->allocateTypedStorage(elementType, d_ptr->expectedArrayLength))
+        return;
+
+    d_ptr->value.reserve(d_ptr->expectedArrayLength);
+    for (size_t i = 0; i < d_ptr->expectedArrayLength; ++i)
+        d_ptr->value.append(QVariant());
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Creates a multidimensional array with typed storage which uses the existing \a data
+    of type \a elementType without copying it. \a data must contain the elements in row-major order
+    and its length must be the product of \a arrayDimensions.
+
+    If \a cleanupFunction is set, it is called with \a cleanupInfo when the last copy of the array
+    is destroyed. Otherwise, \a data must remain valid as long as the array or one of its copies exists.
+    Like for other implicitly shared classes, non-const access to a shared array creates a copy
+    of the elements first, non-const access to an unshared array modifies \a data in place.
+
+    If typed storage is not supported for \a elementType, \a cleanupFunction is called immediately
+    and an invalid array is created.
+
+    \sa isTypedStorageSupported()
+*/
+QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray(QOpcUa::Types elementType, void *data, const QVector<quint32> &arrayDimensions,
+                                                         CleanupFunction cleanupFunction, void *cleanupInfo)
+    : d_ptr(new QOpcUaMultiDimensionalArrayData)
+{
+    if (!isTypedStorageSupported(elementType)) {
+        if (cleanupFunction)
+            cleanupFunction(cleanupInfo);
+        return;
     }
+
+    setArrayDimensions(arrayDimensions);
+    d_ptr->elementType = elementType;
+    d_ptr->typedData = data;
+    d_ptr->typedLength = data ? d_ptr->expectedArrayLength : 0;
+    d_ptr->cleanupFunction = cleanupFunction;
+    d_ptr->cleanupInfo = cleanupInfo;
 }
 
 QOpcUaMultiDimensionalArray::~QOpcUaMultiDimensionalArray()
@@ -129,7 +313,7 @@ QOpcUaMultiDimensionalArray::~QOpcUaMultiDimensionalArray()
 */
 QVector<quint32> QOpcUaMultiDimensionalArray::arrayDimensions() const
 {
-    return data->arrayDimensions;
+    return d_ptr->arrayDimensions;
 }
 
 /*!
@@ -137,9 +321,115 @@ QVector<quint32> QOpcUaMultiDimensionalArray::arrayDimensions() const
 */
 void QOpcUaMultiDimensionalArray::setArrayDimensions(const QVector<quint32> &arrayDimensions)
 {
-    data->arrayDimensions = arrayDimensions;
-    data->expectedArrayLength = std::accumulate(data->arrayDimensions.begin(), data->arrayDimensions.end(),
-                                                1, std::multiplies<quint32>());
+    d_ptr->arrayDimensions = arrayDimensions;
+    d_ptr->expectedArrayLength = std::accumulate(d_ptr->arrayDimensions.begin(), d_ptr->arrayDimensions.end(),
+                                                 1, std::multiplies<quint32>());
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns \c true if the elements of this multidimensional array are stored as contiguous array
+    of their native type.
+
+    \sa elementType(), constData()
+*/
+bool QOpcUaMultiDimensionalArray::hasTypedStorage() const
+{
+    return d_ptr->elementType != QOpcUa::Types::Undefined;
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the element type of the typed storage or \l {QOpcUa::Types} {Undefined}
+    if the elements are stored in a value list.
+*/
+QOpcUa::Types QOpcUaMultiDimensionalArray::elementType() const
+{
+    return d_ptr->elementType;
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns a pointer to the typed storage or \c nullptr if the array has no typed storage.
+
+    \sa typedData(), elementType()
+*/
+const void *QOpcUaMultiDimensionalArray::constData() const
+{
+    return d_ptr->typedData;
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns a pointer to the typed storage which can be used to modify the elements
+    or \c nullptr if the array has no typed storage.
+*/
+void *QOpcUaMultiDimensionalArray::data()
+{
+    return d_ptr->typedData;
+}
+
+/*!
+    \fn template <typename T> const T *QOpcUaMultiDimensionalArray::typedData() const
+    \since QtOpcUa 5.15
+
+    Returns a pointer to the typed storage as array of \c T or \c nullptr if the array has
+    no typed storage. \c T must be the C++ type corresponding to \l elementType(),
+    for example \c float for \l {QOpcUa::Types} {Float}.
+*/
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns a view which covers the complete array.
+*/
+QOpcUaMultiDimensionalArrayView QOpcUaMultiDimensionalArray::view() const
+{
+    return QOpcUaMultiDimensionalArrayView(*this);
+}
+
+/*!
+    \since QtOpcUa 5.15
+
+    Returns \c true if typed storage is supported for \a elementType.
+*/
+bool QOpcUaMultiDimensionalArray::isTypedStorageSupported(QOpcUa::Types elementType)
+{
+    return elementSize(elementType) != 0;
+}
+
+size_t QOpcUaMultiDimensionalArray::elementSize(QOpcUa::Types elementType)
+{
+    switch (elementType) {
+    case QOpcUa::Types::Boolean:
+        return sizeof(bool);
+    case QOpcUa::Types::SByte:
+        return sizeof(qint8);
+    case QOpcUa::Types::Byte:
+        return sizeof(quint8);
+    case QOpcUa::Types::Int16:
+        return sizeof(qint16);
+    case QOpcUa::Types::UInt16:
+        return sizeof(quint16);
+    case QOpcUa::Types::Int32:
+        return sizeof(qint32);
+    case QOpcUa::Types::UInt32:
+        return sizeof(quint32);
+    case QOpcUa::Types::Int64:
+        return sizeof(qint64);
+    case QOpcUa::Types::UInt64:
+        return sizeof(quint64);
+    case QOpcUa::Types::Float:
+        return sizeof(float);
+    case QOpcUa::Types::Double:
+        return sizeof(double);
+    default:
+        return 0;
+    }
 }
 
 /*!
@@ -147,8 +437,44 @@ void QOpcUaMultiDimensionalArray::setArrayDimensions(const QVector<quint32> &arr
 */
 bool QOpcUaMultiDimensionalArray::operator==(const QOpcUaMultiDimensionalArray &other) const
 {
-    return arrayDimensions() == other.arrayDimensions() &&
-            valueArray() == other.valueArray();
+    if (arrayDimensions() != other.arrayDimensions())
+        return false;
+
+    if (!hasTypedStorage() || d_ptr->elementType != other.d_ptr->elementType)
+        return valueArray() == other.valueArray();
+
+    const quint32 length = d_ptr->typedLength;
+    if (length != other.d_ptr->typedLength)
+        return false;
+
+    const void *first = d_ptr->typedData;
+    const void *second = other.d_ptr->typedData;
+    switch (d_ptr->elementType) {
+    case QOpcUa::Types::Boolean:
+        return typedElementsEqual<bool>(first, second, length);
+    case QOpcUa::Types::SByte:
+        return typedElementsEqual<qint8>(first, second, length);
+    case QOpcUa::Types::Byte:
+        return typedElementsEqual<quint8>(first, second, length);
+    case QOpcUa::Types::Int16:
+        return typedElementsEqual<qint16>(first, second, length);
+    case QOpcUa::Types::UInt16:
+        return typedElementsEqual<quint16>(first, second, length);
+    case QOpcUa::Types::Int32:
+        return typedElementsEqual<qint32>(first, second, length);
+    case QOpcUa::Types::UInt32:
+        return typedElementsEqual<quint32>(first, second, length);
+    case QOpcUa::Types::Int64:
+        return typedElementsEqual<qint64>(first, second, length);
+    case QOpcUa::Types::UInt64:
+        return typedElementsEqual<quint64>(first, second, length);
+    case QOpcUa::Types::Float:
+        return typedElementsEqual<float>(first, second, length);
+    case QOpcUa::Types::Double:
+        return typedElementsEqual<double>(first, second, length);
+    default:
+        return false;
+    }
 }
 
 /*!
@@ -161,26 +487,83 @@ QOpcUaMultiDimensionalArray::operator QVariant() const
 
 /*!
     Returns the value array of the multidimensional array.
+
+    For arrays with typed storage, the list is created from the typed storage on each call.
 */
 QVariantList QOpcUaMultiDimensionalArray::valueArray() const
 {
-    return data->value;
+    if (!hasTypedStorage())
+        return d_ptr->value;
+
+    QVariantList result;
+    result.reserve(static_cast<int>(d_ptr->typedLength));
+    for (quint32 i = 0; i < d_ptr->typedLength; ++i)
+        result.append(storedValue(i));
+    return result;
 }
 
 /*!
     Returns a reference to the value array of the multidimensional array.
+
+    Arrays with typed storage are converted to a value list first.
 */
 QVariantList &QOpcUaMultiDimensionalArray::valueArrayRef()
 {
-    return data->value;
+    if (hasTypedStorage()) {
+        const QVariantList value = valueArray();
+        d_ptr->releaseTypedStorage();
+        d_ptr->value = value;
+    }
+    return d_ptr->value;
 }
 
 /*!
     Sets the value array of the multidimensional array to \a value.
+
+    This releases the typed storage of the array.
 */
 void QOpcUaMultiDimensionalArray::setValueArray(const QVariantList &value)
 {
-    data->value = value;
+    d_ptr->releaseTypedStorage();
+    d_ptr->value = value;
+}
+
+quint32 QOpcUaMultiDimensionalArray::storedLength() const
+{
+    return hasTypedStorage() ? d_ptr->typedLength : static_cast<quint32>(d_ptr->value.size());
+}
+
+QVariant QOpcUaMultiDimensionalArray::storedValue(quint32 index) const
+{
+    const void *data = d_ptr->typedData;
+    switch (d_ptr->elementType) {
+    case QOpcUa::Types::Undefined:
+        return d_ptr->value.at(static_cast<int>(index));
+    case QOpcUa::Types::Boolean:
+        return typedElementToVariant<bool>(data, index);
+    case QOpcUa::Types::SByte:
+        return typedElementToVariant<signed char>(data, index);
+    case QOpcUa::Types::Byte:
+        return typedElementToVariant<uchar>(data, index);
+    case QOpcUa::Types::Int16:
+        return typedElementToVariant<qint16>(data, index);
+    case QOpcUa::Types::UInt16:
+        return typedElementToVariant<quint16>(data, index);
+    case QOpcUa::Types::Int32:
+        return typedElementToVariant<qint32>(data, index);
+    case QOpcUa::Types::UInt32:
+        return typedElementToVariant<quint32>(data, index);
+    case QOpcUa::Types::Int64:
+        return typedElementToVariant<qint64>(data, index);
+    case QOpcUa::Types::UInt64:
+        return typedElementToVariant<quint64>(data, index);
+    case QOpcUa::Types::Float:
+        return typedElementToVariant<float>(data, index);
+    case QOpcUa::Types::Double:
+        return typedElementToVariant<double>(data, index);
+    default:
+        return QVariant();
+    }
 }
 
 /*!
@@ -191,26 +574,26 @@ void QOpcUaMultiDimensionalArray::setValueArray(const QVariantList &value)
 int QOpcUaMultiDimensionalArray::arrayIndex(const QVector<quint32> &indices) const
 {
     // A QList can store INT_MAX values. Depending on the platform, this allows a size > UINT32_MAX
-    if (data->expectedArrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()) ||
-            static_cast<quint64>(data->value.size()) > (std::numeric_limits<quint32>::max)())
+    if (d_ptr->expectedArrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()) ||
+            (!hasTypedStorage() && static_cast<quint64>(d_ptr->value.size()) > (std::numeric_limits<quint32>::max)()))
         return -1;
 
     // Check number of dimensions and data size
-    if (indices.size() != data->arrayDimensions.size() ||
-            data->expectedArrayLength != static_cast<quint32>(data->value.size()))
+    if (indices.size() != d_ptr->arrayDimensions.size() ||
+            d_ptr->expectedArrayLength != storedLength())
         return -1; // Missing array dimensions or array dimensions don't fit the array
 
     quint32 index = 0;
     quint32 stride = 1;
     // Reverse iteration to avoid repetitions while calculating the stride
-    for (int i = data->arrayDimensions.size() - 1; i >= 0; --i) {
-        if (indices.at(i) >= data->arrayDimensions.at(i)) // Out of bounds
+    for (int i = d_ptr->arrayDimensions.size() - 1; i >= 0; --i) {
+        if (indices.at(i) >= d_ptr->arrayDimensions.at(i)) // Out of bounds
             return -1;
 
         // Arrays are encoded in row-major order: [0,0,0], [0,0,1], [0,1,0], [0,1,1], [1,0,0], [1,0,1], [1,1,0], [1,1,1]
         // The stride for dimension i in a n dimensional array is the product of all array dimensions from i+1 to n
-        if (i < data->arrayDimensions.size() - 1)
-            stride *= data->arrayDimensions.at(i + 1);
+        if (i < d_ptr->arrayDimensions.size() - 1)
+            stride *= d_ptr->arrayDimensions.at(i + 1);
         index += stride * indices.at(i);
     }
 
@@ -229,12 +612,14 @@ QVariant QOpcUaMultiDimensionalArray::value(const QVector<quint32> &indices) con
     if (index < 0)
         return QVariant();
 
-    return data->value.at(index);
+    return storedValue(static_cast<quint32>(index));
 }
 
 /*!
     Sets the value at position \a indices to \a value.
     Returns \c true if the value has been successfully set.
+
+    For arrays with typed storage, \a value must be convertible to the element type.
 */
 bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, const QVariant &value)
 {
@@ -243,8 +628,37 @@ bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, cons
     if (index < 0)
         return false;
 
-    data->value[index] = value;
-    return true;
+    void *data = d_ptr->typedData;
+    const quint32 i = static_cast<quint32>(index);
+    switch (d_ptr->elementType) {
+    case QOpcUa::Types::Undefined:
+        d_ptr->value[index] = value;
+        return true;
+    case QOpcUa::Types::Boolean:
+        return typedElementFromVariant<bool>(data, i, value);
+    case QOpcUa::Types::SByte:
+        return typedElementFromVariant<signed char>(data, i, value);
+    case QOpcUa::Types::Byte:
+        return typedElementFromVariant<uchar>(data, i, value);
+    case QOpcUa::Types::Int16:
+        return typedElementFromVariant<qint16>(data, i, value);
+    case QOpcUa::Types::UInt16:
+        return typedElementFromVariant<quint16>(data, i, value);
+    case QOpcUa::Types::Int32:
+        return typedElementFromVariant<qint32>(data, i, value);
+    case QOpcUa::Types::UInt32:
+        return typedElementFromVariant<quint32>(data, i, value);
+    case QOpcUa::Types::Int64:
+        return typedElementFromVariant<qint64>(data, i, value);
+    case QOpcUa::Types::UInt64:
+        return typedElementFromVariant<quint64>(data, i, value);
+    case QOpcUa::Types::Float:
+        return typedElementFromVariant<float>(data, i, value);
+    case QOpcUa::Types::Double:
+        return typedElementFromVariant<double>(data, i, value);
+    default:
+        return false;
+    }
 }
 
 /*!
@@ -252,9 +666,9 @@ bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, cons
 */
 bool QOpcUaMultiDimensionalArray::isValid() const
 {
-    return static_cast<quint64>(data->value.size()) == data->expectedArrayLength &&
-            static_cast<quint64>(data->value.size()) <= (std::numeric_limits<quint32>::max)() &&
-            static_cast<quint64>(data->arrayDimensions.size()) <= (std::numeric_limits<quint32>::max)();
+    return static_cast<quint64>(storedLength()) == d_ptr->expectedArrayLength &&
+            (hasTypedStorage() || static_cast<quint64>(d_ptr->value.size()) <= (std::numeric_limits<quint32>::max)()) &&
+            static_cast<quint64>(d_ptr->arrayDimensions.size()) <= (std::numeric_limits<quint32>::max)();
 }
 
 QT_END_NAMESPACE
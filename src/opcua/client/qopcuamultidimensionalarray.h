@@ -38,21 +38,29 @@
 #define QOPCUAMULTIDIMENSIONALARRAY_H
 
 #include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qshareddata.h>
 #include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
+class QOpcUaMultiDimensionalArrayView;
+
 class QOpcUaMultiDimensionalArrayData;
 class Q_OPCUA_EXPORT QOpcUaMultiDimensionalArray
 {
 public:
+    typedef void (*CleanupFunction)(void *info);
+
     QOpcUaMultiDimensionalArray();
     QOpcUaMultiDimensionalArray(const QOpcUaMultiDimensionalArray &other);
     QOpcUaMultiDimensionalArray &operator=(const QOpcUaMultiDimensionalArray &rhs);
     QOpcUaMultiDimensionalArray(const QVariantList &valueArray, const QVector<quint32> &arrayDimensions);
     QOpcUaMultiDimensionalArray(const QVector<quint32> &arrayDimensions);
+    QOpcUaMultiDimensionalArray(QOpcUa::Types elementType, const QVector<quint32> &arrayDimensions);
+    QOpcUaMultiDimensionalArray(QOpcUa::Types elementType, void *data, const QVector<quint32> &arrayDimensions,
+                                CleanupFunction cleanupFunction = nullptr, void *cleanupInfo = nullptr);
     ~QOpcUaMultiDimensionalArray();
 
     QVariantList valueArray() const;
@@ -68,12 +76,30 @@ public:
     QVector<quint32> arrayDimensions() const;
     void setArrayDimensions(const QVector<quint32> &arrayDimensions);
 
+    bool hasTypedStorage() const;
+    QOpcUa::Types elementType() const;
+    const void *constData() const;
+    void *data();
+
+    template <typename T>
+    const T *typedData() const { return static_cast<const T *>(constData()); }
+
+    QOpcUaMultiDimensionalArrayView view() const;
+
+    static bool isTypedStorageSupported(QOpcUa::Types elementType);
+
     bool operator==(const QOpcUaMultiDimensionalArray &other) const;
 
     operator QVariant() const;
 
 private:
-    QSharedDataPointer<QOpcUaMultiDimensionalArrayData> data;
+    friend class QOpcUaMultiDimensionalArrayData;
+    friend class QOpcUaMultiDimensionalArrayView;
+    static size_t elementSize(QOpcUa::Types elementType);
+    quint32 storedLength() const;
+    QVariant storedValue(quint32 index) const;
+
+    QSharedDataPointer<QOpcUaMultiDimensionalArrayData> d_ptr;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,369 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuamultidimensionalarrayview.h"
+
+#include <cstring>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaMultiDimensionalArrayView
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief A strided view on the elements of a multidimensional array.
+
+    A view addresses a part of a \l QOpcUaMultiDimensionalArray using an offset and a stride
+    for each dimension. Creating views with \l slice() and \l subArray() never copies the elements
+    of the array. The view keeps a shallow copy of the array, so the elements remain valid as long
+    as the view exists.
+
+    \code
+    // A 512x512 matrix of Float values
+    const QOpcUaMultiDimensionalArrayView image = matrix.view();
+    // Row 10
+    const QOpcUaMultiDimensionalArrayView row = image.slice(0, 10);
+    // Every second element of the upper left 64x64 block
+    const QOpcUaMultiDimensionalArrayView block = image.subArray({0, 0}, {32, 32}, {2, 2});
+    const float value = block.typedValue<float>({1, 1}); // Element [2, 2] of the matrix
+    \endcode
+
+    \l toArray() copies the elements addressed by the view into a new contiguous array.
+*/
+
+class QOpcUaMultiDimensionalArrayViewData : public QSharedData
+{
+public:
+    QOpcUaMultiDimensionalArray array;
+    QVector<quint32> arrayDimensions;
+    QVector<quint32> strides;
+    quint32 offset{0};
+    bool valid{false};
+};
+
+/*!
+    Constructs an invalid view.
+*/
+QOpcUaMultiDimensionalArrayView::QOpcUaMultiDimensionalArrayView()
+    : data(new QOpcUaMultiDimensionalArrayViewData)
+{
+}
+
+/*!
+    Constructs a view which covers all elements of \a array.
+    The view is invalid if \a array is not valid.
+*/
+QOpcUaMultiDimensionalArrayView::QOpcUaMultiDimensionalArrayView(const QOpcUaMultiDimensionalArray &array)
+    : data(new QOpcUaMultiDimensionalArrayViewData)
+{
+    if (!array.isValid() || array.arrayDimensions().isEmpty() ||
+            array.storedLength() > static_cast<quint32>((std::numeric_limits<int>::max)()))
+        return;
+
+    data->array = array;
+    data->arrayDimensions = array.arrayDimensions();
+    data->strides.resize(data->arrayDimensions.size());
+
+    // Row-major order, the last dimension is contiguous
+    quint32 stride = 1;
+    for (int i = data->arrayDimensions.size() - 1; i >= 0; --i) {
+        data->strides[i] = stride;
+        stride *= data->arrayDimensions.at(i);
+    }
+
+    data->valid = true;
+}
+
+/*!
+    Constructs a view from \a other.
+*/
+QOpcUaMultiDimensionalArrayView::QOpcUaMultiDimensionalArrayView(const QOpcUaMultiDimensionalArrayView &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this view.
+*/
+QOpcUaMultiDimensionalArrayView &QOpcUaMultiDimensionalArrayView::operator=(const QOpcUaMultiDimensionalArrayView &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaMultiDimensionalArrayView::~QOpcUaMultiDimensionalArrayView()
+{
+}
+
+/*!
+    Returns \c true if this view addresses valid elements of a valid array.
+*/
+bool QOpcUaMultiDimensionalArrayView::isValid() const
+{
+    return data->valid;
+}
+
+/*!
+    Returns the array this view refers to.
+*/
+QOpcUaMultiDimensionalArray QOpcUaMultiDimensionalArrayView::array() const
+{
+    return data->array;
+}
+
+/*!
+    Returns the dimensions of this view.
+*/
+QVector<quint32> QOpcUaMultiDimensionalArrayView::arrayDimensions() const
+{
+    return data->arrayDimensions;
+}
+
+/*!
+    Returns the distance in elements of the array between two consecutive elements
+    of each dimension of this view.
+*/
+QVector<quint32> QOpcUaMultiDimensionalArrayView::strides() const
+{
+    return data->strides;
+}
+
+/*!
+    Returns the index of the first element of this view in the array.
+*/
+quint32 QOpcUaMultiDimensionalArrayView::offset() const
+{
+    return data->offset;
+}
+
+/*!
+    Returns the number of elements addressed by this view.
+*/
+quint32 QOpcUaMultiDimensionalArrayView::size() const
+{
+    if (!data->valid)
+        return 0;
+
+    quint32 result = 1;
+    for (const quint32 dimension : qAsConst(data->arrayDimensions))
+        result *= dimension;
+    return result;
+}
+
+/*!
+    Returns \c true if the elements addressed by this view are stored
+    in one contiguous block of the array in row-major order.
+*/
+bool QOpcUaMultiDimensionalArrayView::isContiguous() const
+{
+    if (!data->valid)
+        return false;
+
+    quint32 stride = 1;
+    for (int i = data->arrayDimensions.size() - 1; i >= 0; --i) {
+        if (data->arrayDimensions.at(i) > 1 && data->strides.at(i) != stride)
+            return false;
+        stride *= data->arrayDimensions.at(i);
+    }
+    return true;
+}
+
+/*!
+    Returns the index in the array of the element identified by \a indices relative to this view.
+    If \a indices is invalid for this view, the invalid index \c -1 is returned.
+*/
+int QOpcUaMultiDimensionalArrayView::arrayIndex(const QVector<quint32> &indices) const
+{
+    if (!data->valid || indices.size() != data->arrayDimensions.size())
+        return -1;
+
+    quint32 index = data->offset;
+    for (int i = 0; i < indices.size(); ++i) {
+        if (indices.at(i) >= data->arrayDimensions.at(i))
+            return -1;
+        index += indices.at(i) * data->strides.at(i);
+    }
+
+    return static_cast<int>(index);
+}
+
+/*!
+    Returns the value of the element identified by \a indices relative to this view.
+    If the indices are invalid for this view, an empty \l QVariant is returned.
+*/
+QVariant QOpcUaMultiDimensionalArrayView::value(const QVector<quint32> &indices) const
+{
+    const int index = arrayIndex(indices);
+    return index < 0 ? QVariant() : data->array.storedValue(static_cast<quint32>(index));
+}
+
+/*!
+    Returns a pointer to the typed storage of the array or \c nullptr if the array has no typed storage.
+    The element identified by a set of indices is located at \l arrayIndex().
+*/
+const void *QOpcUaMultiDimensionalArrayView::constData() const
+{
+    return data->array.constData();
+}
+
+/*!
+    \fn template <typename T> const T *QOpcUaMultiDimensionalArrayView::typedData() const
+
+    Returns a pointer to the typed storage of the array as array of \c T or \c nullptr if the
+    array has no typed storage.
+
+    \sa QOpcUaMultiDimensionalArray::typedData()
+*/
+
+/*!
+    \fn template <typename T> T QOpcUaMultiDimensionalArrayView::typedValue(const QVector<quint32> &indices) const
+
+    Returns the element identified by \a indices relative to this view from the typed storage
+    of the array. A default constructed \c T is returned if the indices are invalid or if the array
+    has no typed storage.
+*/
+
+/*!
+    Returns a view with one dimension less which contains the elements with index \a index
+    in dimension \a dimension. An invalid view is returned if \a dimension or \a index are out of range.
+
+    For a matrix, \c {slice(0, n)} returns the n-th row and \c {slice(1, n)} returns the n-th column.
+*/
+QOpcUaMultiDimensionalArrayView QOpcUaMultiDimensionalArrayView::slice(int dimension, quint32 index) const
+{
+    if (!data->valid || dimension < 0 || dimension >= data->arrayDimensions.size()
+            || index >= data->arrayDimensions.at(dimension))
+        return QOpcUaMultiDimensionalArrayView();
+
+    QOpcUaMultiDimensionalArrayView result(*this);
+    result.data->offset += index * data->strides.at(dimension);
+    result.data->arrayDimensions.remove(dimension);
+    result.data->strides.remove(dimension);
+    return result;
+}
+
+/*!
+    Returns a view which contains \a lengths elements starting at \a start for each dimension.
+    If \a steps is not empty, only every n-th element is contained in the view for a step of n.
+
+    An invalid view is returned if the number of values in the arguments doesn't match the number of
+    dimensions of this view or if the view would address elements outside of this view.
+*/
+QOpcUaMultiDimensionalArrayView QOpcUaMultiDimensionalArrayView::subArray(const QVector<quint32> &start,
+                                                                          const QVector<quint32> &lengths,
+                                                                          const QVector<quint32> &steps) const
+{
+    const int dimensions = data->arrayDimensions.size();
+    if (!data->valid || start.size() != dimensions || lengths.size() != dimensions
+            || (!steps.isEmpty() && steps.size() != dimensions))
+        return QOpcUaMultiDimensionalArrayView();
+
+    QOpcUaMultiDimensionalArrayView result(*this);
+    for (int i = 0; i < dimensions; ++i) {
+        const quint32 step = steps.isEmpty() ? 1 : steps.at(i);
+        if (!step || !lengths.at(i) || start.at(i) >= data->arrayDimensions.at(i)
+                || (lengths.at(i) - 1) > (data->arrayDimensions.at(i) - 1 - start.at(i)) / step)
+            return QOpcUaMultiDimensionalArrayView();
+
+        result.data->offset += start.at(i) * data->strides.at(i);
+        result.data->arrayDimensions[i] = lengths.at(i);
+        result.data->strides[i] *= step;
+    }
+    return result;
+}
+
+/*!
+    Returns a new array with the elements addressed by this view in row-major order.
+    The new array uses typed storage if the array of this view uses typed storage.
+*/
+QOpcUaMultiDimensionalArray QOpcUaMultiDimensionalArrayView::toArray() const
+{
+    if (!data->valid)
+        return QOpcUaMultiDimensionalArray();
+
+    // A view without dimensions addresses a single element
+    const QVector<quint32> dimensions = data->arrayDimensions.isEmpty() ? QVector<quint32>({1}) : data->arrayDimensions;
+    const quint32 count = size();
+    const QOpcUa::Types elementType = data->array.elementType();
+
+    QOpcUaMultiDimensionalArray result;
+    const char *source = nullptr;
+    char *target = nullptr;
+    size_t elementSize = 0;
+    QVariantList values;
+
+    if (data->array.hasTypedStorage()) {
+        result = QOpcUaMultiDimensionalArray(elementType, dimensions);
+        source = static_cast<const char *>(data->array.constData());
+        target = static_cast<char *>(result.data());
+        elementSize = QOpcUaMultiDimensionalArray::elementSize(elementType);
+
+        if (isContiguous()) {
+            if (count)
+                std::memcpy(target, source + data->offset * elementSize, count * elementSize);
+            return result;
+        }
+    } else {
+        values.reserve(static_cast<int>(count));
+    }
+
+    // Walk the view in row-major order and update the array index incrementally
+    QVector<quint32> indices(data->arrayDimensions.size(), 0);
+    quint32 index = data->offset;
+    for (quint32 n = 0; n < count; ++n) {
+        if (target)
+            std::memcpy(target + n * elementSize, source + index * elementSize, elementSize);
+        else
+            values.append(data->array.storedValue(index));
+
+        for (int i = indices.size() - 1; i >= 0; --i) {
+            if (++indices[i] < data->arrayDimensions.at(i)) {
+                index += data->strides.at(i);
+                break;
+            }
+            index -= (data->arrayDimensions.at(i) - 1) * data->strides.at(i);
+            indices[i] = 0;
+        }
+    }
+
+    if (!target)
+        result = QOpcUaMultiDimensionalArray(values, dimensions);
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAMULTIDIMENSIONALARRAYVIEW_H
+#define QOPCUAMULTIDIMENSIONALARRAYVIEW_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuamultidimensionalarray.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaMultiDimensionalArrayViewData;
+class Q_OPCUA_EXPORT QOpcUaMultiDimensionalArrayView
+{
+public:
+    QOpcUaMultiDimensionalArrayView();
+    explicit QOpcUaMultiDimensionalArrayView(const QOpcUaMultiDimensionalArray &array);
+    QOpcUaMultiDimensionalArrayView(const QOpcUaMultiDimensionalArrayView &other);
+    QOpcUaMultiDimensionalArrayView &operator=(const QOpcUaMultiDimensionalArrayView &rhs);
+    ~QOpcUaMultiDimensionalArrayView();
+
+    bool isValid() const;
+
+    QOpcUaMultiDimensionalArray array() const;
+    QVector<quint32> arrayDimensions() const;
+    QVector<quint32> strides() const;
+    quint32 offset() const;
+    quint32 size() const;
+    bool isContiguous() const;
+
+    int arrayIndex(const QVector<quint32> &indices) const;
+    QVariant value(const QVector<quint32> &indices) const;
+
+    const void *constData() const;
+
+    template <typename T>
+    const T *typedData() const { return static_cast<const T *>(constData()); }
+
+    template <typename T>
+    T typedValue(const QVector<quint32> &indices) const
+    {
+        const int index = arrayIndex(indices);
+        const T *data = typedData<T>();
+        return (index >= 0 && data) ? data[index] : T();
+    }
+
+    QOpcUaMultiDimensionalArrayView slice(int dimension, quint32 index) const;
+    QOpcUaMultiDimensionalArrayView subArray(const QVector<quint32> &start, const QVector<quint32> &lengths,
+                                             const QVector<quint32> &steps = QVector<quint32>()) const;
+
+    QOpcUaMultiDimensionalArray toArray() const;
+
+private:
+    QSharedDataPointer<QOpcUaMultiDimensionalArrayViewData> data;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaMultiDimensionalArrayView, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaMultiDimensionalArrayView)
+
+#endif // QOPCUAMULTIDIMENSIONALARRAYVIEW_H
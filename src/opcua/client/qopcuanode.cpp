@@ -103,8 +103,17 @@ QT_BEGIN_NAMESPACE
     reported in the \l eventOccurred() signal as a \l QVariantList which contains the values of the selected
     event fields.
 
+    For high event rates, \l eventsOccurred() delivers all events received for the monitored item in one
+    publish response as \l QOpcUaEventRecord objects. The fields of an event record can be accessed by the
+    name of their select clause element and are only converted when they are accessed.
+    If \l eventOccurred() is not connected, no \l QVariantList is created for the events.
+
     Settings of the subscription and monitored item can be modified at runtime using \l modifyMonitoring().
 
+    Monitored items can be linked to a triggering monitored item using \l setTriggering(). A linked item
+    in \l {QOpcUaMonitoringParameters::MonitoringMode} {Sampling} mode is only reported when the triggering item
+    reports a notification, which keeps values that only matter together with a trigger off the wire otherwise.
+
     \section1 Browsing the address space
     The OPC UA address space consists of nodes connected by references.
     \l browseChildren follows these references in forward direction and returns attributes from all
@@ -211,6 +220,15 @@ QT_BEGIN_NAMESPACE
     \a statusCode contains the result of the modify operation on the server.
 */
 
+/*!
+    \fn void QOpcUaNode::setTriggeringFinished(QOpcUa::NodeAttribute attr, QVector<QOpcUa::UaStatusCode> addResults, QVector<QOpcUa::UaStatusCode> removeResults, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after an asynchronous call to \l setTriggering() for the monitored item of \a attr has finished.
+    \a addResults and \a removeResults contain one status code for each link that was requested to be added or removed.
+    \a statusCode contains the service result of the SetTriggering call.
+*/
+
 /*!
     \fn void QOpcUaNode::methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode)
 
@@ -240,6 +258,21 @@ QT_BEGIN_NAMESPACE
     \sa QOpcUaReferenceDescription
 */
 
+/*!
+    \fn void QOpcUaNode::columnarBrowseFinished(QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after a \l browseChildren() or \l browse() operation has finished.
+
+    \a result contains the references which matched the criteria of the browse operation in compact form.
+    \a statusCode contains the service result of the browse operation. If \a statusCode is not \l {QOpcUa::UaStatusCode} {Good},
+    \a result is empty.
+
+    The vector of \l QOpcUaReferenceDescription for \l browseFinished() is only created if that signal is connected.
+    Applications browsing nodes with a large number of references should use this signal instead.
+    \sa QOpcUaBrowseResult
+*/
+
 /*!
     \fn void QOpcUaNode::resolveBrowsePathFinished(QVector<QOpcUaBrowsePathTarget> targets, QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode statusCode)
 
@@ -256,6 +289,21 @@ QT_BEGIN_NAMESPACE
     This signal is emitted after a new event has been received.
 
     \a eventFields contains the values of the event fields in the order specified in the \c select clause of the event filter.
+
+    \sa eventsOccurred()
+*/
+
+/*!
+    \fn void QOpcUaNode::eventsOccurred(QVector<QOpcUaEventRecord> events)
+    \since QtOpcUa 5.15
+
+    This signal is emitted after new events have been received.
+
+    \a events contains the events for this node which have been received in the same publish response
+    in the order they were reported by the server. Each event record is bound to the \c select clause
+    of the event filter.
+
+    \sa eventOccurred() QOpcUaEventRecord
 */
 
 /*!
@@ -424,6 +472,29 @@ QDateTime QOpcUaNode::serverTimestamp(QOpcUa::NodeAttribute attribute) const
     return it->serverTimestamp();
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the cached value, status code and timestamps from the last read or data change of \a attribute.
+    Unlike \l sourceTimestamp() and \l serverTimestamp(), the returned \l QOpcUaDataValue
+    provides the timestamps with the full 100 nanosecond resolution sent by the server.
+
+    If there is no entry in the attribute cache, a data value with status code
+    \l {QOpcUa::UaStatusCode} {BadNoEntryExists} is returned.
+*/
+QOpcUaDataValue QOpcUaNode::dataValue(QOpcUa::NodeAttribute attribute) const
+{
+    Q_D(const QOpcUaNode);
+    auto it = d->m_nodeAttributes.constFind(attribute);
+    if (it == d->m_nodeAttributes.constEnd()) {
+        QOpcUaDataValue value;
+        value.setStatusCode(QOpcUa::UaStatusCode::BadNoEntryExists);
+        return value;
+    }
+
+    return *it;
+}
+
 /*!
     This method creates a monitored item for each of the attributes given in \a attr.
     The settings from \a settings are used in the creation of the monitored items and the subscription.
@@ -471,6 +542,43 @@ bool QOpcUaNode::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringPa
     return d->m_impl->modifyMonitoring(attr, item, value);
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Links the monitored items with the ids in \a linksToAdd to the monitored item of \a attr and removes
+    the links to the monitored items with the ids in \a linksToRemove.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The monitored item of \a attr becomes the triggering item. Whenever it reports a notification, the server
+    also reports the queued notifications of all linked items, even if they are in
+    \l {QOpcUaMonitoringParameters::MonitoringMode} {Sampling} mode. All items must belong to the same subscription,
+    the ids can be obtained from \l QOpcUaMonitoringParameters::monitoredItemId() of the other nodes' \l monitoringStatus().
+
+    \code
+    QOpcUaMonitoringParameters p(100, QOpcUaMonitoringParameters::SubscriptionType::Shared,
+                                 trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId());
+    p.setMonitoringMode(QOpcUaMonitoringParameters::MonitoringMode::Sampling);
+    tag->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    ...
+    trigger->setTriggering(QOpcUa::NodeAttribute::Value, { tag->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoredItemId() });
+    \endcode
+
+    After the call has finished, the \l setTriggeringFinished signal is emitted and the successfully changed links are
+    reflected in \l QOpcUaMonitoringParameters::triggeredItemIds().
+*/
+bool QOpcUaNode::setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd, const QVector<quint32> &linksToRemove)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    if (linksToAdd.isEmpty() && linksToRemove.isEmpty())
+        return false;
+
+    return d->m_impl->setTriggering(attr, linksToAdd, linksToRemove);
+}
+
 /*!
     Returns the monitoring parameters associated with the attribute \a attr. This can be used to check the success of \l enableMonitoring()
     or if parameters have been revised.
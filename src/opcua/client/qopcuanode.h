@@ -38,6 +38,9 @@
 #define QOPCUANODE_H
 
 #include <QtOpcUa/qopcuabrowserequest.h>
+#include <QtOpcUa/qopcuabrowseresult.h>
+#include <QtOpcUa/qopcuadatavalue.h>
+#include <QtOpcUa/qopcuaeventrecord.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <QtOpcUa/qopcuareferencedescription.h>
@@ -79,6 +82,7 @@ public:
     QOpcUa::UaStatusCode valueAttributeError() const;
     QDateTime sourceTimestamp(QOpcUa::NodeAttribute attribute) const;
     QDateTime serverTimestamp(QOpcUa::NodeAttribute attribute) const;
+    QOpcUaDataValue dataValue(QOpcUa::NodeAttribute attribute) const;
     bool writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type = QOpcUa::Types::Undefined);
     bool writeAttributeRange(QOpcUa::NodeAttribute attribute, const QVariant &value,
                         const QString &indexRange, QOpcUa::Types type = QOpcUa::Types::Undefined);
@@ -91,6 +95,8 @@ public:
     QOpcUaMonitoringParameters monitoringStatus(QOpcUa::NodeAttribute attr);
     bool modifyEventFilter(const QOpcUaMonitoringParameters::EventFilter &eventFilter);
     bool modifyDataChangeFilter(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::DataChangeFilter &filter);
+    bool setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                       const QVector<quint32> &linksToRemove = QVector<quint32>());
 
     bool browseChildren(QOpcUa::ReferenceTypeId referenceType = QOpcUa::ReferenceTypeId::HierarchicalReferences,
                         QOpcUa::NodeClasses nodeClassMask = QOpcUa::NodeClass::Undefined);
@@ -110,13 +116,17 @@ Q_SIGNALS:
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QVariant value);
     void attributeUpdated(QOpcUa::NodeAttribute attr, QVariant value);
     void eventOccurred(QVariantList eventFields);
+    void eventsOccurred(QVector<QOpcUaEventRecord> events);
 
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUa::UaStatusCode statusCode);
+    void setTriggeringFinished(QOpcUa::NodeAttribute attr, QVector<QOpcUa::UaStatusCode> addResults,
+                               QVector<QOpcUa::UaStatusCode> removeResults, QOpcUa::UaStatusCode statusCode);
     void enableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode);
     void disableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void columnarBrowseFinished(QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode);
     void resolveBrowsePathFinished(QVector<QOpcUaBrowsePathTarget> targets,
                                      QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode statusCode);
 
@@ -54,6 +54,7 @@
 #include <private/qopcuanodeimpl_p.h>
 
 #include <private/qobject_p.h>
+#include <QtCore/qmetaobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qhash.h>
@@ -76,14 +77,16 @@ public:
             Q_Q(QOpcUaNode);
 
             for (auto &entry : qAsConst(attr)) {
-                if (serviceResult == QOpcUa::UaStatusCode::Good)
-                    m_nodeAttributes[entry.attribute()] = entry;
-                else {
-                    QOpcUaReadResult temp = entry;
-                    temp.setStatusCode(serviceResult);
-                    temp.setValue(QVariant());
-                    m_nodeAttributes[entry.attribute()] = temp;
+                QOpcUaDataValue &cached = m_nodeAttributes[entry.attribute()];
+                if (serviceResult == QOpcUa::UaStatusCode::Good) {
+                    cached.setValue(entry.value());
+                    cached.setStatusCode(entry.statusCode());
+                } else {
+                    cached.setValue(QVariant());
+                    cached.setStatusCode(serviceResult);
                 }
+                cached.setSourceTimestamp(entry.sourceTimestamp());
+                cached.setServerTimestamp(entry.serverTimestamp());
 
                 updatedAttributes |= entry.attribute();
                 emit q->attributeUpdated(entry.attribute(), entry.value());
@@ -107,7 +110,7 @@ public:
         });
 
         m_dataChangeOccurredConnection = QObject::connect(impl, &QOpcUaNodeImpl::dataChangeOccurred,
-                [this](QOpcUa::NodeAttribute attr, QOpcUaReadResult value)
+                [this](QOpcUa::NodeAttribute attr, QOpcUaDataValue value)
         {
             this->m_nodeAttributes[attr] = value;
             Q_Q(QOpcUaNode);
@@ -174,6 +177,29 @@ public:
             emit q->monitoringStatusChanged(attr, items, param.statusCode());
         });
 
+        m_setTriggeringFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::setTriggeringFinished,
+                [this](QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove,
+                       QVector<QOpcUa::UaStatusCode> addResults, QVector<QOpcUa::UaStatusCode> removeResults,
+                       QOpcUa::UaStatusCode statusCode)
+        {
+            auto it = m_monitoringStatus.find(attr);
+            if (statusCode == QOpcUa::UaStatusCode::Good && it != m_monitoringStatus.end()) {
+                QVector<quint32> triggeredItemIds = it->triggeredItemIds();
+                for (int i = 0; i < linksToRemove.size() && i < removeResults.size(); ++i) {
+                    if (removeResults.at(i) == QOpcUa::UaStatusCode::Good)
+                        triggeredItemIds.removeAll(linksToRemove.at(i));
+                }
+                for (int i = 0; i < linksToAdd.size() && i < addResults.size(); ++i) {
+                    if (addResults.at(i) == QOpcUa::UaStatusCode::Good && !triggeredItemIds.contains(linksToAdd.at(i)))
+                        triggeredItemIds.append(linksToAdd.at(i));
+                }
+                it->setTriggeredItemIds(triggeredItemIds);
+            }
+
+            Q_Q(QOpcUaNode);
+            emit q->setTriggeringFinished(attr, addResults, removeResults, statusCode);
+        });
+
 
         m_methodCallFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::methodCallFinished,
             [this](QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode)
@@ -183,10 +209,14 @@ public:
         });
 
         m_browseFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::browseFinished,
-                [this](QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode)
+                [this](QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode)
         {
             Q_Q(QOpcUaNode);
-            emit q->browseFinished(children, statusCode);
+            emit q->columnarBrowseFinished(result, statusCode);
+            // Only create the reference descriptions if someone is interested in them
+            static const QMetaMethod browseFinishedSignal = QMetaMethod::fromSignal(&QOpcUaNode::browseFinished);
+            if (q->isSignalConnected(browseFinishedSignal))
+                emit q->browseFinished(result.toReferenceDescriptions(), statusCode);
         });
 
         m_resolveBrowsePathFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::resolveBrowsePathFinished,
@@ -197,11 +227,17 @@ public:
             emit q->resolveBrowsePathFinished(targets, path, statusCode);
         });
 
-        m_eventOccurredConnection = QObject::connect(impl, &QOpcUaNodeImpl::eventOccurred,
-            [this](QVariantList eventFields)
+        m_eventOccurredConnection = QObject::connect(impl, &QOpcUaNodeImpl::eventsOccurred,
+            [this](QVector<QOpcUaEventRecord> events)
         {
             Q_Q(QOpcUaNode);
-            emit q->eventOccurred(eventFields);
+            // The field lists are only created for users of the signal with one list per event
+            static const QMetaMethod eventOccurredSignal = QMetaMethod::fromSignal(&QOpcUaNode::eventOccurred);
+            if (q->isSignalConnected(eventOccurredSignal)) {
+                for (const auto &event : qAsConst(events))
+                    emit q->eventOccurred(event.toVariantList());
+            }
+            emit q->eventsOccurred(events);
         });
     }
 
@@ -212,6 +248,7 @@ public:
         QObject::disconnect(m_dataChangeOccurredConnection);
         QObject::disconnect(m_monitoringEnableDisableConnection);
         QObject::disconnect(m_monitoringStatusChangedConnection);
+        QObject::disconnect(m_setTriggeringFinishedConnection);
         QObject::disconnect(m_methodCallFinishedConnection);
         QObject::disconnect(m_browseFinishedConnection);
         QObject::disconnect(m_resolveBrowsePathFinishedConnection);
@@ -231,7 +268,7 @@ public:
     QScopedPointer<QOpcUaNodeImpl> m_impl;
     QPointer<QOpcUaClient> m_client;
 
-    QHash<QOpcUa::NodeAttribute, QOpcUaReadResult> m_nodeAttributes;
+    QHash<QOpcUa::NodeAttribute, QOpcUaDataValue> m_nodeAttributes;
     QHash<QOpcUa::NodeAttribute, QOpcUaMonitoringParameters> m_monitoringStatus;
 
     QMetaObject::Connection m_attributesReadConnection;
@@ -239,6 +276,7 @@ public:
     QMetaObject::Connection m_dataChangeOccurredConnection;
     QMetaObject::Connection m_monitoringEnableDisableConnection;
     QMetaObject::Connection m_monitoringStatusChangedConnection;
+    QMetaObject::Connection m_setTriggeringFinishedConnection;
     QMetaObject::Connection m_methodCallFinishedConnection;
     QMetaObject::Connection m_browseFinishedConnection;
     QMetaObject::Connection m_resolveBrowsePathFinishedConnection;
@@ -34,7 +34,7 @@
 **
 ****************************************************************************/
 
-#include "qopcuanodeids.h"
+#include "qopcuanodeids_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -5808,4 +5808,7077 @@ QT_BEGIN_NAMESPACE
     \value Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace
 */
 
+#ifndef QT_OPCUA_NO_NS0IDNAMES
+
+const QOpcUaNodeIdsPrivate::Namespace0Name QOpcUaNodeIdsPrivate::namespace0Names[] = {
+    {1, "Boolean"},
+    {2, "SByte"},
+    {3, "Byte"},
+    {4, "Int16"},
+    {5, "UInt16"},
+    {6, "Int32"},
+    {7, "UInt32"},
+    {8, "Int64"},
+    {9, "UInt64"},
+    {10, "Float"},
+    {11, "Double"},
+    {12, "String"},
+    {13, "DateTime"},
+    {14, "Guid"},
+    {15, "ByteString"},
+    {16, "XmlElement"},
+    {17, "NodeId"},
+    {18, "ExpandedNodeId"},
+    {19, "StatusCode"},
+    {20, "QualifiedName"},
+    {21, "LocalizedText"},
+    {22, "Structure"},
+    {23, "DataValue"},
+    {24, "BaseDataType"},
+    {25, "DiagnosticInfo"},
+    {26, "Number"},
+    {27, "Integer"},
+    {28, "UInteger"},
+    {29, "Enumeration"},
+    {30, "Image"},
+    {31, "References"},
+    {32, "NonHierarchicalReferences"},
+    {33, "HierarchicalReferences"},
+    {34, "HasChild"},
+    {35, "Organizes"},
+    {36, "HasEventSource"},
+    {37, "HasModellingRule"},
+    {38, "HasEncoding"},
+    {39, "HasDescription"},
+    {40, "HasTypeDefinition"},
+    {41, "GeneratesEvent"},
+    {44, "Aggregates"},
+    {45, "HasSubtype"},
+    {46, "HasProperty"},
+    {47, "HasComponent"},
+    {48, "HasNotifier"},
+    {49, "HasOrderedComponent"},
+    {51, "FromState"},
+    {52, "ToState"},
+    {53, "HasCause"},
+    {54, "HasEffect"},
+    {56, "HasHistoricalConfiguration"},
+    {58, "BaseObjectType"},
+    {61, "FolderType"},
+    {62, "BaseVariableType"},
+    {63, "BaseDataVariableType"},
+    {68, "PropertyType"},
+    {69, "DataTypeDescriptionType"},
+    {72, "DataTypeDictionaryType"},
+    {75, "DataTypeSystemType"},
+    {76, "DataTypeEncodingType"},
+    {77, "ModellingRuleType"},
+    {78, "ModellingRule_Mandatory"},
+    {79, "ModellingRule_MandatoryShared"},
+    {80, "ModellingRule_Optional"},
+    {83, "ModellingRule_ExposesItsArray"},
+    {84, "RootFolder"},
+    {85, "ObjectsFolder"},
+    {86, "TypesFolder"},
+    {87, "ViewsFolder"},
+    {88, "ObjectTypesFolder"},
+    {89, "VariableTypesFolder"},
+    {90, "DataTypesFolder"},
+    {91, "ReferenceTypesFolder"},
+    {92, "XmlSchema_TypeSystem"},
+    {93, "OPCBinarySchema_TypeSystem"},
+    {104, "DataTypeDescriptionType_DataTypeVersion"},
+    {105, "DataTypeDescriptionType_DictionaryFragment"},
+    {106, "DataTypeDictionaryType_DataTypeVersion"},
+    {107, "DataTypeDictionaryType_NamespaceUri"},
+    {111, "ModellingRuleType_NamingRule"},
+    {112, "ModellingRule_Mandatory_NamingRule"},
+    {113, "ModellingRule_Optional_NamingRule"},
+    {114, "ModellingRule_ExposesItsArray_NamingRule"},
+    {116, "ModellingRule_MandatoryShared_NamingRule"},
+    {117, "HasSubStateMachine"},
+    {120, "NamingRuleType"},
+    {121, "Decimal128"},
+    {256, "IdType"},
+    {257, "NodeClass"},
+    {258, "Node"},
+    {259, "Node_Encoding_DefaultXml"},
+    {260, "Node_Encoding_DefaultBinary"},
+    {261, "ObjectNode"},
+    {262, "ObjectNode_Encoding_DefaultXml"},
+    {263, "ObjectNode_Encoding_DefaultBinary"},
+    {264, "ObjectTypeNode"},
+    {265, "ObjectTypeNode_Encoding_DefaultXml"},
+    {266, "ObjectTypeNode_Encoding_DefaultBinary"},
+    {267, "VariableNode"},
+    {268, "VariableNode_Encoding_DefaultXml"},
+    {269, "VariableNode_Encoding_DefaultBinary"},
+    {270, "VariableTypeNode"},
+    {271, "VariableTypeNode_Encoding_DefaultXml"},
+    {272, "VariableTypeNode_Encoding_DefaultBinary"},
+    {273, "ReferenceTypeNode"},
+    {274, "ReferenceTypeNode_Encoding_DefaultXml"},
+    {275, "ReferenceTypeNode_Encoding_DefaultBinary"},
+    {276, "MethodNode"},
+    {277, "MethodNode_Encoding_DefaultXml"},
+    {278, "MethodNode_Encoding_DefaultBinary"},
+    {279, "ViewNode"},
+    {280, "ViewNode_Encoding_DefaultXml"},
+    {281, "ViewNode_Encoding_DefaultBinary"},
+    {282, "DataTypeNode"},
+    {283, "DataTypeNode_Encoding_DefaultXml"},
+    {284, "DataTypeNode_Encoding_DefaultBinary"},
+    {285, "ReferenceNode"},
+    {286, "ReferenceNode_Encoding_DefaultXml"},
+    {287, "ReferenceNode_Encoding_DefaultBinary"},
+    {288, "IntegerId"},
+    {289, "Counter"},
+    {290, "Duration"},
+    {291, "NumericRange"},
+    {292, "Time"},
+    {293, "Date"},
+    {294, "UtcTime"},
+    {295, "LocaleId"},
+    {296, "Argument"},
+    {297, "Argument_Encoding_DefaultXml"},
+    {298, "Argument_Encoding_DefaultBinary"},
+    {299, "StatusResult"},
+    {300, "StatusResult_Encoding_DefaultXml"},
+    {301, "StatusResult_Encoding_DefaultBinary"},
+    {302, "MessageSecurityMode"},
+    {303, "UserTokenType"},
+    {304, "UserTokenPolicy"},
+    {305, "UserTokenPolicy_Encoding_DefaultXml"},
+    {306, "UserTokenPolicy_Encoding_DefaultBinary"},
+    {307, "ApplicationType"},
+    {308, "ApplicationDescription"},
+    {309, "ApplicationDescription_Encoding_DefaultXml"},
+    {310, "ApplicationDescription_Encoding_DefaultBinary"},
+    {311, "ApplicationInstanceCertificate"},
+    {312, "EndpointDescription"},
+    {313, "EndpointDescription_Encoding_DefaultXml"},
+    {314, "EndpointDescription_Encoding_DefaultBinary"},
+    {315, "SecurityTokenRequestType"},
+    {316, "UserIdentityToken"},
+    {317, "UserIdentityToken_Encoding_DefaultXml"},
+    {318, "UserIdentityToken_Encoding_DefaultBinary"},
+    {319, "AnonymousIdentityToken"},
+    {320, "AnonymousIdentityToken_Encoding_DefaultXml"},
+    {321, "AnonymousIdentityToken_Encoding_DefaultBinary"},
+    {322, "UserNameIdentityToken"},
+    {323, "UserNameIdentityToken_Encoding_DefaultXml"},
+    {324, "UserNameIdentityToken_Encoding_DefaultBinary"},
+    {325, "X509IdentityToken"},
+    {326, "X509IdentityToken_Encoding_DefaultXml"},
+    {327, "X509IdentityToken_Encoding_DefaultBinary"},
+    {331, "EndpointConfiguration"},
+    {332, "EndpointConfiguration_Encoding_DefaultXml"},
+    {333, "EndpointConfiguration_Encoding_DefaultBinary"},
+    {338, "BuildInfo"},
+    {339, "BuildInfo_Encoding_DefaultXml"},
+    {340, "BuildInfo_Encoding_DefaultBinary"},
+    {344, "SignedSoftwareCertificate"},
+    {345, "SignedSoftwareCertificate_Encoding_DefaultXml"},
+    {346, "SignedSoftwareCertificate_Encoding_DefaultBinary"},
+    {347, "AttributeWriteMask"},
+    {348, "NodeAttributesMask"},
+    {349, "NodeAttributes"},
+    {350, "NodeAttributes_Encoding_DefaultXml"},
+    {351, "NodeAttributes_Encoding_DefaultBinary"},
+    {352, "ObjectAttributes"},
+    {353, "ObjectAttributes_Encoding_DefaultXml"},
+    {354, "ObjectAttributes_Encoding_DefaultBinary"},
+    {355, "VariableAttributes"},
+    {356, "VariableAttributes_Encoding_DefaultXml"},
+    {357, "VariableAttributes_Encoding_DefaultBinary"},
+    {358, "MethodAttributes"},
+    {359, "MethodAttributes_Encoding_DefaultXml"},
+    {360, "MethodAttributes_Encoding_DefaultBinary"},
+    {361, "ObjectTypeAttributes"},
+    {362, "ObjectTypeAttributes_Encoding_DefaultXml"},
+    {363, "ObjectTypeAttributes_Encoding_DefaultBinary"},
+    {364, "VariableTypeAttributes"},
+    {365, "VariableTypeAttributes_Encoding_DefaultXml"},
+    {366, "VariableTypeAttributes_Encoding_DefaultBinary"},
+    {367, "ReferenceTypeAttributes"},
+    {368, "ReferenceTypeAttributes_Encoding_DefaultXml"},
+    {369, "ReferenceTypeAttributes_Encoding_DefaultBinary"},
+    {370, "DataTypeAttributes"},
+    {371, "DataTypeAttributes_Encoding_DefaultXml"},
+    {372, "DataTypeAttributes_Encoding_DefaultBinary"},
+    {373, "ViewAttributes"},
+    {374, "ViewAttributes_Encoding_DefaultXml"},
+    {375, "ViewAttributes_Encoding_DefaultBinary"},
+    {376, "AddNodesItem"},
+    {377, "AddNodesItem_Encoding_DefaultXml"},
+    {378, "AddNodesItem_Encoding_DefaultBinary"},
+    {379, "AddReferencesItem"},
+    {380, "AddReferencesItem_Encoding_DefaultXml"},
+    {381, "AddReferencesItem_Encoding_DefaultBinary"},
+    {382, "DeleteNodesItem"},
+    {383, "DeleteNodesItem_Encoding_DefaultXml"},
+    {384, "DeleteNodesItem_Encoding_DefaultBinary"},
+    {385, "DeleteReferencesItem"},
+    {386, "DeleteReferencesItem_Encoding_DefaultXml"},
+    {387, "DeleteReferencesItem_Encoding_DefaultBinary"},
+    {388, "SessionAuthenticationToken"},
+    {389, "RequestHeader"},
+    {390, "RequestHeader_Encoding_DefaultXml"},
+    {391, "RequestHeader_Encoding_DefaultBinary"},
+    {392, "ResponseHeader"},
+    {393, "ResponseHeader_Encoding_DefaultXml"},
+    {394, "ResponseHeader_Encoding_DefaultBinary"},
+    {395, "ServiceFault"},
+    {396, "ServiceFault_Encoding_DefaultXml"},
+    {397, "ServiceFault_Encoding_DefaultBinary"},
+    {420, "FindServersRequest"},
+    {421, "FindServersRequest_Encoding_DefaultXml"},
+    {422, "FindServersRequest_Encoding_DefaultBinary"},
+    {423, "FindServersResponse"},
+    {424, "FindServersResponse_Encoding_DefaultXml"},
+    {425, "FindServersResponse_Encoding_DefaultBinary"},
+    {426, "GetEndpointsRequest"},
+    {427, "GetEndpointsRequest_Encoding_DefaultXml"},
+    {428, "GetEndpointsRequest_Encoding_DefaultBinary"},
+    {429, "GetEndpointsResponse"},
+    {430, "GetEndpointsResponse_Encoding_DefaultXml"},
+    {431, "GetEndpointsResponse_Encoding_DefaultBinary"},
+    {432, "RegisteredServer"},
+    {433, "RegisteredServer_Encoding_DefaultXml"},
+    {434, "RegisteredServer_Encoding_DefaultBinary"},
+    {435, "RegisterServerRequest"},
+    {436, "RegisterServerRequest_Encoding_DefaultXml"},
+    {437, "RegisterServerRequest_Encoding_DefaultBinary"},
+    {438, "RegisterServerResponse"},
+    {439, "RegisterServerResponse_Encoding_DefaultXml"},
+    {440, "RegisterServerResponse_Encoding_DefaultBinary"},
+    {441, "ChannelSecurityToken"},
+    {442, "ChannelSecurityToken_Encoding_DefaultXml"},
+    {443, "ChannelSecurityToken_Encoding_DefaultBinary"},
+    {444, "OpenSecureChannelRequest"},
+    {445, "OpenSecureChannelRequest_Encoding_DefaultXml"},
+    {446, "OpenSecureChannelRequest_Encoding_DefaultBinary"},
+    {447, "OpenSecureChannelResponse"},
+    {448, "OpenSecureChannelResponse_Encoding_DefaultXml"},
+    {449, "OpenSecureChannelResponse_Encoding_DefaultBinary"},
+    {450, "CloseSecureChannelRequest"},
+    {451, "CloseSecureChannelRequest_Encoding_DefaultXml"},
+    {452, "CloseSecureChannelRequest_Encoding_DefaultBinary"},
+    {453, "CloseSecureChannelResponse"},
+    {454, "CloseSecureChannelResponse_Encoding_DefaultXml"},
+    {455, "CloseSecureChannelResponse_Encoding_DefaultBinary"},
+    {456, "SignatureData"},
+    {457, "SignatureData_Encoding_DefaultXml"},
+    {458, "SignatureData_Encoding_DefaultBinary"},
+    {459, "CreateSessionRequest"},
+    {460, "CreateSessionRequest_Encoding_DefaultXml"},
+    {461, "CreateSessionRequest_Encoding_DefaultBinary"},
+    {462, "CreateSessionResponse"},
+    {463, "CreateSessionResponse_Encoding_DefaultXml"},
+    {464, "CreateSessionResponse_Encoding_DefaultBinary"},
+    {465, "ActivateSessionRequest"},
+    {466, "ActivateSessionRequest_Encoding_DefaultXml"},
+    {467, "ActivateSessionRequest_Encoding_DefaultBinary"},
+    {468, "ActivateSessionResponse"},
+    {469, "ActivateSessionResponse_Encoding_DefaultXml"},
+    {470, "ActivateSessionResponse_Encoding_DefaultBinary"},
+    {471, "CloseSessionRequest"},
+    {472, "CloseSessionRequest_Encoding_DefaultXml"},
+    {473, "CloseSessionRequest_Encoding_DefaultBinary"},
+    {474, "CloseSessionResponse"},
+    {475, "CloseSessionResponse_Encoding_DefaultXml"},
+    {476, "CloseSessionResponse_Encoding_DefaultBinary"},
+    {477, "CancelRequest"},
+    {478, "CancelRequest_Encoding_DefaultXml"},
+    {479, "CancelRequest_Encoding_DefaultBinary"},
+    {480, "CancelResponse"},
+    {481, "CancelResponse_Encoding_DefaultXml"},
+    {482, "CancelResponse_Encoding_DefaultBinary"},
+    {483, "AddNodesResult"},
+    {484, "AddNodesResult_Encoding_DefaultXml"},
+    {485, "AddNodesResult_Encoding_DefaultBinary"},
+    {486, "AddNodesRequest"},
+    {487, "AddNodesRequest_Encoding_DefaultXml"},
+    {488, "AddNodesRequest_Encoding_DefaultBinary"},
+    {489, "AddNodesResponse"},
+    {490, "AddNodesResponse_Encoding_DefaultXml"},
+    {491, "AddNodesResponse_Encoding_DefaultBinary"},
+    {492, "AddReferencesRequest"},
+    {493, "AddReferencesRequest_Encoding_DefaultXml"},
+    {494, "AddReferencesRequest_Encoding_DefaultBinary"},
+    {495, "AddReferencesResponse"},
+    {496, "AddReferencesResponse_Encoding_DefaultXml"},
+    {497, "AddReferencesResponse_Encoding_DefaultBinary"},
+    {498, "DeleteNodesRequest"},
+    {499, "DeleteNodesRequest_Encoding_DefaultXml"},
+    {500, "DeleteNodesRequest_Encoding_DefaultBinary"},
+    {501, "DeleteNodesResponse"},
+    {502, "DeleteNodesResponse_Encoding_DefaultXml"},
+    {503, "DeleteNodesResponse_Encoding_DefaultBinary"},
+    {504, "DeleteReferencesRequest"},
+    {505, "DeleteReferencesRequest_Encoding_DefaultXml"},
+    {506, "DeleteReferencesRequest_Encoding_DefaultBinary"},
+    {507, "DeleteReferencesResponse"},
+    {508, "DeleteReferencesResponse_Encoding_DefaultXml"},
+    {509, "DeleteReferencesResponse_Encoding_DefaultBinary"},
+    {510, "BrowseDirection"},
+    {511, "ViewDescription"},
+    {512, "ViewDescription_Encoding_DefaultXml"},
+    {513, "ViewDescription_Encoding_DefaultBinary"},
+    {514, "BrowseDescription"},
+    {515, "BrowseDescription_Encoding_DefaultXml"},
+    {516, "BrowseDescription_Encoding_DefaultBinary"},
+    {517, "BrowseResultMask"},
+    {518, "ReferenceDescription"},
+    {519, "ReferenceDescription_Encoding_DefaultXml"},
+    {520, "ReferenceDescription_Encoding_DefaultBinary"},
+    {521, "ContinuationPoint"},
+    {522, "BrowseResult"},
+    {523, "BrowseResult_Encoding_DefaultXml"},
+    {524, "BrowseResult_Encoding_DefaultBinary"},
+    {525, "BrowseRequest"},
+    {526, "BrowseRequest_Encoding_DefaultXml"},
+    {527, "BrowseRequest_Encoding_DefaultBinary"},
+    {528, "BrowseResponse"},
+    {529, "BrowseResponse_Encoding_DefaultXml"},
+    {530, "BrowseResponse_Encoding_DefaultBinary"},
+    {531, "BrowseNextRequest"},
+    {532, "BrowseNextRequest_Encoding_DefaultXml"},
+    {533, "BrowseNextRequest_Encoding_DefaultBinary"},
+    {534, "BrowseNextResponse"},
+    {535, "BrowseNextResponse_Encoding_DefaultXml"},
+    {536, "BrowseNextResponse_Encoding_DefaultBinary"},
+    {537, "RelativePathElement"},
+    {538, "RelativePathElement_Encoding_DefaultXml"},
+    {539, "RelativePathElement_Encoding_DefaultBinary"},
+    {540, "RelativePath"},
+    {541, "RelativePath_Encoding_DefaultXml"},
+    {542, "RelativePath_Encoding_DefaultBinary"},
+    {543, "BrowsePath"},
+    {544, "BrowsePath_Encoding_DefaultXml"},
+    {545, "BrowsePath_Encoding_DefaultBinary"},
+    {546, "BrowsePathTarget"},
+    {547, "BrowsePathTarget_Encoding_DefaultXml"},
+    {548, "BrowsePathTarget_Encoding_DefaultBinary"},
+    {549, "BrowsePathResult"},
+    {550, "BrowsePathResult_Encoding_DefaultXml"},
+    {551, "BrowsePathResult_Encoding_DefaultBinary"},
+    {552, "TranslateBrowsePathsToNodeIdsRequest"},
+    {553, "TranslateBrowsePathsToNodeIdsRequest_Encoding_DefaultXml"},
+    {554, "TranslateBrowsePathsToNodeIdsRequest_Encoding_DefaultBinary"},
+    {555, "TranslateBrowsePathsToNodeIdsResponse"},
+    {556, "TranslateBrowsePathsToNodeIdsResponse_Encoding_DefaultXml"},
+    {557, "TranslateBrowsePathsToNodeIdsResponse_Encoding_DefaultBinary"},
+    {558, "RegisterNodesRequest"},
+    {559, "RegisterNodesRequest_Encoding_DefaultXml"},
+    {560, "RegisterNodesRequest_Encoding_DefaultBinary"},
+    {561, "RegisterNodesResponse"},
+    {562, "RegisterNodesResponse_Encoding_DefaultXml"},
+    {563, "RegisterNodesResponse_Encoding_DefaultBinary"},
+    {564, "UnregisterNodesRequest"},
+    {565, "UnregisterNodesRequest_Encoding_DefaultXml"},
+    {566, "UnregisterNodesRequest_Encoding_DefaultBinary"},
+    {567, "UnregisterNodesResponse"},
+    {568, "UnregisterNodesResponse_Encoding_DefaultXml"},
+    {569, "UnregisterNodesResponse_Encoding_DefaultBinary"},
+    {570, "QueryDataDescription"},
+    {571, "QueryDataDescription_Encoding_DefaultXml"},
+    {572, "QueryDataDescription_Encoding_DefaultBinary"},
+    {573, "NodeTypeDescription"},
+    {574, "NodeTypeDescription_Encoding_DefaultXml"},
+    {575, "NodeTypeDescription_Encoding_DefaultBinary"},
+    {576, "FilterOperator"},
+    {577, "QueryDataSet"},
+    {578, "QueryDataSet_Encoding_DefaultXml"},
+    {579, "QueryDataSet_Encoding_DefaultBinary"},
+    {580, "NodeReference"},
+    {581, "NodeReference_Encoding_DefaultXml"},
+    {582, "NodeReference_Encoding_DefaultBinary"},
+    {583, "ContentFilterElement"},
+    {584, "ContentFilterElement_Encoding_DefaultXml"},
+    {585, "ContentFilterElement_Encoding_DefaultBinary"},
+    {586, "ContentFilter"},
+    {587, "ContentFilter_Encoding_DefaultXml"},
+    {588, "ContentFilter_Encoding_DefaultBinary"},
+    {589, "FilterOperand"},
+    {590, "FilterOperand_Encoding_DefaultXml"},
+    {591, "FilterOperand_Encoding_DefaultBinary"},
+    {592, "ElementOperand"},
+    {593, "ElementOperand_Encoding_DefaultXml"},
+    {594, "ElementOperand_Encoding_DefaultBinary"},
+    {595, "LiteralOperand"},
+    {596, "LiteralOperand_Encoding_DefaultXml"},
+    {597, "LiteralOperand_Encoding_DefaultBinary"},
+    {598, "AttributeOperand"},
+    {599, "AttributeOperand_Encoding_DefaultXml"},
+    {600, "AttributeOperand_Encoding_DefaultBinary"},
+    {601, "SimpleAttributeOperand"},
+    {602, "SimpleAttributeOperand_Encoding_DefaultXml"},
+    {603, "SimpleAttributeOperand_Encoding_DefaultBinary"},
+    {604, "ContentFilterElementResult"},
+    {605, "ContentFilterElementResult_Encoding_DefaultXml"},
+    {606, "ContentFilterElementResult_Encoding_DefaultBinary"},
+    {607, "ContentFilterResult"},
+    {608, "ContentFilterResult_Encoding_DefaultXml"},
+    {609, "ContentFilterResult_Encoding_DefaultBinary"},
+    {610, "ParsingResult"},
+    {611, "ParsingResult_Encoding_DefaultXml"},
+    {612, "ParsingResult_Encoding_DefaultBinary"},
+    {613, "QueryFirstRequest"},
+    {614, "QueryFirstRequest_Encoding_DefaultXml"},
+    {615, "QueryFirstRequest_Encoding_DefaultBinary"},
+    {616, "QueryFirstResponse"},
+    {617, "QueryFirstResponse_Encoding_DefaultXml"},
+    {618, "QueryFirstResponse_Encoding_DefaultBinary"},
+    {619, "QueryNextRequest"},
+    {620, "QueryNextRequest_Encoding_DefaultXml"},
+    {621, "QueryNextRequest_Encoding_DefaultBinary"},
+    {622, "QueryNextResponse"},
+    {623, "QueryNextResponse_Encoding_DefaultXml"},
+    {624, "QueryNextResponse_Encoding_DefaultBinary"},
+    {625, "TimestampsToReturn"},
+    {626, "ReadValueId"},
+    {627, "ReadValueId_Encoding_DefaultXml"},
+    {628, "ReadValueId_Encoding_DefaultBinary"},
+    {629, "ReadRequest"},
+    {630, "ReadRequest_Encoding_DefaultXml"},
+    {631, "ReadRequest_Encoding_DefaultBinary"},
+    {632, "ReadResponse"},
+    {633, "ReadResponse_Encoding_DefaultXml"},
+    {634, "ReadResponse_Encoding_DefaultBinary"},
+    {635, "HistoryReadValueId"},
+    {636, "HistoryReadValueId_Encoding_DefaultXml"},
+    {637, "HistoryReadValueId_Encoding_DefaultBinary"},
+    {638, "HistoryReadResult"},
+    {639, "HistoryReadResult_Encoding_DefaultXml"},
+    {640, "HistoryReadResult_Encoding_DefaultBinary"},
+    {641, "HistoryReadDetails"},
+    {642, "HistoryReadDetails_Encoding_DefaultXml"},
+    {643, "HistoryReadDetails_Encoding_DefaultBinary"},
+    {644, "ReadEventDetails"},
+    {645, "ReadEventDetails_Encoding_DefaultXml"},
+    {646, "ReadEventDetails_Encoding_DefaultBinary"},
+    {647, "ReadRawModifiedDetails"},
+    {648, "ReadRawModifiedDetails_Encoding_DefaultXml"},
+    {649, "ReadRawModifiedDetails_Encoding_DefaultBinary"},
+    {650, "ReadProcessedDetails"},
+    {651, "ReadProcessedDetails_Encoding_DefaultXml"},
+    {652, "ReadProcessedDetails_Encoding_DefaultBinary"},
+    {653, "ReadAtTimeDetails"},
+    {654, "ReadAtTimeDetails_Encoding_DefaultXml"},
+    {655, "ReadAtTimeDetails_Encoding_DefaultBinary"},
+    {656, "HistoryData"},
+    {657, "HistoryData_Encoding_DefaultXml"},
+    {658, "HistoryData_Encoding_DefaultBinary"},
+    {659, "HistoryEvent"},
+    {660, "HistoryEvent_Encoding_DefaultXml"},
+    {661, "HistoryEvent_Encoding_DefaultBinary"},
+    {662, "HistoryReadRequest"},
+    {663, "HistoryReadRequest_Encoding_DefaultXml"},
+    {664, "HistoryReadRequest_Encoding_DefaultBinary"},
+    {665, "HistoryReadResponse"},
+    {666, "HistoryReadResponse_Encoding_DefaultXml"},
+    {667, "HistoryReadResponse_Encoding_DefaultBinary"},
+    {668, "WriteValue"},
+    {669, "WriteValue_Encoding_DefaultXml"},
+    {670, "WriteValue_Encoding_DefaultBinary"},
+    {671, "WriteRequest"},
+    {672, "WriteRequest_Encoding_DefaultXml"},
+    {673, "WriteRequest_Encoding_DefaultBinary"},
+    {674, "WriteResponse"},
+    {675, "WriteResponse_Encoding_DefaultXml"},
+    {676, "WriteResponse_Encoding_DefaultBinary"},
+    {677, "HistoryUpdateDetails"},
+    {678, "HistoryUpdateDetails_Encoding_DefaultXml"},
+    {679, "HistoryUpdateDetails_Encoding_DefaultBinary"},
+    {680, "UpdateDataDetails"},
+    {681, "UpdateDataDetails_Encoding_DefaultXml"},
+    {682, "UpdateDataDetails_Encoding_DefaultBinary"},
+    {683, "UpdateEventDetails"},
+    {684, "UpdateEventDetails_Encoding_DefaultXml"},
+    {685, "UpdateEventDetails_Encoding_DefaultBinary"},
+    {686, "DeleteRawModifiedDetails"},
+    {687, "DeleteRawModifiedDetails_Encoding_DefaultXml"},
+    {688, "DeleteRawModifiedDetails_Encoding_DefaultBinary"},
+    {689, "DeleteAtTimeDetails"},
+    {690, "DeleteAtTimeDetails_Encoding_DefaultXml"},
+    {691, "DeleteAtTimeDetails_Encoding_DefaultBinary"},
+    {692, "DeleteEventDetails"},
+    {693, "DeleteEventDetails_Encoding_DefaultXml"},
+    {694, "DeleteEventDetails_Encoding_DefaultBinary"},
+    {695, "HistoryUpdateResult"},
+    {696, "HistoryUpdateResult_Encoding_DefaultXml"},
+    {697, "HistoryUpdateResult_Encoding_DefaultBinary"},
+    {698, "HistoryUpdateRequest"},
+    {699, "HistoryUpdateRequest_Encoding_DefaultXml"},
+    {700, "HistoryUpdateRequest_Encoding_DefaultBinary"},
+    {701, "HistoryUpdateResponse"},
+    {702, "HistoryUpdateResponse_Encoding_DefaultXml"},
+    {703, "HistoryUpdateResponse_Encoding_DefaultBinary"},
+    {704, "CallMethodRequest"},
+    {705, "CallMethodRequest_Encoding_DefaultXml"},
+    {706, "CallMethodRequest_Encoding_DefaultBinary"},
+    {707, "CallMethodResult"},
+    {708, "CallMethodResult_Encoding_DefaultXml"},
+    {709, "CallMethodResult_Encoding_DefaultBinary"},
+    {710, "CallRequest"},
+    {711, "CallRequest_Encoding_DefaultXml"},
+    {712, "CallRequest_Encoding_DefaultBinary"},
+    {713, "CallResponse"},
+    {714, "CallResponse_Encoding_DefaultXml"},
+    {715, "CallResponse_Encoding_DefaultBinary"},
+    {716, "MonitoringMode"},
+    {717, "DataChangeTrigger"},
+    {718, "DeadbandType"},
+    {719, "MonitoringFilter"},
+    {720, "MonitoringFilter_Encoding_DefaultXml"},
+    {721, "MonitoringFilter_Encoding_DefaultBinary"},
+    {722, "DataChangeFilter"},
+    {723, "DataChangeFilter_Encoding_DefaultXml"},
+    {724, "DataChangeFilter_Encoding_DefaultBinary"},
+    {725, "EventFilter"},
+    {726, "EventFilter_Encoding_DefaultXml"},
+    {727, "EventFilter_Encoding_DefaultBinary"},
+    {728, "AggregateFilter"},
+    {729, "AggregateFilter_Encoding_DefaultXml"},
+    {730, "AggregateFilter_Encoding_DefaultBinary"},
+    {731, "MonitoringFilterResult"},
+    {732, "MonitoringFilterResult_Encoding_DefaultXml"},
+    {733, "MonitoringFilterResult_Encoding_DefaultBinary"},
+    {734, "EventFilterResult"},
+    {735, "EventFilterResult_Encoding_DefaultXml"},
+    {736, "EventFilterResult_Encoding_DefaultBinary"},
+    {737, "AggregateFilterResult"},
+    {738, "AggregateFilterResult_Encoding_DefaultXml"},
+    {739, "AggregateFilterResult_Encoding_DefaultBinary"},
+    {740, "MonitoringParameters"},
+    {741, "MonitoringParameters_Encoding_DefaultXml"},
+    {742, "MonitoringParameters_Encoding_DefaultBinary"},
+    {743, "MonitoredItemCreateRequest"},
+    {744, "MonitoredItemCreateRequest_Encoding_DefaultXml"},
+    {745, "MonitoredItemCreateRequest_Encoding_DefaultBinary"},
+    {746, "MonitoredItemCreateResult"},
+    {747, "MonitoredItemCreateResult_Encoding_DefaultXml"},
+    {748, "MonitoredItemCreateResult_Encoding_DefaultBinary"},
+    {749, "CreateMonitoredItemsRequest"},
+    {750, "CreateMonitoredItemsRequest_Encoding_DefaultXml"},
+    {751, "CreateMonitoredItemsRequest_Encoding_DefaultBinary"},
+    {752, "CreateMonitoredItemsResponse"},
+    {753, "CreateMonitoredItemsResponse_Encoding_DefaultXml"},
+    {754, "CreateMonitoredItemsResponse_Encoding_DefaultBinary"},
+    {755, "MonitoredItemModifyRequest"},
+    {756, "MonitoredItemModifyRequest_Encoding_DefaultXml"},
+    {757, "MonitoredItemModifyRequest_Encoding_DefaultBinary"},
+    {758, "MonitoredItemModifyResult"},
+    {759, "MonitoredItemModifyResult_Encoding_DefaultXml"},
+    {760, "MonitoredItemModifyResult_Encoding_DefaultBinary"},
+    {761, "ModifyMonitoredItemsRequest"},
+    {762, "ModifyMonitoredItemsRequest_Encoding_DefaultXml"},
+    {763, "ModifyMonitoredItemsRequest_Encoding_DefaultBinary"},
+    {764, "ModifyMonitoredItemsResponse"},
+    {765, "ModifyMonitoredItemsResponse_Encoding_DefaultXml"},
+    {766, "ModifyMonitoredItemsResponse_Encoding_DefaultBinary"},
+    {767, "SetMonitoringModeRequest"},
+    {768, "SetMonitoringModeRequest_Encoding_DefaultXml"},
+    {769, "SetMonitoringModeRequest_Encoding_DefaultBinary"},
+    {770, "SetMonitoringModeResponse"},
+    {771, "SetMonitoringModeResponse_Encoding_DefaultXml"},
+    {772, "SetMonitoringModeResponse_Encoding_DefaultBinary"},
+    {773, "SetTriggeringRequest"},
+    {774, "SetTriggeringRequest_Encoding_DefaultXml"},
+    {775, "SetTriggeringRequest_Encoding_DefaultBinary"},
+    {776, "SetTriggeringResponse"},
+    {777, "SetTriggeringResponse_Encoding_DefaultXml"},
+    {778, "SetTriggeringResponse_Encoding_DefaultBinary"},
+    {779, "DeleteMonitoredItemsRequest"},
+    {780, "DeleteMonitoredItemsRequest_Encoding_DefaultXml"},
+    {781, "DeleteMonitoredItemsRequest_Encoding_DefaultBinary"},
+    {782, "DeleteMonitoredItemsResponse"},
+    {783, "DeleteMonitoredItemsResponse_Encoding_DefaultXml"},
+    {784, "DeleteMonitoredItemsResponse_Encoding_DefaultBinary"},
+    {785, "CreateSubscriptionRequest"},
+    {786, "CreateSubscriptionRequest_Encoding_DefaultXml"},
+    {787, "CreateSubscriptionRequest_Encoding_DefaultBinary"},
+    {788, "CreateSubscriptionResponse"},
+    {789, "CreateSubscriptionResponse_Encoding_DefaultXml"},
+    {790, "CreateSubscriptionResponse_Encoding_DefaultBinary"},
+    {791, "ModifySubscriptionRequest"},
+    {792, "ModifySubscriptionRequest_Encoding_DefaultXml"},
+    {793, "ModifySubscriptionRequest_Encoding_DefaultBinary"},
+    {794, "ModifySubscriptionResponse"},
+    {795, "ModifySubscriptionResponse_Encoding_DefaultXml"},
+    {796, "ModifySubscriptionResponse_Encoding_DefaultBinary"},
+    {797, "SetPublishingModeRequest"},
+    {798, "SetPublishingModeRequest_Encoding_DefaultXml"},
+    {799, "SetPublishingModeRequest_Encoding_DefaultBinary"},
+    {800, "SetPublishingModeResponse"},
+    {801, "SetPublishingModeResponse_Encoding_DefaultXml"},
+    {802, "SetPublishingModeResponse_Encoding_DefaultBinary"},
+    {803, "NotificationMessage"},
+    {804, "NotificationMessage_Encoding_DefaultXml"},
+    {805, "NotificationMessage_Encoding_DefaultBinary"},
+    {806, "MonitoredItemNotification"},
+    {807, "MonitoredItemNotification_Encoding_DefaultXml"},
+    {808, "MonitoredItemNotification_Encoding_DefaultBinary"},
+    {809, "DataChangeNotification"},
+    {810, "DataChangeNotification_Encoding_DefaultXml"},
+    {811, "DataChangeNotification_Encoding_DefaultBinary"},
+    {818, "StatusChangeNotification"},
+    {819, "StatusChangeNotification_Encoding_DefaultXml"},
+    {820, "StatusChangeNotification_Encoding_DefaultBinary"},
+    {821, "SubscriptionAcknowledgement"},
+    {822, "SubscriptionAcknowledgement_Encoding_DefaultXml"},
+    {823, "SubscriptionAcknowledgement_Encoding_DefaultBinary"},
+    {824, "PublishRequest"},
+    {825, "PublishRequest_Encoding_DefaultXml"},
+    {826, "PublishRequest_Encoding_DefaultBinary"},
+    {827, "PublishResponse"},
+    {828, "PublishResponse_Encoding_DefaultXml"},
+    {829, "PublishResponse_Encoding_DefaultBinary"},
+    {830, "RepublishRequest"},
+    {831, "RepublishRequest_Encoding_DefaultXml"},
+    {832, "RepublishRequest_Encoding_DefaultBinary"},
+    {833, "RepublishResponse"},
+    {834, "RepublishResponse_Encoding_DefaultXml"},
+    {835, "RepublishResponse_Encoding_DefaultBinary"},
+    {836, "TransferResult"},
+    {837, "TransferResult_Encoding_DefaultXml"},
+    {838, "TransferResult_Encoding_DefaultBinary"},
+    {839, "TransferSubscriptionsRequest"},
+    {840, "TransferSubscriptionsRequest_Encoding_DefaultXml"},
+    {841, "TransferSubscriptionsRequest_Encoding_DefaultBinary"},
+    {842, "TransferSubscriptionsResponse"},
+    {843, "TransferSubscriptionsResponse_Encoding_DefaultXml"},
+    {844, "TransferSubscriptionsResponse_Encoding_DefaultBinary"},
+    {845, "DeleteSubscriptionsRequest"},
+    {846, "DeleteSubscriptionsRequest_Encoding_DefaultXml"},
+    {847, "DeleteSubscriptionsRequest_Encoding_DefaultBinary"},
+    {848, "DeleteSubscriptionsResponse"},
+    {849, "DeleteSubscriptionsResponse_Encoding_DefaultXml"},
+    {850, "DeleteSubscriptionsResponse_Encoding_DefaultBinary"},
+    {851, "RedundancySupport"},
+    {852, "ServerState"},
+    {853, "RedundantServerDataType"},
+    {854, "RedundantServerDataType_Encoding_DefaultXml"},
+    {855, "RedundantServerDataType_Encoding_DefaultBinary"},
+    {856, "SamplingIntervalDiagnosticsDataType"},
+    {857, "SamplingIntervalDiagnosticsDataType_Encoding_DefaultXml"},
+    {858, "SamplingIntervalDiagnosticsDataType_Encoding_DefaultBinary"},
+    {859, "ServerDiagnosticsSummaryDataType"},
+    {860, "ServerDiagnosticsSummaryDataType_Encoding_DefaultXml"},
+    {861, "ServerDiagnosticsSummaryDataType_Encoding_DefaultBinary"},
+    {862, "ServerStatusDataType"},
+    {863, "ServerStatusDataType_Encoding_DefaultXml"},
+    {864, "ServerStatusDataType_Encoding_DefaultBinary"},
+    {865, "SessionDiagnosticsDataType"},
+    {866, "SessionDiagnosticsDataType_Encoding_DefaultXml"},
+    {867, "SessionDiagnosticsDataType_Encoding_DefaultBinary"},
+    {868, "SessionSecurityDiagnosticsDataType"},
+    {869, "SessionSecurityDiagnosticsDataType_Encoding_DefaultXml"},
+    {870, "SessionSecurityDiagnosticsDataType_Encoding_DefaultBinary"},
+    {871, "ServiceCounterDataType"},
+    {872, "ServiceCounterDataType_Encoding_DefaultXml"},
+    {873, "ServiceCounterDataType_Encoding_DefaultBinary"},
+    {874, "SubscriptionDiagnosticsDataType"},
+    {875, "SubscriptionDiagnosticsDataType_Encoding_DefaultXml"},
+    {876, "SubscriptionDiagnosticsDataType_Encoding_DefaultBinary"},
+    {877, "ModelChangeStructureDataType"},
+    {878, "ModelChangeStructureDataType_Encoding_DefaultXml"},
+    {879, "ModelChangeStructureDataType_Encoding_DefaultBinary"},
+    {884, "Range"},
+    {885, "Range_Encoding_DefaultXml"},
+    {886, "Range_Encoding_DefaultBinary"},
+    {887, "EUInformation"},
+    {888, "EUInformation_Encoding_DefaultXml"},
+    {889, "EUInformation_Encoding_DefaultBinary"},
+    {890, "ExceptionDeviationFormat"},
+    {891, "Annotation"},
+    {892, "Annotation_Encoding_DefaultXml"},
+    {893, "Annotation_Encoding_DefaultBinary"},
+    {894, "ProgramDiagnosticDataType"},
+    {895, "ProgramDiagnosticDataType_Encoding_DefaultXml"},
+    {896, "ProgramDiagnosticDataType_Encoding_DefaultBinary"},
+    {897, "SemanticChangeStructureDataType"},
+    {898, "SemanticChangeStructureDataType_Encoding_DefaultXml"},
+    {899, "SemanticChangeStructureDataType_Encoding_DefaultBinary"},
+    {914, "EventNotificationList"},
+    {915, "EventNotificationList_Encoding_DefaultXml"},
+    {916, "EventNotificationList_Encoding_DefaultBinary"},
+    {917, "EventFieldList"},
+    {918, "EventFieldList_Encoding_DefaultXml"},
+    {919, "EventFieldList_Encoding_DefaultBinary"},
+    {920, "HistoryEventFieldList"},
+    {921, "HistoryEventFieldList_Encoding_DefaultXml"},
+    {922, "HistoryEventFieldList_Encoding_DefaultBinary"},
+    {938, "IssuedIdentityToken"},
+    {939, "IssuedIdentityToken_Encoding_DefaultXml"},
+    {940, "IssuedIdentityToken_Encoding_DefaultBinary"},
+    {945, "NotificationData"},
+    {946, "NotificationData_Encoding_DefaultXml"},
+    {947, "NotificationData_Encoding_DefaultBinary"},
+    {948, "AggregateConfiguration"},
+    {949, "AggregateConfiguration_Encoding_DefaultXml"},
+    {950, "AggregateConfiguration_Encoding_DefaultBinary"},
+    {2000, "ImageBMP"},
+    {2001, "ImageGIF"},
+    {2002, "ImageJPG"},
+    {2003, "ImagePNG"},
+    {2004, "ServerType"},
+    {2005, "ServerType_ServerArray"},
+    {2006, "ServerType_NamespaceArray"},
+    {2007, "ServerType_ServerStatus"},
+    {2008, "ServerType_ServiceLevel"},
+    {2009, "ServerType_ServerCapabilities"},
+    {2010, "ServerType_ServerDiagnostics"},
+    {2011, "ServerType_VendorServerInfo"},
+    {2012, "ServerType_ServerRedundancy"},
+    {2013, "ServerCapabilitiesType"},
+    {2014, "ServerCapabilitiesType_ServerProfileArray"},
+    {2016, "ServerCapabilitiesType_LocaleIdArray"},
+    {2017, "ServerCapabilitiesType_MinSupportedSampleRate"},
+    {2019, "ServerCapabilitiesType_ModellingRules"},
+    {2020, "ServerDiagnosticsType"},
+    {2021, "ServerDiagnosticsType_ServerDiagnosticsSummary"},
+    {2022, "ServerDiagnosticsType_SamplingIntervalDiagnosticsArray"},
+    {2023, "ServerDiagnosticsType_SubscriptionDiagnosticsArray"},
+    {2025, "ServerDiagnosticsType_EnabledFlag"},
+    {2026, "SessionsDiagnosticsSummaryType"},
+    {2027, "SessionsDiagnosticsSummaryType_SessionDiagnosticsArray"},
+    {2028, "SessionsDiagnosticsSummaryType_SessionSecurityDiagnosticsArray"},
+    {2029, "SessionDiagnosticsObjectType"},
+    {2030, "SessionDiagnosticsObjectType_SessionDiagnostics"},
+    {2031, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics"},
+    {2032, "SessionDiagnosticsObjectType_SubscriptionDiagnosticsArray"},
+    {2033, "VendorServerInfoType"},
+    {2034, "ServerRedundancyType"},
+    {2035, "ServerRedundancyType_RedundancySupport"},
+    {2036, "TransparentRedundancyType"},
+    {2037, "TransparentRedundancyType_CurrentServerId"},
+    {2038, "TransparentRedundancyType_RedundantServerArray"},
+    {2039, "NonTransparentRedundancyType"},
+    {2040, "NonTransparentRedundancyType_ServerUriArray"},
+    {2041, "BaseEventType"},
+    {2042, "BaseEventType_EventId"},
+    {2043, "BaseEventType_EventType"},
+    {2044, "BaseEventType_SourceNode"},
+    {2045, "BaseEventType_SourceName"},
+    {2046, "BaseEventType_Time"},
+    {2047, "BaseEventType_ReceiveTime"},
+    {2050, "BaseEventType_Message"},
+    {2051, "BaseEventType_Severity"},
+    {2052, "AuditEventType"},
+    {2053, "AuditEventType_ActionTimeStamp"},
+    {2054, "AuditEventType_Status"},
+    {2055, "AuditEventType_ServerId"},
+    {2056, "AuditEventType_ClientAuditEntryId"},
+    {2057, "AuditEventType_ClientUserId"},
+    {2058, "AuditSecurityEventType"},
+    {2059, "AuditChannelEventType"},
+    {2060, "AuditOpenSecureChannelEventType"},
+    {2061, "AuditOpenSecureChannelEventType_ClientCertificate"},
+    {2062, "AuditOpenSecureChannelEventType_RequestType"},
+    {2063, "AuditOpenSecureChannelEventType_SecurityPolicyUri"},
+    {2065, "AuditOpenSecureChannelEventType_SecurityMode"},
+    {2066, "AuditOpenSecureChannelEventType_RequestedLifetime"},
+    {2069, "AuditSessionEventType"},
+    {2070, "AuditSessionEventType_SessionId"},
+    {2071, "AuditCreateSessionEventType"},
+    {2072, "AuditCreateSessionEventType_SecureChannelId"},
+    {2073, "AuditCreateSessionEventType_ClientCertificate"},
+    {2074, "AuditCreateSessionEventType_RevisedSessionTimeout"},
+    {2075, "AuditActivateSessionEventType"},
+    {2076, "AuditActivateSessionEventType_ClientSoftwareCertificates"},
+    {2077, "AuditActivateSessionEventType_UserIdentityToken"},
+    {2078, "AuditCancelEventType"},
+    {2079, "AuditCancelEventType_RequestHandle"},
+    {2080, "AuditCertificateEventType"},
+    {2081, "AuditCertificateEventType_Certificate"},
+    {2082, "AuditCertificateDataMismatchEventType"},
+    {2083, "AuditCertificateDataMismatchEventType_InvalidHostname"},
+    {2084, "AuditCertificateDataMismatchEventType_InvalidUri"},
+    {2085, "AuditCertificateExpiredEventType"},
+    {2086, "AuditCertificateInvalidEventType"},
+    {2087, "AuditCertificateUntrustedEventType"},
+    {2088, "AuditCertificateRevokedEventType"},
+    {2089, "AuditCertificateMismatchEventType"},
+    {2090, "AuditNodeManagementEventType"},
+    {2091, "AuditAddNodesEventType"},
+    {2092, "AuditAddNodesEventType_NodesToAdd"},
+    {2093, "AuditDeleteNodesEventType"},
+    {2094, "AuditDeleteNodesEventType_NodesToDelete"},
+    {2095, "AuditAddReferencesEventType"},
+    {2096, "AuditAddReferencesEventType_ReferencesToAdd"},
+    {2097, "AuditDeleteReferencesEventType"},
+    {2098, "AuditDeleteReferencesEventType_ReferencesToDelete"},
+    {2099, "AuditUpdateEventType"},
+    {2100, "AuditWriteUpdateEventType"},
+    {2101, "AuditWriteUpdateEventType_IndexRange"},
+    {2102, "AuditWriteUpdateEventType_OldValue"},
+    {2103, "AuditWriteUpdateEventType_NewValue"},
+    {2104, "AuditHistoryUpdateEventType"},
+    {2127, "AuditUpdateMethodEventType"},
+    {2128, "AuditUpdateMethodEventType_MethodId"},
+    {2129, "AuditUpdateMethodEventType_InputArguments"},
+    {2130, "SystemEventType"},
+    {2131, "DeviceFailureEventType"},
+    {2132, "BaseModelChangeEventType"},
+    {2133, "GeneralModelChangeEventType"},
+    {2134, "GeneralModelChangeEventType_Changes"},
+    {2137, "ServerVendorCapabilityType"},
+    {2138, "ServerStatusType"},
+    {2139, "ServerStatusType_StartTime"},
+    {2140, "ServerStatusType_CurrentTime"},
+    {2141, "ServerStatusType_State"},
+    {2142, "ServerStatusType_BuildInfo"},
+    {2150, "ServerDiagnosticsSummaryType"},
+    {2151, "ServerDiagnosticsSummaryType_ServerViewCount"},
+    {2152, "ServerDiagnosticsSummaryType_CurrentSessionCount"},
+    {2153, "ServerDiagnosticsSummaryType_CumulatedSessionCount"},
+    {2154, "ServerDiagnosticsSummaryType_SecurityRejectedSessionCount"},
+    {2155, "ServerDiagnosticsSummaryType_RejectedSessionCount"},
+    {2156, "ServerDiagnosticsSummaryType_SessionTimeoutCount"},
+    {2157, "ServerDiagnosticsSummaryType_SessionAbortCount"},
+    {2159, "ServerDiagnosticsSummaryType_PublishingIntervalCount"},
+    {2160, "ServerDiagnosticsSummaryType_CurrentSubscriptionCount"},
+    {2161, "ServerDiagnosticsSummaryType_CumulatedSubscriptionCount"},
+    {2162, "ServerDiagnosticsSummaryType_SecurityRejectedRequestsCount"},
+    {2163, "ServerDiagnosticsSummaryType_RejectedRequestsCount"},
+    {2164, "SamplingIntervalDiagnosticsArrayType"},
+    {2165, "SamplingIntervalDiagnosticsType"},
+    {2166, "SamplingIntervalDiagnosticsType_SamplingInterval"},
+    {2171, "SubscriptionDiagnosticsArrayType"},
+    {2172, "SubscriptionDiagnosticsType"},
+    {2173, "SubscriptionDiagnosticsType_SessionId"},
+    {2174, "SubscriptionDiagnosticsType_SubscriptionId"},
+    {2175, "SubscriptionDiagnosticsType_Priority"},
+    {2176, "SubscriptionDiagnosticsType_PublishingInterval"},
+    {2177, "SubscriptionDiagnosticsType_MaxKeepAliveCount"},
+    {2179, "SubscriptionDiagnosticsType_MaxNotificationsPerPublish"},
+    {2180, "SubscriptionDiagnosticsType_PublishingEnabled"},
+    {2181, "SubscriptionDiagnosticsType_ModifyCount"},
+    {2182, "SubscriptionDiagnosticsType_EnableCount"},
+    {2183, "SubscriptionDiagnosticsType_DisableCount"},
+    {2184, "SubscriptionDiagnosticsType_RepublishRequestCount"},
+    {2185, "SubscriptionDiagnosticsType_RepublishMessageRequestCount"},
+    {2186, "SubscriptionDiagnosticsType_RepublishMessageCount"},
+    {2187, "SubscriptionDiagnosticsType_TransferRequestCount"},
+    {2188, "SubscriptionDiagnosticsType_TransferredToAltClientCount"},
+    {2189, "SubscriptionDiagnosticsType_TransferredToSameClientCount"},
+    {2190, "SubscriptionDiagnosticsType_PublishRequestCount"},
+    {2191, "SubscriptionDiagnosticsType_DataChangeNotificationsCount"},
+    {2193, "SubscriptionDiagnosticsType_NotificationsCount"},
+    {2196, "SessionDiagnosticsArrayType"},
+    {2197, "SessionDiagnosticsVariableType"},
+    {2198, "SessionDiagnosticsVariableType_SessionId"},
+    {2199, "SessionDiagnosticsVariableType_SessionName"},
+    {2200, "SessionDiagnosticsVariableType_ClientDescription"},
+    {2201, "SessionDiagnosticsVariableType_ServerUri"},
+    {2202, "SessionDiagnosticsVariableType_EndpointUrl"},
+    {2203, "SessionDiagnosticsVariableType_LocaleIds"},
+    {2204, "SessionDiagnosticsVariableType_ActualSessionTimeout"},
+    {2205, "SessionDiagnosticsVariableType_ClientConnectionTime"},
+    {2206, "SessionDiagnosticsVariableType_ClientLastContactTime"},
+    {2207, "SessionDiagnosticsVariableType_CurrentSubscriptionsCount"},
+    {2208, "SessionDiagnosticsVariableType_CurrentMonitoredItemsCount"},
+    {2209, "SessionDiagnosticsVariableType_CurrentPublishRequestsInQueue"},
+    {2217, "SessionDiagnosticsVariableType_ReadCount"},
+    {2218, "SessionDiagnosticsVariableType_HistoryReadCount"},
+    {2219, "SessionDiagnosticsVariableType_WriteCount"},
+    {2220, "SessionDiagnosticsVariableType_HistoryUpdateCount"},
+    {2221, "SessionDiagnosticsVariableType_CallCount"},
+    {2222, "SessionDiagnosticsVariableType_CreateMonitoredItemsCount"},
+    {2223, "SessionDiagnosticsVariableType_ModifyMonitoredItemsCount"},
+    {2224, "SessionDiagnosticsVariableType_SetMonitoringModeCount"},
+    {2225, "SessionDiagnosticsVariableType_SetTriggeringCount"},
+    {2226, "SessionDiagnosticsVariableType_DeleteMonitoredItemsCount"},
+    {2227, "SessionDiagnosticsVariableType_CreateSubscriptionCount"},
+    {2228, "SessionDiagnosticsVariableType_ModifySubscriptionCount"},
+    {2229, "SessionDiagnosticsVariableType_SetPublishingModeCount"},
+    {2230, "SessionDiagnosticsVariableType_PublishCount"},
+    {2231, "SessionDiagnosticsVariableType_RepublishCount"},
+    {2232, "SessionDiagnosticsVariableType_TransferSubscriptionsCount"},
+    {2233, "SessionDiagnosticsVariableType_DeleteSubscriptionsCount"},
+    {2234, "SessionDiagnosticsVariableType_AddNodesCount"},
+    {2235, "SessionDiagnosticsVariableType_AddReferencesCount"},
+    {2236, "SessionDiagnosticsVariableType_DeleteNodesCount"},
+    {2237, "SessionDiagnosticsVariableType_DeleteReferencesCount"},
+    {2238, "SessionDiagnosticsVariableType_BrowseCount"},
+    {2239, "SessionDiagnosticsVariableType_BrowseNextCount"},
+    {2240, "SessionDiagnosticsVariableType_TranslateBrowsePathsToNodeIdsCount"},
+    {2241, "SessionDiagnosticsVariableType_QueryFirstCount"},
+    {2242, "SessionDiagnosticsVariableType_QueryNextCount"},
+    {2243, "SessionSecurityDiagnosticsArrayType"},
+    {2244, "SessionSecurityDiagnosticsType"},
+    {2245, "SessionSecurityDiagnosticsType_SessionId"},
+    {2246, "SessionSecurityDiagnosticsType_ClientUserIdOfSession"},
+    {2247, "SessionSecurityDiagnosticsType_ClientUserIdHistory"},
+    {2248, "SessionSecurityDiagnosticsType_AuthenticationMechanism"},
+    {2249, "SessionSecurityDiagnosticsType_Encoding"},
+    {2250, "SessionSecurityDiagnosticsType_TransportProtocol"},
+    {2251, "SessionSecurityDiagnosticsType_SecurityMode"},
+    {2252, "SessionSecurityDiagnosticsType_SecurityPolicyUri"},
+    {2253, "Server"},
+    {2254, "Server_ServerArray"},
+    {2255, "Server_NamespaceArray"},
+    {2256, "Server_ServerStatus"},
+    {2257, "Server_ServerStatus_StartTime"},
+    {2258, "Server_ServerStatus_CurrentTime"},
+    {2259, "Server_ServerStatus_State"},
+    {2260, "Server_ServerStatus_BuildInfo"},
+    {2261, "Server_ServerStatus_BuildInfo_ProductName"},
+    {2262, "Server_ServerStatus_BuildInfo_ProductUri"},
+    {2263, "Server_ServerStatus_BuildInfo_ManufacturerName"},
+    {2264, "Server_ServerStatus_BuildInfo_SoftwareVersion"},
+    {2265, "Server_ServerStatus_BuildInfo_BuildNumber"},
+    {2266, "Server_ServerStatus_BuildInfo_BuildDate"},
+    {2267, "Server_ServiceLevel"},
+    {2268, "Server_ServerCapabilities"},
+    {2269, "Server_ServerCapabilities_ServerProfileArray"},
+    {2271, "Server_ServerCapabilities_LocaleIdArray"},
+    {2272, "Server_ServerCapabilities_MinSupportedSampleRate"},
+    {2274, "Server_ServerDiagnostics"},
+    {2275, "Server_ServerDiagnostics_ServerDiagnosticsSummary"},
+    {2276, "Server_ServerDiagnostics_ServerDiagnosticsSummary_ServerViewCount"},
+    {2277, "Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount"},
+    {2278, "Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount"},
+    {2279, "Server_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedSessionCount"},
+    {2281, "Server_ServerDiagnostics_ServerDiagnosticsSummary_SessionTimeoutCount"},
+    {2282, "Server_ServerDiagnostics_ServerDiagnosticsSummary_SessionAbortCount"},
+    {2284, "Server_ServerDiagnostics_ServerDiagnosticsSummary_PublishingIntervalCount"},
+    {2285, "Server_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount"},
+    {2286, "Server_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount"},
+    {2287, "Server_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedRequestsCount"},
+    {2288, "Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount"},
+    {2289, "Server_ServerDiagnostics_SamplingIntervalDiagnosticsArray"},
+    {2290, "Server_ServerDiagnostics_SubscriptionDiagnosticsArray"},
+    {2294, "Server_ServerDiagnostics_EnabledFlag"},
+    {2295, "Server_VendorServerInfo"},
+    {2296, "Server_ServerRedundancy"},
+    {2299, "StateMachineType"},
+    {2307, "StateType"},
+    {2308, "StateType_StateNumber"},
+    {2309, "InitialStateType"},
+    {2310, "TransitionType"},
+    {2311, "TransitionEventType"},
+    {2312, "TransitionType_TransitionNumber"},
+    {2315, "AuditUpdateStateEventType"},
+    {2318, "HistoricalDataConfigurationType"},
+    {2323, "HistoricalDataConfigurationType_Stepped"},
+    {2324, "HistoricalDataConfigurationType_Definition"},
+    {2325, "HistoricalDataConfigurationType_MaxTimeInterval"},
+    {2326, "HistoricalDataConfigurationType_MinTimeInterval"},
+    {2327, "HistoricalDataConfigurationType_ExceptionDeviation"},
+    {2328, "HistoricalDataConfigurationType_ExceptionDeviationFormat"},
+    {2330, "HistoryServerCapabilitiesType"},
+    {2331, "HistoryServerCapabilitiesType_AccessHistoryDataCapability"},
+    {2332, "HistoryServerCapabilitiesType_AccessHistoryEventsCapability"},
+    {2334, "HistoryServerCapabilitiesType_InsertDataCapability"},
+    {2335, "HistoryServerCapabilitiesType_ReplaceDataCapability"},
+    {2336, "HistoryServerCapabilitiesType_UpdateDataCapability"},
+    {2337, "HistoryServerCapabilitiesType_DeleteRawCapability"},
+    {2338, "HistoryServerCapabilitiesType_DeleteAtTimeCapability"},
+    {2340, "AggregateFunctionType"},
+    {2341, "AggregateFunction_Interpolative"},
+    {2342, "AggregateFunction_Average"},
+    {2343, "AggregateFunction_TimeAverage"},
+    {2344, "AggregateFunction_Total"},
+    {2346, "AggregateFunction_Minimum"},
+    {2347, "AggregateFunction_Maximum"},
+    {2348, "AggregateFunction_MinimumActualTime"},
+    {2349, "AggregateFunction_MaximumActualTime"},
+    {2350, "AggregateFunction_Range"},
+    {2351, "AggregateFunction_AnnotationCount"},
+    {2352, "AggregateFunction_Count"},
+    {2355, "AggregateFunction_NumberOfTransitions"},
+    {2357, "AggregateFunction_Start"},
+    {2358, "AggregateFunction_End"},
+    {2359, "AggregateFunction_Delta"},
+    {2360, "AggregateFunction_DurationGood"},
+    {2361, "AggregateFunction_DurationBad"},
+    {2362, "AggregateFunction_PercentGood"},
+    {2363, "AggregateFunction_PercentBad"},
+    {2364, "AggregateFunction_WorstQuality"},
+    {2365, "DataItemType"},
+    {2366, "DataItemType_Definition"},
+    {2367, "DataItemType_ValuePrecision"},
+    {2368, "AnalogItemType"},
+    {2369, "AnalogItemType_EURange"},
+    {2370, "AnalogItemType_InstrumentRange"},
+    {2371, "AnalogItemType_EngineeringUnits"},
+    {2372, "DiscreteItemType"},
+    {2373, "TwoStateDiscreteType"},
+    {2374, "TwoStateDiscreteType_FalseState"},
+    {2375, "TwoStateDiscreteType_TrueState"},
+    {2376, "MultiStateDiscreteType"},
+    {2377, "MultiStateDiscreteType_EnumStrings"},
+    {2378, "ProgramTransitionEventType"},
+    {2379, "ProgramTransitionEventType_IntermediateResult"},
+    {2380, "ProgramDiagnosticType"},
+    {2381, "ProgramDiagnosticType_CreateSessionId"},
+    {2382, "ProgramDiagnosticType_CreateClientName"},
+    {2383, "ProgramDiagnosticType_InvocationCreationTime"},
+    {2384, "ProgramDiagnosticType_LastTransitionTime"},
+    {2385, "ProgramDiagnosticType_LastMethodCall"},
+    {2386, "ProgramDiagnosticType_LastMethodSessionId"},
+    {2387, "ProgramDiagnosticType_LastMethodInputArguments"},
+    {2388, "ProgramDiagnosticType_LastMethodOutputArguments"},
+    {2389, "ProgramDiagnosticType_LastMethodCallTime"},
+    {2390, "ProgramDiagnosticType_LastMethodReturnStatus"},
+    {2391, "ProgramStateMachineType"},
+    {2392, "ProgramStateMachineType_Creatable"},
+    {2393, "ProgramStateMachineType_Deletable"},
+    {2394, "ProgramStateMachineType_AutoDelete"},
+    {2395, "ProgramStateMachineType_RecycleCount"},
+    {2396, "ProgramStateMachineType_InstanceCount"},
+    {2397, "ProgramStateMachineType_MaxInstanceCount"},
+    {2398, "ProgramStateMachineType_MaxRecycleCount"},
+    {2399, "ProgramStateMachineType_ProgramDiagnostics"},
+    {2400, "ProgramStateMachineType_Ready"},
+    {2401, "ProgramStateMachineType_Ready_StateNumber"},
+    {2402, "ProgramStateMachineType_Running"},
+    {2403, "ProgramStateMachineType_Running_StateNumber"},
+    {2404, "ProgramStateMachineType_Suspended"},
+    {2405, "ProgramStateMachineType_Suspended_StateNumber"},
+    {2406, "ProgramStateMachineType_Halted"},
+    {2407, "ProgramStateMachineType_Halted_StateNumber"},
+    {2408, "ProgramStateMachineType_HaltedToReady"},
+    {2409, "ProgramStateMachineType_HaltedToReady_TransitionNumber"},
+    {2410, "ProgramStateMachineType_ReadyToRunning"},
+    {2411, "ProgramStateMachineType_ReadyToRunning_TransitionNumber"},
+    {2412, "ProgramStateMachineType_RunningToHalted"},
+    {2413, "ProgramStateMachineType_RunningToHalted_TransitionNumber"},
+    {2414, "ProgramStateMachineType_RunningToReady"},
+    {2415, "ProgramStateMachineType_RunningToReady_TransitionNumber"},
+    {2416, "ProgramStateMachineType_RunningToSuspended"},
+    {2417, "ProgramStateMachineType_RunningToSuspended_TransitionNumber"},
+    {2418, "ProgramStateMachineType_SuspendedToRunning"},
+    {2419, "ProgramStateMachineType_SuspendedToRunning_TransitionNumber"},
+    {2420, "ProgramStateMachineType_SuspendedToHalted"},
+    {2421, "ProgramStateMachineType_SuspendedToHalted_TransitionNumber"},
+    {2422, "ProgramStateMachineType_SuspendedToReady"},
+    {2423, "ProgramStateMachineType_SuspendedToReady_TransitionNumber"},
+    {2424, "ProgramStateMachineType_ReadyToHalted"},
+    {2425, "ProgramStateMachineType_ReadyToHalted_TransitionNumber"},
+    {2426, "ProgramStateMachineType_Start"},
+    {2427, "ProgramStateMachineType_Suspend"},
+    {2428, "ProgramStateMachineType_Resume"},
+    {2429, "ProgramStateMachineType_Halt"},
+    {2430, "ProgramStateMachineType_Reset"},
+    {2730, "SessionDiagnosticsVariableType_RegisterNodesCount"},
+    {2731, "SessionDiagnosticsVariableType_UnregisterNodesCount"},
+    {2732, "ServerCapabilitiesType_MaxBrowseContinuationPoints"},
+    {2733, "ServerCapabilitiesType_MaxQueryContinuationPoints"},
+    {2734, "ServerCapabilitiesType_MaxHistoryContinuationPoints"},
+    {2735, "Server_ServerCapabilities_MaxBrowseContinuationPoints"},
+    {2736, "Server_ServerCapabilities_MaxQueryContinuationPoints"},
+    {2737, "Server_ServerCapabilities_MaxHistoryContinuationPoints"},
+    {2738, "SemanticChangeEventType"},
+    {2739, "SemanticChangeEventType_Changes"},
+    {2742, "ServerType_Auditing"},
+    {2744, "ServerDiagnosticsType_SessionsDiagnosticsSummary"},
+    {2745, "AuditChannelEventType_SecureChannelId"},
+    {2746, "AuditOpenSecureChannelEventType_ClientCertificateThumbprint"},
+    {2747, "AuditCreateSessionEventType_ClientCertificateThumbprint"},
+    {2748, "AuditUrlMismatchEventType"},
+    {2749, "AuditUrlMismatchEventType_EndpointUrl"},
+    {2750, "AuditWriteUpdateEventType_AttributeId"},
+    {2751, "AuditHistoryUpdateEventType_ParameterDataTypeId"},
+    {2752, "ServerStatusType_SecondsTillShutdown"},
+    {2753, "ServerStatusType_ShutdownReason"},
+    {2754, "ServerCapabilitiesType_AggregateFunctions"},
+    {2755, "StateVariableType"},
+    {2756, "StateVariableType_Id"},
+    {2757, "StateVariableType_Name"},
+    {2758, "StateVariableType_Number"},
+    {2759, "StateVariableType_EffectiveDisplayName"},
+    {2760, "FiniteStateVariableType"},
+    {2761, "FiniteStateVariableType_Id"},
+    {2762, "TransitionVariableType"},
+    {2763, "TransitionVariableType_Id"},
+    {2764, "TransitionVariableType_Name"},
+    {2765, "TransitionVariableType_Number"},
+    {2766, "TransitionVariableType_TransitionTime"},
+    {2767, "FiniteTransitionVariableType"},
+    {2768, "FiniteTransitionVariableType_Id"},
+    {2769, "StateMachineType_CurrentState"},
+    {2770, "StateMachineType_LastTransition"},
+    {2771, "FiniteStateMachineType"},
+    {2772, "FiniteStateMachineType_CurrentState"},
+    {2773, "FiniteStateMachineType_LastTransition"},
+    {2774, "TransitionEventType_Transition"},
+    {2775, "TransitionEventType_FromState"},
+    {2776, "TransitionEventType_ToState"},
+    {2777, "AuditUpdateStateEventType_OldStateId"},
+    {2778, "AuditUpdateStateEventType_NewStateId"},
+    {2782, "ConditionType"},
+    {2787, "RefreshStartEventType"},
+    {2788, "RefreshEndEventType"},
+    {2789, "RefreshRequiredEventType"},
+    {2790, "AuditConditionEventType"},
+    {2803, "AuditConditionEnableEventType"},
+    {2829, "AuditConditionCommentEventType"},
+    {2830, "DialogConditionType"},
+    {2831, "DialogConditionType_Prompt"},
+    {2881, "AcknowledgeableConditionType"},
+    {2915, "AlarmConditionType"},
+    {2929, "ShelvedStateMachineType"},
+    {2930, "ShelvedStateMachineType_Unshelved"},
+    {2932, "ShelvedStateMachineType_TimedShelved"},
+    {2933, "ShelvedStateMachineType_OneShotShelved"},
+    {2935, "ShelvedStateMachineType_UnshelvedToTimedShelved"},
+    {2936, "ShelvedStateMachineType_UnshelvedToOneShotShelved"},
+    {2940, "ShelvedStateMachineType_TimedShelvedToUnshelved"},
+    {2942, "ShelvedStateMachineType_TimedShelvedToOneShotShelved"},
+    {2943, "ShelvedStateMachineType_OneShotShelvedToUnshelved"},
+    {2945, "ShelvedStateMachineType_OneShotShelvedToTimedShelved"},
+    {2947, "ShelvedStateMachineType_Unshelve"},
+    {2948, "ShelvedStateMachineType_OneShotShelve"},
+    {2949, "ShelvedStateMachineType_TimedShelve"},
+    {2955, "LimitAlarmType"},
+    {2991, "ShelvedStateMachineType_TimedShelve_InputArguments"},
+    {2992, "Server_ServerStatus_SecondsTillShutdown"},
+    {2993, "Server_ServerStatus_ShutdownReason"},
+    {2994, "Server_Auditing"},
+    {2996, "Server_ServerCapabilities_ModellingRules"},
+    {2997, "Server_ServerCapabilities_AggregateFunctions"},
+    {2998, "SubscriptionDiagnosticsType_EventNotificationsCount"},
+    {2999, "AuditHistoryEventUpdateEventType"},
+    {3003, "AuditHistoryEventUpdateEventType_Filter"},
+    {3006, "AuditHistoryValueUpdateEventType"},
+    {3012, "AuditHistoryDeleteEventType"},
+    {3014, "AuditHistoryRawModifyDeleteEventType"},
+    {3015, "AuditHistoryRawModifyDeleteEventType_IsDeleteModified"},
+    {3016, "AuditHistoryRawModifyDeleteEventType_StartTime"},
+    {3017, "AuditHistoryRawModifyDeleteEventType_EndTime"},
+    {3019, "AuditHistoryAtTimeDeleteEventType"},
+    {3020, "AuditHistoryAtTimeDeleteEventType_ReqTimes"},
+    {3021, "AuditHistoryAtTimeDeleteEventType_OldValues"},
+    {3022, "AuditHistoryEventDeleteEventType"},
+    {3023, "AuditHistoryEventDeleteEventType_EventIds"},
+    {3024, "AuditHistoryEventDeleteEventType_OldValues"},
+    {3025, "AuditHistoryEventUpdateEventType_UpdatedNode"},
+    {3026, "AuditHistoryValueUpdateEventType_UpdatedNode"},
+    {3027, "AuditHistoryDeleteEventType_UpdatedNode"},
+    {3028, "AuditHistoryEventUpdateEventType_PerformInsertReplace"},
+    {3029, "AuditHistoryEventUpdateEventType_NewValues"},
+    {3030, "AuditHistoryEventUpdateEventType_OldValues"},
+    {3031, "AuditHistoryValueUpdateEventType_PerformInsertReplace"},
+    {3032, "AuditHistoryValueUpdateEventType_NewValues"},
+    {3033, "AuditHistoryValueUpdateEventType_OldValues"},
+    {3034, "AuditHistoryRawModifyDeleteEventType_OldValues"},
+    {3035, "EventQueueOverflowEventType"},
+    {3048, "EventTypesFolder"},
+    {3049, "ServerCapabilitiesType_SoftwareCertificates"},
+    {3050, "SessionDiagnosticsVariableType_MaxResponseMessageSize"},
+    {3051, "BuildInfoType"},
+    {3052, "BuildInfoType_ProductUri"},
+    {3053, "BuildInfoType_ManufacturerName"},
+    {3054, "BuildInfoType_ProductName"},
+    {3055, "BuildInfoType_SoftwareVersion"},
+    {3056, "BuildInfoType_BuildNumber"},
+    {3057, "BuildInfoType_BuildDate"},
+    {3058, "SessionSecurityDiagnosticsType_ClientCertificate"},
+    {3059, "HistoricalDataConfigurationType_AggregateConfiguration"},
+    {3062, "DefaultBinary"},
+    {3063, "DefaultXml"},
+    {3065, "AlwaysGeneratesEvent"},
+    {3067, "Icon"},
+    {3068, "NodeVersion"},
+    {3069, "LocalTime"},
+    {3070, "AllowNulls"},
+    {3071, "EnumValues"},
+    {3072, "InputArguments"},
+    {3073, "OutputArguments"},
+    {3074, "ServerType_ServerStatus_StartTime"},
+    {3075, "ServerType_ServerStatus_CurrentTime"},
+    {3076, "ServerType_ServerStatus_State"},
+    {3077, "ServerType_ServerStatus_BuildInfo"},
+    {3078, "ServerType_ServerStatus_BuildInfo_ProductUri"},
+    {3079, "ServerType_ServerStatus_BuildInfo_ManufacturerName"},
+    {3080, "ServerType_ServerStatus_BuildInfo_ProductName"},
+    {3081, "ServerType_ServerStatus_BuildInfo_SoftwareVersion"},
+    {3082, "ServerType_ServerStatus_BuildInfo_BuildNumber"},
+    {3083, "ServerType_ServerStatus_BuildInfo_BuildDate"},
+    {3084, "ServerType_ServerStatus_SecondsTillShutdown"},
+    {3085, "ServerType_ServerStatus_ShutdownReason"},
+    {3086, "ServerType_ServerCapabilities_ServerProfileArray"},
+    {3087, "ServerType_ServerCapabilities_LocaleIdArray"},
+    {3088, "ServerType_ServerCapabilities_MinSupportedSampleRate"},
+    {3089, "ServerType_ServerCapabilities_MaxBrowseContinuationPoints"},
+    {3090, "ServerType_ServerCapabilities_MaxQueryContinuationPoints"},
+    {3091, "ServerType_ServerCapabilities_MaxHistoryContinuationPoints"},
+    {3092, "ServerType_ServerCapabilities_SoftwareCertificates"},
+    {3093, "ServerType_ServerCapabilities_ModellingRules"},
+    {3094, "ServerType_ServerCapabilities_AggregateFunctions"},
+    {3095, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary"},
+    {3096, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_ServerViewCount"},
+    {3097, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSessionCount"},
+    {3098, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSessionCount"},
+    {3099, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedSessionCount"},
+    {3100, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_RejectedSessionCount"},
+    {3101, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SessionTimeoutCount"},
+    {3102, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SessionAbortCount"},
+    {3104, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_PublishingIntervalCount"},
+    {3105, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CurrentSubscriptionCount"},
+    {3106, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_CumulatedSubscriptionCount"},
+    {3107, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_SecurityRejectedRequestsCount"},
+    {3108, "ServerType_ServerDiagnostics_ServerDiagnosticsSummary_RejectedRequestsCount"},
+    {3109, "ServerType_ServerDiagnostics_SamplingIntervalDiagnosticsArray"},
+    {3110, "ServerType_ServerDiagnostics_SubscriptionDiagnosticsArray"},
+    {3111, "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary"},
+    {3112, "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary_SessionDiagnosticsArray"},
+    {3113, "ServerType_ServerDiagnostics_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray"},
+    {3114, "ServerType_ServerDiagnostics_EnabledFlag"},
+    {3115, "ServerType_ServerRedundancy_RedundancySupport"},
+    {3116, "ServerDiagnosticsType_ServerDiagnosticsSummary_ServerViewCount"},
+    {3117, "ServerDiagnosticsType_ServerDiagnosticsSummary_CurrentSessionCount"},
+    {3118, "ServerDiagnosticsType_ServerDiagnosticsSummary_CumulatedSessionCount"},
+    {3119, "ServerDiagnosticsType_ServerDiagnosticsSummary_SecurityRejectedSessionCount"},
+    {3120, "ServerDiagnosticsType_ServerDiagnosticsSummary_RejectedSessionCount"},
+    {3121, "ServerDiagnosticsType_ServerDiagnosticsSummary_SessionTimeoutCount"},
+    {3122, "ServerDiagnosticsType_ServerDiagnosticsSummary_SessionAbortCount"},
+    {3124, "ServerDiagnosticsType_ServerDiagnosticsSummary_PublishingIntervalCount"},
+    {3125, "ServerDiagnosticsType_ServerDiagnosticsSummary_CurrentSubscriptionCount"},
+    {3126, "ServerDiagnosticsType_ServerDiagnosticsSummary_CumulatedSubscriptionCount"},
+    {3127, "ServerDiagnosticsType_ServerDiagnosticsSummary_SecurityRejectedRequestsCount"},
+    {3128, "ServerDiagnosticsType_ServerDiagnosticsSummary_RejectedRequestsCount"},
+    {3129, "ServerDiagnosticsType_SessionsDiagnosticsSummary_SessionDiagnosticsArray"},
+    {3130, "ServerDiagnosticsType_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray"},
+    {3131, "SessionDiagnosticsObjectType_SessionDiagnostics_SessionId"},
+    {3132, "SessionDiagnosticsObjectType_SessionDiagnostics_SessionName"},
+    {3133, "SessionDiagnosticsObjectType_SessionDiagnostics_ClientDescription"},
+    {3134, "SessionDiagnosticsObjectType_SessionDiagnostics_ServerUri"},
+    {3135, "SessionDiagnosticsObjectType_SessionDiagnostics_EndpointUrl"},
+    {3136, "SessionDiagnosticsObjectType_SessionDiagnostics_LocaleIds"},
+    {3137, "SessionDiagnosticsObjectType_SessionDiagnostics_ActualSessionTimeout"},
+    {3138, "SessionDiagnosticsObjectType_SessionDiagnostics_MaxResponseMessageSize"},
+    {3139, "SessionDiagnosticsObjectType_SessionDiagnostics_ClientConnectionTime"},
+    {3140, "SessionDiagnosticsObjectType_SessionDiagnostics_ClientLastContactTime"},
+    {3141, "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentSubscriptionsCount"},
+    {3142, "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentMonitoredItemsCount"},
+    {3143, "SessionDiagnosticsObjectType_SessionDiagnostics_CurrentPublishRequestsInQueue"},
+    {3151, "SessionDiagnosticsObjectType_SessionDiagnostics_ReadCount"},
+    {3152, "SessionDiagnosticsObjectType_SessionDiagnostics_HistoryReadCount"},
+    {3153, "SessionDiagnosticsObjectType_SessionDiagnostics_WriteCount"},
+    {3154, "SessionDiagnosticsObjectType_SessionDiagnostics_HistoryUpdateCount"},
+    {3155, "SessionDiagnosticsObjectType_SessionDiagnostics_CallCount"},
+    {3156, "SessionDiagnosticsObjectType_SessionDiagnostics_CreateMonitoredItemsCount"},
+    {3157, "SessionDiagnosticsObjectType_SessionDiagnostics_ModifyMonitoredItemsCount"},
+    {3158, "SessionDiagnosticsObjectType_SessionDiagnostics_SetMonitoringModeCount"},
+    {3159, "SessionDiagnosticsObjectType_SessionDiagnostics_SetTriggeringCount"},
+    {3160, "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteMonitoredItemsCount"},
+    {3161, "SessionDiagnosticsObjectType_SessionDiagnostics_CreateSubscriptionCount"},
+    {3162, "SessionDiagnosticsObjectType_SessionDiagnostics_ModifySubscriptionCount"},
+    {3163, "SessionDiagnosticsObjectType_SessionDiagnostics_SetPublishingModeCount"},
+    {3164, "SessionDiagnosticsObjectType_SessionDiagnostics_PublishCount"},
+    {3165, "SessionDiagnosticsObjectType_SessionDiagnostics_RepublishCount"},
+    {3166, "SessionDiagnosticsObjectType_SessionDiagnostics_TransferSubscriptionsCount"},
+    {3167, "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteSubscriptionsCount"},
+    {3168, "SessionDiagnosticsObjectType_SessionDiagnostics_AddNodesCount"},
+    {3169, "SessionDiagnosticsObjectType_SessionDiagnostics_AddReferencesCount"},
+    {3170, "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteNodesCount"},
+    {3171, "SessionDiagnosticsObjectType_SessionDiagnostics_DeleteReferencesCount"},
+    {3172, "SessionDiagnosticsObjectType_SessionDiagnostics_BrowseCount"},
+    {3173, "SessionDiagnosticsObjectType_SessionDiagnostics_BrowseNextCount"},
+    {3174, "SessionDiagnosticsObjectType_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount"},
+    {3175, "SessionDiagnosticsObjectType_SessionDiagnostics_QueryFirstCount"},
+    {3176, "SessionDiagnosticsObjectType_SessionDiagnostics_QueryNextCount"},
+    {3177, "SessionDiagnosticsObjectType_SessionDiagnostics_RegisterNodesCount"},
+    {3178, "SessionDiagnosticsObjectType_SessionDiagnostics_UnregisterNodesCount"},
+    {3179, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SessionId"},
+    {3180, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientUserIdOfSession"},
+    {3181, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientUserIdHistory"},
+    {3182, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_AuthenticationMechanism"},
+    {3183, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_Encoding"},
+    {3184, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_TransportProtocol"},
+    {3185, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SecurityMode"},
+    {3186, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_SecurityPolicyUri"},
+    {3187, "SessionDiagnosticsObjectType_SessionSecurityDiagnostics_ClientCertificate"},
+    {3188, "TransparentRedundancyType_RedundancySupport"},
+    {3189, "NonTransparentRedundancyType_RedundancySupport"},
+    {3190, "BaseEventType_LocalTime"},
+    {3191, "EventQueueOverflowEventType_EventId"},
+    {3192, "EventQueueOverflowEventType_EventType"},
+    {3193, "EventQueueOverflowEventType_SourceNode"},
+    {3194, "EventQueueOverflowEventType_SourceName"},
+    {3195, "EventQueueOverflowEventType_Time"},
+    {3196, "EventQueueOverflowEventType_ReceiveTime"},
+    {3197, "EventQueueOverflowEventType_LocalTime"},
+    {3198, "EventQueueOverflowEventType_Message"},
+    {3199, "EventQueueOverflowEventType_Severity"},
+    {3200, "AuditEventType_EventId"},
+    {3201, "AuditEventType_EventType"},
+    {3202, "AuditEventType_SourceNode"},
+    {3203, "AuditEventType_SourceName"},
+    {3204, "AuditEventType_Time"},
+    {3205, "AuditEventType_ReceiveTime"},
+    {3206, "AuditEventType_LocalTime"},
+    {3207, "AuditEventType_Message"},
+    {3208, "AuditEventType_Severity"},
+    {3209, "AuditSecurityEventType_EventId"},
+    {3210, "AuditSecurityEventType_EventType"},
+    {3211, "AuditSecurityEventType_SourceNode"},
+    {3212, "AuditSecurityEventType_SourceName"},
+    {3213, "AuditSecurityEventType_Time"},
+    {3214, "AuditSecurityEventType_ReceiveTime"},
+    {3215, "AuditSecurityEventType_LocalTime"},
+    {3216, "AuditSecurityEventType_Message"},
+    {3217, "AuditSecurityEventType_Severity"},
+    {3218, "AuditSecurityEventType_ActionTimeStamp"},
+    {3219, "AuditSecurityEventType_Status"},
+    {3220, "AuditSecurityEventType_ServerId"},
+    {3221, "AuditSecurityEventType_ClientAuditEntryId"},
+    {3222, "AuditSecurityEventType_ClientUserId"},
+    {3223, "AuditChannelEventType_EventId"},
+    {3224, "AuditChannelEventType_EventType"},
+    {3225, "AuditChannelEventType_SourceNode"},
+    {3226, "AuditChannelEventType_SourceName"},
+    {3227, "AuditChannelEventType_Time"},
+    {3228, "AuditChannelEventType_ReceiveTime"},
+    {3229, "AuditChannelEventType_LocalTime"},
+    {3230, "AuditChannelEventType_Message"},
+    {3231, "AuditChannelEventType_Severity"},
+    {3232, "AuditChannelEventType_ActionTimeStamp"},
+    {3233, "AuditChannelEventType_Status"},
+    {3234, "AuditChannelEventType_ServerId"},
+    {3235, "AuditChannelEventType_ClientAuditEntryId"},
+    {3236, "AuditChannelEventType_ClientUserId"},
+    {3237, "AuditOpenSecureChannelEventType_EventId"},
+    {3238, "AuditOpenSecureChannelEventType_EventType"},
+    {3239, "AuditOpenSecureChannelEventType_SourceNode"},
+    {3240, "AuditOpenSecureChannelEventType_SourceName"},
+    {3241, "AuditOpenSecureChannelEventType_Time"},
+    {3242, "AuditOpenSecureChannelEventType_ReceiveTime"},
+    {3243, "AuditOpenSecureChannelEventType_LocalTime"},
+    {3244, "AuditOpenSecureChannelEventType_Message"},
+    {3245, "AuditOpenSecureChannelEventType_Severity"},
+    {3246, "AuditOpenSecureChannelEventType_ActionTimeStamp"},
+    {3247, "AuditOpenSecureChannelEventType_Status"},
+    {3248, "AuditOpenSecureChannelEventType_ServerId"},
+    {3249, "AuditOpenSecureChannelEventType_ClientAuditEntryId"},
+    {3250, "AuditOpenSecureChannelEventType_ClientUserId"},
+    {3251, "AuditOpenSecureChannelEventType_SecureChannelId"},
+    {3252, "AuditSessionEventType_EventId"},
+    {3253, "AuditSessionEventType_EventType"},
+    {3254, "AuditSessionEventType_SourceNode"},
+    {3255, "AuditSessionEventType_SourceName"},
+    {3256, "AuditSessionEventType_Time"},
+    {3257, "AuditSessionEventType_ReceiveTime"},
+    {3258, "AuditSessionEventType_LocalTime"},
+    {3259, "AuditSessionEventType_Message"},
+    {3260, "AuditSessionEventType_Severity"},
+    {3261, "AuditSessionEventType_ActionTimeStamp"},
+    {3262, "AuditSessionEventType_Status"},
+    {3263, "AuditSessionEventType_ServerId"},
+    {3264, "AuditSessionEventType_ClientAuditEntryId"},
+    {3265, "AuditSessionEventType_ClientUserId"},
+    {3266, "AuditCreateSessionEventType_EventId"},
+    {3267, "AuditCreateSessionEventType_EventType"},
+    {3268, "AuditCreateSessionEventType_SourceNode"},
+    {3269, "AuditCreateSessionEventType_SourceName"},
+    {3270, "AuditCreateSessionEventType_Time"},
+    {3271, "AuditCreateSessionEventType_ReceiveTime"},
+    {3272, "AuditCreateSessionEventType_LocalTime"},
+    {3273, "AuditCreateSessionEventType_Message"},
+    {3274, "AuditCreateSessionEventType_Severity"},
+    {3275, "AuditCreateSessionEventType_ActionTimeStamp"},
+    {3276, "AuditCreateSessionEventType_Status"},
+    {3277, "AuditCreateSessionEventType_ServerId"},
+    {3278, "AuditCreateSessionEventType_ClientAuditEntryId"},
+    {3279, "AuditCreateSessionEventType_ClientUserId"},
+    {3281, "AuditUrlMismatchEventType_EventId"},
+    {3282, "AuditUrlMismatchEventType_EventType"},
+    {3283, "AuditUrlMismatchEventType_SourceNode"},
+    {3284, "AuditUrlMismatchEventType_SourceName"},
+    {3285, "AuditUrlMismatchEventType_Time"},
+    {3286, "AuditUrlMismatchEventType_ReceiveTime"},
+    {3287, "AuditUrlMismatchEventType_LocalTime"},
+    {3288, "AuditUrlMismatchEventType_Message"},
+    {3289, "AuditUrlMismatchEventType_Severity"},
+    {3290, "AuditUrlMismatchEventType_ActionTimeStamp"},
+    {3291, "AuditUrlMismatchEventType_Status"},
+    {3292, "AuditUrlMismatchEventType_ServerId"},
+    {3293, "AuditUrlMismatchEventType_ClientAuditEntryId"},
+    {3294, "AuditUrlMismatchEventType_ClientUserId"},
+    {3296, "AuditUrlMismatchEventType_SecureChannelId"},
+    {3297, "AuditUrlMismatchEventType_ClientCertificate"},
+    {3298, "AuditUrlMismatchEventType_ClientCertificateThumbprint"},
+    {3299, "AuditUrlMismatchEventType_RevisedSessionTimeout"},
+    {3300, "AuditActivateSessionEventType_EventId"},
+    {3301, "AuditActivateSessionEventType_EventType"},
+    {3302, "AuditActivateSessionEventType_SourceNode"},
+    {3303, "AuditActivateSessionEventType_SourceName"},
+    {3304, "AuditActivateSessionEventType_Time"},
+    {3305, "AuditActivateSessionEventType_ReceiveTime"},
+    {3306, "AuditActivateSessionEventType_LocalTime"},
+    {3307, "AuditActivateSessionEventType_Message"},
+    {3308, "AuditActivateSessionEventType_Severity"},
+    {3309, "AuditActivateSessionEventType_ActionTimeStamp"},
+    {3310, "AuditActivateSessionEventType_Status"},
+    {3311, "AuditActivateSessionEventType_ServerId"},
+    {3312, "AuditActivateSessionEventType_ClientAuditEntryId"},
+    {3313, "AuditActivateSessionEventType_ClientUserId"},
+    {3314, "AuditActivateSessionEventType_SessionId"},
+    {3315, "AuditCancelEventType_EventId"},
+    {3316, "AuditCancelEventType_EventType"},
+    {3317, "AuditCancelEventType_SourceNode"},
+    {3318, "AuditCancelEventType_SourceName"},
+    {3319, "AuditCancelEventType_Time"},
+    {3320, "AuditCancelEventType_ReceiveTime"},
+    {3321, "AuditCancelEventType_LocalTime"},
+    {3322, "AuditCancelEventType_Message"},
+    {3323, "AuditCancelEventType_Severity"},
+    {3324, "AuditCancelEventType_ActionTimeStamp"},
+    {3325, "AuditCancelEventType_Status"},
+    {3326, "AuditCancelEventType_ServerId"},
+    {3327, "AuditCancelEventType_ClientAuditEntryId"},
+    {3328, "AuditCancelEventType_ClientUserId"},
+    {3329, "AuditCancelEventType_SessionId"},
+    {3330, "AuditCertificateEventType_EventId"},
+    {3331, "AuditCertificateEventType_EventType"},
+    {3332, "AuditCertificateEventType_SourceNode"},
+    {3333, "AuditCertificateEventType_SourceName"},
+    {3334, "AuditCertificateEventType_Time"},
+    {3335, "AuditCertificateEventType_ReceiveTime"},
+    {3336, "AuditCertificateEventType_LocalTime"},
+    {3337, "AuditCertificateEventType_Message"},
+    {3338, "AuditCertificateEventType_Severity"},
+    {3339, "AuditCertificateEventType_ActionTimeStamp"},
+    {3340, "AuditCertificateEventType_Status"},
+    {3341, "AuditCertificateEventType_ServerId"},
+    {3342, "AuditCertificateEventType_ClientAuditEntryId"},
+    {3343, "AuditCertificateEventType_ClientUserId"},
+    {3344, "AuditCertificateDataMismatchEventType_EventId"},
+    {3345, "AuditCertificateDataMismatchEventType_EventType"},
+    {3346, "AuditCertificateDataMismatchEventType_SourceNode"},
+    {3347, "AuditCertificateDataMismatchEventType_SourceName"},
+    {3348, "AuditCertificateDataMismatchEventType_Time"},
+    {3349, "AuditCertificateDataMismatchEventType_ReceiveTime"},
+    {3350, "AuditCertificateDataMismatchEventType_LocalTime"},
+    {3351, "AuditCertificateDataMismatchEventType_Message"},
+    {3352, "AuditCertificateDataMismatchEventType_Severity"},
+    {3353, "AuditCertificateDataMismatchEventType_ActionTimeStamp"},
+    {3354, "AuditCertificateDataMismatchEventType_Status"},
+    {3355, "AuditCertificateDataMismatchEventType_ServerId"},
+    {3356, "AuditCertificateDataMismatchEventType_ClientAuditEntryId"},
+    {3357, "AuditCertificateDataMismatchEventType_ClientUserId"},
+    {3358, "AuditCertificateDataMismatchEventType_Certificate"},
+    {3359, "AuditCertificateExpiredEventType_EventId"},
+    {3360, "AuditCertificateExpiredEventType_EventType"},
+    {3361, "AuditCertificateExpiredEventType_SourceNode"},
+    {3362, "AuditCertificateExpiredEventType_SourceName"},
+    {3363, "AuditCertificateExpiredEventType_Time"},
+    {3364, "AuditCertificateExpiredEventType_ReceiveTime"},
+    {3365, "AuditCertificateExpiredEventType_LocalTime"},
+    {3366, "AuditCertificateExpiredEventType_Message"},
+    {3367, "AuditCertificateExpiredEventType_Severity"},
+    {3368, "AuditCertificateExpiredEventType_ActionTimeStamp"},
+    {3369, "AuditCertificateExpiredEventType_Status"},
+    {3370, "AuditCertificateExpiredEventType_ServerId"},
+    {3371, "AuditCertificateExpiredEventType_ClientAuditEntryId"},
+    {3372, "AuditCertificateExpiredEventType_ClientUserId"},
+    {3373, "AuditCertificateExpiredEventType_Certificate"},
+    {3374, "AuditCertificateInvalidEventType_EventId"},
+    {3375, "AuditCertificateInvalidEventType_EventType"},
+    {3376, "AuditCertificateInvalidEventType_SourceNode"},
+    {3377, "AuditCertificateInvalidEventType_SourceName"},
+    {3378, "AuditCertificateInvalidEventType_Time"},
+    {3379, "AuditCertificateInvalidEventType_ReceiveTime"},
+    {3380, "AuditCertificateInvalidEventType_LocalTime"},
+    {3381, "AuditCertificateInvalidEventType_Message"},
+    {3382, "AuditCertificateInvalidEventType_Severity"},
+    {3383, "AuditCertificateInvalidEventType_ActionTimeStamp"},
+    {3384, "AuditCertificateInvalidEventType_Status"},
+    {3385, "AuditCertificateInvalidEventType_ServerId"},
+    {3386, "AuditCertificateInvalidEventType_ClientAuditEntryId"},
+    {3387, "AuditCertificateInvalidEventType_ClientUserId"},
+    {3388, "AuditCertificateInvalidEventType_Certificate"},
+    {3389, "AuditCertificateUntrustedEventType_EventId"},
+    {3390, "AuditCertificateUntrustedEventType_EventType"},
+    {3391, "AuditCertificateUntrustedEventType_SourceNode"},
+    {3392, "AuditCertificateUntrustedEventType_SourceName"},
+    {3393, "AuditCertificateUntrustedEventType_Time"},
+    {3394, "AuditCertificateUntrustedEventType_ReceiveTime"},
+    {3395, "AuditCertificateUntrustedEventType_LocalTime"},
+    {3396, "AuditCertificateUntrustedEventType_Message"},
+    {3397, "AuditCertificateUntrustedEventType_Severity"},
+    {3398, "AuditCertificateUntrustedEventType_ActionTimeStamp"},
+    {3399, "AuditCertificateUntrustedEventType_Status"},
+    {3400, "AuditCertificateUntrustedEventType_ServerId"},
+    {3401, "AuditCertificateUntrustedEventType_ClientAuditEntryId"},
+    {3402, "AuditCertificateUntrustedEventType_ClientUserId"},
+    {3403, "AuditCertificateUntrustedEventType_Certificate"},
+    {3404, "AuditCertificateRevokedEventType_EventId"},
+    {3405, "AuditCertificateRevokedEventType_EventType"},
+    {3406, "AuditCertificateRevokedEventType_SourceNode"},
+    {3407, "AuditCertificateRevokedEventType_SourceName"},
+    {3408, "AuditCertificateRevokedEventType_Time"},
+    {3409, "AuditCertificateRevokedEventType_ReceiveTime"},
+    {3410, "AuditCertificateRevokedEventType_LocalTime"},
+    {3411, "AuditCertificateRevokedEventType_Message"},
+    {3412, "AuditCertificateRevokedEventType_Severity"},
+    {3413, "AuditCertificateRevokedEventType_ActionTimeStamp"},
+    {3414, "AuditCertificateRevokedEventType_Status"},
+    {3415, "AuditCertificateRevokedEventType_ServerId"},
+    {3416, "AuditCertificateRevokedEventType_ClientAuditEntryId"},
+    {3417, "AuditCertificateRevokedEventType_ClientUserId"},
+    {3418, "AuditCertificateRevokedEventType_Certificate"},
+    {3419, "AuditCertificateMismatchEventType_EventId"},
+    {3420, "AuditCertificateMismatchEventType_EventType"},
+    {3421, "AuditCertificateMismatchEventType_SourceNode"},
+    {3422, "AuditCertificateMismatchEventType_SourceName"},
+    {3423, "AuditCertificateMismatchEventType_Time"},
+    {3424, "AuditCertificateMismatchEventType_ReceiveTime"},
+    {3425, "AuditCertificateMismatchEventType_LocalTime"},
+    {3426, "AuditCertificateMismatchEventType_Message"},
+    {3427, "AuditCertificateMismatchEventType_Severity"},
+    {3428, "AuditCertificateMismatchEventType_ActionTimeStamp"},
+    {3429, "AuditCertificateMismatchEventType_Status"},
+    {3430, "AuditCertificateMismatchEventType_ServerId"},
+    {3431, "AuditCertificateMismatchEventType_ClientAuditEntryId"},
+    {3432, "AuditCertificateMismatchEventType_ClientUserId"},
+    {3433, "AuditCertificateMismatchEventType_Certificate"},
+    {3434, "AuditNodeManagementEventType_EventId"},
+    {3435, "AuditNodeManagementEventType_EventType"},
+    {3436, "AuditNodeManagementEventType_SourceNode"},
+    {3437, "AuditNodeManagementEventType_SourceName"},
+    {3438, "AuditNodeManagementEventType_Time"},
+    {3439, "AuditNodeManagementEventType_ReceiveTime"},
+    {3440, "AuditNodeManagementEventType_LocalTime"},
+    {3441, "AuditNodeManagementEventType_Message"},
+    {3442, "AuditNodeManagementEventType_Severity"},
+    {3443, "AuditNodeManagementEventType_ActionTimeStamp"},
+    {3444, "AuditNodeManagementEventType_Status"},
+    {3445, "AuditNodeManagementEventType_ServerId"},
+    {3446, "AuditNodeManagementEventType_ClientAuditEntryId"},
+    {3447, "AuditNodeManagementEventType_ClientUserId"},
+    {3448, "AuditAddNodesEventType_EventId"},
+    {3449, "AuditAddNodesEventType_EventType"},
+    {3450, "AuditAddNodesEventType_SourceNode"},
+    {3451, "AuditAddNodesEventType_SourceName"},
+    {3452, "AuditAddNodesEventType_Time"},
+    {3453, "AuditAddNodesEventType_ReceiveTime"},
+    {3454, "AuditAddNodesEventType_LocalTime"},
+    {3455, "AuditAddNodesEventType_Message"},
+    {3456, "AuditAddNodesEventType_Severity"},
+    {3457, "AuditAddNodesEventType_ActionTimeStamp"},
+    {3458, "AuditAddNodesEventType_Status"},
+    {3459, "AuditAddNodesEventType_ServerId"},
+    {3460, "AuditAddNodesEventType_ClientAuditEntryId"},
+    {3461, "AuditAddNodesEventType_ClientUserId"},
+    {3462, "AuditDeleteNodesEventType_EventId"},
+    {3463, "AuditDeleteNodesEventType_EventType"},
+    {3464, "AuditDeleteNodesEventType_SourceNode"},
+    {3465, "AuditDeleteNodesEventType_SourceName"},
+    {3466, "AuditDeleteNodesEventType_Time"},
+    {3467, "AuditDeleteNodesEventType_ReceiveTime"},
+    {3468, "AuditDeleteNodesEventType_LocalTime"},
+    {3469, "AuditDeleteNodesEventType_Message"},
+    {3470, "AuditDeleteNodesEventType_Severity"},
+    {3471, "AuditDeleteNodesEventType_ActionTimeStamp"},
+    {3472, "AuditDeleteNodesEventType_Status"},
+    {3473, "AuditDeleteNodesEventType_ServerId"},
+    {3474, "AuditDeleteNodesEventType_ClientAuditEntryId"},
+    {3475, "AuditDeleteNodesEventType_ClientUserId"},
+    {3476, "AuditAddReferencesEventType_EventId"},
+    {3477, "AuditAddReferencesEventType_EventType"},
+    {3478, "AuditAddReferencesEventType_SourceNode"},
+    {3479, "AuditAddReferencesEventType_SourceName"},
+    {3480, "AuditAddReferencesEventType_Time"},
+    {3481, "AuditAddReferencesEventType_ReceiveTime"},
+    {3482, "AuditAddReferencesEventType_LocalTime"},
+    {3483, "AuditAddReferencesEventType_Message"},
+    {3484, "AuditAddReferencesEventType_Severity"},
+    {3485, "AuditAddReferencesEventType_ActionTimeStamp"},
+    {3486, "AuditAddReferencesEventType_Status"},
+    {3487, "AuditAddReferencesEventType_ServerId"},
+    {3488, "AuditAddReferencesEventType_ClientAuditEntryId"},
+    {3489, "AuditAddReferencesEventType_ClientUserId"},
+    {3490, "AuditDeleteReferencesEventType_EventId"},
+    {3491, "AuditDeleteReferencesEventType_EventType"},
+    {3492, "AuditDeleteReferencesEventType_SourceNode"},
+    {3493, "AuditDeleteReferencesEventType_SourceName"},
+    {3494, "AuditDeleteReferencesEventType_Time"},
+    {3495, "AuditDeleteReferencesEventType_ReceiveTime"},
+    {3496, "AuditDeleteReferencesEventType_LocalTime"},
+    {3497, "AuditDeleteReferencesEventType_Message"},
+    {3498, "AuditDeleteReferencesEventType_Severity"},
+    {3499, "AuditDeleteReferencesEventType_ActionTimeStamp"},
+    {3500, "AuditDeleteReferencesEventType_Status"},
+    {3501, "AuditDeleteReferencesEventType_ServerId"},
+    {3502, "AuditDeleteReferencesEventType_ClientAuditEntryId"},
+    {3503, "AuditDeleteReferencesEventType_ClientUserId"},
+    {3504, "AuditUpdateEventType_EventId"},
+    {3505, "AuditUpdateEventType_EventType"},
+    {3506, "AuditUpdateEventType_SourceNode"},
+    {3507, "AuditUpdateEventType_SourceName"},
+    {3508, "AuditUpdateEventType_Time"},
+    {3509, "AuditUpdateEventType_ReceiveTime"},
+    {3510, "AuditUpdateEventType_LocalTime"},
+    {3511, "AuditUpdateEventType_Message"},
+    {3512, "AuditUpdateEventType_Severity"},
+    {3513, "AuditUpdateEventType_ActionTimeStamp"},
+    {3514, "AuditUpdateEventType_Status"},
+    {3515, "AuditUpdateEventType_ServerId"},
+    {3516, "AuditUpdateEventType_ClientAuditEntryId"},
+    {3517, "AuditUpdateEventType_ClientUserId"},
+    {3518, "AuditWriteUpdateEventType_EventId"},
+    {3519, "AuditWriteUpdateEventType_EventType"},
+    {3520, "AuditWriteUpdateEventType_SourceNode"},
+    {3521, "AuditWriteUpdateEventType_SourceName"},
+    {3522, "AuditWriteUpdateEventType_Time"},
+    {3523, "AuditWriteUpdateEventType_ReceiveTime"},
+    {3524, "AuditWriteUpdateEventType_LocalTime"},
+    {3525, "AuditWriteUpdateEventType_Message"},
+    {3526, "AuditWriteUpdateEventType_Severity"},
+    {3527, "AuditWriteUpdateEventType_ActionTimeStamp"},
+    {3528, "AuditWriteUpdateEventType_Status"},
+    {3529, "AuditWriteUpdateEventType_ServerId"},
+    {3530, "AuditWriteUpdateEventType_ClientAuditEntryId"},
+    {3531, "AuditWriteUpdateEventType_ClientUserId"},
+    {3532, "AuditHistoryUpdateEventType_EventId"},
+    {3533, "AuditHistoryUpdateEventType_EventType"},
+    {3534, "AuditHistoryUpdateEventType_SourceNode"},
+    {3535, "AuditHistoryUpdateEventType_SourceName"},
+    {3536, "AuditHistoryUpdateEventType_Time"},
+    {3537, "AuditHistoryUpdateEventType_ReceiveTime"},
+    {3538, "AuditHistoryUpdateEventType_LocalTime"},
+    {3539, "AuditHistoryUpdateEventType_Message"},
+    {3540, "AuditHistoryUpdateEventType_Severity"},
+    {3541, "AuditHistoryUpdateEventType_ActionTimeStamp"},
+    {3542, "AuditHistoryUpdateEventType_Status"},
+    {3543, "AuditHistoryUpdateEventType_ServerId"},
+    {3544, "AuditHistoryUpdateEventType_ClientAuditEntryId"},
+    {3545, "AuditHistoryUpdateEventType_ClientUserId"},
+    {3546, "AuditHistoryEventUpdateEventType_EventId"},
+    {3547, "AuditHistoryEventUpdateEventType_EventType"},
+    {3548, "AuditHistoryEventUpdateEventType_SourceNode"},
+    {3549, "AuditHistoryEventUpdateEventType_SourceName"},
+    {3550, "AuditHistoryEventUpdateEventType_Time"},
+    {3551, "AuditHistoryEventUpdateEventType_ReceiveTime"},
+    {3552, "AuditHistoryEventUpdateEventType_LocalTime"},
+    {3553, "AuditHistoryEventUpdateEventType_Message"},
+    {3554, "AuditHistoryEventUpdateEventType_Severity"},
+    {3555, "AuditHistoryEventUpdateEventType_ActionTimeStamp"},
+    {3556, "AuditHistoryEventUpdateEventType_Status"},
+    {3557, "AuditHistoryEventUpdateEventType_ServerId"},
+    {3558, "AuditHistoryEventUpdateEventType_ClientAuditEntryId"},
+    {3559, "AuditHistoryEventUpdateEventType_ClientUserId"},
+    {3560, "AuditHistoryEventUpdateEventType_ParameterDataTypeId"},
+    {3561, "AuditHistoryValueUpdateEventType_EventId"},
+    {3562, "AuditHistoryValueUpdateEventType_EventType"},
+    {3563, "AuditHistoryValueUpdateEventType_SourceNode"},
+    {3564, "AuditHistoryValueUpdateEventType_SourceName"},
+    {3565, "AuditHistoryValueUpdateEventType_Time"},
+    {3566, "AuditHistoryValueUpdateEventType_ReceiveTime"},
+    {3567, "AuditHistoryValueUpdateEventType_LocalTime"},
+    {3568, "AuditHistoryValueUpdateEventType_Message"},
+    {3569, "AuditHistoryValueUpdateEventType_Severity"},
+    {3570, "AuditHistoryValueUpdateEventType_ActionTimeStamp"},
+    {3571, "AuditHistoryValueUpdateEventType_Status"},
+    {3572, "AuditHistoryValueUpdateEventType_ServerId"},
+    {3573, "AuditHistoryValueUpdateEventType_ClientAuditEntryId"},
+    {3574, "AuditHistoryValueUpdateEventType_ClientUserId"},
+    {3575, "AuditHistoryValueUpdateEventType_ParameterDataTypeId"},
+    {3576, "AuditHistoryDeleteEventType_EventId"},
+    {3577, "AuditHistoryDeleteEventType_EventType"},
+    {3578, "AuditHistoryDeleteEventType_SourceNode"},
+    {3579, "AuditHistoryDeleteEventType_SourceName"},
+    {3580, "AuditHistoryDeleteEventType_Time"},
+    {3581, "AuditHistoryDeleteEventType_ReceiveTime"},
+    {3582, "AuditHistoryDeleteEventType_LocalTime"},
+    {3583, "AuditHistoryDeleteEventType_Message"},
+    {3584, "AuditHistoryDeleteEventType_Severity"},
+    {3585, "AuditHistoryDeleteEventType_ActionTimeStamp"},
+    {3586, "AuditHistoryDeleteEventType_Status"},
+    {3587, "AuditHistoryDeleteEventType_ServerId"},
+    {3588, "AuditHistoryDeleteEventType_ClientAuditEntryId"},
+    {3589, "AuditHistoryDeleteEventType_ClientUserId"},
+    {3590, "AuditHistoryDeleteEventType_ParameterDataTypeId"},
+    {3591, "AuditHistoryRawModifyDeleteEventType_EventId"},
+    {3592, "AuditHistoryRawModifyDeleteEventType_EventType"},
+    {3593, "AuditHistoryRawModifyDeleteEventType_SourceNode"},
+    {3594, "AuditHistoryRawModifyDeleteEventType_SourceName"},
+    {3595, "AuditHistoryRawModifyDeleteEventType_Time"},
+    {3596, "AuditHistoryRawModifyDeleteEventType_ReceiveTime"},
+    {3597, "AuditHistoryRawModifyDeleteEventType_LocalTime"},
+    {3598, "AuditHistoryRawModifyDeleteEventType_Message"},
+    {3599, "AuditHistoryRawModifyDeleteEventType_Severity"},
+    {3600, "AuditHistoryRawModifyDeleteEventType_ActionTimeStamp"},
+    {3601, "AuditHistoryRawModifyDeleteEventType_Status"},
+    {3602, "AuditHistoryRawModifyDeleteEventType_ServerId"},
+    {3603, "AuditHistoryRawModifyDeleteEventType_ClientAuditEntryId"},
+    {3604, "AuditHistoryRawModifyDeleteEventType_ClientUserId"},
+    {3605, "AuditHistoryRawModifyDeleteEventType_ParameterDataTypeId"},
+    {3606, "AuditHistoryRawModifyDeleteEventType_UpdatedNode"},
+    {3607, "AuditHistoryAtTimeDeleteEventType_EventId"},
+    {3608, "AuditHistoryAtTimeDeleteEventType_EventType"},
+    {3609, "AuditHistoryAtTimeDeleteEventType_SourceNode"},
+    {3610, "AuditHistoryAtTimeDeleteEventType_SourceName"},
+    {3611, "AuditHistoryAtTimeDeleteEventType_Time"},
+    {3612, "AuditHistoryAtTimeDeleteEventType_ReceiveTime"},
+    {3613, "AuditHistoryAtTimeDeleteEventType_LocalTime"},
+    {3614, "AuditHistoryAtTimeDeleteEventType_Message"},
+    {3615, "AuditHistoryAtTimeDeleteEventType_Severity"},
+    {3616, "AuditHistoryAtTimeDeleteEventType_ActionTimeStamp"},
+    {3617, "AuditHistoryAtTimeDeleteEventType_Status"},
+    {3618, "AuditHistoryAtTimeDeleteEventType_ServerId"},
+    {3619, "AuditHistoryAtTimeDeleteEventType_ClientAuditEntryId"},
+    {3620, "AuditHistoryAtTimeDeleteEventType_ClientUserId"},
+    {3621, "AuditHistoryAtTimeDeleteEventType_ParameterDataTypeId"},
+    {3622, "AuditHistoryAtTimeDeleteEventType_UpdatedNode"},
+    {3623, "AuditHistoryEventDeleteEventType_EventId"},
+    {3624, "AuditHistoryEventDeleteEventType_EventType"},
+    {3625, "AuditHistoryEventDeleteEventType_SourceNode"},
+    {3626, "AuditHistoryEventDeleteEventType_SourceName"},
+    {3627, "AuditHistoryEventDeleteEventType_Time"},
+    {3628, "AuditHistoryEventDeleteEventType_ReceiveTime"},
+    {3629, "AuditHistoryEventDeleteEventType_LocalTime"},
+    {3630, "AuditHistoryEventDeleteEventType_Message"},
+    {3631, "AuditHistoryEventDeleteEventType_Severity"},
+    {3632, "AuditHistoryEventDeleteEventType_ActionTimeStamp"},
+    {3633, "AuditHistoryEventDeleteEventType_Status"},
+    {3634, "AuditHistoryEventDeleteEventType_ServerId"},
+    {3635, "AuditHistoryEventDeleteEventType_ClientAuditEntryId"},
+    {3636, "AuditHistoryEventDeleteEventType_ClientUserId"},
+    {3637, "AuditHistoryEventDeleteEventType_ParameterDataTypeId"},
+    {3638, "AuditHistoryEventDeleteEventType_UpdatedNode"},
+    {3639, "AuditUpdateMethodEventType_EventId"},
+    {3640, "AuditUpdateMethodEventType_EventType"},
+    {3641, "AuditUpdateMethodEventType_SourceNode"},
+    {3642, "AuditUpdateMethodEventType_SourceName"},
+    {3643, "AuditUpdateMethodEventType_Time"},
+    {3644, "AuditUpdateMethodEventType_ReceiveTime"},
+    {3645, "AuditUpdateMethodEventType_LocalTime"},
+    {3646, "AuditUpdateMethodEventType_Message"},
+    {3647, "AuditUpdateMethodEventType_Severity"},
+    {3648, "AuditUpdateMethodEventType_ActionTimeStamp"},
+    {3649, "AuditUpdateMethodEventType_Status"},
+    {3650, "AuditUpdateMethodEventType_ServerId"},
+    {3651, "AuditUpdateMethodEventType_ClientAuditEntryId"},
+    {3652, "AuditUpdateMethodEventType_ClientUserId"},
+    {3653, "SystemEventType_EventId"},
+    {3654, "SystemEventType_EventType"},
+    {3655, "SystemEventType_SourceNode"},
+    {3656, "SystemEventType_SourceName"},
+    {3657, "SystemEventType_Time"},
+    {3658, "SystemEventType_ReceiveTime"},
+    {3659, "SystemEventType_LocalTime"},
+    {3660, "SystemEventType_Message"},
+    {3661, "SystemEventType_Severity"},
+    {3662, "DeviceFailureEventType_EventId"},
+    {3663, "DeviceFailureEventType_EventType"},
+    {3664, "DeviceFailureEventType_SourceNode"},
+    {3665, "DeviceFailureEventType_SourceName"},
+    {3666, "DeviceFailureEventType_Time"},
+    {3667, "DeviceFailureEventType_ReceiveTime"},
+    {3668, "DeviceFailureEventType_LocalTime"},
+    {3669, "DeviceFailureEventType_Message"},
+    {3670, "DeviceFailureEventType_Severity"},
+    {3671, "BaseModelChangeEventType_EventId"},
+    {3672, "BaseModelChangeEventType_EventType"},
+    {3673, "BaseModelChangeEventType_SourceNode"},
+    {3674, "BaseModelChangeEventType_SourceName"},
+    {3675, "BaseModelChangeEventType_Time"},
+    {3676, "BaseModelChangeEventType_ReceiveTime"},
+    {3677, "BaseModelChangeEventType_LocalTime"},
+    {3678, "BaseModelChangeEventType_Message"},
+    {3679, "BaseModelChangeEventType_Severity"},
+    {3680, "GeneralModelChangeEventType_EventId"},
+    {3681, "GeneralModelChangeEventType_EventType"},
+    {3682, "GeneralModelChangeEventType_SourceNode"},
+    {3683, "GeneralModelChangeEventType_SourceName"},
+    {3684, "GeneralModelChangeEventType_Time"},
+    {3685, "GeneralModelChangeEventType_ReceiveTime"},
+    {3686, "GeneralModelChangeEventType_LocalTime"},
+    {3687, "GeneralModelChangeEventType_Message"},
+    {3688, "GeneralModelChangeEventType_Severity"},
+    {3689, "SemanticChangeEventType_EventId"},
+    {3690, "SemanticChangeEventType_EventType"},
+    {3691, "SemanticChangeEventType_SourceNode"},
+    {3692, "SemanticChangeEventType_SourceName"},
+    {3693, "SemanticChangeEventType_Time"},
+    {3694, "SemanticChangeEventType_ReceiveTime"},
+    {3695, "SemanticChangeEventType_LocalTime"},
+    {3696, "SemanticChangeEventType_Message"},
+    {3697, "SemanticChangeEventType_Severity"},
+    {3698, "ServerStatusType_BuildInfo_ProductUri"},
+    {3699, "ServerStatusType_BuildInfo_ManufacturerName"},
+    {3700, "ServerStatusType_BuildInfo_ProductName"},
+    {3701, "ServerStatusType_BuildInfo_SoftwareVersion"},
+    {3702, "ServerStatusType_BuildInfo_BuildNumber"},
+    {3703, "ServerStatusType_BuildInfo_BuildDate"},
+    {3704, "Server_ServerCapabilities_SoftwareCertificates"},
+    {3705, "Server_ServerDiagnostics_ServerDiagnosticsSummary_RejectedSessionCount"},
+    {3706, "Server_ServerDiagnostics_SessionsDiagnosticsSummary"},
+    {3707, "Server_ServerDiagnostics_SessionsDiagnosticsSummary_SessionDiagnosticsArray"},
+    {3708, "Server_ServerDiagnostics_SessionsDiagnosticsSummary_SessionSecurityDiagnosticsArray"},
+    {3709, "Server_ServerRedundancy_RedundancySupport"},
+    {3714, "FiniteStateVariableType_Name"},
+    {3715, "FiniteStateVariableType_Number"},
+    {3716, "FiniteStateVariableType_EffectiveDisplayName"},
+    {3717, "FiniteTransitionVariableType_Name"},
+    {3718, "FiniteTransitionVariableType_Number"},
+    {3719, "FiniteTransitionVariableType_TransitionTime"},
+    {3720, "StateMachineType_CurrentState_Id"},
+    {3721, "StateMachineType_CurrentState_Name"},
+    {3722, "StateMachineType_CurrentState_Number"},
+    {3723, "StateMachineType_CurrentState_EffectiveDisplayName"},
+    {3724, "StateMachineType_LastTransition_Id"},
+    {3725, "StateMachineType_LastTransition_Name"},
+    {3726, "StateMachineType_LastTransition_Number"},
+    {3727, "StateMachineType_LastTransition_TransitionTime"},
+    {3728, "FiniteStateMachineType_CurrentState_Id"},
+    {3729, "FiniteStateMachineType_CurrentState_Name"},
+    {3730, "FiniteStateMachineType_CurrentState_Number"},
+    {3731, "FiniteStateMachineType_CurrentState_EffectiveDisplayName"},
+    {3732, "FiniteStateMachineType_LastTransition_Id"},
+    {3733, "FiniteStateMachineType_LastTransition_Name"},
+    {3734, "FiniteStateMachineType_LastTransition_Number"},
+    {3735, "FiniteStateMachineType_LastTransition_TransitionTime"},
+    {3736, "InitialStateType_StateNumber"},
+    {3737, "TransitionEventType_EventId"},
+    {3738, "TransitionEventType_EventType"},
+    {3739, "TransitionEventType_SourceNode"},
+    {3740, "TransitionEventType_SourceName"},
+    {3741, "TransitionEventType_Time"},
+    {3742, "TransitionEventType_ReceiveTime"},
+    {3743, "TransitionEventType_LocalTime"},
+    {3744, "TransitionEventType_Message"},
+    {3745, "TransitionEventType_Severity"},
+    {3746, "TransitionEventType_FromState_Id"},
+    {3747, "TransitionEventType_FromState_Name"},
+    {3748, "TransitionEventType_FromState_Number"},
+    {3749, "TransitionEventType_FromState_EffectiveDisplayName"},
+    {3750, "TransitionEventType_ToState_Id"},
+    {3751, "TransitionEventType_ToState_Name"},
+    {3752, "TransitionEventType_ToState_Number"},
+    {3753, "TransitionEventType_ToState_EffectiveDisplayName"},
+    {3754, "TransitionEventType_Transition_Id"},
+    {3755, "TransitionEventType_Transition_Name"},
+    {3756, "TransitionEventType_Transition_Number"},
+    {3757, "TransitionEventType_Transition_TransitionTime"},
+    {3758, "AuditUpdateStateEventType_EventId"},
+    {3759, "AuditUpdateStateEventType_EventType"},
+    {3760, "AuditUpdateStateEventType_SourceNode"},
+    {3761, "AuditUpdateStateEventType_SourceName"},
+    {3762, "AuditUpdateStateEventType_Time"},
+    {3763, "AuditUpdateStateEventType_ReceiveTime"},
+    {3764, "AuditUpdateStateEventType_LocalTime"},
+    {3765, "AuditUpdateStateEventType_Message"},
+    {3766, "AuditUpdateStateEventType_Severity"},
+    {3767, "AuditUpdateStateEventType_ActionTimeStamp"},
+    {3768, "AuditUpdateStateEventType_Status"},
+    {3769, "AuditUpdateStateEventType_ServerId"},
+    {3770, "AuditUpdateStateEventType_ClientAuditEntryId"},
+    {3771, "AuditUpdateStateEventType_ClientUserId"},
+    {3772, "AuditUpdateStateEventType_MethodId"},
+    {3773, "AuditUpdateStateEventType_InputArguments"},
+    {3774, "AnalogItemType_Definition"},
+    {3775, "AnalogItemType_ValuePrecision"},
+    {3776, "DiscreteItemType_Definition"},
+    {3777, "DiscreteItemType_ValuePrecision"},
+    {3778, "TwoStateDiscreteType_Definition"},
+    {3779, "TwoStateDiscreteType_ValuePrecision"},
+    {3780, "MultiStateDiscreteType_Definition"},
+    {3781, "MultiStateDiscreteType_ValuePrecision"},
+    {3782, "ProgramTransitionEventType_EventId"},
+    {3783, "ProgramTransitionEventType_EventType"},
+    {3784, "ProgramTransitionEventType_SourceNode"},
+    {3785, "ProgramTransitionEventType_SourceName"},
+    {3786, "ProgramTransitionEventType_Time"},
+    {3787, "ProgramTransitionEventType_ReceiveTime"},
+    {3788, "ProgramTransitionEventType_LocalTime"},
+    {3789, "ProgramTransitionEventType_Message"},
+    {3790, "ProgramTransitionEventType_Severity"},
+    {3791, "ProgramTransitionEventType_FromState"},
+    {3792, "ProgramTransitionEventType_FromState_Id"},
+    {3793, "ProgramTransitionEventType_FromState_Name"},
+    {3794, "ProgramTransitionEventType_FromState_Number"},
+    {3795, "ProgramTransitionEventType_FromState_EffectiveDisplayName"},
+    {3796, "ProgramTransitionEventType_ToState"},
+    {3797, "ProgramTransitionEventType_ToState_Id"},
+    {3798, "ProgramTransitionEventType_ToState_Name"},
+    {3799, "ProgramTransitionEventType_ToState_Number"},
+    {3800, "ProgramTransitionEventType_ToState_EffectiveDisplayName"},
+    {3801, "ProgramTransitionEventType_Transition"},
+    {3802, "ProgramTransitionEventType_Transition_Id"},
+    {3803, "ProgramTransitionEventType_Transition_Name"},
+    {3804, "ProgramTransitionEventType_Transition_Number"},
+    {3805, "ProgramTransitionEventType_Transition_TransitionTime"},
+    {3806, "ProgramTransitionAuditEventType"},
+    {3807, "ProgramTransitionAuditEventType_EventId"},
+    {3808, "ProgramTransitionAuditEventType_EventType"},
+    {3809, "ProgramTransitionAuditEventType_SourceNode"},
+    {3810, "ProgramTransitionAuditEventType_SourceName"},
+    {3811, "ProgramTransitionAuditEventType_Time"},
+    {3812, "ProgramTransitionAuditEventType_ReceiveTime"},
+    {3813, "ProgramTransitionAuditEventType_LocalTime"},
+    {3814, "ProgramTransitionAuditEventType_Message"},
+    {3815, "ProgramTransitionAuditEventType_Severity"},
+    {3816, "ProgramTransitionAuditEventType_ActionTimeStamp"},
+    {3817, "ProgramTransitionAuditEventType_Status"},
+    {3818, "ProgramTransitionAuditEventType_ServerId"},
+    {3819, "ProgramTransitionAuditEventType_ClientAuditEntryId"},
+    {3820, "ProgramTransitionAuditEventType_ClientUserId"},
+    {3821, "ProgramTransitionAuditEventType_MethodId"},
+    {3822, "ProgramTransitionAuditEventType_InputArguments"},
+    {3823, "ProgramTransitionAuditEventType_OldStateId"},
+    {3824, "ProgramTransitionAuditEventType_NewStateId"},
+    {3825, "ProgramTransitionAuditEventType_Transition"},
+    {3826, "ProgramTransitionAuditEventType_Transition_Id"},
+    {3827, "ProgramTransitionAuditEventType_Transition_Name"},
+    {3828, "ProgramTransitionAuditEventType_Transition_Number"},
+    {3829, "ProgramTransitionAuditEventType_Transition_TransitionTime"},
+    {3830, "ProgramStateMachineType_CurrentState"},
+    {3831, "ProgramStateMachineType_CurrentState_Id"},
+    {3832, "ProgramStateMachineType_CurrentState_Name"},
+    {3833, "ProgramStateMachineType_CurrentState_Number"},
+    {3834, "ProgramStateMachineType_CurrentState_EffectiveDisplayName"},
+    {3835, "ProgramStateMachineType_LastTransition"},
+    {3836, "ProgramStateMachineType_LastTransition_Id"},
+    {3837, "ProgramStateMachineType_LastTransition_Name"},
+    {3838, "ProgramStateMachineType_LastTransition_Number"},
+    {3839, "ProgramStateMachineType_LastTransition_TransitionTime"},
+    {3840, "ProgramStateMachineType_ProgramDiagnostics_CreateSessionId"},
+    {3841, "ProgramStateMachineType_ProgramDiagnostics_CreateClientName"},
+    {3842, "ProgramStateMachineType_ProgramDiagnostics_InvocationCreationTime"},
+    {3843, "ProgramStateMachineType_ProgramDiagnostics_LastTransitionTime"},
+    {3844, "ProgramStateMachineType_ProgramDiagnostics_LastMethodCall"},
+    {3845, "ProgramStateMachineType_ProgramDiagnostics_LastMethodSessionId"},
+    {3846, "ProgramStateMachineType_ProgramDiagnostics_LastMethodInputArguments"},
+    {3847, "ProgramStateMachineType_ProgramDiagnostics_LastMethodOutputArguments"},
+    {3848, "ProgramStateMachineType_ProgramDiagnostics_LastMethodCallTime"},
+    {3849, "ProgramStateMachineType_ProgramDiagnostics_LastMethodReturnStatus"},
+    {3850, "ProgramStateMachineType_FinalResultData"},
+    {3863, "AddCommentMethodType"},
+    {3864, "AddCommentMethodType_InputArguments"},
+    {3865, "ConditionType_EventId"},
+    {3866, "ConditionType_EventType"},
+    {3867, "ConditionType_SourceNode"},
+    {3868, "ConditionType_SourceName"},
+    {3869, "ConditionType_Time"},
+    {3870, "ConditionType_ReceiveTime"},
+    {3871, "ConditionType_LocalTime"},
+    {3872, "ConditionType_Message"},
+    {3873, "ConditionType_Severity"},
+    {3874, "ConditionType_Retain"},
+    {3875, "ConditionType_ConditionRefresh"},
+    {3876, "ConditionType_ConditionRefresh_InputArguments"},
+    {3969, "RefreshStartEventType_EventId"},
+    {3970, "RefreshStartEventType_EventType"},
+    {3971, "RefreshStartEventType_SourceNode"},
+    {3972, "RefreshStartEventType_SourceName"},
+    {3973, "RefreshStartEventType_Time"},
+    {3974, "RefreshStartEventType_ReceiveTime"},
+    {3975, "RefreshStartEventType_LocalTime"},
+    {3976, "RefreshStartEventType_Message"},
+    {3977, "RefreshStartEventType_Severity"},
+    {3978, "RefreshEndEventType_EventId"},
+    {3979, "RefreshEndEventType_EventType"},
+    {3980, "RefreshEndEventType_SourceNode"},
+    {3981, "RefreshEndEventType_SourceName"},
+    {3982, "RefreshEndEventType_Time"},
+    {3983, "RefreshEndEventType_ReceiveTime"},
+    {3984, "RefreshEndEventType_LocalTime"},
+    {3985, "RefreshEndEventType_Message"},
+    {3986, "RefreshEndEventType_Severity"},
+    {3987, "RefreshRequiredEventType_EventId"},
+    {3988, "RefreshRequiredEventType_EventType"},
+    {3989, "RefreshRequiredEventType_SourceNode"},
+    {3990, "RefreshRequiredEventType_SourceName"},
+    {3991, "RefreshRequiredEventType_Time"},
+    {3992, "RefreshRequiredEventType_ReceiveTime"},
+    {3993, "RefreshRequiredEventType_LocalTime"},
+    {3994, "RefreshRequiredEventType_Message"},
+    {3995, "RefreshRequiredEventType_Severity"},
+    {3996, "AuditConditionEventType_EventId"},
+    {3997, "AuditConditionEventType_EventType"},
+    {3998, "AuditConditionEventType_SourceNode"},
+    {3999, "AuditConditionEventType_SourceName"},
+    {4000, "AuditConditionEventType_Time"},
+    {4001, "AuditConditionEventType_ReceiveTime"},
+    {4002, "AuditConditionEventType_LocalTime"},
+    {4003, "AuditConditionEventType_Message"},
+    {4004, "AuditConditionEventType_Severity"},
+    {4005, "AuditConditionEventType_ActionTimeStamp"},
+    {4006, "AuditConditionEventType_Status"},
+    {4007, "AuditConditionEventType_ServerId"},
+    {4008, "AuditConditionEventType_ClientAuditEntryId"},
+    {4009, "AuditConditionEventType_ClientUserId"},
+    {4010, "AuditConditionEventType_MethodId"},
+    {4011, "AuditConditionEventType_InputArguments"},
+    {4106, "AuditConditionEnableEventType_EventId"},
+    {4107, "AuditConditionEnableEventType_EventType"},
+    {4108, "AuditConditionEnableEventType_SourceNode"},
+    {4109, "AuditConditionEnableEventType_SourceName"},
+    {4110, "AuditConditionEnableEventType_Time"},
+    {4111, "AuditConditionEnableEventType_ReceiveTime"},
+    {4112, "AuditConditionEnableEventType_LocalTime"},
+    {4113, "AuditConditionEnableEventType_Message"},
+    {4114, "AuditConditionEnableEventType_Severity"},
+    {4115, "AuditConditionEnableEventType_ActionTimeStamp"},
+    {4116, "AuditConditionEnableEventType_Status"},
+    {4117, "AuditConditionEnableEventType_ServerId"},
+    {4118, "AuditConditionEnableEventType_ClientAuditEntryId"},
+    {4119, "AuditConditionEnableEventType_ClientUserId"},
+    {4120, "AuditConditionEnableEventType_MethodId"},
+    {4121, "AuditConditionEnableEventType_InputArguments"},
+    {4170, "AuditConditionCommentEventType_EventId"},
+    {4171, "AuditConditionCommentEventType_EventType"},
+    {4172, "AuditConditionCommentEventType_SourceNode"},
+    {4173, "AuditConditionCommentEventType_SourceName"},
+    {4174, "AuditConditionCommentEventType_Time"},
+    {4175, "AuditConditionCommentEventType_ReceiveTime"},
+    {4176, "AuditConditionCommentEventType_LocalTime"},
+    {4177, "AuditConditionCommentEventType_Message"},
+    {4178, "AuditConditionCommentEventType_Severity"},
+    {4179, "AuditConditionCommentEventType_ActionTimeStamp"},
+    {4180, "AuditConditionCommentEventType_Status"},
+    {4181, "AuditConditionCommentEventType_ServerId"},
+    {4182, "AuditConditionCommentEventType_ClientAuditEntryId"},
+    {4183, "AuditConditionCommentEventType_ClientUserId"},
+    {4184, "AuditConditionCommentEventType_MethodId"},
+    {4185, "AuditConditionCommentEventType_InputArguments"},
+    {4188, "DialogConditionType_EventId"},
+    {4189, "DialogConditionType_EventType"},
+    {4190, "DialogConditionType_SourceNode"},
+    {4191, "DialogConditionType_SourceName"},
+    {4192, "DialogConditionType_Time"},
+    {4193, "DialogConditionType_ReceiveTime"},
+    {4194, "DialogConditionType_LocalTime"},
+    {4195, "DialogConditionType_Message"},
+    {4196, "DialogConditionType_Severity"},
+    {4197, "DialogConditionType_Retain"},
+    {4198, "DialogConditionType_ConditionRefresh"},
+    {4199, "DialogConditionType_ConditionRefresh_InputArguments"},
+    {5113, "AcknowledgeableConditionType_EventId"},
+    {5114, "AcknowledgeableConditionType_EventType"},
+    {5115, "AcknowledgeableConditionType_SourceNode"},
+    {5116, "AcknowledgeableConditionType_SourceName"},
+    {5117, "AcknowledgeableConditionType_Time"},
+    {5118, "AcknowledgeableConditionType_ReceiveTime"},
+    {5119, "AcknowledgeableConditionType_LocalTime"},
+    {5120, "AcknowledgeableConditionType_Message"},
+    {5121, "AcknowledgeableConditionType_Severity"},
+    {5122, "AcknowledgeableConditionType_Retain"},
+    {5123, "AcknowledgeableConditionType_ConditionRefresh"},
+    {5124, "AcknowledgeableConditionType_ConditionRefresh_InputArguments"},
+    {5540, "AlarmConditionType_EventId"},
+    {5541, "AlarmConditionType_EventType"},
+    {5542, "AlarmConditionType_SourceNode"},
+    {5543, "AlarmConditionType_SourceName"},
+    {5544, "AlarmConditionType_Time"},
+    {5545, "AlarmConditionType_ReceiveTime"},
+    {5546, "AlarmConditionType_LocalTime"},
+    {5547, "AlarmConditionType_Message"},
+    {5548, "AlarmConditionType_Severity"},
+    {5549, "AlarmConditionType_Retain"},
+    {5550, "AlarmConditionType_ConditionRefresh"},
+    {5551, "AlarmConditionType_ConditionRefresh_InputArguments"},
+    {6088, "ShelvedStateMachineType_CurrentState"},
+    {6089, "ShelvedStateMachineType_CurrentState_Id"},
+    {6090, "ShelvedStateMachineType_CurrentState_Name"},
+    {6091, "ShelvedStateMachineType_CurrentState_Number"},
+    {6092, "ShelvedStateMachineType_CurrentState_EffectiveDisplayName"},
+    {6093, "ShelvedStateMachineType_LastTransition"},
+    {6094, "ShelvedStateMachineType_LastTransition_Id"},
+    {6095, "ShelvedStateMachineType_LastTransition_Name"},
+    {6096, "ShelvedStateMachineType_LastTransition_Number"},
+    {6097, "ShelvedStateMachineType_LastTransition_TransitionTime"},
+    {6098, "ShelvedStateMachineType_Unshelved_StateNumber"},
+    {6100, "ShelvedStateMachineType_TimedShelved_StateNumber"},
+    {6101, "ShelvedStateMachineType_OneShotShelved_StateNumber"},
+    {6102, "TimedShelveMethodType"},
+    {6103, "TimedShelveMethodType_InputArguments"},
+    {6116, "LimitAlarmType_EventId"},
+    {6117, "LimitAlarmType_EventType"},
+    {6118, "LimitAlarmType_SourceNode"},
+    {6119, "LimitAlarmType_SourceName"},
+    {6120, "LimitAlarmType_Time"},
+    {6121, "LimitAlarmType_ReceiveTime"},
+    {6122, "LimitAlarmType_LocalTime"},
+    {6123, "LimitAlarmType_Message"},
+    {6124, "LimitAlarmType_Severity"},
+    {6125, "LimitAlarmType_Retain"},
+    {6126, "LimitAlarmType_ConditionRefresh"},
+    {6127, "LimitAlarmType_ConditionRefresh_InputArguments"},
+    {7591, "IdType_EnumStrings"},
+    {7594, "EnumValueType"},
+    {7595, "MessageSecurityMode_EnumStrings"},
+    {7596, "UserTokenType_EnumStrings"},
+    {7597, "ApplicationType_EnumStrings"},
+    {7598, "SecurityTokenRequestType_EnumStrings"},
+    {7603, "BrowseDirection_EnumStrings"},
+    {7605, "FilterOperator_EnumStrings"},
+    {7606, "TimestampsToReturn_EnumStrings"},
+    {7608, "MonitoringMode_EnumStrings"},
+    {7609, "DataChangeTrigger_EnumStrings"},
+    {7610, "DeadbandType_EnumStrings"},
+    {7611, "RedundancySupport_EnumStrings"},
+    {7612, "ServerState_EnumStrings"},
+    {7614, "ExceptionDeviationFormat_EnumStrings"},
+    {7616, "EnumValueType_Encoding_DefaultXml"},
+    {7617, "OpcUa_BinarySchema"},
+    {7618, "OpcUa_BinarySchema_DataTypeVersion"},
+    {7619, "OpcUa_BinarySchema_NamespaceUri"},
+    {7650, "OpcUa_BinarySchema_Argument"},
+    {7651, "OpcUa_BinarySchema_Argument_DataTypeVersion"},
+    {7652, "OpcUa_BinarySchema_Argument_DictionaryFragment"},
+    {7656, "OpcUa_BinarySchema_EnumValueType"},
+    {7657, "OpcUa_BinarySchema_EnumValueType_DataTypeVersion"},
+    {7658, "OpcUa_BinarySchema_EnumValueType_DictionaryFragment"},
+    {7659, "OpcUa_BinarySchema_StatusResult"},
+    {7660, "OpcUa_BinarySchema_StatusResult_DataTypeVersion"},
+    {7661, "OpcUa_BinarySchema_StatusResult_DictionaryFragment"},
+    {7662, "OpcUa_BinarySchema_UserTokenPolicy"},
+    {7663, "OpcUa_BinarySchema_UserTokenPolicy_DataTypeVersion"},
+    {7664, "OpcUa_BinarySchema_UserTokenPolicy_DictionaryFragment"},
+    {7665, "OpcUa_BinarySchema_ApplicationDescription"},
+    {7666, "OpcUa_BinarySchema_ApplicationDescription_DataTypeVersion"},
+    {7667, "OpcUa_BinarySchema_ApplicationDescription_DictionaryFragment"},
+    {7668, "OpcUa_BinarySchema_EndpointDescription"},
+    {7669, "OpcUa_BinarySchema_EndpointDescription_DataTypeVersion"},
+    {7670, "OpcUa_BinarySchema_EndpointDescription_DictionaryFragment"},
+    {7671, "OpcUa_BinarySchema_UserIdentityToken"},
+    {7672, "OpcUa_BinarySchema_UserIdentityToken_DataTypeVersion"},
+    {7673, "OpcUa_BinarySchema_UserIdentityToken_DictionaryFragment"},
+    {7674, "OpcUa_BinarySchema_AnonymousIdentityToken"},
+    {7675, "OpcUa_BinarySchema_AnonymousIdentityToken_DataTypeVersion"},
+    {7676, "OpcUa_BinarySchema_AnonymousIdentityToken_DictionaryFragment"},
+    {7677, "OpcUa_BinarySchema_UserNameIdentityToken"},
+    {7678, "OpcUa_BinarySchema_UserNameIdentityToken_DataTypeVersion"},
+    {7679, "OpcUa_BinarySchema_UserNameIdentityToken_DictionaryFragment"},
+    {7680, "OpcUa_BinarySchema_X509IdentityToken"},
+    {7681, "OpcUa_BinarySchema_X509IdentityToken_DataTypeVersion"},
+    {7682, "OpcUa_BinarySchema_X509IdentityToken_DictionaryFragment"},
+    {7683, "OpcUa_BinarySchema_IssuedIdentityToken"},
+    {7684, "OpcUa_BinarySchema_IssuedIdentityToken_DataTypeVersion"},
+    {7685, "OpcUa_BinarySchema_IssuedIdentityToken_DictionaryFragment"},
+    {7686, "OpcUa_BinarySchema_EndpointConfiguration"},
+    {7687, "OpcUa_BinarySchema_EndpointConfiguration_DataTypeVersion"},
+    {7688, "OpcUa_BinarySchema_EndpointConfiguration_DictionaryFragment"},
+    {7692, "OpcUa_BinarySchema_BuildInfo"},
+    {7693, "OpcUa_BinarySchema_BuildInfo_DataTypeVersion"},
+    {7694, "OpcUa_BinarySchema_BuildInfo_DictionaryFragment"},
+    {7698, "OpcUa_BinarySchema_SignedSoftwareCertificate"},
+    {7699, "OpcUa_BinarySchema_SignedSoftwareCertificate_DataTypeVersion"},
+    {7700, "OpcUa_BinarySchema_SignedSoftwareCertificate_DictionaryFragment"},
+    {7728, "OpcUa_BinarySchema_AddNodesItem"},
+    {7729, "OpcUa_BinarySchema_AddNodesItem_DataTypeVersion"},
+    {7730, "OpcUa_BinarySchema_AddNodesItem_DictionaryFragment"},
+    {7731, "OpcUa_BinarySchema_AddReferencesItem"},
+    {7732, "OpcUa_BinarySchema_AddReferencesItem_DataTypeVersion"},
+    {7733, "OpcUa_BinarySchema_AddReferencesItem_DictionaryFragment"},
+    {7734, "OpcUa_BinarySchema_DeleteNodesItem"},
+    {7735, "OpcUa_BinarySchema_DeleteNodesItem_DataTypeVersion"},
+    {7736, "OpcUa_BinarySchema_DeleteNodesItem_DictionaryFragment"},
+    {7737, "OpcUa_BinarySchema_DeleteReferencesItem"},
+    {7738, "OpcUa_BinarySchema_DeleteReferencesItem_DataTypeVersion"},
+    {7739, "OpcUa_BinarySchema_DeleteReferencesItem_DictionaryFragment"},
+    {7782, "OpcUa_BinarySchema_RegisteredServer"},
+    {7783, "OpcUa_BinarySchema_RegisteredServer_DataTypeVersion"},
+    {7784, "OpcUa_BinarySchema_RegisteredServer_DictionaryFragment"},
+    {7929, "OpcUa_BinarySchema_ContentFilterElement"},
+    {7930, "OpcUa_BinarySchema_ContentFilterElement_DataTypeVersion"},
+    {7931, "OpcUa_BinarySchema_ContentFilterElement_DictionaryFragment"},
+    {7932, "OpcUa_BinarySchema_ContentFilter"},
+    {7933, "OpcUa_BinarySchema_ContentFilter_DataTypeVersion"},
+    {7934, "OpcUa_BinarySchema_ContentFilter_DictionaryFragment"},
+    {7935, "OpcUa_BinarySchema_FilterOperand"},
+    {7936, "OpcUa_BinarySchema_FilterOperand_DataTypeVersion"},
+    {7937, "OpcUa_BinarySchema_FilterOperand_DictionaryFragment"},
+    {7938, "OpcUa_BinarySchema_ElementOperand"},
+    {7939, "OpcUa_BinarySchema_ElementOperand_DataTypeVersion"},
+    {7940, "OpcUa_BinarySchema_ElementOperand_DictionaryFragment"},
+    {7941, "OpcUa_BinarySchema_LiteralOperand"},
+    {7942, "OpcUa_BinarySchema_LiteralOperand_DataTypeVersion"},
+    {7943, "OpcUa_BinarySchema_LiteralOperand_DictionaryFragment"},
+    {7944, "OpcUa_BinarySchema_AttributeOperand"},
+    {7945, "OpcUa_BinarySchema_AttributeOperand_DataTypeVersion"},
+    {7946, "OpcUa_BinarySchema_AttributeOperand_DictionaryFragment"},
+    {7947, "OpcUa_BinarySchema_SimpleAttributeOperand"},
+    {7948, "OpcUa_BinarySchema_SimpleAttributeOperand_DataTypeVersion"},
+    {7949, "OpcUa_BinarySchema_SimpleAttributeOperand_DictionaryFragment"},
+    {8004, "OpcUa_BinarySchema_HistoryEvent"},
+    {8005, "OpcUa_BinarySchema_HistoryEvent_DataTypeVersion"},
+    {8006, "OpcUa_BinarySchema_HistoryEvent_DictionaryFragment"},
+    {8067, "OpcUa_BinarySchema_MonitoringFilter"},
+    {8068, "OpcUa_BinarySchema_MonitoringFilter_DataTypeVersion"},
+    {8069, "OpcUa_BinarySchema_MonitoringFilter_DictionaryFragment"},
+    {8073, "OpcUa_BinarySchema_EventFilter"},
+    {8074, "OpcUa_BinarySchema_EventFilter_DataTypeVersion"},
+    {8075, "OpcUa_BinarySchema_EventFilter_DictionaryFragment"},
+    {8076, "OpcUa_BinarySchema_AggregateConfiguration"},
+    {8077, "OpcUa_BinarySchema_AggregateConfiguration_DataTypeVersion"},
+    {8078, "OpcUa_BinarySchema_AggregateConfiguration_DictionaryFragment"},
+    {8172, "OpcUa_BinarySchema_HistoryEventFieldList"},
+    {8173, "OpcUa_BinarySchema_HistoryEventFieldList_DataTypeVersion"},
+    {8174, "OpcUa_BinarySchema_HistoryEventFieldList_DictionaryFragment"},
+    {8208, "OpcUa_BinarySchema_RedundantServerDataType"},
+    {8209, "OpcUa_BinarySchema_RedundantServerDataType_DataTypeVersion"},
+    {8210, "OpcUa_BinarySchema_RedundantServerDataType_DictionaryFragment"},
+    {8211, "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType"},
+    {8212, "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType_DataTypeVersion"},
+    {8213, "OpcUa_BinarySchema_SamplingIntervalDiagnosticsDataType_DictionaryFragment"},
+    {8214, "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType"},
+    {8215, "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType_DataTypeVersion"},
+    {8216, "OpcUa_BinarySchema_ServerDiagnosticsSummaryDataType_DictionaryFragment"},
+    {8217, "OpcUa_BinarySchema_ServerStatusDataType"},
+    {8218, "OpcUa_BinarySchema_ServerStatusDataType_DataTypeVersion"},
+    {8219, "OpcUa_BinarySchema_ServerStatusDataType_DictionaryFragment"},
+    {8220, "OpcUa_BinarySchema_SessionDiagnosticsDataType"},
+    {8221, "OpcUa_BinarySchema_SessionDiagnosticsDataType_DataTypeVersion"},
+    {8222, "OpcUa_BinarySchema_SessionDiagnosticsDataType_DictionaryFragment"},
+    {8223, "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType"},
+    {8224, "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType_DataTypeVersion"},
+    {8225, "OpcUa_BinarySchema_SessionSecurityDiagnosticsDataType_DictionaryFragment"},
+    {8226, "OpcUa_BinarySchema_ServiceCounterDataType"},
+    {8227, "OpcUa_BinarySchema_ServiceCounterDataType_DataTypeVersion"},
+    {8228, "OpcUa_BinarySchema_ServiceCounterDataType_DictionaryFragment"},
+    {8229, "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType"},
+    {8230, "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType_DataTypeVersion"},
+    {8231, "OpcUa_BinarySchema_SubscriptionDiagnosticsDataType_DictionaryFragment"},
+    {8232, "OpcUa_BinarySchema_ModelChangeStructureDataType"},
+    {8233, "OpcUa_BinarySchema_ModelChangeStructureDataType_DataTypeVersion"},
+    {8234, "OpcUa_BinarySchema_ModelChangeStructureDataType_DictionaryFragment"},
+    {8235, "OpcUa_BinarySchema_SemanticChangeStructureDataType"},
+    {8236, "OpcUa_BinarySchema_SemanticChangeStructureDataType_DataTypeVersion"},
+    {8237, "OpcUa_BinarySchema_SemanticChangeStructureDataType_DictionaryFragment"},
+    {8238, "OpcUa_BinarySchema_Range"},
+    {8239, "OpcUa_BinarySchema_Range_DataTypeVersion"},
+    {8240, "OpcUa_BinarySchema_Range_DictionaryFragment"},
+    {8241, "OpcUa_BinarySchema_EUInformation"},
+    {8242, "OpcUa_BinarySchema_EUInformation_DataTypeVersion"},
+    {8243, "OpcUa_BinarySchema_EUInformation_DictionaryFragment"},
+    {8244, "OpcUa_BinarySchema_Annotation"},
+    {8245, "OpcUa_BinarySchema_Annotation_DataTypeVersion"},
+    {8246, "OpcUa_BinarySchema_Annotation_DictionaryFragment"},
+    {8247, "OpcUa_BinarySchema_ProgramDiagnosticDataType"},
+    {8248, "OpcUa_BinarySchema_ProgramDiagnosticDataType_DataTypeVersion"},
+    {8249, "OpcUa_BinarySchema_ProgramDiagnosticDataType_DictionaryFragment"},
+    {8251, "EnumValueType_Encoding_DefaultBinary"},
+    {8252, "OpcUa_XmlSchema"},
+    {8253, "OpcUa_XmlSchema_DataTypeVersion"},
+    {8254, "OpcUa_XmlSchema_NamespaceUri"},
+    {8285, "OpcUa_XmlSchema_Argument"},
+    {8286, "OpcUa_XmlSchema_Argument_DataTypeVersion"},
+    {8287, "OpcUa_XmlSchema_Argument_DictionaryFragment"},
+    {8291, "OpcUa_XmlSchema_EnumValueType"},
+    {8292, "OpcUa_XmlSchema_EnumValueType_DataTypeVersion"},
+    {8293, "OpcUa_XmlSchema_EnumValueType_DictionaryFragment"},
+    {8294, "OpcUa_XmlSchema_StatusResult"},
+    {8295, "OpcUa_XmlSchema_StatusResult_DataTypeVersion"},
+    {8296, "OpcUa_XmlSchema_StatusResult_DictionaryFragment"},
+    {8297, "OpcUa_XmlSchema_UserTokenPolicy"},
+    {8298, "OpcUa_XmlSchema_UserTokenPolicy_DataTypeVersion"},
+    {8299, "OpcUa_XmlSchema_UserTokenPolicy_DictionaryFragment"},
+    {8300, "OpcUa_XmlSchema_ApplicationDescription"},
+    {8301, "OpcUa_XmlSchema_ApplicationDescription_DataTypeVersion"},
+    {8302, "OpcUa_XmlSchema_ApplicationDescription_DictionaryFragment"},
+    {8303, "OpcUa_XmlSchema_EndpointDescription"},
+    {8304, "OpcUa_XmlSchema_EndpointDescription_DataTypeVersion"},
+    {8305, "OpcUa_XmlSchema_EndpointDescription_DictionaryFragment"},
+    {8306, "OpcUa_XmlSchema_UserIdentityToken"},
+    {8307, "OpcUa_XmlSchema_UserIdentityToken_DataTypeVersion"},
+    {8308, "OpcUa_XmlSchema_UserIdentityToken_DictionaryFragment"},
+    {8309, "OpcUa_XmlSchema_AnonymousIdentityToken"},
+    {8310, "OpcUa_XmlSchema_AnonymousIdentityToken_DataTypeVersion"},
+    {8311, "OpcUa_XmlSchema_AnonymousIdentityToken_DictionaryFragment"},
+    {8312, "OpcUa_XmlSchema_UserNameIdentityToken"},
+    {8313, "OpcUa_XmlSchema_UserNameIdentityToken_DataTypeVersion"},
+    {8314, "OpcUa_XmlSchema_UserNameIdentityToken_DictionaryFragment"},
+    {8315, "OpcUa_XmlSchema_X509IdentityToken"},
+    {8316, "OpcUa_XmlSchema_X509IdentityToken_DataTypeVersion"},
+    {8317, "OpcUa_XmlSchema_X509IdentityToken_DictionaryFragment"},
+    {8318, "OpcUa_XmlSchema_IssuedIdentityToken"},
+    {8319, "OpcUa_XmlSchema_IssuedIdentityToken_DataTypeVersion"},
+    {8320, "OpcUa_XmlSchema_IssuedIdentityToken_DictionaryFragment"},
+    {8321, "OpcUa_XmlSchema_EndpointConfiguration"},
+    {8322, "OpcUa_XmlSchema_EndpointConfiguration_DataTypeVersion"},
+    {8323, "OpcUa_XmlSchema_EndpointConfiguration_DictionaryFragment"},
+    {8327, "OpcUa_XmlSchema_BuildInfo"},
+    {8328, "OpcUa_XmlSchema_BuildInfo_DataTypeVersion"},
+    {8329, "OpcUa_XmlSchema_BuildInfo_DictionaryFragment"},
+    {8333, "OpcUa_XmlSchema_SignedSoftwareCertificate"},
+    {8334, "OpcUa_XmlSchema_SignedSoftwareCertificate_DataTypeVersion"},
+    {8335, "OpcUa_XmlSchema_SignedSoftwareCertificate_DictionaryFragment"},
+    {8363, "OpcUa_XmlSchema_AddNodesItem"},
+    {8364, "OpcUa_XmlSchema_AddNodesItem_DataTypeVersion"},
+    {8365, "OpcUa_XmlSchema_AddNodesItem_DictionaryFragment"},
+    {8366, "OpcUa_XmlSchema_AddReferencesItem"},
+    {8367, "OpcUa_XmlSchema_AddReferencesItem_DataTypeVersion"},
+    {8368, "OpcUa_XmlSchema_AddReferencesItem_DictionaryFragment"},
+    {8369, "OpcUa_XmlSchema_DeleteNodesItem"},
+    {8370, "OpcUa_XmlSchema_DeleteNodesItem_DataTypeVersion"},
+    {8371, "OpcUa_XmlSchema_DeleteNodesItem_DictionaryFragment"},
+    {8372, "OpcUa_XmlSchema_DeleteReferencesItem"},
+    {8373, "OpcUa_XmlSchema_DeleteReferencesItem_DataTypeVersion"},
+    {8374, "OpcUa_XmlSchema_DeleteReferencesItem_DictionaryFragment"},
+    {8417, "OpcUa_XmlSchema_RegisteredServer"},
+    {8418, "OpcUa_XmlSchema_RegisteredServer_DataTypeVersion"},
+    {8419, "OpcUa_XmlSchema_RegisteredServer_DictionaryFragment"},
+    {8564, "OpcUa_XmlSchema_ContentFilterElement"},
+    {8565, "OpcUa_XmlSchema_ContentFilterElement_DataTypeVersion"},
+    {8566, "OpcUa_XmlSchema_ContentFilterElement_DictionaryFragment"},
+    {8567, "OpcUa_XmlSchema_ContentFilter"},
+    {8568, "OpcUa_XmlSchema_ContentFilter_DataTypeVersion"},
+    {8569, "OpcUa_XmlSchema_ContentFilter_DictionaryFragment"},
+    {8570, "OpcUa_XmlSchema_FilterOperand"},
+    {8571, "OpcUa_XmlSchema_FilterOperand_DataTypeVersion"},
+    {8572, "OpcUa_XmlSchema_FilterOperand_DictionaryFragment"},
+    {8573, "OpcUa_XmlSchema_ElementOperand"},
+    {8574, "OpcUa_XmlSchema_ElementOperand_DataTypeVersion"},
+    {8575, "OpcUa_XmlSchema_ElementOperand_DictionaryFragment"},
+    {8576, "OpcUa_XmlSchema_LiteralOperand"},
+    {8577, "OpcUa_XmlSchema_LiteralOperand_DataTypeVersion"},
+    {8578, "OpcUa_XmlSchema_LiteralOperand_DictionaryFragment"},
+    {8579, "OpcUa_XmlSchema_AttributeOperand"},
+    {8580, "OpcUa_XmlSchema_AttributeOperand_DataTypeVersion"},
+    {8581, "OpcUa_XmlSchema_AttributeOperand_DictionaryFragment"},
+    {8582, "OpcUa_XmlSchema_SimpleAttributeOperand"},
+    {8583, "OpcUa_XmlSchema_SimpleAttributeOperand_DataTypeVersion"},
+    {8584, "OpcUa_XmlSchema_SimpleAttributeOperand_DictionaryFragment"},
+    {8639, "OpcUa_XmlSchema_HistoryEvent"},
+    {8640, "OpcUa_XmlSchema_HistoryEvent_DataTypeVersion"},
+    {8641, "OpcUa_XmlSchema_HistoryEvent_DictionaryFragment"},
+    {8702, "OpcUa_XmlSchema_MonitoringFilter"},
+    {8703, "OpcUa_XmlSchema_MonitoringFilter_DataTypeVersion"},
+    {8704, "OpcUa_XmlSchema_MonitoringFilter_DictionaryFragment"},
+    {8708, "OpcUa_XmlSchema_EventFilter"},
+    {8709, "OpcUa_XmlSchema_EventFilter_DataTypeVersion"},
+    {8710, "OpcUa_XmlSchema_EventFilter_DictionaryFragment"},
+    {8711, "OpcUa_XmlSchema_AggregateConfiguration"},
+    {8712, "OpcUa_XmlSchema_AggregateConfiguration_DataTypeVersion"},
+    {8713, "OpcUa_XmlSchema_AggregateConfiguration_DictionaryFragment"},
+    {8807, "OpcUa_XmlSchema_HistoryEventFieldList"},
+    {8808, "OpcUa_XmlSchema_HistoryEventFieldList_DataTypeVersion"},
+    {8809, "OpcUa_XmlSchema_HistoryEventFieldList_DictionaryFragment"},
+    {8843, "OpcUa_XmlSchema_RedundantServerDataType"},
+    {8844, "OpcUa_XmlSchema_RedundantServerDataType_DataTypeVersion"},
+    {8845, "OpcUa_XmlSchema_RedundantServerDataType_DictionaryFragment"},
+    {8846, "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType"},
+    {8847, "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType_DataTypeVersion"},
+    {8848, "OpcUa_XmlSchema_SamplingIntervalDiagnosticsDataType_DictionaryFragment"},
+    {8849, "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType"},
+    {8850, "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType_DataTypeVersion"},
+    {8851, "OpcUa_XmlSchema_ServerDiagnosticsSummaryDataType_DictionaryFragment"},
+    {8852, "OpcUa_XmlSchema_ServerStatusDataType"},
+    {8853, "OpcUa_XmlSchema_ServerStatusDataType_DataTypeVersion"},
+    {8854, "OpcUa_XmlSchema_ServerStatusDataType_DictionaryFragment"},
+    {8855, "OpcUa_XmlSchema_SessionDiagnosticsDataType"},
+    {8856, "OpcUa_XmlSchema_SessionDiagnosticsDataType_DataTypeVersion"},
+    {8857, "OpcUa_XmlSchema_SessionDiagnosticsDataType_DictionaryFragment"},
+    {8858, "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType"},
+    {8859, "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType_DataTypeVersion"},
+    {8860, "OpcUa_XmlSchema_SessionSecurityDiagnosticsDataType_DictionaryFragment"},
+    {8861, "OpcUa_XmlSchema_ServiceCounterDataType"},
+    {8862, "OpcUa_XmlSchema_ServiceCounterDataType_DataTypeVersion"},
+    {8863, "OpcUa_XmlSchema_ServiceCounterDataType_DictionaryFragment"},
+    {8864, "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType"},
+    {8865, "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType_DataTypeVersion"},
+    {8866, "OpcUa_XmlSchema_SubscriptionDiagnosticsDataType_DictionaryFragment"},
+    {8867, "OpcUa_XmlSchema_ModelChangeStructureDataType"},
+    {8868, "OpcUa_XmlSchema_ModelChangeStructureDataType_DataTypeVersion"},
+    {8869, "OpcUa_XmlSchema_ModelChangeStructureDataType_DictionaryFragment"},
+    {8870, "OpcUa_XmlSchema_SemanticChangeStructureDataType"},
+    {8871, "OpcUa_XmlSchema_SemanticChangeStructureDataType_DataTypeVersion"},
+    {8872, "OpcUa_XmlSchema_SemanticChangeStructureDataType_DictionaryFragment"},
+    {8873, "OpcUa_XmlSchema_Range"},
+    {8874, "OpcUa_XmlSchema_Range_DataTypeVersion"},
+    {8875, "OpcUa_XmlSchema_Range_DictionaryFragment"},
+    {8876, "OpcUa_XmlSchema_EUInformation"},
+    {8877, "OpcUa_XmlSchema_EUInformation_DataTypeVersion"},
+    {8878, "OpcUa_XmlSchema_EUInformation_DictionaryFragment"},
+    {8879, "OpcUa_XmlSchema_Annotation"},
+    {8880, "OpcUa_XmlSchema_Annotation_DataTypeVersion"},
+    {8881, "OpcUa_XmlSchema_Annotation_DictionaryFragment"},
+    {8882, "OpcUa_XmlSchema_ProgramDiagnosticDataType"},
+    {8883, "OpcUa_XmlSchema_ProgramDiagnosticDataType_DataTypeVersion"},
+    {8884, "OpcUa_XmlSchema_ProgramDiagnosticDataType_DictionaryFragment"},
+    {8888, "SubscriptionDiagnosticsType_MaxLifetimeCount"},
+    {8889, "SubscriptionDiagnosticsType_LatePublishRequestCount"},
+    {8890, "SubscriptionDiagnosticsType_CurrentKeepAliveCount"},
+    {8891, "SubscriptionDiagnosticsType_CurrentLifetimeCount"},
+    {8892, "SubscriptionDiagnosticsType_UnacknowledgedMessageCount"},
+    {8893, "SubscriptionDiagnosticsType_DiscardedMessageCount"},
+    {8894, "SubscriptionDiagnosticsType_MonitoredItemCount"},
+    {8895, "SubscriptionDiagnosticsType_DisabledMonitoredItemCount"},
+    {8896, "SubscriptionDiagnosticsType_MonitoringQueueOverflowCount"},
+    {8897, "SubscriptionDiagnosticsType_NextSequenceNumber"},
+    {8898, "SessionDiagnosticsObjectType_SessionDiagnostics_TotalRequestCount"},
+    {8900, "SessionDiagnosticsVariableType_TotalRequestCount"},
+    {8902, "SubscriptionDiagnosticsType_EventQueueOverFlowCount"},
+    {8912, "TimeZoneDataType"},
+    {8913, "TimeZoneDataType_Encoding_DefaultXml"},
+    {8914, "OpcUa_BinarySchema_TimeZoneDataType"},
+    {8915, "OpcUa_BinarySchema_TimeZoneDataType_DataTypeVersion"},
+    {8916, "OpcUa_BinarySchema_TimeZoneDataType_DictionaryFragment"},
+    {8917, "TimeZoneDataType_Encoding_DefaultBinary"},
+    {8918, "OpcUa_XmlSchema_TimeZoneDataType"},
+    {8919, "OpcUa_XmlSchema_TimeZoneDataType_DataTypeVersion"},
+    {8920, "OpcUa_XmlSchema_TimeZoneDataType_DictionaryFragment"},
+    {8927, "AuditConditionRespondEventType"},
+    {8928, "AuditConditionRespondEventType_EventId"},
+    {8929, "AuditConditionRespondEventType_EventType"},
+    {8930, "AuditConditionRespondEventType_SourceNode"},
+    {8931, "AuditConditionRespondEventType_SourceName"},
+    {8932, "AuditConditionRespondEventType_Time"},
+    {8933, "AuditConditionRespondEventType_ReceiveTime"},
+    {8934, "AuditConditionRespondEventType_LocalTime"},
+    {8935, "AuditConditionRespondEventType_Message"},
+    {8936, "AuditConditionRespondEventType_Severity"},
+    {8937, "AuditConditionRespondEventType_ActionTimeStamp"},
+    {8938, "AuditConditionRespondEventType_Status"},
+    {8939, "AuditConditionRespondEventType_ServerId"},
+    {8940, "AuditConditionRespondEventType_ClientAuditEntryId"},
+    {8941, "AuditConditionRespondEventType_ClientUserId"},
+    {8942, "AuditConditionRespondEventType_MethodId"},
+    {8943, "AuditConditionRespondEventType_InputArguments"},
+    {8944, "AuditConditionAcknowledgeEventType"},
+    {8945, "AuditConditionAcknowledgeEventType_EventId"},
+    {8946, "AuditConditionAcknowledgeEventType_EventType"},
+    {8947, "AuditConditionAcknowledgeEventType_SourceNode"},
+    {8948, "AuditConditionAcknowledgeEventType_SourceName"},
+    {8949, "AuditConditionAcknowledgeEventType_Time"},
+    {8950, "AuditConditionAcknowledgeEventType_ReceiveTime"},
+    {8951, "AuditConditionAcknowledgeEventType_LocalTime"},
+    {8952, "AuditConditionAcknowledgeEventType_Message"},
+    {8953, "AuditConditionAcknowledgeEventType_Severity"},
+    {8954, "AuditConditionAcknowledgeEventType_ActionTimeStamp"},
+    {8955, "AuditConditionAcknowledgeEventType_Status"},
+    {8956, "AuditConditionAcknowledgeEventType_ServerId"},
+    {8957, "AuditConditionAcknowledgeEventType_ClientAuditEntryId"},
+    {8958, "AuditConditionAcknowledgeEventType_ClientUserId"},
+    {8959, "AuditConditionAcknowledgeEventType_MethodId"},
+    {8960, "AuditConditionAcknowledgeEventType_InputArguments"},
+    {8961, "AuditConditionConfirmEventType"},
+    {8962, "AuditConditionConfirmEventType_EventId"},
+    {8963, "AuditConditionConfirmEventType_EventType"},
+    {8964, "AuditConditionConfirmEventType_SourceNode"},
+    {8965, "AuditConditionConfirmEventType_SourceName"},
+    {8966, "AuditConditionConfirmEventType_Time"},
+    {8967, "AuditConditionConfirmEventType_ReceiveTime"},
+    {8968, "AuditConditionConfirmEventType_LocalTime"},
+    {8969, "AuditConditionConfirmEventType_Message"},
+    {8970, "AuditConditionConfirmEventType_Severity"},
+    {8971, "AuditConditionConfirmEventType_ActionTimeStamp"},
+    {8972, "AuditConditionConfirmEventType_Status"},
+    {8973, "AuditConditionConfirmEventType_ServerId"},
+    {8974, "AuditConditionConfirmEventType_ClientAuditEntryId"},
+    {8975, "AuditConditionConfirmEventType_ClientUserId"},
+    {8976, "AuditConditionConfirmEventType_MethodId"},
+    {8977, "AuditConditionConfirmEventType_InputArguments"},
+    {8995, "TwoStateVariableType"},
+    {8996, "TwoStateVariableType_Id"},
+    {8997, "TwoStateVariableType_Name"},
+    {8998, "TwoStateVariableType_Number"},
+    {8999, "TwoStateVariableType_EffectiveDisplayName"},
+    {9000, "TwoStateVariableType_TransitionTime"},
+    {9001, "TwoStateVariableType_EffectiveTransitionTime"},
+    {9002, "ConditionVariableType"},
+    {9003, "ConditionVariableType_SourceTimestamp"},
+    {9004, "HasTrueSubState"},
+    {9005, "HasFalseSubState"},
+    {9006, "HasCondition"},
+    {9007, "ConditionRefreshMethodType"},
+    {9008, "ConditionRefreshMethodType_InputArguments"},
+    {9009, "ConditionType_ConditionName"},
+    {9010, "ConditionType_BranchId"},
+    {9011, "ConditionType_EnabledState"},
+    {9012, "ConditionType_EnabledState_Id"},
+    {9013, "ConditionType_EnabledState_Name"},
+    {9014, "ConditionType_EnabledState_Number"},
+    {9015, "ConditionType_EnabledState_EffectiveDisplayName"},
+    {9016, "ConditionType_EnabledState_TransitionTime"},
+    {9017, "ConditionType_EnabledState_EffectiveTransitionTime"},
+    {9018, "ConditionType_EnabledState_TrueState"},
+    {9019, "ConditionType_EnabledState_FalseState"},
+    {9020, "ConditionType_Quality"},
+    {9021, "ConditionType_Quality_SourceTimestamp"},
+    {9022, "ConditionType_LastSeverity"},
+    {9023, "ConditionType_LastSeverity_SourceTimestamp"},
+    {9024, "ConditionType_Comment"},
+    {9025, "ConditionType_Comment_SourceTimestamp"},
+    {9026, "ConditionType_ClientUserId"},
+    {9027, "ConditionType_Enable"},
+    {9028, "ConditionType_Disable"},
+    {9029, "ConditionType_AddComment"},
+    {9030, "ConditionType_AddComment_InputArguments"},
+    {9031, "DialogResponseMethodType"},
+    {9032, "DialogResponseMethodType_InputArguments"},
+    {9033, "DialogConditionType_ConditionName"},
+    {9034, "DialogConditionType_BranchId"},
+    {9035, "DialogConditionType_EnabledState"},
+    {9036, "DialogConditionType_EnabledState_Id"},
+    {9037, "DialogConditionType_EnabledState_Name"},
+    {9038, "DialogConditionType_EnabledState_Number"},
+    {9039, "DialogConditionType_EnabledState_EffectiveDisplayName"},
+    {9040, "DialogConditionType_EnabledState_TransitionTime"},
+    {9041, "DialogConditionType_EnabledState_EffectiveTransitionTime"},
+    {9042, "DialogConditionType_EnabledState_TrueState"},
+    {9043, "DialogConditionType_EnabledState_FalseState"},
+    {9044, "DialogConditionType_Quality"},
+    {9045, "DialogConditionType_Quality_SourceTimestamp"},
+    {9046, "DialogConditionType_LastSeverity"},
+    {9047, "DialogConditionType_LastSeverity_SourceTimestamp"},
+    {9048, "DialogConditionType_Comment"},
+    {9049, "DialogConditionType_Comment_SourceTimestamp"},
+    {9050, "DialogConditionType_ClientUserId"},
+    {9051, "DialogConditionType_Enable"},
+    {9052, "DialogConditionType_Disable"},
+    {9053, "DialogConditionType_AddComment"},
+    {9054, "DialogConditionType_AddComment_InputArguments"},
+    {9055, "DialogConditionType_DialogState"},
+    {9056, "DialogConditionType_DialogState_Id"},
+    {9057, "DialogConditionType_DialogState_Name"},
+    {9058, "DialogConditionType_DialogState_Number"},
+    {9059, "DialogConditionType_DialogState_EffectiveDisplayName"},
+    {9060, "DialogConditionType_DialogState_TransitionTime"},
+    {9061, "DialogConditionType_DialogState_EffectiveTransitionTime"},
+    {9062, "DialogConditionType_DialogState_TrueState"},
+    {9063, "DialogConditionType_DialogState_FalseState"},
+    {9064, "DialogConditionType_ResponseOptionSet"},
+    {9065, "DialogConditionType_DefaultResponse"},
+    {9066, "DialogConditionType_OkResponse"},
+    {9067, "DialogConditionType_CancelResponse"},
+    {9068, "DialogConditionType_LastResponse"},
+    {9069, "DialogConditionType_Respond"},
+    {9070, "DialogConditionType_Respond_InputArguments"},
+    {9071, "AcknowledgeableConditionType_ConditionName"},
+    {9072, "AcknowledgeableConditionType_BranchId"},
+    {9073, "AcknowledgeableConditionType_EnabledState"},
+    {9074, "AcknowledgeableConditionType_EnabledState_Id"},
+    {9075, "AcknowledgeableConditionType_EnabledState_Name"},
+    {9076, "AcknowledgeableConditionType_EnabledState_Number"},
+    {9077, "AcknowledgeableConditionType_EnabledState_EffectiveDisplayName"},
+    {9078, "AcknowledgeableConditionType_EnabledState_TransitionTime"},
+    {9079, "AcknowledgeableConditionType_EnabledState_EffectiveTransitionTime"},
+    {9080, "AcknowledgeableConditionType_EnabledState_TrueState"},
+    {9081, "AcknowledgeableConditionType_EnabledState_FalseState"},
+    {9082, "AcknowledgeableConditionType_Quality"},
+    {9083, "AcknowledgeableConditionType_Quality_SourceTimestamp"},
+    {9084, "AcknowledgeableConditionType_LastSeverity"},
+    {9085, "AcknowledgeableConditionType_LastSeverity_SourceTimestamp"},
+    {9086, "AcknowledgeableConditionType_Comment"},
+    {9087, "AcknowledgeableConditionType_Comment_SourceTimestamp"},
+    {9088, "AcknowledgeableConditionType_ClientUserId"},
+    {9089, "AcknowledgeableConditionType_Enable"},
+    {9090, "AcknowledgeableConditionType_Disable"},
+    {9091, "AcknowledgeableConditionType_AddComment"},
+    {9092, "AcknowledgeableConditionType_AddComment_InputArguments"},
+    {9093, "AcknowledgeableConditionType_AckedState"},
+    {9094, "AcknowledgeableConditionType_AckedState_Id"},
+    {9095, "AcknowledgeableConditionType_AckedState_Name"},
+    {9096, "AcknowledgeableConditionType_AckedState_Number"},
+    {9097, "AcknowledgeableConditionType_AckedState_EffectiveDisplayName"},
+    {9098, "AcknowledgeableConditionType_AckedState_TransitionTime"},
+    {9099, "AcknowledgeableConditionType_AckedState_EffectiveTransitionTime"},
+    {9100, "AcknowledgeableConditionType_AckedState_TrueState"},
+    {9101, "AcknowledgeableConditionType_AckedState_FalseState"},
+    {9102, "AcknowledgeableConditionType_ConfirmedState"},
+    {9103, "AcknowledgeableConditionType_ConfirmedState_Id"},
+    {9104, "AcknowledgeableConditionType_ConfirmedState_Name"},
+    {9105, "AcknowledgeableConditionType_ConfirmedState_Number"},
+    {9106, "AcknowledgeableConditionType_ConfirmedState_EffectiveDisplayName"},
+    {9107, "AcknowledgeableConditionType_ConfirmedState_TransitionTime"},
+    {9108, "AcknowledgeableConditionType_ConfirmedState_EffectiveTransitionTime"},
+    {9109, "AcknowledgeableConditionType_ConfirmedState_TrueState"},
+    {9110, "AcknowledgeableConditionType_ConfirmedState_FalseState"},
+    {9111, "AcknowledgeableConditionType_Acknowledge"},
+    {9112, "AcknowledgeableConditionType_Acknowledge_InputArguments"},
+    {9113, "AcknowledgeableConditionType_Confirm"},
+    {9114, "AcknowledgeableConditionType_Confirm_InputArguments"},
+    {9115, "ShelvedStateMachineType_UnshelveTime"},
+    {9116, "AlarmConditionType_ConditionName"},
+    {9117, "AlarmConditionType_BranchId"},
+    {9118, "AlarmConditionType_EnabledState"},
+    {9119, "AlarmConditionType_EnabledState_Id"},
+    {9120, "AlarmConditionType_EnabledState_Name"},
+    {9121, "AlarmConditionType_EnabledState_Number"},
+    {9122, "AlarmConditionType_EnabledState_EffectiveDisplayName"},
+    {9123, "AlarmConditionType_EnabledState_TransitionTime"},
+    {9124, "AlarmConditionType_EnabledState_EffectiveTransitionTime"},
+    {9125, "AlarmConditionType_EnabledState_TrueState"},
+    {9126, "AlarmConditionType_EnabledState_FalseState"},
+    {9127, "AlarmConditionType_Quality"},
+    {9128, "AlarmConditionType_Quality_SourceTimestamp"},
+    {9129, "AlarmConditionType_LastSeverity"},
+    {9130, "AlarmConditionType_LastSeverity_SourceTimestamp"},
+    {9131, "AlarmConditionType_Comment"},
+    {9132, "AlarmConditionType_Comment_SourceTimestamp"},
+    {9133, "AlarmConditionType_ClientUserId"},
+    {9134, "AlarmConditionType_Enable"},
+    {9135, "AlarmConditionType_Disable"},
+    {9136, "AlarmConditionType_AddComment"},
+    {9137, "AlarmConditionType_AddComment_InputArguments"},
+    {9138, "AlarmConditionType_AckedState"},
+    {9139, "AlarmConditionType_AckedState_Id"},
+    {9140, "AlarmConditionType_AckedState_Name"},
+    {9141, "AlarmConditionType_AckedState_Number"},
+    {9142, "AlarmConditionType_AckedState_EffectiveDisplayName"},
+    {9143, "AlarmConditionType_AckedState_TransitionTime"},
+    {9144, "AlarmConditionType_AckedState_EffectiveTransitionTime"},
+    {9145, "AlarmConditionType_AckedState_TrueState"},
+    {9146, "AlarmConditionType_AckedState_FalseState"},
+    {9147, "AlarmConditionType_ConfirmedState"},
+    {9148, "AlarmConditionType_ConfirmedState_Id"},
+    {9149, "AlarmConditionType_ConfirmedState_Name"},
+    {9150, "AlarmConditionType_ConfirmedState_Number"},
+    {9151, "AlarmConditionType_ConfirmedState_EffectiveDisplayName"},
+    {9152, "AlarmConditionType_ConfirmedState_TransitionTime"},
+    {9153, "AlarmConditionType_ConfirmedState_EffectiveTransitionTime"},
+    {9154, "AlarmConditionType_ConfirmedState_TrueState"},
+    {9155, "AlarmConditionType_ConfirmedState_FalseState"},
+    {9156, "AlarmConditionType_Acknowledge"},
+    {9157, "AlarmConditionType_Acknowledge_InputArguments"},
+    {9158, "AlarmConditionType_Confirm"},
+    {9159, "AlarmConditionType_Confirm_InputArguments"},
+    {9160, "AlarmConditionType_ActiveState"},
+    {9161, "AlarmConditionType_ActiveState_Id"},
+    {9162, "AlarmConditionType_ActiveState_Name"},
+    {9163, "AlarmConditionType_ActiveState_Number"},
+    {9164, "AlarmConditionType_ActiveState_EffectiveDisplayName"},
+    {9165, "AlarmConditionType_ActiveState_TransitionTime"},
+    {9166, "AlarmConditionType_ActiveState_EffectiveTransitionTime"},
+    {9167, "AlarmConditionType_ActiveState_TrueState"},
+    {9168, "AlarmConditionType_ActiveState_FalseState"},
+    {9169, "AlarmConditionType_SuppressedState"},
+    {9170, "AlarmConditionType_SuppressedState_Id"},
+    {9171, "AlarmConditionType_SuppressedState_Name"},
+    {9172, "AlarmConditionType_SuppressedState_Number"},
+    {9173, "AlarmConditionType_SuppressedState_EffectiveDisplayName"},
+    {9174, "AlarmConditionType_SuppressedState_TransitionTime"},
+    {9175, "AlarmConditionType_SuppressedState_EffectiveTransitionTime"},
+    {9176, "AlarmConditionType_SuppressedState_TrueState"},
+    {9177, "AlarmConditionType_SuppressedState_FalseState"},
+    {9178, "AlarmConditionType_ShelvingState"},
+    {9179, "AlarmConditionType_ShelvingState_CurrentState"},
+    {9180, "AlarmConditionType_ShelvingState_CurrentState_Id"},
+    {9181, "AlarmConditionType_ShelvingState_CurrentState_Name"},
+    {9182, "AlarmConditionType_ShelvingState_CurrentState_Number"},
+    {9183, "AlarmConditionType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9184, "AlarmConditionType_ShelvingState_LastTransition"},
+    {9185, "AlarmConditionType_ShelvingState_LastTransition_Id"},
+    {9186, "AlarmConditionType_ShelvingState_LastTransition_Name"},
+    {9187, "AlarmConditionType_ShelvingState_LastTransition_Number"},
+    {9188, "AlarmConditionType_ShelvingState_LastTransition_TransitionTime"},
+    {9189, "AlarmConditionType_ShelvingState_UnshelveTime"},
+    {9211, "AlarmConditionType_ShelvingState_Unshelve"},
+    {9212, "AlarmConditionType_ShelvingState_OneShotShelve"},
+    {9213, "AlarmConditionType_ShelvingState_TimedShelve"},
+    {9214, "AlarmConditionType_ShelvingState_TimedShelve_InputArguments"},
+    {9215, "AlarmConditionType_SuppressedOrShelved"},
+    {9216, "AlarmConditionType_MaxTimeShelved"},
+    {9217, "LimitAlarmType_ConditionName"},
+    {9218, "LimitAlarmType_BranchId"},
+    {9219, "LimitAlarmType_EnabledState"},
+    {9220, "LimitAlarmType_EnabledState_Id"},
+    {9221, "LimitAlarmType_EnabledState_Name"},
+    {9222, "LimitAlarmType_EnabledState_Number"},
+    {9223, "LimitAlarmType_EnabledState_EffectiveDisplayName"},
+    {9224, "LimitAlarmType_EnabledState_TransitionTime"},
+    {9225, "LimitAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9226, "LimitAlarmType_EnabledState_TrueState"},
+    {9227, "LimitAlarmType_EnabledState_FalseState"},
+    {9228, "LimitAlarmType_Quality"},
+    {9229, "LimitAlarmType_Quality_SourceTimestamp"},
+    {9230, "LimitAlarmType_LastSeverity"},
+    {9231, "LimitAlarmType_LastSeverity_SourceTimestamp"},
+    {9232, "LimitAlarmType_Comment"},
+    {9233, "LimitAlarmType_Comment_SourceTimestamp"},
+    {9234, "LimitAlarmType_ClientUserId"},
+    {9235, "LimitAlarmType_Enable"},
+    {9236, "LimitAlarmType_Disable"},
+    {9237, "LimitAlarmType_AddComment"},
+    {9238, "LimitAlarmType_AddComment_InputArguments"},
+    {9239, "LimitAlarmType_AckedState"},
+    {9240, "LimitAlarmType_AckedState_Id"},
+    {9241, "LimitAlarmType_AckedState_Name"},
+    {9242, "LimitAlarmType_AckedState_Number"},
+    {9243, "LimitAlarmType_AckedState_EffectiveDisplayName"},
+    {9244, "LimitAlarmType_AckedState_TransitionTime"},
+    {9245, "LimitAlarmType_AckedState_EffectiveTransitionTime"},
+    {9246, "LimitAlarmType_AckedState_TrueState"},
+    {9247, "LimitAlarmType_AckedState_FalseState"},
+    {9248, "LimitAlarmType_ConfirmedState"},
+    {9249, "LimitAlarmType_ConfirmedState_Id"},
+    {9250, "LimitAlarmType_ConfirmedState_Name"},
+    {9251, "LimitAlarmType_ConfirmedState_Number"},
+    {9252, "LimitAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9253, "LimitAlarmType_ConfirmedState_TransitionTime"},
+    {9254, "LimitAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9255, "LimitAlarmType_ConfirmedState_TrueState"},
+    {9256, "LimitAlarmType_ConfirmedState_FalseState"},
+    {9257, "LimitAlarmType_Acknowledge"},
+    {9258, "LimitAlarmType_Acknowledge_InputArguments"},
+    {9259, "LimitAlarmType_Confirm"},
+    {9260, "LimitAlarmType_Confirm_InputArguments"},
+    {9261, "LimitAlarmType_ActiveState"},
+    {9262, "LimitAlarmType_ActiveState_Id"},
+    {9263, "LimitAlarmType_ActiveState_Name"},
+    {9264, "LimitAlarmType_ActiveState_Number"},
+    {9265, "LimitAlarmType_ActiveState_EffectiveDisplayName"},
+    {9266, "LimitAlarmType_ActiveState_TransitionTime"},
+    {9267, "LimitAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9268, "LimitAlarmType_ActiveState_TrueState"},
+    {9269, "LimitAlarmType_ActiveState_FalseState"},
+    {9270, "LimitAlarmType_SuppressedState"},
+    {9271, "LimitAlarmType_SuppressedState_Id"},
+    {9272, "LimitAlarmType_SuppressedState_Name"},
+    {9273, "LimitAlarmType_SuppressedState_Number"},
+    {9274, "LimitAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9275, "LimitAlarmType_SuppressedState_TransitionTime"},
+    {9276, "LimitAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9277, "LimitAlarmType_SuppressedState_TrueState"},
+    {9278, "LimitAlarmType_SuppressedState_FalseState"},
+    {9279, "LimitAlarmType_ShelvingState"},
+    {9280, "LimitAlarmType_ShelvingState_CurrentState"},
+    {9281, "LimitAlarmType_ShelvingState_CurrentState_Id"},
+    {9282, "LimitAlarmType_ShelvingState_CurrentState_Name"},
+    {9283, "LimitAlarmType_ShelvingState_CurrentState_Number"},
+    {9284, "LimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9285, "LimitAlarmType_ShelvingState_LastTransition"},
+    {9286, "LimitAlarmType_ShelvingState_LastTransition_Id"},
+    {9287, "LimitAlarmType_ShelvingState_LastTransition_Name"},
+    {9288, "LimitAlarmType_ShelvingState_LastTransition_Number"},
+    {9289, "LimitAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9290, "LimitAlarmType_ShelvingState_UnshelveTime"},
+    {9312, "LimitAlarmType_ShelvingState_Unshelve"},
+    {9313, "LimitAlarmType_ShelvingState_OneShotShelve"},
+    {9314, "LimitAlarmType_ShelvingState_TimedShelve"},
+    {9315, "LimitAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {9316, "LimitAlarmType_SuppressedOrShelved"},
+    {9317, "LimitAlarmType_MaxTimeShelved"},
+    {9318, "ExclusiveLimitStateMachineType"},
+    {9319, "ExclusiveLimitStateMachineType_CurrentState"},
+    {9320, "ExclusiveLimitStateMachineType_CurrentState_Id"},
+    {9321, "ExclusiveLimitStateMachineType_CurrentState_Name"},
+    {9322, "ExclusiveLimitStateMachineType_CurrentState_Number"},
+    {9323, "ExclusiveLimitStateMachineType_CurrentState_EffectiveDisplayName"},
+    {9324, "ExclusiveLimitStateMachineType_LastTransition"},
+    {9325, "ExclusiveLimitStateMachineType_LastTransition_Id"},
+    {9326, "ExclusiveLimitStateMachineType_LastTransition_Name"},
+    {9327, "ExclusiveLimitStateMachineType_LastTransition_Number"},
+    {9328, "ExclusiveLimitStateMachineType_LastTransition_TransitionTime"},
+    {9329, "ExclusiveLimitStateMachineType_HighHigh"},
+    {9330, "ExclusiveLimitStateMachineType_HighHigh_StateNumber"},
+    {9331, "ExclusiveLimitStateMachineType_High"},
+    {9332, "ExclusiveLimitStateMachineType_High_StateNumber"},
+    {9333, "ExclusiveLimitStateMachineType_Low"},
+    {9334, "ExclusiveLimitStateMachineType_Low_StateNumber"},
+    {9335, "ExclusiveLimitStateMachineType_LowLow"},
+    {9336, "ExclusiveLimitStateMachineType_LowLow_StateNumber"},
+    {9337, "ExclusiveLimitStateMachineType_LowLowToLow"},
+    {9338, "ExclusiveLimitStateMachineType_LowToLowLow"},
+    {9339, "ExclusiveLimitStateMachineType_HighHighToHigh"},
+    {9340, "ExclusiveLimitStateMachineType_HighToHighHigh"},
+    {9341, "ExclusiveLimitAlarmType"},
+    {9342, "ExclusiveLimitAlarmType_EventId"},
+    {9343, "ExclusiveLimitAlarmType_EventType"},
+    {9344, "ExclusiveLimitAlarmType_SourceNode"},
+    {9345, "ExclusiveLimitAlarmType_SourceName"},
+    {9346, "ExclusiveLimitAlarmType_Time"},
+    {9347, "ExclusiveLimitAlarmType_ReceiveTime"},
+    {9348, "ExclusiveLimitAlarmType_LocalTime"},
+    {9349, "ExclusiveLimitAlarmType_Message"},
+    {9350, "ExclusiveLimitAlarmType_Severity"},
+    {9351, "ExclusiveLimitAlarmType_ConditionName"},
+    {9352, "ExclusiveLimitAlarmType_BranchId"},
+    {9353, "ExclusiveLimitAlarmType_Retain"},
+    {9354, "ExclusiveLimitAlarmType_EnabledState"},
+    {9355, "ExclusiveLimitAlarmType_EnabledState_Id"},
+    {9356, "ExclusiveLimitAlarmType_EnabledState_Name"},
+    {9357, "ExclusiveLimitAlarmType_EnabledState_Number"},
+    {9358, "ExclusiveLimitAlarmType_EnabledState_EffectiveDisplayName"},
+    {9359, "ExclusiveLimitAlarmType_EnabledState_TransitionTime"},
+    {9360, "ExclusiveLimitAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9361, "ExclusiveLimitAlarmType_EnabledState_TrueState"},
+    {9362, "ExclusiveLimitAlarmType_EnabledState_FalseState"},
+    {9363, "ExclusiveLimitAlarmType_Quality"},
+    {9364, "ExclusiveLimitAlarmType_Quality_SourceTimestamp"},
+    {9365, "ExclusiveLimitAlarmType_LastSeverity"},
+    {9366, "ExclusiveLimitAlarmType_LastSeverity_SourceTimestamp"},
+    {9367, "ExclusiveLimitAlarmType_Comment"},
+    {9368, "ExclusiveLimitAlarmType_Comment_SourceTimestamp"},
+    {9369, "ExclusiveLimitAlarmType_ClientUserId"},
+    {9370, "ExclusiveLimitAlarmType_Enable"},
+    {9371, "ExclusiveLimitAlarmType_Disable"},
+    {9372, "ExclusiveLimitAlarmType_AddComment"},
+    {9373, "ExclusiveLimitAlarmType_AddComment_InputArguments"},
+    {9374, "ExclusiveLimitAlarmType_ConditionRefresh"},
+    {9375, "ExclusiveLimitAlarmType_ConditionRefresh_InputArguments"},
+    {9376, "ExclusiveLimitAlarmType_AckedState"},
+    {9377, "ExclusiveLimitAlarmType_AckedState_Id"},
+    {9378, "ExclusiveLimitAlarmType_AckedState_Name"},
+    {9379, "ExclusiveLimitAlarmType_AckedState_Number"},
+    {9380, "ExclusiveLimitAlarmType_AckedState_EffectiveDisplayName"},
+    {9381, "ExclusiveLimitAlarmType_AckedState_TransitionTime"},
+    {9382, "ExclusiveLimitAlarmType_AckedState_EffectiveTransitionTime"},
+    {9383, "ExclusiveLimitAlarmType_AckedState_TrueState"},
+    {9384, "ExclusiveLimitAlarmType_AckedState_FalseState"},
+    {9385, "ExclusiveLimitAlarmType_ConfirmedState"},
+    {9386, "ExclusiveLimitAlarmType_ConfirmedState_Id"},
+    {9387, "ExclusiveLimitAlarmType_ConfirmedState_Name"},
+    {9388, "ExclusiveLimitAlarmType_ConfirmedState_Number"},
+    {9389, "ExclusiveLimitAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9390, "ExclusiveLimitAlarmType_ConfirmedState_TransitionTime"},
+    {9391, "ExclusiveLimitAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9392, "ExclusiveLimitAlarmType_ConfirmedState_TrueState"},
+    {9393, "ExclusiveLimitAlarmType_ConfirmedState_FalseState"},
+    {9394, "ExclusiveLimitAlarmType_Acknowledge"},
+    {9395, "ExclusiveLimitAlarmType_Acknowledge_InputArguments"},
+    {9396, "ExclusiveLimitAlarmType_Confirm"},
+    {9397, "ExclusiveLimitAlarmType_Confirm_InputArguments"},
+    {9398, "ExclusiveLimitAlarmType_ActiveState"},
+    {9399, "ExclusiveLimitAlarmType_ActiveState_Id"},
+    {9400, "ExclusiveLimitAlarmType_ActiveState_Name"},
+    {9401, "ExclusiveLimitAlarmType_ActiveState_Number"},
+    {9402, "ExclusiveLimitAlarmType_ActiveState_EffectiveDisplayName"},
+    {9403, "ExclusiveLimitAlarmType_ActiveState_TransitionTime"},
+    {9404, "ExclusiveLimitAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9405, "ExclusiveLimitAlarmType_ActiveState_TrueState"},
+    {9406, "ExclusiveLimitAlarmType_ActiveState_FalseState"},
+    {9407, "ExclusiveLimitAlarmType_SuppressedState"},
+    {9408, "ExclusiveLimitAlarmType_SuppressedState_Id"},
+    {9409, "ExclusiveLimitAlarmType_SuppressedState_Name"},
+    {9410, "ExclusiveLimitAlarmType_SuppressedState_Number"},
+    {9411, "ExclusiveLimitAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9412, "ExclusiveLimitAlarmType_SuppressedState_TransitionTime"},
+    {9413, "ExclusiveLimitAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9414, "ExclusiveLimitAlarmType_SuppressedState_TrueState"},
+    {9415, "ExclusiveLimitAlarmType_SuppressedState_FalseState"},
+    {9416, "ExclusiveLimitAlarmType_ShelvingState"},
+    {9417, "ExclusiveLimitAlarmType_ShelvingState_CurrentState"},
+    {9418, "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Id"},
+    {9419, "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Name"},
+    {9420, "ExclusiveLimitAlarmType_ShelvingState_CurrentState_Number"},
+    {9421, "ExclusiveLimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9422, "ExclusiveLimitAlarmType_ShelvingState_LastTransition"},
+    {9423, "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Id"},
+    {9424, "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Name"},
+    {9425, "ExclusiveLimitAlarmType_ShelvingState_LastTransition_Number"},
+    {9426, "ExclusiveLimitAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9427, "ExclusiveLimitAlarmType_ShelvingState_UnshelveTime"},
+    {9449, "ExclusiveLimitAlarmType_ShelvingState_Unshelve"},
+    {9450, "ExclusiveLimitAlarmType_ShelvingState_OneShotShelve"},
+    {9451, "ExclusiveLimitAlarmType_ShelvingState_TimedShelve"},
+    {9452, "ExclusiveLimitAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {9453, "ExclusiveLimitAlarmType_SuppressedOrShelved"},
+    {9454, "ExclusiveLimitAlarmType_MaxTimeShelved"},
+    {9455, "ExclusiveLimitAlarmType_LimitState"},
+    {9456, "ExclusiveLimitAlarmType_LimitState_CurrentState"},
+    {9457, "ExclusiveLimitAlarmType_LimitState_CurrentState_Id"},
+    {9458, "ExclusiveLimitAlarmType_LimitState_CurrentState_Name"},
+    {9459, "ExclusiveLimitAlarmType_LimitState_CurrentState_Number"},
+    {9460, "ExclusiveLimitAlarmType_LimitState_CurrentState_EffectiveDisplayName"},
+    {9461, "ExclusiveLimitAlarmType_LimitState_LastTransition"},
+    {9462, "ExclusiveLimitAlarmType_LimitState_LastTransition_Id"},
+    {9463, "ExclusiveLimitAlarmType_LimitState_LastTransition_Name"},
+    {9464, "ExclusiveLimitAlarmType_LimitState_LastTransition_Number"},
+    {9465, "ExclusiveLimitAlarmType_LimitState_LastTransition_TransitionTime"},
+    {9478, "ExclusiveLimitAlarmType_HighHighLimit"},
+    {9479, "ExclusiveLimitAlarmType_HighLimit"},
+    {9480, "ExclusiveLimitAlarmType_LowLimit"},
+    {9481, "ExclusiveLimitAlarmType_LowLowLimit"},
+    {9482, "ExclusiveLevelAlarmType"},
+    {9483, "ExclusiveLevelAlarmType_EventId"},
+    {9484, "ExclusiveLevelAlarmType_EventType"},
+    {9485, "ExclusiveLevelAlarmType_SourceNode"},
+    {9486, "ExclusiveLevelAlarmType_SourceName"},
+    {9487, "ExclusiveLevelAlarmType_Time"},
+    {9488, "ExclusiveLevelAlarmType_ReceiveTime"},
+    {9489, "ExclusiveLevelAlarmType_LocalTime"},
+    {9490, "ExclusiveLevelAlarmType_Message"},
+    {9491, "ExclusiveLevelAlarmType_Severity"},
+    {9492, "ExclusiveLevelAlarmType_ConditionName"},
+    {9493, "ExclusiveLevelAlarmType_BranchId"},
+    {9494, "ExclusiveLevelAlarmType_Retain"},
+    {9495, "ExclusiveLevelAlarmType_EnabledState"},
+    {9496, "ExclusiveLevelAlarmType_EnabledState_Id"},
+    {9497, "ExclusiveLevelAlarmType_EnabledState_Name"},
+    {9498, "ExclusiveLevelAlarmType_EnabledState_Number"},
+    {9499, "ExclusiveLevelAlarmType_EnabledState_EffectiveDisplayName"},
+    {9500, "ExclusiveLevelAlarmType_EnabledState_TransitionTime"},
+    {9501, "ExclusiveLevelAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9502, "ExclusiveLevelAlarmType_EnabledState_TrueState"},
+    {9503, "ExclusiveLevelAlarmType_EnabledState_FalseState"},
+    {9504, "ExclusiveLevelAlarmType_Quality"},
+    {9505, "ExclusiveLevelAlarmType_Quality_SourceTimestamp"},
+    {9506, "ExclusiveLevelAlarmType_LastSeverity"},
+    {9507, "ExclusiveLevelAlarmType_LastSeverity_SourceTimestamp"},
+    {9508, "ExclusiveLevelAlarmType_Comment"},
+    {9509, "ExclusiveLevelAlarmType_Comment_SourceTimestamp"},
+    {9510, "ExclusiveLevelAlarmType_ClientUserId"},
+    {9511, "ExclusiveLevelAlarmType_Enable"},
+    {9512, "ExclusiveLevelAlarmType_Disable"},
+    {9513, "ExclusiveLevelAlarmType_AddComment"},
+    {9514, "ExclusiveLevelAlarmType_AddComment_InputArguments"},
+    {9515, "ExclusiveLevelAlarmType_ConditionRefresh"},
+    {9516, "ExclusiveLevelAlarmType_ConditionRefresh_InputArguments"},
+    {9517, "ExclusiveLevelAlarmType_AckedState"},
+    {9518, "ExclusiveLevelAlarmType_AckedState_Id"},
+    {9519, "ExclusiveLevelAlarmType_AckedState_Name"},
+    {9520, "ExclusiveLevelAlarmType_AckedState_Number"},
+    {9521, "ExclusiveLevelAlarmType_AckedState_EffectiveDisplayName"},
+    {9522, "ExclusiveLevelAlarmType_AckedState_TransitionTime"},
+    {9523, "ExclusiveLevelAlarmType_AckedState_EffectiveTransitionTime"},
+    {9524, "ExclusiveLevelAlarmType_AckedState_TrueState"},
+    {9525, "ExclusiveLevelAlarmType_AckedState_FalseState"},
+    {9526, "ExclusiveLevelAlarmType_ConfirmedState"},
+    {9527, "ExclusiveLevelAlarmType_ConfirmedState_Id"},
+    {9528, "ExclusiveLevelAlarmType_ConfirmedState_Name"},
+    {9529, "ExclusiveLevelAlarmType_ConfirmedState_Number"},
+    {9530, "ExclusiveLevelAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9531, "ExclusiveLevelAlarmType_ConfirmedState_TransitionTime"},
+    {9532, "ExclusiveLevelAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9533, "ExclusiveLevelAlarmType_ConfirmedState_TrueState"},
+    {9534, "ExclusiveLevelAlarmType_ConfirmedState_FalseState"},
+    {9535, "ExclusiveLevelAlarmType_Acknowledge"},
+    {9536, "ExclusiveLevelAlarmType_Acknowledge_InputArguments"},
+    {9537, "ExclusiveLevelAlarmType_Confirm"},
+    {9538, "ExclusiveLevelAlarmType_Confirm_InputArguments"},
+    {9539, "ExclusiveLevelAlarmType_ActiveState"},
+    {9540, "ExclusiveLevelAlarmType_ActiveState_Id"},
+    {9541, "ExclusiveLevelAlarmType_ActiveState_Name"},
+    {9542, "ExclusiveLevelAlarmType_ActiveState_Number"},
+    {9543, "ExclusiveLevelAlarmType_ActiveState_EffectiveDisplayName"},
+    {9544, "ExclusiveLevelAlarmType_ActiveState_TransitionTime"},
+    {9545, "ExclusiveLevelAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9546, "ExclusiveLevelAlarmType_ActiveState_TrueState"},
+    {9547, "ExclusiveLevelAlarmType_ActiveState_FalseState"},
+    {9548, "ExclusiveLevelAlarmType_SuppressedState"},
+    {9549, "ExclusiveLevelAlarmType_SuppressedState_Id"},
+    {9550, "ExclusiveLevelAlarmType_SuppressedState_Name"},
+    {9551, "ExclusiveLevelAlarmType_SuppressedState_Number"},
+    {9552, "ExclusiveLevelAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9553, "ExclusiveLevelAlarmType_SuppressedState_TransitionTime"},
+    {9554, "ExclusiveLevelAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9555, "ExclusiveLevelAlarmType_SuppressedState_TrueState"},
+    {9556, "ExclusiveLevelAlarmType_SuppressedState_FalseState"},
+    {9557, "ExclusiveLevelAlarmType_ShelvingState"},
+    {9558, "ExclusiveLevelAlarmType_ShelvingState_CurrentState"},
+    {9559, "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Id"},
+    {9560, "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Name"},
+    {9561, "ExclusiveLevelAlarmType_ShelvingState_CurrentState_Number"},
+    {9562, "ExclusiveLevelAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9563, "ExclusiveLevelAlarmType_ShelvingState_LastTransition"},
+    {9564, "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Id"},
+    {9565, "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Name"},
+    {9566, "ExclusiveLevelAlarmType_ShelvingState_LastTransition_Number"},
+    {9567, "ExclusiveLevelAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9568, "ExclusiveLevelAlarmType_ShelvingState_UnshelveTime"},
+    {9590, "ExclusiveLevelAlarmType_ShelvingState_Unshelve"},
+    {9591, "ExclusiveLevelAlarmType_ShelvingState_OneShotShelve"},
+    {9592, "ExclusiveLevelAlarmType_ShelvingState_TimedShelve"},
+    {9593, "ExclusiveLevelAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {9594, "ExclusiveLevelAlarmType_SuppressedOrShelved"},
+    {9595, "ExclusiveLevelAlarmType_MaxTimeShelved"},
+    {9596, "ExclusiveLevelAlarmType_LimitState"},
+    {9597, "ExclusiveLevelAlarmType_LimitState_CurrentState"},
+    {9598, "ExclusiveLevelAlarmType_LimitState_CurrentState_Id"},
+    {9599, "ExclusiveLevelAlarmType_LimitState_CurrentState_Name"},
+    {9600, "ExclusiveLevelAlarmType_LimitState_CurrentState_Number"},
+    {9601, "ExclusiveLevelAlarmType_LimitState_CurrentState_EffectiveDisplayName"},
+    {9602, "ExclusiveLevelAlarmType_LimitState_LastTransition"},
+    {9603, "ExclusiveLevelAlarmType_LimitState_LastTransition_Id"},
+    {9604, "ExclusiveLevelAlarmType_LimitState_LastTransition_Name"},
+    {9605, "ExclusiveLevelAlarmType_LimitState_LastTransition_Number"},
+    {9606, "ExclusiveLevelAlarmType_LimitState_LastTransition_TransitionTime"},
+    {9619, "ExclusiveLevelAlarmType_HighHighLimit"},
+    {9620, "ExclusiveLevelAlarmType_HighLimit"},
+    {9621, "ExclusiveLevelAlarmType_LowLimit"},
+    {9622, "ExclusiveLevelAlarmType_LowLowLimit"},
+    {9623, "ExclusiveRateOfChangeAlarmType"},
+    {9624, "ExclusiveRateOfChangeAlarmType_EventId"},
+    {9625, "ExclusiveRateOfChangeAlarmType_EventType"},
+    {9626, "ExclusiveRateOfChangeAlarmType_SourceNode"},
+    {9627, "ExclusiveRateOfChangeAlarmType_SourceName"},
+    {9628, "ExclusiveRateOfChangeAlarmType_Time"},
+    {9629, "ExclusiveRateOfChangeAlarmType_ReceiveTime"},
+    {9630, "ExclusiveRateOfChangeAlarmType_LocalTime"},
+    {9631, "ExclusiveRateOfChangeAlarmType_Message"},
+    {9632, "ExclusiveRateOfChangeAlarmType_Severity"},
+    {9633, "ExclusiveRateOfChangeAlarmType_ConditionName"},
+    {9634, "ExclusiveRateOfChangeAlarmType_BranchId"},
+    {9635, "ExclusiveRateOfChangeAlarmType_Retain"},
+    {9636, "ExclusiveRateOfChangeAlarmType_EnabledState"},
+    {9637, "ExclusiveRateOfChangeAlarmType_EnabledState_Id"},
+    {9638, "ExclusiveRateOfChangeAlarmType_EnabledState_Name"},
+    {9639, "ExclusiveRateOfChangeAlarmType_EnabledState_Number"},
+    {9640, "ExclusiveRateOfChangeAlarmType_EnabledState_EffectiveDisplayName"},
+    {9641, "ExclusiveRateOfChangeAlarmType_EnabledState_TransitionTime"},
+    {9642, "ExclusiveRateOfChangeAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9643, "ExclusiveRateOfChangeAlarmType_EnabledState_TrueState"},
+    {9644, "ExclusiveRateOfChangeAlarmType_EnabledState_FalseState"},
+    {9645, "ExclusiveRateOfChangeAlarmType_Quality"},
+    {9646, "ExclusiveRateOfChangeAlarmType_Quality_SourceTimestamp"},
+    {9647, "ExclusiveRateOfChangeAlarmType_LastSeverity"},
+    {9648, "ExclusiveRateOfChangeAlarmType_LastSeverity_SourceTimestamp"},
+    {9649, "ExclusiveRateOfChangeAlarmType_Comment"},
+    {9650, "ExclusiveRateOfChangeAlarmType_Comment_SourceTimestamp"},
+    {9651, "ExclusiveRateOfChangeAlarmType_ClientUserId"},
+    {9652, "ExclusiveRateOfChangeAlarmType_Enable"},
+    {9653, "ExclusiveRateOfChangeAlarmType_Disable"},
+    {9654, "ExclusiveRateOfChangeAlarmType_AddComment"},
+    {9655, "ExclusiveRateOfChangeAlarmType_AddComment_InputArguments"},
+    {9656, "ExclusiveRateOfChangeAlarmType_ConditionRefresh"},
+    {9657, "ExclusiveRateOfChangeAlarmType_ConditionRefresh_InputArguments"},
+    {9658, "ExclusiveRateOfChangeAlarmType_AckedState"},
+    {9659, "ExclusiveRateOfChangeAlarmType_AckedState_Id"},
+    {9660, "ExclusiveRateOfChangeAlarmType_AckedState_Name"},
+    {9661, "ExclusiveRateOfChangeAlarmType_AckedState_Number"},
+    {9662, "ExclusiveRateOfChangeAlarmType_AckedState_EffectiveDisplayName"},
+    {9663, "ExclusiveRateOfChangeAlarmType_AckedState_TransitionTime"},
+    {9664, "ExclusiveRateOfChangeAlarmType_AckedState_EffectiveTransitionTime"},
+    {9665, "ExclusiveRateOfChangeAlarmType_AckedState_TrueState"},
+    {9666, "ExclusiveRateOfChangeAlarmType_AckedState_FalseState"},
+    {9667, "ExclusiveRateOfChangeAlarmType_ConfirmedState"},
+    {9668, "ExclusiveRateOfChangeAlarmType_ConfirmedState_Id"},
+    {9669, "ExclusiveRateOfChangeAlarmType_ConfirmedState_Name"},
+    {9670, "ExclusiveRateOfChangeAlarmType_ConfirmedState_Number"},
+    {9671, "ExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9672, "ExclusiveRateOfChangeAlarmType_ConfirmedState_TransitionTime"},
+    {9673, "ExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9674, "ExclusiveRateOfChangeAlarmType_ConfirmedState_TrueState"},
+    {9675, "ExclusiveRateOfChangeAlarmType_ConfirmedState_FalseState"},
+    {9676, "ExclusiveRateOfChangeAlarmType_Acknowledge"},
+    {9677, "ExclusiveRateOfChangeAlarmType_Acknowledge_InputArguments"},
+    {9678, "ExclusiveRateOfChangeAlarmType_Confirm"},
+    {9679, "ExclusiveRateOfChangeAlarmType_Confirm_InputArguments"},
+    {9680, "ExclusiveRateOfChangeAlarmType_ActiveState"},
+    {9681, "ExclusiveRateOfChangeAlarmType_ActiveState_Id"},
+    {9682, "ExclusiveRateOfChangeAlarmType_ActiveState_Name"},
+    {9683, "ExclusiveRateOfChangeAlarmType_ActiveState_Number"},
+    {9684, "ExclusiveRateOfChangeAlarmType_ActiveState_EffectiveDisplayName"},
+    {9685, "ExclusiveRateOfChangeAlarmType_ActiveState_TransitionTime"},
+    {9686, "ExclusiveRateOfChangeAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9687, "ExclusiveRateOfChangeAlarmType_ActiveState_TrueState"},
+    {9688, "ExclusiveRateOfChangeAlarmType_ActiveState_FalseState"},
+    {9689, "ExclusiveRateOfChangeAlarmType_SuppressedState"},
+    {9690, "ExclusiveRateOfChangeAlarmType_SuppressedState_Id"},
+    {9691, "ExclusiveRateOfChangeAlarmType_SuppressedState_Name"},
+    {9692, "ExclusiveRateOfChangeAlarmType_SuppressedState_Number"},
+    {9693, "ExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9694, "ExclusiveRateOfChangeAlarmType_SuppressedState_TransitionTime"},
+    {9695, "ExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9696, "ExclusiveRateOfChangeAlarmType_SuppressedState_TrueState"},
+    {9697, "ExclusiveRateOfChangeAlarmType_SuppressedState_FalseState"},
+    {9698, "ExclusiveRateOfChangeAlarmType_ShelvingState"},
+    {9699, "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState"},
+    {9700, "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Id"},
+    {9701, "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Name"},
+    {9702, "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Number"},
+    {9703, "ExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9704, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition"},
+    {9705, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Id"},
+    {9706, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Name"},
+    {9707, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Number"},
+    {9708, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9709, "ExclusiveRateOfChangeAlarmType_ShelvingState_UnshelveTime"},
+    {9731, "ExclusiveRateOfChangeAlarmType_ShelvingState_Unshelve"},
+    {9732, "ExclusiveRateOfChangeAlarmType_ShelvingState_OneShotShelve"},
+    {9733, "ExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve"},
+    {9734, "ExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {9735, "ExclusiveRateOfChangeAlarmType_SuppressedOrShelved"},
+    {9736, "ExclusiveRateOfChangeAlarmType_MaxTimeShelved"},
+    {9737, "ExclusiveRateOfChangeAlarmType_LimitState"},
+    {9738, "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState"},
+    {9739, "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Id"},
+    {9740, "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Name"},
+    {9741, "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_Number"},
+    {9742, "ExclusiveRateOfChangeAlarmType_LimitState_CurrentState_EffectiveDisplayName"},
+    {9743, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition"},
+    {9744, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Id"},
+    {9745, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Name"},
+    {9746, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_Number"},
+    {9747, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_TransitionTime"},
+    {9760, "ExclusiveRateOfChangeAlarmType_HighHighLimit"},
+    {9761, "ExclusiveRateOfChangeAlarmType_HighLimit"},
+    {9762, "ExclusiveRateOfChangeAlarmType_LowLimit"},
+    {9763, "ExclusiveRateOfChangeAlarmType_LowLowLimit"},
+    {9764, "ExclusiveDeviationAlarmType"},
+    {9765, "ExclusiveDeviationAlarmType_EventId"},
+    {9766, "ExclusiveDeviationAlarmType_EventType"},
+    {9767, "ExclusiveDeviationAlarmType_SourceNode"},
+    {9768, "ExclusiveDeviationAlarmType_SourceName"},
+    {9769, "ExclusiveDeviationAlarmType_Time"},
+    {9770, "ExclusiveDeviationAlarmType_ReceiveTime"},
+    {9771, "ExclusiveDeviationAlarmType_LocalTime"},
+    {9772, "ExclusiveDeviationAlarmType_Message"},
+    {9773, "ExclusiveDeviationAlarmType_Severity"},
+    {9774, "ExclusiveDeviationAlarmType_ConditionName"},
+    {9775, "ExclusiveDeviationAlarmType_BranchId"},
+    {9776, "ExclusiveDeviationAlarmType_Retain"},
+    {9777, "ExclusiveDeviationAlarmType_EnabledState"},
+    {9778, "ExclusiveDeviationAlarmType_EnabledState_Id"},
+    {9779, "ExclusiveDeviationAlarmType_EnabledState_Name"},
+    {9780, "ExclusiveDeviationAlarmType_EnabledState_Number"},
+    {9781, "ExclusiveDeviationAlarmType_EnabledState_EffectiveDisplayName"},
+    {9782, "ExclusiveDeviationAlarmType_EnabledState_TransitionTime"},
+    {9783, "ExclusiveDeviationAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9784, "ExclusiveDeviationAlarmType_EnabledState_TrueState"},
+    {9785, "ExclusiveDeviationAlarmType_EnabledState_FalseState"},
+    {9786, "ExclusiveDeviationAlarmType_Quality"},
+    {9787, "ExclusiveDeviationAlarmType_Quality_SourceTimestamp"},
+    {9788, "ExclusiveDeviationAlarmType_LastSeverity"},
+    {9789, "ExclusiveDeviationAlarmType_LastSeverity_SourceTimestamp"},
+    {9790, "ExclusiveDeviationAlarmType_Comment"},
+    {9791, "ExclusiveDeviationAlarmType_Comment_SourceTimestamp"},
+    {9792, "ExclusiveDeviationAlarmType_ClientUserId"},
+    {9793, "ExclusiveDeviationAlarmType_Enable"},
+    {9794, "ExclusiveDeviationAlarmType_Disable"},
+    {9795, "ExclusiveDeviationAlarmType_AddComment"},
+    {9796, "ExclusiveDeviationAlarmType_AddComment_InputArguments"},
+    {9797, "ExclusiveDeviationAlarmType_ConditionRefresh"},
+    {9798, "ExclusiveDeviationAlarmType_ConditionRefresh_InputArguments"},
+    {9799, "ExclusiveDeviationAlarmType_AckedState"},
+    {9800, "ExclusiveDeviationAlarmType_AckedState_Id"},
+    {9801, "ExclusiveDeviationAlarmType_AckedState_Name"},
+    {9802, "ExclusiveDeviationAlarmType_AckedState_Number"},
+    {9803, "ExclusiveDeviationAlarmType_AckedState_EffectiveDisplayName"},
+    {9804, "ExclusiveDeviationAlarmType_AckedState_TransitionTime"},
+    {9805, "ExclusiveDeviationAlarmType_AckedState_EffectiveTransitionTime"},
+    {9806, "ExclusiveDeviationAlarmType_AckedState_TrueState"},
+    {9807, "ExclusiveDeviationAlarmType_AckedState_FalseState"},
+    {9808, "ExclusiveDeviationAlarmType_ConfirmedState"},
+    {9809, "ExclusiveDeviationAlarmType_ConfirmedState_Id"},
+    {9810, "ExclusiveDeviationAlarmType_ConfirmedState_Name"},
+    {9811, "ExclusiveDeviationAlarmType_ConfirmedState_Number"},
+    {9812, "ExclusiveDeviationAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9813, "ExclusiveDeviationAlarmType_ConfirmedState_TransitionTime"},
+    {9814, "ExclusiveDeviationAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9815, "ExclusiveDeviationAlarmType_ConfirmedState_TrueState"},
+    {9816, "ExclusiveDeviationAlarmType_ConfirmedState_FalseState"},
+    {9817, "ExclusiveDeviationAlarmType_Acknowledge"},
+    {9818, "ExclusiveDeviationAlarmType_Acknowledge_InputArguments"},
+    {9819, "ExclusiveDeviationAlarmType_Confirm"},
+    {9820, "ExclusiveDeviationAlarmType_Confirm_InputArguments"},
+    {9821, "ExclusiveDeviationAlarmType_ActiveState"},
+    {9822, "ExclusiveDeviationAlarmType_ActiveState_Id"},
+    {9823, "ExclusiveDeviationAlarmType_ActiveState_Name"},
+    {9824, "ExclusiveDeviationAlarmType_ActiveState_Number"},
+    {9825, "ExclusiveDeviationAlarmType_ActiveState_EffectiveDisplayName"},
+    {9826, "ExclusiveDeviationAlarmType_ActiveState_TransitionTime"},
+    {9827, "ExclusiveDeviationAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9828, "ExclusiveDeviationAlarmType_ActiveState_TrueState"},
+    {9829, "ExclusiveDeviationAlarmType_ActiveState_FalseState"},
+    {9830, "ExclusiveDeviationAlarmType_SuppressedState"},
+    {9831, "ExclusiveDeviationAlarmType_SuppressedState_Id"},
+    {9832, "ExclusiveDeviationAlarmType_SuppressedState_Name"},
+    {9833, "ExclusiveDeviationAlarmType_SuppressedState_Number"},
+    {9834, "ExclusiveDeviationAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9835, "ExclusiveDeviationAlarmType_SuppressedState_TransitionTime"},
+    {9836, "ExclusiveDeviationAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9837, "ExclusiveDeviationAlarmType_SuppressedState_TrueState"},
+    {9838, "ExclusiveDeviationAlarmType_SuppressedState_FalseState"},
+    {9839, "ExclusiveDeviationAlarmType_ShelvingState"},
+    {9840, "ExclusiveDeviationAlarmType_ShelvingState_CurrentState"},
+    {9841, "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Id"},
+    {9842, "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Name"},
+    {9843, "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_Number"},
+    {9844, "ExclusiveDeviationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9845, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition"},
+    {9846, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Id"},
+    {9847, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Name"},
+    {9848, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_Number"},
+    {9849, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9850, "ExclusiveDeviationAlarmType_ShelvingState_UnshelveTime"},
+    {9872, "ExclusiveDeviationAlarmType_ShelvingState_Unshelve"},
+    {9873, "ExclusiveDeviationAlarmType_ShelvingState_OneShotShelve"},
+    {9874, "ExclusiveDeviationAlarmType_ShelvingState_TimedShelve"},
+    {9875, "ExclusiveDeviationAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {9876, "ExclusiveDeviationAlarmType_SuppressedOrShelved"},
+    {9877, "ExclusiveDeviationAlarmType_MaxTimeShelved"},
+    {9878, "ExclusiveDeviationAlarmType_LimitState"},
+    {9879, "ExclusiveDeviationAlarmType_LimitState_CurrentState"},
+    {9880, "ExclusiveDeviationAlarmType_LimitState_CurrentState_Id"},
+    {9881, "ExclusiveDeviationAlarmType_LimitState_CurrentState_Name"},
+    {9882, "ExclusiveDeviationAlarmType_LimitState_CurrentState_Number"},
+    {9883, "ExclusiveDeviationAlarmType_LimitState_CurrentState_EffectiveDisplayName"},
+    {9884, "ExclusiveDeviationAlarmType_LimitState_LastTransition"},
+    {9885, "ExclusiveDeviationAlarmType_LimitState_LastTransition_Id"},
+    {9886, "ExclusiveDeviationAlarmType_LimitState_LastTransition_Name"},
+    {9887, "ExclusiveDeviationAlarmType_LimitState_LastTransition_Number"},
+    {9888, "ExclusiveDeviationAlarmType_LimitState_LastTransition_TransitionTime"},
+    {9901, "ExclusiveDeviationAlarmType_HighHighLimit"},
+    {9902, "ExclusiveDeviationAlarmType_HighLimit"},
+    {9903, "ExclusiveDeviationAlarmType_LowLimit"},
+    {9904, "ExclusiveDeviationAlarmType_LowLowLimit"},
+    {9905, "ExclusiveDeviationAlarmType_SetpointNode"},
+    {9906, "NonExclusiveLimitAlarmType"},
+    {9907, "NonExclusiveLimitAlarmType_EventId"},
+    {9908, "NonExclusiveLimitAlarmType_EventType"},
+    {9909, "NonExclusiveLimitAlarmType_SourceNode"},
+    {9910, "NonExclusiveLimitAlarmType_SourceName"},
+    {9911, "NonExclusiveLimitAlarmType_Time"},
+    {9912, "NonExclusiveLimitAlarmType_ReceiveTime"},
+    {9913, "NonExclusiveLimitAlarmType_LocalTime"},
+    {9914, "NonExclusiveLimitAlarmType_Message"},
+    {9915, "NonExclusiveLimitAlarmType_Severity"},
+    {9916, "NonExclusiveLimitAlarmType_ConditionName"},
+    {9917, "NonExclusiveLimitAlarmType_BranchId"},
+    {9918, "NonExclusiveLimitAlarmType_Retain"},
+    {9919, "NonExclusiveLimitAlarmType_EnabledState"},
+    {9920, "NonExclusiveLimitAlarmType_EnabledState_Id"},
+    {9921, "NonExclusiveLimitAlarmType_EnabledState_Name"},
+    {9922, "NonExclusiveLimitAlarmType_EnabledState_Number"},
+    {9923, "NonExclusiveLimitAlarmType_EnabledState_EffectiveDisplayName"},
+    {9924, "NonExclusiveLimitAlarmType_EnabledState_TransitionTime"},
+    {9925, "NonExclusiveLimitAlarmType_EnabledState_EffectiveTransitionTime"},
+    {9926, "NonExclusiveLimitAlarmType_EnabledState_TrueState"},
+    {9927, "NonExclusiveLimitAlarmType_EnabledState_FalseState"},
+    {9928, "NonExclusiveLimitAlarmType_Quality"},
+    {9929, "NonExclusiveLimitAlarmType_Quality_SourceTimestamp"},
+    {9930, "NonExclusiveLimitAlarmType_LastSeverity"},
+    {9931, "NonExclusiveLimitAlarmType_LastSeverity_SourceTimestamp"},
+    {9932, "NonExclusiveLimitAlarmType_Comment"},
+    {9933, "NonExclusiveLimitAlarmType_Comment_SourceTimestamp"},
+    {9934, "NonExclusiveLimitAlarmType_ClientUserId"},
+    {9935, "NonExclusiveLimitAlarmType_Enable"},
+    {9936, "NonExclusiveLimitAlarmType_Disable"},
+    {9937, "NonExclusiveLimitAlarmType_AddComment"},
+    {9938, "NonExclusiveLimitAlarmType_AddComment_InputArguments"},
+    {9939, "NonExclusiveLimitAlarmType_ConditionRefresh"},
+    {9940, "NonExclusiveLimitAlarmType_ConditionRefresh_InputArguments"},
+    {9941, "NonExclusiveLimitAlarmType_AckedState"},
+    {9942, "NonExclusiveLimitAlarmType_AckedState_Id"},
+    {9943, "NonExclusiveLimitAlarmType_AckedState_Name"},
+    {9944, "NonExclusiveLimitAlarmType_AckedState_Number"},
+    {9945, "NonExclusiveLimitAlarmType_AckedState_EffectiveDisplayName"},
+    {9946, "NonExclusiveLimitAlarmType_AckedState_TransitionTime"},
+    {9947, "NonExclusiveLimitAlarmType_AckedState_EffectiveTransitionTime"},
+    {9948, "NonExclusiveLimitAlarmType_AckedState_TrueState"},
+    {9949, "NonExclusiveLimitAlarmType_AckedState_FalseState"},
+    {9950, "NonExclusiveLimitAlarmType_ConfirmedState"},
+    {9951, "NonExclusiveLimitAlarmType_ConfirmedState_Id"},
+    {9952, "NonExclusiveLimitAlarmType_ConfirmedState_Name"},
+    {9953, "NonExclusiveLimitAlarmType_ConfirmedState_Number"},
+    {9954, "NonExclusiveLimitAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {9955, "NonExclusiveLimitAlarmType_ConfirmedState_TransitionTime"},
+    {9956, "NonExclusiveLimitAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {9957, "NonExclusiveLimitAlarmType_ConfirmedState_TrueState"},
+    {9958, "NonExclusiveLimitAlarmType_ConfirmedState_FalseState"},
+    {9959, "NonExclusiveLimitAlarmType_Acknowledge"},
+    {9960, "NonExclusiveLimitAlarmType_Acknowledge_InputArguments"},
+    {9961, "NonExclusiveLimitAlarmType_Confirm"},
+    {9962, "NonExclusiveLimitAlarmType_Confirm_InputArguments"},
+    {9963, "NonExclusiveLimitAlarmType_ActiveState"},
+    {9964, "NonExclusiveLimitAlarmType_ActiveState_Id"},
+    {9965, "NonExclusiveLimitAlarmType_ActiveState_Name"},
+    {9966, "NonExclusiveLimitAlarmType_ActiveState_Number"},
+    {9967, "NonExclusiveLimitAlarmType_ActiveState_EffectiveDisplayName"},
+    {9968, "NonExclusiveLimitAlarmType_ActiveState_TransitionTime"},
+    {9969, "NonExclusiveLimitAlarmType_ActiveState_EffectiveTransitionTime"},
+    {9970, "NonExclusiveLimitAlarmType_ActiveState_TrueState"},
+    {9971, "NonExclusiveLimitAlarmType_ActiveState_FalseState"},
+    {9972, "NonExclusiveLimitAlarmType_SuppressedState"},
+    {9973, "NonExclusiveLimitAlarmType_SuppressedState_Id"},
+    {9974, "NonExclusiveLimitAlarmType_SuppressedState_Name"},
+    {9975, "NonExclusiveLimitAlarmType_SuppressedState_Number"},
+    {9976, "NonExclusiveLimitAlarmType_SuppressedState_EffectiveDisplayName"},
+    {9977, "NonExclusiveLimitAlarmType_SuppressedState_TransitionTime"},
+    {9978, "NonExclusiveLimitAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {9979, "NonExclusiveLimitAlarmType_SuppressedState_TrueState"},
+    {9980, "NonExclusiveLimitAlarmType_SuppressedState_FalseState"},
+    {9981, "NonExclusiveLimitAlarmType_ShelvingState"},
+    {9982, "NonExclusiveLimitAlarmType_ShelvingState_CurrentState"},
+    {9983, "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Id"},
+    {9984, "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Name"},
+    {9985, "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_Number"},
+    {9986, "NonExclusiveLimitAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {9987, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition"},
+    {9988, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Id"},
+    {9989, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Name"},
+    {9990, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_Number"},
+    {9991, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {9992, "NonExclusiveLimitAlarmType_ShelvingState_UnshelveTime"},
+    {10014, "NonExclusiveLimitAlarmType_ShelvingState_Unshelve"},
+    {10015, "NonExclusiveLimitAlarmType_ShelvingState_OneShotShelve"},
+    {10016, "NonExclusiveLimitAlarmType_ShelvingState_TimedShelve"},
+    {10017, "NonExclusiveLimitAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10018, "NonExclusiveLimitAlarmType_SuppressedOrShelved"},
+    {10019, "NonExclusiveLimitAlarmType_MaxTimeShelved"},
+    {10020, "NonExclusiveLimitAlarmType_HighHighState"},
+    {10021, "NonExclusiveLimitAlarmType_HighHighState_Id"},
+    {10022, "NonExclusiveLimitAlarmType_HighHighState_Name"},
+    {10023, "NonExclusiveLimitAlarmType_HighHighState_Number"},
+    {10024, "NonExclusiveLimitAlarmType_HighHighState_EffectiveDisplayName"},
+    {10025, "NonExclusiveLimitAlarmType_HighHighState_TransitionTime"},
+    {10026, "NonExclusiveLimitAlarmType_HighHighState_EffectiveTransitionTime"},
+    {10027, "NonExclusiveLimitAlarmType_HighHighState_TrueState"},
+    {10028, "NonExclusiveLimitAlarmType_HighHighState_FalseState"},
+    {10029, "NonExclusiveLimitAlarmType_HighState"},
+    {10030, "NonExclusiveLimitAlarmType_HighState_Id"},
+    {10031, "NonExclusiveLimitAlarmType_HighState_Name"},
+    {10032, "NonExclusiveLimitAlarmType_HighState_Number"},
+    {10033, "NonExclusiveLimitAlarmType_HighState_EffectiveDisplayName"},
+    {10034, "NonExclusiveLimitAlarmType_HighState_TransitionTime"},
+    {10035, "NonExclusiveLimitAlarmType_HighState_EffectiveTransitionTime"},
+    {10036, "NonExclusiveLimitAlarmType_HighState_TrueState"},
+    {10037, "NonExclusiveLimitAlarmType_HighState_FalseState"},
+    {10038, "NonExclusiveLimitAlarmType_LowState"},
+    {10039, "NonExclusiveLimitAlarmType_LowState_Id"},
+    {10040, "NonExclusiveLimitAlarmType_LowState_Name"},
+    {10041, "NonExclusiveLimitAlarmType_LowState_Number"},
+    {10042, "NonExclusiveLimitAlarmType_LowState_EffectiveDisplayName"},
+    {10043, "NonExclusiveLimitAlarmType_LowState_TransitionTime"},
+    {10044, "NonExclusiveLimitAlarmType_LowState_EffectiveTransitionTime"},
+    {10045, "NonExclusiveLimitAlarmType_LowState_TrueState"},
+    {10046, "NonExclusiveLimitAlarmType_LowState_FalseState"},
+    {10047, "NonExclusiveLimitAlarmType_LowLowState"},
+    {10048, "NonExclusiveLimitAlarmType_LowLowState_Id"},
+    {10049, "NonExclusiveLimitAlarmType_LowLowState_Name"},
+    {10050, "NonExclusiveLimitAlarmType_LowLowState_Number"},
+    {10051, "NonExclusiveLimitAlarmType_LowLowState_EffectiveDisplayName"},
+    {10052, "NonExclusiveLimitAlarmType_LowLowState_TransitionTime"},
+    {10053, "NonExclusiveLimitAlarmType_LowLowState_EffectiveTransitionTime"},
+    {10054, "NonExclusiveLimitAlarmType_LowLowState_TrueState"},
+    {10055, "NonExclusiveLimitAlarmType_LowLowState_FalseState"},
+    {10056, "NonExclusiveLimitAlarmType_HighHighLimit"},
+    {10057, "NonExclusiveLimitAlarmType_HighLimit"},
+    {10058, "NonExclusiveLimitAlarmType_LowLimit"},
+    {10059, "NonExclusiveLimitAlarmType_LowLowLimit"},
+    {10060, "NonExclusiveLevelAlarmType"},
+    {10061, "NonExclusiveLevelAlarmType_EventId"},
+    {10062, "NonExclusiveLevelAlarmType_EventType"},
+    {10063, "NonExclusiveLevelAlarmType_SourceNode"},
+    {10064, "NonExclusiveLevelAlarmType_SourceName"},
+    {10065, "NonExclusiveLevelAlarmType_Time"},
+    {10066, "NonExclusiveLevelAlarmType_ReceiveTime"},
+    {10067, "NonExclusiveLevelAlarmType_LocalTime"},
+    {10068, "NonExclusiveLevelAlarmType_Message"},
+    {10069, "NonExclusiveLevelAlarmType_Severity"},
+    {10070, "NonExclusiveLevelAlarmType_ConditionName"},
+    {10071, "NonExclusiveLevelAlarmType_BranchId"},
+    {10072, "NonExclusiveLevelAlarmType_Retain"},
+    {10073, "NonExclusiveLevelAlarmType_EnabledState"},
+    {10074, "NonExclusiveLevelAlarmType_EnabledState_Id"},
+    {10075, "NonExclusiveLevelAlarmType_EnabledState_Name"},
+    {10076, "NonExclusiveLevelAlarmType_EnabledState_Number"},
+    {10077, "NonExclusiveLevelAlarmType_EnabledState_EffectiveDisplayName"},
+    {10078, "NonExclusiveLevelAlarmType_EnabledState_TransitionTime"},
+    {10079, "NonExclusiveLevelAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10080, "NonExclusiveLevelAlarmType_EnabledState_TrueState"},
+    {10081, "NonExclusiveLevelAlarmType_EnabledState_FalseState"},
+    {10082, "NonExclusiveLevelAlarmType_Quality"},
+    {10083, "NonExclusiveLevelAlarmType_Quality_SourceTimestamp"},
+    {10084, "NonExclusiveLevelAlarmType_LastSeverity"},
+    {10085, "NonExclusiveLevelAlarmType_LastSeverity_SourceTimestamp"},
+    {10086, "NonExclusiveLevelAlarmType_Comment"},
+    {10087, "NonExclusiveLevelAlarmType_Comment_SourceTimestamp"},
+    {10088, "NonExclusiveLevelAlarmType_ClientUserId"},
+    {10089, "NonExclusiveLevelAlarmType_Enable"},
+    {10090, "NonExclusiveLevelAlarmType_Disable"},
+    {10091, "NonExclusiveLevelAlarmType_AddComment"},
+    {10092, "NonExclusiveLevelAlarmType_AddComment_InputArguments"},
+    {10093, "NonExclusiveLevelAlarmType_ConditionRefresh"},
+    {10094, "NonExclusiveLevelAlarmType_ConditionRefresh_InputArguments"},
+    {10095, "NonExclusiveLevelAlarmType_AckedState"},
+    {10096, "NonExclusiveLevelAlarmType_AckedState_Id"},
+    {10097, "NonExclusiveLevelAlarmType_AckedState_Name"},
+    {10098, "NonExclusiveLevelAlarmType_AckedState_Number"},
+    {10099, "NonExclusiveLevelAlarmType_AckedState_EffectiveDisplayName"},
+    {10100, "NonExclusiveLevelAlarmType_AckedState_TransitionTime"},
+    {10101, "NonExclusiveLevelAlarmType_AckedState_EffectiveTransitionTime"},
+    {10102, "NonExclusiveLevelAlarmType_AckedState_TrueState"},
+    {10103, "NonExclusiveLevelAlarmType_AckedState_FalseState"},
+    {10104, "NonExclusiveLevelAlarmType_ConfirmedState"},
+    {10105, "NonExclusiveLevelAlarmType_ConfirmedState_Id"},
+    {10106, "NonExclusiveLevelAlarmType_ConfirmedState_Name"},
+    {10107, "NonExclusiveLevelAlarmType_ConfirmedState_Number"},
+    {10108, "NonExclusiveLevelAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10109, "NonExclusiveLevelAlarmType_ConfirmedState_TransitionTime"},
+    {10110, "NonExclusiveLevelAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10111, "NonExclusiveLevelAlarmType_ConfirmedState_TrueState"},
+    {10112, "NonExclusiveLevelAlarmType_ConfirmedState_FalseState"},
+    {10113, "NonExclusiveLevelAlarmType_Acknowledge"},
+    {10114, "NonExclusiveLevelAlarmType_Acknowledge_InputArguments"},
+    {10115, "NonExclusiveLevelAlarmType_Confirm"},
+    {10116, "NonExclusiveLevelAlarmType_Confirm_InputArguments"},
+    {10117, "NonExclusiveLevelAlarmType_ActiveState"},
+    {10118, "NonExclusiveLevelAlarmType_ActiveState_Id"},
+    {10119, "NonExclusiveLevelAlarmType_ActiveState_Name"},
+    {10120, "NonExclusiveLevelAlarmType_ActiveState_Number"},
+    {10121, "NonExclusiveLevelAlarmType_ActiveState_EffectiveDisplayName"},
+    {10122, "NonExclusiveLevelAlarmType_ActiveState_TransitionTime"},
+    {10123, "NonExclusiveLevelAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10124, "NonExclusiveLevelAlarmType_ActiveState_TrueState"},
+    {10125, "NonExclusiveLevelAlarmType_ActiveState_FalseState"},
+    {10126, "NonExclusiveLevelAlarmType_SuppressedState"},
+    {10127, "NonExclusiveLevelAlarmType_SuppressedState_Id"},
+    {10128, "NonExclusiveLevelAlarmType_SuppressedState_Name"},
+    {10129, "NonExclusiveLevelAlarmType_SuppressedState_Number"},
+    {10130, "NonExclusiveLevelAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10131, "NonExclusiveLevelAlarmType_SuppressedState_TransitionTime"},
+    {10132, "NonExclusiveLevelAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10133, "NonExclusiveLevelAlarmType_SuppressedState_TrueState"},
+    {10134, "NonExclusiveLevelAlarmType_SuppressedState_FalseState"},
+    {10135, "NonExclusiveLevelAlarmType_ShelvingState"},
+    {10136, "NonExclusiveLevelAlarmType_ShelvingState_CurrentState"},
+    {10137, "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Id"},
+    {10138, "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Name"},
+    {10139, "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_Number"},
+    {10140, "NonExclusiveLevelAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10141, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition"},
+    {10142, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Id"},
+    {10143, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Name"},
+    {10144, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_Number"},
+    {10145, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10146, "NonExclusiveLevelAlarmType_ShelvingState_UnshelveTime"},
+    {10168, "NonExclusiveLevelAlarmType_ShelvingState_Unshelve"},
+    {10169, "NonExclusiveLevelAlarmType_ShelvingState_OneShotShelve"},
+    {10170, "NonExclusiveLevelAlarmType_ShelvingState_TimedShelve"},
+    {10171, "NonExclusiveLevelAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10172, "NonExclusiveLevelAlarmType_SuppressedOrShelved"},
+    {10173, "NonExclusiveLevelAlarmType_MaxTimeShelved"},
+    {10174, "NonExclusiveLevelAlarmType_HighHighState"},
+    {10175, "NonExclusiveLevelAlarmType_HighHighState_Id"},
+    {10176, "NonExclusiveLevelAlarmType_HighHighState_Name"},
+    {10177, "NonExclusiveLevelAlarmType_HighHighState_Number"},
+    {10178, "NonExclusiveLevelAlarmType_HighHighState_EffectiveDisplayName"},
+    {10179, "NonExclusiveLevelAlarmType_HighHighState_TransitionTime"},
+    {10180, "NonExclusiveLevelAlarmType_HighHighState_EffectiveTransitionTime"},
+    {10181, "NonExclusiveLevelAlarmType_HighHighState_TrueState"},
+    {10182, "NonExclusiveLevelAlarmType_HighHighState_FalseState"},
+    {10183, "NonExclusiveLevelAlarmType_HighState"},
+    {10184, "NonExclusiveLevelAlarmType_HighState_Id"},
+    {10185, "NonExclusiveLevelAlarmType_HighState_Name"},
+    {10186, "NonExclusiveLevelAlarmType_HighState_Number"},
+    {10187, "NonExclusiveLevelAlarmType_HighState_EffectiveDisplayName"},
+    {10188, "NonExclusiveLevelAlarmType_HighState_TransitionTime"},
+    {10189, "NonExclusiveLevelAlarmType_HighState_EffectiveTransitionTime"},
+    {10190, "NonExclusiveLevelAlarmType_HighState_TrueState"},
+    {10191, "NonExclusiveLevelAlarmType_HighState_FalseState"},
+    {10192, "NonExclusiveLevelAlarmType_LowState"},
+    {10193, "NonExclusiveLevelAlarmType_LowState_Id"},
+    {10194, "NonExclusiveLevelAlarmType_LowState_Name"},
+    {10195, "NonExclusiveLevelAlarmType_LowState_Number"},
+    {10196, "NonExclusiveLevelAlarmType_LowState_EffectiveDisplayName"},
+    {10197, "NonExclusiveLevelAlarmType_LowState_TransitionTime"},
+    {10198, "NonExclusiveLevelAlarmType_LowState_EffectiveTransitionTime"},
+    {10199, "NonExclusiveLevelAlarmType_LowState_TrueState"},
+    {10200, "NonExclusiveLevelAlarmType_LowState_FalseState"},
+    {10201, "NonExclusiveLevelAlarmType_LowLowState"},
+    {10202, "NonExclusiveLevelAlarmType_LowLowState_Id"},
+    {10203, "NonExclusiveLevelAlarmType_LowLowState_Name"},
+    {10204, "NonExclusiveLevelAlarmType_LowLowState_Number"},
+    {10205, "NonExclusiveLevelAlarmType_LowLowState_EffectiveDisplayName"},
+    {10206, "NonExclusiveLevelAlarmType_LowLowState_TransitionTime"},
+    {10207, "NonExclusiveLevelAlarmType_LowLowState_EffectiveTransitionTime"},
+    {10208, "NonExclusiveLevelAlarmType_LowLowState_TrueState"},
+    {10209, "NonExclusiveLevelAlarmType_LowLowState_FalseState"},
+    {10210, "NonExclusiveLevelAlarmType_HighHighLimit"},
+    {10211, "NonExclusiveLevelAlarmType_HighLimit"},
+    {10212, "NonExclusiveLevelAlarmType_LowLimit"},
+    {10213, "NonExclusiveLevelAlarmType_LowLowLimit"},
+    {10214, "NonExclusiveRateOfChangeAlarmType"},
+    {10215, "NonExclusiveRateOfChangeAlarmType_EventId"},
+    {10216, "NonExclusiveRateOfChangeAlarmType_EventType"},
+    {10217, "NonExclusiveRateOfChangeAlarmType_SourceNode"},
+    {10218, "NonExclusiveRateOfChangeAlarmType_SourceName"},
+    {10219, "NonExclusiveRateOfChangeAlarmType_Time"},
+    {10220, "NonExclusiveRateOfChangeAlarmType_ReceiveTime"},
+    {10221, "NonExclusiveRateOfChangeAlarmType_LocalTime"},
+    {10222, "NonExclusiveRateOfChangeAlarmType_Message"},
+    {10223, "NonExclusiveRateOfChangeAlarmType_Severity"},
+    {10224, "NonExclusiveRateOfChangeAlarmType_ConditionName"},
+    {10225, "NonExclusiveRateOfChangeAlarmType_BranchId"},
+    {10226, "NonExclusiveRateOfChangeAlarmType_Retain"},
+    {10227, "NonExclusiveRateOfChangeAlarmType_EnabledState"},
+    {10228, "NonExclusiveRateOfChangeAlarmType_EnabledState_Id"},
+    {10229, "NonExclusiveRateOfChangeAlarmType_EnabledState_Name"},
+    {10230, "NonExclusiveRateOfChangeAlarmType_EnabledState_Number"},
+    {10231, "NonExclusiveRateOfChangeAlarmType_EnabledState_EffectiveDisplayName"},
+    {10232, "NonExclusiveRateOfChangeAlarmType_EnabledState_TransitionTime"},
+    {10233, "NonExclusiveRateOfChangeAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10234, "NonExclusiveRateOfChangeAlarmType_EnabledState_TrueState"},
+    {10235, "NonExclusiveRateOfChangeAlarmType_EnabledState_FalseState"},
+    {10236, "NonExclusiveRateOfChangeAlarmType_Quality"},
+    {10237, "NonExclusiveRateOfChangeAlarmType_Quality_SourceTimestamp"},
+    {10238, "NonExclusiveRateOfChangeAlarmType_LastSeverity"},
+    {10239, "NonExclusiveRateOfChangeAlarmType_LastSeverity_SourceTimestamp"},
+    {10240, "NonExclusiveRateOfChangeAlarmType_Comment"},
+    {10241, "NonExclusiveRateOfChangeAlarmType_Comment_SourceTimestamp"},
+    {10242, "NonExclusiveRateOfChangeAlarmType_ClientUserId"},
+    {10243, "NonExclusiveRateOfChangeAlarmType_Enable"},
+    {10244, "NonExclusiveRateOfChangeAlarmType_Disable"},
+    {10245, "NonExclusiveRateOfChangeAlarmType_AddComment"},
+    {10246, "NonExclusiveRateOfChangeAlarmType_AddComment_InputArguments"},
+    {10247, "NonExclusiveRateOfChangeAlarmType_ConditionRefresh"},
+    {10248, "NonExclusiveRateOfChangeAlarmType_ConditionRefresh_InputArguments"},
+    {10249, "NonExclusiveRateOfChangeAlarmType_AckedState"},
+    {10250, "NonExclusiveRateOfChangeAlarmType_AckedState_Id"},
+    {10251, "NonExclusiveRateOfChangeAlarmType_AckedState_Name"},
+    {10252, "NonExclusiveRateOfChangeAlarmType_AckedState_Number"},
+    {10253, "NonExclusiveRateOfChangeAlarmType_AckedState_EffectiveDisplayName"},
+    {10254, "NonExclusiveRateOfChangeAlarmType_AckedState_TransitionTime"},
+    {10255, "NonExclusiveRateOfChangeAlarmType_AckedState_EffectiveTransitionTime"},
+    {10256, "NonExclusiveRateOfChangeAlarmType_AckedState_TrueState"},
+    {10257, "NonExclusiveRateOfChangeAlarmType_AckedState_FalseState"},
+    {10258, "NonExclusiveRateOfChangeAlarmType_ConfirmedState"},
+    {10259, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Id"},
+    {10260, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Name"},
+    {10261, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_Number"},
+    {10262, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10263, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_TransitionTime"},
+    {10264, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10265, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_TrueState"},
+    {10266, "NonExclusiveRateOfChangeAlarmType_ConfirmedState_FalseState"},
+    {10267, "NonExclusiveRateOfChangeAlarmType_Acknowledge"},
+    {10268, "NonExclusiveRateOfChangeAlarmType_Acknowledge_InputArguments"},
+    {10269, "NonExclusiveRateOfChangeAlarmType_Confirm"},
+    {10270, "NonExclusiveRateOfChangeAlarmType_Confirm_InputArguments"},
+    {10271, "NonExclusiveRateOfChangeAlarmType_ActiveState"},
+    {10272, "NonExclusiveRateOfChangeAlarmType_ActiveState_Id"},
+    {10273, "NonExclusiveRateOfChangeAlarmType_ActiveState_Name"},
+    {10274, "NonExclusiveRateOfChangeAlarmType_ActiveState_Number"},
+    {10275, "NonExclusiveRateOfChangeAlarmType_ActiveState_EffectiveDisplayName"},
+    {10276, "NonExclusiveRateOfChangeAlarmType_ActiveState_TransitionTime"},
+    {10277, "NonExclusiveRateOfChangeAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10278, "NonExclusiveRateOfChangeAlarmType_ActiveState_TrueState"},
+    {10279, "NonExclusiveRateOfChangeAlarmType_ActiveState_FalseState"},
+    {10280, "NonExclusiveRateOfChangeAlarmType_SuppressedState"},
+    {10281, "NonExclusiveRateOfChangeAlarmType_SuppressedState_Id"},
+    {10282, "NonExclusiveRateOfChangeAlarmType_SuppressedState_Name"},
+    {10283, "NonExclusiveRateOfChangeAlarmType_SuppressedState_Number"},
+    {10284, "NonExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10285, "NonExclusiveRateOfChangeAlarmType_SuppressedState_TransitionTime"},
+    {10286, "NonExclusiveRateOfChangeAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10287, "NonExclusiveRateOfChangeAlarmType_SuppressedState_TrueState"},
+    {10288, "NonExclusiveRateOfChangeAlarmType_SuppressedState_FalseState"},
+    {10289, "NonExclusiveRateOfChangeAlarmType_ShelvingState"},
+    {10290, "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState"},
+    {10291, "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Id"},
+    {10292, "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Name"},
+    {10293, "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_Number"},
+    {10294, "NonExclusiveRateOfChangeAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10295, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition"},
+    {10296, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Id"},
+    {10297, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Name"},
+    {10298, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_Number"},
+    {10299, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10300, "NonExclusiveRateOfChangeAlarmType_ShelvingState_UnshelveTime"},
+    {10322, "NonExclusiveRateOfChangeAlarmType_ShelvingState_Unshelve"},
+    {10323, "NonExclusiveRateOfChangeAlarmType_ShelvingState_OneShotShelve"},
+    {10324, "NonExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve"},
+    {10325, "NonExclusiveRateOfChangeAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10326, "NonExclusiveRateOfChangeAlarmType_SuppressedOrShelved"},
+    {10327, "NonExclusiveRateOfChangeAlarmType_MaxTimeShelved"},
+    {10328, "NonExclusiveRateOfChangeAlarmType_HighHighState"},
+    {10329, "NonExclusiveRateOfChangeAlarmType_HighHighState_Id"},
+    {10330, "NonExclusiveRateOfChangeAlarmType_HighHighState_Name"},
+    {10331, "NonExclusiveRateOfChangeAlarmType_HighHighState_Number"},
+    {10332, "NonExclusiveRateOfChangeAlarmType_HighHighState_EffectiveDisplayName"},
+    {10333, "NonExclusiveRateOfChangeAlarmType_HighHighState_TransitionTime"},
+    {10334, "NonExclusiveRateOfChangeAlarmType_HighHighState_EffectiveTransitionTime"},
+    {10335, "NonExclusiveRateOfChangeAlarmType_HighHighState_TrueState"},
+    {10336, "NonExclusiveRateOfChangeAlarmType_HighHighState_FalseState"},
+    {10337, "NonExclusiveRateOfChangeAlarmType_HighState"},
+    {10338, "NonExclusiveRateOfChangeAlarmType_HighState_Id"},
+    {10339, "NonExclusiveRateOfChangeAlarmType_HighState_Name"},
+    {10340, "NonExclusiveRateOfChangeAlarmType_HighState_Number"},
+    {10341, "NonExclusiveRateOfChangeAlarmType_HighState_EffectiveDisplayName"},
+    {10342, "NonExclusiveRateOfChangeAlarmType_HighState_TransitionTime"},
+    {10343, "NonExclusiveRateOfChangeAlarmType_HighState_EffectiveTransitionTime"},
+    {10344, "NonExclusiveRateOfChangeAlarmType_HighState_TrueState"},
+    {10345, "NonExclusiveRateOfChangeAlarmType_HighState_FalseState"},
+    {10346, "NonExclusiveRateOfChangeAlarmType_LowState"},
+    {10347, "NonExclusiveRateOfChangeAlarmType_LowState_Id"},
+    {10348, "NonExclusiveRateOfChangeAlarmType_LowState_Name"},
+    {10349, "NonExclusiveRateOfChangeAlarmType_LowState_Number"},
+    {10350, "NonExclusiveRateOfChangeAlarmType_LowState_EffectiveDisplayName"},
+    {10351, "NonExclusiveRateOfChangeAlarmType_LowState_TransitionTime"},
+    {10352, "NonExclusiveRateOfChangeAlarmType_LowState_EffectiveTransitionTime"},
+    {10353, "NonExclusiveRateOfChangeAlarmType_LowState_TrueState"},
+    {10354, "NonExclusiveRateOfChangeAlarmType_LowState_FalseState"},
+    {10355, "NonExclusiveRateOfChangeAlarmType_LowLowState"},
+    {10356, "NonExclusiveRateOfChangeAlarmType_LowLowState_Id"},
+    {10357, "NonExclusiveRateOfChangeAlarmType_LowLowState_Name"},
+    {10358, "NonExclusiveRateOfChangeAlarmType_LowLowState_Number"},
+    {10359, "NonExclusiveRateOfChangeAlarmType_LowLowState_EffectiveDisplayName"},
+    {10360, "NonExclusiveRateOfChangeAlarmType_LowLowState_TransitionTime"},
+    {10361, "NonExclusiveRateOfChangeAlarmType_LowLowState_EffectiveTransitionTime"},
+    {10362, "NonExclusiveRateOfChangeAlarmType_LowLowState_TrueState"},
+    {10363, "NonExclusiveRateOfChangeAlarmType_LowLowState_FalseState"},
+    {10364, "NonExclusiveRateOfChangeAlarmType_HighHighLimit"},
+    {10365, "NonExclusiveRateOfChangeAlarmType_HighLimit"},
+    {10366, "NonExclusiveRateOfChangeAlarmType_LowLimit"},
+    {10367, "NonExclusiveRateOfChangeAlarmType_LowLowLimit"},
+    {10368, "NonExclusiveDeviationAlarmType"},
+    {10369, "NonExclusiveDeviationAlarmType_EventId"},
+    {10370, "NonExclusiveDeviationAlarmType_EventType"},
+    {10371, "NonExclusiveDeviationAlarmType_SourceNode"},
+    {10372, "NonExclusiveDeviationAlarmType_SourceName"},
+    {10373, "NonExclusiveDeviationAlarmType_Time"},
+    {10374, "NonExclusiveDeviationAlarmType_ReceiveTime"},
+    {10375, "NonExclusiveDeviationAlarmType_LocalTime"},
+    {10376, "NonExclusiveDeviationAlarmType_Message"},
+    {10377, "NonExclusiveDeviationAlarmType_Severity"},
+    {10378, "NonExclusiveDeviationAlarmType_ConditionName"},
+    {10379, "NonExclusiveDeviationAlarmType_BranchId"},
+    {10380, "NonExclusiveDeviationAlarmType_Retain"},
+    {10381, "NonExclusiveDeviationAlarmType_EnabledState"},
+    {10382, "NonExclusiveDeviationAlarmType_EnabledState_Id"},
+    {10383, "NonExclusiveDeviationAlarmType_EnabledState_Name"},
+    {10384, "NonExclusiveDeviationAlarmType_EnabledState_Number"},
+    {10385, "NonExclusiveDeviationAlarmType_EnabledState_EffectiveDisplayName"},
+    {10386, "NonExclusiveDeviationAlarmType_EnabledState_TransitionTime"},
+    {10387, "NonExclusiveDeviationAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10388, "NonExclusiveDeviationAlarmType_EnabledState_TrueState"},
+    {10389, "NonExclusiveDeviationAlarmType_EnabledState_FalseState"},
+    {10390, "NonExclusiveDeviationAlarmType_Quality"},
+    {10391, "NonExclusiveDeviationAlarmType_Quality_SourceTimestamp"},
+    {10392, "NonExclusiveDeviationAlarmType_LastSeverity"},
+    {10393, "NonExclusiveDeviationAlarmType_LastSeverity_SourceTimestamp"},
+    {10394, "NonExclusiveDeviationAlarmType_Comment"},
+    {10395, "NonExclusiveDeviationAlarmType_Comment_SourceTimestamp"},
+    {10396, "NonExclusiveDeviationAlarmType_ClientUserId"},
+    {10397, "NonExclusiveDeviationAlarmType_Enable"},
+    {10398, "NonExclusiveDeviationAlarmType_Disable"},
+    {10399, "NonExclusiveDeviationAlarmType_AddComment"},
+    {10400, "NonExclusiveDeviationAlarmType_AddComment_InputArguments"},
+    {10401, "NonExclusiveDeviationAlarmType_ConditionRefresh"},
+    {10402, "NonExclusiveDeviationAlarmType_ConditionRefresh_InputArguments"},
+    {10403, "NonExclusiveDeviationAlarmType_AckedState"},
+    {10404, "NonExclusiveDeviationAlarmType_AckedState_Id"},
+    {10405, "NonExclusiveDeviationAlarmType_AckedState_Name"},
+    {10406, "NonExclusiveDeviationAlarmType_AckedState_Number"},
+    {10407, "NonExclusiveDeviationAlarmType_AckedState_EffectiveDisplayName"},
+    {10408, "NonExclusiveDeviationAlarmType_AckedState_TransitionTime"},
+    {10409, "NonExclusiveDeviationAlarmType_AckedState_EffectiveTransitionTime"},
+    {10410, "NonExclusiveDeviationAlarmType_AckedState_TrueState"},
+    {10411, "NonExclusiveDeviationAlarmType_AckedState_FalseState"},
+    {10412, "NonExclusiveDeviationAlarmType_ConfirmedState"},
+    {10413, "NonExclusiveDeviationAlarmType_ConfirmedState_Id"},
+    {10414, "NonExclusiveDeviationAlarmType_ConfirmedState_Name"},
+    {10415, "NonExclusiveDeviationAlarmType_ConfirmedState_Number"},
+    {10416, "NonExclusiveDeviationAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10417, "NonExclusiveDeviationAlarmType_ConfirmedState_TransitionTime"},
+    {10418, "NonExclusiveDeviationAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10419, "NonExclusiveDeviationAlarmType_ConfirmedState_TrueState"},
+    {10420, "NonExclusiveDeviationAlarmType_ConfirmedState_FalseState"},
+    {10421, "NonExclusiveDeviationAlarmType_Acknowledge"},
+    {10422, "NonExclusiveDeviationAlarmType_Acknowledge_InputArguments"},
+    {10423, "NonExclusiveDeviationAlarmType_Confirm"},
+    {10424, "NonExclusiveDeviationAlarmType_Confirm_InputArguments"},
+    {10425, "NonExclusiveDeviationAlarmType_ActiveState"},
+    {10426, "NonExclusiveDeviationAlarmType_ActiveState_Id"},
+    {10427, "NonExclusiveDeviationAlarmType_ActiveState_Name"},
+    {10428, "NonExclusiveDeviationAlarmType_ActiveState_Number"},
+    {10429, "NonExclusiveDeviationAlarmType_ActiveState_EffectiveDisplayName"},
+    {10430, "NonExclusiveDeviationAlarmType_ActiveState_TransitionTime"},
+    {10431, "NonExclusiveDeviationAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10432, "NonExclusiveDeviationAlarmType_ActiveState_TrueState"},
+    {10433, "NonExclusiveDeviationAlarmType_ActiveState_FalseState"},
+    {10434, "NonExclusiveDeviationAlarmType_SuppressedState"},
+    {10435, "NonExclusiveDeviationAlarmType_SuppressedState_Id"},
+    {10436, "NonExclusiveDeviationAlarmType_SuppressedState_Name"},
+    {10437, "NonExclusiveDeviationAlarmType_SuppressedState_Number"},
+    {10438, "NonExclusiveDeviationAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10439, "NonExclusiveDeviationAlarmType_SuppressedState_TransitionTime"},
+    {10440, "NonExclusiveDeviationAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10441, "NonExclusiveDeviationAlarmType_SuppressedState_TrueState"},
+    {10442, "NonExclusiveDeviationAlarmType_SuppressedState_FalseState"},
+    {10443, "NonExclusiveDeviationAlarmType_ShelvingState"},
+    {10444, "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState"},
+    {10445, "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Id"},
+    {10446, "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Name"},
+    {10447, "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_Number"},
+    {10448, "NonExclusiveDeviationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10449, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition"},
+    {10450, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Id"},
+    {10451, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Name"},
+    {10452, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_Number"},
+    {10453, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10454, "NonExclusiveDeviationAlarmType_ShelvingState_UnshelveTime"},
+    {10476, "NonExclusiveDeviationAlarmType_ShelvingState_Unshelve"},
+    {10477, "NonExclusiveDeviationAlarmType_ShelvingState_OneShotShelve"},
+    {10478, "NonExclusiveDeviationAlarmType_ShelvingState_TimedShelve"},
+    {10479, "NonExclusiveDeviationAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10480, "NonExclusiveDeviationAlarmType_SuppressedOrShelved"},
+    {10481, "NonExclusiveDeviationAlarmType_MaxTimeShelved"},
+    {10482, "NonExclusiveDeviationAlarmType_HighHighState"},
+    {10483, "NonExclusiveDeviationAlarmType_HighHighState_Id"},
+    {10484, "NonExclusiveDeviationAlarmType_HighHighState_Name"},
+    {10485, "NonExclusiveDeviationAlarmType_HighHighState_Number"},
+    {10486, "NonExclusiveDeviationAlarmType_HighHighState_EffectiveDisplayName"},
+    {10487, "NonExclusiveDeviationAlarmType_HighHighState_TransitionTime"},
+    {10488, "NonExclusiveDeviationAlarmType_HighHighState_EffectiveTransitionTime"},
+    {10489, "NonExclusiveDeviationAlarmType_HighHighState_TrueState"},
+    {10490, "NonExclusiveDeviationAlarmType_HighHighState_FalseState"},
+    {10491, "NonExclusiveDeviationAlarmType_HighState"},
+    {10492, "NonExclusiveDeviationAlarmType_HighState_Id"},
+    {10493, "NonExclusiveDeviationAlarmType_HighState_Name"},
+    {10494, "NonExclusiveDeviationAlarmType_HighState_Number"},
+    {10495, "NonExclusiveDeviationAlarmType_HighState_EffectiveDisplayName"},
+    {10496, "NonExclusiveDeviationAlarmType_HighState_TransitionTime"},
+    {10497, "NonExclusiveDeviationAlarmType_HighState_EffectiveTransitionTime"},
+    {10498, "NonExclusiveDeviationAlarmType_HighState_TrueState"},
+    {10499, "NonExclusiveDeviationAlarmType_HighState_FalseState"},
+    {10500, "NonExclusiveDeviationAlarmType_LowState"},
+    {10501, "NonExclusiveDeviationAlarmType_LowState_Id"},
+    {10502, "NonExclusiveDeviationAlarmType_LowState_Name"},
+    {10503, "NonExclusiveDeviationAlarmType_LowState_Number"},
+    {10504, "NonExclusiveDeviationAlarmType_LowState_EffectiveDisplayName"},
+    {10505, "NonExclusiveDeviationAlarmType_LowState_TransitionTime"},
+    {10506, "NonExclusiveDeviationAlarmType_LowState_EffectiveTransitionTime"},
+    {10507, "NonExclusiveDeviationAlarmType_LowState_TrueState"},
+    {10508, "NonExclusiveDeviationAlarmType_LowState_FalseState"},
+    {10509, "NonExclusiveDeviationAlarmType_LowLowState"},
+    {10510, "NonExclusiveDeviationAlarmType_LowLowState_Id"},
+    {10511, "NonExclusiveDeviationAlarmType_LowLowState_Name"},
+    {10512, "NonExclusiveDeviationAlarmType_LowLowState_Number"},
+    {10513, "NonExclusiveDeviationAlarmType_LowLowState_EffectiveDisplayName"},
+    {10514, "NonExclusiveDeviationAlarmType_LowLowState_TransitionTime"},
+    {10515, "NonExclusiveDeviationAlarmType_LowLowState_EffectiveTransitionTime"},
+    {10516, "NonExclusiveDeviationAlarmType_LowLowState_TrueState"},
+    {10517, "NonExclusiveDeviationAlarmType_LowLowState_FalseState"},
+    {10518, "NonExclusiveDeviationAlarmType_HighHighLimit"},
+    {10519, "NonExclusiveDeviationAlarmType_HighLimit"},
+    {10520, "NonExclusiveDeviationAlarmType_LowLimit"},
+    {10521, "NonExclusiveDeviationAlarmType_LowLowLimit"},
+    {10522, "NonExclusiveDeviationAlarmType_SetpointNode"},
+    {10523, "DiscreteAlarmType"},
+    {10524, "DiscreteAlarmType_EventId"},
+    {10525, "DiscreteAlarmType_EventType"},
+    {10526, "DiscreteAlarmType_SourceNode"},
+    {10527, "DiscreteAlarmType_SourceName"},
+    {10528, "DiscreteAlarmType_Time"},
+    {10529, "DiscreteAlarmType_ReceiveTime"},
+    {10530, "DiscreteAlarmType_LocalTime"},
+    {10531, "DiscreteAlarmType_Message"},
+    {10532, "DiscreteAlarmType_Severity"},
+    {10533, "DiscreteAlarmType_ConditionName"},
+    {10534, "DiscreteAlarmType_BranchId"},
+    {10535, "DiscreteAlarmType_Retain"},
+    {10536, "DiscreteAlarmType_EnabledState"},
+    {10537, "DiscreteAlarmType_EnabledState_Id"},
+    {10538, "DiscreteAlarmType_EnabledState_Name"},
+    {10539, "DiscreteAlarmType_EnabledState_Number"},
+    {10540, "DiscreteAlarmType_EnabledState_EffectiveDisplayName"},
+    {10541, "DiscreteAlarmType_EnabledState_TransitionTime"},
+    {10542, "DiscreteAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10543, "DiscreteAlarmType_EnabledState_TrueState"},
+    {10544, "DiscreteAlarmType_EnabledState_FalseState"},
+    {10545, "DiscreteAlarmType_Quality"},
+    {10546, "DiscreteAlarmType_Quality_SourceTimestamp"},
+    {10547, "DiscreteAlarmType_LastSeverity"},
+    {10548, "DiscreteAlarmType_LastSeverity_SourceTimestamp"},
+    {10549, "DiscreteAlarmType_Comment"},
+    {10550, "DiscreteAlarmType_Comment_SourceTimestamp"},
+    {10551, "DiscreteAlarmType_ClientUserId"},
+    {10552, "DiscreteAlarmType_Enable"},
+    {10553, "DiscreteAlarmType_Disable"},
+    {10554, "DiscreteAlarmType_AddComment"},
+    {10555, "DiscreteAlarmType_AddComment_InputArguments"},
+    {10556, "DiscreteAlarmType_ConditionRefresh"},
+    {10557, "DiscreteAlarmType_ConditionRefresh_InputArguments"},
+    {10558, "DiscreteAlarmType_AckedState"},
+    {10559, "DiscreteAlarmType_AckedState_Id"},
+    {10560, "DiscreteAlarmType_AckedState_Name"},
+    {10561, "DiscreteAlarmType_AckedState_Number"},
+    {10562, "DiscreteAlarmType_AckedState_EffectiveDisplayName"},
+    {10563, "DiscreteAlarmType_AckedState_TransitionTime"},
+    {10564, "DiscreteAlarmType_AckedState_EffectiveTransitionTime"},
+    {10565, "DiscreteAlarmType_AckedState_TrueState"},
+    {10566, "DiscreteAlarmType_AckedState_FalseState"},
+    {10567, "DiscreteAlarmType_ConfirmedState"},
+    {10568, "DiscreteAlarmType_ConfirmedState_Id"},
+    {10569, "DiscreteAlarmType_ConfirmedState_Name"},
+    {10570, "DiscreteAlarmType_ConfirmedState_Number"},
+    {10571, "DiscreteAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10572, "DiscreteAlarmType_ConfirmedState_TransitionTime"},
+    {10573, "DiscreteAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10574, "DiscreteAlarmType_ConfirmedState_TrueState"},
+    {10575, "DiscreteAlarmType_ConfirmedState_FalseState"},
+    {10576, "DiscreteAlarmType_Acknowledge"},
+    {10577, "DiscreteAlarmType_Acknowledge_InputArguments"},
+    {10578, "DiscreteAlarmType_Confirm"},
+    {10579, "DiscreteAlarmType_Confirm_InputArguments"},
+    {10580, "DiscreteAlarmType_ActiveState"},
+    {10581, "DiscreteAlarmType_ActiveState_Id"},
+    {10582, "DiscreteAlarmType_ActiveState_Name"},
+    {10583, "DiscreteAlarmType_ActiveState_Number"},
+    {10584, "DiscreteAlarmType_ActiveState_EffectiveDisplayName"},
+    {10585, "DiscreteAlarmType_ActiveState_TransitionTime"},
+    {10586, "DiscreteAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10587, "DiscreteAlarmType_ActiveState_TrueState"},
+    {10588, "DiscreteAlarmType_ActiveState_FalseState"},
+    {10589, "DiscreteAlarmType_SuppressedState"},
+    {10590, "DiscreteAlarmType_SuppressedState_Id"},
+    {10591, "DiscreteAlarmType_SuppressedState_Name"},
+    {10592, "DiscreteAlarmType_SuppressedState_Number"},
+    {10593, "DiscreteAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10594, "DiscreteAlarmType_SuppressedState_TransitionTime"},
+    {10595, "DiscreteAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10596, "DiscreteAlarmType_SuppressedState_TrueState"},
+    {10597, "DiscreteAlarmType_SuppressedState_FalseState"},
+    {10598, "DiscreteAlarmType_ShelvingState"},
+    {10599, "DiscreteAlarmType_ShelvingState_CurrentState"},
+    {10600, "DiscreteAlarmType_ShelvingState_CurrentState_Id"},
+    {10601, "DiscreteAlarmType_ShelvingState_CurrentState_Name"},
+    {10602, "DiscreteAlarmType_ShelvingState_CurrentState_Number"},
+    {10603, "DiscreteAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10604, "DiscreteAlarmType_ShelvingState_LastTransition"},
+    {10605, "DiscreteAlarmType_ShelvingState_LastTransition_Id"},
+    {10606, "DiscreteAlarmType_ShelvingState_LastTransition_Name"},
+    {10607, "DiscreteAlarmType_ShelvingState_LastTransition_Number"},
+    {10608, "DiscreteAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10609, "DiscreteAlarmType_ShelvingState_UnshelveTime"},
+    {10631, "DiscreteAlarmType_ShelvingState_Unshelve"},
+    {10632, "DiscreteAlarmType_ShelvingState_OneShotShelve"},
+    {10633, "DiscreteAlarmType_ShelvingState_TimedShelve"},
+    {10634, "DiscreteAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10635, "DiscreteAlarmType_SuppressedOrShelved"},
+    {10636, "DiscreteAlarmType_MaxTimeShelved"},
+    {10637, "OffNormalAlarmType"},
+    {10638, "OffNormalAlarmType_EventId"},
+    {10639, "OffNormalAlarmType_EventType"},
+    {10640, "OffNormalAlarmType_SourceNode"},
+    {10641, "OffNormalAlarmType_SourceName"},
+    {10642, "OffNormalAlarmType_Time"},
+    {10643, "OffNormalAlarmType_ReceiveTime"},
+    {10644, "OffNormalAlarmType_LocalTime"},
+    {10645, "OffNormalAlarmType_Message"},
+    {10646, "OffNormalAlarmType_Severity"},
+    {10647, "OffNormalAlarmType_ConditionName"},
+    {10648, "OffNormalAlarmType_BranchId"},
+    {10649, "OffNormalAlarmType_Retain"},
+    {10650, "OffNormalAlarmType_EnabledState"},
+    {10651, "OffNormalAlarmType_EnabledState_Id"},
+    {10652, "OffNormalAlarmType_EnabledState_Name"},
+    {10653, "OffNormalAlarmType_EnabledState_Number"},
+    {10654, "OffNormalAlarmType_EnabledState_EffectiveDisplayName"},
+    {10655, "OffNormalAlarmType_EnabledState_TransitionTime"},
+    {10656, "OffNormalAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10657, "OffNormalAlarmType_EnabledState_TrueState"},
+    {10658, "OffNormalAlarmType_EnabledState_FalseState"},
+    {10659, "OffNormalAlarmType_Quality"},
+    {10660, "OffNormalAlarmType_Quality_SourceTimestamp"},
+    {10661, "OffNormalAlarmType_LastSeverity"},
+    {10662, "OffNormalAlarmType_LastSeverity_SourceTimestamp"},
+    {10663, "OffNormalAlarmType_Comment"},
+    {10664, "OffNormalAlarmType_Comment_SourceTimestamp"},
+    {10665, "OffNormalAlarmType_ClientUserId"},
+    {10666, "OffNormalAlarmType_Enable"},
+    {10667, "OffNormalAlarmType_Disable"},
+    {10668, "OffNormalAlarmType_AddComment"},
+    {10669, "OffNormalAlarmType_AddComment_InputArguments"},
+    {10670, "OffNormalAlarmType_ConditionRefresh"},
+    {10671, "OffNormalAlarmType_ConditionRefresh_InputArguments"},
+    {10672, "OffNormalAlarmType_AckedState"},
+    {10673, "OffNormalAlarmType_AckedState_Id"},
+    {10674, "OffNormalAlarmType_AckedState_Name"},
+    {10675, "OffNormalAlarmType_AckedState_Number"},
+    {10676, "OffNormalAlarmType_AckedState_EffectiveDisplayName"},
+    {10677, "OffNormalAlarmType_AckedState_TransitionTime"},
+    {10678, "OffNormalAlarmType_AckedState_EffectiveTransitionTime"},
+    {10679, "OffNormalAlarmType_AckedState_TrueState"},
+    {10680, "OffNormalAlarmType_AckedState_FalseState"},
+    {10681, "OffNormalAlarmType_ConfirmedState"},
+    {10682, "OffNormalAlarmType_ConfirmedState_Id"},
+    {10683, "OffNormalAlarmType_ConfirmedState_Name"},
+    {10684, "OffNormalAlarmType_ConfirmedState_Number"},
+    {10685, "OffNormalAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10686, "OffNormalAlarmType_ConfirmedState_TransitionTime"},
+    {10687, "OffNormalAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10688, "OffNormalAlarmType_ConfirmedState_TrueState"},
+    {10689, "OffNormalAlarmType_ConfirmedState_FalseState"},
+    {10690, "OffNormalAlarmType_Acknowledge"},
+    {10691, "OffNormalAlarmType_Acknowledge_InputArguments"},
+    {10692, "OffNormalAlarmType_Confirm"},
+    {10693, "OffNormalAlarmType_Confirm_InputArguments"},
+    {10694, "OffNormalAlarmType_ActiveState"},
+    {10695, "OffNormalAlarmType_ActiveState_Id"},
+    {10696, "OffNormalAlarmType_ActiveState_Name"},
+    {10697, "OffNormalAlarmType_ActiveState_Number"},
+    {10698, "OffNormalAlarmType_ActiveState_EffectiveDisplayName"},
+    {10699, "OffNormalAlarmType_ActiveState_TransitionTime"},
+    {10700, "OffNormalAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10701, "OffNormalAlarmType_ActiveState_TrueState"},
+    {10702, "OffNormalAlarmType_ActiveState_FalseState"},
+    {10703, "OffNormalAlarmType_SuppressedState"},
+    {10704, "OffNormalAlarmType_SuppressedState_Id"},
+    {10705, "OffNormalAlarmType_SuppressedState_Name"},
+    {10706, "OffNormalAlarmType_SuppressedState_Number"},
+    {10707, "OffNormalAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10708, "OffNormalAlarmType_SuppressedState_TransitionTime"},
+    {10709, "OffNormalAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10710, "OffNormalAlarmType_SuppressedState_TrueState"},
+    {10711, "OffNormalAlarmType_SuppressedState_FalseState"},
+    {10712, "OffNormalAlarmType_ShelvingState"},
+    {10713, "OffNormalAlarmType_ShelvingState_CurrentState"},
+    {10714, "OffNormalAlarmType_ShelvingState_CurrentState_Id"},
+    {10715, "OffNormalAlarmType_ShelvingState_CurrentState_Name"},
+    {10716, "OffNormalAlarmType_ShelvingState_CurrentState_Number"},
+    {10717, "OffNormalAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10718, "OffNormalAlarmType_ShelvingState_LastTransition"},
+    {10719, "OffNormalAlarmType_ShelvingState_LastTransition_Id"},
+    {10720, "OffNormalAlarmType_ShelvingState_LastTransition_Name"},
+    {10721, "OffNormalAlarmType_ShelvingState_LastTransition_Number"},
+    {10722, "OffNormalAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10723, "OffNormalAlarmType_ShelvingState_UnshelveTime"},
+    {10745, "OffNormalAlarmType_ShelvingState_Unshelve"},
+    {10746, "OffNormalAlarmType_ShelvingState_OneShotShelve"},
+    {10747, "OffNormalAlarmType_ShelvingState_TimedShelve"},
+    {10748, "OffNormalAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10749, "OffNormalAlarmType_SuppressedOrShelved"},
+    {10750, "OffNormalAlarmType_MaxTimeShelved"},
+    {10751, "TripAlarmType"},
+    {10752, "TripAlarmType_EventId"},
+    {10753, "TripAlarmType_EventType"},
+    {10754, "TripAlarmType_SourceNode"},
+    {10755, "TripAlarmType_SourceName"},
+    {10756, "TripAlarmType_Time"},
+    {10757, "TripAlarmType_ReceiveTime"},
+    {10758, "TripAlarmType_LocalTime"},
+    {10759, "TripAlarmType_Message"},
+    {10760, "TripAlarmType_Severity"},
+    {10761, "TripAlarmType_ConditionName"},
+    {10762, "TripAlarmType_BranchId"},
+    {10763, "TripAlarmType_Retain"},
+    {10764, "TripAlarmType_EnabledState"},
+    {10765, "TripAlarmType_EnabledState_Id"},
+    {10766, "TripAlarmType_EnabledState_Name"},
+    {10767, "TripAlarmType_EnabledState_Number"},
+    {10768, "TripAlarmType_EnabledState_EffectiveDisplayName"},
+    {10769, "TripAlarmType_EnabledState_TransitionTime"},
+    {10770, "TripAlarmType_EnabledState_EffectiveTransitionTime"},
+    {10771, "TripAlarmType_EnabledState_TrueState"},
+    {10772, "TripAlarmType_EnabledState_FalseState"},
+    {10773, "TripAlarmType_Quality"},
+    {10774, "TripAlarmType_Quality_SourceTimestamp"},
+    {10775, "TripAlarmType_LastSeverity"},
+    {10776, "TripAlarmType_LastSeverity_SourceTimestamp"},
+    {10777, "TripAlarmType_Comment"},
+    {10778, "TripAlarmType_Comment_SourceTimestamp"},
+    {10779, "TripAlarmType_ClientUserId"},
+    {10780, "TripAlarmType_Enable"},
+    {10781, "TripAlarmType_Disable"},
+    {10782, "TripAlarmType_AddComment"},
+    {10783, "TripAlarmType_AddComment_InputArguments"},
+    {10784, "TripAlarmType_ConditionRefresh"},
+    {10785, "TripAlarmType_ConditionRefresh_InputArguments"},
+    {10786, "TripAlarmType_AckedState"},
+    {10787, "TripAlarmType_AckedState_Id"},
+    {10788, "TripAlarmType_AckedState_Name"},
+    {10789, "TripAlarmType_AckedState_Number"},
+    {10790, "TripAlarmType_AckedState_EffectiveDisplayName"},
+    {10791, "TripAlarmType_AckedState_TransitionTime"},
+    {10792, "TripAlarmType_AckedState_EffectiveTransitionTime"},
+    {10793, "TripAlarmType_AckedState_TrueState"},
+    {10794, "TripAlarmType_AckedState_FalseState"},
+    {10795, "TripAlarmType_ConfirmedState"},
+    {10796, "TripAlarmType_ConfirmedState_Id"},
+    {10797, "TripAlarmType_ConfirmedState_Name"},
+    {10798, "TripAlarmType_ConfirmedState_Number"},
+    {10799, "TripAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {10800, "TripAlarmType_ConfirmedState_TransitionTime"},
+    {10801, "TripAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {10802, "TripAlarmType_ConfirmedState_TrueState"},
+    {10803, "TripAlarmType_ConfirmedState_FalseState"},
+    {10804, "TripAlarmType_Acknowledge"},
+    {10805, "TripAlarmType_Acknowledge_InputArguments"},
+    {10806, "TripAlarmType_Confirm"},
+    {10807, "TripAlarmType_Confirm_InputArguments"},
+    {10808, "TripAlarmType_ActiveState"},
+    {10809, "TripAlarmType_ActiveState_Id"},
+    {10810, "TripAlarmType_ActiveState_Name"},
+    {10811, "TripAlarmType_ActiveState_Number"},
+    {10812, "TripAlarmType_ActiveState_EffectiveDisplayName"},
+    {10813, "TripAlarmType_ActiveState_TransitionTime"},
+    {10814, "TripAlarmType_ActiveState_EffectiveTransitionTime"},
+    {10815, "TripAlarmType_ActiveState_TrueState"},
+    {10816, "TripAlarmType_ActiveState_FalseState"},
+    {10817, "TripAlarmType_SuppressedState"},
+    {10818, "TripAlarmType_SuppressedState_Id"},
+    {10819, "TripAlarmType_SuppressedState_Name"},
+    {10820, "TripAlarmType_SuppressedState_Number"},
+    {10821, "TripAlarmType_SuppressedState_EffectiveDisplayName"},
+    {10822, "TripAlarmType_SuppressedState_TransitionTime"},
+    {10823, "TripAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {10824, "TripAlarmType_SuppressedState_TrueState"},
+    {10825, "TripAlarmType_SuppressedState_FalseState"},
+    {10826, "TripAlarmType_ShelvingState"},
+    {10827, "TripAlarmType_ShelvingState_CurrentState"},
+    {10828, "TripAlarmType_ShelvingState_CurrentState_Id"},
+    {10829, "TripAlarmType_ShelvingState_CurrentState_Name"},
+    {10830, "TripAlarmType_ShelvingState_CurrentState_Number"},
+    {10831, "TripAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {10832, "TripAlarmType_ShelvingState_LastTransition"},
+    {10833, "TripAlarmType_ShelvingState_LastTransition_Id"},
+    {10834, "TripAlarmType_ShelvingState_LastTransition_Name"},
+    {10835, "TripAlarmType_ShelvingState_LastTransition_Number"},
+    {10836, "TripAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {10837, "TripAlarmType_ShelvingState_UnshelveTime"},
+    {10859, "TripAlarmType_ShelvingState_Unshelve"},
+    {10860, "TripAlarmType_ShelvingState_OneShotShelve"},
+    {10861, "TripAlarmType_ShelvingState_TimedShelve"},
+    {10862, "TripAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {10863, "TripAlarmType_SuppressedOrShelved"},
+    {10864, "TripAlarmType_MaxTimeShelved"},
+    {11093, "AuditConditionShelvingEventType"},
+    {11094, "AuditConditionShelvingEventType_EventId"},
+    {11095, "AuditConditionShelvingEventType_EventType"},
+    {11096, "AuditConditionShelvingEventType_SourceNode"},
+    {11097, "AuditConditionShelvingEventType_SourceName"},
+    {11098, "AuditConditionShelvingEventType_Time"},
+    {11099, "AuditConditionShelvingEventType_ReceiveTime"},
+    {11100, "AuditConditionShelvingEventType_LocalTime"},
+    {11101, "AuditConditionShelvingEventType_Message"},
+    {11102, "AuditConditionShelvingEventType_Severity"},
+    {11103, "AuditConditionShelvingEventType_ActionTimeStamp"},
+    {11104, "AuditConditionShelvingEventType_Status"},
+    {11105, "AuditConditionShelvingEventType_ServerId"},
+    {11106, "AuditConditionShelvingEventType_ClientAuditEntryId"},
+    {11107, "AuditConditionShelvingEventType_ClientUserId"},
+    {11108, "AuditConditionShelvingEventType_MethodId"},
+    {11109, "AuditConditionShelvingEventType_InputArguments"},
+    {11110, "TwoStateVariableType_TrueState"},
+    {11111, "TwoStateVariableType_FalseState"},
+    {11112, "ConditionType_ConditionClassId"},
+    {11113, "ConditionType_ConditionClassName"},
+    {11114, "DialogConditionType_ConditionClassId"},
+    {11115, "DialogConditionType_ConditionClassName"},
+    {11116, "AcknowledgeableConditionType_ConditionClassId"},
+    {11117, "AcknowledgeableConditionType_ConditionClassName"},
+    {11118, "AlarmConditionType_ConditionClassId"},
+    {11119, "AlarmConditionType_ConditionClassName"},
+    {11120, "AlarmConditionType_InputNode"},
+    {11121, "LimitAlarmType_ConditionClassId"},
+    {11122, "LimitAlarmType_ConditionClassName"},
+    {11123, "LimitAlarmType_InputNode"},
+    {11124, "LimitAlarmType_HighHighLimit"},
+    {11125, "LimitAlarmType_HighLimit"},
+    {11126, "LimitAlarmType_LowLimit"},
+    {11127, "LimitAlarmType_LowLowLimit"},
+    {11128, "ExclusiveLimitAlarmType_ConditionClassId"},
+    {11129, "ExclusiveLimitAlarmType_ConditionClassName"},
+    {11130, "ExclusiveLimitAlarmType_InputNode"},
+    {11131, "ExclusiveLevelAlarmType_ConditionClassId"},
+    {11132, "ExclusiveLevelAlarmType_ConditionClassName"},
+    {11133, "ExclusiveLevelAlarmType_InputNode"},
+    {11134, "ExclusiveRateOfChangeAlarmType_ConditionClassId"},
+    {11135, "ExclusiveRateOfChangeAlarmType_ConditionClassName"},
+    {11136, "ExclusiveRateOfChangeAlarmType_InputNode"},
+    {11137, "ExclusiveDeviationAlarmType_ConditionClassId"},
+    {11138, "ExclusiveDeviationAlarmType_ConditionClassName"},
+    {11139, "ExclusiveDeviationAlarmType_InputNode"},
+    {11140, "NonExclusiveLimitAlarmType_ConditionClassId"},
+    {11141, "NonExclusiveLimitAlarmType_ConditionClassName"},
+    {11142, "NonExclusiveLimitAlarmType_InputNode"},
+    {11143, "NonExclusiveLevelAlarmType_ConditionClassId"},
+    {11144, "NonExclusiveLevelAlarmType_ConditionClassName"},
+    {11145, "NonExclusiveLevelAlarmType_InputNode"},
+    {11146, "NonExclusiveRateOfChangeAlarmType_ConditionClassId"},
+    {11147, "NonExclusiveRateOfChangeAlarmType_ConditionClassName"},
+    {11148, "NonExclusiveRateOfChangeAlarmType_InputNode"},
+    {11149, "NonExclusiveDeviationAlarmType_ConditionClassId"},
+    {11150, "NonExclusiveDeviationAlarmType_ConditionClassName"},
+    {11151, "NonExclusiveDeviationAlarmType_InputNode"},
+    {11152, "DiscreteAlarmType_ConditionClassId"},
+    {11153, "DiscreteAlarmType_ConditionClassName"},
+    {11154, "DiscreteAlarmType_InputNode"},
+    {11155, "OffNormalAlarmType_ConditionClassId"},
+    {11156, "OffNormalAlarmType_ConditionClassName"},
+    {11157, "OffNormalAlarmType_InputNode"},
+    {11158, "OffNormalAlarmType_NormalState"},
+    {11159, "TripAlarmType_ConditionClassId"},
+    {11160, "TripAlarmType_ConditionClassName"},
+    {11161, "TripAlarmType_InputNode"},
+    {11162, "TripAlarmType_NormalState"},
+    {11163, "BaseConditionClassType"},
+    {11164, "ProcessConditionClassType"},
+    {11165, "MaintenanceConditionClassType"},
+    {11166, "SystemConditionClassType"},
+    {11168, "HistoricalDataConfigurationType_AggregateConfiguration_TreatUncertainAsBad"},
+    {11169, "HistoricalDataConfigurationType_AggregateConfiguration_PercentDataBad"},
+    {11170, "HistoricalDataConfigurationType_AggregateConfiguration_PercentDataGood"},
+    {11171, "HistoricalDataConfigurationType_AggregateConfiguration_UseSlopedExtrapolation"},
+    {11172, "HistoryServerCapabilitiesType_AggregateFunctions"},
+    {11187, "AggregateConfigurationType"},
+    {11188, "AggregateConfigurationType_TreatUncertainAsBad"},
+    {11189, "AggregateConfigurationType_PercentDataBad"},
+    {11190, "AggregateConfigurationType_PercentDataGood"},
+    {11191, "AggregateConfigurationType_UseSlopedExtrapolation"},
+    {11192, "HistoryServerCapabilities"},
+    {11193, "HistoryServerCapabilities_AccessHistoryDataCapability"},
+    {11196, "HistoryServerCapabilities_InsertDataCapability"},
+    {11197, "HistoryServerCapabilities_ReplaceDataCapability"},
+    {11198, "HistoryServerCapabilities_UpdateDataCapability"},
+    {11199, "HistoryServerCapabilities_DeleteRawCapability"},
+    {11200, "HistoryServerCapabilities_DeleteAtTimeCapability"},
+    {11201, "HistoryServerCapabilities_AggregateFunctions"},
+    {11202, "HAConfiguration"},
+    {11203, "HAConfiguration_AggregateConfiguration"},
+    {11204, "HAConfiguration_AggregateConfiguration_TreatUncertainAsBad"},
+    {11205, "HAConfiguration_AggregateConfiguration_PercentDataBad"},
+    {11206, "HAConfiguration_AggregateConfiguration_PercentDataGood"},
+    {11207, "HAConfiguration_AggregateConfiguration_UseSlopedExtrapolation"},
+    {11208, "HAConfiguration_Stepped"},
+    {11209, "HAConfiguration_Definition"},
+    {11210, "HAConfiguration_MaxTimeInterval"},
+    {11211, "HAConfiguration_MinTimeInterval"},
+    {11212, "HAConfiguration_ExceptionDeviation"},
+    {11213, "HAConfiguration_ExceptionDeviationFormat"},
+    {11214, "Annotations"},
+    {11215, "HistoricalEventFilter"},
+    {11216, "ModificationInfo"},
+    {11217, "HistoryModifiedData"},
+    {11218, "ModificationInfo_Encoding_DefaultXml"},
+    {11219, "HistoryModifiedData_Encoding_DefaultXml"},
+    {11226, "ModificationInfo_Encoding_DefaultBinary"},
+    {11227, "HistoryModifiedData_Encoding_DefaultBinary"},
+    {11234, "HistoryUpdateType"},
+    {11238, "MultiStateValueDiscreteType"},
+    {11239, "MultiStateValueDiscreteType_Definition"},
+    {11240, "MultiStateValueDiscreteType_ValuePrecision"},
+    {11241, "MultiStateValueDiscreteType_EnumValues"},
+    {11242, "HistoryServerCapabilities_AccessHistoryEventsCapability"},
+    {11268, "HistoryServerCapabilitiesType_MaxReturnDataValues"},
+    {11269, "HistoryServerCapabilitiesType_MaxReturnEventValues"},
+    {11270, "HistoryServerCapabilitiesType_InsertAnnotationCapability"},
+    {11273, "HistoryServerCapabilities_MaxReturnDataValues"},
+    {11274, "HistoryServerCapabilities_MaxReturnEventValues"},
+    {11275, "HistoryServerCapabilities_InsertAnnotationCapability"},
+    {11278, "HistoryServerCapabilitiesType_InsertEventCapability"},
+    {11279, "HistoryServerCapabilitiesType_ReplaceEventCapability"},
+    {11280, "HistoryServerCapabilitiesType_UpdateEventCapability"},
+    {11281, "HistoryServerCapabilities_InsertEventCapability"},
+    {11282, "HistoryServerCapabilities_ReplaceEventCapability"},
+    {11283, "HistoryServerCapabilities_UpdateEventCapability"},
+    {11285, "AggregateFunction_TimeAverage2"},
+    {11286, "AggregateFunction_Minimum2"},
+    {11287, "AggregateFunction_Maximum2"},
+    {11288, "AggregateFunction_Range2"},
+    {11292, "AggregateFunction_WorstQuality2"},
+    {11293, "PerformUpdateType"},
+    {11295, "UpdateStructureDataDetails"},
+    {11296, "UpdateStructureDataDetails_Encoding_DefaultXml"},
+    {11300, "UpdateStructureDataDetails_Encoding_DefaultBinary"},
+    {11304, "AggregateFunction_Total2"},
+    {11305, "AggregateFunction_MinimumActualTime2"},
+    {11306, "AggregateFunction_MaximumActualTime2"},
+    {11307, "AggregateFunction_DurationInStateZero"},
+    {11308, "AggregateFunction_DurationInStateNonZero"},
+    {11312, "Server_ServerRedundancy_CurrentServerId"},
+    {11313, "Server_ServerRedundancy_RedundantServerArray"},
+    {11314, "Server_ServerRedundancy_ServerUriArray"},
+    {11322, "ShelvedStateMachineType_UnshelvedToTimedShelved_TransitionNumber"},
+    {11323, "ShelvedStateMachineType_UnshelvedToOneShotShelved_TransitionNumber"},
+    {11324, "ShelvedStateMachineType_TimedShelvedToUnshelved_TransitionNumber"},
+    {11325, "ShelvedStateMachineType_TimedShelvedToOneShotShelved_TransitionNumber"},
+    {11326, "ShelvedStateMachineType_OneShotShelvedToUnshelved_TransitionNumber"},
+    {11327, "ShelvedStateMachineType_OneShotShelvedToTimedShelved_TransitionNumber"},
+    {11340, "ExclusiveLimitStateMachineType_LowLowToLow_TransitionNumber"},
+    {11341, "ExclusiveLimitStateMachineType_LowToLowLow_TransitionNumber"},
+    {11342, "ExclusiveLimitStateMachineType_HighHighToHigh_TransitionNumber"},
+    {11343, "ExclusiveLimitStateMachineType_HighToHighHigh_TransitionNumber"},
+    {11426, "AggregateFunction_StandardDeviationSample"},
+    {11427, "AggregateFunction_StandardDeviationPopulation"},
+    {11428, "AggregateFunction_VarianceSample"},
+    {11429, "AggregateFunction_VariancePopulation"},
+    {11432, "EnumStrings"},
+    {11433, "ValueAsText"},
+    {11436, "ProgressEventType"},
+    {11437, "ProgressEventType_EventId"},
+    {11438, "ProgressEventType_EventType"},
+    {11439, "ProgressEventType_SourceNode"},
+    {11440, "ProgressEventType_SourceName"},
+    {11441, "ProgressEventType_Time"},
+    {11442, "ProgressEventType_ReceiveTime"},
+    {11443, "ProgressEventType_LocalTime"},
+    {11444, "ProgressEventType_Message"},
+    {11445, "ProgressEventType_Severity"},
+    {11446, "SystemStatusChangeEventType"},
+    {11447, "SystemStatusChangeEventType_EventId"},
+    {11448, "SystemStatusChangeEventType_EventType"},
+    {11449, "SystemStatusChangeEventType_SourceNode"},
+    {11450, "SystemStatusChangeEventType_SourceName"},
+    {11451, "SystemStatusChangeEventType_Time"},
+    {11452, "SystemStatusChangeEventType_ReceiveTime"},
+    {11453, "SystemStatusChangeEventType_LocalTime"},
+    {11454, "SystemStatusChangeEventType_Message"},
+    {11455, "SystemStatusChangeEventType_Severity"},
+    {11456, "TransitionVariableType_EffectiveTransitionTime"},
+    {11457, "FiniteTransitionVariableType_EffectiveTransitionTime"},
+    {11458, "StateMachineType_LastTransition_EffectiveTransitionTime"},
+    {11459, "FiniteStateMachineType_LastTransition_EffectiveTransitionTime"},
+    {11460, "TransitionEventType_Transition_EffectiveTransitionTime"},
+    {11461, "MultiStateValueDiscreteType_ValueAsText"},
+    {11462, "ProgramTransitionEventType_Transition_EffectiveTransitionTime"},
+    {11463, "ProgramTransitionAuditEventType_Transition_EffectiveTransitionTime"},
+    {11464, "ProgramStateMachineType_LastTransition_EffectiveTransitionTime"},
+    {11465, "ShelvedStateMachineType_LastTransition_EffectiveTransitionTime"},
+    {11466, "AlarmConditionType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11467, "LimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11468, "ExclusiveLimitStateMachineType_LastTransition_EffectiveTransitionTime"},
+    {11469, "ExclusiveLimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11470, "ExclusiveLimitAlarmType_LimitState_LastTransition_EffectiveTransitionTime"},
+    {11471, "ExclusiveLevelAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11472, "ExclusiveLevelAlarmType_LimitState_LastTransition_EffectiveTransitionTime"},
+    {11473, "ExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11474, "ExclusiveRateOfChangeAlarmType_LimitState_LastTransition_EffectiveTransitionTime"},
+    {11475, "ExclusiveDeviationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11476, "ExclusiveDeviationAlarmType_LimitState_LastTransition_EffectiveTransitionTime"},
+    {11477, "NonExclusiveLimitAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11478, "NonExclusiveLevelAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11479, "NonExclusiveRateOfChangeAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11480, "NonExclusiveDeviationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11481, "DiscreteAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11482, "OffNormalAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11483, "TripAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11485, "AuditActivateSessionEventType_SecureChannelId"},
+    {11487, "OptionSetType"},
+    {11488, "OptionSetType_OptionSetValues"},
+    {11489, "ServerType_GetMonitoredItems"},
+    {11490, "ServerType_GetMonitoredItems_InputArguments"},
+    {11491, "ServerType_GetMonitoredItems_OutputArguments"},
+    {11492, "Server_GetMonitoredItems"},
+    {11493, "Server_GetMonitoredItems_InputArguments"},
+    {11494, "Server_GetMonitoredItems_OutputArguments"},
+    {11495, "GetMonitoredItemsMethodType"},
+    {11496, "GetMonitoredItemsMethodType_InputArguments"},
+    {11497, "GetMonitoredItemsMethodType_OutputArguments"},
+    {11498, "MaxStringLength"},
+    {11499, "HistoricalDataConfigurationType_StartOfArchive"},
+    {11500, "HistoricalDataConfigurationType_StartOfOnlineArchive"},
+    {11501, "HistoryServerCapabilitiesType_DeleteEventCapability"},
+    {11502, "HistoryServerCapabilities_DeleteEventCapability"},
+    {11503, "HAConfiguration_StartOfArchive"},
+    {11504, "HAConfiguration_StartOfOnlineArchive"},
+    {11505, "AggregateFunction_StartBound"},
+    {11506, "AggregateFunction_EndBound"},
+    {11507, "AggregateFunction_DeltaBounds"},
+    {11508, "ModellingRule_OptionalPlaceholder"},
+    {11509, "ModellingRule_OptionalPlaceholder_NamingRule"},
+    {11510, "ModellingRule_MandatoryPlaceholder"},
+    {11511, "ModellingRule_MandatoryPlaceholder_NamingRule"},
+    {11512, "MaxArrayLength"},
+    {11513, "EngineeringUnits"},
+    {11514, "ServerType_ServerCapabilities_MaxArrayLength"},
+    {11515, "ServerType_ServerCapabilities_MaxStringLength"},
+    {11516, "ServerType_ServerCapabilities_OperationLimits"},
+    {11517, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerRead"},
+    {11519, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerWrite"},
+    {11521, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall"},
+    {11522, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerBrowse"},
+    {11523, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerRegisterNodes"},
+    {11524, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds"},
+    {11525, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement"},
+    {11526, "ServerType_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall"},
+    {11527, "ServerType_Namespaces"},
+    {11528, "ServerType_Namespaces_AddressSpaceFile"},
+    {11529, "ServerType_Namespaces_AddressSpaceFile_Size"},
+    {11532, "ServerType_Namespaces_AddressSpaceFile_OpenCount"},
+    {11533, "ServerType_Namespaces_AddressSpaceFile_Open"},
+    {11534, "ServerType_Namespaces_AddressSpaceFile_Open_InputArguments"},
+    {11535, "ServerType_Namespaces_AddressSpaceFile_Open_OutputArguments"},
+    {11536, "ServerType_Namespaces_AddressSpaceFile_Close"},
+    {11537, "ServerType_Namespaces_AddressSpaceFile_Close_InputArguments"},
+    {11538, "ServerType_Namespaces_AddressSpaceFile_Read"},
+    {11539, "ServerType_Namespaces_AddressSpaceFile_Read_InputArguments"},
+    {11540, "ServerType_Namespaces_AddressSpaceFile_Read_OutputArguments"},
+    {11541, "ServerType_Namespaces_AddressSpaceFile_Write"},
+    {11542, "ServerType_Namespaces_AddressSpaceFile_Write_InputArguments"},
+    {11543, "ServerType_Namespaces_AddressSpaceFile_GetPosition"},
+    {11544, "ServerType_Namespaces_AddressSpaceFile_GetPosition_InputArguments"},
+    {11545, "ServerType_Namespaces_AddressSpaceFile_GetPosition_OutputArguments"},
+    {11546, "ServerType_Namespaces_AddressSpaceFile_SetPosition"},
+    {11547, "ServerType_Namespaces_AddressSpaceFile_SetPosition_InputArguments"},
+    {11548, "ServerType_Namespaces_AddressSpaceFile_ExportNamespace"},
+    {11549, "ServerCapabilitiesType_MaxArrayLength"},
+    {11550, "ServerCapabilitiesType_MaxStringLength"},
+    {11551, "ServerCapabilitiesType_OperationLimits"},
+    {11552, "ServerCapabilitiesType_OperationLimits_MaxNodesPerRead"},
+    {11554, "ServerCapabilitiesType_OperationLimits_MaxNodesPerWrite"},
+    {11556, "ServerCapabilitiesType_OperationLimits_MaxNodesPerMethodCall"},
+    {11557, "ServerCapabilitiesType_OperationLimits_MaxNodesPerBrowse"},
+    {11558, "ServerCapabilitiesType_OperationLimits_MaxNodesPerRegisterNodes"},
+    {11559, "ServerCapabilitiesType_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds"},
+    {11560, "ServerCapabilitiesType_OperationLimits_MaxNodesPerNodeManagement"},
+    {11561, "ServerCapabilitiesType_OperationLimits_MaxMonitoredItemsPerCall"},
+    {11562, "ServerCapabilitiesType_VendorCapability_Placeholder"},
+    {11564, "OperationLimitsType"},
+    {11565, "OperationLimitsType_MaxNodesPerRead"},
+    {11567, "OperationLimitsType_MaxNodesPerWrite"},
+    {11569, "OperationLimitsType_MaxNodesPerMethodCall"},
+    {11570, "OperationLimitsType_MaxNodesPerBrowse"},
+    {11571, "OperationLimitsType_MaxNodesPerRegisterNodes"},
+    {11572, "OperationLimitsType_MaxNodesPerTranslateBrowsePathsToNodeIds"},
+    {11573, "OperationLimitsType_MaxNodesPerNodeManagement"},
+    {11574, "OperationLimitsType_MaxMonitoredItemsPerCall"},
+    {11575, "FileType"},
+    {11576, "FileType_Size"},
+    {11579, "FileType_OpenCount"},
+    {11580, "FileType_Open"},
+    {11581, "FileType_Open_InputArguments"},
+    {11582, "FileType_Open_OutputArguments"},
+    {11583, "FileType_Close"},
+    {11584, "FileType_Close_InputArguments"},
+    {11585, "FileType_Read"},
+    {11586, "FileType_Read_InputArguments"},
+    {11587, "FileType_Read_OutputArguments"},
+    {11588, "FileType_Write"},
+    {11589, "FileType_Write_InputArguments"},
+    {11590, "FileType_GetPosition"},
+    {11591, "FileType_GetPosition_InputArguments"},
+    {11592, "FileType_GetPosition_OutputArguments"},
+    {11593, "FileType_SetPosition"},
+    {11594, "FileType_SetPosition_InputArguments"},
+    {11595, "AddressSpaceFileType"},
+    {11596, "AddressSpaceFileType_Size"},
+    {11599, "AddressSpaceFileType_OpenCount"},
+    {11600, "AddressSpaceFileType_Open"},
+    {11601, "AddressSpaceFileType_Open_InputArguments"},
+    {11602, "AddressSpaceFileType_Open_OutputArguments"},
+    {11603, "AddressSpaceFileType_Close"},
+    {11604, "AddressSpaceFileType_Close_InputArguments"},
+    {11605, "AddressSpaceFileType_Read"},
+    {11606, "AddressSpaceFileType_Read_InputArguments"},
+    {11607, "AddressSpaceFileType_Read_OutputArguments"},
+    {11608, "AddressSpaceFileType_Write"},
+    {11609, "AddressSpaceFileType_Write_InputArguments"},
+    {11610, "AddressSpaceFileType_GetPosition"},
+    {11611, "AddressSpaceFileType_GetPosition_InputArguments"},
+    {11612, "AddressSpaceFileType_GetPosition_OutputArguments"},
+    {11613, "AddressSpaceFileType_SetPosition"},
+    {11614, "AddressSpaceFileType_SetPosition_InputArguments"},
+    {11615, "AddressSpaceFileType_ExportNamespace"},
+    {11616, "NamespaceMetadataType"},
+    {11617, "NamespaceMetadataType_NamespaceUri"},
+    {11618, "NamespaceMetadataType_NamespaceVersion"},
+    {11619, "NamespaceMetadataType_NamespacePublicationDate"},
+    {11620, "NamespaceMetadataType_IsNamespaceSubset"},
+    {11621, "NamespaceMetadataType_StaticNodeIdTypes"},
+    {11622, "NamespaceMetadataType_StaticNumericNodeIdRange"},
+    {11623, "NamespaceMetadataType_StaticStringNodeIdPattern"},
+    {11624, "NamespaceMetadataType_NamespaceFile"},
+    {11625, "NamespaceMetadataType_NamespaceFile_Size"},
+    {11628, "NamespaceMetadataType_NamespaceFile_OpenCount"},
+    {11629, "NamespaceMetadataType_NamespaceFile_Open"},
+    {11630, "NamespaceMetadataType_NamespaceFile_Open_InputArguments"},
+    {11631, "NamespaceMetadataType_NamespaceFile_Open_OutputArguments"},
+    {11632, "NamespaceMetadataType_NamespaceFile_Close"},
+    {11633, "NamespaceMetadataType_NamespaceFile_Close_InputArguments"},
+    {11634, "NamespaceMetadataType_NamespaceFile_Read"},
+    {11635, "NamespaceMetadataType_NamespaceFile_Read_InputArguments"},
+    {11636, "NamespaceMetadataType_NamespaceFile_Read_OutputArguments"},
+    {11637, "NamespaceMetadataType_NamespaceFile_Write"},
+    {11638, "NamespaceMetadataType_NamespaceFile_Write_InputArguments"},
+    {11639, "NamespaceMetadataType_NamespaceFile_GetPosition"},
+    {11640, "NamespaceMetadataType_NamespaceFile_GetPosition_InputArguments"},
+    {11641, "NamespaceMetadataType_NamespaceFile_GetPosition_OutputArguments"},
+    {11642, "NamespaceMetadataType_NamespaceFile_SetPosition"},
+    {11643, "NamespaceMetadataType_NamespaceFile_SetPosition_InputArguments"},
+    {11644, "NamespaceMetadataType_NamespaceFile_ExportNamespace"},
+    {11645, "NamespacesType"},
+    {11646, "NamespacesType_NamespaceIdentifier_Placeholder"},
+    {11647, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceUri"},
+    {11648, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceVersion"},
+    {11649, "NamespacesType_NamespaceIdentifier_Placeholder_NamespacePublicationDate"},
+    {11650, "NamespacesType_NamespaceIdentifier_Placeholder_IsNamespaceSubset"},
+    {11651, "NamespacesType_NamespaceIdentifier_Placeholder_StaticNodeIdTypes"},
+    {11652, "NamespacesType_NamespaceIdentifier_Placeholder_StaticNumericNodeIdRange"},
+    {11653, "NamespacesType_NamespaceIdentifier_Placeholder_StaticStringNodeIdPattern"},
+    {11654, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile"},
+    {11655, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Size"},
+    {11658, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_OpenCount"},
+    {11659, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open"},
+    {11660, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open_InputArguments"},
+    {11661, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Open_OutputArguments"},
+    {11662, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Close"},
+    {11663, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Close_InputArguments"},
+    {11664, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read"},
+    {11665, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read_InputArguments"},
+    {11666, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Read_OutputArguments"},
+    {11667, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Write"},
+    {11668, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Write_InputArguments"},
+    {11669, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition"},
+    {11670, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition_InputArguments"},
+    {11671, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_GetPosition_OutputArguments"},
+    {11672, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_SetPosition"},
+    {11673, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_SetPosition_InputArguments"},
+    {11674, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_ExportNamespace"},
+    {11675, "NamespacesType_AddressSpaceFile"},
+    {11676, "NamespacesType_AddressSpaceFile_Size"},
+    {11679, "NamespacesType_AddressSpaceFile_OpenCount"},
+    {11680, "NamespacesType_AddressSpaceFile_Open"},
+    {11681, "NamespacesType_AddressSpaceFile_Open_InputArguments"},
+    {11682, "NamespacesType_AddressSpaceFile_Open_OutputArguments"},
+    {11683, "NamespacesType_AddressSpaceFile_Close"},
+    {11684, "NamespacesType_AddressSpaceFile_Close_InputArguments"},
+    {11685, "NamespacesType_AddressSpaceFile_Read"},
+    {11686, "NamespacesType_AddressSpaceFile_Read_InputArguments"},
+    {11687, "NamespacesType_AddressSpaceFile_Read_OutputArguments"},
+    {11688, "NamespacesType_AddressSpaceFile_Write"},
+    {11689, "NamespacesType_AddressSpaceFile_Write_InputArguments"},
+    {11690, "NamespacesType_AddressSpaceFile_GetPosition"},
+    {11691, "NamespacesType_AddressSpaceFile_GetPosition_InputArguments"},
+    {11692, "NamespacesType_AddressSpaceFile_GetPosition_OutputArguments"},
+    {11693, "NamespacesType_AddressSpaceFile_SetPosition"},
+    {11694, "NamespacesType_AddressSpaceFile_SetPosition_InputArguments"},
+    {11695, "NamespacesType_AddressSpaceFile_ExportNamespace"},
+    {11696, "SystemStatusChangeEventType_SystemState"},
+    {11697, "SamplingIntervalDiagnosticsType_SampledMonitoredItemsCount"},
+    {11698, "SamplingIntervalDiagnosticsType_MaxSampledMonitoredItemsCount"},
+    {11699, "SamplingIntervalDiagnosticsType_DisabledMonitoredItemsSamplingCount"},
+    {11701, "OptionSetType_BitMask"},
+    {11702, "Server_ServerCapabilities_MaxArrayLength"},
+    {11703, "Server_ServerCapabilities_MaxStringLength"},
+    {11704, "Server_ServerCapabilities_OperationLimits"},
+    {11705, "Server_ServerCapabilities_OperationLimits_MaxNodesPerRead"},
+    {11707, "Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite"},
+    {11709, "Server_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall"},
+    {11710, "Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse"},
+    {11711, "Server_ServerCapabilities_OperationLimits_MaxNodesPerRegisterNodes"},
+    {11712, "Server_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds"},
+    {11713, "Server_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement"},
+    {11714, "Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall"},
+    {11715, "Server_Namespaces"},
+    {11716, "Server_Namespaces_AddressSpaceFile"},
+    {11717, "Server_Namespaces_AddressSpaceFile_Size"},
+    {11720, "Server_Namespaces_AddressSpaceFile_OpenCount"},
+    {11721, "Server_Namespaces_AddressSpaceFile_Open"},
+    {11722, "Server_Namespaces_AddressSpaceFile_Open_InputArguments"},
+    {11723, "Server_Namespaces_AddressSpaceFile_Open_OutputArguments"},
+    {11724, "Server_Namespaces_AddressSpaceFile_Close"},
+    {11725, "Server_Namespaces_AddressSpaceFile_Close_InputArguments"},
+    {11726, "Server_Namespaces_AddressSpaceFile_Read"},
+    {11727, "Server_Namespaces_AddressSpaceFile_Read_InputArguments"},
+    {11728, "Server_Namespaces_AddressSpaceFile_Read_OutputArguments"},
+    {11729, "Server_Namespaces_AddressSpaceFile_Write"},
+    {11730, "Server_Namespaces_AddressSpaceFile_Write_InputArguments"},
+    {11731, "Server_Namespaces_AddressSpaceFile_GetPosition"},
+    {11732, "Server_Namespaces_AddressSpaceFile_GetPosition_InputArguments"},
+    {11733, "Server_Namespaces_AddressSpaceFile_GetPosition_OutputArguments"},
+    {11734, "Server_Namespaces_AddressSpaceFile_SetPosition"},
+    {11735, "Server_Namespaces_AddressSpaceFile_SetPosition_InputArguments"},
+    {11736, "Server_Namespaces_AddressSpaceFile_ExportNamespace"},
+    {11737, "BitFieldMaskDataType"},
+    {11738, "OpenMethodType"},
+    {11739, "OpenMethodType_InputArguments"},
+    {11740, "OpenMethodType_OutputArguments"},
+    {11741, "CloseMethodType"},
+    {11742, "CloseMethodType_InputArguments"},
+    {11743, "ReadMethodType"},
+    {11744, "ReadMethodType_InputArguments"},
+    {11745, "ReadMethodType_OutputArguments"},
+    {11746, "WriteMethodType"},
+    {11747, "WriteMethodType_InputArguments"},
+    {11748, "GetPositionMethodType"},
+    {11749, "GetPositionMethodType_InputArguments"},
+    {11750, "GetPositionMethodType_OutputArguments"},
+    {11751, "SetPositionMethodType"},
+    {11752, "SetPositionMethodType_InputArguments"},
+    {11753, "SystemOffNormalAlarmType"},
+    {11754, "SystemOffNormalAlarmType_EventId"},
+    {11755, "SystemOffNormalAlarmType_EventType"},
+    {11756, "SystemOffNormalAlarmType_SourceNode"},
+    {11757, "SystemOffNormalAlarmType_SourceName"},
+    {11758, "SystemOffNormalAlarmType_Time"},
+    {11759, "SystemOffNormalAlarmType_ReceiveTime"},
+    {11760, "SystemOffNormalAlarmType_LocalTime"},
+    {11761, "SystemOffNormalAlarmType_Message"},
+    {11762, "SystemOffNormalAlarmType_Severity"},
+    {11763, "SystemOffNormalAlarmType_ConditionClassId"},
+    {11764, "SystemOffNormalAlarmType_ConditionClassName"},
+    {11765, "SystemOffNormalAlarmType_ConditionName"},
+    {11766, "SystemOffNormalAlarmType_BranchId"},
+    {11767, "SystemOffNormalAlarmType_Retain"},
+    {11768, "SystemOffNormalAlarmType_EnabledState"},
+    {11769, "SystemOffNormalAlarmType_EnabledState_Id"},
+    {11770, "SystemOffNormalAlarmType_EnabledState_Name"},
+    {11771, "SystemOffNormalAlarmType_EnabledState_Number"},
+    {11772, "SystemOffNormalAlarmType_EnabledState_EffectiveDisplayName"},
+    {11773, "SystemOffNormalAlarmType_EnabledState_TransitionTime"},
+    {11774, "SystemOffNormalAlarmType_EnabledState_EffectiveTransitionTime"},
+    {11775, "SystemOffNormalAlarmType_EnabledState_TrueState"},
+    {11776, "SystemOffNormalAlarmType_EnabledState_FalseState"},
+    {11777, "SystemOffNormalAlarmType_Quality"},
+    {11778, "SystemOffNormalAlarmType_Quality_SourceTimestamp"},
+    {11779, "SystemOffNormalAlarmType_LastSeverity"},
+    {11780, "SystemOffNormalAlarmType_LastSeverity_SourceTimestamp"},
+    {11781, "SystemOffNormalAlarmType_Comment"},
+    {11782, "SystemOffNormalAlarmType_Comment_SourceTimestamp"},
+    {11783, "SystemOffNormalAlarmType_ClientUserId"},
+    {11784, "SystemOffNormalAlarmType_Disable"},
+    {11785, "SystemOffNormalAlarmType_Enable"},
+    {11786, "SystemOffNormalAlarmType_AddComment"},
+    {11787, "SystemOffNormalAlarmType_AddComment_InputArguments"},
+    {11788, "SystemOffNormalAlarmType_ConditionRefresh"},
+    {11789, "SystemOffNormalAlarmType_ConditionRefresh_InputArguments"},
+    {11790, "SystemOffNormalAlarmType_AckedState"},
+    {11791, "SystemOffNormalAlarmType_AckedState_Id"},
+    {11792, "SystemOffNormalAlarmType_AckedState_Name"},
+    {11793, "SystemOffNormalAlarmType_AckedState_Number"},
+    {11794, "SystemOffNormalAlarmType_AckedState_EffectiveDisplayName"},
+    {11795, "SystemOffNormalAlarmType_AckedState_TransitionTime"},
+    {11796, "SystemOffNormalAlarmType_AckedState_EffectiveTransitionTime"},
+    {11797, "SystemOffNormalAlarmType_AckedState_TrueState"},
+    {11798, "SystemOffNormalAlarmType_AckedState_FalseState"},
+    {11799, "SystemOffNormalAlarmType_ConfirmedState"},
+    {11800, "SystemOffNormalAlarmType_ConfirmedState_Id"},
+    {11801, "SystemOffNormalAlarmType_ConfirmedState_Name"},
+    {11802, "SystemOffNormalAlarmType_ConfirmedState_Number"},
+    {11803, "SystemOffNormalAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {11804, "SystemOffNormalAlarmType_ConfirmedState_TransitionTime"},
+    {11805, "SystemOffNormalAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {11806, "SystemOffNormalAlarmType_ConfirmedState_TrueState"},
+    {11807, "SystemOffNormalAlarmType_ConfirmedState_FalseState"},
+    {11808, "SystemOffNormalAlarmType_Acknowledge"},
+    {11809, "SystemOffNormalAlarmType_Acknowledge_InputArguments"},
+    {11810, "SystemOffNormalAlarmType_Confirm"},
+    {11811, "SystemOffNormalAlarmType_Confirm_InputArguments"},
+    {11812, "SystemOffNormalAlarmType_ActiveState"},
+    {11813, "SystemOffNormalAlarmType_ActiveState_Id"},
+    {11814, "SystemOffNormalAlarmType_ActiveState_Name"},
+    {11815, "SystemOffNormalAlarmType_ActiveState_Number"},
+    {11816, "SystemOffNormalAlarmType_ActiveState_EffectiveDisplayName"},
+    {11817, "SystemOffNormalAlarmType_ActiveState_TransitionTime"},
+    {11818, "SystemOffNormalAlarmType_ActiveState_EffectiveTransitionTime"},
+    {11819, "SystemOffNormalAlarmType_ActiveState_TrueState"},
+    {11820, "SystemOffNormalAlarmType_ActiveState_FalseState"},
+    {11821, "SystemOffNormalAlarmType_InputNode"},
+    {11822, "SystemOffNormalAlarmType_SuppressedState"},
+    {11823, "SystemOffNormalAlarmType_SuppressedState_Id"},
+    {11824, "SystemOffNormalAlarmType_SuppressedState_Name"},
+    {11825, "SystemOffNormalAlarmType_SuppressedState_Number"},
+    {11826, "SystemOffNormalAlarmType_SuppressedState_EffectiveDisplayName"},
+    {11827, "SystemOffNormalAlarmType_SuppressedState_TransitionTime"},
+    {11828, "SystemOffNormalAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {11829, "SystemOffNormalAlarmType_SuppressedState_TrueState"},
+    {11830, "SystemOffNormalAlarmType_SuppressedState_FalseState"},
+    {11831, "SystemOffNormalAlarmType_ShelvingState"},
+    {11832, "SystemOffNormalAlarmType_ShelvingState_CurrentState"},
+    {11833, "SystemOffNormalAlarmType_ShelvingState_CurrentState_Id"},
+    {11834, "SystemOffNormalAlarmType_ShelvingState_CurrentState_Name"},
+    {11835, "SystemOffNormalAlarmType_ShelvingState_CurrentState_Number"},
+    {11836, "SystemOffNormalAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {11837, "SystemOffNormalAlarmType_ShelvingState_LastTransition"},
+    {11838, "SystemOffNormalAlarmType_ShelvingState_LastTransition_Id"},
+    {11839, "SystemOffNormalAlarmType_ShelvingState_LastTransition_Name"},
+    {11840, "SystemOffNormalAlarmType_ShelvingState_LastTransition_Number"},
+    {11841, "SystemOffNormalAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {11842, "SystemOffNormalAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {11843, "SystemOffNormalAlarmType_ShelvingState_UnshelveTime"},
+    {11844, "SystemOffNormalAlarmType_ShelvingState_Unshelve"},
+    {11845, "SystemOffNormalAlarmType_ShelvingState_OneShotShelve"},
+    {11846, "SystemOffNormalAlarmType_ShelvingState_TimedShelve"},
+    {11847, "SystemOffNormalAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {11848, "SystemOffNormalAlarmType_SuppressedOrShelved"},
+    {11849, "SystemOffNormalAlarmType_MaxTimeShelved"},
+    {11850, "SystemOffNormalAlarmType_NormalState"},
+    {11851, "AuditConditionCommentEventType_Comment"},
+    {11852, "AuditConditionRespondEventType_SelectedResponse"},
+    {11853, "AuditConditionAcknowledgeEventType_Comment"},
+    {11854, "AuditConditionConfirmEventType_Comment"},
+    {11855, "AuditConditionShelvingEventType_ShelvingTime"},
+    {11856, "AuditProgramTransitionEventType"},
+    {11857, "AuditProgramTransitionEventType_EventId"},
+    {11858, "AuditProgramTransitionEventType_EventType"},
+    {11859, "AuditProgramTransitionEventType_SourceNode"},
+    {11860, "AuditProgramTransitionEventType_SourceName"},
+    {11861, "AuditProgramTransitionEventType_Time"},
+    {11862, "AuditProgramTransitionEventType_ReceiveTime"},
+    {11863, "AuditProgramTransitionEventType_LocalTime"},
+    {11864, "AuditProgramTransitionEventType_Message"},
+    {11865, "AuditProgramTransitionEventType_Severity"},
+    {11866, "AuditProgramTransitionEventType_ActionTimeStamp"},
+    {11867, "AuditProgramTransitionEventType_Status"},
+    {11868, "AuditProgramTransitionEventType_ServerId"},
+    {11869, "AuditProgramTransitionEventType_ClientAuditEntryId"},
+    {11870, "AuditProgramTransitionEventType_ClientUserId"},
+    {11871, "AuditProgramTransitionEventType_MethodId"},
+    {11872, "AuditProgramTransitionEventType_InputArguments"},
+    {11873, "AuditProgramTransitionEventType_OldStateId"},
+    {11874, "AuditProgramTransitionEventType_NewStateId"},
+    {11875, "AuditProgramTransitionEventType_TransitionNumber"},
+    {11876, "HistoricalDataConfigurationType_AggregateFunctions"},
+    {11877, "HAConfiguration_AggregateFunctions"},
+    {11878, "NodeClass_EnumValues"},
+    {11879, "InstanceNode"},
+    {11880, "TypeNode"},
+    {11881, "NodeAttributesMask_EnumValues"},
+    {11882, "AttributeWriteMask_EnumValues"},
+    {11883, "BrowseResultMask_EnumValues"},
+    {11884, "HistoryUpdateType_EnumValues"},
+    {11885, "PerformUpdateType_EnumValues"},
+    {11887, "InstanceNode_Encoding_DefaultXml"},
+    {11888, "TypeNode_Encoding_DefaultXml"},
+    {11889, "InstanceNode_Encoding_DefaultBinary"},
+    {11890, "TypeNode_Encoding_DefaultBinary"},
+    {11891, "SessionDiagnosticsObjectType_SessionDiagnostics_UnauthorizedRequestCount"},
+    {11892, "SessionDiagnosticsVariableType_UnauthorizedRequestCount"},
+    {11939, "OpenFileMode"},
+    {11940, "OpenFileMode_EnumValues"},
+    {11941, "ModelChangeStructureVerbMask"},
+    {11942, "ModelChangeStructureVerbMask_EnumValues"},
+    {11943, "EndpointUrlListDataType"},
+    {11944, "NetworkGroupDataType"},
+    {11945, "NonTransparentNetworkRedundancyType"},
+    {11946, "NonTransparentNetworkRedundancyType_RedundancySupport"},
+    {11947, "NonTransparentNetworkRedundancyType_ServerUriArray"},
+    {11948, "NonTransparentNetworkRedundancyType_ServerNetworkGroups"},
+    {11949, "EndpointUrlListDataType_Encoding_DefaultXml"},
+    {11950, "NetworkGroupDataType_Encoding_DefaultXml"},
+    {11951, "OpcUa_XmlSchema_EndpointUrlListDataType"},
+    {11952, "OpcUa_XmlSchema_EndpointUrlListDataType_DataTypeVersion"},
+    {11953, "OpcUa_XmlSchema_EndpointUrlListDataType_DictionaryFragment"},
+    {11954, "OpcUa_XmlSchema_NetworkGroupDataType"},
+    {11955, "OpcUa_XmlSchema_NetworkGroupDataType_DataTypeVersion"},
+    {11956, "OpcUa_XmlSchema_NetworkGroupDataType_DictionaryFragment"},
+    {11957, "EndpointUrlListDataType_Encoding_DefaultBinary"},
+    {11958, "NetworkGroupDataType_Encoding_DefaultBinary"},
+    {11959, "OpcUa_BinarySchema_EndpointUrlListDataType"},
+    {11960, "OpcUa_BinarySchema_EndpointUrlListDataType_DataTypeVersion"},
+    {11961, "OpcUa_BinarySchema_EndpointUrlListDataType_DictionaryFragment"},
+    {11962, "OpcUa_BinarySchema_NetworkGroupDataType"},
+    {11963, "OpcUa_BinarySchema_NetworkGroupDataType_DataTypeVersion"},
+    {11964, "OpcUa_BinarySchema_NetworkGroupDataType_DictionaryFragment"},
+    {12021, "ArrayItemType"},
+    {12022, "ArrayItemType_Definition"},
+    {12023, "ArrayItemType_ValuePrecision"},
+    {12024, "ArrayItemType_InstrumentRange"},
+    {12025, "ArrayItemType_EURange"},
+    {12026, "ArrayItemType_EngineeringUnits"},
+    {12027, "ArrayItemType_Title"},
+    {12028, "ArrayItemType_AxisScaleType"},
+    {12029, "YArrayItemType"},
+    {12030, "YArrayItemType_Definition"},
+    {12031, "YArrayItemType_ValuePrecision"},
+    {12032, "YArrayItemType_InstrumentRange"},
+    {12033, "YArrayItemType_EURange"},
+    {12034, "YArrayItemType_EngineeringUnits"},
+    {12035, "YArrayItemType_Title"},
+    {12036, "YArrayItemType_AxisScaleType"},
+    {12037, "YArrayItemType_XAxisDefinition"},
+    {12038, "XYArrayItemType"},
+    {12039, "XYArrayItemType_Definition"},
+    {12040, "XYArrayItemType_ValuePrecision"},
+    {12041, "XYArrayItemType_InstrumentRange"},
+    {12042, "XYArrayItemType_EURange"},
+    {12043, "XYArrayItemType_EngineeringUnits"},
+    {12044, "XYArrayItemType_Title"},
+    {12045, "XYArrayItemType_AxisScaleType"},
+    {12046, "XYArrayItemType_XAxisDefinition"},
+    {12047, "ImageItemType"},
+    {12048, "ImageItemType_Definition"},
+    {12049, "ImageItemType_ValuePrecision"},
+    {12050, "ImageItemType_InstrumentRange"},
+    {12051, "ImageItemType_EURange"},
+    {12052, "ImageItemType_EngineeringUnits"},
+    {12053, "ImageItemType_Title"},
+    {12054, "ImageItemType_AxisScaleType"},
+    {12055, "ImageItemType_XAxisDefinition"},
+    {12056, "ImageItemType_YAxisDefinition"},
+    {12057, "CubeItemType"},
+    {12058, "CubeItemType_Definition"},
+    {12059, "CubeItemType_ValuePrecision"},
+    {12060, "CubeItemType_InstrumentRange"},
+    {12061, "CubeItemType_EURange"},
+    {12062, "CubeItemType_EngineeringUnits"},
+    {12063, "CubeItemType_Title"},
+    {12064, "CubeItemType_AxisScaleType"},
+    {12065, "CubeItemType_XAxisDefinition"},
+    {12066, "CubeItemType_YAxisDefinition"},
+    {12067, "CubeItemType_ZAxisDefinition"},
+    {12068, "NDimensionArrayItemType"},
+    {12069, "NDimensionArrayItemType_Definition"},
+    {12070, "NDimensionArrayItemType_ValuePrecision"},
+    {12071, "NDimensionArrayItemType_InstrumentRange"},
+    {12072, "NDimensionArrayItemType_EURange"},
+    {12073, "NDimensionArrayItemType_EngineeringUnits"},
+    {12074, "NDimensionArrayItemType_Title"},
+    {12075, "NDimensionArrayItemType_AxisScaleType"},
+    {12076, "NDimensionArrayItemType_AxisDefinition"},
+    {12077, "AxisScaleEnumeration"},
+    {12078, "AxisScaleEnumeration_EnumStrings"},
+    {12079, "AxisInformation"},
+    {12080, "XVType"},
+    {12081, "AxisInformation_Encoding_DefaultXml"},
+    {12082, "XVType_Encoding_DefaultXml"},
+    {12083, "OpcUa_XmlSchema_AxisInformation"},
+    {12084, "OpcUa_XmlSchema_AxisInformation_DataTypeVersion"},
+    {12085, "OpcUa_XmlSchema_AxisInformation_DictionaryFragment"},
+    {12086, "OpcUa_XmlSchema_XVType"},
+    {12087, "OpcUa_XmlSchema_XVType_DataTypeVersion"},
+    {12088, "OpcUa_XmlSchema_XVType_DictionaryFragment"},
+    {12089, "AxisInformation_Encoding_DefaultBinary"},
+    {12090, "XVType_Encoding_DefaultBinary"},
+    {12091, "OpcUa_BinarySchema_AxisInformation"},
+    {12092, "OpcUa_BinarySchema_AxisInformation_DataTypeVersion"},
+    {12093, "OpcUa_BinarySchema_AxisInformation_DictionaryFragment"},
+    {12094, "OpcUa_BinarySchema_XVType"},
+    {12095, "OpcUa_BinarySchema_XVType_DataTypeVersion"},
+    {12096, "OpcUa_BinarySchema_XVType_DictionaryFragment"},
+    {12097, "SessionsDiagnosticsSummaryType_ClientName_Placeholder"},
+    {12098, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics"},
+    {12099, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SessionId"},
+    {12100, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SessionName"},
+    {12101, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientDescription"},
+    {12102, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ServerUri"},
+    {12103, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_EndpointUrl"},
+    {12104, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_LocaleIds"},
+    {12105, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ActualSessionTimeout"},
+    {12106, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_MaxResponseMessageSize"},
+    {12107, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientConnectionTime"},
+    {12108, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ClientLastContactTime"},
+    {12109, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentSubscriptionsCount"},
+    {12110, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentMonitoredItemsCount"},
+    {12111, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CurrentPublishRequestsInQueue"},
+    {12112, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TotalRequestCount"},
+    {12113, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_UnauthorizedRequestCount"},
+    {12114, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ReadCount"},
+    {12115, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_HistoryReadCount"},
+    {12116, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_WriteCount"},
+    {12117, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_HistoryUpdateCount"},
+    {12118, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CallCount"},
+    {12119, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CreateMonitoredItemsCount"},
+    {12120, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ModifyMonitoredItemsCount"},
+    {12121, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetMonitoringModeCount"},
+    {12122, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetTriggeringCount"},
+    {12123, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteMonitoredItemsCount"},
+    {12124, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_CreateSubscriptionCount"},
+    {12125, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_ModifySubscriptionCount"},
+    {12126, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_SetPublishingModeCount"},
+    {12127, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_PublishCount"},
+    {12128, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_RepublishCount"},
+    {12129, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TransferSubscriptionsCount"},
+    {12130, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteSubscriptionsCount"},
+    {12131, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_AddNodesCount"},
+    {12132, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_AddReferencesCount"},
+    {12133, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteNodesCount"},
+    {12134, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_DeleteReferencesCount"},
+    {12135, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_BrowseCount"},
+    {12136, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_BrowseNextCount"},
+    {12137, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount"},
+    {12138, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_QueryFirstCount"},
+    {12139, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_QueryNextCount"},
+    {12140, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_RegisterNodesCount"},
+    {12141, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionDiagnostics_UnregisterNodesCount"},
+    {12142, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics"},
+    {12143, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SessionId"},
+    {12144, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientUserIdOfSession"},
+    {12145, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientUserIdHistory"},
+    {12146, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_AuthenticationMechanism"},
+    {12147, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_Encoding"},
+    {12148, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_TransportProtocol"},
+    {12149, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SecurityMode"},
+    {12150, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_SecurityPolicyUri"},
+    {12151, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SessionSecurityDiagnostics_ClientCertificate"},
+    {12152, "SessionsDiagnosticsSummaryType_ClientName_Placeholder_SubscriptionDiagnosticsArray"},
+    {12153, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData"},
+    {12154, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadEvents"},
+    {12155, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateData"},
+    {12156, "ServerType_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateEvents"},
+    {12157, "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryReadData"},
+    {12158, "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryReadEvents"},
+    {12159, "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryUpdateData"},
+    {12160, "ServerCapabilitiesType_OperationLimits_MaxNodesPerHistoryUpdateEvents"},
+    {12161, "OperationLimitsType_MaxNodesPerHistoryReadData"},
+    {12162, "OperationLimitsType_MaxNodesPerHistoryReadEvents"},
+    {12163, "OperationLimitsType_MaxNodesPerHistoryUpdateData"},
+    {12164, "OperationLimitsType_MaxNodesPerHistoryUpdateEvents"},
+    {12165, "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData"},
+    {12166, "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadEvents"},
+    {12167, "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateData"},
+    {12168, "Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryUpdateEvents"},
+    {12169, "NamingRuleType_EnumValues"},
+    {12170, "ViewVersion"},
+    {12171, "ComplexNumberType"},
+    {12172, "DoubleComplexNumberType"},
+    {12173, "ComplexNumberType_Encoding_DefaultXml"},
+    {12174, "DoubleComplexNumberType_Encoding_DefaultXml"},
+    {12175, "OpcUa_XmlSchema_ComplexNumberType"},
+    {12176, "OpcUa_XmlSchema_ComplexNumberType_DataTypeVersion"},
+    {12177, "OpcUa_XmlSchema_ComplexNumberType_DictionaryFragment"},
+    {12178, "OpcUa_XmlSchema_DoubleComplexNumberType"},
+    {12179, "OpcUa_XmlSchema_DoubleComplexNumberType_DataTypeVersion"},
+    {12180, "OpcUa_XmlSchema_DoubleComplexNumberType_DictionaryFragment"},
+    {12181, "ComplexNumberType_Encoding_DefaultBinary"},
+    {12182, "DoubleComplexNumberType_Encoding_DefaultBinary"},
+    {12183, "OpcUa_BinarySchema_ComplexNumberType"},
+    {12184, "OpcUa_BinarySchema_ComplexNumberType_DataTypeVersion"},
+    {12185, "OpcUa_BinarySchema_ComplexNumberType_DictionaryFragment"},
+    {12186, "OpcUa_BinarySchema_DoubleComplexNumberType"},
+    {12187, "OpcUa_BinarySchema_DoubleComplexNumberType_DataTypeVersion"},
+    {12188, "OpcUa_BinarySchema_DoubleComplexNumberType_DictionaryFragment"},
+    {12189, "ServerOnNetwork"},
+    {12190, "FindServersOnNetworkRequest"},
+    {12191, "FindServersOnNetworkResponse"},
+    {12193, "RegisterServer2Request"},
+    {12194, "RegisterServer2Response"},
+    {12195, "ServerOnNetwork_Encoding_DefaultXml"},
+    {12196, "FindServersOnNetworkRequest_Encoding_DefaultXml"},
+    {12197, "FindServersOnNetworkResponse_Encoding_DefaultXml"},
+    {12199, "RegisterServer2Request_Encoding_DefaultXml"},
+    {12200, "RegisterServer2Response_Encoding_DefaultXml"},
+    {12201, "OpcUa_XmlSchema_ServerOnNetwork"},
+    {12202, "OpcUa_XmlSchema_ServerOnNetwork_DataTypeVersion"},
+    {12203, "OpcUa_XmlSchema_ServerOnNetwork_DictionaryFragment"},
+    {12207, "ServerOnNetwork_Encoding_DefaultBinary"},
+    {12208, "FindServersOnNetworkRequest_Encoding_DefaultBinary"},
+    {12209, "FindServersOnNetworkResponse_Encoding_DefaultBinary"},
+    {12211, "RegisterServer2Request_Encoding_DefaultBinary"},
+    {12212, "RegisterServer2Response_Encoding_DefaultBinary"},
+    {12213, "OpcUa_BinarySchema_ServerOnNetwork"},
+    {12214, "OpcUa_BinarySchema_ServerOnNetwork_DataTypeVersion"},
+    {12215, "OpcUa_BinarySchema_ServerOnNetwork_DictionaryFragment"},
+    {12502, "ProgressEventType_Context"},
+    {12503, "ProgressEventType_Progress"},
+    {12513, "OpenWithMasksMethodType"},
+    {12514, "OpenWithMasksMethodType_InputArguments"},
+    {12515, "OpenWithMasksMethodType_OutputArguments"},
+    {12516, "CloseAndUpdateMethodType"},
+    {12517, "CloseAndUpdateMethodType_OutputArguments"},
+    {12518, "AddCertificateMethodType"},
+    {12519, "AddCertificateMethodType_InputArguments"},
+    {12520, "RemoveCertificateMethodType"},
+    {12521, "RemoveCertificateMethodType_InputArguments"},
+    {12522, "TrustListType"},
+    {12523, "TrustListType_Size"},
+    {12526, "TrustListType_OpenCount"},
+    {12527, "TrustListType_Open"},
+    {12528, "TrustListType_Open_InputArguments"},
+    {12529, "TrustListType_Open_OutputArguments"},
+    {12530, "TrustListType_Close"},
+    {12531, "TrustListType_Close_InputArguments"},
+    {12532, "TrustListType_Read"},
+    {12533, "TrustListType_Read_InputArguments"},
+    {12534, "TrustListType_Read_OutputArguments"},
+    {12535, "TrustListType_Write"},
+    {12536, "TrustListType_Write_InputArguments"},
+    {12537, "TrustListType_GetPosition"},
+    {12538, "TrustListType_GetPosition_InputArguments"},
+    {12539, "TrustListType_GetPosition_OutputArguments"},
+    {12540, "TrustListType_SetPosition"},
+    {12541, "TrustListType_SetPosition_InputArguments"},
+    {12542, "TrustListType_LastUpdateTime"},
+    {12543, "TrustListType_OpenWithMasks"},
+    {12544, "TrustListType_OpenWithMasks_InputArguments"},
+    {12545, "TrustListType_OpenWithMasks_OutputArguments"},
+    {12546, "TrustListType_CloseAndUpdate"},
+    {12547, "TrustListType_CloseAndUpdate_OutputArguments"},
+    {12548, "TrustListType_AddCertificate"},
+    {12549, "TrustListType_AddCertificate_InputArguments"},
+    {12550, "TrustListType_RemoveCertificate"},
+    {12551, "TrustListType_RemoveCertificate_InputArguments"},
+    {12552, "TrustListMasks"},
+    {12553, "TrustListMasks_EnumValues"},
+    {12554, "TrustListDataType"},
+    {12555, "CertificateGroupType"},
+    {12556, "CertificateType"},
+    {12557, "ApplicationCertificateType"},
+    {12558, "HttpsCertificateType"},
+    {12559, "RsaMinApplicationCertificateType"},
+    {12560, "RsaSha256ApplicationCertificateType"},
+    {12561, "TrustListUpdatedAuditEventType"},
+    {12562, "TrustListUpdatedAuditEventType_EventId"},
+    {12563, "TrustListUpdatedAuditEventType_EventType"},
+    {12564, "TrustListUpdatedAuditEventType_SourceNode"},
+    {12565, "TrustListUpdatedAuditEventType_SourceName"},
+    {12566, "TrustListUpdatedAuditEventType_Time"},
+    {12567, "TrustListUpdatedAuditEventType_ReceiveTime"},
+    {12568, "TrustListUpdatedAuditEventType_LocalTime"},
+    {12569, "TrustListUpdatedAuditEventType_Message"},
+    {12570, "TrustListUpdatedAuditEventType_Severity"},
+    {12571, "TrustListUpdatedAuditEventType_ActionTimeStamp"},
+    {12572, "TrustListUpdatedAuditEventType_Status"},
+    {12573, "TrustListUpdatedAuditEventType_ServerId"},
+    {12574, "TrustListUpdatedAuditEventType_ClientAuditEntryId"},
+    {12575, "TrustListUpdatedAuditEventType_ClientUserId"},
+    {12576, "TrustListUpdatedAuditEventType_MethodId"},
+    {12577, "TrustListUpdatedAuditEventType_InputArguments"},
+    {12578, "UpdateCertificateMethodType"},
+    {12579, "UpdateCertificateMethodType_InputArguments"},
+    {12580, "UpdateCertificateMethodType_OutputArguments"},
+    {12581, "ServerConfigurationType"},
+    {12583, "ServerConfigurationType_SupportedPrivateKeyFormats"},
+    {12584, "ServerConfigurationType_MaxTrustListSize"},
+    {12585, "ServerConfigurationType_MulticastDnsEnabled"},
+    {12616, "ServerConfigurationType_UpdateCertificate"},
+    {12617, "ServerConfigurationType_UpdateCertificate_InputArguments"},
+    {12618, "ServerConfigurationType_UpdateCertificate_OutputArguments"},
+    {12620, "CertificateUpdatedAuditEventType"},
+    {12621, "CertificateUpdatedAuditEventType_EventId"},
+    {12622, "CertificateUpdatedAuditEventType_EventType"},
+    {12623, "CertificateUpdatedAuditEventType_SourceNode"},
+    {12624, "CertificateUpdatedAuditEventType_SourceName"},
+    {12625, "CertificateUpdatedAuditEventType_Time"},
+    {12626, "CertificateUpdatedAuditEventType_ReceiveTime"},
+    {12627, "CertificateUpdatedAuditEventType_LocalTime"},
+    {12628, "CertificateUpdatedAuditEventType_Message"},
+    {12629, "CertificateUpdatedAuditEventType_Severity"},
+    {12630, "CertificateUpdatedAuditEventType_ActionTimeStamp"},
+    {12631, "CertificateUpdatedAuditEventType_Status"},
+    {12632, "CertificateUpdatedAuditEventType_ServerId"},
+    {12633, "CertificateUpdatedAuditEventType_ClientAuditEntryId"},
+    {12634, "CertificateUpdatedAuditEventType_ClientUserId"},
+    {12635, "CertificateUpdatedAuditEventType_MethodId"},
+    {12636, "CertificateUpdatedAuditEventType_InputArguments"},
+    {12637, "ServerConfiguration"},
+    {12639, "ServerConfiguration_SupportedPrivateKeyFormats"},
+    {12640, "ServerConfiguration_MaxTrustListSize"},
+    {12641, "ServerConfiguration_MulticastDnsEnabled"},
+    {12642, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList"},
+    {12643, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Size"},
+    {12646, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenCount"},
+    {12647, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open"},
+    {12648, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open_InputArguments"},
+    {12649, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Open_OutputArguments"},
+    {12650, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Close"},
+    {12651, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Close_InputArguments"},
+    {12652, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read"},
+    {12653, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read_InputArguments"},
+    {12654, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Read_OutputArguments"},
+    {12655, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Write"},
+    {12656, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Write_InputArguments"},
+    {12657, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition"},
+    {12658, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_InputArguments"},
+    {12659, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments"},
+    {12660, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition"},
+    {12661, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition_InputArguments"},
+    {12662, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_LastUpdateTime"},
+    {12663, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks"},
+    {12664, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments"},
+    {12665, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {12666, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate"},
+    {12667, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {12668, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate"},
+    {12669, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments"},
+    {12670, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate"},
+    {12671, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments"},
+    {12676, "TrustListDataType_Encoding_DefaultXml"},
+    {12677, "OpcUa_XmlSchema_TrustListDataType"},
+    {12678, "OpcUa_XmlSchema_TrustListDataType_DataTypeVersion"},
+    {12679, "OpcUa_XmlSchema_TrustListDataType_DictionaryFragment"},
+    {12680, "TrustListDataType_Encoding_DefaultBinary"},
+    {12681, "OpcUa_BinarySchema_TrustListDataType"},
+    {12682, "OpcUa_BinarySchema_TrustListDataType_DataTypeVersion"},
+    {12683, "OpcUa_BinarySchema_TrustListDataType_DictionaryFragment"},
+    {12684, "ServerType_Namespaces_AddressSpaceFile_Writable"},
+    {12685, "ServerType_Namespaces_AddressSpaceFile_UserWritable"},
+    {12686, "FileType_Writable"},
+    {12687, "FileType_UserWritable"},
+    {12688, "AddressSpaceFileType_Writable"},
+    {12689, "AddressSpaceFileType_UserWritable"},
+    {12690, "NamespaceMetadataType_NamespaceFile_Writable"},
+    {12691, "NamespaceMetadataType_NamespaceFile_UserWritable"},
+    {12692, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_Writable"},
+    {12693, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_UserWritable"},
+    {12694, "NamespacesType_AddressSpaceFile_Writable"},
+    {12695, "NamespacesType_AddressSpaceFile_UserWritable"},
+    {12696, "Server_Namespaces_AddressSpaceFile_Writable"},
+    {12697, "Server_Namespaces_AddressSpaceFile_UserWritable"},
+    {12698, "TrustListType_Writable"},
+    {12699, "TrustListType_UserWritable"},
+    {12704, "CloseAndUpdateMethodType_InputArguments"},
+    {12705, "TrustListType_CloseAndUpdate_InputArguments"},
+    {12708, "ServerConfigurationType_ServerCapabilities"},
+    {12710, "ServerConfiguration_ServerCapabilities"},
+    {12712, "OpcUa_XmlSchema_RelativePathElement"},
+    {12713, "OpcUa_XmlSchema_RelativePathElement_DataTypeVersion"},
+    {12714, "OpcUa_XmlSchema_RelativePathElement_DictionaryFragment"},
+    {12715, "OpcUa_XmlSchema_RelativePath"},
+    {12716, "OpcUa_XmlSchema_RelativePath_DataTypeVersion"},
+    {12717, "OpcUa_XmlSchema_RelativePath_DictionaryFragment"},
+    {12718, "OpcUa_BinarySchema_RelativePathElement"},
+    {12719, "OpcUa_BinarySchema_RelativePathElement_DataTypeVersion"},
+    {12720, "OpcUa_BinarySchema_RelativePathElement_DictionaryFragment"},
+    {12721, "OpcUa_BinarySchema_RelativePath"},
+    {12722, "OpcUa_BinarySchema_RelativePath_DataTypeVersion"},
+    {12723, "OpcUa_BinarySchema_RelativePath_DictionaryFragment"},
+    {12731, "ServerConfigurationType_CreateSigningRequest"},
+    {12732, "ServerConfigurationType_CreateSigningRequest_InputArguments"},
+    {12733, "ServerConfigurationType_CreateSigningRequest_OutputArguments"},
+    {12734, "ServerConfigurationType_ApplyChanges"},
+    {12737, "ServerConfiguration_CreateSigningRequest"},
+    {12738, "ServerConfiguration_CreateSigningRequest_InputArguments"},
+    {12739, "ServerConfiguration_CreateSigningRequest_OutputArguments"},
+    {12740, "ServerConfiguration_ApplyChanges"},
+    {12741, "CreateSigningRequestMethodType"},
+    {12742, "CreateSigningRequestMethodType_InputArguments"},
+    {12743, "CreateSigningRequestMethodType_OutputArguments"},
+    {12745, "OptionSetValues"},
+    {12746, "ServerType_SetSubscriptionDurable"},
+    {12747, "ServerType_SetSubscriptionDurable_InputArguments"},
+    {12748, "ServerType_SetSubscriptionDurable_OutputArguments"},
+    {12749, "Server_SetSubscriptionDurable"},
+    {12750, "Server_SetSubscriptionDurable_InputArguments"},
+    {12751, "Server_SetSubscriptionDurable_OutputArguments"},
+    {12752, "SetSubscriptionDurableMethodType"},
+    {12753, "SetSubscriptionDurableMethodType_InputArguments"},
+    {12754, "SetSubscriptionDurableMethodType_OutputArguments"},
+    {12755, "OptionSet"},
+    {12756, "Union"},
+    {12757, "OptionSet_Encoding_DefaultXml"},
+    {12758, "Union_Encoding_DefaultXml"},
+    {12759, "OpcUa_XmlSchema_OptionSet"},
+    {12760, "OpcUa_XmlSchema_OptionSet_DataTypeVersion"},
+    {12761, "OpcUa_XmlSchema_OptionSet_DictionaryFragment"},
+    {12762, "OpcUa_XmlSchema_Union"},
+    {12763, "OpcUa_XmlSchema_Union_DataTypeVersion"},
+    {12764, "OpcUa_XmlSchema_Union_DictionaryFragment"},
+    {12765, "OptionSet_Encoding_DefaultBinary"},
+    {12766, "Union_Encoding_DefaultBinary"},
+    {12767, "OpcUa_BinarySchema_OptionSet"},
+    {12768, "OpcUa_BinarySchema_OptionSet_DataTypeVersion"},
+    {12769, "OpcUa_BinarySchema_OptionSet_DictionaryFragment"},
+    {12770, "OpcUa_BinarySchema_Union"},
+    {12771, "OpcUa_BinarySchema_Union_DataTypeVersion"},
+    {12772, "OpcUa_BinarySchema_Union_DictionaryFragment"},
+    {12773, "GetRejectedListMethodType"},
+    {12774, "GetRejectedListMethodType_OutputArguments"},
+    {12775, "ServerConfigurationType_GetRejectedList"},
+    {12776, "ServerConfigurationType_GetRejectedList_OutputArguments"},
+    {12777, "ServerConfiguration_GetRejectedList"},
+    {12778, "ServerConfiguration_GetRejectedList_OutputArguments"},
+    {12779, "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics"},
+    {12780, "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_SamplingInterval"},
+    {12781, "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_SampledMonitoredItemsCount"},
+    {12782, "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_MaxSampledMonitoredItemsCount"},
+    {12783, "SamplingIntervalDiagnosticsArrayType_SamplingIntervalDiagnostics_DisabledMonitoredItemsSamplingCount"},
+    {12784, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics"},
+    {12785, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_SessionId"},
+    {12786, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_SubscriptionId"},
+    {12787, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_Priority"},
+    {12788, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishingInterval"},
+    {12789, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxKeepAliveCount"},
+    {12790, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxLifetimeCount"},
+    {12791, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MaxNotificationsPerPublish"},
+    {12792, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishingEnabled"},
+    {12793, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_ModifyCount"},
+    {12794, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EnableCount"},
+    {12795, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DisableCount"},
+    {12796, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishRequestCount"},
+    {12797, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishMessageRequestCount"},
+    {12798, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_RepublishMessageCount"},
+    {12799, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferRequestCount"},
+    {12800, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferredToAltClientCount"},
+    {12801, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_TransferredToSameClientCount"},
+    {12802, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_PublishRequestCount"},
+    {12803, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DataChangeNotificationsCount"},
+    {12804, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EventNotificationsCount"},
+    {12805, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_NotificationsCount"},
+    {12806, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_LatePublishRequestCount"},
+    {12807, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_CurrentKeepAliveCount"},
+    {12808, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_CurrentLifetimeCount"},
+    {12809, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_UnacknowledgedMessageCount"},
+    {12810, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DiscardedMessageCount"},
+    {12811, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MonitoredItemCount"},
+    {12812, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_DisabledMonitoredItemCount"},
+    {12813, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_MonitoringQueueOverflowCount"},
+    {12814, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_NextSequenceNumber"},
+    {12815, "SubscriptionDiagnosticsArrayType_SubscriptionDiagnostics_EventQueueOverFlowCount"},
+    {12816, "SessionDiagnosticsArrayType_SessionDiagnostics"},
+    {12817, "SessionDiagnosticsArrayType_SessionDiagnostics_SessionId"},
+    {12818, "SessionDiagnosticsArrayType_SessionDiagnostics_SessionName"},
+    {12819, "SessionDiagnosticsArrayType_SessionDiagnostics_ClientDescription"},
+    {12820, "SessionDiagnosticsArrayType_SessionDiagnostics_ServerUri"},
+    {12821, "SessionDiagnosticsArrayType_SessionDiagnostics_EndpointUrl"},
+    {12822, "SessionDiagnosticsArrayType_SessionDiagnostics_LocaleIds"},
+    {12823, "SessionDiagnosticsArrayType_SessionDiagnostics_ActualSessionTimeout"},
+    {12824, "SessionDiagnosticsArrayType_SessionDiagnostics_MaxResponseMessageSize"},
+    {12825, "SessionDiagnosticsArrayType_SessionDiagnostics_ClientConnectionTime"},
+    {12826, "SessionDiagnosticsArrayType_SessionDiagnostics_ClientLastContactTime"},
+    {12827, "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentSubscriptionsCount"},
+    {12828, "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentMonitoredItemsCount"},
+    {12829, "SessionDiagnosticsArrayType_SessionDiagnostics_CurrentPublishRequestsInQueue"},
+    {12830, "SessionDiagnosticsArrayType_SessionDiagnostics_TotalRequestCount"},
+    {12831, "SessionDiagnosticsArrayType_SessionDiagnostics_UnauthorizedRequestCount"},
+    {12832, "SessionDiagnosticsArrayType_SessionDiagnostics_ReadCount"},
+    {12833, "SessionDiagnosticsArrayType_SessionDiagnostics_HistoryReadCount"},
+    {12834, "SessionDiagnosticsArrayType_SessionDiagnostics_WriteCount"},
+    {12835, "SessionDiagnosticsArrayType_SessionDiagnostics_HistoryUpdateCount"},
+    {12836, "SessionDiagnosticsArrayType_SessionDiagnostics_CallCount"},
+    {12837, "SessionDiagnosticsArrayType_SessionDiagnostics_CreateMonitoredItemsCount"},
+    {12838, "SessionDiagnosticsArrayType_SessionDiagnostics_ModifyMonitoredItemsCount"},
+    {12839, "SessionDiagnosticsArrayType_SessionDiagnostics_SetMonitoringModeCount"},
+    {12840, "SessionDiagnosticsArrayType_SessionDiagnostics_SetTriggeringCount"},
+    {12841, "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteMonitoredItemsCount"},
+    {12842, "SessionDiagnosticsArrayType_SessionDiagnostics_CreateSubscriptionCount"},
+    {12843, "SessionDiagnosticsArrayType_SessionDiagnostics_ModifySubscriptionCount"},
+    {12844, "SessionDiagnosticsArrayType_SessionDiagnostics_SetPublishingModeCount"},
+    {12845, "SessionDiagnosticsArrayType_SessionDiagnostics_PublishCount"},
+    {12846, "SessionDiagnosticsArrayType_SessionDiagnostics_RepublishCount"},
+    {12847, "SessionDiagnosticsArrayType_SessionDiagnostics_TransferSubscriptionsCount"},
+    {12848, "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteSubscriptionsCount"},
+    {12849, "SessionDiagnosticsArrayType_SessionDiagnostics_AddNodesCount"},
+    {12850, "SessionDiagnosticsArrayType_SessionDiagnostics_AddReferencesCount"},
+    {12851, "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteNodesCount"},
+    {12852, "SessionDiagnosticsArrayType_SessionDiagnostics_DeleteReferencesCount"},
+    {12853, "SessionDiagnosticsArrayType_SessionDiagnostics_BrowseCount"},
+    {12854, "SessionDiagnosticsArrayType_SessionDiagnostics_BrowseNextCount"},
+    {12855, "SessionDiagnosticsArrayType_SessionDiagnostics_TranslateBrowsePathsToNodeIdsCount"},
+    {12856, "SessionDiagnosticsArrayType_SessionDiagnostics_QueryFirstCount"},
+    {12857, "SessionDiagnosticsArrayType_SessionDiagnostics_QueryNextCount"},
+    {12858, "SessionDiagnosticsArrayType_SessionDiagnostics_RegisterNodesCount"},
+    {12859, "SessionDiagnosticsArrayType_SessionDiagnostics_UnregisterNodesCount"},
+    {12860, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics"},
+    {12861, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SessionId"},
+    {12862, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientUserIdOfSession"},
+    {12863, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientUserIdHistory"},
+    {12864, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_AuthenticationMechanism"},
+    {12865, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_Encoding"},
+    {12866, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_TransportProtocol"},
+    {12867, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SecurityMode"},
+    {12868, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_SecurityPolicyUri"},
+    {12869, "SessionSecurityDiagnosticsArrayType_SessionSecurityDiagnostics_ClientCertificate"},
+    {12871, "ServerType_ResendData"},
+    {12872, "ServerType_ResendData_InputArguments"},
+    {12873, "Server_ResendData"},
+    {12874, "Server_ResendData_InputArguments"},
+    {12875, "ResendDataMethodType"},
+    {12876, "ResendDataMethodType_InputArguments"},
+    {12877, "NormalizedString"},
+    {12878, "DecimalString"},
+    {12879, "DurationString"},
+    {12880, "TimeString"},
+    {12881, "DateString"},
+    {12882, "ServerType_EstimatedReturnTime"},
+    {12883, "ServerType_RequestServerStateChange"},
+    {12884, "ServerType_RequestServerStateChange_InputArguments"},
+    {12885, "Server_EstimatedReturnTime"},
+    {12886, "Server_RequestServerStateChange"},
+    {12887, "Server_RequestServerStateChange_InputArguments"},
+    {12888, "RequestServerStateChangeMethodType"},
+    {12889, "RequestServerStateChangeMethodType_InputArguments"},
+    {12890, "DiscoveryConfiguration"},
+    {12891, "MdnsDiscoveryConfiguration"},
+    {12892, "DiscoveryConfiguration_Encoding_DefaultXml"},
+    {12893, "MdnsDiscoveryConfiguration_Encoding_DefaultXml"},
+    {12894, "OpcUa_XmlSchema_DiscoveryConfiguration"},
+    {12895, "OpcUa_XmlSchema_DiscoveryConfiguration_DataTypeVersion"},
+    {12896, "OpcUa_XmlSchema_DiscoveryConfiguration_DictionaryFragment"},
+    {12897, "OpcUa_XmlSchema_MdnsDiscoveryConfiguration"},
+    {12898, "OpcUa_XmlSchema_MdnsDiscoveryConfiguration_DataTypeVersion"},
+    {12899, "OpcUa_XmlSchema_MdnsDiscoveryConfiguration_DictionaryFragment"},
+    {12900, "DiscoveryConfiguration_Encoding_DefaultBinary"},
+    {12901, "MdnsDiscoveryConfiguration_Encoding_DefaultBinary"},
+    {12902, "OpcUa_BinarySchema_DiscoveryConfiguration"},
+    {12903, "OpcUa_BinarySchema_DiscoveryConfiguration_DataTypeVersion"},
+    {12904, "OpcUa_BinarySchema_DiscoveryConfiguration_DictionaryFragment"},
+    {12905, "OpcUa_BinarySchema_MdnsDiscoveryConfiguration"},
+    {12906, "OpcUa_BinarySchema_MdnsDiscoveryConfiguration_DataTypeVersion"},
+    {12907, "OpcUa_BinarySchema_MdnsDiscoveryConfiguration_DictionaryFragment"},
+    {12908, "MaxByteStringLength"},
+    {12909, "ServerType_ServerCapabilities_MaxByteStringLength"},
+    {12910, "ServerCapabilitiesType_MaxByteStringLength"},
+    {12911, "Server_ServerCapabilities_MaxByteStringLength"},
+    {12912, "ConditionType_ConditionRefresh2"},
+    {12913, "ConditionType_ConditionRefresh2_InputArguments"},
+    {12914, "ConditionRefresh2MethodType"},
+    {12915, "ConditionRefresh2MethodType_InputArguments"},
+    {12916, "DialogConditionType_ConditionRefresh2"},
+    {12917, "DialogConditionType_ConditionRefresh2_InputArguments"},
+    {12918, "AcknowledgeableConditionType_ConditionRefresh2"},
+    {12919, "AcknowledgeableConditionType_ConditionRefresh2_InputArguments"},
+    {12984, "AlarmConditionType_ConditionRefresh2"},
+    {12985, "AlarmConditionType_ConditionRefresh2_InputArguments"},
+    {12986, "LimitAlarmType_ConditionRefresh2"},
+    {12987, "LimitAlarmType_ConditionRefresh2_InputArguments"},
+    {12988, "ExclusiveLimitAlarmType_ConditionRefresh2"},
+    {12989, "ExclusiveLimitAlarmType_ConditionRefresh2_InputArguments"},
+    {12990, "NonExclusiveLimitAlarmType_ConditionRefresh2"},
+    {12991, "NonExclusiveLimitAlarmType_ConditionRefresh2_InputArguments"},
+    {12992, "NonExclusiveLevelAlarmType_ConditionRefresh2"},
+    {12993, "NonExclusiveLevelAlarmType_ConditionRefresh2_InputArguments"},
+    {12994, "ExclusiveLevelAlarmType_ConditionRefresh2"},
+    {12995, "ExclusiveLevelAlarmType_ConditionRefresh2_InputArguments"},
+    {12996, "NonExclusiveDeviationAlarmType_ConditionRefresh2"},
+    {12997, "NonExclusiveDeviationAlarmType_ConditionRefresh2_InputArguments"},
+    {12998, "ExclusiveDeviationAlarmType_ConditionRefresh2"},
+    {12999, "ExclusiveDeviationAlarmType_ConditionRefresh2_InputArguments"},
+    {13000, "NonExclusiveRateOfChangeAlarmType_ConditionRefresh2"},
+    {13001, "NonExclusiveRateOfChangeAlarmType_ConditionRefresh2_InputArguments"},
+    {13002, "ExclusiveRateOfChangeAlarmType_ConditionRefresh2"},
+    {13003, "ExclusiveRateOfChangeAlarmType_ConditionRefresh2_InputArguments"},
+    {13004, "DiscreteAlarmType_ConditionRefresh2"},
+    {13005, "DiscreteAlarmType_ConditionRefresh2_InputArguments"},
+    {13006, "OffNormalAlarmType_ConditionRefresh2"},
+    {13007, "OffNormalAlarmType_ConditionRefresh2_InputArguments"},
+    {13008, "SystemOffNormalAlarmType_ConditionRefresh2"},
+    {13009, "SystemOffNormalAlarmType_ConditionRefresh2_InputArguments"},
+    {13010, "TripAlarmType_ConditionRefresh2"},
+    {13011, "TripAlarmType_ConditionRefresh2_InputArguments"},
+    {13225, "CertificateExpirationAlarmType"},
+    {13226, "CertificateExpirationAlarmType_EventId"},
+    {13227, "CertificateExpirationAlarmType_EventType"},
+    {13228, "CertificateExpirationAlarmType_SourceNode"},
+    {13229, "CertificateExpirationAlarmType_SourceName"},
+    {13230, "CertificateExpirationAlarmType_Time"},
+    {13231, "CertificateExpirationAlarmType_ReceiveTime"},
+    {13232, "CertificateExpirationAlarmType_LocalTime"},
+    {13233, "CertificateExpirationAlarmType_Message"},
+    {13234, "CertificateExpirationAlarmType_Severity"},
+    {13235, "CertificateExpirationAlarmType_ConditionClassId"},
+    {13236, "CertificateExpirationAlarmType_ConditionClassName"},
+    {13237, "CertificateExpirationAlarmType_ConditionName"},
+    {13238, "CertificateExpirationAlarmType_BranchId"},
+    {13239, "CertificateExpirationAlarmType_Retain"},
+    {13240, "CertificateExpirationAlarmType_EnabledState"},
+    {13241, "CertificateExpirationAlarmType_EnabledState_Id"},
+    {13242, "CertificateExpirationAlarmType_EnabledState_Name"},
+    {13243, "CertificateExpirationAlarmType_EnabledState_Number"},
+    {13244, "CertificateExpirationAlarmType_EnabledState_EffectiveDisplayName"},
+    {13245, "CertificateExpirationAlarmType_EnabledState_TransitionTime"},
+    {13246, "CertificateExpirationAlarmType_EnabledState_EffectiveTransitionTime"},
+    {13247, "CertificateExpirationAlarmType_EnabledState_TrueState"},
+    {13248, "CertificateExpirationAlarmType_EnabledState_FalseState"},
+    {13249, "CertificateExpirationAlarmType_Quality"},
+    {13250, "CertificateExpirationAlarmType_Quality_SourceTimestamp"},
+    {13251, "CertificateExpirationAlarmType_LastSeverity"},
+    {13252, "CertificateExpirationAlarmType_LastSeverity_SourceTimestamp"},
+    {13253, "CertificateExpirationAlarmType_Comment"},
+    {13254, "CertificateExpirationAlarmType_Comment_SourceTimestamp"},
+    {13255, "CertificateExpirationAlarmType_ClientUserId"},
+    {13256, "CertificateExpirationAlarmType_Disable"},
+    {13257, "CertificateExpirationAlarmType_Enable"},
+    {13258, "CertificateExpirationAlarmType_AddComment"},
+    {13259, "CertificateExpirationAlarmType_AddComment_InputArguments"},
+    {13260, "CertificateExpirationAlarmType_ConditionRefresh"},
+    {13261, "CertificateExpirationAlarmType_ConditionRefresh_InputArguments"},
+    {13262, "CertificateExpirationAlarmType_ConditionRefresh2"},
+    {13263, "CertificateExpirationAlarmType_ConditionRefresh2_InputArguments"},
+    {13264, "CertificateExpirationAlarmType_AckedState"},
+    {13265, "CertificateExpirationAlarmType_AckedState_Id"},
+    {13266, "CertificateExpirationAlarmType_AckedState_Name"},
+    {13267, "CertificateExpirationAlarmType_AckedState_Number"},
+    {13268, "CertificateExpirationAlarmType_AckedState_EffectiveDisplayName"},
+    {13269, "CertificateExpirationAlarmType_AckedState_TransitionTime"},
+    {13270, "CertificateExpirationAlarmType_AckedState_EffectiveTransitionTime"},
+    {13271, "CertificateExpirationAlarmType_AckedState_TrueState"},
+    {13272, "CertificateExpirationAlarmType_AckedState_FalseState"},
+    {13273, "CertificateExpirationAlarmType_ConfirmedState"},
+    {13274, "CertificateExpirationAlarmType_ConfirmedState_Id"},
+    {13275, "CertificateExpirationAlarmType_ConfirmedState_Name"},
+    {13276, "CertificateExpirationAlarmType_ConfirmedState_Number"},
+    {13277, "CertificateExpirationAlarmType_ConfirmedState_EffectiveDisplayName"},
+    {13278, "CertificateExpirationAlarmType_ConfirmedState_TransitionTime"},
+    {13279, "CertificateExpirationAlarmType_ConfirmedState_EffectiveTransitionTime"},
+    {13280, "CertificateExpirationAlarmType_ConfirmedState_TrueState"},
+    {13281, "CertificateExpirationAlarmType_ConfirmedState_FalseState"},
+    {13282, "CertificateExpirationAlarmType_Acknowledge"},
+    {13283, "CertificateExpirationAlarmType_Acknowledge_InputArguments"},
+    {13284, "CertificateExpirationAlarmType_Confirm"},
+    {13285, "CertificateExpirationAlarmType_Confirm_InputArguments"},
+    {13286, "CertificateExpirationAlarmType_ActiveState"},
+    {13287, "CertificateExpirationAlarmType_ActiveState_Id"},
+    {13288, "CertificateExpirationAlarmType_ActiveState_Name"},
+    {13289, "CertificateExpirationAlarmType_ActiveState_Number"},
+    {13290, "CertificateExpirationAlarmType_ActiveState_EffectiveDisplayName"},
+    {13291, "CertificateExpirationAlarmType_ActiveState_TransitionTime"},
+    {13292, "CertificateExpirationAlarmType_ActiveState_EffectiveTransitionTime"},
+    {13293, "CertificateExpirationAlarmType_ActiveState_TrueState"},
+    {13294, "CertificateExpirationAlarmType_ActiveState_FalseState"},
+    {13295, "CertificateExpirationAlarmType_InputNode"},
+    {13296, "CertificateExpirationAlarmType_SuppressedState"},
+    {13297, "CertificateExpirationAlarmType_SuppressedState_Id"},
+    {13298, "CertificateExpirationAlarmType_SuppressedState_Name"},
+    {13299, "CertificateExpirationAlarmType_SuppressedState_Number"},
+    {13300, "CertificateExpirationAlarmType_SuppressedState_EffectiveDisplayName"},
+    {13301, "CertificateExpirationAlarmType_SuppressedState_TransitionTime"},
+    {13302, "CertificateExpirationAlarmType_SuppressedState_EffectiveTransitionTime"},
+    {13303, "CertificateExpirationAlarmType_SuppressedState_TrueState"},
+    {13304, "CertificateExpirationAlarmType_SuppressedState_FalseState"},
+    {13305, "CertificateExpirationAlarmType_ShelvingState"},
+    {13306, "CertificateExpirationAlarmType_ShelvingState_CurrentState"},
+    {13307, "CertificateExpirationAlarmType_ShelvingState_CurrentState_Id"},
+    {13308, "CertificateExpirationAlarmType_ShelvingState_CurrentState_Name"},
+    {13309, "CertificateExpirationAlarmType_ShelvingState_CurrentState_Number"},
+    {13310, "CertificateExpirationAlarmType_ShelvingState_CurrentState_EffectiveDisplayName"},
+    {13311, "CertificateExpirationAlarmType_ShelvingState_LastTransition"},
+    {13312, "CertificateExpirationAlarmType_ShelvingState_LastTransition_Id"},
+    {13313, "CertificateExpirationAlarmType_ShelvingState_LastTransition_Name"},
+    {13314, "CertificateExpirationAlarmType_ShelvingState_LastTransition_Number"},
+    {13315, "CertificateExpirationAlarmType_ShelvingState_LastTransition_TransitionTime"},
+    {13316, "CertificateExpirationAlarmType_ShelvingState_LastTransition_EffectiveTransitionTime"},
+    {13317, "CertificateExpirationAlarmType_ShelvingState_UnshelveTime"},
+    {13318, "CertificateExpirationAlarmType_ShelvingState_Unshelve"},
+    {13319, "CertificateExpirationAlarmType_ShelvingState_OneShotShelve"},
+    {13320, "CertificateExpirationAlarmType_ShelvingState_TimedShelve"},
+    {13321, "CertificateExpirationAlarmType_ShelvingState_TimedShelve_InputArguments"},
+    {13322, "CertificateExpirationAlarmType_SuppressedOrShelved"},
+    {13323, "CertificateExpirationAlarmType_MaxTimeShelved"},
+    {13324, "CertificateExpirationAlarmType_NormalState"},
+    {13325, "CertificateExpirationAlarmType_ExpirationDate"},
+    {13326, "CertificateExpirationAlarmType_CertificateType"},
+    {13327, "CertificateExpirationAlarmType_Certificate"},
+    {13340, "ServerType_Namespaces_AddressSpaceFile_MimeType"},
+    {13341, "FileType_MimeType"},
+    {13342, "CreateDirectoryMethodType"},
+    {13343, "CreateDirectoryMethodType_InputArguments"},
+    {13344, "CreateDirectoryMethodType_OutputArguments"},
+    {13345, "CreateFileMethodType"},
+    {13346, "CreateFileMethodType_InputArguments"},
+    {13347, "CreateFileMethodType_OutputArguments"},
+    {13348, "DeleteFileMethodType"},
+    {13349, "DeleteFileMethodType_InputArguments"},
+    {13350, "MoveOrCopyMethodType"},
+    {13351, "MoveOrCopyMethodType_InputArguments"},
+    {13352, "MoveOrCopyMethodType_OutputArguments"},
+    {13353, "FileDirectoryType"},
+    {13354, "FileDirectoryType_FileDirectoryName_Placeholder"},
+    {13355, "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory"},
+    {13356, "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory_InputArguments"},
+    {13357, "FileDirectoryType_FileDirectoryName_Placeholder_CreateDirectory_OutputArguments"},
+    {13358, "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile"},
+    {13359, "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile_InputArguments"},
+    {13360, "FileDirectoryType_FileDirectoryName_Placeholder_CreateFile_OutputArguments"},
+    {13361, "FileDirectoryType_FileDirectoryName_Placeholder_Delete"},
+    {13362, "FileDirectoryType_FileDirectoryName_Placeholder_Delete_InputArguments"},
+    {13363, "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy"},
+    {13364, "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy_InputArguments"},
+    {13365, "FileDirectoryType_FileDirectoryName_Placeholder_MoveOrCopy_OutputArguments"},
+    {13366, "FileDirectoryType_FileName_Placeholder"},
+    {13367, "FileDirectoryType_FileName_Placeholder_Size"},
+    {13368, "FileDirectoryType_FileName_Placeholder_Writable"},
+    {13369, "FileDirectoryType_FileName_Placeholder_UserWritable"},
+    {13370, "FileDirectoryType_FileName_Placeholder_OpenCount"},
+    {13371, "FileDirectoryType_FileName_Placeholder_MimeType"},
+    {13372, "FileDirectoryType_FileName_Placeholder_Open"},
+    {13373, "FileDirectoryType_FileName_Placeholder_Open_InputArguments"},
+    {13374, "FileDirectoryType_FileName_Placeholder_Open_OutputArguments"},
+    {13375, "FileDirectoryType_FileName_Placeholder_Close"},
+    {13376, "FileDirectoryType_FileName_Placeholder_Close_InputArguments"},
+    {13377, "FileDirectoryType_FileName_Placeholder_Read"},
+    {13378, "FileDirectoryType_FileName_Placeholder_Read_InputArguments"},
+    {13379, "FileDirectoryType_FileName_Placeholder_Read_OutputArguments"},
+    {13380, "FileDirectoryType_FileName_Placeholder_Write"},
+    {13381, "FileDirectoryType_FileName_Placeholder_Write_InputArguments"},
+    {13382, "FileDirectoryType_FileName_Placeholder_GetPosition"},
+    {13383, "FileDirectoryType_FileName_Placeholder_GetPosition_InputArguments"},
+    {13384, "FileDirectoryType_FileName_Placeholder_GetPosition_OutputArguments"},
+    {13385, "FileDirectoryType_FileName_Placeholder_SetPosition"},
+    {13386, "FileDirectoryType_FileName_Placeholder_SetPosition_InputArguments"},
+    {13387, "FileDirectoryType_CreateDirectory"},
+    {13388, "FileDirectoryType_CreateDirectory_InputArguments"},
+    {13389, "FileDirectoryType_CreateDirectory_OutputArguments"},
+    {13390, "FileDirectoryType_CreateFile"},
+    {13391, "FileDirectoryType_CreateFile_InputArguments"},
+    {13392, "FileDirectoryType_CreateFile_OutputArguments"},
+    {13393, "FileDirectoryType_Delete"},
+    {13394, "FileDirectoryType_Delete_InputArguments"},
+    {13395, "FileDirectoryType_MoveOrCopy"},
+    {13396, "FileDirectoryType_MoveOrCopy_InputArguments"},
+    {13397, "FileDirectoryType_MoveOrCopy_OutputArguments"},
+    {13398, "AddressSpaceFileType_MimeType"},
+    {13399, "NamespaceMetadataType_NamespaceFile_MimeType"},
+    {13400, "NamespacesType_NamespaceIdentifier_Placeholder_NamespaceFile_MimeType"},
+    {13401, "NamespacesType_AddressSpaceFile_MimeType"},
+    {13402, "Server_Namespaces_AddressSpaceFile_MimeType"},
+    {13403, "TrustListType_MimeType"},
+    {13599, "CertificateGroupType_TrustList"},
+    {13600, "CertificateGroupType_TrustList_Size"},
+    {13601, "CertificateGroupType_TrustList_Writable"},
+    {13602, "CertificateGroupType_TrustList_UserWritable"},
+    {13603, "CertificateGroupType_TrustList_OpenCount"},
+    {13604, "CertificateGroupType_TrustList_MimeType"},
+    {13605, "CertificateGroupType_TrustList_Open"},
+    {13606, "CertificateGroupType_TrustList_Open_InputArguments"},
+    {13607, "CertificateGroupType_TrustList_Open_OutputArguments"},
+    {13608, "CertificateGroupType_TrustList_Close"},
+    {13609, "CertificateGroupType_TrustList_Close_InputArguments"},
+    {13610, "CertificateGroupType_TrustList_Read"},
+    {13611, "CertificateGroupType_TrustList_Read_InputArguments"},
+    {13612, "CertificateGroupType_TrustList_Read_OutputArguments"},
+    {13613, "CertificateGroupType_TrustList_Write"},
+    {13614, "CertificateGroupType_TrustList_Write_InputArguments"},
+    {13615, "CertificateGroupType_TrustList_GetPosition"},
+    {13616, "CertificateGroupType_TrustList_GetPosition_InputArguments"},
+    {13617, "CertificateGroupType_TrustList_GetPosition_OutputArguments"},
+    {13618, "CertificateGroupType_TrustList_SetPosition"},
+    {13619, "CertificateGroupType_TrustList_SetPosition_InputArguments"},
+    {13620, "CertificateGroupType_TrustList_LastUpdateTime"},
+    {13621, "CertificateGroupType_TrustList_OpenWithMasks"},
+    {13622, "CertificateGroupType_TrustList_OpenWithMasks_InputArguments"},
+    {13623, "CertificateGroupType_TrustList_OpenWithMasks_OutputArguments"},
+    {13624, "CertificateGroupType_TrustList_CloseAndUpdate"},
+    {13625, "CertificateGroupType_TrustList_CloseAndUpdate_InputArguments"},
+    {13626, "CertificateGroupType_TrustList_CloseAndUpdate_OutputArguments"},
+    {13627, "CertificateGroupType_TrustList_AddCertificate"},
+    {13628, "CertificateGroupType_TrustList_AddCertificate_InputArguments"},
+    {13629, "CertificateGroupType_TrustList_RemoveCertificate"},
+    {13630, "CertificateGroupType_TrustList_RemoveCertificate_InputArguments"},
+    {13631, "CertificateGroupType_CertificateTypes"},
+    {13735, "CertificateUpdatedAuditEventType_CertificateGroup"},
+    {13736, "CertificateUpdatedAuditEventType_CertificateType"},
+    {13737, "ServerConfiguration_UpdateCertificate"},
+    {13738, "ServerConfiguration_UpdateCertificate_InputArguments"},
+    {13739, "ServerConfiguration_UpdateCertificate_OutputArguments"},
+    {13813, "CertificateGroupFolderType"},
+    {13814, "CertificateGroupFolderType_DefaultApplicationGroup"},
+    {13815, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList"},
+    {13816, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Size"},
+    {13817, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Writable"},
+    {13818, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_UserWritable"},
+    {13819, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenCount"},
+    {13820, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_MimeType"},
+    {13821, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open"},
+    {13822, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open_InputArguments"},
+    {13823, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Open_OutputArguments"},
+    {13824, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Close"},
+    {13825, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Close_InputArguments"},
+    {13826, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read"},
+    {13827, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read_InputArguments"},
+    {13828, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Read_OutputArguments"},
+    {13829, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Write"},
+    {13830, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_Write_InputArguments"},
+    {13831, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition"},
+    {13832, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition_InputArguments"},
+    {13833, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments"},
+    {13834, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_SetPosition"},
+    {13835, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_SetPosition_InputArguments"},
+    {13836, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_LastUpdateTime"},
+    {13837, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks"},
+    {13838, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments"},
+    {13839, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {13840, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate"},
+    {13841, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {13842, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {13843, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_AddCertificate"},
+    {13844, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments"},
+    {13845, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_RemoveCertificate"},
+    {13846, "CertificateGroupFolderType_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments"},
+    {13847, "CertificateGroupFolderType_DefaultApplicationGroup_CertificateTypes"},
+    {13848, "CertificateGroupFolderType_DefaultHttpsGroup"},
+    {13849, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList"},
+    {13850, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Size"},
+    {13851, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Writable"},
+    {13852, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_UserWritable"},
+    {13853, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenCount"},
+    {13854, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_MimeType"},
+    {13855, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open"},
+    {13856, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open_InputArguments"},
+    {13857, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Open_OutputArguments"},
+    {13858, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Close"},
+    {13859, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Close_InputArguments"},
+    {13860, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read"},
+    {13861, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read_InputArguments"},
+    {13862, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Read_OutputArguments"},
+    {13863, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Write"},
+    {13864, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_Write_InputArguments"},
+    {13865, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition"},
+    {13866, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition_InputArguments"},
+    {13867, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments"},
+    {13868, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_SetPosition"},
+    {13869, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_SetPosition_InputArguments"},
+    {13870, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_LastUpdateTime"},
+    {13871, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks"},
+    {13872, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments"},
+    {13873, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {13874, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate"},
+    {13875, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {13876, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {13877, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_AddCertificate"},
+    {13878, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments"},
+    {13879, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_RemoveCertificate"},
+    {13880, "CertificateGroupFolderType_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments"},
+    {13881, "CertificateGroupFolderType_DefaultHttpsGroup_CertificateTypes"},
+    {13882, "CertificateGroupFolderType_DefaultUserTokenGroup"},
+    {13883, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList"},
+    {13884, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Size"},
+    {13885, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Writable"},
+    {13886, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_UserWritable"},
+    {13887, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenCount"},
+    {13888, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_MimeType"},
+    {13889, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open"},
+    {13890, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open_InputArguments"},
+    {13891, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Open_OutputArguments"},
+    {13892, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Close"},
+    {13893, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Close_InputArguments"},
+    {13894, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read"},
+    {13895, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read_InputArguments"},
+    {13896, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Read_OutputArguments"},
+    {13897, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Write"},
+    {13898, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_Write_InputArguments"},
+    {13899, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition"},
+    {13900, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments"},
+    {13901, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments"},
+    {13902, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_SetPosition"},
+    {13903, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments"},
+    {13904, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_LastUpdateTime"},
+    {13905, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks"},
+    {13906, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments"},
+    {13907, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {13908, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate"},
+    {13909, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {13910, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {13911, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_AddCertificate"},
+    {13912, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments"},
+    {13913, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_RemoveCertificate"},
+    {13914, "CertificateGroupFolderType_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments"},
+    {13915, "CertificateGroupFolderType_DefaultUserTokenGroup_CertificateTypes"},
+    {13916, "CertificateGroupFolderType_AdditionalGroup_Placeholder"},
+    {13917, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList"},
+    {13918, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Size"},
+    {13919, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Writable"},
+    {13920, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_UserWritable"},
+    {13921, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenCount"},
+    {13922, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_MimeType"},
+    {13923, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open"},
+    {13924, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open_InputArguments"},
+    {13925, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Open_OutputArguments"},
+    {13926, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Close"},
+    {13927, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Close_InputArguments"},
+    {13928, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read"},
+    {13929, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read_InputArguments"},
+    {13930, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Read_OutputArguments"},
+    {13931, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Write"},
+    {13932, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_Write_InputArguments"},
+    {13933, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition"},
+    {13934, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition_InputArguments"},
+    {13935, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_GetPosition_OutputArguments"},
+    {13936, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_SetPosition"},
+    {13937, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_SetPosition_InputArguments"},
+    {13938, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_LastUpdateTime"},
+    {13939, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks"},
+    {13940, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks_InputArguments"},
+    {13941, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_OpenWithMasks_OutputArguments"},
+    {13942, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate"},
+    {13943, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate_InputArguments"},
+    {13944, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_CloseAndUpdate_OutputArguments"},
+    {13945, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_AddCertificate"},
+    {13946, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_AddCertificate_InputArguments"},
+    {13947, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_RemoveCertificate"},
+    {13948, "CertificateGroupFolderType_AdditionalGroup_Placeholder_TrustList_RemoveCertificate_InputArguments"},
+    {13949, "CertificateGroupFolderType_AdditionalGroup_Placeholder_CertificateTypes"},
+    {13950, "ServerConfigurationType_CertificateGroups"},
+    {13951, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup"},
+    {13952, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList"},
+    {13953, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Size"},
+    {13954, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Writable"},
+    {13955, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_UserWritable"},
+    {13956, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenCount"},
+    {13957, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_MimeType"},
+    {13958, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open"},
+    {13959, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open_InputArguments"},
+    {13960, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Open_OutputArguments"},
+    {13961, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Close"},
+    {13962, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Close_InputArguments"},
+    {13963, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read"},
+    {13964, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read_InputArguments"},
+    {13965, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Read_OutputArguments"},
+    {13966, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Write"},
+    {13967, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_Write_InputArguments"},
+    {13968, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition"},
+    {13969, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_InputArguments"},
+    {13970, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_GetPosition_OutputArguments"},
+    {13971, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition"},
+    {13972, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_SetPosition_InputArguments"},
+    {13973, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_LastUpdateTime"},
+    {13974, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks"},
+    {13975, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_InputArguments"},
+    {13976, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {13977, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate"},
+    {13978, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {13979, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {13980, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate"},
+    {13981, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_AddCertificate_InputArguments"},
+    {13982, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate"},
+    {13983, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_TrustList_RemoveCertificate_InputArguments"},
+    {13984, "ServerConfigurationType_CertificateGroups_DefaultApplicationGroup_CertificateTypes"},
+    {13985, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup"},
+    {13986, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList"},
+    {13987, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Size"},
+    {13988, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Writable"},
+    {13989, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_UserWritable"},
+    {13990, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenCount"},
+    {13991, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_MimeType"},
+    {13992, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open"},
+    {13993, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open_InputArguments"},
+    {13994, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Open_OutputArguments"},
+    {13995, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Close"},
+    {13996, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Close_InputArguments"},
+    {13997, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read"},
+    {13998, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read_InputArguments"},
+    {13999, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Read_OutputArguments"},
+    {14000, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Write"},
+    {14001, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_Write_InputArguments"},
+    {14002, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition"},
+    {14003, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_InputArguments"},
+    {14004, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments"},
+    {14005, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition"},
+    {14006, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition_InputArguments"},
+    {14007, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_LastUpdateTime"},
+    {14008, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks"},
+    {14009, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments"},
+    {14010, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {14011, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate"},
+    {14012, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {14013, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {14014, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate"},
+    {14015, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments"},
+    {14016, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate"},
+    {14017, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments"},
+    {14018, "ServerConfigurationType_CertificateGroups_DefaultHttpsGroup_CertificateTypes"},
+    {14019, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup"},
+    {14020, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList"},
+    {14021, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Size"},
+    {14022, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Writable"},
+    {14023, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_UserWritable"},
+    {14024, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenCount"},
+    {14025, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_MimeType"},
+    {14026, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open"},
+    {14027, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_InputArguments"},
+    {14028, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_OutputArguments"},
+    {14029, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Close"},
+    {14030, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Close_InputArguments"},
+    {14031, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read"},
+    {14032, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_InputArguments"},
+    {14033, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_OutputArguments"},
+    {14034, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Write"},
+    {14035, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_Write_InputArguments"},
+    {14036, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition"},
+    {14037, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments"},
+    {14038, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments"},
+    {14039, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition"},
+    {14040, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments"},
+    {14041, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_LastUpdateTime"},
+    {14042, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks"},
+    {14043, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments"},
+    {14044, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {14045, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate"},
+    {14046, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {14047, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {14048, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate"},
+    {14049, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments"},
+    {14050, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate"},
+    {14051, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments"},
+    {14052, "ServerConfigurationType_CertificateGroups_DefaultUserTokenGroup_CertificateTypes"},
+    {14053, "ServerConfiguration_CertificateGroups"},
+    {14088, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup"},
+    {14089, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList"},
+    {14090, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Size"},
+    {14091, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Writable"},
+    {14092, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_UserWritable"},
+    {14093, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenCount"},
+    {14094, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_MimeType"},
+    {14095, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open"},
+    {14096, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open_InputArguments"},
+    {14097, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Open_OutputArguments"},
+    {14098, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Close"},
+    {14099, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Close_InputArguments"},
+    {14100, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read"},
+    {14101, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read_InputArguments"},
+    {14102, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Read_OutputArguments"},
+    {14103, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Write"},
+    {14104, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_Write_InputArguments"},
+    {14105, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition"},
+    {14106, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_InputArguments"},
+    {14107, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_GetPosition_OutputArguments"},
+    {14108, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition"},
+    {14109, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_SetPosition_InputArguments"},
+    {14110, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_LastUpdateTime"},
+    {14111, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks"},
+    {14112, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_InputArguments"},
+    {14113, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {14114, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate"},
+    {14115, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {14116, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {14117, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate"},
+    {14118, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_AddCertificate_InputArguments"},
+    {14119, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate"},
+    {14120, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_TrustList_RemoveCertificate_InputArguments"},
+    {14121, "ServerConfiguration_CertificateGroups_DefaultHttpsGroup_CertificateTypes"},
+    {14122, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup"},
+    {14123, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList"},
+    {14124, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Size"},
+    {14125, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Writable"},
+    {14126, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_UserWritable"},
+    {14127, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenCount"},
+    {14128, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_MimeType"},
+    {14129, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open"},
+    {14130, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_InputArguments"},
+    {14131, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Open_OutputArguments"},
+    {14132, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Close"},
+    {14133, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Close_InputArguments"},
+    {14134, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read"},
+    {14135, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_InputArguments"},
+    {14136, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Read_OutputArguments"},
+    {14137, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Write"},
+    {14138, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_Write_InputArguments"},
+    {14139, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition"},
+    {14140, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_InputArguments"},
+    {14141, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_GetPosition_OutputArguments"},
+    {14142, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition"},
+    {14143, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_SetPosition_InputArguments"},
+    {14144, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_LastUpdateTime"},
+    {14145, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks"},
+    {14146, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_InputArguments"},
+    {14147, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_OpenWithMasks_OutputArguments"},
+    {14148, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate"},
+    {14149, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {14150, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_CloseAndUpdate_OutputArguments"},
+    {14151, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate"},
+    {14152, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_AddCertificate_InputArguments"},
+    {14153, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate"},
+    {14154, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_TrustList_RemoveCertificate_InputArguments"},
+    {14155, "ServerConfiguration_CertificateGroups_DefaultUserTokenGroup_CertificateTypes"},
+    {14156, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup"},
+    {14157, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_Writable"},
+    {14158, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_UserWritable"},
+    {14159, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_MimeType"},
+    {14160, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_TrustList_CloseAndUpdate_InputArguments"},
+    {14161, "ServerConfiguration_CertificateGroups_DefaultApplicationGroup_CertificateTypes"},
+    {14413, "AuditCreateSessionEventType_SessionId"},
+    {14414, "AuditUrlMismatchEventType_SessionId"},
+    {14415, "Server_ServerRedundancy_ServerNetworkGroups"},
+    {14900, "CertificateExpirationAlarmType_ExpirationLimit"},
+    {15182, "Server_Namespaces_OPCUANamespaceUri"},
+    {15183, "Server_Namespaces_OPCUANamespaceUri_NamespaceUri"},
+    {15184, "Server_Namespaces_OPCUANamespaceUri_NamespaceVersion"},
+    {15185, "Server_Namespaces_OPCUANamespaceUri_NamespacePublicationDate"},
+    {15186, "Server_Namespaces_OPCUANamespaceUri_IsNamespaceSubset"},
+    {15187, "Server_Namespaces_OPCUANamespaceUri_StaticNodeIdTypes"},
+    {15188, "Server_Namespaces_OPCUANamespaceUri_StaticNumericNodeIdRange"},
+    {15189, "Server_Namespaces_OPCUANamespaceUri_StaticStringNodeIdPattern"},
+    {15190, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile"},
+    {15191, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Size"},
+    {15192, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Writable"},
+    {15193, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_UserWritable"},
+    {15194, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_OpenCount"},
+    {15195, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_MimeType"},
+    {15196, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open"},
+    {15197, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open_InputArguments"},
+    {15198, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Open_OutputArguments"},
+    {15199, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Close"},
+    {15200, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Close_InputArguments"},
+    {15201, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read"},
+    {15202, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read_InputArguments"},
+    {15203, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Read_OutputArguments"},
+    {15204, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Write"},
+    {15205, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_Write_InputArguments"},
+    {15206, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition"},
+    {15207, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition_InputArguments"},
+    {15208, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_GetPosition_OutputArguments"},
+    {15209, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_SetPosition"},
+    {15210, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_SetPosition_InputArguments"},
+    {15211, "Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace"}
+};
+
+const int QOpcUaNodeIdsPrivate::namespace0NameCount = 5746;
+const quint32 QOpcUaNodeIdsPrivate::namespace0MaxId = 15211;
+
+const quint16 QOpcUaNodeIdsPrivate::namespace0IdIndices[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 0, 0, 42, 43, 44, 45,
+    46, 47, 0, 48, 49, 50, 51, 0, 52, 0, 53, 0, 0, 54, 55, 56,
+    0, 0, 0, 0, 57, 58, 0, 0, 59, 0, 0, 60, 61, 62, 63, 64,
+    65, 0, 0, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 77, 78, 79, 80, 0, 0, 0, 81,
+    82, 83, 84, 0, 85, 86, 0, 0, 87, 88, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+    137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 0, 0, 0, 161, 162, 163, 0, 0,
+    0, 0, 164, 165, 166, 0, 0, 0, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+    191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+    207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+    233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+    249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+    265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+    281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296,
+    297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312,
+    313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328,
+    329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408,
+    409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424,
+    425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+    441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456,
+    457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472,
+    473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+    489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+    505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+    537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552,
+    553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568,
+    569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
+    585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+    601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 0, 0, 0, 0,
+    0, 0, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626,
+    627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642,
+    643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658,
+    659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
+    0, 0, 0, 0, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686,
+    687, 688, 689, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 691, 692, 693, 694, 695, 696, 697, 698, 699, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 701, 702, 0, 0, 0,
+    0, 703, 704, 705, 706, 707, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 0,
+    724, 725, 0, 726, 727, 728, 729, 730, 0, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    0, 0, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    0, 768, 769, 0, 0, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780,
+    781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796,
+    797, 798, 799, 800, 801, 802, 803, 804, 805, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 806,
+    807, 808, 809, 810, 811, 812, 813, 0, 0, 814, 815, 816, 817, 818, 819, 0,
+    0, 0, 0, 0, 0, 0, 820, 821, 822, 823, 824, 825, 826, 827, 0, 828,
+    829, 830, 831, 832, 833, 834, 835, 0, 0, 0, 0, 836, 837, 838, 839, 840,
+    841, 842, 0, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855,
+    0, 856, 0, 0, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868,
+    869, 870, 0, 0, 0, 0, 0, 0, 0, 871, 872, 873, 874, 875, 876, 877,
+    878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893,
+    894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909,
+    910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 0, 924,
+    925, 0, 926, 927, 928, 929, 930, 931, 0, 932, 933, 0, 934, 935, 936, 937,
+    938, 939, 940, 0, 0, 0, 941, 942, 943, 0, 0, 944, 0, 0, 0, 0,
+    0, 0, 0, 945, 946, 947, 948, 949, 950, 0, 0, 951, 0, 0, 952, 0,
+    0, 0, 0, 953, 954, 955, 956, 957, 958, 0, 959, 960, 961, 0, 962, 963,
+    964, 965, 966, 0, 967, 968, 969, 970, 971, 0, 972, 973, 974, 975, 976, 977,
+    978, 0, 0, 979, 0, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+    991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+    1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+    1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1054, 1055, 1056, 1057, 1058, 1059,
+    1060, 1061, 1062, 1063, 0, 0, 1064, 0, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
+    1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+    1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 0, 0, 0, 1100, 0,
+    0, 0, 0, 1101, 1102, 1103, 1104, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1106, 1107, 1108,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1111, 1112, 0, 1113, 1114, 0, 1115, 1116, 0, 0, 0, 1117, 0, 1118, 1119,
+    0, 1120, 0, 1121, 1122, 1123, 0, 0, 0, 0, 0, 1124, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1125,
+    1126, 1127, 1128, 0, 1129, 1130, 1131, 1132, 0, 0, 0, 1133, 0, 0, 1134, 0,
+    0, 0, 0, 0, 1135, 0, 1136, 1137, 1138, 1139, 0, 1140, 1141, 1142, 1143, 1144,
+    1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+    1165, 1166, 1167, 1168, 0, 0, 1169, 1170, 0, 1171, 0, 1172, 1173, 1174, 1175, 1176,
+    1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+    1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 0,
+    1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+    1224, 1225, 1226, 0, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
+    1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0, 0, 0, 0, 0, 1247,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+    1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    0, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 0,
+    1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
+    1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+    1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+    1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+    1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+    1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+    1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+    1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533,
+    1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+    1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
+    1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
+    1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597,
+    1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,
+    1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629,
+    1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645,
+    1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
+    1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+    1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693,
+    1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709,
+    1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725,
+    1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
+    1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
+    1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789,
+    1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 0, 0,
+    0, 0, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+    1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833,
+    1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+    1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
+    1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
+    1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
+    1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+    1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949,
+    1950, 1951, 1952, 1953, 1954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969,
+    1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985,
+    1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1998, 1999, 2000, 2001, 2002, 2003,
+    2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2014, 2015, 2016, 2017, 2018, 2019,
+    2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 0, 0, 2030, 2031, 2032, 2033,
+    2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2042, 2043, 2044, 2045, 2046, 2047, 2048,
+    2049, 2050, 2051, 2052, 2053, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073,
+    2074, 2075, 2076, 0, 2077, 2078, 2079, 2080, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2093, 0, 0, 2094, 2095, 2096, 2097, 2098, 0,
+    0, 0, 0, 2099, 0, 2100, 2101, 0, 2102, 2103, 2104, 2105, 2106, 0, 2107, 0,
+    2108, 2109, 2110, 2111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2112, 2113, 2114, 0, 0, 0, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122,
+    2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138,
+    2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 0, 0, 0, 2148, 2149, 2150, 0,
+    0, 0, 2151, 2152, 2153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2166, 2167, 2168, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+    2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2190, 2191, 2192, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2193, 2194, 2195, 0, 0, 0, 2196, 2197, 2198, 2199, 2200, 2201, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2202, 2203, 2204, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220,
+    2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236,
+    2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 0, 2247, 2248, 2249, 2250, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2251, 2252, 2253,
+    0, 0, 0, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266,
+    2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282,
+    2283, 2284, 2285, 2286, 0, 0, 0, 2287, 2288, 2289, 0, 0, 0, 2290, 2291, 2292,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2293, 2294, 2295, 2296, 2297,
+    2298, 2299, 2300, 2301, 2302, 2303, 2304, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2305, 2306, 2307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+    2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2329,
+    2330, 2331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2332, 2333,
+    2334, 0, 0, 0, 2335, 2336, 2337, 2338, 2339, 2340, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2341, 2342, 2343, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2344, 2345, 2346, 2347, 2348,
+    2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364,
+    2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380,
+    2381, 2382, 2383, 2384, 2385, 0, 0, 0, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393,
+    2394, 2395, 2396, 0, 2397, 0, 2398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 0, 0, 0, 0, 0, 0, 2408,
+    2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424,
+    2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440,
+    2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456,
+    2457, 2458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471,
+    2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487,
+    2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+    2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519,
+    2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535,
+    2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
+    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567,
+    2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583,
+    2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599,
+    2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615,
+    2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631,
+    2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647,
+    2648, 2649, 2650, 2651, 2652, 2653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2654, 2655, 2656, 2657, 2658,
+    2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674,
+    2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690,
+    2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706,
+    2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722,
+    2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749,
+    2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765,
+    2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781,
+    2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797,
+    2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813,
+    2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829,
+    2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845,
+    2846, 2847, 2848, 2849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2850, 2851, 2852, 2853, 2854, 2855, 2856,
+    2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876,
+    2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892,
+    2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908,
+    2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924,
+    2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940,
+    2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+    2957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967,
+    2968, 2969, 2970, 2971, 2972, 2973, 2974, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987,
+    2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003,
+    3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019,
+    3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035,
+    3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051,
+    3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078,
+    3079, 3080, 3081, 3082, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098,
+    3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114,
+    3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130,
+    3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146,
+    3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162,
+    3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189,
+    3190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3191, 3192, 3193,
+    3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209,
+    3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225,
+    3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241,
+    3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257,
+    3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273,
+    3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3283, 3284,
+    3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300,
+    3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316,
+    3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332,
+    3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348,
+    3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364,
+    3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380,
+    3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396,
+    3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412,
+    3413, 3414, 3415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423,
+    3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439,
+    3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455,
+    3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471,
+    3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487,
+    3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503,
+    3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519,
+    3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535,
+    3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562,
+    3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
+    3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594,
+    3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610,
+    3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626,
+    3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642,
+    3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658,
+    3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674,
+    3675, 3676, 3677, 3678, 3679, 3680, 3681, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3682, 3683, 3684, 3685,
+    3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701,
+    3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717,
+    3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733,
+    3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749,
+    3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765,
+    3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781,
+    3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797,
+    3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813,
+    3814, 3815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824,
+    3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840,
+    3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856,
+    3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872,
+    3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888,
+    3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904,
+    3905, 3906, 3907, 3908, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3909, 3910, 3911, 3912, 3913, 3914, 3915,
+    3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931,
+    3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947,
+    3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
+    3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979,
+    3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995,
+    3996, 3997, 3998, 3999, 4000, 4001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4002, 4003, 4004, 4005, 4006,
+    4007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018,
+    4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034,
+    4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050,
+    4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066,
+    4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 0,
+    4082, 4083, 4084, 4085, 4086, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 0, 0, 4094, 4095, 4096, 4097,
+    4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113,
+    4114, 4115, 4116, 4117, 0, 0, 0, 0, 0, 0, 4118, 4119, 0, 0, 0, 0,
+    0, 0, 4120, 0, 0, 0, 4121, 4122, 4123, 4124, 4125, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4126, 4127, 4128, 0, 0, 4129, 4130, 4131, 0, 0, 4132, 4133,
+    4134, 4135, 4136, 4137, 0, 4138, 4139, 4140, 4141, 0, 0, 0, 4142, 4143, 0, 4144,
+    4145, 0, 0, 0, 4146, 0, 0, 0, 4147, 4148, 4149, 4150, 4151, 0, 0, 0,
+    4152, 4153, 4154, 0, 0, 0, 0, 0, 0, 0, 4155, 4156, 4157, 4158, 4159, 4160,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4161, 4162, 4163, 4164,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4165, 4166, 4167, 4168, 0, 0, 4169, 4170, 0, 0, 4171, 4172, 4173, 4174,
+    4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190,
+    4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206,
+    4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 0, 4219, 0, 4220,
+    4221, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236,
+    4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 0, 4251,
+    0, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 0, 0, 4261, 4262, 4263, 4264,
+    4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280,
+    4281, 0, 4282, 0, 4283, 4284, 4285, 4286, 4287, 4288, 4289, 0, 4290, 4291, 0, 4292,
+    0, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4300, 0, 0, 4301, 4302, 4303, 4304, 4305,
+    4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 0, 0, 4319,
+    4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335,
+    4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 0, 0, 4346, 4347, 4348, 4349,
+    4350, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365,
+    4366, 4367, 4368, 4369, 4370, 4371, 4372, 4373, 0, 0, 4374, 4375, 4376, 4377, 4378, 4379,
+    4380, 4381, 4382, 4383, 4384, 4385, 4386, 4387, 4388, 4389, 4390, 4391, 4392, 0, 0, 4393,
+    4394, 4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409,
+    4410, 4411, 4412, 4413, 0, 4414, 4415, 4416, 4417, 4418, 0, 4419, 0, 4420, 4421, 4422,
+    4423, 4424, 4425, 4426, 4427, 4428, 0, 0, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436,
+    4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452,
+    4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468,
+    4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 4484,
+    4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500,
+    4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516,
+    4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530, 4531, 4532,
+    4533, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548,
+    4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 4563, 4564,
+    4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580,
+    4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 0, 4595,
+    4596, 4597, 4598, 4599, 4600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613,
+    4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 4626, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637,
+    4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653,
+    4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669,
+    4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685,
+    4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701,
+    4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717,
+    4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733,
+    4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744, 4745, 4746, 4747, 4748, 4749,
+    4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765,
+    4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780, 4781,
+    4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797,
+    0, 4798, 4799, 4800, 4801, 4802, 0, 4803, 4804, 4805, 4806, 4807, 0, 0, 0, 4808,
+    4809, 4810, 0, 4811, 4812, 4813, 4814, 4815, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4816, 4817, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4818, 4819, 4820, 4821, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 0, 0, 4829, 4830,
+    4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846,
+    4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862,
+    4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878,
+    4879, 4880, 4881, 4882, 4883, 4884, 0, 4885, 4886, 4887, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4888, 4889, 4890, 0, 4891, 4892, 4893, 4894,
+    4895, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 0, 4909,
+    4910, 4911, 4912, 4913, 0, 0, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923,
+    4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939,
+    0, 0, 0, 0, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+    4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961, 4962, 4963, 0, 0, 0, 0,
+    4964, 4965, 0, 0, 4966, 0, 4967, 0, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975,
+    4976, 4977, 4978, 4979, 0, 0, 0, 0, 0, 0, 0, 4980, 4981, 4982, 4983, 0,
+    0, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 0, 4991, 4992, 4993, 4994, 4995, 4996, 4997,
+    4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013,
+    5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 5024, 5025, 5026, 5027, 5028, 5029,
+    5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045,
+    5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061,
+    5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077,
+    5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093,
+    5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109,
+    5110, 5111, 5112, 5113, 5114, 5115, 0, 5116, 5117, 5118, 5119, 5120, 5121, 5122, 5123, 5124,
+    5125, 5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140,
+    5141, 5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153, 5154, 5155, 5156,
+    5157, 5158, 5159, 5160, 5161, 5162, 5163, 5164, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172,
+    5173, 5174, 5175, 5176, 5177, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188,
+    5189, 5190, 5191, 5192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5193, 5194, 5195, 5196, 5197, 5198, 5199,
+    5200, 5201, 5202, 5203, 5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215,
+    5216, 5217, 5218, 5219, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231,
+    5232, 5233, 5234, 5235, 5236, 5237, 5238, 5239, 5240, 5241, 5242, 5243, 5244, 5245, 5246, 5247,
+    5248, 5249, 5250, 5251, 5252, 5253, 5254, 5255, 5256, 5257, 5258, 5259, 5260, 5261, 5262, 5263,
+    5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271, 5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279,
+    5280, 5281, 5282, 5283, 5284, 5285, 5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5296, 5297, 5298, 5299,
+    5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315,
+    5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330, 5331,
+    5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347,
+    5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5360,
+    5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5376,
+    5377, 5378, 5379, 5380, 5381, 5382, 5383, 5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391, 5392,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5393, 5394, 5395, 5396, 5397, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5398, 5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408,
+    5409, 5410, 5411, 5412, 5413, 5414, 5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423, 5424,
+    5425, 5426, 5427, 5428, 5429, 5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5440,
+    5441, 5442, 5443, 5444, 5445, 5446, 5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456,
+    5457, 5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472,
+    5473, 5474, 5475, 5476, 5477, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488,
+    5489, 5490, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504,
+    5505, 5506, 5507, 5508, 5509, 5510, 5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520,
+    5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536,
+    5537, 5538, 5539, 5540, 5541, 5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5551, 5552,
+    5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566, 5567, 5568,
+    5569, 5570, 5571, 5572, 5573, 5574, 5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5584,
+    5585, 5586, 5587, 5588, 5589, 5590, 5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600,
+    5601, 5602, 5603, 5604, 5605, 5606, 5607, 5608, 5609, 5610, 5611, 5612, 5613, 5614, 5615, 5616,
+    5617, 5618, 5619, 5620, 5621, 5622, 5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632,
+    5633, 5634, 5635, 5636, 5637, 5638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646,
+    5647, 5648, 5649, 5650, 5651, 5652, 5653, 5654, 5655, 5656, 5657, 5658, 5659, 5660, 5661, 5662,
+    5663, 5664, 5665, 5666, 5667, 5668, 5669, 5670, 5671, 5672, 5673, 5674, 5675, 5676, 5677, 5678,
+    5679, 5680, 5681, 5682, 5683, 5684, 5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694,
+    5695, 5696, 5697, 5698, 5699, 5700, 5701, 5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710,
+    5711, 5712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5713, 5714, 5715,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5716, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5717, 5718,
+    5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734,
+    5735, 5736, 5737, 5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746
+};
+
+const quint16 QOpcUaNodeIdsPrivate::namespace0NameOrder[] = {
+    1108, 2556, 2560, 2562, 2564, 2557, 2558, 2559, 2561, 2563, 2574, 2575, 2554, 2555, 2535, 2551,
+    2549, 2550, 4030, 4031, 2534, 2051, 5162, 5163, 2052, 2576, 2577, 2565, 2569, 2571, 2573, 2566,
+    2567, 2568, 2570, 2572, 2553, 2552, 2536, 2540, 2542, 2544, 2537, 2538, 2539, 2541, 2543, 2041,
+    2042, 2547, 2548, 2047, 2048, 2545, 2546, 2046, 2050, 2049, 2044, 2043, 2045, 265, 267, 266,
+    268, 270, 269, 4822, 4823, 1940, 1941, 198, 200, 199, 286, 288, 287, 289, 291, 290,
+    283, 285, 284, 201, 203, 202, 292, 294, 293, 295, 297, 296, 4316, 4322, 4323, 4334,
+    4329, 4330, 4331, 5353, 4319, 4318, 4320, 4321, 4324, 4325, 4326, 4332, 4333, 4317, 4952, 4951,
+    4327, 4328, 705, 4086, 4088, 4089, 4087, 4090, 707, 706, 528, 537, 539, 538, 530, 529,
+    966, 976, 968, 977, 981, 4239, 983, 982, 4150, 4149, 980, 4238, 967, 972, 4139, 974,
+    4148, 971, 4138, 973, 4147, 978, 985, 984, 975, 4140, 4165, 4164, 979, 4237, 969, 4137,
+    970, 4146, 4167, 4166, 986, 4141, 41, 1109, 2601, 2605, 2607, 2609, 2602, 2603, 2604, 2606,
+    2608, 2619, 2620, 2623, 2627, 2629, 2631, 2624, 2625, 2626, 2628, 2630, 2599, 2600, 2580, 2596,
+    2594, 2595, 4032, 4033, 2579, 2063, 5164, 5165, 2064, 2621, 2622, 2610, 2614, 2616, 2618, 2611,
+    2612, 2613, 2615, 2617, 2598, 2597, 2581, 2585, 2587, 2589, 2582, 2583, 2584, 2586, 2588, 2053,
+    2054, 4034, 2592, 2593, 2059, 2658, 2060, 2590, 2591, 2058, 2062, 2061, 2641, 2642, 2646, 2643,
+    2644, 2645, 2647, 4200, 2648, 2649, 2650, 2651, 2654, 2655, 2656, 2653, 2652, 2056, 2055, 2657,
+    2632, 2636, 2638, 2640, 2633, 2634, 2635, 2637, 2639, 2057, 1174, 1170, 990, 1863, 991, 993,
+    992, 1864, 681, 683, 682, 4111, 151, 153, 152, 4859, 140, 142, 141, 143, 139, 2096,
+    128, 130, 129, 4626, 4633, 4627, 4630, 4631, 4629, 4632, 4628, 398, 400, 399, 169, 4590,
+    775, 1402, 1405, 776, 1406, 1393, 1394, 1399, 1400, 1398, 4218, 1404, 1407, 1401, 1396, 1395,
+    1403, 1397, 777, 791, 1550, 1553, 1554, 1541, 1542, 1547, 1548, 792, 1546, 1552, 1549, 1544,
+    1543, 1551, 1545, 795, 1578, 1581, 1582, 1569, 1570, 1575, 1576, 1574, 796, 1580, 1577, 1572,
+    1571, 1579, 1573, 778, 1417, 1420, 1421, 1408, 1409, 1414, 1415, 1413, 779, 1419, 1422, 1416,
+    1411, 1410, 1418, 1412, 782, 1446, 1451, 1449, 1450, 1437, 1438, 783, 784, 1443, 1444, 1442,
+    1448, 1445, 1440, 1439, 1447, 1441, 780, 1432, 781, 1435, 1436, 1423, 1424, 1429, 1430, 1428,
+    1434, 1431, 1426, 1425, 1433, 1427, 785, 1461, 1466, 1464, 1465, 1452, 1453, 1458, 1459, 1457,
+    1463, 1460, 1455, 1454, 1462, 1456, 786, 1476, 1481, 1479, 1480, 1467, 1468, 1473, 1474, 1472,
+    1478, 1475, 1470, 1469, 1477, 1471, 789, 1521, 1526, 1524, 1525, 1512, 1513, 1518, 1519, 1517,
+    1523, 1520, 1515, 1514, 1522, 1516, 788, 1506, 1511, 1509, 1510, 1497, 1498, 1503, 1504, 1502,
+    1508, 1505, 1500, 1499, 1507, 1501, 787, 1491, 1496, 1494, 1495, 1482, 1483, 1488, 1489, 1487,
+    1493, 1490, 1485, 1484, 1492, 1486, 762, 1327, 1330, 1331, 1318, 1319, 1324, 1325, 1323, 1065,
+    1329, 1326, 1321, 1320, 1328, 1322, 2424, 2434, 2437, 2438, 4561, 2425, 2426, 2440, 2431, 2432,
+    2439, 2430, 2436, 2433, 2428, 2427, 2435, 2429, 1105, 2022, 2025, 2026, 4559, 2013, 2014, 2028,
+    2019, 2020, 2027, 2018, 2024, 2021, 2016, 2015, 2023, 2017, 2441, 2451, 2454, 2455, 4562, 2442,
+    2443, 2457, 2448, 2449, 2456, 2447, 2453, 2450, 2445, 2444, 2452, 2446, 1104, 2006, 2009, 2010,
+    1997, 1998, 2012, 2003, 2004, 2011, 2002, 2008, 2005, 2000, 1999, 2007, 2001, 1103, 1990, 1993,
+    1994, 1981, 1982, 1996, 1987, 1988, 1995, 1986, 1992, 1989, 1984, 1983, 1991, 1985, 2407, 2417,
+    2420, 2421, 2408, 2409, 2423, 2414, 2415, 2422, 2413, 4560, 2419, 2416, 2411, 2410, 2418, 2412,
+    4007, 4017, 4020, 4021, 4008, 4009, 4023, 4014, 4015, 4022, 4013, 4019, 4016, 4563, 4011, 4010,
+    4018, 4012, 771, 1370, 1373, 773, 1067, 1374, 1361, 1362, 1367, 1368, 1366, 774, 772, 1372,
+    5712, 1369, 1364, 1363, 1371, 1365, 793, 1564, 1567, 1568, 1555, 1556, 1561, 1562, 794, 1560,
+    1566, 1563, 1558, 1557, 1565, 1559, 797, 1592, 1595, 1596, 1583, 1584, 1589, 1590, 1588, 798,
+    1594, 1591, 1586, 1585, 1593, 1587, 755, 756, 759, 760, 1295, 1296, 1301, 1302, 1300, 758,
+    1303, 1298, 1297, 757, 1299, 1139, 1709, 1712, 1713, 1700, 1701, 1706, 1707, 1141, 1714, 1705,
+    1140, 1711, 1708, 1703, 1702, 1710, 1704, 1715, 1134, 1678, 1681, 1682, 1669, 1670, 1675, 1676,
+    1683, 1674, 1680, 1677, 1672, 1671, 1679, 1673, 1147, 1142, 1725, 1728, 1729, 1716, 1143, 1717,
+    1722, 1723, 1144, 1730, 1721, 1727, 1724, 1719, 1718, 1726, 1720, 1731, 1131, 1648, 1651, 1652,
+    1639, 1640, 1132, 1645, 1646, 1149, 1150, 1653, 1148, 1644, 1650, 1647, 1642, 1641, 1649, 1643,
+    1145, 1135, 1693, 1696, 1697, 1138, 1684, 1685, 1136, 1690, 1691, 1154, 1698, 1689, 1695, 1692,
+    1687, 1686, 1137, 1694, 1688, 1699, 804, 1634, 1637, 1638, 1625, 1626, 1631, 1632, 1071, 1630,
+    1636, 1633, 1628, 1627, 1635, 1629, 1133, 1663, 1666, 1667, 1654, 1655, 1660, 1661, 1152, 1153,
+    1668, 1151, 1659, 1665, 1662, 1657, 1656, 1664, 1658, 1146, 790, 1536, 1539, 1540, 1527, 1528,
+    1533, 1534, 1532, 1538, 1535, 1530, 1529, 1537, 1531, 763, 1341, 1344, 764, 1066, 1345, 1332,
+    1333, 1338, 1339, 1337, 765, 768, 1346, 767, 766, 1343, 1340, 1335, 1334, 1342, 1336, 4564,
+    4574, 4577, 4578, 4565, 4566, 4580, 4571, 4572, 4579, 4582, 4581, 4570, 4576, 4573, 4568, 4567,
+    4575, 4569, 4583, 761, 1313, 1316, 1317, 1304, 1305, 1310, 1311, 1309, 1315, 1312, 1307, 1306,
+    1314, 1308, 769, 1356, 1359, 1360, 1347, 1348, 1353, 1354, 1352, 1358, 770, 1355, 1350, 1349,
+    1357, 1351, 799, 1606, 1609, 1610, 1597, 1598, 1603, 1604, 1602, 1608, 1605, 1600, 1599, 1607,
+    1601, 805, 1741, 1744, 1745, 1732, 1733, 807, 1738, 1739, 806, 1737, 1743, 1740, 1735, 1734,
+    1742, 1736, 950, 1856, 1859, 1860, 1847, 1848, 1862, 1853, 1854, 1861, 1098, 1097, 1852, 1858,
+    1855, 1850, 1849, 1857, 1851, 1068, 1384, 1387, 1390, 1391, 1388, 1069, 1375, 1376, 1381, 1382,
+    1380, 1392, 1389, 1386, 5713, 1383, 1378, 1377, 1385, 1379, 800, 1620, 1070, 1623, 1624, 1611,
+    1612, 801, 1617, 1618, 803, 802, 1616, 1622, 1619, 1614, 1613, 1621, 1615, 4684, 4694, 4686,
+    4682, 4683, 4077, 23, 55, 746, 747, 748, 1285, 753, 752, 754, 750, 749, 751, 810,
+    1764, 1765, 1770, 1771, 1769, 1772, 1767, 1766, 1768, 52, 54, 4445, 0, 314, 316, 315,
+    310, 2098, 331, 333, 332, 334, 336, 335, 343, 349, 351, 350, 346, 348, 347, 345,
+    344, 325, 327, 326, 328, 330, 329, 322, 317, 4591, 324, 323, 163, 1159, 1165, 1164,
+    1161, 1162, 1160, 1163, 165, 164, 2, 14, 504, 506, 505, 507, 509, 508, 510, 512,
+    511, 513, 515, 514, 277, 279, 278, 280, 282, 281, 5192, 5231, 5235, 5237, 5239, 5232,
+    5233, 5234, 5236, 5238, 5249, 5250, 5253, 5257, 5259, 5261, 5254, 5255, 5256, 5258, 5260, 5225,
+    5226, 5205, 5294, 5293, 5222, 5220, 5221, 5202, 5203, 5204, 5227, 5229, 5230, 5228, 5251, 5252,
+    5240, 5244, 5246, 5248, 5241, 5242, 5243, 5245, 5247, 5223, 5224, 5207, 5211, 5213, 5215, 5208,
+    5209, 5210, 5212, 5214, 5193, 5194, 5292, 5715, 5262, 5218, 5219, 5199, 5290, 5200, 5291, 5216,
+    5217, 5198, 5206, 5201, 5272, 5273, 5277, 5274, 5275, 5276, 5278, 5283, 5279, 5280, 5281, 5282,
+    5286, 5287, 5288, 5285, 5284, 5196, 5195, 5289, 5263, 5267, 5269, 5271, 5264, 5265, 5266, 5268,
+    5270, 5197, 5397, 5500, 5533, 5501, 5529, 5530, 5510, 5526, 5527, 5528, 5511, 5517, 5518, 5519,
+    5522, 5506, 5507, 5505, 5523, 5524, 5525, 5508, 5509, 5512, 5513, 5514, 5531, 5532, 5520, 5521,
+    5502, 5504, 5503, 5515, 5516, 5398, 5431, 5399, 5427, 5428, 5408, 5424, 5425, 5426, 5409, 5415,
+    5416, 5417, 5420, 5404, 5405, 5403, 5421, 5422, 5423, 5406, 5407, 5410, 5411, 5412, 5429, 5430,
+    5418, 5419, 5400, 5402, 5401, 5413, 5414, 5432, 5465, 5433, 5461, 5462, 5442, 5458, 5459, 5460,
+    5443, 5449, 5450, 5451, 5454, 5438, 5439, 5437, 5455, 5456, 5457, 5440, 5441, 5444, 5445, 5446,
+    5463, 5464, 5452, 5453, 5434, 5436, 5435, 5447, 5448, 5466, 5499, 5467, 5495, 5496, 5476, 5492,
+    5493, 5494, 5477, 5483, 5484, 5485, 5488, 5472, 5473, 5471, 5489, 5490, 5491, 5474, 5475, 5478,
+    5479, 5480, 5497, 5498, 5486, 5487, 5468, 5470, 5469, 5481, 5482, 4857, 5391, 5359, 5387, 5388,
+    5368, 5384, 5385, 5386, 5369, 5375, 5376, 5377, 5380, 5364, 5365, 5363, 5381, 5382, 5383, 5366,
+    5367, 5370, 5371, 5372, 5389, 5390, 5378, 5379, 5360, 5362, 5361, 5373, 5374, 4858, 4890, 4900,
+    5392, 5393, 4903, 4904, 4891, 4892, 4906, 4897, 4898, 4905, 4896, 4902, 4899, 4894, 4893, 4901,
+    4895, 241, 243, 242, 4820, 4963, 4821, 4449, 4450, 250, 252, 251, 253, 255, 254, 271,
+    273, 272, 274, 276, 275, 4776, 4786, 4778, 5158, 5159, 2470, 2471, 1099, 2492, 2493, 2473,
+    2489, 2487, 2488, 4026, 4027, 2472, 1952, 5156, 5157, 1953, 2491, 2490, 2474, 2478, 2480, 2482,
+    2475, 2476, 2477, 2479, 2481, 1942, 1943, 2485, 2486, 1948, 1949, 2483, 2484, 1947, 1951, 1950,
+    1945, 1944, 1946, 2465, 2466, 386, 383, 404, 406, 405, 385, 384, 407, 409, 408, 388,
+    387, 321, 121, 5297, 5298, 5299, 5300, 5301, 5302, 549, 551, 550, 552, 554, 553, 259,
+    261, 260, 262, 264, 263, 4987, 4988, 4989, 585, 587, 586, 588, 590, 589, 4662, 4669,
+    4663, 4666, 4667, 4665, 4668, 4664, 4670, 4671, 4672, 522, 524, 523, 609, 611, 610, 517,
+    2102, 987, 988, 989, 192, 194, 193, 57, 76, 77, 58, 78, 79, 60, 114, 116,
+    115, 59, 72, 22, 125, 5125, 12, 518, 2103, 87, 5122, 1168, 1169, 489, 491, 490,
+    492, 494, 493, 5303, 5304, 579, 581, 580, 582, 584, 583, 204, 206, 205, 298, 300,
+    299, 301, 303, 302, 486, 488, 487, 207, 209, 208, 304, 306, 305, 307, 309, 308,
+    639, 641, 640, 642, 644, 643, 809, 1755, 1756, 1761, 1762, 1760, 1763, 1758, 1757, 1759,
+    24, 1106, 2516, 2517, 2497, 2530, 2513, 2511, 2512, 4028, 4029, 2496, 2039, 5160, 5161, 2040,
+    2528, 2518, 2522, 2524, 2526, 2519, 2520, 2521, 2523, 2525, 2515, 2514, 2498, 2502, 2504, 2506,
+    2499, 2500, 2501, 2503, 2505, 2029, 2030, 2531, 2509, 2510, 2035, 2036, 2529, 1107, 2507, 2508,
+    2034, 2532, 2533, 2527, 2038, 2037, 2032, 2031, 2033, 2494, 2495, 5134, 5144, 5136, 3728, 3763,
+    3767, 3769, 3771, 3764, 3765, 3766, 3768, 3770, 3781, 3782, 3785, 3789, 3791, 3793, 3786, 3787,
+    3788, 3790, 3792, 3759, 3760, 3739, 3756, 3754, 3755, 4066, 4067, 3738, 3761, 5184, 5185, 3762,
+    3783, 3784, 3772, 3776, 3778, 3780, 3773, 3774, 3775, 3777, 3779, 3758, 3757, 3741, 3745, 3747,
+    3749, 3742, 3743, 3744, 3746, 3748, 3729, 3730, 4068, 3752, 3753, 3735, 3820, 3736, 3750, 3751,
+    3734, 3740, 3737, 3803, 3804, 3808, 3805, 3806, 3807, 3809, 4215, 3810, 3811, 3812, 3813, 3816,
+    3817, 3818, 3815, 3814, 3732, 3731, 3819, 3794, 3798, 3800, 3802, 3795, 3796, 3797, 3799, 3801,
+    3733, 994, 1865, 1866, 10, 4777, 4787, 4779, 122, 5123, 677, 679, 678, 392, 394, 393,
+    160, 162, 161, 144, 146, 145, 4604, 4618, 4610, 4245, 4168, 2093, 2246, 2107, 1175, 28,
+    693, 695, 694, 525, 534, 536, 535, 527, 526, 690, 692, 691, 1155, 1286, 1287, 1292,
+    1293, 1291, 1294, 1289, 1288, 1290, 1156, 680, 2106, 3086, 3121, 3125, 3127, 3129, 3122, 3123,
+    3124, 3126, 3128, 3139, 3140, 3143, 3147, 3149, 3151, 3144, 3145, 3146, 3148, 3150, 3117, 3118,
+    3097, 3114, 3112, 3113, 4051, 4052, 3096, 3119, 5178, 5179, 3120, 3141, 3142, 3130, 3134, 3136,
+    3138, 3131, 3132, 3133, 3135, 3137, 3116, 3115, 3099, 3103, 3105, 3107, 3100, 3101, 3102, 3104,
+    3106, 3087, 3088, 3190, 3191, 4053, 3110, 3111, 3179, 3180, 3184, 3181, 3182, 3183, 3185, 4210,
+    3186, 3187, 3188, 3189, 3093, 3192, 3193, 3178, 3094, 3108, 3109, 3092, 3098, 3194, 3095, 3161,
+    3162, 3166, 3163, 3164, 3165, 3167, 4209, 3168, 3169, 3170, 3171, 3174, 3175, 3176, 3173, 3172,
+    3090, 3089, 3177, 3152, 3156, 3158, 3160, 3153, 3154, 3155, 3157, 3159, 3091, 2870, 2905, 2909,
+    2911, 2913, 2906, 2907, 2908, 2910, 2912, 2923, 2924, 2927, 2931, 2933, 2935, 2928, 2929, 2930,
+    2932, 2934, 2901, 2902, 2881, 2898, 2896, 2897, 4045, 4046, 2880, 2903, 5174, 5175, 2904, 2925,
+    2926, 2914, 2918, 2920, 2922, 2915, 2916, 2917, 2919, 2921, 2900, 2899, 2883, 2887, 2889, 2891,
+    2884, 2885, 2886, 2888, 2890, 2871, 2872, 2974, 2975, 4047, 2894, 2895, 2963, 2964, 2968, 2965,
+    2966, 2967, 2969, 4206, 2970, 2971, 2972, 2973, 2877, 2976, 2977, 2962, 2878, 2892, 2893, 2876,
+    2882, 2879, 2945, 2946, 2950, 2947, 2948, 2949, 2951, 4205, 2952, 2953, 2954, 2955, 2958, 2959,
+    2960, 2957, 2956, 2874, 2873, 2961, 2936, 2940, 2942, 2944, 2937, 2938, 2939, 2941, 2943, 2875,
+    2762, 2797, 2801, 2803, 2805, 2798, 2799, 2800, 2802, 2804, 2815, 2816, 2819, 2823, 2825, 2827,
+    2820, 2821, 2822, 2824, 2826, 2793, 2794, 2773, 2790, 2788, 2789, 4042, 4043, 2772, 2795, 5168,
+    5169, 2796, 2817, 2818, 2806, 2810, 2812, 2814, 2807, 2808, 2809, 2811, 2813, 2792, 2791, 2775,
+    2779, 2781, 2783, 2776, 2777, 2778, 2780, 2782, 2763, 2764, 2866, 2867, 4044, 2786, 2787, 2855,
+    2856, 2860, 2857, 2858, 2859, 2861, 4204, 2862, 2863, 2864, 2865, 2769, 2868, 2869, 2854, 2770,
+    2784, 2785, 2768, 2774, 2771, 2837, 2838, 2842, 2839, 2840, 2841, 2843, 4203, 2844, 2845, 2846,
+    2847, 2850, 2851, 2852, 2849, 2848, 2766, 2765, 2853, 2828, 2832, 2834, 2836, 2829, 2830, 2831,
+    2833, 2835, 2767, 2739, 2740, 2744, 2741, 2742, 2743, 2752, 2750, 2760, 4162, 2751, 2761, 4163,
+    2753, 2745, 4202, 2746, 2747, 2748, 2749, 2754, 2756, 2758, 4160, 2757, 2759, 4161, 2755, 2978,
+    3013, 3017, 3019, 3021, 3014, 3015, 3016, 3018, 3020, 3031, 3032, 3035, 3039, 3041, 3043, 3036,
+    3037, 3038, 3040, 3042, 3009, 3010, 2989, 3006, 3004, 3005, 4048, 4049, 2988, 3011, 5182, 5183,
+    3012, 3033, 3034, 3022, 3026, 3028, 3030, 3023, 3024, 3025, 3027, 3029, 3008, 3007, 2991, 2995,
+    2997, 2999, 2992, 2993, 2994, 2996, 2998, 2979, 2980, 3082, 3083, 4050, 3002, 3003, 3071, 3072,
+    3076, 3073, 3074, 3075, 3077, 4208, 3078, 3079, 3080, 3081, 2985, 3084, 3085, 3070, 2986, 3000,
+    3001, 2984, 2990, 2987, 3053, 3054, 3058, 3055, 3056, 3057, 3059, 4207, 3060, 3061, 3062, 3063,
+    3066, 3067, 3068, 3065, 3064, 2982, 2981, 3069, 3044, 3048, 3050, 3052, 3045, 3046, 3047, 3049,
+    3051, 2983, 17, 5308, 5342, 5343, 5344, 5345, 5346, 5347, 5348, 5349, 5309, 5310, 5311, 5312,
+    5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321, 5330, 5331, 5337, 5338, 5339, 5326, 5327,
+    5325, 5328, 5329, 5332, 5333, 5334, 5340, 5341, 5322, 5324, 5323, 5335, 5336, 5350, 5351, 5352,
+    4298, 4304, 4305, 4311, 4312, 4313, 5296, 4301, 4300, 4302, 4303, 4306, 4307, 4308, 4314, 4315,
+    4299, 4950, 4949, 4309, 4310, 389, 391, 390, 376, 2099, 4795, 4808, 4800, 4796, 4809, 4801,
+    220, 222, 221, 223, 225, 224, 1091, 1092, 1820, 1817, 1818, 1819, 1093, 4193, 1821, 1822,
+    1823, 1824, 1080, 1805, 1081, 1803, 1804, 1087, 4191, 1088, 1806, 1807, 1808, 9, 53, 47,
+    811, 812, 1773, 1774, 1779, 1780, 1778, 1781, 1776, 1775, 1777, 40, 226, 228, 227, 229,
+    231, 230, 4227, 4228, 4229, 4456, 4457, 4458, 5018, 5019, 13, 4099, 4100, 4102, 4103, 4101,
+    4104, 4585, 4106, 4109, 4110, 4107, 4108, 4235, 4236, 4105, 49, 33, 44, 2469, 38, 50,
+    37, 35, 2468, 51, 36, 45, 46, 43, 85, 42, 2467, 39, 32, 951, 1167, 4082,
+    4083, 4081, 4084, 4584, 953, 956, 957, 954, 955, 4231, 4232, 952, 4112, 456, 458, 457,
+    459, 696, 698, 697, 461, 460, 4114, 4118, 4116, 441, 443, 442, 462, 464, 463, 465,
+    467, 466, 438, 440, 439, 435, 437, 436, 4091, 958, 959, 960, 4085, 965, 4233, 964,
+    4127, 961, 4131, 4125, 4126, 962, 4132, 963, 4133, 4092, 4124, 4098, 4097, 4234, 4096, 4130,
+    4093, 4134, 4128, 4129, 4094, 4135, 4095, 4136, 477, 479, 478, 498, 500, 499, 501, 503,
+    502, 495, 497, 496, 4119, 4592, 4860, 1171, 88, 2092, 29, 708, 709, 4652, 4659, 4653,
+    4656, 4657, 4655, 4658, 4654, 4660, 4661, 710, 711, 946, 1825, 1176, 4587, 4596, 4594, 3,
+    5, 7, 26, 120, 699, 701, 700, 1123, 2681, 2685, 2687, 2689, 2682, 2683, 2684, 2686,
+    2688, 2699, 2700, 2703, 2707, 2709, 2711, 2704, 2705, 2706, 2708, 2710, 2679, 2680, 2660, 2676,
+    2674, 2675, 4035, 4036, 2659, 2090, 5166, 5167, 2091, 2701, 2702, 2690, 2694, 2696, 2698, 2691,
+    2692, 2693, 2695, 2697, 2678, 2677, 2661, 2665, 2667, 2669, 2662, 2663, 2664, 2666, 2668, 2080,
+    2081, 4038, 4039, 4037, 2672, 2673, 2086, 4040, 4041, 2738, 2087, 2670, 2671, 2085, 2089, 2088,
+    2721, 2722, 2726, 2723, 2724, 2725, 2727, 4201, 2728, 2729, 2730, 2731, 2734, 2735, 2736, 2733,
+    2732, 2083, 2082, 2737, 2712, 2716, 2718, 2720, 2713, 2714, 2715, 2717, 2719, 2084, 395, 397,
+    396, 1173, 127, 20, 4079, 4244, 5152, 4230, 5135, 5145, 5137, 134, 2094, 180, 182, 181,
+    108, 110, 109, 671, 673, 672, 4602, 4603, 61, 80, 65, 83, 62, 4242, 4243, 63,
+    84, 81, 64, 4240, 4241, 82, 4113, 4117, 4115, 561, 563, 562, 564, 566, 565, 591,
+    593, 592, 594, 596, 595, 543, 545, 544, 546, 548, 547, 555, 557, 556, 558, 560,
+    559, 606, 608, 607, 519, 531, 533, 532, 521, 520, 516, 2101, 540, 542, 541, 5305,
+    5306, 5307, 998, 1869, 999, 1870, 4120, 4121, 4123, 4195, 4122, 4673, 4681, 4680, 4674, 4677,
+    4678, 4676, 4679, 4675, 4335, 4339, 4343, 4349, 4350, 4361, 4356, 4357, 4358, 5354, 4346, 4345,
+    4347, 4348, 4351, 4352, 4353, 4359, 4360, 4344, 4954, 4953, 4354, 4355, 4338, 4336, 4337, 4340,
+    4341, 4342, 4362, 4390, 4396, 4397, 4408, 4403, 4404, 4405, 5356, 4393, 4392, 4394, 4395, 4398,
+    4399, 4400, 4406, 4407, 4391, 4958, 4957, 4401, 4402, 4363, 4367, 4371, 4377, 4378, 4389, 4384,
+    4385, 4386, 5355, 4374, 4373, 4375, 4376, 4379, 4380, 4381, 4387, 4388, 4372, 4956, 4955, 4382,
+    4383, 4366, 4364, 4365, 4368, 4369, 4370, 86, 4774, 4605, 4619, 4611, 90, 171, 170, 4589,
+    173, 172, 89, 4586, 16, 380, 382, 381, 373, 375, 374, 1172, 92, 91, 3594, 3629,
+    3633, 3635, 3637, 3630, 3631, 3632, 3634, 3636, 3647, 3648, 3651, 3655, 3657, 3659, 3652, 3653,
+    3654, 3656, 3658, 3625, 3626, 3605, 3622, 3620, 3621, 4063, 4064, 3604, 3627, 5176, 5177, 3628,
+    3649, 3650, 3638, 3642, 3644, 3646, 3639, 3640, 3641, 3643, 3645, 3624, 3623, 3607, 3611, 3613,
+    3615, 3608, 3609, 3610, 3612, 3614, 3595, 3596, 3723, 3687, 3691, 3693, 3695, 3688, 3689, 3690,
+    3692, 3694, 3724, 3696, 3700, 3702, 3704, 3697, 3698, 3699, 3701, 3703, 4065, 3618, 3619, 3601,
+    3725, 3726, 3714, 3718, 3720, 3722, 3715, 3716, 3717, 3719, 3721, 3705, 3709, 3711, 3713, 3706,
+    3707, 3708, 3710, 3712, 3686, 3602, 3616, 3617, 3600, 3606, 3727, 3603, 3669, 3670, 3674, 3671,
+    3672, 3673, 3675, 4214, 3676, 3677, 3678, 3679, 3682, 3683, 3684, 3681, 3680, 3598, 3597, 3685,
+    3660, 3664, 3666, 3668, 3661, 3662, 3663, 3665, 3667, 3599, 3328, 3363, 3367, 3369, 3371, 3364,
+    3365, 3366, 3368, 3370, 3381, 3382, 3385, 3389, 3391, 3393, 3386, 3387, 3388, 3390, 3392, 3359,
+    3360, 3339, 3356, 3354, 3355, 4057, 4058, 3338, 3361, 5172, 5173, 3362, 3383, 3384, 3372, 3376,
+    3378, 3380, 3373, 3374, 3375, 3377, 3379, 3358, 3357, 3341, 3345, 3347, 3349, 3342, 3343, 3344,
+    3346, 3348, 3329, 3330, 3457, 3421, 3425, 3427, 3429, 3422, 3423, 3424, 3426, 3428, 3458, 3430,
+    3434, 3436, 3438, 3431, 3432, 3433, 3435, 3437, 4059, 3352, 3353, 3335, 3459, 3460, 3448, 3452,
+    3454, 3456, 3449, 3450, 3451, 3453, 3455, 3439, 3443, 3445, 3447, 3440, 3441, 3442, 3444, 3446,
+    3420, 3336, 3350, 3351, 3334, 3340, 3337, 3403, 3404, 3408, 3405, 3406, 3407, 3409, 4212, 3410,
+    3411, 3412, 3413, 3416, 3417, 3418, 3415, 3414, 3332, 3331, 3419, 3394, 3398, 3400, 3402, 3395,
+    3396, 3397, 3399, 3401, 3333, 3195, 3230, 3234, 3236, 3238, 3231, 3232, 3233, 3235, 3237, 3248,
+    3249, 3252, 3256, 3258, 3260, 3253, 3254, 3255, 3257, 3259, 3226, 3227, 3206, 3223, 3221, 3222,
+    4054, 4055, 3205, 3228, 5170, 5171, 3229, 3250, 3251, 3239, 3243, 3245, 3247, 3240, 3241, 3242,
+    3244, 3246, 3225, 3224, 3208, 3212, 3214, 3216, 3209, 3210, 3211, 3213, 3215, 3196, 3197, 3324,
+    3288, 3292, 3294, 3296, 3289, 3290, 3291, 3293, 3295, 3325, 3297, 3301, 3303, 3305, 3298, 3299,
+    3300, 3302, 3304, 4056, 3219, 3220, 3202, 3326, 3327, 3315, 3319, 3321, 3323, 3316, 3317, 3318,
+    3320, 3322, 3306, 3310, 3312, 3314, 3307, 3308, 3309, 3311, 3313, 3287, 3203, 3217, 3218, 3201,
+    3207, 3204, 3270, 3271, 3275, 3272, 3273, 3274, 3276, 4211, 3277, 3278, 3279, 3280, 3283, 3284,
+    3285, 3282, 3281, 3199, 3198, 3286, 3261, 3265, 3267, 3269, 3262, 3263, 3264, 3266, 3268, 3200,
+    3461, 3496, 3500, 3502, 3504, 3497, 3498, 3499, 3501, 3503, 3514, 3515, 3518, 3522, 3524, 3526,
+    3519, 3520, 3521, 3523, 3525, 3492, 3493, 3472, 3489, 3487, 3488, 4060, 4061, 3471, 3494, 5180,
+    5181, 3495, 3516, 3517, 3505, 3509, 3511, 3513, 3506, 3507, 3508, 3510, 3512, 3491, 3490, 3474,
+    3478, 3480, 3482, 3475, 3476, 3477, 3479, 3481, 3462, 3463, 3590, 3554, 3558, 3560, 3562, 3555,
+    3556, 3557, 3559, 3561, 3591, 3563, 3567, 3569, 3571, 3564, 3565, 3566, 3568, 3570, 4062, 3485,
+    3486, 3468, 3592, 3593, 3581, 3585, 3587, 3589, 3582, 3583, 3584, 3586, 3588, 3572, 3576, 3578,
+    3580, 3573, 3574, 3575, 3577, 3579, 3553, 3469, 3483, 3484, 3467, 3473, 3470, 3536, 3537, 3541,
+    3538, 3539, 3540, 3542, 4213, 3543, 3544, 3545, 3546, 3549, 3550, 3551, 3548, 3547, 3465, 3464,
+    3552, 3527, 3531, 3533, 3535, 3528, 3529, 3530, 3532, 3534, 3466, 31, 4606, 4607, 4609, 4608,
+    744, 1284, 745, 5121, 702, 704, 703, 603, 605, 604, 25, 123, 75, 174, 176, 175,
+    93, 95, 94, 183, 185, 184, 96, 98, 97, 70, 67, 3821, 3856, 3860, 3862, 3864,
+    3857, 3858, 3859, 3861, 3863, 3874, 3875, 3878, 3882, 3884, 3886, 3879, 3880, 3881, 3883, 3885,
+    3852, 3853, 3832, 3849, 3847, 3848, 4069, 4070, 3831, 3854, 5186, 5187, 3855, 3876, 3877, 3865,
+    3869, 3871, 3873, 3866, 3867, 3868, 3870, 3872, 3851, 3850, 3834, 3838, 3840, 3842, 3835, 3836,
+    3837, 3839, 3841, 3822, 3823, 4071, 3845, 3846, 3828, 3913, 3829, 4072, 3843, 3844, 3827, 3833,
+    3830, 3896, 3897, 3901, 3898, 3899, 3900, 3902, 4216, 3903, 3904, 3905, 3906, 3909, 3910, 3911,
+    3908, 3907, 3825, 3824, 3912, 3887, 3891, 3893, 3895, 3888, 3889, 3890, 3892, 3894, 3826, 2108,
+    2153, 2154, 2155, 2156, 2157, 2158, 2198, 2199, 2200, 2240, 2241, 2242, 2132, 2133, 2134, 2123,
+    2124, 2125, 2111, 2112, 2113, 2183, 2184, 2185, 4696, 4697, 4698, 2147, 2148, 2149, 4788, 4789,
+    4790, 2171, 2168, 2169, 2170, 2172, 2173, 2109, 2159, 2160, 2161, 2162, 2163, 2164, 5146, 5147,
+    5148, 4791, 4792, 4793, 2237, 2238, 2239, 2177, 2178, 2179, 2144, 2145, 2146, 2126, 2127, 2128,
+    4620, 4621, 4622, 2114, 2115, 2116, 2195, 2196, 2197, 2174, 2175, 2176, 2189, 2201, 2202, 2203,
+    2190, 2191, 2141, 2142, 2143, 2180, 2181, 2182, 5149, 5150, 5151, 2228, 2229, 2230, 2192, 2193,
+    2194, 2110, 4623, 4624, 4625, 5012, 5013, 5014, 2243, 2244, 2245, 2234, 2235, 2236, 2204, 2205,
+    2206, 2165, 2166, 2167, 4976, 4973, 4974, 4975, 4977, 4978, 2207, 2208, 2209, 2231, 2232, 2233,
+    2210, 2211, 2212, 4812, 4813, 4814, 2213, 2214, 2215, 2222, 2223, 2224, 2216, 2217, 2218, 2219,
+    2220, 2221, 2150, 2151, 2152, 2186, 2187, 2188, 2117, 2118, 2119, 2225, 2226, 2227, 2400, 2401,
+    2402, 4944, 4945, 4946, 5015, 5016, 5017, 2129, 2130, 2131, 2135, 2136, 2137, 2120, 2121, 2122,
+    2138, 2139, 2140, 4699, 4700, 4701, 2247, 2292, 2293, 2294, 2295, 2296, 2297, 2337, 2338, 2339,
+    2379, 2380, 2381, 2271, 2272, 2273, 2262, 2263, 2264, 2250, 2251, 2252, 2322, 2323, 2324, 4688,
+    4689, 4690, 2286, 2287, 2288, 4780, 4781, 4782, 2310, 2307, 2308, 2309, 2311, 2312, 2248, 2298,
+    2299, 2300, 2301, 2302, 2303, 5138, 5139, 5140, 4783, 4784, 4785, 2376, 2377, 2378, 2316, 2317,
+    2318, 2283, 2284, 2285, 2265, 2266, 2267, 4612, 4613, 4614, 2253, 2254, 2255, 2334, 2335, 2336,
+    2313, 2314, 2315, 2328, 2340, 2341, 2342, 2329, 2330, 2280, 2281, 2282, 2319, 2320, 2321, 5141,
+    5142, 5143, 2367, 2368, 2369, 2331, 2332, 2333, 2249, 4615, 4616, 4617, 5004, 5005, 5006, 2382,
+    2383, 2384, 2373, 2374, 2375, 2343, 2344, 2345, 2304, 2305, 2306, 4970, 4967, 4968, 4969, 4971,
+    4972, 2346, 2347, 2348, 2370, 2371, 2372, 2349, 2350, 2351, 4804, 4805, 4806, 2352, 2353, 2354,
+    2361, 2362, 2363, 2355, 2356, 2357, 2358, 2359, 2360, 2289, 2290, 2291, 2325, 2326, 2327, 2256,
+    2257, 2258, 2364, 2365, 2366, 2404, 2405, 2406, 4940, 4941, 4942, 5007, 5008, 5009, 2268, 2269,
+    2270, 2274, 2275, 2276, 2259, 2260, 2261, 2277, 2278, 2279, 4691, 4692, 4693, 4600, 4601, 4446,
+    4447, 4448, 244, 246, 245, 247, 249, 248, 4817, 4818, 4819, 4289, 4297, 4293, 4766, 4767,
+    4768, 4769, 4292, 4296, 4290, 4294, 4295, 4291, 5000, 4219, 4413, 4220, 4990, 5010, 5002, 34,
+    1177, 410, 412, 411, 4142, 4593, 4078, 684, 686, 685, 1002, 1004, 1003, 1005, 1007, 1011,
+    1009, 1010, 1012, 1008, 1006, 1013, 1016, 1014, 1919, 1923, 1920, 1921, 1922, 1015, 1939, 1051,
+    1028, 1030, 1031, 1029, 1018, 1924, 4198, 1925, 1926, 1927, 1928, 1019, 1020, 1021, 1930, 1929,
+    1931, 1933, 1937, 1935, 1936, 1938, 1934, 1932, 1022, 1046, 1047, 1032, 1033, 1023, 1017, 1052,
+    1050, 1024, 1034, 1035, 1036, 1037, 1038, 1039, 1025, 1048, 1049, 1026, 1042, 1043, 1044, 1045,
+    1040, 1041, 1027, 1895, 1905, 1908, 1909, 1896, 1897, 1911, 1902, 1903, 1910, 1913, 1912, 1901,
+    1907, 1904, 1899, 1898, 1906, 1900, 1914, 4197, 1915, 1916, 1917, 1918, 1000, 1871, 1872, 1880,
+    1884, 1881, 1882, 1883, 1001, 1877, 1878, 1876, 1879, 1874, 1873, 1875, 1885, 1889, 1886, 1887,
+    1888, 1890, 4196, 1891, 1892, 1893, 1894, 4170, 4815, 4171, 4172, 4177, 4178, 4816, 4176, 4179,
+    4174, 4173, 4175, 56, 618, 620, 619, 621, 623, 622, 19, 370, 372, 371, 377, 379,
+    378, 413, 415, 414, 416, 418, 417, 419, 421, 420, 422, 424, 423, 674, 676, 675,
+    453, 455, 454, 444, 446, 445, 4451, 4452, 4453, 450, 452, 451, 447, 449, 448, 429,
+    431, 430, 432, 434, 433, 426, 428, 427, 645, 2104, 647, 649, 648, 318, 320, 319,
+    117, 119, 118, 189, 191, 190, 105, 107, 106, 73, 30, 1101, 1963, 1964, 1969, 1970,
+    1968, 1971, 1966, 1965, 1967, 1102, 1972, 1973, 1978, 1979, 1977, 1980, 1975, 1974, 1976, 1100,
+    1954, 1955, 1960, 1961, 1959, 1962, 1957, 1956, 1958, 358, 360, 359, 361, 363, 362, 4797,
+    4810, 4802, 4798, 4811, 4803, 235, 237, 236, 238, 240, 239, 232, 234, 233, 340, 337,
+    339, 338, 342, 341, 4824, 4825, 624, 626, 625, 627, 629, 628, 211, 213, 212, 5132,
+    5133, 5119, 5120, 214, 216, 215, 66, 4861, 4862, 1, 832, 5024, 5028, 5027, 5026, 5025,
+    650, 652, 651, 833, 4412, 4411, 4410, 834, 147, 2097, 1061, 1062, 1782, 1783, 1788, 1789,
+    1787, 1790, 1785, 1784, 1786, 687, 689, 688, 906, 721, 1074, 723, 4277, 1055, 5154, 1057,
+    1056, 4278, 724, 725, 4279, 4287, 4283, 4762, 4763, 4764, 4765, 4282, 4286, 4280, 4284, 4285,
+    4281, 722, 1157, 4288, 4907, 4883, 4982, 5534, 5535, 5568, 5536, 5564, 5565, 5545, 5561, 5562,
+    5563, 5546, 5552, 5553, 5554, 5557, 5541, 5542, 5540, 5558, 5559, 5560, 5543, 5544, 5547, 5548,
+    5549, 5566, 5567, 5555, 5556, 5537, 5539, 5538, 5550, 5551, 5569, 5602, 5570, 5598, 5599, 5579,
+    5595, 5596, 5597, 5580, 5586, 5587, 5588, 5591, 5575, 5576, 5574, 5592, 5593, 5594, 5577, 5578,
+    5581, 5582, 5583, 5600, 5601, 5589, 5590, 5571, 5573, 5572, 5584, 5585, 5603, 5636, 5604, 5632,
+    5633, 5613, 5629, 5630, 5631, 5614, 5620, 5621, 5622, 5625, 5609, 5610, 5608, 5626, 5627, 5628,
+    5611, 5612, 5615, 5616, 5617, 5634, 5635, 5623, 5624, 5605, 5607, 5606, 5618, 5619, 4979, 4980,
+    4981, 5020, 5021, 4885, 4886, 4965, 4884, 4887, 4888, 4889, 4986, 5637, 5706, 5711, 4911, 4935,
+    4936, 4917, 4933, 5710, 4934, 4918, 4924, 4925, 4926, 4929, 5709, 4914, 4913, 4930, 4931, 4932,
+    4915, 4916, 4919, 4920, 4921, 4937, 4938, 4927, 4928, 4912, 5708, 5707, 4922, 4923, 5638, 5671,
+    5639, 5667, 5668, 5648, 5664, 5665, 5666, 5649, 5655, 5656, 5657, 5660, 5644, 5645, 5643, 5661,
+    5662, 5663, 5646, 5647, 5650, 5651, 5652, 5669, 5670, 5658, 5659, 5640, 5642, 5641, 5653, 5654,
+    5672, 5705, 5673, 5701, 5702, 5682, 5698, 5699, 5700, 5683, 5689, 5690, 5691, 5694, 5678, 5679,
+    5677, 5695, 5696, 5697, 5680, 5681, 5684, 5685, 5686, 5703, 5704, 5692, 5693, 5674, 5676, 5675,
+    5687, 5688, 4983, 4984, 4985, 5022, 5023, 4909, 4910, 4966, 4908, 5394, 5395, 5396, 653, 655,
+    654, 819, 822, 829, 821, 828, 827, 831, 824, 830, 823, 820, 826, 825, 726, 730,
+    728, 727, 1221, 1228, 1220, 1227, 1226, 1230, 1223, 1229, 1222, 1219, 1225, 1224, 1064, 1231,
+    1232, 729, 4794, 4807, 4799, 739, 740, 646, 2105, 656, 658, 657, 814, 818, 1796, 1795,
+    1792, 1793, 1791, 1794, 816, 1072, 1073, 815, 817, 712, 1063, 5126, 4221, 4222, 4223, 714,
+    4257, 4258, 4264, 4265, 4276, 4271, 4272, 4273, 5295, 4261, 4260, 4262, 4263, 4266, 4267, 4268,
+    4274, 4275, 4259, 4948, 4947, 4269, 4270, 5127, 5128, 5115, 5116, 713, 717, 1198, 1191, 4246,
+    1193, 5153, 1195, 1194, 4247, 1192, 1197, 4248, 4256, 4252, 4758, 4759, 4760, 4761, 4251, 4255,
+    4249, 4253, 4254, 4250, 1190, 1196, 718, 1217, 1212, 1199, 1202, 1209, 1201, 1208, 1207, 1211,
+    1204, 1210, 1203, 1200, 1206, 1205, 1214, 1215, 1216, 1213, 720, 1218, 715, 1181, 1187, 1186,
+    1183, 1184, 1182, 1185, 1179, 1188, 1189, 1178, 1180, 716, 4991, 4992, 4993, 719, 813, 1127,
+    5129, 4224, 4225, 4226, 908, 4425, 4426, 4432, 4433, 4444, 4439, 4440, 4441, 5357, 4429, 4428,
+    4430, 4431, 4434, 4435, 4436, 4442, 4443, 4427, 4960, 4959, 4437, 4438, 5716, 5720, 5724, 5733,
+    5734, 5745, 5740, 5741, 5742, 5729, 5730, 5728, 5731, 5732, 5735, 5736, 5737, 5743, 5744, 5725,
+    5727, 5726, 5738, 5739, 5719, 5717, 5718, 5721, 5722, 5723, 5130, 5131, 5117, 5118, 907, 921,
+    1129, 923, 4414, 1058, 5155, 1060, 1059, 4415, 924, 1128, 4416, 4424, 4420, 4770, 4771, 4772,
+    4773, 4419, 4423, 4417, 4421, 4422, 4418, 922, 1797, 925, 940, 938, 926, 929, 935, 928,
+    934, 933, 937, 1798, 936, 930, 927, 932, 931, 1799, 1800, 1801, 939, 942, 4151, 1802,
+    4152, 5714, 4153, 909, 913, 919, 918, 916, 914, 915, 917, 911, 1125, 1126, 910, 912,
+    920, 4994, 4995, 4996, 941, 665, 667, 666, 217, 219, 218, 210, 856, 5061, 5068, 5094,
+    5095, 5098, 5099, 5081, 5070, 5064, 5071, 5082, 5087, 5073, 5074, 5072, 5086, 5096, 5097, 5093,
+    5066, 5078, 5080, 5067, 5069, 5083, 5088, 5090, 5101, 5102, 5077, 5103, 5091, 5065, 5062, 5063,
+    5084, 5089, 5085, 5075, 5092, 5100, 5076, 5104, 5079, 659, 661, 660, 734, 735, 1239, 1263,
+    1264, 1267, 1268, 1250, 1241, 1235, 1242, 1251, 1256, 1244, 1245, 1243, 1255, 1265, 1266, 1262,
+    1237, 1247, 1249, 1238, 1240, 1252, 1257, 1259, 1270, 1271, 1246, 1272, 1260, 1236, 1233, 1234,
+    1253, 1258, 1254, 2395, 1261, 1269, 4598, 1273, 1248, 736, 1277, 1282, 1276, 1275, 1278, 1280,
+    1281, 1274, 1279, 737, 857, 864, 887, 888, 891, 892, 874, 865, 860, 866, 875, 880,
+    868, 869, 867, 879, 889, 890, 886, 862, 871, 873, 863, 1158, 876, 881, 883, 894,
+    895, 870, 1053, 884, 861, 858, 859, 877, 882, 878, 2396, 885, 893, 4599, 1054, 872,
+    896, 5105, 5109, 5114, 5108, 5107, 5110, 5112, 5113, 5106, 5111, 662, 664, 663, 897, 901,
+    1166, 900, 899, 902, 904, 905, 898, 903, 731, 4702, 4703, 4710, 4736, 4737, 4740, 4741,
+    4723, 4712, 4706, 4713, 4724, 4729, 4715, 4716, 4714, 4728, 4738, 4739, 4735, 4708, 4720, 4722,
+    4709, 4711, 4725, 4730, 4732, 4743, 4744, 4719, 4745, 4733, 4707, 4704, 4705, 4726, 4731, 4727,
+    4717, 4734, 4742, 4718, 4746, 4721, 4747, 4751, 4756, 4750, 4749, 4752, 4754, 4755, 4748, 4753,
+    4757, 732, 733, 567, 569, 568, 570, 572, 571, 4459, 4460, 597, 599, 598, 600, 602,
+    601, 4997, 4998, 4999, 573, 575, 574, 576, 578, 577, 1110, 2065, 2069, 2066, 2067, 2068,
+    2070, 4199, 2071, 2072, 2073, 2074, 1121, 1113, 1119, 4159, 1118, 4158, 2077, 1122, 1124, 1112,
+    1117, 4157, 1116, 4156, 2076, 1120, 2578, 1111, 1115, 4155, 1114, 4154, 2075, 256, 258, 257,
+    166, 168, 167, 401, 403, 402, 943, 1089, 1812, 1809, 1810, 1811, 1090, 4192, 1813, 1814,
+    1815, 1816, 944, 945, 1075, 1079, 1076, 1077, 1078, 612, 614, 613, 18, 131, 133, 132,
+    11, 21, 615, 617, 616, 835, 5029, 5052, 5053, 5048, 5040, 5057, 5055, 5039, 5049, 5060,
+    5051, 5034, 5035, 5036, 5038, 5056, 5058, 5059, 5050, 5032, 5047, 5037, 5033, 5043, 5042, 5041,
+    5030, 5031, 5044, 5045, 5046, 5054, 668, 670, 669, 836, 2387, 2388, 854, 846, 2392, 2390,
+    845, 1130, 2397, 2386, 841, 2385, 842, 844, 2391, 2393, 2394, 855, 839, 853, 843, 840,
+    849, 848, 847, 837, 838, 850, 851, 852, 2389, 4080, 808, 1746, 1747, 1752, 1753, 1751,
+    1754, 1749, 1748, 1750, 4461, 4498, 4502, 4504, 4506, 4499, 4500, 4501, 4503, 4505, 4516, 4517,
+    4520, 4524, 4526, 4528, 4521, 4522, 4523, 4525, 4527, 4494, 4495, 4474, 4491, 4489, 4490, 4471,
+    4472, 4473, 4496, 5188, 5189, 4497, 4518, 4519, 4507, 4511, 4513, 4515, 4508, 4509, 4510, 4512,
+    4514, 4492, 4493, 4476, 4480, 4482, 4484, 4477, 4478, 4479, 4481, 4483, 4462, 4463, 4529, 4487,
+    4488, 4468, 4557, 4469, 4558, 4485, 4486, 4467, 4475, 4470, 4539, 4540, 4544, 4541, 4542, 4543,
+    4545, 4550, 4546, 4547, 4548, 4549, 4553, 4554, 4555, 4552, 4551, 4465, 4464, 4556, 4530, 4534,
+    4536, 4538, 4531, 4532, 4533, 4535, 4537, 4466, 4180, 4181, 4182, 4187, 4188, 4186, 4189, 4184,
+    4183, 4409, 4185, 124, 5124, 2398, 2403, 2399, 2078, 2079, 425, 2100, 48, 630, 632, 631,
+    633, 635, 634, 636, 638, 637, 948, 1826, 1827, 1095, 1838, 1835, 1836, 1837, 1832, 1833,
+    1831, 1834, 1829, 1828, 1830, 1096, 1842, 1839, 1840, 1841, 1094, 4194, 1843, 1844, 1845, 1846,
+    947, 949, 1082, 4190, 1083, 1084, 1085, 1086, 352, 354, 353, 355, 357, 356, 741, 742,
+    1283, 743, 3914, 3949, 3953, 3955, 3957, 3950, 3951, 3952, 3954, 3956, 3967, 3968, 3971, 3975,
+    3977, 3979, 3972, 3973, 3974, 3976, 3978, 3945, 3946, 3925, 3942, 3940, 3941, 4073, 4074, 3924,
+    3947, 5190, 5191, 3948, 3969, 3970, 3958, 3962, 3964, 3966, 3959, 3960, 3961, 3963, 3965, 3944,
+    3943, 3927, 3931, 3933, 3935, 3928, 3929, 3930, 3932, 3934, 3915, 3916, 4075, 3938, 3939, 3921,
+    4006, 3922, 4076, 3936, 3937, 3920, 3926, 3923, 3989, 3990, 3994, 3991, 3992, 3993, 3995, 4217,
+    3996, 3997, 3998, 3999, 4002, 4003, 4004, 4001, 4000, 3918, 3917, 4005, 3980, 3984, 3986, 3988,
+    3981, 3982, 3983, 3985, 3987, 3919, 4856, 4943, 4939, 4854, 4855, 4826, 4850, 4851, 4832, 4848,
+    4964, 4849, 4833, 4839, 4840, 4841, 4844, 5358, 4829, 4828, 4845, 4846, 4847, 4830, 4831, 4834,
+    4835, 4836, 4852, 4853, 4842, 4843, 4827, 4962, 4961, 4837, 4838, 4863, 4873, 4876, 4877, 4864,
+    4865, 4879, 4870, 4871, 4878, 4869, 4875, 4872, 4867, 4866, 4874, 4868, 995, 1867, 996, 997,
+    1868, 2458, 2462, 2464, 4025, 2459, 2460, 2461, 2463, 4024, 4588, 4597, 4595, 68, 4, 6,
+    8, 27, 5001, 5011, 5003, 364, 366, 365, 367, 369, 368, 4880, 4881, 4882, 480, 482,
+    481, 483, 485, 484, 4143, 4145, 4144, 148, 150, 149, 154, 156, 155, 136, 138, 137,
+    135, 2095, 126, 4169, 177, 179, 178, 99, 101, 100, 186, 188, 187, 102, 104, 103,
+    71, 738, 195, 197, 196, 311, 313, 312, 111, 113, 112, 4775, 69, 4454, 4455, 471,
+    473, 472, 474, 476, 475, 468, 470, 469, 157, 159, 158, 4685, 4695, 4687, 4643, 4650,
+    4644, 4647, 4648, 4646, 4649, 4645, 4651, 15, 74, 4634, 4641, 4635, 4638, 4639, 4637, 4640,
+    4636, 4642
+};
+
+#endif
+
 QT_END_NAMESPACE
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUANODEIDS_P_H
+#define QOPCUANODEIDS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuanodeids.h>
+
+#include <QtCore/qstring.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+// The tables are generated by qtopcua-defaultnodeidsgenerator together with the Namespace0 enum
+namespace QOpcUaNodeIdsPrivate {
+
+#ifndef QT_OPCUA_NO_NS0IDNAMES
+struct Namespace0Name {
+    quint32 id;
+    const char *name;
+};
+
+// Sorted by id
+extern const Namespace0Name namespace0Names[];
+extern const int namespace0NameCount;
+extern const quint32 namespace0MaxId;
+
+// Index + 1 of the entry in namespace0Names for each id up to namespace0MaxId, 0 for unknown ids
+extern const quint16 namespace0IdIndices[];
+
+// Indices of the entries in namespace0Names sorted by name
+extern const quint16 namespace0NameOrder[];
+#endif
+
+// Returns true and sets id if nodeId is a numeric node id in namespace 0, for example "ns=0;i=84" or "i=84".
+// This avoids the regular expressions of QOpcUa::nodeIdStringSplit() for the most frequently used node ids.
+inline bool namespace0NumericId(const QString &nodeId, quint32 *id)
+{
+    int start = 0;
+    if (nodeId.startsWith(QLatin1String("ns=0;i=")))
+        start = 7;
+    else if (nodeId.startsWith(QLatin1String("i=")))
+        start = 2;
+    else
+        return false;
+
+    const int length = nodeId.size() - start;
+    if (length < 1 || length > 10)
+        return false;
+
+    quint64 value = 0;
+    for (int i = start; i < nodeId.size(); ++i) {
+        const ushort c = nodeId.at(i).unicode();
+        if (c < '0' || c > '9')
+            return false;
+        value = value * 10 + (c - '0');
+    }
+
+    if (value > (std::numeric_limits<quint32>::max)())
+        return false;
+
+    *id = static_cast<quint32>(value);
+    return true;
+}
+
+}
+
+QT_END_NAMESPACE
+
+#endif // QOPCUANODEIDS_P_H
@@ -50,6 +50,8 @@
 
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuabrowsepathtarget.h>
+#include <QtOpcUa/qopcuabrowseresult.h>
+#include <QtOpcUa/qopcuadatavalue.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuareaditem.h>
@@ -78,6 +80,8 @@ public:
     virtual bool writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QOpcUa::Types valueAttributeType) = 0;
     virtual bool modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item,
                                           const QVariant &value) = 0;
+    virtual bool setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                               const QVector<quint32> &linksToRemove) = 0;
 
     virtual bool callMethod(const QString &methodNodeId, const QVector<QOpcUa::TypedVariant> &args) = 0;
 
@@ -92,13 +96,16 @@ public:
 Q_SIGNALS:
     void attributesRead(QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void attributeWritten(QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::UaStatusCode statusCode);
-    void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
+    void browseFinished(QOpcUaBrowseResult result, QOpcUa::UaStatusCode statusCode);
 
-    void dataChangeOccurred(QOpcUa::NodeAttribute attr, QOpcUaReadResult value);
-    void eventOccurred(QVariantList eventFields);
+    void dataChangeOccurred(QOpcUa::NodeAttribute attr, QOpcUaDataValue value);
+    void eventsOccurred(QVector<QOpcUaEventRecord> events);
     void monitoringEnableDisable(QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
+    void setTriggeringFinished(QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove,
+                               QVector<QOpcUa::UaStatusCode> addResults, QVector<QOpcUa::UaStatusCode> removeResults,
+                               QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void resolveBrowsePathFinished(QVector<QOpcUaBrowsePathTarget> targets,
                                      QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode status);
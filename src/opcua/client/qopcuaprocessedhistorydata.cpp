@@ -0,0 +1,261 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuaprocessedhistorydata.h"
+#include "qopcuadatavalue.h"
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaProcessedHistoryData
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief This class stores a chunk of aggregated historical values of a node.
+
+    A processed history read operation returns the aggregates calculated by the server for
+    each processing interval. To keep large time series small in memory, the values of a
+    node are not stored as one object per sample but in three parallel buffers:
+    the start times of the intervals, the aggregated values converted to \c double and
+    the status codes of the aggregates.
+
+    The start times are kept as OPC UA DateTime ticks (intervals of 100 nanoseconds since
+    January 1, 1601 UTC) to preserve the full precision of the server timestamps.
+    \l timestamp() converts a start time to a \l QDateTime with millisecond precision.
+
+    Values which can't be converted to \c double are stored as NaN, the status code of
+    such an entry is kept as returned by the server.
+
+    \sa QOpcUaClient::readHistoryProcessed() QOpcUaHistoryReadItem
+*/
+
+class QOpcUaProcessedHistoryDataData : public QSharedData
+{
+public:
+    QString nodeId;
+    QString aggregateType;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QVector<qint64> timestamps;
+    QVector<double> values;
+    QVector<QOpcUa::UaStatusCode> statusCodes;
+};
+
+QOpcUaProcessedHistoryData::QOpcUaProcessedHistoryData()
+    : data(new QOpcUaProcessedHistoryDataData)
+{
+}
+
+/*!
+    Constructs processed history data from \a other.
+*/
+QOpcUaProcessedHistoryData::QOpcUaProcessedHistoryData(const QOpcUaProcessedHistoryData &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs empty processed history data for node \a nodeId and the aggregate function \a aggregateType.
+*/
+QOpcUaProcessedHistoryData::QOpcUaProcessedHistoryData(const QString &nodeId, const QString &aggregateType)
+    : data(new QOpcUaProcessedHistoryDataData)
+{
+    data->nodeId = nodeId;
+    data->aggregateType = aggregateType;
+}
+
+/*!
+    Sets the values from \a rhs in this processed history data.
+*/
+QOpcUaProcessedHistoryData &QOpcUaProcessedHistoryData::operator=(const QOpcUaProcessedHistoryData &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaProcessedHistoryData::~QOpcUaProcessedHistoryData()
+{
+}
+
+/*!
+    Returns the node id of the node the values belong to.
+*/
+QString QOpcUaProcessedHistoryData::nodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaProcessedHistoryData::setNodeId(const QString &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the node id of the aggregate function.
+*/
+QString QOpcUaProcessedHistoryData::aggregateType() const
+{
+    return data->aggregateType;
+}
+
+/*!
+    Sets the node id of the aggregate function to \a aggregateType.
+*/
+void QOpcUaProcessedHistoryData::setAggregateType(const QString &aggregateType)
+{
+    data->aggregateType = aggregateType;
+}
+
+/*!
+    Returns the status code of the history read for this node.
+*/
+QOpcUa::UaStatusCode QOpcUaProcessedHistoryData::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaProcessedHistoryData::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the number of aggregated values.
+*/
+int QOpcUaProcessedHistoryData::count() const
+{
+    return data->values.size();
+}
+
+/*!
+    Reserves space for \a size aggregated values.
+*/
+void QOpcUaProcessedHistoryData::reserve(int size)
+{
+    data->timestamps.reserve(size);
+    data->values.reserve(size);
+    data->statusCodes.reserve(size);
+}
+
+/*!
+    Appends an aggregated \a value with the interval start time \a timestampTicks in
+    OPC UA DateTime ticks and the status code \a statusCode.
+
+    \sa QOpcUaDataValue::dateTimeToTicks()
+*/
+void QOpcUaProcessedHistoryData::append(qint64 timestampTicks, double value, QOpcUa::UaStatusCode statusCode)
+{
+    data->timestamps.push_back(timestampTicks);
+    data->values.push_back(value);
+    data->statusCodes.push_back(statusCode);
+}
+
+/*!
+    Returns the interval start times in OPC UA DateTime ticks.
+*/
+QVector<qint64> QOpcUaProcessedHistoryData::timestamps() const
+{
+    return data->timestamps;
+}
+
+/*!
+    Returns the aggregated values.
+*/
+QVector<double> QOpcUaProcessedHistoryData::values() const
+{
+    return data->values;
+}
+
+/*!
+    Returns the status codes of the aggregated values.
+*/
+QVector<QOpcUa::UaStatusCode> QOpcUaProcessedHistoryData::statusCodes() const
+{
+    return data->statusCodes;
+}
+
+/*!
+    Returns the interval start time of the value at index \a i.
+    The sub-millisecond part of the start time is truncated.
+
+    \sa timestampTicks()
+*/
+QDateTime QOpcUaProcessedHistoryData::timestamp(int i) const
+{
+    if (i < 0 || i >= data->timestamps.size())
+        return QDateTime();
+    return QOpcUaDataValue::ticksToDateTime(data->timestamps.at(i)).toUTC();
+}
+
+/*!
+    Returns the interval start time of the value at index \a i in OPC UA DateTime ticks
+    or \c 0 if \a i is out of range.
+*/
+qint64 QOpcUaProcessedHistoryData::timestampTicks(int i) const
+{
+    if (i < 0 || i >= data->timestamps.size())
+        return 0;
+    return data->timestamps.at(i);
+}
+
+/*!
+    Returns the aggregated value at index \a i.
+*/
+double QOpcUaProcessedHistoryData::value(int i) const
+{
+    if (i < 0 || i >= data->values.size())
+        return std::numeric_limits<double>::quiet_NaN();
+    return data->values.at(i);
+}
+
+/*!
+    Returns the status code of the value at index \a i.
+*/
+QOpcUa::UaStatusCode QOpcUaProcessedHistoryData::statusCode(int i) const
+{
+    if (i < 0 || i >= data->statusCodes.size())
+        return QOpcUa::UaStatusCode::BadNoData;
+    return data->statusCodes.at(i);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAPROCESSEDHISTORYDATA_H
+#define QOPCUAPROCESSEDHISTORYDATA_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaProcessedHistoryDataData;
+class Q_OPCUA_EXPORT QOpcUaProcessedHistoryData
+{
+public:
+    QOpcUaProcessedHistoryData();
+    QOpcUaProcessedHistoryData(const QOpcUaProcessedHistoryData &other);
+    QOpcUaProcessedHistoryData(const QString &nodeId, const QString &aggregateType);
+    QOpcUaProcessedHistoryData &operator=(const QOpcUaProcessedHistoryData &rhs);
+    ~QOpcUaProcessedHistoryData();
+
+    QString nodeId() const;
+    void setNodeId(const QString &nodeId);
+
+    QString aggregateType() const;
+    void setAggregateType(const QString &aggregateType);
+
+    QOpcUa::UaStatusCode statusCode() const;
+    void setStatusCode(QOpcUa::UaStatusCode statusCode);
+
+    int count() const;
+    void reserve(int size);
+    void append(qint64 timestampTicks, double value, QOpcUa::UaStatusCode statusCode);
+
+    QVector<qint64> timestamps() const;
+    QVector<double> values() const;
+    QVector<QOpcUa::UaStatusCode> statusCodes() const;
+
+    QDateTime timestamp(int i) const;
+    qint64 timestampTicks(int i) const;
+    double value(int i) const;
+    QOpcUa::UaStatusCode statusCode(int i) const;
+
+private:
+    QSharedDataPointer<QOpcUaProcessedHistoryDataData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaProcessedHistoryData)
+
+#endif // QOPCUAPROCESSEDHISTORYDATA_H
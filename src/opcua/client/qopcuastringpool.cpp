@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuastringpool_p.h"
+
+#include <QtCore/qthreadstorage.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QOpcUaStringPool returns shared QString instances for repeated content.
+
+    Browsing and reading large address spaces creates many equal strings like browse names
+    ("Value", "EngineeringUnits"), locales and node ids of reference types. A pool makes
+    all occurrences share the data of the first one.
+
+    Strings longer than maximumLength bytes are not pooled, they are rarely repeated.
+    The pool is cleared if it grows beyond maximumCount entries, this keeps the memory
+    use bounded if a server returns mostly unique strings.
+
+    The pool is not thread safe. The backends enable a pool for their own thread and
+    the value converters use it via forCurrentThread().
+*/
+
+Q_GLOBAL_STATIC(QThreadStorage<QOpcUaStringPool *>, threadPools)
+
+QOpcUaStringPool::QOpcUaStringPool(int maximumLength, int maximumCount)
+    : m_maximumLength(maximumLength)
+    , m_maximumCount(maximumCount)
+{
+}
+
+QString QOpcUaStringPool::fromUtf8(const char *data, int size)
+{
+    if (size <= 0 || size > m_maximumLength)
+        return QString::fromUtf8(data, size);
+
+    // The lookup key references the caller's buffer, only inserted keys are copied
+    const QByteArray key = QByteArray::fromRawData(data, size);
+    const auto it = m_utf8Strings.constFind(key);
+    if (it != m_utf8Strings.constEnd())
+        return it.value();
+
+    reserveEntry();
+    const QString value = QString::fromUtf8(data, size);
+    m_utf8Strings.insert(QByteArray(data, size), value);
+    return value;
+}
+
+QString QOpcUaStringPool::numericNodeId(quint16 namespaceIndex, quint32 identifier)
+{
+    const quint64 key = (quint64(namespaceIndex) << 32) | identifier;
+    const auto it = m_numericNodeIds.constFind(key);
+    if (it != m_numericNodeIds.constEnd())
+        return it.value();
+
+    reserveEntry();
+    const QString value = QLatin1String("ns=") + QString::number(namespaceIndex) + QLatin1String(";i=") + QString::number(identifier);
+    m_numericNodeIds.insert(key, value);
+    return value;
+}
+
+QString QOpcUaStringPool::intern(const QString &value)
+{
+    if (value.isEmpty() || value.size() > m_maximumLength)
+        return value;
+
+    const auto it = m_strings.constFind(value);
+    if (it != m_strings.constEnd())
+        return *it;
+
+    reserveEntry();
+    m_strings.insert(value);
+    return value;
+}
+
+int QOpcUaStringPool::count() const
+{
+    return m_utf8Strings.size() + m_numericNodeIds.size() + m_strings.size();
+}
+
+void QOpcUaStringPool::clear()
+{
+    m_utf8Strings.clear();
+    m_numericNodeIds.clear();
+    m_strings.clear();
+}
+
+void QOpcUaStringPool::reserveEntry()
+{
+    if (count() >= m_maximumCount)
+        clear();
+}
+
+/*
+    Creates or removes the pool of the current thread.
+    The pool is deleted when the thread exits.
+*/
+void QOpcUaStringPool::setEnabledForCurrentThread(bool enabled)
+{
+    QThreadStorage<QOpcUaStringPool *> *pools = threadPools();
+    if (!pools)
+        return;
+
+    if (enabled && !pools->localData())
+        pools->setLocalData(new QOpcUaStringPool());
+    else if (!enabled && pools->hasLocalData())
+        pools->setLocalData(nullptr); // Deletes the previous pool
+}
+
+QOpcUaStringPool *QOpcUaStringPool::forCurrentThread()
+{
+    QThreadStorage<QOpcUaStringPool *> *pools = threadPools();
+    if (!pools || !pools->hasLocalData())
+        return nullptr;
+    return pools->localData();
+}
+
+QT_END_NAMESPACE
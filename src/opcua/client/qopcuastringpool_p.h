@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUASTRINGPOOL_P_H
+#define QOPCUASTRINGPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qset.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaStringPool
+{
+public:
+    enum {
+        DefaultMaximumLength = 64,
+        DefaultMaximumCount = 100000
+    };
+
+    explicit QOpcUaStringPool(int maximumLength = DefaultMaximumLength, int maximumCount = DefaultMaximumCount);
+
+    QString fromUtf8(const char *data, int size);
+    QString numericNodeId(quint16 namespaceIndex, quint32 identifier);
+    QString intern(const QString &value);
+
+    int count() const;
+    void clear();
+
+    static void setEnabledForCurrentThread(bool enabled);
+    static QOpcUaStringPool *forCurrentThread();
+
+    static QString utf8ToString(const char *data, int size);
+
+private:
+    void reserveEntry();
+
+    QHash<QByteArray, QString> m_utf8Strings;
+    QHash<quint64, QString> m_numericNodeIds;
+    QSet<QString> m_strings;
+    int m_maximumLength;
+    int m_maximumCount;
+};
+
+inline QString QOpcUaStringPool::utf8ToString(const char *data, int size)
+{
+    if (QOpcUaStringPool *pool = forCurrentThread())
+        return pool->fromUtf8(data, size);
+    return QString::fromUtf8(data, size);
+}
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASTRINGPOOL_P_H
@@ -0,0 +1,1123 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuastructurecodec.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qset.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/qxmlstream.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaStructureCodec
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief QOpcUaStructureCodec decodes and encodes structured data types of a server at runtime.
+
+    Structured data types which are not known to Qt OPC UA are delivered as \l QOpcUaExtensionObject
+    with the binary encoded body. QOpcUaStructureCodec uses the OPC Binary type dictionaries
+    provided by the server to decode these bodies into a \l QVariantMap with one entry per field
+    and to encode a \l QVariantMap back into an extension object.
+
+    Each structured type is compiled once into a flat list of field operations when its
+    encoding id is registered. Decoding and encoding only walk this list, the type dictionary is
+    not evaluated again.
+
+    \code
+    // The value of a DataTypeDictionaryType node contains the dictionary as ByteString
+    codec.addTypeDictionary(dictionaryNode->attribute(QOpcUa::NodeAttribute::Value).toByteArray());
+    // The encoding id is the node id of the "Default Binary" node of the data type
+    codec.registerEncodingId(QLatin1String("ns=2;i=5005"), QLatin1String("MyStructure"));
+
+    bool success = false;
+    const QVariantMap fields = codec.decode(value.value<QOpcUaExtensionObject>(), &success).toMap();
+    \endcode
+
+    Fields are mapped to the following types:
+
+    \table
+        \header
+            \li OPC Binary type
+            \li Qt type
+        \row
+            \li Boolean, SByte, Byte, Int16, UInt16, Int32, UInt32, Int64, UInt64, Float, Double
+            \li The matching C++ arithmetic type
+        \row
+            \li String, CharArray
+            \li QString
+        \row
+            \li DateTime
+            \li QDateTime
+        \row
+            \li Guid
+            \li QUuid
+        \row
+            \li ByteString
+            \li QByteArray
+        \row
+            \li NodeId
+            \li QString
+        \row
+            \li ExpandedNodeId
+            \li QOpcUaExpandedNodeId
+        \row
+            \li StatusCode
+            \li QOpcUa::UaStatusCode
+        \row
+            \li QualifiedName
+            \li QOpcUaQualifiedName
+        \row
+            \li LocalizedText
+            \li QOpcUaLocalizedText
+        \row
+            \li ExtensionObject
+            \li The decoded value if the encoding id is registered, QOpcUaExtensionObject otherwise
+        \row
+            \li Structured type
+            \li QVariantMap
+        \row
+            \li Enumerated type
+            \li The signed integer type with the size of the enumeration
+    \endtable
+
+    Fields of the types Variant, DataValue, DiagnosticInfo and XmlElement are not supported.
+    Registering the encoding id of a structure which contains such a field fails.
+    Nested structures and extension objects are decoded and encoded up to a depth of 100,
+    deeper values are treated as an error.
+
+    Fields with a \c LengthField are mapped to QVariantList. Length fields, switch fields
+    and reserved padding bits are not part of the map, they are derived from the other fields
+    when encoding. Optional fields which are not present are omitted from the map.
+
+    The result of a decode can be converted to a C++ type by registering conversion functions
+    with \l registerType().
+
+    Registering types and dictionaries is not thread-safe, but decode() and encode() may be
+    called concurrently from multiple threads as soon as all registrations are done.
+*/
+
+/*!
+    \typealias QOpcUaStructureCodec::FromMapFunction
+
+    Converts the decoded fields of a structure to a user type.
+*/
+
+/*!
+    \typealias QOpcUaStructureCodec::ToMapFunction
+
+    Converts a value of a user type to the fields of a structure.
+*/
+
+/*!
+    \fn template <typename T> bool QOpcUaStructureCodec::registerType(const QString &encodingId, const std::function<T(const QVariantMap &)> &fromMap, const std::function<QVariantMap(const T &)> &toMap)
+
+    Registers the C++ type \c T for the structure with \a encodingId.
+    \a fromMap and \a toMap convert between the fields of the structure and \c T.
+
+    Returns \c true if the type has been registered.
+*/
+
+static const QLatin1String binarySchemaNamespace("http://opcfoundation.org/BinarySchema/");
+static const QLatin1String uaNamespace("http://opcfoundation.org/UA/");
+
+// Nested structures and extension objects deeper than this are rejected to bound the stack usage
+static const int maxNestingDepth = 100;
+
+static QString typeKey(const QString &namespaceUri, const QString &name)
+{
+    return QLatin1Char('{') + namespaceUri + QLatin1Char('}') + name;
+}
+
+namespace {
+
+enum class FieldType : quint8 {
+    Bits,
+    Boolean,
+    SByte,
+    Byte,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    String,
+    DateTime,
+    Guid,
+    ByteString,
+    NodeId,
+    ExpandedNodeId,
+    StatusCode,
+    QualifiedName,
+    LocalizedText,
+    ExtensionObject,
+    Structure
+};
+
+struct FieldDescription {
+    QString name;
+    QString typeName; // Clark notation
+    QString lengthField;
+    QString switchField;
+    qint64 switchValue = -1;
+    int length = 1;
+};
+
+struct StructuredType {
+    QVector<FieldDescription> fields;
+};
+
+struct Program;
+
+struct Operation {
+    FieldType type = FieldType::Int32;
+    QString name; // Empty for fields which are derived from other fields
+    int lengthIndex = -1; // Operation which contains the array length
+    int switchIndex = -1; // Operation which controls if the field is present
+    qint64 switchValue = -1; // -1 means the switch field must be non-zero
+    int bitLength = 0;
+    const Program *structure = nullptr;
+};
+
+struct Program {
+    enum class State {
+        Compiling,
+        Valid,
+        Invalid
+    };
+
+    QVector<Operation> operations;
+    State state = State::Compiling;
+};
+
+struct TypeConverter {
+    int metaType = QMetaType::UnknownType;
+    QOpcUaStructureCodec::FromMapFunction fromMap;
+    QOpcUaStructureCodec::ToMapFunction toMap;
+};
+
+// Reads and writes bit fields, which are packed LSB first and padded to the next byte
+struct BitCursor {
+    quint8 byte = 0;
+    int position = 8;
+
+    void reset() { position = 8; }
+};
+
+} // namespace
+
+class QOpcUaStructureCodecPrivate
+{
+public:
+    bool parseDictionary(const QByteArray &dictionary);
+    const Program *compile(const QString &key, bool &success);
+    void recompile();
+
+    bool decodeProgram(const Program *program, QOpcUaBinaryDataEncoding &decoder, int size, int depth, QVariantMap &result) const;
+    bool decodeValue(const Operation &operation, QOpcUaBinaryDataEncoding &decoder, int size, int depth, QVariant &result) const;
+    bool encodeProgram(const Program *program, const QVariantMap &fields, int depth, QOpcUaBinaryDataEncoding &encoder) const;
+    bool encodeValue(const Operation &operation, const QVariant &value, int depth, QOpcUaBinaryDataEncoding &encoder) const;
+    QVariant decodeExtensionObject(const QOpcUaExtensionObject &object, int depth, bool &success) const;
+    bool encodeExtensionObject(const QString &encodingId, const QVariant &value, int depth, QOpcUaExtensionObject &target) const;
+
+    QHash<QString, StructuredType> structuredTypes;
+    QHash<QString, int> enumeratedTypes; // Length in bits
+    QHash<QString, QString> encodingTypes; // Encoding id -> type key
+    QHash<QString, QSharedPointer<Program>> programs; // Type key -> compiled program
+    QHash<QString, const Program *> encodingPrograms; // Encoding id -> compiled program
+    QHash<QString, TypeConverter> converters; // Encoding id -> converter
+    QHash<int, QString> metaTypeEncodings; // Meta type -> encoding id
+};
+
+static bool builtinFieldType(const QString &key, FieldType &type)
+{
+    static const QHash<QString, FieldType> builtinTypes = {
+        {typeKey(binarySchemaNamespace, QStringLiteral("Bit")), FieldType::Bits},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Boolean")), FieldType::Boolean},
+        {typeKey(binarySchemaNamespace, QStringLiteral("SByte")), FieldType::SByte},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Byte")), FieldType::Byte},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Int16")), FieldType::Int16},
+        {typeKey(binarySchemaNamespace, QStringLiteral("UInt16")), FieldType::UInt16},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Int32")), FieldType::Int32},
+        {typeKey(binarySchemaNamespace, QStringLiteral("UInt32")), FieldType::UInt32},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Int64")), FieldType::Int64},
+        {typeKey(binarySchemaNamespace, QStringLiteral("UInt64")), FieldType::UInt64},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Float")), FieldType::Float},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Double")), FieldType::Double},
+        {typeKey(binarySchemaNamespace, QStringLiteral("String")), FieldType::String},
+        {typeKey(binarySchemaNamespace, QStringLiteral("CharArray")), FieldType::String},
+        {typeKey(binarySchemaNamespace, QStringLiteral("DateTime")), FieldType::DateTime},
+        {typeKey(binarySchemaNamespace, QStringLiteral("Guid")), FieldType::Guid},
+        {typeKey(binarySchemaNamespace, QStringLiteral("ByteString")), FieldType::ByteString},
+        {typeKey(uaNamespace, QStringLiteral("String")), FieldType::String},
+        {typeKey(uaNamespace, QStringLiteral("DateTime")), FieldType::DateTime},
+        {typeKey(uaNamespace, QStringLiteral("Guid")), FieldType::Guid},
+        {typeKey(uaNamespace, QStringLiteral("ByteString")), FieldType::ByteString},
+        {typeKey(uaNamespace, QStringLiteral("NodeId")), FieldType::NodeId},
+        {typeKey(uaNamespace, QStringLiteral("ExpandedNodeId")), FieldType::ExpandedNodeId},
+        {typeKey(uaNamespace, QStringLiteral("StatusCode")), FieldType::StatusCode},
+        {typeKey(uaNamespace, QStringLiteral("QualifiedName")), FieldType::QualifiedName},
+        {typeKey(uaNamespace, QStringLiteral("LocalizedText")), FieldType::LocalizedText},
+        {typeKey(uaNamespace, QStringLiteral("ExtensionObject")), FieldType::ExtensionObject}
+    };
+
+    const auto it = builtinTypes.constFind(key);
+    if (it == builtinTypes.constEnd())
+        return false;
+    type = it.value();
+    return true;
+}
+
+// Built-in types which have no binary decoder in QOpcUaBinaryDataEncoding
+static bool isUnsupportedBuiltinType(const QString &key)
+{
+    static const QSet<QString> unsupportedTypes = {
+        typeKey(binarySchemaNamespace, QStringLiteral("XmlElement")),
+        typeKey(uaNamespace, QStringLiteral("XmlElement")),
+        typeKey(uaNamespace, QStringLiteral("Variant")),
+        typeKey(uaNamespace, QStringLiteral("DataValue")),
+        typeKey(uaNamespace, QStringLiteral("DiagnosticInfo"))
+    };
+
+    return unsupportedTypes.contains(key);
+}
+
+bool QOpcUaStructureCodecPrivate::parseDictionary(const QByteArray &dictionary)
+{
+    QXmlStreamReader reader(dictionary);
+
+    QHash<QString, QString> prefixes;
+    QString targetNamespace;
+    QString currentType;
+    StructuredType currentStructure;
+    QHash<QString, StructuredType> newStructures;
+    QHash<QString, int> newEnumerations;
+
+    const auto resolve = [&prefixes, &targetNamespace](const QString &qualifiedName) {
+        const int separator = qualifiedName.indexOf(QLatin1Char(':'));
+        if (separator < 0)
+            return typeKey(prefixes.value(QString(), targetNamespace), qualifiedName);
+        return typeKey(prefixes.value(qualifiedName.left(separator)), qualifiedName.mid(separator + 1));
+    };
+
+    while (!reader.atEnd()) {
+        reader.readNext();
+
+        if (reader.isStartElement()) {
+            if (reader.namespaceUri() != binarySchemaNamespace)
+                continue;
+
+            const auto attributes = reader.attributes();
+
+            if (reader.name() == QLatin1String("TypeDictionary")) {
+                targetNamespace = attributes.value(QLatin1String("TargetNamespace")).toString();
+                for (const auto &declaration : reader.namespaceDeclarations())
+                    prefixes[declaration.prefix().toString()] = declaration.namespaceUri().toString();
+            } else if (reader.name() == QLatin1String("StructuredType")) {
+                currentType = typeKey(targetNamespace, attributes.value(QLatin1String("Name")).toString());
+                currentStructure = StructuredType();
+            } else if (reader.name() == QLatin1String("Field") && !currentType.isEmpty()) {
+                FieldDescription field;
+                field.name = attributes.value(QLatin1String("Name")).toString();
+                field.typeName = resolve(attributes.value(QLatin1String("TypeName")).toString());
+                field.lengthField = attributes.value(QLatin1String("LengthField")).toString();
+                field.switchField = attributes.value(QLatin1String("SwitchField")).toString();
+                if (attributes.hasAttribute(QLatin1String("SwitchValue"))) {
+                    bool ok = false;
+                    field.switchValue = attributes.value(QLatin1String("SwitchValue")).toLongLong(&ok);
+                    if (!ok || field.switchValue < 0) {
+                        qCWarning(QT_OPCUA) << "Invalid switch value for field" << field.name;
+                        return false;
+                    }
+                }
+                if (attributes.hasAttribute(QLatin1String("Length"))) {
+                    bool ok = false;
+                    field.length = attributes.value(QLatin1String("Length")).toInt(&ok);
+                    if (!ok || field.length <= 0) {
+                        qCWarning(QT_OPCUA) << "Invalid length for field" << field.name;
+                        return false;
+                    }
+                }
+                currentStructure.fields.push_back(field);
+            } else if (reader.name() == QLatin1String("EnumeratedType")) {
+                const QString key = typeKey(targetNamespace, attributes.value(QLatin1String("Name")).toString());
+                newEnumerations[key] = attributes.value(QLatin1String("LengthInBits")).toInt();
+            }
+        } else if (reader.isEndElement() && reader.name() == QLatin1String("StructuredType")) {
+            newStructures[currentType] = currentStructure;
+            currentType.clear();
+        }
+    }
+
+    if (reader.hasError()) {
+        qCWarning(QT_OPCUA) << "Failed to parse type dictionary:" << reader.errorString();
+        return false;
+    }
+
+    if (targetNamespace.isEmpty()) {
+        qCWarning(QT_OPCUA) << "The type dictionary has no target namespace";
+        return false;
+    }
+
+    for (auto it = newStructures.constBegin(); it != newStructures.constEnd(); ++it)
+        structuredTypes[it.key()] = it.value();
+    for (auto it = newEnumerations.constBegin(); it != newEnumerations.constEnd(); ++it)
+        enumeratedTypes[it.key()] = it.value();
+
+    return true;
+}
+
+const Program *QOpcUaStructureCodecPrivate::compile(const QString &key, bool &success)
+{
+    const auto existing = programs.constFind(key);
+    if (existing != programs.constEnd()) {
+        // Programs which are still being compiled are returned for recursive types
+        if (existing.value()->state == Program::State::Invalid) {
+            success = false;
+            return nullptr;
+        }
+        return existing.value().data();
+    }
+
+    const auto type = structuredTypes.constFind(key);
+    if (type == structuredTypes.constEnd()) {
+        qCWarning(QT_OPCUA) << "Unknown structured type" << key;
+        success = false;
+        return nullptr;
+    }
+
+    // Insert the program before compiling the fields to allow recursive types.
+    // It stays in the cache as invalid if one of the fields can't be resolved.
+    QSharedPointer<Program> program(new Program);
+    programs.insert(key, program);
+
+    const auto &fields = type->fields;
+    QHash<QString, int> fieldIndices;
+    QVector<bool> derived(fields.size(), false);
+
+    for (int i = 0; i < fields.size(); ++i) {
+        const auto &field = fields.at(i);
+        Operation operation;
+        operation.name = field.name;
+
+        if (isUnsupportedBuiltinType(field.typeName)) {
+            qCWarning(QT_OPCUA) << "Field" << field.name << "of" << key << "has the unsupported type" << field.typeName;
+            success = false;
+            program->state = Program::State::Invalid;
+            return nullptr;
+        }
+
+        if (!builtinFieldType(field.typeName, operation.type)) {
+            const auto enumeration = enumeratedTypes.constFind(field.typeName);
+            if (enumeration != enumeratedTypes.constEnd()) {
+                switch (enumeration.value()) {
+                case 8:
+                    operation.type = FieldType::SByte;
+                    break;
+                case 16:
+                    operation.type = FieldType::Int16;
+                    break;
+                case 32:
+                    operation.type = FieldType::Int32;
+                    break;
+                case 64:
+                    operation.type = FieldType::Int64;
+                    break;
+                default:
+                    qCWarning(QT_OPCUA) << "Unsupported enumeration size for field" << field.name;
+                    success = false;
+                    program->state = Program::State::Invalid;
+                    return nullptr;
+                }
+            } else {
+                operation.type = FieldType::Structure;
+                operation.structure = compile(field.typeName, success);
+                if (!success) {
+                    program->state = Program::State::Invalid;
+                    return nullptr;
+                }
+            }
+        }
+
+        if (operation.type == FieldType::Bits)
+            operation.bitLength = field.length;
+
+        if (!field.lengthField.isEmpty()) {
+            operation.lengthIndex = fieldIndices.value(field.lengthField, -1);
+            if (operation.lengthIndex < 0 || operation.type == FieldType::Bits) {
+                qCWarning(QT_OPCUA) << "Invalid length field for field" << field.name;
+                success = false;
+                program->state = Program::State::Invalid;
+                return nullptr;
+            }
+            derived[operation.lengthIndex] = true;
+        }
+
+        if (!field.switchField.isEmpty()) {
+            operation.switchIndex = fieldIndices.value(field.switchField, -1);
+            if (operation.switchIndex < 0) {
+                qCWarning(QT_OPCUA) << "Invalid switch field for field" << field.name;
+                success = false;
+                program->state = Program::State::Invalid;
+                return nullptr;
+            }
+            operation.switchValue = field.switchValue;
+            derived[operation.switchIndex] = true;
+        }
+
+        fieldIndices.insert(field.name, i);
+        program->operations.push_back(operation);
+    }
+
+    // Length and switch fields are computed from the other fields, padding bits are always zero
+    for (int i = 0; i < fields.size(); ++i) {
+        auto &operation = program->operations[i];
+        if (derived.at(i) || (operation.type == FieldType::Bits && operation.name.startsWith(QLatin1String("Reserved"))))
+            operation.name.clear();
+    }
+
+    program->state = Program::State::Valid;
+    return program.data();
+}
+
+void QOpcUaStructureCodecPrivate::recompile()
+{
+    programs.clear();
+    encodingPrograms.clear();
+
+    for (auto it = encodingTypes.constBegin(); it != encodingTypes.constEnd(); ++it) {
+        bool success = true;
+        const Program *program = compile(it.value(), success);
+        if (success)
+            encodingPrograms.insert(it.key(), program);
+    }
+}
+
+static bool readBits(QOpcUaBinaryDataEncoding &decoder, BitCursor &cursor, int length, quint64 &value)
+{
+    value = 0;
+    for (int i = 0; i < length; ++i) {
+        if (cursor.position == 8) {
+            bool success = false;
+            cursor.byte = decoder.decode<quint8>(success);
+            if (!success)
+                return false;
+            cursor.position = 0;
+        }
+        if (i < 64 && (cursor.byte >> cursor.position) & 1)
+            value |= quint64(1) << i;
+        ++cursor.position;
+    }
+    return true;
+}
+
+static bool writeBits(QOpcUaBinaryDataEncoding &encoder, BitCursor &cursor, int length, quint64 value)
+{
+    for (int i = 0; i < length; ++i) {
+        if (cursor.position == 8) {
+            cursor.byte = 0;
+            cursor.position = 0;
+        }
+        if (i < 64 && (value >> i) & 1)
+            cursor.byte |= quint8(1) << cursor.position;
+        ++cursor.position;
+        if (cursor.position == 8 && !encoder.encode<quint8>(cursor.byte))
+            return false;
+    }
+    return true;
+}
+
+// Writes the incomplete byte of a run of bit fields
+static bool flushBits(QOpcUaBinaryDataEncoding &encoder, BitCursor &cursor)
+{
+    if (cursor.position == 0 || cursor.position == 8)
+        return true;
+    cursor.position = 8;
+    return encoder.encode<quint8>(cursor.byte);
+}
+
+static bool isSwitchedOn(const Operation &operation, const QVarLengthArray<qint64, 32> &scalars)
+{
+    if (operation.switchIndex < 0)
+        return true;
+    const qint64 switchValue = scalars.at(operation.switchIndex);
+    return operation.switchValue < 0 ? switchValue != 0 : switchValue == operation.switchValue;
+}
+
+bool QOpcUaStructureCodecPrivate::decodeValue(const Operation &operation, QOpcUaBinaryDataEncoding &decoder, int size, int depth, QVariant &result) const
+{
+    bool success = false;
+
+    switch (operation.type) {
+    case FieldType::Boolean:
+        result = decoder.decode<bool>(success);
+        break;
+    case FieldType::SByte:
+        result = QVariant::fromValue(decoder.decode<qint8>(success));
+        break;
+    case FieldType::Byte:
+        result = QVariant::fromValue(decoder.decode<quint8>(success));
+        break;
+    case FieldType::Int16:
+        result = QVariant::fromValue(decoder.decode<qint16>(success));
+        break;
+    case FieldType::UInt16:
+        result = QVariant::fromValue(decoder.decode<quint16>(success));
+        break;
+    case FieldType::Int32:
+        result = decoder.decode<qint32>(success);
+        break;
+    case FieldType::UInt32:
+        result = decoder.decode<quint32>(success);
+        break;
+    case FieldType::Int64:
+        result = decoder.decode<qint64>(success);
+        break;
+    case FieldType::UInt64:
+        result = decoder.decode<quint64>(success);
+        break;
+    case FieldType::Float:
+        result = decoder.decode<float>(success);
+        break;
+    case FieldType::Double:
+        result = decoder.decode<double>(success);
+        break;
+    case FieldType::String:
+        result = decoder.decode<QString>(success);
+        break;
+    case FieldType::DateTime:
+        result = decoder.decode<QDateTime>(success);
+        break;
+    case FieldType::Guid:
+        result = decoder.decode<QUuid>(success);
+        break;
+    case FieldType::ByteString:
+        result = decoder.decode<QByteArray>(success);
+        break;
+    case FieldType::NodeId:
+        result = decoder.decode<QString, QOpcUa::Types::NodeId>(success);
+        break;
+    case FieldType::ExpandedNodeId:
+        result = QVariant::fromValue(decoder.decode<QOpcUaExpandedNodeId>(success));
+        break;
+    case FieldType::StatusCode:
+        result = QVariant::fromValue(decoder.decode<QOpcUa::UaStatusCode>(success));
+        break;
+    case FieldType::QualifiedName:
+        result = QVariant::fromValue(decoder.decode<QOpcUaQualifiedName>(success));
+        break;
+    case FieldType::LocalizedText:
+        result = QVariant::fromValue(decoder.decode<QOpcUaLocalizedText>(success));
+        break;
+    case FieldType::ExtensionObject: {
+        const auto object = decoder.decode<QOpcUaExtensionObject>(success);
+        if (success) {
+            if (encodingPrograms.contains(object.encodingTypeId()))
+                result = decodeExtensionObject(object, depth + 1, success);
+            else
+                result = QVariant::fromValue(object);
+        }
+        break;
+    }
+    case FieldType::Structure: {
+        QVariantMap fields;
+        success = decodeProgram(operation.structure, decoder, size, depth + 1, fields);
+        result = fields;
+        break;
+    }
+    case FieldType::Bits:
+        break;
+    }
+
+    return success;
+}
+
+static bool scalarValue(const QVariant &value, qint64 &result)
+{
+    bool ok = false;
+    result = value.toLongLong(&ok);
+    return ok;
+}
+
+bool QOpcUaStructureCodecPrivate::decodeProgram(const Program *program, QOpcUaBinaryDataEncoding &decoder, int size, int depth, QVariantMap &result) const
+{
+    if (!program || program->state != Program::State::Valid)
+        return false;
+
+    if (depth > maxNestingDepth) {
+        qCWarning(QT_OPCUA) << "Failed to decode structure, the maximum nesting depth of" << maxNestingDepth << "is exceeded";
+        return false;
+    }
+
+    const auto &operations = program->operations;
+    QVarLengthArray<qint64, 32> scalars(operations.size());
+    BitCursor cursor;
+
+    for (int i = 0; i < operations.size(); ++i) {
+        const auto &operation = operations.at(i);
+        scalars[i] = 0;
+
+        if (!isSwitchedOn(operation, scalars))
+            continue;
+
+        if (operation.type == FieldType::Bits) {
+            quint64 bits = 0;
+            if (!readBits(decoder, cursor, operation.bitLength, bits))
+                return false;
+            scalars[i] = static_cast<qint64>(bits);
+            if (!operation.name.isEmpty())
+                result.insert(operation.name, bits);
+            continue;
+        }
+
+        cursor.reset();
+
+        if (operation.lengthIndex >= 0) {
+            const qint64 length = scalars.at(operation.lengthIndex);
+            // Each element needs at least one byte
+            if (length > size - decoder.offset())
+                return false;
+
+            QVariantList elements;
+            elements.reserve(length > 0 ? static_cast<int>(length) : 0);
+            for (qint64 j = 0; j < length; ++j) {
+                QVariant element;
+                if (!decodeValue(operation, decoder, size, depth, element))
+                    return false;
+                elements.push_back(element);
+            }
+            result.insert(operation.name, elements);
+            continue;
+        }
+
+        QVariant value;
+        if (!decodeValue(operation, decoder, size, depth, value))
+            return false;
+
+        if (operation.name.isEmpty()) {
+            if (!scalarValue(value, scalars[i]))
+                return false;
+        } else {
+            result.insert(operation.name, value);
+        }
+    }
+
+    return true;
+}
+
+bool QOpcUaStructureCodecPrivate::encodeValue(const Operation &operation, const QVariant &value, int depth, QOpcUaBinaryDataEncoding &encoder) const
+{
+    bool ok = true;
+
+    switch (operation.type) {
+    case FieldType::Boolean:
+        return encoder.encode<bool>(value.toBool());
+    case FieldType::SByte: {
+        const qint64 temp = value.toLongLong(&ok);
+        return ok && temp >= std::numeric_limits<qint8>::min() && temp <= std::numeric_limits<qint8>::max()
+                && encoder.encode<qint8>(static_cast<qint8>(temp));
+    }
+    case FieldType::Byte: {
+        const quint64 temp = value.toULongLong(&ok);
+        return ok && temp <= std::numeric_limits<quint8>::max() && encoder.encode<quint8>(static_cast<quint8>(temp));
+    }
+    case FieldType::Int16: {
+        const qint64 temp = value.toLongLong(&ok);
+        return ok && temp >= std::numeric_limits<qint16>::min() && temp <= std::numeric_limits<qint16>::max()
+                && encoder.encode<qint16>(static_cast<qint16>(temp));
+    }
+    case FieldType::UInt16: {
+        const quint64 temp = value.toULongLong(&ok);
+        return ok && temp <= std::numeric_limits<quint16>::max() && encoder.encode<quint16>(static_cast<quint16>(temp));
+    }
+    case FieldType::Int32: {
+        const qint32 temp = value.toInt(&ok);
+        return ok && encoder.encode<qint32>(temp);
+    }
+    case FieldType::UInt32: {
+        const quint32 temp = value.toUInt(&ok);
+        return ok && encoder.encode<quint32>(temp);
+    }
+    case FieldType::Int64: {
+        const qint64 temp = value.toLongLong(&ok);
+        return ok && encoder.encode<qint64>(temp);
+    }
+    case FieldType::UInt64: {
+        const quint64 temp = value.toULongLong(&ok);
+        return ok && encoder.encode<quint64>(temp);
+    }
+    case FieldType::Float: {
+        const float temp = value.toFloat(&ok);
+        return ok && encoder.encode<float>(temp);
+    }
+    case FieldType::Double: {
+        const double temp = value.toDouble(&ok);
+        return ok && encoder.encode<double>(temp);
+    }
+    case FieldType::String:
+        return encoder.encode<QString>(value.toString());
+    case FieldType::DateTime:
+        return encoder.encode<QDateTime>(value.toDateTime());
+    case FieldType::Guid:
+        return encoder.encode<QUuid>(value.value<QUuid>());
+    case FieldType::ByteString:
+        return encoder.encode<QByteArray>(value.toByteArray());
+    case FieldType::NodeId:
+        return encoder.encode<QString, QOpcUa::Types::NodeId>(value.toString());
+    case FieldType::ExpandedNodeId:
+        return encoder.encode<QOpcUaExpandedNodeId>(value.value<QOpcUaExpandedNodeId>());
+    case FieldType::StatusCode:
+        return encoder.encode<QOpcUa::UaStatusCode>(value.value<QOpcUa::UaStatusCode>());
+    case FieldType::QualifiedName:
+        return encoder.encode<QOpcUaQualifiedName>(value.value<QOpcUaQualifiedName>());
+    case FieldType::LocalizedText:
+        return encoder.encode<QOpcUaLocalizedText>(value.value<QOpcUaLocalizedText>());
+    case FieldType::ExtensionObject: {
+        if (value.userType() == qMetaTypeId<QOpcUaExtensionObject>())
+            return encoder.encode<QOpcUaExtensionObject>(value.value<QOpcUaExtensionObject>());
+
+        const QString encodingId = metaTypeEncodings.value(value.userType());
+        QOpcUaExtensionObject object;
+        if (encodingId.isEmpty() || !encodeExtensionObject(encodingId, value, depth + 1, object))
+            return false;
+        return encoder.encode<QOpcUaExtensionObject>(object);
+    }
+    case FieldType::Structure:
+        if (value.type() != QVariant::Map)
+            return false;
+        return encodeProgram(operation.structure, value.toMap(), depth + 1, encoder);
+    case FieldType::Bits:
+        break;
+    }
+
+    return false;
+}
+
+bool QOpcUaStructureCodecPrivate::encodeProgram(const Program *program, const QVariantMap &fields, int depth, QOpcUaBinaryDataEncoding &encoder) const
+{
+    if (!program || program->state != Program::State::Valid)
+        return false;
+
+    if (depth > maxNestingDepth) {
+        qCWarning(QT_OPCUA) << "Failed to encode structure, the maximum nesting depth of" << maxNestingDepth << "is exceeded";
+        return false;
+    }
+
+    const auto &operations = program->operations;
+    QVarLengthArray<qint64, 32> scalars(operations.size());
+    for (int i = 0; i < operations.size(); ++i)
+        scalars[i] = 0;
+
+    // Derive the values of length and switch fields from the present fields
+    for (int i = 0; i < operations.size(); ++i) {
+        const auto &operation = operations.at(i);
+        const auto value = fields.constFind(operation.name);
+        const bool present = !operation.name.isEmpty() && value != fields.constEnd();
+
+        if (operation.switchIndex >= 0 && present)
+            scalars[operation.switchIndex] = operation.switchValue < 0 ? 1 : operation.switchValue;
+
+        if (operation.lengthIndex >= 0 && present) {
+            if (value->type() != QVariant::List)
+                return false;
+            scalars[operation.lengthIndex] = value->toList().size();
+        }
+    }
+
+    BitCursor cursor;
+
+    for (int i = 0; i < operations.size(); ++i) {
+        const auto &operation = operations.at(i);
+
+        if (!isSwitchedOn(operation, scalars))
+            continue;
+
+        const QVariant value = operation.name.isEmpty() ? QVariant(scalars.at(i)) : fields.value(operation.name);
+
+        if (operation.type == FieldType::Bits) {
+            bool ok = true;
+            const quint64 bits = value.isValid() ? value.toULongLong(&ok) : 0;
+            if (!ok || !writeBits(encoder, cursor, operation.bitLength, bits))
+                return false;
+            continue;
+        }
+
+        if (!flushBits(encoder, cursor))
+            return false;
+
+        if (!operation.name.isEmpty() && !value.isValid()) {
+            qCWarning(QT_OPCUA) << "Missing value for field" << operation.name;
+            return false;
+        }
+
+        if (operation.lengthIndex >= 0) {
+            for (const auto &element : value.toList()) {
+                if (!encodeValue(operation, element, depth, encoder))
+                    return false;
+            }
+            continue;
+        }
+
+        if (!encodeValue(operation, value, depth, encoder))
+            return false;
+    }
+
+    return flushBits(encoder, cursor);
+}
+
+QVariant QOpcUaStructureCodecPrivate::decodeExtensionObject(const QOpcUaExtensionObject &object, int depth, bool &success) const
+{
+    success = false;
+
+    const Program *program = encodingPrograms.value(object.encodingTypeId(), nullptr);
+    if (!program || object.encoding() != QOpcUaExtensionObject::Encoding::ByteString)
+        return QVariant();
+
+    QByteArray body = object.encodedBody();
+    QOpcUaBinaryDataEncoding decoder(&body);
+    QVariantMap fields;
+    if (!decodeProgram(program, decoder, body.size(), depth, fields))
+        return QVariant();
+
+    success = true;
+
+    const auto converter = converters.constFind(object.encodingTypeId());
+    if (converter != converters.constEnd())
+        return converter->fromMap(fields);
+
+    return fields;
+}
+
+bool QOpcUaStructureCodecPrivate::encodeExtensionObject(const QString &encodingId, const QVariant &value, int depth, QOpcUaExtensionObject &target) const
+{
+    const Program *program = encodingPrograms.value(encodingId, nullptr);
+    if (!program)
+        return false;
+
+    QVariantMap fields;
+    const auto converter = converters.constFind(encodingId);
+    if (converter != converters.constEnd() && value.userType() == converter->metaType)
+        fields = converter->toMap(value);
+    else if (value.type() == QVariant::Map)
+        fields = value.toMap();
+    else
+        return false;
+
+    QByteArray body;
+    QOpcUaBinaryDataEncoding encoder(&body);
+    if (!encodeProgram(program, fields, depth, encoder))
+        return false;
+
+    target.setEncodingTypeId(encodingId);
+    target.setEncoding(QOpcUaExtensionObject::Encoding::ByteString);
+    target.setEncodedBody(body);
+    return true;
+}
+
+/*!
+    Constructs a structure codec without any known types.
+*/
+QOpcUaStructureCodec::QOpcUaStructureCodec()
+    : d_ptr(new QOpcUaStructureCodecPrivate)
+{
+}
+
+/*!
+    Destroys this structure codec.
+*/
+QOpcUaStructureCodec::~QOpcUaStructureCodec()
+{
+}
+
+/*!
+    Adds the structured and enumerated types of the OPC Binary type dictionary \a dictionary
+    to the known types. Types from the same namespace which are already known are replaced.
+
+    The dictionary is the value of a node of type DataTypeDictionaryType on the server.
+    Types from other dictionaries which are referenced by \a dictionary must be added
+    before the encoding ids of the dependent types are registered.
+
+    Returns \c true if the dictionary has been parsed successfully.
+*/
+bool QOpcUaStructureCodec::addTypeDictionary(const QByteArray &dictionary)
+{
+    Q_D(QOpcUaStructureCodec);
+
+    if (!d->parseDictionary(dictionary))
+        return false;
+
+    // Types which were incomplete before may be resolvable now
+    d->recompile();
+    return true;
+}
+
+/*!
+    Registers \a encodingId as the node id of the binary encoding of the structured type
+    \a typeName and compiles the type.
+
+    If \a dictionaryNamespace is empty, \a typeName must be unique in all added dictionaries.
+
+    Returns \c true if the type is known and all its fields could be resolved.
+*/
+bool QOpcUaStructureCodec::registerEncodingId(const QString &encodingId, const QString &typeName, const QString &dictionaryNamespace)
+{
+    Q_D(QOpcUaStructureCodec);
+
+    QString key;
+    if (!dictionaryNamespace.isEmpty()) {
+        key = typeKey(dictionaryNamespace, typeName);
+    } else {
+        const QString suffix = QLatin1Char('}') + typeName;
+        for (auto it = d->structuredTypes.constBegin(); it != d->structuredTypes.constEnd(); ++it) {
+            if (!it.key().endsWith(suffix))
+                continue;
+            if (!key.isEmpty()) {
+                qCWarning(QT_OPCUA) << "The type name" << typeName << "is ambiguous";
+                return false;
+            }
+            key = it.key();
+        }
+    }
+
+    if (!d->structuredTypes.contains(key)) {
+        qCWarning(QT_OPCUA) << "Unknown structured type" << typeName;
+        return false;
+    }
+
+    d->encodingTypes.insert(encodingId, key);
+
+    bool success = true;
+    const Program *program = d->compile(key, success);
+    if (!success)
+        return false;
+
+    d->encodingPrograms.insert(encodingId, program);
+    return true;
+}
+
+/*!
+    Returns \c true if a compiled structure is available for \a encodingId.
+*/
+bool QOpcUaStructureCodec::hasEncodingId(const QString &encodingId) const
+{
+    Q_D(const QOpcUaStructureCodec);
+    return d->encodingPrograms.contains(encodingId);
+}
+
+/*!
+    Registers the type \a metaType for the structure with \a encodingId.
+    Decoded structures are converted to \a metaType using \a fromMap,
+    values of type \a metaType are converted to the fields of the structure using \a toMap.
+
+    Returns \c true if the type has been registered.
+*/
+bool QOpcUaStructureCodec::registerType(const QString &encodingId, int metaType, const FromMapFunction &fromMap, const ToMapFunction &toMap)
+{
+    Q_D(QOpcUaStructureCodec);
+
+    if (metaType == QMetaType::UnknownType || !fromMap || !toMap)
+        return false;
+
+    TypeConverter converter;
+    converter.metaType = metaType;
+    converter.fromMap = fromMap;
+    converter.toMap = toMap;
+    d->converters.insert(encodingId, converter);
+    d->metaTypeEncodings.insert(metaType, encodingId);
+    return true;
+}
+
+/*!
+    Decodes the binary encoded body of \a object.
+
+    Returns a \l QVariantMap with the fields of the structure or the registered type for the
+    encoding id of \a object. If \a success is not \c nullptr, it is set to \c true if
+    the object was decoded successfully.
+*/
+QVariant QOpcUaStructureCodec::decode(const QOpcUaExtensionObject &object, bool *success) const
+{
+    Q_D(const QOpcUaStructureCodec);
+
+    bool result = false;
+    const QVariant value = d->decodeExtensionObject(object, 0, result);
+    if (success)
+        *success = result;
+    return value;
+}
+
+/*!
+    Encodes \a value as the structure with \a encodingId into \a target.
+    \a value must be a \l QVariantMap with the fields of the structure or a value of the type
+    registered for \a encodingId.
+
+    Returns \c true if the value was encoded successfully.
+*/
+bool QOpcUaStructureCodec::encode(const QString &encodingId, const QVariant &value, QOpcUaExtensionObject &target) const
+{
+    Q_D(const QOpcUaStructureCodec);
+    return d->encodeExtensionObject(encodingId, value, 0, target);
+}
+
+/*!
+    Encodes \a value of a registered type into \a target.
+
+    Returns \c true if the value was encoded successfully.
+
+    \sa registerType()
+*/
+bool QOpcUaStructureCodec::encode(const QVariant &value, QOpcUaExtensionObject &target) const
+{
+    Q_D(const QOpcUaStructureCodec);
+
+    const QString encodingId = d->metaTypeEncodings.value(value.userType());
+    if (encodingId.isEmpty())
+        return false;
+    return d->encodeExtensionObject(encodingId, value, 0, target);
+}
+
+QT_END_NAMESPACE
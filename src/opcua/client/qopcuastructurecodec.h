@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUASTRUCTURECODEC_H
+#define QOPCUASTRUCTURECODEC_H
+
+#include <QtOpcUa/qopcuaextensionobject.h>
+
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qvariant.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaStructureCodecPrivate;
+class Q_OPCUA_EXPORT QOpcUaStructureCodec
+{
+public:
+    using FromMapFunction = std::function<QVariant(const QVariantMap &)>;
+    using ToMapFunction = std::function<QVariantMap(const QVariant &)>;
+
+    QOpcUaStructureCodec();
+    ~QOpcUaStructureCodec();
+
+    bool addTypeDictionary(const QByteArray &dictionary);
+    bool registerEncodingId(const QString &encodingId, const QString &typeName, const QString &dictionaryNamespace = QString());
+    bool hasEncodingId(const QString &encodingId) const;
+
+    bool registerType(const QString &encodingId, int metaType, const FromMapFunction &fromMap, const ToMapFunction &toMap);
+    template <typename T>
+    bool registerType(const QString &encodingId, const std::function<T(const QVariantMap &)> &fromMap,
+                      const std::function<QVariantMap(const T &)> &toMap)
+    {
+        return registerType(encodingId, qMetaTypeId<T>(),
+                            [fromMap](const QVariantMap &map) { return QVariant::fromValue(fromMap(map)); },
+                            [toMap](const QVariant &value) { return toMap(value.value<T>()); });
+    }
+
+    QVariant decode(const QOpcUaExtensionObject &object, bool *success = nullptr) const;
+    bool encode(const QString &encodingId, const QVariant &value, QOpcUaExtensionObject &target) const;
+    bool encode(const QVariant &value, QOpcUaExtensionObject &target) const;
+
+private:
+    Q_DISABLE_COPY(QOpcUaStructureCodec)
+    QScopedPointer<QOpcUaStructureCodecPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QOpcUaStructureCodec)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASTRUCTURECODEC_H
@@ -0,0 +1,478 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuatagmodel.h"
+#include "qopcuatagmodel_p.h"
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <private/qopcuaclient_p.h>
+
+#include <QtCore/qtimer.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaTagModel
+    \inmodule QtOpcUa
+    \since QtOpcUa 5.15
+    \brief A list model which shows the current values of a list of nodes.
+
+    QOpcUaTagModel monitors the value attribute of every node in \l nodeIds and provides
+    one row per node. The monitored items for all nodes are created with one batched
+    request each time the client connects, instead of one request per node.
+
+    The model doesn't create a QOpcUaNode per row. Each row registers a monitored item
+    handle with the client, and the data changes are assigned to the rows by their handle.
+    The model must live in the thread of the client.
+
+    The values are stored in a flat vector in the order of \l nodeIds. Value changes are
+    collected and reported once per iteration of the event loop. Changed rows which are
+    adjacent are combined into a single \l dataChanged() signal, so a publish response
+    which updates a block of rows causes one signal instead of one per row.
+
+    \code
+    QOpcUaTagModel *model = new QOpcUaTagModel(this);
+    model->setMonitoringParameters(QOpcUaMonitoringParameters(250));
+    model->setNodeIds({QStringLiteral("ns=2;s=Tank1.Level"), QStringLiteral("ns=2;s=Tank2.Level")});
+    model->setClient(client);
+    view->setModel(model);
+    \endcode
+
+    If a node id is invalid or the monitored item could not be created, the status code of
+    the row contains the error. After a disconnect, the last values are kept and the status
+    code of all rows is set to \l {QOpcUa::UaStatusCode} {BadDisconnect}.
+*/
+
+/*!
+    \enum QOpcUaTagModel::Roles
+
+    This enum contains the roles provided by the model in addition to Qt::DisplayRole,
+    which returns the value.
+
+    \value NodeIdRole The node id of the row.
+    \value ValueRole The value of the node.
+    \value StatusCodeRole The status code of the value.
+    \value SourceTimestampRole The source timestamp of the value.
+    \value ServerTimestampRole The server timestamp of the value.
+*/
+
+/*!
+    \property QOpcUaTagModel::nodeIds
+
+    The ids of the nodes shown by the model, one row per node.
+*/
+
+/*!
+    \property QOpcUaTagModel::count
+
+    The number of rows in the model.
+*/
+
+/*!
+    \fn void QOpcUaTagModel::clientChanged()
+
+    This signal is emitted when the client of the model has changed.
+*/
+
+/*!
+    \fn void QOpcUaTagModel::nodeIdsChanged()
+
+    This signal is emitted when the node ids of the model have changed.
+*/
+
+QOpcUaTagModelPrivate::QOpcUaTagModelPrivate()
+    : m_parameters(100)
+{
+}
+
+void QOpcUaTagModelPrivate::init()
+{
+    Q_Q(QOpcUaTagModel);
+
+    m_flushTimer = new QTimer(q);
+    m_flushTimer->setSingleShot(true);
+    m_flushTimer->setInterval(0);
+    QObject::connect(m_flushTimer, &QTimer::timeout, q, [this]() { flushChanges(); });
+}
+
+QOpcUaClientImpl *QOpcUaTagModelPrivate::clientImpl() const
+{
+    if (!m_client)
+        return nullptr;
+    return static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client.data()))->m_impl.data();
+}
+
+void QOpcUaTagModelPrivate::createMonitoredItems()
+{
+    QOpcUaClientImpl *impl = clientImpl();
+    if (!impl)
+        return;
+
+    QVector<quint64> handles;
+    QStringList nodeIds;
+    handles.reserve(m_tags.size());
+    nodeIds.reserve(m_tags.size());
+
+    for (int row = 0; row < m_tags.size(); ++row) {
+        Tag &tag = m_tags[row];
+        if (!QOpcUa::nodeIdStringSplit(tag.nodeId, nullptr, nullptr, nullptr)) {
+            updateStatusCode(row, QOpcUa::UaStatusCode::BadNodeIdInvalid);
+            continue;
+        }
+
+        tag.handle = impl->registerMonitoredItem(this);
+        if (!tag.handle) {
+            updateStatusCode(row, QOpcUa::UaStatusCode::BadTooManyMonitoredItems);
+            continue;
+        }
+
+        m_rows.insert(tag.handle, row);
+        handles.append(tag.handle);
+        nodeIds.append(tag.nodeId);
+    }
+
+    if (handles.isEmpty() || impl->enableMonitoring(handles, nodeIds, QOpcUa::NodeAttribute::Value, m_parameters))
+        return;
+
+    for (int row = 0; row < m_tags.size(); ++row) {
+        if (m_tags.at(row).handle)
+            updateStatusCode(row, QOpcUa::UaStatusCode::BadInternalError);
+    }
+}
+
+void QOpcUaTagModelPrivate::releaseMonitoredItems()
+{
+    QVector<quint64> handles;
+    handles.reserve(m_rows.size());
+    for (Tag &tag : m_tags) {
+        if (!tag.handle)
+            continue;
+        handles.append(tag.handle);
+        tag.handle = 0;
+    }
+    m_rows.clear();
+
+    QOpcUaClientImpl *impl = clientImpl();
+    if (!impl || handles.isEmpty())
+        return;
+
+    // Results for the handles are dropped by the client after they have been unregistered
+    if (m_client->state() == QOpcUaClient::Connected)
+        impl->disableMonitoring(handles, QOpcUa::NodeAttribute::Value);
+    for (const quint64 handle : qAsConst(handles))
+        impl->unregisterMonitoredItem(handle);
+}
+
+void QOpcUaTagModelPrivate::handleStateChanged(QOpcUaClient::ClientState state)
+{
+    if (state == QOpcUaClient::Connected) {
+        createMonitoredItems();
+    } else if (state == QOpcUaClient::Disconnected) {
+        releaseMonitoredItems();
+        for (int row = 0; row < m_tags.size(); ++row)
+            updateStatusCode(row, QOpcUa::UaStatusCode::BadDisconnect);
+    }
+}
+
+void QOpcUaTagModelPrivate::updateValue(int row, const QOpcUaDataValue &value)
+{
+    if (row < 0 || row >= m_tags.size())
+        return;
+
+    m_tags[row].value = value;
+    markChanged(row);
+}
+
+void QOpcUaTagModelPrivate::updateStatusCode(int row, QOpcUa::UaStatusCode statusCode)
+{
+    if (row < 0 || row >= m_tags.size() || m_tags.at(row).value.statusCode() == statusCode)
+        return;
+
+    m_tags[row].value.setStatusCode(statusCode);
+    markChanged(row);
+}
+
+void QOpcUaTagModelPrivate::markChanged(int row)
+{
+    if (m_rowChanged.testBit(row))
+        return;
+
+    m_rowChanged.setBit(row);
+    m_changedRows.append(row);
+
+    if (!m_flushTimer->isActive())
+        m_flushTimer->start();
+}
+
+void QOpcUaTagModelPrivate::flushChanges()
+{
+    Q_Q(QOpcUaTagModel);
+
+    m_flushTimer->stop();
+
+    if (m_changedRows.isEmpty())
+        return;
+
+    // The flags are reset first, a receiver of dataChanged() may cause new changes
+    QVector<int> rows;
+    rows.swap(m_changedRows);
+    for (const int row : qAsConst(rows))
+        m_rowChanged.clearBit(row);
+
+    std::sort(rows.begin(), rows.end());
+
+    static const QVector<int> roles = {
+        Qt::DisplayRole,
+        QOpcUaTagModel::ValueRole,
+        QOpcUaTagModel::StatusCodeRole,
+        QOpcUaTagModel::SourceTimestampRole,
+        QOpcUaTagModel::ServerTimestampRole
+    };
+
+    int first = rows.first();
+    int last = first;
+    for (int i = 1; i < rows.size(); ++i) {
+        const int row = rows.at(i);
+        if (row == last + 1) {
+            last = row;
+            continue;
+        }
+        emit q->dataChanged(q->index(first), q->index(last), roles);
+        first = last = row;
+    }
+    emit q->dataChanged(q->index(first), q->index(last), roles);
+}
+
+void QOpcUaTagModelPrivate::monitoredItemDataChanged(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value)
+{
+    if (attr == QOpcUa::NodeAttribute::Value)
+        updateValue(m_rows.value(handle, -1), value);
+}
+
+void QOpcUaTagModelPrivate::monitoredItemEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe,
+                                                       const QOpcUaMonitoringParameters &status)
+{
+    if (attr == QOpcUa::NodeAttribute::Value && subscribe && status.statusCode() != QOpcUa::UaStatusCode::Good)
+        updateStatusCode(m_rows.value(handle, -1), status.statusCode());
+}
+
+/*!
+    Constructs a tag model with parent \a parent.
+*/
+QOpcUaTagModel::QOpcUaTagModel(QObject *parent)
+    : QAbstractListModel(*(new QOpcUaTagModelPrivate), parent)
+{
+    Q_D(QOpcUaTagModel);
+    d->init();
+}
+
+/*!
+    Destroys the model and removes the monitored items it has created.
+*/
+QOpcUaTagModel::~QOpcUaTagModel()
+{
+    Q_D(QOpcUaTagModel);
+    d->releaseMonitoredItems();
+}
+
+/*!
+    Returns the client used by the model.
+*/
+QOpcUaClient *QOpcUaTagModel::client() const
+{
+    Q_D(const QOpcUaTagModel);
+    return d->m_client;
+}
+
+/*!
+    Sets the client used to monitor the nodes to \a client.
+
+    The monitored items are created as soon as \a client is connected and are recreated after a reconnect.
+    Values received from the previous client are discarded.
+*/
+void QOpcUaTagModel::setClient(QOpcUaClient *client)
+{
+    Q_D(QOpcUaTagModel);
+
+    if (d->m_client == client)
+        return;
+
+    QObject::disconnect(d->m_stateConnection);
+    d->releaseMonitoredItems();
+
+    for (int row = 0; row < d->m_tags.size(); ++row) {
+        d->m_tags[row].value = QOpcUaDataValue();
+        d->markChanged(row);
+    }
+
+    d->m_client = client;
+
+    if (client) {
+        d->m_stateConnection = QObject::connect(client, &QOpcUaClient::stateChanged, this,
+                                                [d](QOpcUaClient::ClientState state) { d->handleStateChanged(state); });
+        if (client->state() == QOpcUaClient::Connected)
+            d->createMonitoredItems();
+    }
+
+    emit clientChanged();
+}
+
+/*!
+    Returns the ids of the nodes shown by the model.
+*/
+QStringList QOpcUaTagModel::nodeIds() const
+{
+    Q_D(const QOpcUaTagModel);
+
+    QStringList ids;
+    ids.reserve(d->m_tags.size());
+    for (const auto &tag : qAsConst(d->m_tags))
+        ids.append(tag.nodeId);
+    return ids;
+}
+
+/*!
+    Sets the ids of the nodes shown by the model to \a nodeIds and resets the model.
+*/
+void QOpcUaTagModel::setNodeIds(const QStringList &nodeIds)
+{
+    Q_D(QOpcUaTagModel);
+
+    if (nodeIds == this->nodeIds())
+        return;
+
+    beginResetModel();
+
+    d->releaseMonitoredItems();
+    d->m_flushTimer->stop();
+    d->m_changedRows.clear();
+    d->m_rowChanged.fill(false, nodeIds.size());
+
+    d->m_tags.clear();
+    d->m_tags.resize(nodeIds.size());
+    for (int i = 0; i < nodeIds.size(); ++i)
+        d->m_tags[i].nodeId = nodeIds.at(i);
+
+    endResetModel();
+
+    if (d->m_client && d->m_client->state() == QOpcUaClient::Connected)
+        d->createMonitoredItems();
+
+    emit nodeIdsChanged();
+}
+
+/*!
+    Returns the parameters used to create the monitored items.
+*/
+QOpcUaMonitoringParameters QOpcUaTagModel::monitoringParameters() const
+{
+    Q_D(const QOpcUaTagModel);
+    return d->m_parameters;
+}
+
+/*!
+    Sets the parameters used to create the monitored items to \a parameters.
+    The default is a publishing interval of 100 ms.
+
+    Existing monitored items are removed and created again using the new parameters.
+*/
+void QOpcUaTagModel::setMonitoringParameters(const QOpcUaMonitoringParameters &parameters)
+{
+    Q_D(QOpcUaTagModel);
+
+    d->m_parameters = parameters;
+
+    if (d->m_client && d->m_client->state() == QOpcUaClient::Connected) {
+        d->releaseMonitoredItems();
+        d->createMonitoredItems();
+    }
+}
+
+/*!
+    \reimp
+*/
+int QOpcUaTagModel::rowCount(const QModelIndex &parent) const
+{
+    Q_D(const QOpcUaTagModel);
+    return parent.isValid() ? 0 : d->m_tags.size();
+}
+
+/*!
+    \reimp
+*/
+QVariant QOpcUaTagModel::data(const QModelIndex &index, int role) const
+{
+    Q_D(const QOpcUaTagModel);
+
+    if (!index.isValid() || index.row() >= d->m_tags.size())
+        return QVariant();
+
+    const auto &tag = d->m_tags.at(index.row());
+
+    switch (role) {
+    case Qt::DisplayRole:
+    case ValueRole:
+        return tag.value.value();
+    case NodeIdRole:
+        return tag.nodeId;
+    case StatusCodeRole:
+        return QVariant::fromValue(tag.value.statusCode());
+    case SourceTimestampRole:
+        return tag.value.sourceTimestamp();
+    case ServerTimestampRole:
+        return tag.value.serverTimestamp();
+    default:
+        return QVariant();
+    }
+}
+
+/*!
+    \reimp
+*/
+QHash<int, QByteArray> QOpcUaTagModel::roleNames() const
+{
+    QHash<int, QByteArray> names = QAbstractListModel::roleNames();
+    names.insert(NodeIdRole, QByteArrayLiteral("nodeId"));
+    names.insert(ValueRole, QByteArrayLiteral("value"));
+    names.insert(StatusCodeRole, QByteArrayLiteral("statusCode"));
+    names.insert(SourceTimestampRole, QByteArrayLiteral("sourceTimestamp"));
+    names.insert(ServerTimestampRole, QByteArrayLiteral("serverTimestamp"));
+    return names;
+}
+
+QT_END_NAMESPACE
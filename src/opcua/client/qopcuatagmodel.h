@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUATAGMODEL_H
+#define QOPCUATAGMODEL_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClient;
+class QOpcUaTagModelPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaTagModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QStringList nodeIds READ nodeIds WRITE setNodeIds NOTIFY nodeIdsChanged)
+    Q_PROPERTY(int count READ rowCount NOTIFY nodeIdsChanged)
+    Q_DECLARE_PRIVATE(QOpcUaTagModel)
+
+public:
+    enum Roles {
+        NodeIdRole = Qt::UserRole + 1,
+        ValueRole,
+        StatusCodeRole,
+        SourceTimestampRole,
+        ServerTimestampRole
+    };
+    Q_ENUM(Roles)
+
+    explicit QOpcUaTagModel(QObject *parent = nullptr);
+    ~QOpcUaTagModel();
+
+    QOpcUaClient *client() const;
+    void setClient(QOpcUaClient *client);
+
+    QStringList nodeIds() const;
+    void setNodeIds(const QStringList &nodeIds);
+
+    QOpcUaMonitoringParameters monitoringParameters() const;
+    void setMonitoringParameters(const QOpcUaMonitoringParameters &parameters);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+Q_SIGNALS:
+    void clientChanged();
+    void nodeIdsChanged();
+
+private:
+    Q_DISABLE_COPY(QOpcUaTagModel)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATAGMODEL_H
@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUATAGMODEL_P_H
+#define QOPCUATAGMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuadatavalue.h>
+#include <QtOpcUa/qopcuatagmodel.h>
+
+#include <QtCore/qbitarray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qvector.h>
+#include <private/qabstractitemmodel_p.h>
+#include <private/qopcuaclientimpl_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QTimer;
+
+class Q_OPCUA_EXPORT QOpcUaTagModelPrivate : public QAbstractItemModelPrivate, public QOpcUaMonitoredItemReceiver
+{
+    Q_DECLARE_PUBLIC(QOpcUaTagModel)
+
+public:
+    struct Tag {
+        QString nodeId;
+        QOpcUaDataValue value;
+        // The handle of the monitored item registered with the client, 0 if there is none
+        quint64 handle = 0;
+    };
+
+    QOpcUaTagModelPrivate();
+
+    static QOpcUaTagModelPrivate *get(QOpcUaTagModel *model) { return model->d_func(); }
+
+    void init();
+
+    QOpcUaClientImpl *clientImpl() const;
+    void createMonitoredItems();
+    void releaseMonitoredItems();
+    void handleStateChanged(QOpcUaClient::ClientState state);
+
+    void updateValue(int row, const QOpcUaDataValue &value);
+    void updateStatusCode(int row, QOpcUa::UaStatusCode statusCode);
+    void markChanged(int row);
+    void flushChanges();
+
+    void monitoredItemDataChanged(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaDataValue &value) override;
+    void monitoredItemEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe,
+                                    const QOpcUaMonitoringParameters &status) override;
+
+    QPointer<QOpcUaClient> m_client;
+    QMetaObject::Connection m_stateConnection;
+    QOpcUaMonitoringParameters m_parameters;
+
+    // One entry per row, the values are updated in place
+    QVector<Tag> m_tags;
+    // The row of each registered handle
+    QHash<quint64, int> m_rows;
+
+    // Rows changed since the last flush, each row is contained at most once
+    QVector<int> m_changedRows;
+    QBitArray m_rowChanged;
+    QTimer *m_flushTimer = nullptr;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaTagModelPrivate::Tag, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATAGMODEL_P_H
@@ -35,11 +35,14 @@
 ****************************************************************************/
 
 #include "qopcuatype.h"
+#include "qopcuanodeids_p.h"
 
 #include <QMetaEnum>
 #include <QRegularExpression>
 #include <QUuid>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -715,7 +718,7 @@ bool QOpcUa::nodeIdEquals(const QString &first, const QString &second)
 */
 QString QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0 id)
 {
-    return QStringLiteral("ns=0;i=%1").arg(quint32(id));
+    return QLatin1String("ns=0;i=") + QString::number(quint32(id));
 }
 
 /*!
@@ -745,13 +748,43 @@ QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromNodeId(const QString &nodeId
         return QOpcUa::NodeIds::Namespace0::Unknown;
 
 #ifndef QT_OPCUA_NO_NS0IDNAMES
-    if (!QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(identifier))
+    if (identifier > QOpcUaNodeIdsPrivate::namespace0MaxId || !QOpcUaNodeIdsPrivate::namespace0IdIndices[identifier])
         return QOpcUa::NodeIds::Namespace0::Unknown;
 #endif
 
     return QOpcUa::NodeIds::Namespace0(identifier);
 }
 
+/*!
+    \since QtOpcUa 5.15
+
+    Returns the enum value from \l QOpcUa::NodeIds::Namespace0 for the name \a name
+    from the OPC Foundation's NodeIds.csv file.
+
+    If \a name is unknown or Qt OPC UA has been configured with -no-feature-ns0idnames,
+    \l {QOpcUa::NodeIds::Namespace0} {Unknown} is returned.
+
+    \sa namespace0IdName()
+*/
+QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromName(const QString &name)
+{
+#ifdef QT_OPCUA_NO_NS0IDNAMES
+    Q_UNUSED(name);
+    return QOpcUa::NodeIds::Namespace0::Unknown;
+#else
+    const auto begin = QOpcUaNodeIdsPrivate::namespace0NameOrder;
+    const auto end = begin + QOpcUaNodeIdsPrivate::namespace0NameCount;
+    const auto it = std::lower_bound(begin, end, name, [](quint16 index, const QString &value) {
+        return value.compare(QLatin1String(QOpcUaNodeIdsPrivate::namespace0Names[index].name)) > 0;
+    });
+
+    if (it == end || name != QLatin1String(QOpcUaNodeIdsPrivate::namespace0Names[*it].name))
+        return QOpcUa::NodeIds::Namespace0::Unknown;
+
+    return QOpcUa::NodeIds::Namespace0(QOpcUaNodeIdsPrivate::namespace0Names[*it].id);
+#endif
+}
+
 /*!
     Returns the name of the namespace 0 node id \a id.
 
@@ -764,9 +797,13 @@ QString QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0 id)
     Q_UNUSED(id);
     return QString();
 #else
-    if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+    const quint32 identifier = quint32(id);
+    if (identifier > QOpcUaNodeIdsPrivate::namespace0MaxId)
+        return QString();
+    const quint16 index = QOpcUaNodeIdsPrivate::namespace0IdIndices[identifier];
+    if (!index)
         return QString();
-    return QString::fromUtf8(QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(quint32(id)));
+    return QString::fromLatin1(QOpcUaNodeIdsPrivate::namespace0Names[index - 1].name);
 #endif
 }
 
@@ -41,6 +41,7 @@
 #include <QtOpcUa/qopcuatype.h>
 #include <QtOpcUa/qopcuaapplicationidentity.h>
 #include <QtOpcUa/qopcuapkiconfiguration.h>
+#include <private/qopcuamethodcallitem_p.h>
 #include <private/qopcuanodeimpl_p.h>
 #include <QtOpcUa/qopcuaqualifiedname.h>
 #include <QtOpcUa/qopcuarange.h>
@@ -55,6 +56,7 @@
 #include <QtOpcUa/qopcuaexpandednodeid.h>
 #include <QtOpcUa/qopcuarelativepathelement.h>
 #include <QtOpcUa/qopcuabrowsepathtarget.h>
+#include <QtOpcUa/qopcuabrowseresult.h>
 
 #include <private/qfactoryloader_p.h>
 #include <QtCore/qjsonarray.h>
@@ -154,6 +156,9 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameter>();
     qRegisterMetaType<QOpcUaMonitoringParameters::Parameters>();
     qRegisterMetaType<QOpcUaMonitoringParameters>();
+    qRegisterMetaType<QOpcUaMonitoringParameters::ClientSideFilter>();
+    qRegisterMetaType<QVector<quint32>>("QVector<quint32>");
+    qRegisterMetaType<QVector<quint64>>("QVector<quint64>");
     qRegisterMetaType<QOpcUaReferenceDescription>();
     qRegisterMetaType<QVector<QOpcUaReferenceDescription>>();
     qRegisterMetaType<QOpcUa::ReferenceTypeId>();
@@ -173,6 +178,7 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaArgument>();
     qRegisterMetaType<QOpcUaExtensionObject>();
     qRegisterMetaType<QOpcUaBrowseRequest>();
+    qRegisterMetaType<QOpcUaBrowseResult>();
     qRegisterMetaType<QOpcUaReadItem>();
     qRegisterMetaType<QOpcUaReadResult>();
     qRegisterMetaType<QVector<QOpcUaReadItem>>();
@@ -185,6 +191,21 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaAddNodeItem>();
     qRegisterMetaType<QOpcUaAddReferenceItem>();
     qRegisterMetaType<QOpcUaDeleteReferenceItem>();
+    qRegisterMetaType<QVector<QOpcUaAddNodeItem>>();
+    qRegisterMetaType<QVector<QOpcUaAddReferenceItem>>();
+    qRegisterMetaType<QVector<QOpcUaDeleteReferenceItem>>();
+    qRegisterMetaType<QVector<QOpcUa::UaStatusCode>>();
+    qRegisterMetaType<QOpcUaDataValue>();
+    qRegisterMetaType<QOpcUaEventRecord>();
+    qRegisterMetaType<QOpcUaMethodCallItem>();
+    qRegisterMetaType<QVector<QOpcUaMethodCallItem>>("QVector<QOpcUaMethodCallItem>");
+    qRegisterMetaType<QVector<QOpcUaEventRecord>>();
+    qRegisterMetaType<QOpcUaHistoryData>();
+    qRegisterMetaType<QOpcUaHistoryReadItem>();
+    qRegisterMetaType<QVector<QOpcUaHistoryData>>();
+    qRegisterMetaType<QVector<QOpcUaHistoryReadItem>>();
+    qRegisterMetaType<QOpcUaProcessedHistoryData>();
+    qRegisterMetaType<QVector<QOpcUaProcessedHistoryData>>();
     qRegisterMetaType<QVector<QOpcUaApplicationDescription>>();
     qRegisterMetaType<QOpcUaApplicationIdentity>();
     qRegisterMetaType<QOpcUaPkiConfiguration>();
@@ -234,6 +255,33 @@ static QOpcUaPlugin *loadPlugin(const QString &key)
         \li Unified Automation
         \li Tells the backend to print additional output to the terminal. The backend specific logging
             level is set to \c OPCUA_TRACE_OUTPUT_LEVEL_ALL.
+    \row
+        \li enableStringInterning
+        \li open62541
+        \li Makes repeated strings in browse and read results like browse names, locales and node ids share
+            their data. This reduces the memory use of applications which cache large parts of the address
+            space at the cost of a hash lookup for each converted string. This setting is available since QtOpcUa 5.15.
+    \row
+        \li maximumItemsPerSubscription
+        \li open62541, Unified Automation
+        \li Limits the number of monitored items in a shared subscription. If all shared subscriptions with the
+            requested publishing interval are full, the backend creates an additional subscription. New monitored items
+            are added to the subscription with the fewest items. This keeps the size of publish responses bounded for
+            applications monitoring a large number of nodes. The default value \c 0 disables the limit.
+            This setting is available since QtOpcUa 5.15.
+    \row
+        \li outstandingPublishRequests
+        \li open62541
+        \li The number of publish requests the client keeps outstanding at the server. More outstanding requests
+            allow the server to send several publish responses per round trip, which increases the notification
+            throughput on links with high latency. The default value \c 0 keeps the default of open62541 which is 10.
+            This setting is available since QtOpcUa 5.15.
+    \row
+        \li adaptivePublishRequests
+        \li open62541
+        \li Adapts the number of outstanding publish requests to the number of subscriptions, their publishing
+            intervals and the measured round trip time of service calls. The value of \c outstandingPublishRequests
+            or the default of open62541 is used as upper limit. This setting is available since QtOpcUa 5.15.
     \endtable
 */
 QOpcUaClient *QOpcUaProvider::createClient(const QString &backend, const QVariantMap &backendProperties)
@@ -16,6 +16,7 @@ qtConfig(open62541):!qtConfig(system-open62541) {
 HEADERS += \
     qopen62541backend.h \
     qopen62541client.h \
+    qopen62541historytypes.h \
     qopen62541node.h \
     qopen62541plugin.h \
     qopen62541subscription.h \
@@ -26,6 +27,7 @@ HEADERS += \
 SOURCES += \
     qopen62541backend.cpp \
     qopen62541client.cpp \
+    qopen62541historytypes.cpp \
     qopen62541node.cpp \
     qopen62541plugin.cpp \
     qopen62541subscription.cpp \
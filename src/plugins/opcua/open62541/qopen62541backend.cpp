@@ -35,19 +35,26 @@
 ****************************************************************************/
 
 #include "qopen62541backend.h"
+#include "qopen62541historytypes.h"
 #include "qopen62541node.h"
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
+#include <private/qopcuabrowseresult_p.h>
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuastringpool_p.h>
 
 #include "qopcuaauthenticationinformation.h"
 #include <qopcuaerrorstate.h>
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qmath.h>
 #include <QtCore/qstringlist.h>
 #include <QtCore/qurl.h>
+#include <QtCore/quuid.h>
+
 
 QT_BEGIN_NAMESPACE
 
@@ -60,7 +67,14 @@ Open62541AsyncBackend::Open62541AsyncBackend(QOpen62541Client *parent)
     , m_useStateCallback(false)
     , m_subscriptionTimer(this)
     , m_sendPublishRequests(false)
+    , m_maximumItemsPerSubscription(0)
+    , m_outstandingPublishRequests(0)
+    , m_adaptivePublishRequests(false)
     , m_minPublishingInterval(0)
+    , m_roundTripTime(0)
+    , m_publishRequestLimit(0)
+    , m_publishRequestCount(0)
+    , m_historyReadHandle(0)
 {
     m_subscriptionTimer.setSingleShot(true);
     QObject::connect(&m_subscriptionTimer, &QTimer::timeout,
@@ -70,6 +84,7 @@ Open62541AsyncBackend::Open62541AsyncBackend(QOpen62541Client *parent)
 Open62541AsyncBackend::~Open62541AsyncBackend()
 {
     cleanupSubscriptions();
+    qDeleteAll(m_historyReads);
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
 }
@@ -103,7 +118,10 @@ void Open62541AsyncBackend::readAttributes(quint64 handle, UA_NodeId id, QOpcUa:
     req.nodesToReadSize = valueIds.size();
     req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
 
+    QElapsedTimer roundTripTimer;
+    roundTripTimer.start();
     res = UA_Client_Service_read(m_uaclient, req);
+    updateRoundTripTime(roundTripTimer.elapsed());
 
     UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
 
@@ -119,7 +137,7 @@ void Open62541AsyncBackend::readAttributes(quint64 handle, UA_NodeId id, QOpcUa:
         else
             vec[i].setStatusCode(QOpcUa::UaStatusCode::Good);
         if (res.results[i].hasValue && res.results[i].value.data)
-                vec[i].setValue(QOpen62541ValueConverter::toQVariant(res.results[i].value));
+                vec[i].setValue(QOpen62541ValueConverter::moveToQVariant(&res.results[i].value));
         if (res.results[i].hasServerTimestamp)
             vec[i].setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&res.results[i].sourceTimestamp));
         if (res.results[i].hasSourceTimestamp)
@@ -211,7 +229,7 @@ void Open62541AsyncBackend::enableMonitoring(quint64 handle, UA_NodeId id, QOpcU
         }
         usedSubscription = sub.value(); // Ignore interval != subscription.interval
     } else {
-        usedSubscription = getSubscription(settings);
+        usedSubscription = getSubscription(settings, static_cast<int>(qPopulationCount(static_cast<quint32>(attr))));
     }
 
     if (!usedSubscription) {
@@ -257,6 +275,21 @@ void Open62541AsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttrib
     modifyPublishRequests();
 }
 
+void Open62541AsyncBackend::disableMonitoredItems(QVector<quint64> handles, QOpcUa::NodeAttribute attr)
+{
+    // The publish requests are adjusted once for all items
+    for (const quint64 handle : qAsConst(handles)) {
+        QOpen62541Subscription *sub = getSubscriptionForItem(handle, attr);
+        if (!sub)
+            continue;
+        sub->removeAttributeMonitoredItem(handle, attr);
+        m_attributeMapping[handle].remove(attr);
+        if (sub->monitoredItemsCount() == 0)
+            removeSubscription(sub->subscriptionId());
+    }
+    modifyPublishRequests();
+}
+
 void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QOpen62541Subscription *subscription = getSubscriptionForItem(handle, attr);
@@ -272,15 +305,134 @@ void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribu
     modifyPublishRequests();
 }
 
-QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings)
+void Open62541AsyncBackend::modifyMonitoredItems(QVector<quint64> handles, QOpcUa::NodeAttribute attr,
+                                                 QOpcUaMonitoringParameters::Parameter item, QVariant value)
+{
+    // Group the items by subscription to send one request per subscription
+    QHash<QOpen62541Subscription *, QVector<quint64>> itemsPerSubscription;
+    for (const quint64 handle : qAsConst(handles)) {
+        QOpen62541Subscription *subscription = getSubscriptionForItem(handle, attr);
+        if (subscription) {
+            itemsPerSubscription[subscription].append(handle);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << ", the monitored item does not exist";
+            QOpcUaMonitoringParameters p;
+            p.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            emit monitoringStatusChanged(handle, attr, item, p);
+        }
+    }
+
+    for (auto it = itemsPerSubscription.constBegin(); it != itemsPerSubscription.constEnd(); ++it)
+        it.key()->modifyMonitoring(it.value(), attr, item, value);
+
+    modifyPublishRequests();
+}
+
+void Open62541AsyncBackend::enableMonitoredItems(QVector<quint64> handles, QStringList nodeIds, QOpcUa::NodeAttribute attr,
+                                                 const QOpcUaMonitoringParameters &settings)
+{
+    // Event monitored items need a layout per item, they are created one by one
+    if (attr == QOpcUa::NodeAttribute::EventNotifier) {
+        for (int i = 0; i < handles.size(); ++i)
+            enableMonitoring(handles.at(i), Open62541Utils::nodeIdFromQString(nodeIds.at(i)), attr, settings);
+        return;
+    }
+
+    QVector<quint64> pendingHandles;
+    QVector<UA_NodeId> pendingIds;
+    pendingHandles.reserve(handles.size());
+    pendingIds.reserve(handles.size());
+    for (int i = 0; i < handles.size(); ++i) {
+        if (getSubscriptionForItem(handles.at(i), attr)) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Monitored item for" << attr << "has already been created";
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadEntryExists);
+            emit monitoringEnableDisable(handles.at(i), attr, true, s);
+        } else {
+            pendingHandles.append(handles.at(i));
+            pendingIds.append(Open62541Utils::nodeIdFromQString(nodeIds.at(i)));
+        }
+    }
+
+    const auto emitFailure = [this, attr](const QVector<quint64> &failedHandles, QOpcUa::UaStatusCode statusCode) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(statusCode);
+        for (const quint64 handle : failedHandles)
+            emit monitoringEnableDisable(handle, attr, true, s);
+    };
+
+    QOpen62541Subscription *fixedSubscription = nullptr;
+    if (settings.subscriptionId()) {
+        auto sub = m_subscriptions.find(settings.subscriptionId());
+        if (sub == m_subscriptions.end()) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no subscription with id" << settings.subscriptionId();
+            emitFailure(pendingHandles, QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
+            pendingHandles.clear();
+        } else {
+            fixedSubscription = sub.value();
+        }
+    }
+
+    // One CreateMonitoredItems request per chunk, a chunk never exceeds the item limit of a subscription
+    int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXMONITOREDITEMSPERCALL, pendingHandles.size());
+    if (!fixedSubscription && m_maximumItemsPerSubscription > 0)
+        maxItems = qMin(maxItems, m_maximumItemsPerSubscription);
+
+    for (int offset = 0; offset < pendingHandles.size(); offset += maxItems) {
+        const int count = qMin(maxItems, pendingHandles.size() - offset);
+        const QVector<quint64> chunkHandles = pendingHandles.mid(offset, count);
+
+        QOpen62541Subscription *usedSubscription = fixedSubscription ? fixedSubscription : getSubscription(settings, count);
+        if (!usedSubscription) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << settings.publishingInterval();
+            emitFailure(chunkHandles, QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
+            continue;
+        }
+
+        const QVector<quint64> added = usedSubscription->addAttributeMonitoredItems(chunkHandles, attr, pendingIds.mid(offset, count), settings);
+        for (const quint64 handle : added)
+            m_attributeMapping[handle][attr] = usedSubscription;
+
+        if (usedSubscription->monitoredItemsCount() == 0)
+            removeSubscription(usedSubscription->subscriptionId()); // No items were added
+    }
+
+    for (UA_NodeId &id : pendingIds)
+        UA_NodeId_deleteMembers(&id);
+
+    modifyPublishRequests();
+}
+
+void Open62541AsyncBackend::setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove)
+{
+    QOpen62541Subscription *subscription = getSubscriptionForItem(handle, attr);
+    if (!subscription) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not set triggering for" << attr << ", the monitored item does not exist";
+        emit setTriggeringFinished(handle, attr, linksToAdd, linksToRemove, QVector<QOpcUa::UaStatusCode>(),
+                                   QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+        return;
+    }
+
+    subscription->setTriggering(handle, attr, linksToAdd, linksToRemove);
+}
+
+QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount)
 {
     if (settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Shared) {
         // Requesting multiple subscriptions with publishing interval < minimum publishing interval breaks subscription sharing
         double interval = revisePublishingInterval(settings.publishingInterval(), m_minPublishingInterval);
+        QOpen62541Subscription *leastLoaded = nullptr;
         for (auto entry : qAsConst(m_subscriptions)) {
-            if (qFuzzyCompare(entry->interval(), interval) && entry->shared() == QOpcUaMonitoringParameters::SubscriptionType::Shared)
-                return entry;
+            if (!qFuzzyCompare(entry->interval(), interval) || entry->shared() != QOpcUaMonitoringParameters::SubscriptionType::Shared)
+                continue;
+            // Full subscriptions are skipped, a new subscription is created if all of them are full
+            if (m_maximumItemsPerSubscription > 0 && entry->monitoredItemsCount() + itemCount > m_maximumItemsPerSubscription)
+                continue;
+            if (!leastLoaded || entry->monitoredItemsCount() < leastLoaded->monitoredItemsCount())
+                leastLoaded = entry;
         }
+        if (leastLoaded)
+            return leastLoaded;
     }
 
     QOpen62541Subscription *sub = new QOpen62541Subscription(this, settings);
@@ -347,6 +499,53 @@ void Open62541AsyncBackend::callMethod(quint64 handle, UA_NodeId objectId, UA_No
     emit methodCallFinished(handle, Open62541Utils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(res));
 }
 
+void Open62541AsyncBackend::callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls)
+{
+    if (calls.isEmpty()) {
+        emit callMethodsFinished(requestId, QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    UA_CallRequest req;
+    UA_CallRequest_init(&req);
+    UaDeleter<UA_CallRequest> requestDeleter(&req, UA_CallRequest_deleteMembers);
+
+    req.methodsToCallSize = calls.size();
+    req.methodsToCall = static_cast<UA_CallMethodRequest *>(UA_Array_new(calls.size(), &UA_TYPES[UA_TYPES_CALLMETHODREQUEST]));
+
+    for (int i = 0; i < calls.size(); ++i) {
+        const QOpcUaMethodCallItem &call = calls.at(i);
+        UA_CallMethodRequest &method = req.methodsToCall[i];
+        method.objectId = Open62541Utils::nodeIdFromQString(call.objectId);
+        method.methodId = Open62541Utils::nodeIdFromQString(call.methodId);
+        if (call.inputArguments.isEmpty())
+            continue;
+        method.inputArgumentsSize = call.inputArguments.size();
+        method.inputArguments = static_cast<UA_Variant *>(UA_Array_new(call.inputArguments.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+        for (int j = 0; j < call.inputArguments.size(); ++j)
+            method.inputArguments[j] = QOpen62541ValueConverter::toOpen62541Variant(call.inputArguments.at(j).first,
+                                                                                   call.inputArguments.at(j).second);
+    }
+
+    UA_CallResponse res = UA_Client_Service_call(m_uaclient, req);
+    UaDeleter<UA_CallResponse> responseDeleter(&res, UA_CallResponse_deleteMembers);
+
+    const QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+    QVector<QOpcUa::UaStatusCode> results;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch method call failed:" << serviceResult;
+    } else {
+        results.reserve(calls.size());
+        for (int i = 0; i < calls.size(); ++i) {
+            results.push_back(static_cast<size_t>(i) < res.resultsSize ? static_cast<QOpcUa::UaStatusCode>(res.results[i].statusCode)
+                                                                       : QOpcUa::UaStatusCode::BadInternalError);
+        }
+    }
+
+    emit callMethodsFinished(requestId, results, serviceResult);
+}
+
 void Open62541AsyncBackend::resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUaRelativePathElement> &path)
 {
     UA_TranslateBrowsePathsToNodeIdsRequest req;
@@ -570,27 +769,7 @@ void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
     UaDeleter<UA_AddNodesRequest> requestDeleter(&req, UA_AddNodesRequest_deleteMembers);
     req.nodesToAddSize = 1;
     req.nodesToAdd = UA_AddNodesItem_new();
-    UA_AddNodesItem_init(req.nodesToAdd);
-
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                nodeToAdd.parentNodeId(), &req.nodesToAdd->parentNodeId);
-
-    req.nodesToAdd->referenceTypeId = Open62541Utils::nodeIdFromQString(nodeToAdd.referenceTypeId());
-
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                nodeToAdd.requestedNewNodeId(), &req.nodesToAdd->requestedNewNodeId);
-
-    QOpen62541ValueConverter::scalarFromQt<UA_QualifiedName, QOpcUaQualifiedName>(
-                nodeToAdd.browseName(), &req.nodesToAdd->browseName);
-
-    req.nodesToAdd->nodeClass = static_cast<UA_NodeClass>(nodeToAdd.nodeClass());
-
-    req.nodesToAdd->nodeAttributes = assembleNodeAttributes(nodeToAdd.nodeAttributes(),
-                                                            nodeToAdd.nodeClass());
-
-    if (!nodeToAdd.typeDefinition().nodeId().isEmpty())
-        QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                    nodeToAdd.typeDefinition(), &req.nodesToAdd->typeDefinition);
+    assembleAddNodesItem(nodeToAdd, req.nodesToAdd);
 
     UA_AddNodesResponse res = UA_Client_Service_addNodes(m_uaclient, req);
     UaDeleter<UA_AddNodesResponse> responseDeleter(&res, UA_AddNodesResponse_deleteMembers);
@@ -683,21 +862,552 @@ void Open62541AsyncBackend::deleteReference(const QOpcUaDeleteReferenceItem &ref
                                  referenceToDelete.isForwardReference(), statusCode);
 }
 
-static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
+void Open62541AsyncBackend::addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd)
+{
+    if (nodesToAdd.isEmpty()) {
+        emit addNodesFinished(nodesToAdd, QStringList(), QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    QStringList assignedNodeIds;
+    assignedNodeIds.reserve(nodesToAdd.size());
+    QVector<QOpcUa::UaStatusCode> results;
+    results.reserve(nodesToAdd.size());
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERNODEMANAGEMENT, nodesToAdd.size());
+
+    for (int offset = 0; offset < nodesToAdd.size(); offset += maxItems) {
+        const int count = qMin(maxItems, nodesToAdd.size() - offset);
+
+        UA_AddNodesRequest req;
+        UA_AddNodesRequest_init(&req);
+        UaDeleter<UA_AddNodesRequest> requestDeleter(&req, UA_AddNodesRequest_deleteMembers);
+        req.nodesToAddSize = count;
+        req.nodesToAdd = static_cast<UA_AddNodesItem *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_ADDNODESITEM]));
+
+        for (int i = 0; i < count; ++i)
+            assembleAddNodesItem(nodesToAdd.at(offset + i), &req.nodesToAdd[i]);
+
+        UA_AddNodesResponse res = UA_Client_Service_addNodes(m_uaclient, req);
+        UaDeleter<UA_AddNodesResponse> responseDeleter(&res, UA_AddNodesResponse_deleteMembers);
+
+        const QOpcUa::UaStatusCode chunkResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        if (chunkResult != QOpcUa::UaStatusCode::Good) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add nodes:" << chunkResult;
+            serviceResult = chunkResult;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (chunkResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res.resultsSize) {
+                results.push_back(static_cast<QOpcUa::UaStatusCode>(res.results[i].statusCode));
+                assignedNodeIds.push_back(res.results[i].statusCode == UA_STATUSCODE_GOOD ?
+                                              Open62541Utils::nodeIdToQString(res.results[i].addedNodeId) : QString());
+            } else {
+                results.push_back(chunkResult == QOpcUa::UaStatusCode::Good ? QOpcUa::UaStatusCode::BadUnexpectedError : chunkResult);
+                assignedNodeIds.push_back(QString());
+            }
+        }
+    }
+
+    emit addNodesFinished(nodesToAdd, assignedNodeIds, results, serviceResult);
+}
+
+void Open62541AsyncBackend::deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences)
+{
+    if (nodeIds.isEmpty()) {
+        emit deleteNodesFinished(nodeIds, QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    QVector<QOpcUa::UaStatusCode> results;
+    results.reserve(nodeIds.size());
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERNODEMANAGEMENT, nodeIds.size());
+
+    for (int offset = 0; offset < nodeIds.size(); offset += maxItems) {
+        const int count = qMin(maxItems, nodeIds.size() - offset);
+
+        UA_DeleteNodesRequest req;
+        UA_DeleteNodesRequest_init(&req);
+        UaDeleter<UA_DeleteNodesRequest> requestDeleter(&req, UA_DeleteNodesRequest_deleteMembers);
+        req.nodesToDeleteSize = count;
+        req.nodesToDelete = static_cast<UA_DeleteNodesItem *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_DELETENODESITEM]));
+
+        for (int i = 0; i < count; ++i) {
+            req.nodesToDelete[i].nodeId = Open62541Utils::nodeIdFromQString(nodeIds.at(offset + i));
+            req.nodesToDelete[i].deleteTargetReferences = deleteTargetReferences;
+        }
+
+        UA_DeleteNodesResponse res = UA_Client_Service_deleteNodes(m_uaclient, req);
+        UaDeleter<UA_DeleteNodesResponse> responseDeleter(&res, UA_DeleteNodesResponse_deleteMembers);
+
+        const QOpcUa::UaStatusCode chunkResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        if (chunkResult != QOpcUa::UaStatusCode::Good) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete nodes:" << chunkResult;
+            serviceResult = chunkResult;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (chunkResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res.resultsSize)
+                results.push_back(static_cast<QOpcUa::UaStatusCode>(res.results[i]));
+            else
+                results.push_back(chunkResult == QOpcUa::UaStatusCode::Good ? QOpcUa::UaStatusCode::BadUnexpectedError : chunkResult);
+        }
+    }
+
+    emit deleteNodesFinished(nodeIds, results, serviceResult);
+}
+
+void Open62541AsyncBackend::addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd)
+{
+    if (referencesToAdd.isEmpty()) {
+        emit addReferencesFinished(referencesToAdd, QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    QVector<QOpcUa::UaStatusCode> results;
+    results.reserve(referencesToAdd.size());
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERNODEMANAGEMENT, referencesToAdd.size());
+
+    for (int offset = 0; offset < referencesToAdd.size(); offset += maxItems) {
+        const int count = qMin(maxItems, referencesToAdd.size() - offset);
+
+        UA_AddReferencesRequest req;
+        UA_AddReferencesRequest_init(&req);
+        UaDeleter<UA_AddReferencesRequest> requestDeleter(&req, UA_AddReferencesRequest_deleteMembers);
+        req.referencesToAddSize = count;
+        req.referencesToAdd = static_cast<UA_AddReferencesItem *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_ADDREFERENCESITEM]));
+
+        for (int i = 0; i < count; ++i) {
+            const auto &currentItem = referencesToAdd.at(offset + i);
+            auto &currentUaItem = req.referencesToAdd[i];
+            currentUaItem.sourceNodeId = Open62541Utils::nodeIdFromQString(currentItem.sourceNodeId());
+            currentUaItem.referenceTypeId = Open62541Utils::nodeIdFromQString(currentItem.referenceTypeId());
+            currentUaItem.isForward = currentItem.isForwardReference();
+            if (!currentItem.targetServerUri().isEmpty())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.targetServerUri(), &currentUaItem.targetServerUri);
+            QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                        currentItem.targetNodeId(), &currentUaItem.targetNodeId);
+            currentUaItem.targetNodeClass = static_cast<UA_NodeClass>(currentItem.targetNodeClass());
+        }
+
+        UA_AddReferencesResponse res = UA_Client_Service_addReferences(m_uaclient, req);
+        UaDeleter<UA_AddReferencesResponse> responseDeleter(&res, UA_AddReferencesResponse_deleteMembers);
+
+        const QOpcUa::UaStatusCode chunkResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        if (chunkResult != QOpcUa::UaStatusCode::Good) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add references:" << chunkResult;
+            serviceResult = chunkResult;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (chunkResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res.resultsSize)
+                results.push_back(static_cast<QOpcUa::UaStatusCode>(res.results[i]));
+            else
+                results.push_back(chunkResult == QOpcUa::UaStatusCode::Good ? QOpcUa::UaStatusCode::BadUnexpectedError : chunkResult);
+        }
+    }
+
+    emit addReferencesFinished(referencesToAdd, results, serviceResult);
+}
+
+void Open62541AsyncBackend::deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete)
+{
+    if (referencesToDelete.isEmpty()) {
+        emit deleteReferencesFinished(referencesToDelete, QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    QVector<QOpcUa::UaStatusCode> results;
+    results.reserve(referencesToDelete.size());
+    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERNODEMANAGEMENT, referencesToDelete.size());
+
+    for (int offset = 0; offset < referencesToDelete.size(); offset += maxItems) {
+        const int count = qMin(maxItems, referencesToDelete.size() - offset);
+
+        UA_DeleteReferencesRequest req;
+        UA_DeleteReferencesRequest_init(&req);
+        UaDeleter<UA_DeleteReferencesRequest> requestDeleter(&req, UA_DeleteReferencesRequest_deleteMembers);
+        req.referencesToDeleteSize = count;
+        req.referencesToDelete = static_cast<UA_DeleteReferencesItem *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_DELETEREFERENCESITEM]));
+
+        for (int i = 0; i < count; ++i) {
+            const auto &currentItem = referencesToDelete.at(offset + i);
+            auto &currentUaItem = req.referencesToDelete[i];
+            currentUaItem.sourceNodeId = Open62541Utils::nodeIdFromQString(currentItem.sourceNodeId());
+            currentUaItem.referenceTypeId = Open62541Utils::nodeIdFromQString(currentItem.referenceTypeId());
+            currentUaItem.isForward = currentItem.isForwardReference();
+            QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                        currentItem.targetNodeId(), &currentUaItem.targetNodeId);
+            currentUaItem.deleteBidirectional = currentItem.deleteBidirectional();
+        }
+
+        UA_DeleteReferencesResponse res = UA_Client_Service_deleteReferences(m_uaclient, req);
+        UaDeleter<UA_DeleteReferencesResponse> responseDeleter(&res, UA_DeleteReferencesResponse_deleteMembers);
+
+        const QOpcUa::UaStatusCode chunkResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        if (chunkResult != QOpcUa::UaStatusCode::Good) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete references:" << chunkResult;
+            serviceResult = chunkResult;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (chunkResult == QOpcUa::UaStatusCode::Good && static_cast<size_t>(i) < res.resultsSize)
+                results.push_back(static_cast<QOpcUa::UaStatusCode>(res.results[i]));
+            else
+                results.push_back(chunkResult == QOpcUa::UaStatusCode::Good ? QOpcUa::UaStatusCode::BadUnexpectedError : chunkResult);
+        }
+    }
+
+    emit deleteReferencesFinished(referencesToDelete, results, serviceResult);
+}
+
+static void initHistoryReadRequest(const UA_ExtensionObject &details, const QVector<QOpcUaHistoryReadItem> &nodesToRead,
+                                   const QVector<QByteArray> &continuationPoints, const QVector<int> &nodes,
+                                   QOpen62541HistoryTypes::HistoryReadRequest *req)
+{
+    using namespace QOpen62541HistoryTypes;
+
+    UA_ExtensionObject_copy(&details, &req->historyReadDetails);
+    req->timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+
+    // ReadProcessedDetails contains one aggregate per node of the request
+    if (isType(details.content.decoded.type, ReadProcessedDetailsType)) {
+        auto processedDetails = static_cast<ReadProcessedDetails *>(req->historyReadDetails.content.decoded.data);
+        processedDetails->aggregateTypeSize = nodes.size();
+        processedDetails->aggregateType = static_cast<UA_NodeId *>(UA_Array_new(nodes.size(), &UA_TYPES[UA_TYPES_NODEID]));
+        for (int i = 0; i < nodes.size(); ++i)
+            processedDetails->aggregateType[i] = Open62541Utils::nodeIdFromQString(nodesToRead.at(nodes.at(i)).aggregateType());
+    }
+    req->nodesToReadSize = nodes.size();
+    req->nodesToRead = static_cast<HistoryReadValueId *>(UA_Array_new(nodes.size(), &types[HistoryReadValueIdType]));
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        const auto &item = nodesToRead.at(nodes.at(i));
+        req->nodesToRead[i].nodeId = Open62541Utils::nodeIdFromQString(item.nodeId());
+        if (!item.indexRange().isEmpty())
+            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(item.indexRange(), &req->nodesToRead[i].indexRange);
+        const QByteArray &continuationPoint = continuationPoints.at(nodes.at(i));
+        if (!continuationPoint.isEmpty())
+            QOpen62541ValueConverter::scalarFromQt<UA_ByteString, QByteArray>(continuationPoint, &req->nodesToRead[i].continuationPoint);
+    }
+}
+
+void Open62541AsyncBackend::readHistoryRaw(const QVector<QOpcUaHistoryReadItem> &nodesToRead, QDateTime startTime, QDateTime endTime,
+                                           quint32 numValuesPerNode, bool returnBounds, bool isReadModified)
+{
+    if (nodesToRead.isEmpty()) {
+        emit readHistoryDataFinished(nodesToRead, QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    const UA_DataType *detailsType = &QOpen62541HistoryTypes::types[QOpen62541HistoryTypes::ReadRawModifiedDetailsType];
+    auto details = static_cast<QOpen62541HistoryTypes::ReadRawModifiedDetails *>(UA_new(detailsType));
+    details->isReadModified = isReadModified;
+    QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(startTime, &details->startTime);
+    QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(endTime, &details->endTime);
+    details->numValuesPerNode = numValuesPerNode;
+    details->returnBounds = returnBounds;
+
+    startHistoryRead(new HistoryReadState(nodesToRead, details, detailsType));
+}
+
+void Open62541AsyncBackend::readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, QDateTime startTime, QDateTime endTime,
+                                                 double processingInterval)
+{
+    if (nodesToRead.isEmpty()) {
+        emit readHistoryDataFinished(nodesToRead, QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    const UA_DataType *detailsType = &QOpen62541HistoryTypes::types[QOpen62541HistoryTypes::ReadProcessedDetailsType];
+    auto details = static_cast<QOpen62541HistoryTypes::ReadProcessedDetails *>(UA_new(detailsType));
+    QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(startTime, &details->startTime);
+    QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(endTime, &details->endTime);
+    details->processingInterval = processingInterval;
+    details->aggregateConfiguration.useServerCapabilitiesDefaults = true;
+    // The aggregate types are filled in per request in continueHistoryRead()
+
+    startHistoryRead(new HistoryReadState(nodesToRead, details, detailsType));
+}
+
+Open62541AsyncBackend::HistoryReadState::HistoryReadState(const QVector<QOpcUaHistoryReadItem> &items, void *historyReadDetails,
+                                                          const UA_DataType *detailsType)
+    : nodesToRead(items)
+    , continuationPoints(items.size())
+{
+    UA_ExtensionObject_init(&details);
+    details.encoding = UA_EXTENSIONOBJECT_DECODED;
+    details.content.decoded.type = detailsType;
+    details.content.decoded.data = historyReadDetails;
+
+    pendingNodes.reserve(items.size());
+    for (int i = 0; i < items.size(); ++i)
+        pendingNodes.push_back(i);
+}
+
+Open62541AsyncBackend::HistoryReadState::~HistoryReadState()
+{
+    UA_ExtensionObject_deleteMembers(&details);
+}
+
+void Open62541AsyncBackend::startHistoryRead(HistoryReadState *state)
+{
+    const quint64 handle = ++m_historyReadHandle;
+    m_historyReads.insert(handle, state);
+    continueHistoryRead(handle);
+}
+
+/*
+    Sends one HistoryRead request for the next batch of pending nodes and emits the received data.
+    If there are continuation points left, the next request is scheduled via the event loop
+    to allow other operations to be processed in between and to never keep more than
+    one response in memory.
+*/
+void Open62541AsyncBackend::continueHistoryRead(quint64 handle)
+{
+    HistoryReadState *state = m_historyReads.value(handle);
+    if (!state)
+        return;
+
+    if (!m_uaclient) {
+        finishHistoryRead(handle, QOpcUa::UaStatusCode::BadDisconnect);
+        return;
+    }
+
+    using namespace QOpen62541HistoryTypes;
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERHISTORYREADDATA,
+                                   state->pendingNodes.size());
+    const QVector<int> currentNodes = state->pendingNodes.mid(0, maxItems);
+    state->pendingNodes.remove(0, currentNodes.size());
+
+    HistoryReadRequest req;
+    UA_init(&req, &types[HistoryReadRequestType]);
+    UaDeleter<HistoryReadRequest> requestDeleter(&req, [](HistoryReadRequest *value) {
+        UA_deleteMembers(value, &types[HistoryReadRequestType]);
+    });
+    initHistoryReadRequest(state->details, state->nodesToRead, state->continuationPoints, currentNodes, &req);
+
+    const bool isProcessed = isType(state->details.content.decoded.type, ReadProcessedDetailsType);
+
+    HistoryReadResponse res;
+    __UA_Client_Service(m_uaclient, &req, &types[HistoryReadRequestType], &res, &types[HistoryReadResponseType]);
+    UaDeleter<HistoryReadResponse> responseDeleter(&res, [](HistoryReadResponse *value) {
+        UA_deleteMembers(value, &types[HistoryReadResponseType]);
+    });
+
+    const QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "History read failed:" << serviceResult;
+        // The continuation points of the failed chunk and of the nodes still waiting are unused
+        releaseContinuationPoints(state, currentNodes + state->pendingNodes);
+        finishHistoryRead(handle, serviceResult);
+        return;
+    }
+
+    QVector<QOpcUaHistoryData> data;
+    QVector<QOpcUaProcessedHistoryData> processedData;
+    if (isProcessed)
+        processedData.reserve(currentNodes.size());
+    else
+        data.reserve(currentNodes.size());
+
+    for (int i = 0; i < currentNodes.size(); ++i) {
+        const int index = currentNodes.at(i);
+        const QOpcUaHistoryReadItem &item = state->nodesToRead.at(index);
+
+        QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::BadUnexpectedError;
+        const UA_ExtensionObject *historyData = nullptr;
+
+        if (static_cast<size_t>(i) < res.resultsSize) {
+            const HistoryReadResult &result = res.results[i];
+            statusCode = static_cast<QOpcUa::UaStatusCode>(result.statusCode);
+            historyData = &result.historyData;
+
+            if (result.continuationPoint.length) {
+                state->continuationPoints[index] = QOpen62541ValueConverter::scalarToQt<QByteArray, UA_ByteString>(&result.continuationPoint);
+                state->pendingNodes.push_back(index);
+            } else {
+                state->continuationPoints[index].clear();
+            }
+        }
+
+        if (isProcessed) {
+            QOpcUaProcessedHistoryData nodeData(item.nodeId(), item.aggregateType());
+            nodeData.setStatusCode(statusCode);
+            if (historyData)
+                convertProcessedHistoryData(*historyData, nodeData);
+            processedData.push_back(nodeData);
+        } else {
+            QOpcUaHistoryData nodeData(item.nodeId());
+            nodeData.setStatusCode(statusCode);
+            if (historyData)
+                convertHistoryData(*historyData, nodeData);
+            data.push_back(nodeData);
+        }
+    }
+
+    if (isProcessed)
+        emit processedHistoryDataAvailable(processedData);
+    else
+        emit historyDataAvailable(data);
+
+    if (state->pendingNodes.isEmpty())
+        finishHistoryRead(handle, QOpcUa::UaStatusCode::Good);
+    else
+        QMetaObject::invokeMethod(this, [this, handle]() { continueHistoryRead(handle); }, Qt::QueuedConnection);
+}
+
+/*
+    Tells the server to free the continuation points of \a nodes after a history read
+    has been aborted. The server would otherwise keep them until the session is closed.
+*/
+void Open62541AsyncBackend::releaseContinuationPoints(HistoryReadState *state, const QVector<int> &nodes)
+{
+    if (!m_uaclient)
+        return;
+
+    using namespace QOpen62541HistoryTypes;
+
+    QVector<int> nodesWithContinuationPoint;
+    for (const int index : nodes) {
+        if (!state->continuationPoints.at(index).isEmpty())
+            nodesWithContinuationPoint.push_back(index);
+    }
+
+    const int maxItems = chunkSize(UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERHISTORYREADDATA,
+                                   nodesWithContinuationPoint.size());
+
+    for (int processed = 0; processed < nodesWithContinuationPoint.size(); processed += maxItems) {
+        const QVector<int> currentNodes = nodesWithContinuationPoint.mid(processed, maxItems);
+
+        HistoryReadRequest req;
+        UA_init(&req, &types[HistoryReadRequestType]);
+        UaDeleter<HistoryReadRequest> requestDeleter(&req, [](HistoryReadRequest *value) {
+            UA_deleteMembers(value, &types[HistoryReadRequestType]);
+        });
+        initHistoryReadRequest(state->details, state->nodesToRead, state->continuationPoints, currentNodes, &req);
+        req.releaseContinuationPoints = true;
+
+        HistoryReadResponse res;
+        __UA_Client_Service(m_uaclient, &req, &types[HistoryReadRequestType], &res, &types[HistoryReadResponseType]);
+        UaDeleter<HistoryReadResponse> responseDeleter(&res, [](HistoryReadResponse *value) {
+            UA_deleteMembers(value, &types[HistoryReadResponseType]);
+        });
+
+        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to release continuation points:"
+                                                << static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+        }
+    }
+
+    for (const int index : nodesWithContinuationPoint)
+        state->continuationPoints[index].clear();
+}
+
+void Open62541AsyncBackend::finishHistoryRead(quint64 handle, QOpcUa::UaStatusCode serviceResult)
+{
+    HistoryReadState *state = m_historyReads.take(handle);
+    if (!state)
+        return;
+
+    emit readHistoryDataFinished(state->nodesToRead, serviceResult);
+    delete state;
+}
+
+void Open62541AsyncBackend::abortHistoryReads(QOpcUa::UaStatusCode reason)
+{
+    // Continuation points are released by the server when the session is closed
+    const auto handles = m_historyReads.keys();
+    for (const quint64 handle : handles)
+        finishHistoryRead(handle, reason);
+}
+
+static QOpcUaBrowseResultPrivate::NodeId appendBrowseNodeId(QOpcUaBrowseResultPrivate *dst, const UA_NodeId &id)
+{
+    QOpcUaBrowseResultPrivate::NodeId result;
+    result.namespaceIndex = id.namespaceIndex;
+
+    // With string interning, the node id strings share their data with the pool
+    if (QOpcUaStringPool::forCurrentThread())
+        result.pooledString = dst->appendPooledString(Open62541Utils::nodeIdToQString(id));
+
+    switch (id.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        result.identifierType = 'i';
+        result.numericIdentifier = id.identifier.numeric;
+        break;
+    case UA_NODEIDTYPE_STRING:
+        result.identifierType = 's';
+        result.identifier = dst->appendUtf8(reinterpret_cast<const char *>(id.identifier.string.data),
+                                            static_cast<int>(id.identifier.string.length));
+        break;
+    case UA_NODEIDTYPE_GUID: {
+        const UA_Guid &src = id.identifier.guid;
+        const QUuid uuid(src.data1, src.data2, src.data3, src.data4[0], src.data4[1], src.data4[2],
+                src.data4[3], src.data4[4], src.data4[5], src.data4[6], src.data4[7]);
+        const QByteArray temp = uuid.toByteArray(QUuid::WithoutBraces);
+        result.identifierType = 'g';
+        result.identifier = dst->appendLatin1(temp.constData(), temp.size());
+        break;
+    }
+    case UA_NODEIDTYPE_BYTESTRING: {
+        const QByteArray temp = QByteArray::fromRawData(reinterpret_cast<const char *>(id.identifier.byteString.data),
+                                                        static_cast<int>(id.identifier.byteString.length)).toBase64();
+        result.identifierType = 'b';
+        result.identifier = dst->appendLatin1(temp.constData(), temp.size());
+        break;
+    }
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not convert UA_NodeId in browse result";
+        result.identifierType = 0;
+    }
+
+    return result;
+}
+
+static QOpcUaBrowseResultPrivate::ExpandedNodeId appendBrowseExpandedNodeId(QOpcUaBrowseResultPrivate *dst,
+                                                                           const UA_ExpandedNodeId &id)
+{
+    QOpcUaBrowseResultPrivate::ExpandedNodeId result;
+    result.nodeId = appendBrowseNodeId(dst, id.nodeId);
+    result.namespaceUri = dst->appendUtf8(reinterpret_cast<const char *>(id.namespaceUri.data),
+                                          static_cast<int>(id.namespaceUri.length));
+    result.serverIndex = id.serverIndex;
+    return result;
+}
+
+// Fills the columns of the browse result directly to avoid creating a QOpcUaReferenceDescription
+// and several temporary strings for each reference.
+static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QOpcUaBrowseResult &dst)
 {
     if (!src)
         return;
 
+    QOpcUaBrowseResultPrivate *d = dst.data_ptr().data();
+    d->reserve(dst.size() + static_cast<int>(referencesSize));
+
     for (size_t i = 0; i < referencesSize; ++i) {
-        QOpcUaReferenceDescription temp;
-        temp.setTargetNodeId(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].nodeId));
-        temp.setTypeDefinition(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].typeDefinition));
-        temp.setRefTypeId(Open62541Utils::nodeIdToQString(src->references[i].referenceTypeId));
-        temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src->references[i].nodeClass));
-        temp.setBrowseName(QOpen62541ValueConverter::scalarToQt<QOpcUaQualifiedName, UA_QualifiedName>(&src->references[i].browseName));
-        temp.setDisplayName(QOpen62541ValueConverter::scalarToQt<QOpcUaLocalizedText, UA_LocalizedText>(&src->references[i].displayName));
-        temp.setIsForwardReference(src->references[i].isForward);
-        dst.push_back(temp);
+        const UA_ReferenceDescription &ref = src->references[i];
+        d->targetNodeIds.push_back(appendBrowseExpandedNodeId(d, ref.nodeId));
+        d->typeDefinitions.push_back(appendBrowseExpandedNodeId(d, ref.typeDefinition));
+        d->refTypeIds.push_back(appendBrowseNodeId(d, ref.referenceTypeId));
+        d->browseNameNamespaces.push_back(ref.browseName.namespaceIndex);
+        d->browseNames.push_back(d->appendUtf8(reinterpret_cast<const char *>(ref.browseName.name.data),
+                                               static_cast<int>(ref.browseName.name.length)));
+        d->displayNameLocales.push_back(d->appendUtf8(reinterpret_cast<const char *>(ref.displayName.locale.data),
+                                                      static_cast<int>(ref.displayName.locale.length)));
+        d->displayNameTexts.push_back(d->appendUtf8(reinterpret_cast<const char *>(ref.displayName.text.data),
+                                                    static_cast<int>(ref.displayName.text.length)));
+        d->nodeClasses.push_back(static_cast<quint8>(ref.nodeClass));
+        d->isForwardReferences.push_back(ref.isForward);
     }
 }
 
@@ -721,7 +1431,7 @@ void Open62541AsyncBackend::browse(quint64 handle, UA_NodeId id, const QOpcUaBro
     UaDeleter<UA_BrowseResponse> responseDeleter(response, UA_BrowseResponse_delete);
     *response = UA_Client_Service_browse(m_uaclient, uaRequest);
 
-    QVector<QOpcUaReferenceDescription> ret;
+    QOpcUaBrowseResult ret;
 
     QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
 
@@ -770,6 +1480,8 @@ static void clientStateCallback(UA_Client *client, UA_ClientState state)
 void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &endpoint)
 {
     cleanupSubscriptions();
+    abortHistoryReads(QOpcUa::UaStatusCode::BadDisconnect);
+    m_operationLimits.clear();
 
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
@@ -867,8 +1579,15 @@ void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &e
         UA_ClientConfig_setDefault(conf);
     }
 
+    if (m_outstandingPublishRequests > 0)
+        conf->outStandingPublishRequests = static_cast<UA_UInt16>(qMin(m_outstandingPublishRequests, 0xFFFF));
+    m_publishRequestLimit = conf->outStandingPublishRequests;
+    m_publishRequestCount = 0;
+    m_roundTripTime = 0;
+
     conf->clientContext = this;
     conf->stateCallback = &clientStateCallback;
+    conf->customDataTypes = &QOpen62541HistoryTypes::dataTypeArray;
     conf->clientDescription.applicationName = UA_LOCALIZEDTEXT_ALLOC("", identity.applicationName().toUtf8().constData());
     conf->clientDescription.applicationUri  = UA_STRING_ALLOC(identity.applicationUri().toUtf8().constData());
     conf->clientDescription.productUri      = UA_STRING_ALLOC(identity.productUri().toUtf8().constData());
@@ -936,6 +1655,8 @@ void Open62541AsyncBackend::disconnectFromEndpoint()
 {
     m_subscriptionTimer.stop();
     cleanupSubscriptions();
+    abortHistoryReads(QOpcUa::UaStatusCode::BadDisconnect);
+    m_operationLimits.clear();
 
     m_useStateCallback = false;
 
@@ -1038,6 +1759,8 @@ void Open62541AsyncBackend::modifyPublishRequests()
         return;
     }
 
+    updatePublishRequestCount();
+
     m_subscriptionTimer.stop();
     m_sendPublishRequests = true;
     sendPublishRequest();
@@ -1056,6 +1779,35 @@ void Open62541AsyncBackend::handleSubscriptionTimeout(QOpen62541Subscription *su
     modifyPublishRequests();
 }
 
+void Open62541AsyncBackend::updateRoundTripTime(qint64 milliseconds)
+{
+    // Exponential moving average to smooth out single slow service calls
+    m_roundTripTime = m_roundTripTime > 0 ? (7 * m_roundTripTime + milliseconds) / 8 : milliseconds;
+    updatePublishRequestCount();
+}
+
+void Open62541AsyncBackend::updatePublishRequestCount()
+{
+    if (!m_uaclient || !m_adaptivePublishRequests || m_subscriptions.isEmpty())
+        return;
+
+    UA_ClientConfig *conf = UA_Client_getConfig(m_uaclient);
+
+    // open62541 lowers the value if the server rejects publish requests with BadTooManyPublishRequests.
+    // The lowered value is the upper limit from now on.
+    if (m_publishRequestCount && conf->outStandingPublishRequests < m_publishRequestCount)
+        m_publishRequestLimit = qMax<int>(1, conf->outStandingPublishRequests);
+
+    // The server needs a publish request for each subscription in every publishing interval.
+    // After a response has been sent, the next request arrives one round trip later.
+    int requiredRequests = 0;
+    for (const QOpen62541Subscription *subscription : qAsConst(m_subscriptions))
+        requiredRequests += 1 + qCeil(m_roundTripTime / qMax(subscription->interval(), 1.0));
+
+    m_publishRequestCount = static_cast<UA_UInt16>(qBound(1, requiredRequests, m_publishRequestLimit));
+    conf->outStandingPublishRequests = m_publishRequestCount;
+}
+
 QOpen62541Subscription *Open62541AsyncBackend::getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     auto nodeEntry = m_attributeMapping.find(handle);
@@ -1182,6 +1934,59 @@ bool Open62541AsyncBackend::loadAllFilesInDirectory(const QString &location, UA_
     return true;
 }
 
+UA_UInt32 Open62541AsyncBackend::operationLimit(UA_UInt32 limitNodeId)
+{
+    auto it = m_operationLimits.constFind(limitNodeId);
+    if (it != m_operationLimits.constEnd())
+        return it.value();
+
+    UA_Variant value;
+    UA_Variant_init(&value);
+    UaDeleter<UA_Variant> valueDeleter(&value, UA_Variant_deleteMembers);
+
+    UA_UInt32 limit = 0; // 0 means "no limit" in OPC UA
+    UA_StatusCode res = UA_Client_readValueAttribute(m_uaclient, UA_NODEID_NUMERIC(0, limitNodeId), &value);
+    if (res == UA_STATUSCODE_GOOD && UA_Variant_hasScalarType(&value, &UA_TYPES[UA_TYPES_UINT32]))
+        limit = *static_cast<UA_UInt32 *>(value.data);
+    else
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to read operation limit" << limitNodeId << "from the server, assuming no limit";
+
+    m_operationLimits[limitNodeId] = limit;
+    return limit;
+}
+
+int Open62541AsyncBackend::chunkSize(UA_UInt32 limitNodeId, int itemCount)
+{
+    const UA_UInt32 limit = operationLimit(limitNodeId);
+    if (limit == 0 || limit >= static_cast<UA_UInt32>(itemCount))
+        return qMax(itemCount, 1);
+    return static_cast<int>(limit);
+}
+
+void Open62541AsyncBackend::assembleAddNodesItem(const QOpcUaAddNodeItem &nodeToAdd, UA_AddNodesItem *target)
+{
+    UA_AddNodesItem_init(target);
+
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                nodeToAdd.parentNodeId(), &target->parentNodeId);
+
+    target->referenceTypeId = Open62541Utils::nodeIdFromQString(nodeToAdd.referenceTypeId());
+
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                nodeToAdd.requestedNewNodeId(), &target->requestedNewNodeId);
+
+    QOpen62541ValueConverter::scalarFromQt<UA_QualifiedName, QOpcUaQualifiedName>(
+                nodeToAdd.browseName(), &target->browseName);
+
+    target->nodeClass = static_cast<UA_NodeClass>(nodeToAdd.nodeClass());
+
+    target->nodeAttributes = assembleNodeAttributes(nodeToAdd.nodeAttributes(), nodeToAdd.nodeClass());
+
+    if (!nodeToAdd.typeDefinition().nodeId().isEmpty())
+        QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                    nodeToAdd.typeDefinition(), &target->typeDefinition);
+}
+
 UA_ExtensionObject Open62541AsyncBackend::assembleNodeAttributes(const QOpcUaNodeCreationAttributes &nodeAttributes,
                                                                  QOpcUa::NodeClass nodeClass)
 {
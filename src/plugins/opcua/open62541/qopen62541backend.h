@@ -65,7 +65,12 @@ public Q_SLOTS:
     void enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
     void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void modifyMonitoredItems(QVector<quint64> handles, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void enableMonitoredItems(QVector<quint64> handles, QStringList nodeIds, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings);
+    void disableMonitoredItems(QVector<quint64> handles, QOpcUa::NodeAttribute attr);
+    void setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove);
     void callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args);
+    void callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls);
     void resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUaRelativePathElement> &path);
     void findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris);
 
@@ -77,30 +82,66 @@ public Q_SLOTS:
     void deleteNode(const QString &nodeId, bool deleteTargetReferences);
     void addReference(const QOpcUaAddReferenceItem &referenceToAdd);
     void deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete);
+    void addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd);
+    void deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences);
+    void addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd);
+    void deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete);
+
+    // History
+    void readHistoryRaw(const QVector<QOpcUaHistoryReadItem> &nodesToRead, QDateTime startTime, QDateTime endTime,
+                        quint32 numValuesPerNode, bool returnBounds, bool isReadModified);
+    void readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, QDateTime startTime, QDateTime endTime,
+                              double processingInterval);
 
     // Subscription
-    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings);
+    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount);
     bool removeSubscription(UA_UInt32 subscriptionId);
     void sendPublishRequest();
     void modifyPublishRequests();
     void handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
     void cleanupSubscriptions();
+    void updateRoundTripTime(qint64 milliseconds);
 
 public:
     UA_Client *m_uaclient;
     QOpen62541Client *m_clientImpl;
     bool m_useStateCallback;
+    int m_maximumItemsPerSubscription; // 0 means no limit
+    int m_outstandingPublishRequests; // 0 keeps the default of open62541
+    bool m_adaptivePublishRequests;
 
 private:
     QOpen62541Subscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    void updatePublishRequestCount();
     QOpcUaApplicationDescription convertApplicationDescription(UA_ApplicationDescription &desc);
 
+    void assembleAddNodesItem(const QOpcUaAddNodeItem &nodeToAdd, UA_AddNodesItem *target);
     UA_ExtensionObject assembleNodeAttributes(const QOpcUaNodeCreationAttributes &nodeAttributes, QOpcUa::NodeClass nodeClass);
     UA_UInt32 *copyArrayDimensions(const QVector<quint32> &arrayDimensions, size_t *outputSize);
 
     // Helper
     bool loadFileToByteString(const QString &location, UA_ByteString *target) const;
     bool loadAllFilesInDirectory(const QString &location, UA_ByteString **target, int *size) const;
+    UA_UInt32 operationLimit(UA_UInt32 limitNodeId);
+    int chunkSize(UA_UInt32 limitNodeId, int itemCount);
+
+    struct HistoryReadState {
+        HistoryReadState(const QVector<QOpcUaHistoryReadItem> &items, void *historyReadDetails, const UA_DataType *detailsType);
+        ~HistoryReadState();
+
+        QVector<QOpcUaHistoryReadItem> nodesToRead;
+        UA_ExtensionObject details;
+        QVector<QByteArray> continuationPoints; // One entry per node in nodesToRead
+        QVector<int> pendingNodes; // Indices of the nodes which have not been read completely
+
+        Q_DISABLE_COPY(HistoryReadState)
+    };
+
+    void startHistoryRead(HistoryReadState *state);
+    void continueHistoryRead(quint64 handle);
+    void releaseContinuationPoints(HistoryReadState *state, const QVector<int> &nodes);
+    void finishHistoryRead(quint64 handle, QOpcUa::UaStatusCode serviceResult);
+    void abortHistoryReads(QOpcUa::UaStatusCode reason);
 
     QTimer m_subscriptionTimer;
 
@@ -111,6 +152,15 @@ private:
     bool m_sendPublishRequests;
 
     double m_minPublishingInterval;
+
+    double m_roundTripTime; // Smoothed duration of synchronous service calls in milliseconds
+    int m_publishRequestLimit; // Upper limit for the adaptive number of outstanding publish requests
+    UA_UInt16 m_publishRequestCount; // The number of outstanding publish requests last set in the client config
+
+    QHash<UA_UInt32, UA_UInt32> m_operationLimits; // Node id of the OperationLimits variable -> value
+
+    QHash<quint64, HistoryReadState *> m_historyReads;
+    quint64 m_historyReadHandle;
 };
 
 QT_END_NAMESPACE
@@ -41,6 +41,7 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuastringpool_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
@@ -51,13 +52,25 @@ QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
-QOpen62541Client::QOpen62541Client()
+QOpen62541Client::QOpen62541Client(const QVariantMap &backendProperties)
     : QOpcUaClientImpl()
     , m_backend(new Open62541AsyncBackend(this))
 {
+    m_backend->m_maximumItemsPerSubscription = qMax(0, backendProperties.value(QLatin1String("maximumItemsPerSubscription"), 0).toInt());
+    m_backend->m_outstandingPublishRequests = qMax(0, backendProperties.value(QLatin1String("outstandingPublishRequests"), 0).toInt());
+    m_backend->m_adaptivePublishRequests = backendProperties.value(QLatin1String("adaptivePublishRequests"), false).toBool();
+
     m_thread = new QThread();
     connectBackendWithClient(m_backend);
     m_backend->moveToThread(m_thread);
+
+    if (backendProperties.value(QLatin1String("enableStringInterning"), false).toBool()) {
+        // The pool belongs to the backend thread and is deleted when the thread exits
+        connect(m_thread, &QThread::started, m_backend, []() {
+            QOpcUaStringPool::setEnabledForCurrentThread(true);
+        });
+    }
+
     connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
     connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
     m_thread->start();
@@ -86,6 +99,19 @@ QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
     if (UA_NodeId_isNull(&uaNodeId))
         return nullptr;
 
+    return createNode(uaNodeId, nodeId);
+}
+
+QOpcUaNode *QOpen62541Client::node(QOpcUa::NodeIds::Namespace0 id)
+{
+    if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+        return nullptr;
+
+    return createNode(UA_NODEID_NUMERIC(0, static_cast<UA_UInt32>(id)), QOpcUa::namespace0Id(id));
+}
+
+QOpcUaNode *QOpen62541Client::createNode(const UA_NodeId &uaNodeId, const QString &nodeId)
+{
     auto tempNode = new QOpen62541Node(uaNodeId, this, nodeId);
     if (!tempNode->registered()) {
         qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register node with backend, maximum number of nodes reached.";
@@ -150,6 +176,87 @@ bool QOpen62541Client::deleteReference(const QOpcUaDeleteReferenceItem &referenc
                                      Q_ARG(QOpcUaDeleteReferenceItem, referenceToDelete));
 }
 
+bool QOpen62541Client::addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd)
+{
+    return QMetaObject::invokeMethod(m_backend, "addNodes", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaAddNodeItem>, nodesToAdd));
+}
+
+bool QOpen62541Client::deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences)
+{
+    return QMetaObject::invokeMethod(m_backend, "deleteNodes", Qt::QueuedConnection,
+                                     Q_ARG(QStringList, nodeIds),
+                                     Q_ARG(bool, deleteTargetReferences));
+}
+
+bool QOpen62541Client::addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd)
+{
+    return QMetaObject::invokeMethod(m_backend, "addReferences", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaAddReferenceItem>, referencesToAdd));
+}
+
+bool QOpen62541Client::deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete)
+{
+    return QMetaObject::invokeMethod(m_backend, "deleteReferences", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaDeleteReferenceItem>, referencesToDelete));
+}
+
+bool QOpen62541Client::readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                       const QDateTime &endTime, quint32 numValuesPerNode, bool returnBounds, bool isReadModified)
+{
+    return QMetaObject::invokeMethod(m_backend, "readHistoryRaw", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaHistoryReadItem>, nodesToRead),
+                                     Q_ARG(QDateTime, startTime),
+                                     Q_ARG(QDateTime, endTime),
+                                     Q_ARG(quint32, numValuesPerNode),
+                                     Q_ARG(bool, returnBounds),
+                                     Q_ARG(bool, isReadModified));
+}
+
+bool QOpen62541Client::readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                                            const QDateTime &endTime, double processingInterval)
+{
+    return QMetaObject::invokeMethod(m_backend, "readHistoryProcessed", Qt::QueuedConnection,
+                                     Q_ARG(QVector<QOpcUaHistoryReadItem>, nodesToRead),
+                                     Q_ARG(QDateTime, startTime),
+                                     Q_ARG(QDateTime, endTime),
+                                     Q_ARG(double, processingInterval));
+}
+
+bool QOpen62541Client::enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                                        const QOpcUaMonitoringParameters &settings)
+{
+    return QMetaObject::invokeMethod(m_backend, "enableMonitoredItems", Qt::QueuedConnection,
+                                     Q_ARG(QVector<quint64>, handles),
+                                     Q_ARG(QStringList, nodeIds),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters, settings));
+}
+
+bool QOpen62541Client::disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr)
+{
+    return QMetaObject::invokeMethod(m_backend, "disableMonitoredItems", Qt::QueuedConnection,
+                                     Q_ARG(QVector<quint64>, handles),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr));
+}
+
+bool QOpen62541Client::modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                        QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    return QMetaObject::invokeMethod(m_backend, "modifyMonitoredItems", Qt::QueuedConnection,
+                                     Q_ARG(QVector<quint64>, handles),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters::Parameter, item),
+                                     Q_ARG(QVariant, value));
+}
+
+bool QOpen62541Client::callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls)
+{
+    return QMetaObject::invokeMethod(m_backend, "callMethods", Qt::QueuedConnection,
+                                     Q_ARG(quint64, requestId),
+                                     Q_ARG(QVector<QOpcUaMethodCallItem>, calls));
+}
+
 QStringList QOpen62541Client::supportedSecurityPolicies() const
 {
     return QStringList {
@@ -51,13 +51,14 @@ class QOpen62541Client : public QOpcUaClientImpl
     Q_OBJECT
 
 public:
-    explicit QOpen62541Client();
+    explicit QOpen62541Client(const QVariantMap &backendProperties);
     ~QOpen62541Client();
 
     void connectToEndpoint(const QOpcUaEndpointDescription &endpoint) override;
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(QOpcUa::NodeIds::Namespace0 id) override;
 
     QString backend() const override;
 
@@ -74,12 +75,29 @@ public:
     bool addReference(const QOpcUaAddReferenceItem &referenceToAdd) override;
     bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete) override;
 
+    bool addNodes(const QVector<QOpcUaAddNodeItem> &nodesToAdd) override;
+    bool deleteNodes(const QStringList &nodeIds, bool deleteTargetReferences) override;
+    bool addReferences(const QVector<QOpcUaAddReferenceItem> &referencesToAdd) override;
+    bool deleteReferences(const QVector<QOpcUaDeleteReferenceItem> &referencesToDelete) override;
+    bool readHistoryData(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                         const QDateTime &endTime, quint32 numValuesPerNode, bool returnBounds, bool isReadModified) override;
+    bool readHistoryProcessed(const QVector<QOpcUaHistoryReadItem> &nodesToRead, const QDateTime &startTime,
+                              const QDateTime &endTime, double processingInterval) override;
+    bool enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                          const QOpcUaMonitoringParameters &settings) override;
+    bool disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr) override;
+    bool modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                          QOpcUaMonitoringParameters::Parameter item, const QVariant &value) override;
+    bool callMethods(quint64 requestId, const QVector<QOpcUaMethodCallItem> &calls) override;
+
     QStringList supportedSecurityPolicies() const override;
     QVector<QOpcUaUserTokenPolicy::TokenType> supportedUserTokenTypes() const override;
 
 private slots:
 
 private:
+    QOpcUaNode *createNode(const UA_NodeId &uaNodeId, const QString &nodeId);
+
     friend class QOpen62541Node;
     QThread *m_thread;
     Open62541AsyncBackend *m_backend;
@@ -0,0 +1,516 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541historytypes.h"
+#include "qopen62541valueconverter.h"
+
+#include <QtCore/qloggingcategory.h>
+
+#include <cstddef>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
+
+namespace QOpen62541HistoryTypes {
+
+static UA_DataTypeMember ReadRawModifiedDetails_members[5] = {
+{
+    UA_TYPENAME("IsReadModified")
+    UA_TYPES_BOOLEAN,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("StartTime")
+    UA_TYPES_DATETIME,
+    offsetof(ReadRawModifiedDetails, startTime) - offsetof(ReadRawModifiedDetails, isReadModified) - sizeof(UA_Boolean),
+    true,
+    false
+},
+{
+    UA_TYPENAME("EndTime")
+    UA_TYPES_DATETIME,
+    offsetof(ReadRawModifiedDetails, endTime) - offsetof(ReadRawModifiedDetails, startTime) - sizeof(UA_DateTime),
+    true,
+    false
+},
+{
+    UA_TYPENAME("NumValuesPerNode")
+    UA_TYPES_UINT32,
+    offsetof(ReadRawModifiedDetails, numValuesPerNode) - offsetof(ReadRawModifiedDetails, endTime) - sizeof(UA_DateTime),
+    true,
+    false
+},
+{
+    UA_TYPENAME("ReturnBounds")
+    UA_TYPES_BOOLEAN,
+    offsetof(ReadRawModifiedDetails, returnBounds) - offsetof(ReadRawModifiedDetails, numValuesPerNode) - sizeof(UA_UInt32),
+    true,
+    false
+}};
+
+static UA_DataTypeMember ReadProcessedDetails_members[5] = {
+{
+    UA_TYPENAME("StartTime")
+    UA_TYPES_DATETIME,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("EndTime")
+    UA_TYPES_DATETIME,
+    offsetof(ReadProcessedDetails, endTime) - offsetof(ReadProcessedDetails, startTime) - sizeof(UA_DateTime),
+    true,
+    false
+},
+{
+    UA_TYPENAME("ProcessingInterval")
+    UA_TYPES_DOUBLE,
+    offsetof(ReadProcessedDetails, processingInterval) - offsetof(ReadProcessedDetails, endTime) - sizeof(UA_DateTime),
+    true,
+    false
+},
+{
+    UA_TYPENAME("AggregateType")
+    UA_TYPES_NODEID,
+    offsetof(ReadProcessedDetails, aggregateTypeSize) - offsetof(ReadProcessedDetails, processingInterval) - sizeof(UA_Double),
+    true,
+    true
+},
+{
+    UA_TYPENAME("AggregateConfiguration")
+    UA_TYPES_AGGREGATECONFIGURATION,
+    offsetof(ReadProcessedDetails, aggregateConfiguration) - offsetof(ReadProcessedDetails, aggregateType) - sizeof(void *),
+    true,
+    false
+}};
+
+static UA_DataTypeMember HistoryReadValueId_members[4] = {
+{
+    UA_TYPENAME("NodeId")
+    UA_TYPES_NODEID,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("IndexRange")
+    UA_TYPES_STRING,
+    offsetof(HistoryReadValueId, indexRange) - offsetof(HistoryReadValueId, nodeId) - sizeof(UA_NodeId),
+    true,
+    false
+},
+{
+    UA_TYPENAME("DataEncoding")
+    UA_TYPES_QUALIFIEDNAME,
+    offsetof(HistoryReadValueId, dataEncoding) - offsetof(HistoryReadValueId, indexRange) - sizeof(UA_String),
+    true,
+    false
+},
+{
+    UA_TYPENAME("ContinuationPoint")
+    UA_TYPES_BYTESTRING,
+    offsetof(HistoryReadValueId, continuationPoint) - offsetof(HistoryReadValueId, dataEncoding) - sizeof(UA_QualifiedName),
+    true,
+    false
+}};
+
+static UA_DataTypeMember HistoryReadRequest_members[5] = {
+{
+    UA_TYPENAME("RequestHeader")
+    UA_TYPES_REQUESTHEADER,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("HistoryReadDetails")
+    UA_TYPES_EXTENSIONOBJECT,
+    offsetof(HistoryReadRequest, historyReadDetails) - offsetof(HistoryReadRequest, requestHeader) - sizeof(UA_RequestHeader),
+    true,
+    false
+},
+{
+    UA_TYPENAME("TimestampsToReturn")
+    UA_TYPES_TIMESTAMPSTORETURN,
+    offsetof(HistoryReadRequest, timestampsToReturn) - offsetof(HistoryReadRequest, historyReadDetails) - sizeof(UA_ExtensionObject),
+    true,
+    false
+},
+{
+    UA_TYPENAME("ReleaseContinuationPoints")
+    UA_TYPES_BOOLEAN,
+    offsetof(HistoryReadRequest, releaseContinuationPoints) - offsetof(HistoryReadRequest, timestampsToReturn) - sizeof(UA_TimestampsToReturn),
+    true,
+    false
+},
+{
+    UA_TYPENAME("NodesToRead")
+    HistoryReadValueIdType,
+    offsetof(HistoryReadRequest, nodesToReadSize) - offsetof(HistoryReadRequest, releaseContinuationPoints) - sizeof(UA_Boolean),
+    false,
+    true
+}};
+
+static UA_DataTypeMember HistoryReadResult_members[3] = {
+{
+    UA_TYPENAME("StatusCode")
+    UA_TYPES_STATUSCODE,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("ContinuationPoint")
+    UA_TYPES_BYTESTRING,
+    offsetof(HistoryReadResult, continuationPoint) - offsetof(HistoryReadResult, statusCode) - sizeof(UA_StatusCode),
+    true,
+    false
+},
+{
+    UA_TYPENAME("HistoryData")
+    UA_TYPES_EXTENSIONOBJECT,
+    offsetof(HistoryReadResult, historyData) - offsetof(HistoryReadResult, continuationPoint) - sizeof(UA_ByteString),
+    true,
+    false
+}};
+
+static UA_DataTypeMember HistoryReadResponse_members[3] = {
+{
+    UA_TYPENAME("ResponseHeader")
+    UA_TYPES_RESPONSEHEADER,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("Results")
+    HistoryReadResultType,
+    offsetof(HistoryReadResponse, resultsSize) - offsetof(HistoryReadResponse, responseHeader) - sizeof(UA_ResponseHeader),
+    false,
+    true
+},
+{
+    UA_TYPENAME("DiagnosticInfos")
+    UA_TYPES_DIAGNOSTICINFO,
+    offsetof(HistoryReadResponse, diagnosticInfosSize) - offsetof(HistoryReadResponse, results) - sizeof(void *),
+    true,
+    true
+}};
+
+static UA_DataTypeMember HistoryData_members[1] = {
+{
+    UA_TYPENAME("DataValues")
+    UA_TYPES_DATAVALUE,
+    0,
+    true,
+    true
+}};
+
+static UA_DataTypeMember ModificationInfo_members[3] = {
+{
+    UA_TYPENAME("ModificationTime")
+    UA_TYPES_DATETIME,
+    0,
+    true,
+    false
+},
+{
+    UA_TYPENAME("UpdateType")
+    UA_TYPES_INT32,
+    offsetof(ModificationInfo, updateType) - offsetof(ModificationInfo, modificationTime) - sizeof(UA_DateTime),
+    true,
+    false
+},
+{
+    UA_TYPENAME("UserName")
+    UA_TYPES_STRING,
+    offsetof(ModificationInfo, userName) - offsetof(ModificationInfo, updateType) - sizeof(UA_Int32),
+    true,
+    false
+}};
+
+static UA_DataTypeMember HistoryModifiedData_members[2] = {
+{
+    UA_TYPENAME("DataValues")
+    UA_TYPES_DATAVALUE,
+    0,
+    true,
+    true
+},
+{
+    UA_TYPENAME("ModificationInfos")
+    ModificationInfoType,
+    offsetof(HistoryModifiedData, modificationInfosSize) - offsetof(HistoryModifiedData, dataValues) - sizeof(void *),
+    false,
+    true
+}};
+
+// The order of the entries must match the values of TypeIndex
+const UA_DataType types[TypeCount] = {
+{
+    UA_TYPENAME("ReadRawModifiedDetails")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_READRAWMODIFIEDDETAILS}},
+    sizeof(ReadRawModifiedDetails),
+    ReadRawModifiedDetailsType,
+    UA_DATATYPEKIND_STRUCTURE,
+    true,
+    false,
+    5,
+    UA_NS0ID_READRAWMODIFIEDDETAILS_ENCODING_DEFAULTBINARY,
+    ReadRawModifiedDetails_members
+},
+{
+    UA_TYPENAME("HistoryReadValueId")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYREADVALUEID}},
+    sizeof(HistoryReadValueId),
+    HistoryReadValueIdType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    4,
+    UA_NS0ID_HISTORYREADVALUEID_ENCODING_DEFAULTBINARY,
+    HistoryReadValueId_members
+},
+{
+    UA_TYPENAME("HistoryReadRequest")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYREADREQUEST}},
+    sizeof(HistoryReadRequest),
+    HistoryReadRequestType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    5,
+    UA_NS0ID_HISTORYREADREQUEST_ENCODING_DEFAULTBINARY,
+    HistoryReadRequest_members
+},
+{
+    UA_TYPENAME("HistoryReadResult")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYREADRESULT}},
+    sizeof(HistoryReadResult),
+    HistoryReadResultType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    3,
+    UA_NS0ID_HISTORYREADRESULT_ENCODING_DEFAULTBINARY,
+    HistoryReadResult_members
+},
+{
+    UA_TYPENAME("HistoryReadResponse")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYREADRESPONSE}},
+    sizeof(HistoryReadResponse),
+    HistoryReadResponseType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    3,
+    UA_NS0ID_HISTORYREADRESPONSE_ENCODING_DEFAULTBINARY,
+    HistoryReadResponse_members
+},
+{
+    UA_TYPENAME("HistoryData")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYDATA}},
+    sizeof(HistoryData),
+    HistoryDataType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    1,
+    UA_NS0ID_HISTORYDATA_ENCODING_DEFAULTBINARY,
+    HistoryData_members
+},
+{
+    UA_TYPENAME("ModificationInfo")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_MODIFICATIONINFO}},
+    sizeof(ModificationInfo),
+    ModificationInfoType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    3,
+    UA_NS0ID_MODIFICATIONINFO_ENCODING_DEFAULTBINARY,
+    ModificationInfo_members
+},
+{
+    UA_TYPENAME("HistoryModifiedData")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_HISTORYMODIFIEDDATA}},
+    sizeof(HistoryModifiedData),
+    HistoryModifiedDataType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    2,
+    UA_NS0ID_HISTORYMODIFIEDDATA_ENCODING_DEFAULTBINARY,
+    HistoryModifiedData_members
+},
+{
+    UA_TYPENAME("ReadProcessedDetails")
+    {0, UA_NODEIDTYPE_NUMERIC, {UA_NS0ID_READPROCESSEDDETAILS}},
+    sizeof(ReadProcessedDetails),
+    ReadProcessedDetailsType,
+    UA_DATATYPEKIND_STRUCTURE,
+    false,
+    false,
+    5,
+    UA_NS0ID_READPROCESSEDDETAILS_ENCODING_DEFAULTBINARY,
+    ReadProcessedDetails_members
+}};
+
+const UA_DataTypeArray dataTypeArray = {
+    nullptr,
+    TypeCount,
+    types
+};
+
+bool isType(const UA_DataType *type, TypeIndex index)
+{
+    if (!type)
+        return false;
+
+    const UA_DataType &expected = types[index];
+    return type == &expected || (type->binaryEncodingId == expected.binaryEncodingId
+                                 && UA_NodeId_equal(&type->typeId, &expected.typeId));
+}
+
+void convertHistoryData(const UA_ExtensionObject &historyData, QOpcUaHistoryData &target)
+{
+    if (historyData.encoding == UA_EXTENSIONOBJECT_ENCODED_NOBODY)
+        return;
+
+    // HistoryModifiedData begins with the same members as HistoryData
+    if (historyData.encoding != UA_EXTENSIONOBJECT_DECODED ||
+            (!isType(historyData.content.decoded.type, HistoryDataType) &&
+             !isType(historyData.content.decoded.type, HistoryModifiedDataType))) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to decode history data for" << target.nodeId();
+        return;
+    }
+
+    const auto data = static_cast<const HistoryData *>(historyData.content.decoded.data);
+    QVector<QOpcUaDataValue> &values = target.resultRef();
+    values.reserve(data->dataValuesSize);
+    for (size_t i = 0; i < data->dataValuesSize; ++i) {
+        const UA_DataValue &dv = data->dataValues[i];
+        QOpcUaDataValue value;
+        if (dv.hasValue)
+            value.setValue(QOpen62541ValueConverter::toQVariant(dv.value));
+        if (dv.hasStatus)
+            value.setStatusCode(static_cast<QOpcUa::UaStatusCode>(dv.status));
+        if (dv.hasSourceTimestamp)
+            value.setSourceTimestampTicks(dv.sourceTimestamp);
+        if (dv.hasServerTimestamp)
+            value.setServerTimestampTicks(dv.serverTimestamp);
+        values.push_back(value);
+    }
+}
+
+static bool numericScalarToDouble(const UA_Variant &var, double *target)
+{
+    if (!var.type || !UA_Variant_isScalar(&var))
+        return false;
+
+    switch (var.type->typeIndex) {
+    case UA_TYPES_BOOLEAN:
+        *target = *static_cast<UA_Boolean *>(var.data) ? 1 : 0;
+        return true;
+    case UA_TYPES_SBYTE:
+        *target = *static_cast<UA_SByte *>(var.data);
+        return true;
+    case UA_TYPES_BYTE:
+        *target = *static_cast<UA_Byte *>(var.data);
+        return true;
+    case UA_TYPES_INT16:
+        *target = *static_cast<UA_Int16 *>(var.data);
+        return true;
+    case UA_TYPES_UINT16:
+        *target = *static_cast<UA_UInt16 *>(var.data);
+        return true;
+    case UA_TYPES_INT32:
+        *target = *static_cast<UA_Int32 *>(var.data);
+        return true;
+    case UA_TYPES_UINT32:
+        *target = *static_cast<UA_UInt32 *>(var.data);
+        return true;
+    case UA_TYPES_INT64:
+        *target = static_cast<double>(*static_cast<UA_Int64 *>(var.data));
+        return true;
+    case UA_TYPES_UINT64:
+        *target = static_cast<double>(*static_cast<UA_UInt64 *>(var.data));
+        return true;
+    case UA_TYPES_FLOAT:
+        *target = *static_cast<UA_Float *>(var.data);
+        return true;
+    case UA_TYPES_DOUBLE:
+        *target = *static_cast<UA_Double *>(var.data);
+        return true;
+    default:
+        return false;
+    }
+}
+
+void convertProcessedHistoryData(const UA_ExtensionObject &historyData, QOpcUaProcessedHistoryData &target)
+{
+    if (historyData.encoding == UA_EXTENSIONOBJECT_ENCODED_NOBODY)
+        return;
+
+    if (historyData.encoding != UA_EXTENSIONOBJECT_DECODED || !isType(historyData.content.decoded.type, HistoryDataType)) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to decode processed history data for" << target.nodeId();
+        return;
+    }
+
+    const auto data = static_cast<const HistoryData *>(historyData.content.decoded.data);
+    target.reserve(data->dataValuesSize);
+    for (size_t i = 0; i < data->dataValuesSize; ++i) {
+        const UA_DataValue &dv = data->dataValues[i];
+
+        // The source timestamp of an aggregate is the start of its processing interval
+        const UA_DateTime timestamp = dv.hasSourceTimestamp ? dv.sourceTimestamp : dv.serverTimestamp;
+
+        double value = std::numeric_limits<double>::quiet_NaN();
+        if (dv.hasValue)
+            numericScalarToDouble(dv.value, &value);
+
+        target.append(timestamp, value, dv.hasStatus ? static_cast<QOpcUa::UaStatusCode>(dv.status) : QOpcUa::UaStatusCode::Good);
+    }
+}
+
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,148 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPEN62541HISTORYTYPES_H
+#define QOPEN62541HISTORYTYPES_H
+
+#include "qopen62541.h"
+
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuaprocessedhistorydata.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The bundled open62541 is built without UA_ENABLE_HISTORIZING, which removes the
+    data types of the HistoryRead service from UA_TYPES. This namespace contains hand written
+    type descriptions with the same memory layout as the generated ones which can be passed
+    to __UA_Client_Service(), UA_encodeBinary() and UA_decodeBinary().
+*/
+namespace QOpen62541HistoryTypes {
+
+typedef struct {
+    UA_Boolean isReadModified;
+    UA_DateTime startTime;
+    UA_DateTime endTime;
+    UA_UInt32 numValuesPerNode;
+    UA_Boolean returnBounds;
+} ReadRawModifiedDetails;
+
+typedef struct {
+    UA_DateTime startTime;
+    UA_DateTime endTime;
+    UA_Double processingInterval;
+    size_t aggregateTypeSize;
+    UA_NodeId *aggregateType;
+    UA_AggregateConfiguration aggregateConfiguration;
+} ReadProcessedDetails;
+
+typedef struct {
+    UA_NodeId nodeId;
+    UA_String indexRange;
+    UA_QualifiedName dataEncoding;
+    UA_ByteString continuationPoint;
+} HistoryReadValueId;
+
+typedef struct {
+    UA_RequestHeader requestHeader;
+    UA_ExtensionObject historyReadDetails;
+    UA_TimestampsToReturn timestampsToReturn;
+    UA_Boolean releaseContinuationPoints;
+    size_t nodesToReadSize;
+    HistoryReadValueId *nodesToRead;
+} HistoryReadRequest;
+
+typedef struct {
+    UA_StatusCode statusCode;
+    UA_ByteString continuationPoint;
+    UA_ExtensionObject historyData;
+} HistoryReadResult;
+
+typedef struct {
+    UA_ResponseHeader responseHeader;
+    size_t resultsSize;
+    HistoryReadResult *results;
+    size_t diagnosticInfosSize;
+    UA_DiagnosticInfo *diagnosticInfos;
+} HistoryReadResponse;
+
+typedef struct {
+    size_t dataValuesSize;
+    UA_DataValue *dataValues;
+} HistoryData;
+
+typedef struct {
+    UA_DateTime modificationTime;
+    UA_Int32 updateType; // HistoryUpdateType enumeration
+    UA_String userName;
+} ModificationInfo;
+
+typedef struct {
+    size_t dataValuesSize;
+    UA_DataValue *dataValues;
+    size_t modificationInfosSize;
+    ModificationInfo *modificationInfos;
+} HistoryModifiedData;
+
+enum TypeIndex {
+    ReadRawModifiedDetailsType = 0,
+    HistoryReadValueIdType = 1,
+    HistoryReadRequestType = 2,
+    HistoryReadResultType = 3,
+    HistoryReadResponseType = 4,
+    HistoryDataType = 5,
+    ModificationInfoType = 6,
+    HistoryModifiedDataType = 7,
+    ReadProcessedDetailsType = 8,
+    TypeCount = 9
+};
+
+extern const UA_DataType types[TypeCount];
+
+// Must be set as customDataTypes in the client config to have HistoryData decoded by open62541
+extern const UA_DataTypeArray dataTypeArray;
+
+// Compares the type ids, a decoded extension object may refer to a copy of the type description
+bool isType(const UA_DataType *type, TypeIndex index);
+
+void convertHistoryData(const UA_ExtensionObject &historyData, QOpcUaHistoryData &target);
+void convertProcessedHistoryData(const UA_ExtensionObject &historyData, QOpcUaProcessedHistoryData &target);
+
+}
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541HISTORYTYPES_H
@@ -117,6 +117,20 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
                                      Q_ARG(QVariant, value));
 }
 
+bool QOpen62541Node::setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                                   const QVector<quint32> &linksToRemove)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "setTriggering",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr),
+                                     Q_ARG(QVector<quint32>, linksToAdd),
+                                     Q_ARG(QVector<quint32>, linksToRemove));
+}
+
 QString QOpen62541Node::nodeId() const
 {
     return m_nodeIdString;
@@ -41,6 +41,7 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include "qopen62541utils.h"
+#include <private/qopcuaeventrecord_p.h>
 #include <private/qopcuanode_p.h>
 
 #include "qopcuaelementoperand.h"
@@ -48,6 +49,7 @@
 #include "qopcuaattributeoperand.h"
 #include "qopcuacontentfilterelementresult.h"
 
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
@@ -83,13 +85,44 @@ static void eventHandler(UA_Client *client, UA_UInt32 subId, void *subContext, U
     Q_UNUSED(subContext);
 
     QOpen62541Subscription *subscription = static_cast<QOpen62541Subscription *>(monContext);
-
-    QVariantList list;
-    for (size_t i = 0; i < numFields; ++i)
-        list.append(QOpen62541ValueConverter::toQVariant(eventFields[i]));
-    subscription->eventReceived(monId, list);
+    subscription->eventReceived(monId, numFields, eventFields);
 }
 
+// Keeps the event fields as UA_Variant until they are accessed in the event record
+class QOpen62541EventFieldSource : public QOpcUaEventFieldSource
+{
+public:
+    QOpen62541EventFieldSource(size_t numFields, UA_Variant *eventFields)
+        : m_fields(static_cast<int>(numFields))
+    {
+        // The publish response is deleted after all notifications have been processed.
+        // Taking the variants and leaving empty ones behind avoids copying the field values.
+        for (size_t i = 0; i < numFields; ++i) {
+            m_fields[static_cast<int>(i)] = eventFields[i];
+            UA_Variant_init(&eventFields[i]);
+        }
+    }
+
+    ~QOpen62541EventFieldSource() override
+    {
+        for (auto &field : m_fields)
+            UA_Variant_deleteMembers(&field);
+    }
+
+    int size() const override
+    {
+        return m_fields.size();
+    }
+
+    QVariant field(int index) const override
+    {
+        return QOpen62541ValueConverter::toQVariant(m_fields.at(index));
+    }
+
+private:
+    QVector<UA_Variant> m_fields;
+};
+
 QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, const QOpcUaMonitoringParameters &settings)
     : m_backend(backend)
     , m_interval(settings.publishingInterval())
@@ -117,7 +150,10 @@ UA_UInt32 QOpen62541Subscription::createOnServer()
     req.requestedMaxKeepAliveCount = m_maxKeepaliveCount;
     req.priority = m_priority;
     req.maxNotificationsPerPublish = m_maxNotificationsPerPublish;
+    QElapsedTimer roundTripTimer;
+    roundTripTimer.start();
     UA_CreateSubscriptionResponse res = UA_Client_Subscriptions_create(m_backend->m_uaclient, req, this, stateChangeHandler, nullptr);
+    m_backend->updateRoundTripTime(roundTripTimer.elapsed());
 
     if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << m_interval << UA_StatusCode_name(res.responseHeader.serviceResult);
@@ -149,6 +185,8 @@ bool QOpen62541Subscription::removeOnServer()
 
     m_itemIdToItemMapping.clear();
     m_nodeHandleToItemMapping.clear();
+    m_pendingEvents.clear();
+    m_pendingEventHandles.clear();
 
     return (res == UA_STATUSCODE_GOOD) ? true : false;
 }
@@ -166,86 +204,121 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
         return;
     }
 
-    p = monItem->parameters;
-
     // SetPublishingMode service
     if (item == QOpcUaMonitoringParameters::Parameter::PublishingEnabled) {
-        if (value.type() != QVariant::Bool) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "New value for PublishingEnabled is not a boolean";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
-        }
-
-        UA_SetPublishingModeRequest req;
-        UA_SetPublishingModeRequest_init(&req);
-        UaDeleter<UA_SetPublishingModeRequest> requestDeleter(&req, UA_SetPublishingModeRequest_deleteMembers);
-        req.publishingEnabled = value.toBool();
-        req.subscriptionIdsSize = 1;
-        req.subscriptionIds = UA_UInt32_new();
-        *req.subscriptionIds = m_subscriptionId;
-        UA_SetPublishingModeResponse res = UA_Client_Subscriptions_setPublishingMode(m_backend->m_uaclient, req);
-        UaDeleter<UA_SetPublishingModeResponse> responseDeleter(&res, UA_SetPublishingModeResponse_deleteMembers);
-
-        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set publishing mode:" << res.responseHeader.serviceResult;
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-            emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
-        }
-
-        if (res.resultsSize && res.results[0] == UA_STATUSCODE_GOOD)
-            p.setPublishingEnabled(value.toBool());
-
-        p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[0]));
-        emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-
+        setPublishingMode({monItem}, value);
         return;
     }
 
     // SetMonitoringMode service
     if (item == QOpcUaMonitoringParameters::Parameter::MonitoringMode) {
-        if (value.type() != QVariant::UserType || value.userType() != QMetaType::type("QOpcUaMonitoringParameters::MonitoringMode")) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "New value for MonitoringMode is not a monitoring mode";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
-        }
+        setMonitoringMode({monItem}, value);
+        return;
+    }
 
-        UA_SetMonitoringModeRequest req;
-        UA_SetMonitoringModeRequest_init(&req);
-        UaDeleter<UA_SetMonitoringModeRequest> requestDeleter(&req, UA_SetMonitoringModeRequest_deleteMembers);
-        req.monitoringMode = static_cast<UA_MonitoringMode>(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
-        req.monitoredItemIdsSize = 1;
-        req.monitoredItemIds = UA_UInt32_new();
-        *req.monitoredItemIds = monItem->monitoredItemId;
-        req.subscriptionId = m_subscriptionId;
-        UA_SetMonitoringModeResponse res = UA_Client_MonitoredItems_setMonitoringMode(m_backend->m_uaclient, req);
-        UaDeleter<UA_SetMonitoringModeResponse> responseDeleter(&res, UA_SetMonitoringModeResponse_deleteMembers);
+    if (modifySubscriptionParameters({monItem}, item, value))
+        return;
+    if (modifyMonitoredItemParameters({monItem}, item, value))
+        return;
 
-        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set monitoring mode:" << res.responseHeader.serviceResult;
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+    qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Modifying" << item << "is not implemented";
+    p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
+    emit m_backend->monitoringStatusChanged(handle, attr, item, p);
+}
+
+void QOpen62541Subscription::modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                              QOpcUaMonitoringParameters::Parameter item, QVariant value)
+{
+    QVector<MonitoredItem *> items;
+    items.reserve(handles.size());
+    for (const quint64 handle : handles) {
+        MonitoredItem *monItem = getItemForAttribute(handle, attr);
+        if (monItem) {
+            items.append(monItem);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify parameter" << item << "there are no monitored items";
+            QOpcUaMonitoringParameters p;
+            p.setStatusCode(QOpcUa::UaStatusCode::BadAttributeIdInvalid);
             emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
         }
+    }
 
-        if (res.resultsSize && res.results[0] == UA_STATUSCODE_GOOD)
-            p.setMonitoringMode(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
+    if (items.isEmpty())
+        return;
 
-        p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[0]));
-        emit m_backend->monitoringStatusChanged(handle, attr, item, p);
+    if (item == QOpcUaMonitoringParameters::Parameter::PublishingEnabled) {
+        setPublishingMode(items, value);
+        return;
+    }
+
+    if (item == QOpcUaMonitoringParameters::Parameter::MonitoringMode) {
+        setMonitoringMode(items, value);
         return;
     }
 
-    if (modifySubscriptionParameters(handle, attr, item, value))
+    // Subscription parameters are modified once, all items of the subscription are notified about the change
+    if (modifySubscriptionParameters(items, item, value))
         return;
-    if (modifyMonitoredItemParameters(handle, attr, item, value))
+    if (modifyMonitoredItemParameters(items, item, value))
         return;
 
     qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Modifying" << item << "is not implemented";
+    QOpcUaMonitoringParameters p;
     p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
-    emit m_backend->monitoringStatusChanged(handle, attr, item, p);
+    for (const MonitoredItem *monItem : qAsConst(items))
+        emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, item, p);
+}
+
+void QOpen62541Subscription::setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                                           const QVector<quint32> &linksToRemove)
+{
+    MonitoredItem *monItem = getItemForAttribute(handle, attr);
+    if (!monItem) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not set triggering, there are no monitored items";
+        emit m_backend->setTriggeringFinished(handle, attr, linksToAdd, linksToRemove, QVector<QOpcUa::UaStatusCode>(),
+                                              QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+        return;
+    }
+
+    UA_SetTriggeringRequest req;
+    UA_SetTriggeringRequest_init(&req);
+    UaDeleter<UA_SetTriggeringRequest> requestDeleter(&req, UA_SetTriggeringRequest_deleteMembers);
+    req.subscriptionId = m_subscriptionId;
+    req.triggeringItemId = monItem->monitoredItemId;
+
+    if (!linksToAdd.isEmpty()) {
+        req.linksToAdd = static_cast<UA_UInt32 *>(UA_Array_new(linksToAdd.size(), &UA_TYPES[UA_TYPES_UINT32]));
+        req.linksToAddSize = linksToAdd.size();
+        std::copy(linksToAdd.constBegin(), linksToAdd.constEnd(), req.linksToAdd);
+    }
+    if (!linksToRemove.isEmpty()) {
+        req.linksToRemove = static_cast<UA_UInt32 *>(UA_Array_new(linksToRemove.size(), &UA_TYPES[UA_TYPES_UINT32]));
+        req.linksToRemoveSize = linksToRemove.size();
+        std::copy(linksToRemove.constBegin(), linksToRemove.constEnd(), req.linksToRemove);
+    }
+
+    // The client API of open62541 has no wrapper for SetTriggering
+    UA_SetTriggeringResponse res;
+    __UA_Client_Service(m_backend->m_uaclient, &req, &UA_TYPES[UA_TYPES_SETTRIGGERINGREQUEST],
+                        &res, &UA_TYPES[UA_TYPES_SETTRIGGERINGRESPONSE]);
+    UaDeleter<UA_SetTriggeringResponse> responseDeleter(&res, UA_SetTriggeringResponse_deleteMembers);
+
+    QVector<QOpcUa::UaStatusCode> addResults;
+    QVector<QOpcUa::UaStatusCode> removeResults;
+
+    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set triggering:" << res.responseHeader.serviceResult;
+    } else {
+        addResults.reserve(static_cast<int>(res.addResultsSize));
+        for (size_t i = 0; i < res.addResultsSize; ++i)
+            addResults.append(static_cast<QOpcUa::UaStatusCode>(res.addResults[i]));
+        removeResults.reserve(static_cast<int>(res.removeResultsSize));
+        for (size_t i = 0; i < res.removeResultsSize; ++i)
+            removeResults.append(static_cast<QOpcUa::UaStatusCode>(res.removeResults[i]));
+    }
+
+    emit m_backend->setTriggeringFinished(handle, attr, linksToAdd, linksToRemove, addResults, removeResults,
+                                          static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
 }
 
 bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings)
@@ -293,6 +366,96 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
         return false;
     }
 
+    registerMonitoredItem(handle, attr, settings, m_clientHandle, res);
+
+    return true;
+}
+
+QVector<quint64> QOpen62541Subscription::addAttributeMonitoredItems(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                                                   const QVector<UA_NodeId> &ids, const QOpcUaMonitoringParameters &settings)
+{
+    QVector<quint64> added;
+
+    UA_ExtensionObject filter;
+    UA_ExtensionObject_init(&filter);
+    UaDeleter<UA_ExtensionObject> filterDeleter(&filter, UA_ExtensionObject_deleteMembers);
+    if (settings.filter().isValid()) {
+        filter = createFilter(settings.filter());
+        if (!filter.content.decoded.data) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored items, filter creation failed";
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
+            for (const quint64 handle : handles)
+                emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+            return added;
+        }
+    }
+
+    const size_t count = static_cast<size_t>(handles.size());
+
+    UA_CreateMonitoredItemsRequest req;
+    UA_CreateMonitoredItemsRequest_init(&req);
+    UaDeleter<UA_CreateMonitoredItemsRequest> requestDeleter(&req, UA_CreateMonitoredItemsRequest_deleteMembers);
+    req.subscriptionId = m_subscriptionId;
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    req.itemsToCreateSize = count;
+    req.itemsToCreate = static_cast<UA_MonitoredItemCreateRequest *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST]));
+
+    QVector<void *> contexts(handles.size(), this);
+    QVector<UA_Client_DataChangeNotificationCallback> callbacks(handles.size(), monitoredValueHandler);
+    QVector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(handles.size(), nullptr);
+
+    for (size_t i = 0; i < count; ++i) {
+        UA_MonitoredItemCreateRequest &item = req.itemsToCreate[i];
+        item.itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
+        UA_NodeId_copy(&ids.at(static_cast<int>(i)), &item.itemToMonitor.nodeId);
+        if (settings.indexRange().size())
+            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &item.itemToMonitor.indexRange);
+        item.monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
+        item.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+        item.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+        item.requestedParameters.discardOldest = settings.discardOldest();
+        item.requestedParameters.clientHandle = ++m_clientHandle;
+        if (filter.content.decoded.data)
+            UA_ExtensionObject_copy(&filter, &item.requestedParameters.filter);
+    }
+
+    UA_CreateMonitoredItemsResponse res = UA_Client_MonitoredItems_createDataChanges(m_backend->m_uaclient, req, contexts.data(),
+                                                                                     callbacks.data(), deleteCallbacks.data());
+    UaDeleter<UA_CreateMonitoredItemsResponse> responseDeleter(&res, UA_CreateMonitoredItemsResponse_deleteMembers);
+
+    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.resultsSize != count) {
+        const UA_StatusCode status = res.responseHeader.serviceResult != UA_STATUSCODE_GOOD ?
+                    res.responseHeader.serviceResult : UA_STATUSCODE_BADINTERNALERROR;
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add" << handles.size() << "monitored items for" << attr << ":" << UA_StatusCode_name(status);
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        for (const quint64 handle : handles)
+            emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+        return added;
+    }
+
+    added.reserve(handles.size());
+    for (size_t i = 0; i < count; ++i) {
+        const quint64 handle = handles.at(static_cast<int>(i));
+        if (res.results[i].statusCode != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored item for" << attr << "of node"
+                                                  << Open62541Utils::nodeIdToQString(ids.at(static_cast<int>(i))) << ":" << UA_StatusCode_name(res.results[i].statusCode);
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[i].statusCode));
+            emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+            continue;
+        }
+        registerMonitoredItem(handle, attr, settings, req.itemsToCreate[i].requestedParameters.clientHandle, res.results[i]);
+        added.append(handle);
+    }
+
+    return added;
+}
+
+void QOpen62541Subscription::registerMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                                                   UA_UInt32 clientHandle, const UA_MonitoredItemCreateResult &res)
+{
     MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
     m_nodeHandleToItemMapping[handle][attr] = temp;
     m_itemIdToItemMapping[res.monitoredItemId] = temp;
@@ -307,17 +470,16 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     s.setQueueSize(res.revisedQueueSize);
     s.setMonitoredItemId(res.monitoredItemId);
     temp->parameters = s;
-    temp->clientHandle = m_clientHandle;
+    temp->clientHandle = clientHandle;
+    temp->eventLayout = QOpcUaEventRecordLayout::fromFilter(settings.filter());
 
     if (res.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
             res.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
-        s.setFilterResult(convertEventFilterResult(&res.filterResult));
+        s.setFilterResult(convertEventFilterResult(const_cast<UA_ExtensionObject *>(&res.filterResult)));
     else
         s.clearFilterResult();
 
     emit m_backend->monitoringEnableDisable(handle, attr, true, s);
-
-    return true;
 }
 
 bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
@@ -336,6 +498,8 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(res);
 
     m_itemIdToItemMapping.remove(item->monitoredItemId);
+    if (item->eventLayout && m_pendingEvents.remove(handle))
+        m_pendingEventHandles.removeOne(handle);
     auto it = m_nodeHandleToItemMapping.find(handle);
     it->remove(attr);
     if (it->empty())
@@ -355,22 +519,23 @@ void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
-    QOpcUaReadResult res;
+    QOpcUaDataValue res;
 
     if (!value || value == UA_EMPTY_ARRAY_SENTINEL) {
-        res.setStatusCode(QOpcUa::UaStatusCode::Good);
-        emit m_backend->dataChangeOccurred(item.value()->handle, res);
+        emit m_backend->dataChangeOccurred(item.value()->handle, item.value()->attr, res);
         return;
     }
 
-    res.setValue(QOpen62541ValueConverter::toQVariant(value->value));
-    res.setAttribute(item.value()->attr);
+    res.setValue(QOpen62541ValueConverter::moveToQVariant(&value->value));
+    // A data value without a status code is good
+    if (value->hasStatus)
+        res.setStatusCode(static_cast<QOpcUa::UaStatusCode>(value->status));
+    // UA_DateTime uses the same 100ns ticks as QOpcUaDataValue, the QDateTime is created on demand
     if (value->hasServerTimestamp)
-        res.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->serverTimestamp));
+        res.setServerTimestampTicks(value->serverTimestamp);
     if (value->hasSourceTimestamp)
-        res.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->sourceTimestamp));
-    res.setStatusCode(QOpcUa::UaStatusCode::Good);
-    emit m_backend->dataChangeOccurred(item.value()->handle, res);
+        res.setSourceTimestampTicks(value->sourceTimestamp);
+    emit m_backend->dataChangeOccurred(item.value()->handle, item.value()->attr, res);
 }
 
 void QOpen62541Subscription::sendTimeoutNotification()
@@ -385,12 +550,36 @@ void QOpen62541Subscription::sendTimeoutNotification()
     m_timeout = true;
 }
 
-void QOpen62541Subscription::eventReceived(UA_UInt32 monId, QVariantList list)
+void QOpen62541Subscription::eventReceived(UA_UInt32 monId, size_t numFields, UA_Variant *eventFields)
 {
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
-    emit m_backend->eventOccurred(item.value()->handle, list);
+
+    // All events of a publish response are processed in one call into open62541.
+    // They are collected per monitored item and delivered together when control returns to the event loop.
+    if (m_pendingEventHandles.isEmpty())
+        QMetaObject::invokeMethod(this, &QOpen62541Subscription::flushEvents, Qt::QueuedConnection);
+
+    const quint64 handle = item.value()->handle;
+    auto pending = m_pendingEvents.find(handle);
+    if (pending == m_pendingEvents.end()) {
+        pending = m_pendingEvents.insert(handle, QVector<QOpcUaEventRecord>());
+        m_pendingEventHandles.push_back(handle);
+    }
+    pending->push_back(QOpcUaEventRecordPrivate::create(item.value()->eventLayout,
+                                                        new QOpen62541EventFieldSource(numFields, eventFields)));
+}
+
+void QOpen62541Subscription::flushEvents()
+{
+    QVector<quint64> handles;
+    QHash<quint64, QVector<QOpcUaEventRecord>> events;
+    handles.swap(m_pendingEventHandles);
+    events.swap(m_pendingEvents);
+
+    for (const quint64 handle : handles)
+        emit m_backend->eventsOccurred(handle, events.take(handle));
 }
 
 double QOpen62541Subscription::interval() const
@@ -616,10 +805,17 @@ QOpcUaEventFilterResult QOpen62541Subscription::convertEventFilterResult(UA_Exte
     return result;
 }
 
-bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+bool QOpen62541Subscription::modifySubscriptionParameters(const QVector<MonitoredItem *> &items, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
 {
     QOpcUaMonitoringParameters p;
 
+    // A failed modification of the subscription is reported to all items which requested it
+    const auto emitError = [&](QOpcUa::UaStatusCode statusCode) {
+        p.setStatusCode(statusCode);
+        for (const MonitoredItem *monItem : items)
+            emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, item, p);
+    };
+
     UA_ModifySubscriptionRequest req;
     UA_ModifySubscriptionRequest_init(&req);
     req.subscriptionId = m_subscriptionId;
@@ -636,8 +832,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         req.requestedPublishingInterval = value.toDouble(&ok);
         if (!ok) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify PublishingInterval, value is not a double";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
         break;
@@ -647,8 +842,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         req.requestedLifetimeCount = value.toUInt(&ok);
         if (!ok) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify LifetimeCount, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
         break;
@@ -658,8 +852,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         req.requestedMaxKeepAliveCount = value.toUInt(&ok);
         if (!ok) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify MaxKeepAliveCount, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
         break;
@@ -669,8 +862,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         req.priority = value.toUInt(&ok);
         if (!ok) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify Priority, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
         break;
@@ -680,8 +872,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         req.maxNotificationsPerPublish = value.toUInt(&ok);
         if (!ok) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify MaxNotificationsPerPublish, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
         break;
@@ -695,8 +886,7 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
         UA_ModifySubscriptionResponse res = UA_Client_Subscriptions_modify(m_backend->m_uaclient, req);
 
         if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitError(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
         } else {
             QOpcUaMonitoringParameters::Parameters changed = item;
             if (!qFuzzyCompare(p.publishingInterval(), m_interval))
@@ -729,130 +919,214 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
     return false;
 }
 
-bool QOpen62541Subscription::modifyMonitoredItemParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+void QOpen62541Subscription::emitMonitoringStatus(const QVector<MonitoredItem *> &items,
+                                                  QOpcUaMonitoringParameters::Parameter item, QOpcUa::UaStatusCode statusCode)
 {
-    MonitoredItem *monItem = getItemForAttribute(nodeHandle, attr);
-    QOpcUaMonitoringParameters p = monItem->parameters;
+    for (const MonitoredItem *monItem : items) {
+        QOpcUaMonitoringParameters p = monItem->parameters;
+        p.setStatusCode(statusCode);
+        emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, item, p);
+    }
+}
 
-    UA_ModifyMonitoredItemsRequest req;
-    UA_ModifyMonitoredItemsRequest_init(&req);
-    UaDeleter<UA_ModifyMonitoredItemsRequest> requestDeleter(&req, UA_ModifyMonitoredItemsRequest_deleteMembers);
+void QOpen62541Subscription::setPublishingMode(const QVector<MonitoredItem *> &items, const QVariant &value)
+{
+    const auto item = QOpcUaMonitoringParameters::Parameter::PublishingEnabled;
+
+    if (value.type() != QVariant::Bool) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "New value for PublishingEnabled is not a boolean";
+        emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadTypeMismatch);
+        return;
+    }
+
+    UA_SetPublishingModeRequest req;
+    UA_SetPublishingModeRequest_init(&req);
+    UaDeleter<UA_SetPublishingModeRequest> requestDeleter(&req, UA_SetPublishingModeRequest_deleteMembers);
+    req.publishingEnabled = value.toBool();
+    req.subscriptionIdsSize = 1;
+    req.subscriptionIds = UA_UInt32_new();
+    *req.subscriptionIds = m_subscriptionId;
+    UA_SetPublishingModeResponse res = UA_Client_Subscriptions_setPublishingMode(m_backend->m_uaclient, req);
+    UaDeleter<UA_SetPublishingModeResponse> responseDeleter(&res, UA_SetPublishingModeResponse_deleteMembers);
+
+    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set publishing mode:" << res.responseHeader.serviceResult;
+        emitMonitoringStatus(items, item, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+        return;
+    }
+
+    const UA_StatusCode result = res.resultsSize ? res.results[0] : UA_STATUSCODE_BADINTERNALERROR;
+    if (result == UA_STATUSCODE_GOOD) {
+        for (MonitoredItem *monItem : items)
+            monItem->parameters.setPublishingEnabled(value.toBool());
+    }
+
+    emitMonitoringStatus(items, item, static_cast<QOpcUa::UaStatusCode>(result));
+}
+
+void QOpen62541Subscription::setMonitoringMode(const QVector<MonitoredItem *> &items, const QVariant &value)
+{
+    const auto item = QOpcUaMonitoringParameters::Parameter::MonitoringMode;
+
+    if (value.type() != QVariant::UserType || value.userType() != QMetaType::type("QOpcUaMonitoringParameters::MonitoringMode")) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "New value for MonitoringMode is not a monitoring mode";
+        emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadTypeMismatch);
+        return;
+    }
+
+    const auto mode = value.value<QOpcUaMonitoringParameters::MonitoringMode>();
+
+    UA_SetMonitoringModeRequest req;
+    UA_SetMonitoringModeRequest_init(&req);
+    UaDeleter<UA_SetMonitoringModeRequest> requestDeleter(&req, UA_SetMonitoringModeRequest_deleteMembers);
+    req.monitoringMode = static_cast<UA_MonitoringMode>(mode);
+    req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(items.size(), &UA_TYPES[UA_TYPES_UINT32]));
+    req.monitoredItemIdsSize = items.size();
+    for (int i = 0; i < items.size(); ++i)
+        req.monitoredItemIds[i] = items.at(i)->monitoredItemId;
     req.subscriptionId = m_subscriptionId;
-    req.itemsToModifySize = 1;
-    req.itemsToModify = UA_MonitoredItemModifyRequest_new();
-    UA_MonitoredItemModifyRequest_init(req.itemsToModify);
-    req.itemsToModify->monitoredItemId = monItem->monitoredItemId;
-    req.itemsToModify->requestedParameters.discardOldest = monItem->parameters.discardOldest();
-    req.itemsToModify->requestedParameters.queueSize = monItem->parameters.queueSize();
-    req.itemsToModify->requestedParameters.samplingInterval = monItem->parameters.samplingInterval();
-    req.itemsToModify->monitoredItemId = monItem->monitoredItemId;
-    req.itemsToModify->requestedParameters.clientHandle = monItem->clientHandle;
+    UA_SetMonitoringModeResponse res = UA_Client_MonitoredItems_setMonitoringMode(m_backend->m_uaclient, req);
+    UaDeleter<UA_SetMonitoringModeResponse> responseDeleter(&res, UA_SetMonitoringModeResponse_deleteMembers);
 
-    bool match = true;
+    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set monitoring mode:" << res.responseHeader.serviceResult;
+        emitMonitoringStatus(items, item, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+        return;
+    }
+
+    for (int i = 0; i < items.size(); ++i) {
+        MonitoredItem *monItem = items.at(i);
+        const UA_StatusCode result = static_cast<size_t>(i) < res.resultsSize ? res.results[i] : UA_STATUSCODE_BADINTERNALERROR;
+        if (result == UA_STATUSCODE_GOOD)
+            monItem->parameters.setMonitoringMode(mode);
+
+        QOpcUaMonitoringParameters p = monItem->parameters;
+        p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(result));
+        emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, item, p);
+    }
+}
 
+bool QOpen62541Subscription::modifyMonitoredItemParameters(const QVector<MonitoredItem *> &items, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+{
     switch (item) {
-    case QOpcUaMonitoringParameters::Parameter::DiscardOldest: {
+    case QOpcUaMonitoringParameters::Parameter::DiscardOldest:
         if (value.type() != QVariant::Bool) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify DiscardOldest, value is not a bool";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
-        req.itemsToModify->requestedParameters.discardOldest = value.toBool();
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::QueueSize: {
+    case QOpcUaMonitoringParameters::Parameter::QueueSize:
         if (value.type() != QVariant::UInt) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify QueueSize, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
-        req.itemsToModify->requestedParameters.queueSize = value.toUInt();
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::SamplingInterval: {
+    case QOpcUaMonitoringParameters::Parameter::SamplingInterval:
         if (value.type() != QVariant::Double) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify SamplingInterval, value is not a double";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+            emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadTypeMismatch);
             return true;
         }
-        req.itemsToModify->requestedParameters.samplingInterval = value.toDouble();
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::Filter: {
-        UA_ExtensionObject filter = createFilter(value);
-        if (filter.content.decoded.data)
-            req.itemsToModify->requestedParameters.filter = filter;
-        else {
-            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to modify filter, filter creation failed";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        }
+    case QOpcUaMonitoringParameters::Parameter::Filter:
         break;
-    }
     default:
-        match = false;
-        break;
+        return false;
     }
 
-    if (match) {
-        if (item != QOpcUaMonitoringParameters::Parameter::Filter && p.filter().isValid()) {
-            UA_ExtensionObject filter = createFilter(monItem->parameters.filter());
-            if (filter.content.decoded.data)
-                req.itemsToModify->requestedParameters.filter = filter;
-            else {
+    UA_ModifyMonitoredItemsRequest req;
+    UA_ModifyMonitoredItemsRequest_init(&req);
+    UaDeleter<UA_ModifyMonitoredItemsRequest> requestDeleter(&req, UA_ModifyMonitoredItemsRequest_deleteMembers);
+    req.subscriptionId = m_subscriptionId;
+    req.itemsToModify = static_cast<UA_MonitoredItemModifyRequest *>(
+                UA_Array_new(items.size(), &UA_TYPES[UA_TYPES_MONITOREDITEMMODIFYREQUEST]));
+    req.itemsToModifySize = items.size();
+
+    // All items are modified in a single request, the parameters which are not modified keep their current values
+    for (int i = 0; i < items.size(); ++i) {
+        const MonitoredItem *monItem = items.at(i);
+        UA_MonitoredItemModifyRequest &modifyRequest = req.itemsToModify[i];
+        modifyRequest.monitoredItemId = monItem->monitoredItemId;
+        modifyRequest.requestedParameters.clientHandle = monItem->clientHandle;
+        modifyRequest.requestedParameters.discardOldest = monItem->parameters.discardOldest();
+        modifyRequest.requestedParameters.queueSize = monItem->parameters.queueSize();
+        modifyRequest.requestedParameters.samplingInterval = monItem->parameters.samplingInterval();
+
+        if (item == QOpcUaMonitoringParameters::Parameter::DiscardOldest)
+            modifyRequest.requestedParameters.discardOldest = value.toBool();
+        else if (item == QOpcUaMonitoringParameters::Parameter::QueueSize)
+            modifyRequest.requestedParameters.queueSize = value.toUInt();
+        else if (item == QOpcUaMonitoringParameters::Parameter::SamplingInterval)
+            modifyRequest.requestedParameters.samplingInterval = value.toDouble();
+
+        const bool isNewFilter = item == QOpcUaMonitoringParameters::Parameter::Filter;
+        if (isNewFilter || monItem->parameters.filter().isValid()) {
+            UA_ExtensionObject filter = createFilter(isNewFilter ? value : monItem->parameters.filter());
+            if (!filter.content.decoded.data) {
                 qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify monitored item, filter creation failed";
-                p.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-                emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
+                emitMonitoringStatus(items, item, QOpcUa::UaStatusCode::BadInternalError);
                 return true;
             }
+            modifyRequest.requestedParameters.filter = filter;
         }
+    }
 
-        UA_ModifyMonitoredItemsResponse res = UA_Client_MonitoredItems_modify(m_backend->m_uaclient, req);
-        UaDeleter<UA_ModifyMonitoredItemsResponse> responseDeleter(
-                    &res, UA_ModifyMonitoredItemsResponse_deleteMembers);
+    UA_ModifyMonitoredItemsResponse res = UA_Client_MonitoredItems_modify(m_backend->m_uaclient, req);
+    UaDeleter<UA_ModifyMonitoredItemsResponse> responseDeleter(
+                &res, UA_ModifyMonitoredItemsResponse_deleteMembers);
 
-        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.results[0].statusCode != UA_STATUSCODE_GOOD) {
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult == UA_STATUSCODE_GOOD ? res.results[0].statusCode : res.responseHeader.serviceResult));
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        } else {
-            p.setStatusCode(QOpcUa::UaStatusCode::Good);
-            QOpcUaMonitoringParameters::Parameters changed = item;
-            if (!qFuzzyCompare(p.samplingInterval(), res.results[0].revisedSamplingInterval)) {
-                p.setSamplingInterval(res.results[0].revisedSamplingInterval);
-                changed |= QOpcUaMonitoringParameters::Parameter::SamplingInterval;
-            }
-            if (p.queueSize() != res.results[0].revisedQueueSize) {
-                p.setQueueSize(res.results[0].revisedQueueSize);
-                changed |= QOpcUaMonitoringParameters::Parameter::QueueSize;
-            }
+    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
+        emitMonitoringStatus(items, item, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+        return true;
+    }
 
-            if (item == QOpcUaMonitoringParameters::Parameter::DiscardOldest) {
-                p.setDiscardOldest(value.toBool());
-                changed |= QOpcUaMonitoringParameters::Parameter::DiscardOldest;
-            }
+    for (int i = 0; i < items.size(); ++i) {
+        MonitoredItem *monItem = items.at(i);
+        QOpcUaMonitoringParameters p = monItem->parameters;
 
-            if (item == QOpcUaMonitoringParameters::Parameter::Filter) {
-                changed |= QOpcUaMonitoringParameters::Parameter::Filter;
-                if (value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
-                    p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
-                else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
-                    p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
-                if (res.results[0].filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
-                    p.setFilterResult(convertEventFilterResult(&res.results[0].filterResult));
-            }
+        if (static_cast<size_t>(i) >= res.resultsSize || res.results[i].statusCode != UA_STATUSCODE_GOOD) {
+            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(static_cast<size_t>(i) < res.resultsSize ?
+                                                                  res.results[i].statusCode : UA_STATUSCODE_BADINTERNALERROR));
+            emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, item, p);
+            continue;
+        }
+
+        UA_MonitoredItemModifyResult &result = res.results[i];
+        p.setStatusCode(QOpcUa::UaStatusCode::Good);
+        QOpcUaMonitoringParameters::Parameters changed = item;
+        if (!qFuzzyCompare(p.samplingInterval(), result.revisedSamplingInterval)) {
+            p.setSamplingInterval(result.revisedSamplingInterval);
+            changed |= QOpcUaMonitoringParameters::Parameter::SamplingInterval;
+        }
+        if (p.queueSize() != result.revisedQueueSize) {
+            p.setQueueSize(result.revisedQueueSize);
+            changed |= QOpcUaMonitoringParameters::Parameter::QueueSize;
+        }
 
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, changed, p);
+        if (item == QOpcUaMonitoringParameters::Parameter::DiscardOldest) {
+            p.setDiscardOldest(value.toBool());
+            changed |= QOpcUaMonitoringParameters::Parameter::DiscardOldest;
+        }
 
-            monItem->parameters = p;
+        if (item == QOpcUaMonitoringParameters::Parameter::Filter) {
+            changed |= QOpcUaMonitoringParameters::Parameter::Filter;
+            if (value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
+                p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
+            else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
+                p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
+            monItem->eventLayout = QOpcUaEventRecordLayout::fromFilter(p.filter());
+            if (result.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
+                p.setFilterResult(convertEventFilterResult(&result.filterResult));
         }
-        return true;
+
+        emit m_backend->monitoringStatusChanged(monItem->handle, monItem->attr, changed, p);
+
+        monItem->parameters = p;
     }
-    return false;
+
+    return true;
 }
 
 QT_END_NAMESPACE
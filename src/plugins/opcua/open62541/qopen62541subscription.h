@@ -40,9 +40,12 @@
 #include "qopen62541.h"
 #include <QtOpcUa/qopcuanode.h>
 
+#include <QtCore/qsharedpointer.h>
+
 QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend;
+class QOpcUaEventRecordLayout;
 
 class QOpen62541Subscription : public QObject
 {
@@ -56,12 +59,18 @@ public:
     bool removeOnServer();
 
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void modifyMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                          QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                       const QVector<quint32> &linksToRemove);
 
     bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
+    QVector<quint64> addAttributeMonitoredItems(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                                const QVector<UA_NodeId> &ids, const QOpcUaMonitoringParameters &settings);
     bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
 
     void monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value);
-    void eventReceived(UA_UInt32 monId, QVariantList list);
+    void eventReceived(UA_UInt32 monId, size_t numFields, UA_Variant *eventFields);
 
     void sendTimeoutNotification();
 
@@ -71,6 +80,7 @@ public:
         UA_UInt32 monitoredItemId;
         UA_UInt32 clientHandle;
         QOpcUaMonitoringParameters parameters;
+        QSharedPointer<const QOpcUaEventRecordLayout> eventLayout; // Only set for event monitored items
         MonitoredItem(quint64 h, QOpcUa::NodeAttribute a, UA_UInt32 id)
             : handle(h)
             , attr(a)
@@ -92,7 +102,10 @@ signals:
     void timeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
 
 private:
+    void flushEvents();
     MonitoredItem *getItemForAttribute(quint64 nodeHandle, QOpcUa::NodeAttribute attr);
+    void registerMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                               UA_UInt32 clientHandle, const UA_MonitoredItemCreateResult &res);
     UA_ExtensionObject createFilter(const QVariant &filterData);
     void createDataChangeFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter, UA_ExtensionObject *out);
     void createEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter, UA_ExtensionObject *out);
@@ -100,8 +113,12 @@ private:
                              UA_SimpleAttributeOperand **selectClauses, size_t *size);
     bool convertWhereClause(const QOpcUaMonitoringParameters::EventFilter &filter, UA_ContentFilter *result);
 
-    bool modifySubscriptionParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
-    bool modifyMonitoredItemParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
+    bool modifySubscriptionParameters(const QVector<MonitoredItem *> &items, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
+    bool modifyMonitoredItemParameters(const QVector<MonitoredItem *> &items, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
+    void setPublishingMode(const QVector<MonitoredItem *> &items, const QVariant &value);
+    void setMonitoringMode(const QVector<MonitoredItem *> &items, const QVariant &value);
+    void emitMonitoringStatus(const QVector<MonitoredItem *> &items, QOpcUaMonitoringParameters::Parameter item,
+                              QOpcUa::UaStatusCode statusCode);
     QOpcUaEventFilterResult convertEventFilterResult(UA_ExtensionObject *obj);
 
     Open62541AsyncBackend *m_backend;
@@ -116,6 +133,10 @@ private:
     QHash<quint64, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_nodeHandleToItemMapping; // Handle -> Attribute -> MonitoredItem
     QHash<UA_UInt32, MonitoredItem *> m_itemIdToItemMapping; // ItemId -> Item for fast lookup on data change
 
+    // Events received in the current publish response, delivered in one signal per monitored item
+    QHash<quint64, QVector<QOpcUaEventRecord>> m_pendingEvents;
+    QVector<quint64> m_pendingEventHandles;
+
     quint32 m_clientHandle;
     bool m_timeout;
 };
@@ -36,6 +36,8 @@
 
 #include "qopen62541utils.h"
 #include <qopcuatype.h>
+#include <private/qopcuanodeids_p.h>
+#include <private/qopcuastringpool_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
@@ -49,6 +51,10 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
 UA_NodeId Open62541Utils::nodeIdFromQString(const QString &name)
 {
+    quint32 namespace0Id = 0;
+    if (QOpcUaNodeIdsPrivate::namespace0NumericId(name, &namespace0Id))
+        return UA_NODEID_NUMERIC(0, namespace0Id);
+
     quint16 namespaceIndex;
     QString identifierString;
     char identifierType;
@@ -108,6 +114,10 @@ UA_NodeId Open62541Utils::nodeIdFromQString(const QString &name)
 
 QString Open62541Utils::nodeIdToQString(UA_NodeId id)
 {
+    QOpcUaStringPool *pool = QOpcUaStringPool::forCurrentThread();
+    if (pool && id.identifierType == UA_NODEIDTYPE_NUMERIC)
+        return pool->numericNodeId(id.namespaceIndex, id.identifier.numeric);
+
     QString result = QString::fromLatin1("ns=%1;").arg(id.namespaceIndex);
 
     switch (id.identifierType) {
@@ -135,7 +145,7 @@ QString Open62541Utils::nodeIdToQString(UA_NodeId id)
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Open62541 Utils: Could not convert UA_NodeId to QString";
         result.clear();
     }
-    return result;
+    return pool ? pool->intern(result) : result;
 }
 
 QT_END_NAMESPACE
@@ -40,11 +40,15 @@
 
 #include "qopcuamultidimensionalarray.h"
 
+#include <QtOpcUa/qopcuaextensionobjectdecoderregistry.h>
+#include <private/qopcuastringpool_p.h>
+
 #include <QtCore/qdatetime.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/quuid.h>
 
 #include <cstring>
+#include <numeric>
 
 QT_BEGIN_NAMESPACE
 
@@ -61,7 +65,19 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 
     if (value.canConvert<QOpcUaMultiDimensionalArray>()) {
         QOpcUaMultiDimensionalArray data = value.value<QOpcUaMultiDimensionalArray>();
-        UA_Variant result = toOpen62541Variant(data.valueArray(), type);
+        UA_Variant result;
+        UA_Variant_init(&result);
+
+        // Typed storage has the same layout as the open62541 array, copy it as one block
+        if (data.hasTypedStorage() && data.isValid() && (type == QOpcUa::Undefined || type == data.elementType())) {
+            const UA_DataType *dt = toDataType(data.elementType());
+            const size_t length = std::accumulate(data.arrayDimensions().constBegin(), data.arrayDimensions().constEnd(),
+                                                  size_t(1), std::multiplies<size_t>());
+            if (length && UA_Variant_setArrayCopy(&result, data.constData(), length, dt) != UA_STATUSCODE_GOOD)
+                return open62541value;
+        } else {
+            result = toOpen62541Variant(data.valueArray(), type);
+        }
 
         if (!data.arrayDimensions().isEmpty()) {
             // Ensure that the array dimensions size is < UINT32_MAX
@@ -149,12 +165,90 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
     return open62541value;
 }
 
+// Returns the element type for multidimensional arrays which can use the data of the variant as typed storage
+static QOpcUa::Types typedArrayElementType(const UA_Variant &var)
+{
+    if (var.type == nullptr || var.arrayLength == 0 || var.data == UA_EMPTY_ARRAY_SENTINEL ||
+            var.arrayDimensionsSize == 0 || var.arrayDimensionsSize > static_cast<quint64>((std::numeric_limits<int>::max)()))
+        return QOpcUa::Undefined;
+
+    quint64 length = 1;
+    for (size_t i = 0; i < var.arrayDimensionsSize; ++i) {
+        length *= var.arrayDimensions[i];
+        if (length > var.arrayLength)
+            return QOpcUa::Undefined;
+    }
+    if (length != var.arrayLength)
+        return QOpcUa::Undefined;
+
+    switch (var.type->typeIndex) {
+    case UA_TYPES_BOOLEAN:
+        return QOpcUa::Boolean;
+    case UA_TYPES_SBYTE:
+        return QOpcUa::SByte;
+    case UA_TYPES_BYTE:
+        return QOpcUa::Byte;
+    case UA_TYPES_INT16:
+        return QOpcUa::Int16;
+    case UA_TYPES_UINT16:
+        return QOpcUa::UInt16;
+    case UA_TYPES_INT32:
+        return QOpcUa::Int32;
+    case UA_TYPES_UINT32:
+        return QOpcUa::UInt32;
+    case UA_TYPES_INT64:
+        return QOpcUa::Int64;
+    case UA_TYPES_UINT64:
+        return QOpcUa::UInt64;
+    case UA_TYPES_FLOAT:
+        return QOpcUa::Float;
+    case UA_TYPES_DOUBLE:
+        return QOpcUa::Double;
+    default:
+        return QOpcUa::Undefined;
+    }
+}
+
+static QVector<quint32> arrayDimensionsFromVariant(const UA_Variant &var)
+{
+    QVector<quint32> arrayDimensions;
+    arrayDimensions.reserve(static_cast<int>(var.arrayDimensionsSize));
+    std::copy(var.arrayDimensions, var.arrayDimensions + var.arrayDimensionsSize, std::back_inserter(arrayDimensions));
+    return arrayDimensions;
+}
+
+static void freeVariantData(void *data)
+{
+    UA_free(data);
+}
+
+QVariant moveToQVariant(UA_Variant *value)
+{
+    const QOpcUa::Types elementType = typedArrayElementType(*value);
+    if (elementType == QOpcUa::Undefined)
+        return toQVariant(*value);
+
+    // The array takes over the data, the variant keeps only the array dimensions
+    void *data = value->data;
+    value->data = nullptr;
+    value->arrayLength = 0;
+    return QOpcUaMultiDimensionalArray(elementType, data, arrayDimensionsFromVariant(*value), &freeVariantData, data);
+}
+
 QVariant toQVariant(const UA_Variant &value)
 {
     if (value.type == nullptr) {
         return QVariant();
     }
 
+    // Copy multidimensional arrays of numeric types as one block instead of creating a QVariant per element
+    const QOpcUa::Types elementType = typedArrayElementType(value);
+    if (elementType != QOpcUa::Undefined) {
+        QOpcUaMultiDimensionalArray result(elementType, arrayDimensionsFromVariant(value));
+        std::memcpy(result.data(), value.data, value.arrayLength * value.type->memSize);
+        return result;
+    }
+
     switch (value.type->typeIndex) {
     case UA_TYPES_BOOLEAN:
         return arrayToQVariant<bool, UA_Boolean>(value, QMetaType::Bool);
@@ -281,7 +375,7 @@ TARGETTYPE scalarToQt(const UATYPE *data)
 template<>
 QString scalarToQt<QString, UA_String>(const UA_String *data)
 {
-    return QString::fromUtf8(reinterpret_cast<const char *>(data->data), data->length);
+    return QOpcUaStringPool::utf8ToString(reinterpret_cast<const char *>(data->data), data->length);
 }
 
 template<>
@@ -379,6 +473,15 @@ QVariant scalarToQt<QVariant, UA_ExtensionObject>(const UA_ExtensionObject *data
     QByteArray buffer = QByteArray::fromRawData(reinterpret_cast<const char *>(data->content.encoded.body.data),
                                                 data->content.encoded.body.length);
 
+    // Decoders registered by the application work directly on the received body
+    if (data->encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING && !QOpcUaExtensionObjectDecoderRegistry::isEmpty()) {
+        bool success = false;
+        const QVariant result = QOpcUaExtensionObjectDecoderRegistry::decode(
+                    Open62541Utils::nodeIdToQString(data->content.encoded.typeId), buffer, &success);
+        if (success)
+            return result;
+    }
+
     // Decode recognized types, as required by OPC-UA part 4, 5.2.2.15
     if (data->content.encoded.typeId.identifierType == UA_NODEIDTYPE_NUMERIC &&
             data->content.encoded.typeId.namespaceIndex == 0 &&
@@ -61,6 +61,7 @@ namespace QOpen62541ValueConverter {
 
     UA_Variant toOpen62541Variant(const QVariant&, QOpcUa::Types);
     QVariant toQVariant(const UA_Variant&);
+    QVariant moveToQVariant(UA_Variant *value);
     const UA_DataType *toDataType(QOpcUa::Types valueType);
     QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type);
 
@@ -167,7 +167,7 @@ void UACppAsyncBackend::browse(quint64 handle, const UaNodeId &id, const QOpcUaB
     browseContext.browseDirection = static_cast<OpcUa_BrowseDirection>(request.browseDirection());
 
     QStringList result;
-    QVector<QOpcUaReferenceDescription> ret;
+    QOpcUaBrowseResult ret;
     status = m_nativeSession->browse(serviceSettings, id, browseContext, continuationPoint, referenceDescriptions);
     bool initialBrowse = true;
     do {
@@ -555,7 +555,7 @@ void UACppAsyncBackend::enableMonitoring(quint64 handle, const UaNodeId &id, QOp
         }
         usedSubscription = sub.value(); // Ignore interval != subscription.interval
     } else {
-        usedSubscription = getSubscription(settings);
+        usedSubscription = getSubscription(settings, static_cast<int>(qPopulationCount(static_cast<quint32>(attr))));
     }
 
     if (!usedSubscription) {
@@ -599,6 +599,19 @@ void UACppAsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute a
     subscription->modifyMonitoring(handle, attr, item, value);
 }
 
+void UACppAsyncBackend::setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove)
+{
+    QUACppSubscription *subscription = getSubscriptionForItem(handle, attr);
+    if (!subscription) {
+        qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Could not set triggering for" << attr << ", the monitored item does not exist";
+        emit setTriggeringFinished(handle, attr, linksToAdd, linksToRemove, QVector<QOpcUa::UaStatusCode>(),
+                                   QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+        return;
+    }
+
+    subscription->setTriggering(handle, attr, linksToAdd, linksToRemove);
+}
+
 void UACppAsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
@@ -691,15 +704,23 @@ void UACppAsyncBackend::resolveBrowsePath(quint64 handle, const UaNodeId &startN
     emit resolveBrowsePathFinished(handle, ret, path, status);
 }
 
-QUACppSubscription *UACppAsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings)
+QUACppSubscription *UACppAsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount)
 {
     if (settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Shared) {
         // Requesting multiple subscriptions with publishing interval < minimum publishing interval breaks subscription sharing
         double interval = revisePublishingInterval(settings.publishingInterval(), m_minPublishingInterval);
+        QUACppSubscription *leastLoaded = nullptr;
         for (auto entry : qAsConst(m_subscriptions)) {
-            if (qFuzzyCompare(entry->interval(), interval) && entry->shared() == QOpcUaMonitoringParameters::SubscriptionType::Shared)
-                return entry;
+            if (!qFuzzyCompare(entry->interval(), interval) || entry->shared() != QOpcUaMonitoringParameters::SubscriptionType::Shared)
+                continue;
+            // Full subscriptions are skipped, a new subscription is created if all of them are full
+            if (m_maximumItemsPerSubscription > 0 && entry->monitoredItemsCount() + itemCount > m_maximumItemsPerSubscription)
+                continue;
+            if (!leastLoaded || entry->monitoredItemsCount() < leastLoaded->monitoredItemsCount())
+                leastLoaded = entry;
         }
+        if (leastLoaded)
+            return leastLoaded;
     }
 
     QUACppSubscription *sub = new QUACppSubscription(this, settings);
@@ -69,6 +69,7 @@ public Q_SLOTS:
     void writeAttributes(quint64 handle, const UaNodeId &id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
     void enableMonitoring(quint64 handle, const UaNodeId &id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void setTriggering(quint64 handle, QOpcUa::NodeAttribute attr, QVector<quint32> linksToAdd, QVector<quint32> linksToRemove);
     void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
     void callMethod(quint64 handle, const UaNodeId &objectId, const UaNodeId &methodId, QVector<QOpcUa::TypedVariant> args);
     void resolveBrowsePath(quint64 handle, const UaNodeId &startNode, const QVector<QOpcUaRelativePathElement> &path);
@@ -91,7 +92,7 @@ public Q_SLOTS:
     QOpcUaErrorState::ConnectionStep connectionStepFromUaServiceType(UaClientSdk::UaClient::ConnectServiceType type) const;
 
 public:
-    QUACppSubscription *getSubscription(const QOpcUaMonitoringParameters &settings);
+    QUACppSubscription *getSubscription(const QOpcUaMonitoringParameters &settings, int itemCount);
     QUACppSubscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
     void cleanupSubscriptions();
     Q_DISABLE_COPY(UACppAsyncBackend);
@@ -104,6 +105,7 @@ public:
     QMutex m_lifecycleMutex;
     double m_minPublishingInterval;
     bool m_disableEncryptedPasswordCheck{false};
+    int m_maximumItemsPerSubscription{0}; // 0 means no limit
 
 private:
     bool assembleNodeAttributes(OpcUa_ExtensionObject *uaExtensionObject, const QOpcUaNodeCreationAttributes &nodeAttributes, QOpcUa::NodeClass nodeClass);
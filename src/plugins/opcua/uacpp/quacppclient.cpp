@@ -54,6 +54,8 @@ QUACppClient::QUACppClient(const QVariantMap &backendProperties)
         m_backend->m_disableEncryptedPasswordCheck = true;
     }
 
+    m_backend->m_maximumItemsPerSubscription = qMax(0, backendProperties.value(QLatin1String("maximumItemsPerSubscription"), 0).toInt());
+
     if (backendProperties.value(QLatin1String("enableVerboseDebugOutput"), false).toBool()) {
         OpcUa_Trace_Initialize();
         OpcUa_Trace_ChangeTraceLevel(OPCUA_TRACE_OUTPUT_LEVEL_ALL);
@@ -90,6 +92,19 @@ QOpcUaNode *QUACppClient::node(const QString &nodeId)
     if (nativeId.isNull())
         return nullptr;
 
+    return createNode(nativeId, nodeId);
+}
+
+QOpcUaNode *QUACppClient::node(QOpcUa::NodeIds::Namespace0 id)
+{
+    if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+        return nullptr;
+
+    return createNode(UaNodeId(static_cast<OpcUa_UInt32>(id), 0), QOpcUa::namespace0Id(id));
+}
+
+QOpcUaNode *QUACppClient::createNode(const UaNodeId &nativeId, const QString &nodeId)
+{
     auto tempNode = new QUACppNode(nativeId, this, nodeId);
     if (!tempNode->registered()) {
         qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Failed to register node with backend, maximum number of nodes reached.";
@@ -154,6 +169,34 @@ bool QUACppClient::deleteReference(const QOpcUaDeleteReferenceItem &referenceToD
                                      Q_ARG(QOpcUaDeleteReferenceItem, referenceToDelete));
 }
 
+bool QUACppClient::enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                                   const QOpcUaMonitoringParameters &settings)
+{
+    // The backend creates the monitored items one by one, this also works for handles without a node
+    bool dispatched = true;
+    for (int i = 0; i < handles.size(); ++i) {
+        if (!QMetaObject::invokeMethod(m_backend, "enableMonitoring", Qt::QueuedConnection,
+                                       Q_ARG(quint64, handles.at(i)),
+                                       Q_ARG(UaNodeId, UACppUtils::nodeIdFromQString(nodeIds.at(i))),
+                                       Q_ARG(QOpcUa::NodeAttributes, attr),
+                                       Q_ARG(QOpcUaMonitoringParameters, settings)))
+            dispatched = false;
+    }
+    return dispatched;
+}
+
+bool QUACppClient::disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr)
+{
+    bool dispatched = true;
+    for (const quint64 handle : handles) {
+        if (!QMetaObject::invokeMethod(m_backend, "disableMonitoring", Qt::QueuedConnection,
+                                       Q_ARG(quint64, handle),
+                                       Q_ARG(QOpcUa::NodeAttributes, attr)))
+            dispatched = false;
+    }
+    return dispatched;
+}
+
 QStringList QUACppClient::supportedSecurityPolicies() const
 {
     return QStringList {
@@ -34,6 +34,8 @@
 
 #include <QtCore/QTimer>
 
+#include <uanodeid.h>
+
 QT_BEGIN_NAMESPACE
 
 class UACppAsyncBackend;
@@ -50,6 +52,7 @@ public:
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(QOpcUa::NodeIds::Namespace0 id) override;
 
     QString backend() const override;
 
@@ -66,10 +69,16 @@ public:
     bool addReference(const QOpcUaAddReferenceItem &referenceToAdd) override;
     bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete) override;
 
+    bool enableMonitoring(const QVector<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttribute attr,
+                          const QOpcUaMonitoringParameters &settings) override;
+    bool disableMonitoring(const QVector<quint64> &handles, QOpcUa::NodeAttribute attr) override;
+
     QStringList supportedSecurityPolicies() const override;
     QVector<QOpcUaUserTokenPolicy::TokenType> supportedUserTokenTypes() const override;
 
 private:
+    QOpcUaNode *createNode(const UaNodeId &nativeId, const QString &nodeId);
+
     friend class QUACppNode;
     QThread *m_thread;
     UACppAsyncBackend *m_backend;
@@ -104,6 +104,20 @@ bool QUACppNode::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringPa
                                      Q_ARG(QVariant, value));
 }
 
+bool QUACppNode::setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                              const QVector<quint32> &linksToRemove)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "setTriggering",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr),
+                                     Q_ARG(QVector<quint32>, linksToAdd),
+                                     Q_ARG(QVector<quint32>, linksToRemove));
+}
+
 bool QUACppNode::browse(const QOpcUaBrowseRequest &request)
 {
     if (!m_client)
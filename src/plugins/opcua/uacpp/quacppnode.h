@@ -50,6 +50,8 @@ public:
     bool enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings) override;
     bool disableMonitoring(QOpcUa::NodeAttributes attr) override;
     bool modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, const QVariant &value) override;
+    bool setTriggering(QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                       const QVector<quint32> &linksToRemove) override;
     bool browse(const QOpcUaBrowseRequest &request);
 
     QString nodeId() const override;
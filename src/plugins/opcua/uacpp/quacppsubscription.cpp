@@ -38,6 +38,8 @@
 #include "qopcualiteraloperand.h"
 #include "qopcuaeventfilterresult.h"
 
+#include <private/qopcuaeventrecord_p.h>
+
 #include <QtCore/QLoggingCategory>
 
 #include <uasession.h>
@@ -165,6 +167,8 @@ bool QUACppSubscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeA
     const auto value = qMakePair(createResults[0], parameters);
     m_monitoredItems.insert(key, value);
     m_monitoredIds.insert(monitorId, key);
+    if (attr == QOpcUa::NodeAttribute::EventNotifier)
+        m_eventLayouts.insert(key, QOpcUaEventRecordLayout::fromFilter(parameters.filter()));
     monitorId++;
 
     if (UaNodeId(createResults[0].FilterResult.TypeId.NodeId) == UaNodeId(OpcUaId_EventFilterResult_Encoding_DefaultBinary, 0))
@@ -256,6 +260,54 @@ void QUACppSubscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute
     emit m_backend->monitoringStatusChanged(handle, attr, item, p);
 }
 
+void QUACppSubscription::setTriggering(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                                       const QVector<quint32> &linksToRemove)
+{
+    const auto key = qMakePair(nodeHandle, attr);
+
+    if (!m_monitoredItems.contains(key)) {
+        qCWarning(QT_OPCUA_PLUGINS_UACPP, "Could not set triggering, there are no monitored items");
+        emit m_backend->setTriggeringFinished(nodeHandle, attr, linksToAdd, linksToRemove, QVector<QOpcUa::UaStatusCode>(),
+                                              QVector<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+        return;
+    }
+
+    UaUInt32Array add;
+    add.create(linksToAdd.size());
+    for (int i = 0; i < linksToAdd.size(); ++i)
+        add[i] = linksToAdd.at(i);
+
+    UaUInt32Array remove;
+    remove.create(linksToRemove.size());
+    for (int i = 0; i < linksToRemove.size(); ++i)
+        remove[i] = linksToRemove.at(i);
+
+    ServiceSettings service;
+    UaStatusCodeArray addResults;
+    UaDiagnosticInfos addDiagnosticInfos;
+    UaStatusCodeArray removeResults;
+    UaDiagnosticInfos removeDiagnosticInfos;
+    UaStatus result = m_nativeSubscription->setTriggering(service, m_monitoredItems[key].first.MonitoredItemId, add, remove,
+                                                          addResults, addDiagnosticInfos, removeResults, removeDiagnosticInfos);
+
+    QVector<QOpcUa::UaStatusCode> addStatus;
+    QVector<QOpcUa::UaStatusCode> removeStatus;
+
+    if (result.isNotGood()) {
+        qCWarning(QT_OPCUA_PLUGINS_UACPP) << "Failed to set triggering:" << result.statusCode();
+    } else {
+        addStatus.reserve(static_cast<int>(addResults.length()));
+        for (quint32 i = 0; i < addResults.length(); ++i)
+            addStatus.append(static_cast<QOpcUa::UaStatusCode>(addResults[i]));
+        removeStatus.reserve(static_cast<int>(removeResults.length()));
+        for (quint32 i = 0; i < removeResults.length(); ++i)
+            removeStatus.append(static_cast<QOpcUa::UaStatusCode>(removeResults[i]));
+    }
+
+    emit m_backend->setTriggeringFinished(nodeHandle, attr, linksToAdd, linksToRemove, addStatus, removeStatus,
+                                          static_cast<QOpcUa::UaStatusCode>(result.statusCode()));
+}
+
 bool QUACppSubscription::removeAttributeMonitoredItem(quint64 nodeHandle, QOpcUa::NodeAttribute attr)
 {
     qCDebug(QT_OPCUA_PLUGINS_UACPP) << "Removing monitored Item for" << attr;
@@ -267,6 +319,7 @@ bool QUACppSubscription::removeAttributeMonitoredItem(quint64 nodeHandle, QOpcUa
     }
 
     auto monitoredItem = m_monitoredItems.take(pair);
+    m_eventLayouts.remove(pair);
     UaStatus result;
     ServiceSettings settings;
 
@@ -330,14 +383,13 @@ void QUACppSubscription::dataChange(OpcUa_UInt32 clientSubscriptionHandle, const
         if (!m_monitoredIds.contains(monitorId))
             continue;
 
-        QOpcUaReadResult temp;
+        QOpcUaDataValue temp;
         temp.setValue(var);
-        temp.setServerTimestamp(QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.ServerTimestamp));
-        temp.setSourceTimestamp(QUACppValueConverter::toQDateTime(&dataNotifications[i].Value.SourceTimestamp));
-        temp.setAttribute(m_monitoredIds[monitorId].second);
-        temp.setStatusCode(QOpcUa::UaStatusCode::Good);
+        temp.setStatusCode(static_cast<QOpcUa::UaStatusCode>(dataNotifications[i].Value.StatusCode));
+        temp.setServerTimestampTicks(QUACppValueConverter::toTicks(&dataNotifications[i].Value.ServerTimestamp));
+        temp.setSourceTimestampTicks(QUACppValueConverter::toTicks(&dataNotifications[i].Value.SourceTimestamp));
 
-        emit m_backend->dataChangeOccurred(m_monitoredIds[monitorId].first, temp);
+        emit m_backend->dataChangeOccurred(m_monitoredIds[monitorId].first, m_monitoredIds[monitorId].second, temp);
     }
 }
 
@@ -345,10 +397,15 @@ void QUACppSubscription::newEvents(OpcUa_UInt32 clientSubscriptionHandle, UaEven
 {
     Q_UNUSED(clientSubscriptionHandle);
 
+    // The events of one publish response are delivered in one signal per monitored item
+    QHash<quint64, QVector<QOpcUaEventRecord>> events;
+    QVector<quint64> handles;
+
     for (quint32 i = 0; i < eventFieldList.length(); ++i) {
         const quint32 monitorId = eventFieldList[i].ClientHandle;
 
-        if (!m_monitoredIds.contains(monitorId))
+        const auto key = m_monitoredIds.constFind(monitorId);
+        if (key == m_monitoredIds.constEnd())
             continue;
 
         QVariantList eventFields;
@@ -356,8 +413,17 @@ void QUACppSubscription::newEvents(OpcUa_UInt32 clientSubscriptionHandle, UaEven
         for (int j = 0; j < eventFieldList[i].NoOfEventFields; ++j)
             eventFields.append(QUACppValueConverter::toQVariant(eventFieldList[i].EventFields[j]));
 
-        emit m_backend->eventOccurred(m_monitoredIds[monitorId].first, eventFields);
+        const quint64 handle = key->first;
+        auto it = events.find(handle);
+        if (it == events.end()) {
+            it = events.insert(handle, QVector<QOpcUaEventRecord>());
+            handles.push_back(handle);
+        }
+        it->push_back(QOpcUaEventRecordPrivate::create(m_eventLayouts.value(key.value()), eventFields));
     }
+
+    for (const quint64 handle : qAsConst(handles))
+        emit m_backend->eventsOccurred(handle, events.take(handle));
 }
 
 OpcUa_ExtensionObject QUACppSubscription::createFilter(const QVariant &filterData)
@@ -755,6 +821,8 @@ bool QUACppSubscription::modifyMonitoredItemParameters(quint64 nodeHandle, QOpcU
                     p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
                 else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
                     p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
+                if (attr == QOpcUa::NodeAttribute::EventNotifier)
+                    m_eventLayouts.insert(key, QOpcUaEventRecordLayout::fromFilter(p.filter()));
                 if (UaNodeId(results[0].FilterResult.TypeId.NodeId) == UaNodeId(OpcUaId_EventFilterResult_Encoding_DefaultBinary, 0))
                     p.setFilterResult(convertEventFilterResult(results[0].FilterResult));
             }
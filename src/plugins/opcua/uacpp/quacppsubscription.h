@@ -35,8 +35,12 @@
 #include <uanodeid.h>
 #include <uasubscription.h>
 
+#include <QtCore/qsharedpointer.h>
+
 QT_BEGIN_NAMESPACE
 
+class QOpcUaEventRecordLayout;
+
 class QUACppSubscription : public UaClientSdk::UaSubscriptionCallback
 {
 public:
@@ -49,6 +53,8 @@ public:
 
     bool addAttributeMonitoredItem(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const UaNodeId &id, QOpcUaMonitoringParameters parameters);
     void modifyMonitoring(quint64 nodeHandle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void setTriggering(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QVector<quint32> &linksToAdd,
+                       const QVector<quint32> &linksToRemove);
     bool removeAttributeMonitoredItem(quint64 nodeHandle, QOpcUa::NodeAttribute attr);
 
     double interval() const;
@@ -76,6 +82,7 @@ private:
     QHash<QPair<quint64, QOpcUa::NodeAttribute>,
         QPair<OpcUa_MonitoredItemCreateResult, QOpcUaMonitoringParameters>> m_monitoredItems;
     QHash<quint32, QPair<quint64, QOpcUa::NodeAttribute>> m_monitoredIds;
+    QHash<QPair<quint64, QOpcUa::NodeAttribute>, QSharedPointer<const QOpcUaEventRecordLayout>> m_eventLayouts;
 };
 
 QT_END_NAMESPACE
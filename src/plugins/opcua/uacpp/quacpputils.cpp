@@ -30,6 +30,7 @@
 #include "quacpputils.h"
 
 #include <QtOpcUa/qopcuatype.h>
+#include <private/qopcuanodeids_p.h>
 
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QString>
@@ -46,6 +47,10 @@ namespace UACppUtils {
 
 UaNodeId nodeIdFromQString(const QString &name)
 {
+    quint32 namespace0Id = 0;
+    if (QOpcUaNodeIdsPrivate::namespace0NumericId(name, &namespace0Id))
+        return UaNodeId(static_cast<OpcUa_UInt32>(namespace0Id), 0);
+
     quint16 index = 0;
     char identifierType = 0;
     QString identifierString;
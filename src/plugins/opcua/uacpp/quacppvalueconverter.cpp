@@ -31,6 +31,7 @@
 #include "quacpputils.h"
 
 #include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuaextensionobjectdecoderregistry.h>
 #include <QtOpcUa/qopcuamultidimensionalarray.h>
 
 #include <QtCore/QDateTime>
@@ -238,6 +239,17 @@ QVariant scalarToQVariant<QVariant, OpcUa_ExtensionObject>(OpcUa_ExtensionObject
         const UaExpandedNodeId uaExpandedNodeId(data->TypeId);
         const UaNodeId uaTypeId(uaExpandedNodeId.nodeId());
         obj.setEncodingTypeId(UACppUtils::nodeIdToQString(uaTypeId));
+
+        // Decoders registered by the application work directly on the received body
+        if (!QOpcUaExtensionObjectDecoderRegistry::isEmpty()) {
+            bool success = false;
+            const QByteArray body = QByteArray::fromRawData(reinterpret_cast<const char *>(data->Body.Binary.Data),
+                                                            data->Body.Binary.Length);
+            const QVariant result = QOpcUaExtensionObjectDecoderRegistry::decode(obj.encodingTypeId(), body, &success);
+            if (success)
+                return result;
+        }
+
         // Copy data for later use
         obj.setEncodedBody(QByteArray(reinterpret_cast<char*>(data->Body.Binary.Data), data->Body.Binary.Length));
         return obj;
@@ -988,6 +1000,12 @@ QDateTime toQDateTime(const OpcUa_DateTime *dt)
     return uaEpochStart.addMSecs(((quint64)temp) / 10000).toLocalTime();
 }
 
+qint64 toTicks(const OpcUa_DateTime *dt)
+{
+    // OpcUa_DateTime is a FILETIME, which uses the same 100ns ticks since 1601 as QOpcUaDataValue
+    return (static_cast<qint64>(dt->dwHighDateTime) << 32) | dt->dwLowDateTime;
+}
+
 OpcUa_DateTime toUACppDateTime(const QDateTime &qtDateTime)
 {
     // OPC-UA part 3, Table C.9
@@ -66,6 +66,7 @@ namespace QUACppValueConverter {
     OpcUa_Variant arrayFromQVariant(const QVariant &var, const OpcUa_BuiltInType type);
 
     QDateTime toQDateTime(const OpcUa_DateTime *dt);
+    qint64 toTicks(const OpcUa_DateTime *dt);
     OpcUa_DateTime toUACppDateTime(const QDateTime &qtDateTime);
 
     UaStringArray toUaStringArray(const QStringList &value);
@@ -8,4 +8,10 @@ qtHaveModule(qmltest):qtConfig(open62541)|qtConfig(uacpp) {
     SUBDIRS += declarative
 }
 
+# the HistoryRead types of the open62541 plugin are tested without a server
+qtConfig(open62541): SUBDIRS += open62541history
+
+# the generated header of a nodeset fixture is compiled and tested without a server
+qtConfig(nodesetgenerator): SUBDIRS += nodesetgenerator
+
 qtConfig(ssl):!darwin:!winrt: SUBDIRS += x509
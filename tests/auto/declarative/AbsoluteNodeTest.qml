@@ -228,6 +228,125 @@ Item {
         }
     }
 
+    CompletionLoggingTestCase {
+        name: parent.parent.testName + ": " + backendName + ": Monitoring of Shared Value Nodes"
+        when: sharedNode1.readyToUse && sharedNode2.readyToUse && shouldRun
+
+        function test_nodeTest() {
+            tryCompare(sharedNode1, "monitored", true);
+            compare(sharedNode2.monitored, false);
+            compare(sharedNode1.value, sharedNode2.value);
+
+            // Both nodes share one node and one monitored item
+            var monitoringRequests = testSetup.nodeRegistryProperty(connection, "monitoringRequestCount");
+            sharedNode2.monitored = true;
+            tryCompare(sharedNode2, "monitored", true);
+            compare(testSetup.nodeRegistryProperty(connection, "monitoringRequestCount"), monitoringRequests);
+            compare(sharedNode2.publishingInterval, sharedNode1.publishingInterval);
+
+            // Disabling monitoring for one node keeps it enabled for the other one
+            sharedNode1.monitored = false;
+            tryCompare(sharedNode1, "monitored", false);
+            wait(100);
+            compare(sharedNode2.monitored, true);
+
+            var oldValue = sharedNode2.value;
+            sharedNode2SpyValue.clear();
+            writerNode.value = oldValue + 1;
+            sharedNode2SpyValue.wait();
+            compare(sharedNode2.value, oldValue + 1);
+
+            sharedNode1.monitored = true;
+            tryCompare(sharedNode1, "monitored", true);
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: sharedNode1
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: sharedNode2
+            monitored: false
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "Test Namespace"
+                identifier: "s=TestNode.ReadWrite"
+            }
+            id: writerNode
+            monitored: false
+        }
+
+        SignalSpy {
+            id: sharedNode2SpyValue
+            target: sharedNode2
+            signalName: "valueChanged"
+        }
+    }
+
+    CompletionLoggingTestCase {
+        name: parent.parent.testName + ": " + backendName + ": Shared Value Nodes use one read and one monitored item"
+        when: node1.readyToUse && shouldRun
+
+        function registryValue(name) {
+            return testSetup.nodeRegistryProperty(connection, name);
+        }
+
+        function test_nodeTest() {
+            var sharedNodes = registryValue("sharedNodeCount");
+            var readRequests = registryValue("readRequestCount");
+            var monitoringRequests = registryValue("monitoringRequestCount");
+
+            var nodes = [];
+            for (var i = 0; i < 3; ++i) {
+                // The last node asks for another publishing interval and gets the one of the existing monitored item
+                var node = identicalNodeComponent.createObject(this, { "publishingInterval": i < 2 ? 100 : 500 });
+                verify(node);
+                nodes.push(node);
+            }
+
+            for (i = 0; i < nodes.length; ++i) {
+                tryCompare(nodes[i], "readyToUse", true);
+                tryCompare(nodes[i], "monitored", true);
+                compare(nodes[i].value, nodes[0].value);
+            }
+
+            compare(registryValue("sharedNodeCount"), sharedNodes + 1);
+            compare(registryValue("readRequestCount"), readRequests + 1);
+            compare(registryValue("monitoringRequestCount"), monitoringRequests + 1);
+            for (i = 0; i < nodes.length; ++i)
+                tryCompare(nodes[i], "publishingInterval", nodes[0].publishingInterval);
+
+            for (i = 0; i < nodes.length; ++i)
+                nodes[i].destroy();
+            tryVerify(function() { return registryValue("sharedNodeCount") === sharedNodes; });
+        }
+
+        Component {
+            id: identicalNodeComponent
+
+            QtOpcUa.ValueNode {
+                connection: connection
+                nodeId: QtOpcUa.NodeId {
+                    ns: "http://qt-project.org"
+                    identifier: "s=Demo.Static.Scalar.Int16"
+                }
+            }
+        }
+    }
+
     CompletionLoggingTestCase {
         name: parent.parent.testName + ": " + backendName + ": Emitting signals on node changes"
         when: node8.readyToUse && shouldRun
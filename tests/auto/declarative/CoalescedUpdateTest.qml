@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.3
+import QtTest 1.0
+import QtOpcUa 5.15 as QtOpcUa
+
+Item {
+    property string backendName
+    property int completedTestCases: 0
+    property int availableTestCases: 0
+    property bool completed: completedTestCases == availableTestCases && availableTestCases > 0
+    property bool shouldRun: false
+
+    onShouldRunChanged: {
+        if (shouldRun)
+            console.log("Running", parent.testName, "with", backendName);
+    }
+
+    QtOpcUa.Connection {
+        id: connection
+        backend: backendName
+        defaultConnection: true
+    }
+
+    QtOpcUa.ServerDiscovery {
+        id: serverDiscovery
+        onServersChanged: {
+            if (!count)
+                return;
+            endpointDiscovery.serverUrl = at(0).discoveryUrls[0];
+        }
+
+        Binding on discoveryUrl {
+            when: shouldRun && Component.completed
+            value: OPCUA_DISCOVERY_URL
+        }
+    }
+
+    QtOpcUa.EndpointDiscovery {
+        id: endpointDiscovery
+        onEndpointsChanged: {
+            if (!count)
+                return;
+            connection.connectToEndpoint(at(0));
+        }
+    }
+
+    Component.onCompleted: {
+        for (var i in children) {
+            if (children[i].objectName == "TestCase")
+                availableTestCases += 1;
+        }
+    }
+
+    CompletionLoggingTestCase {
+        id: coalescedTestCase
+        name: parent.parent.testName + ": " + backendName + ": Coalesced Updates"
+        when: node1.readyToUse && node2.readyToUse && shouldRun
+
+        // Times of the valueChanged signals of node1 in milliseconds
+        property var deliveryTimes: []
+
+        function test_coalescedUpdates() {
+            tryCompare(node1, "monitored", true);
+            compare(node1.updateMode, QtOpcUa.ValueNode.Coalesced);
+            compare(node1.maximumUpdateRate, 2);
+            compare(node2.updateMode, QtOpcUa.ValueNode.Immediate);
+            compare(node2.maximumUpdateRate, 0);
+            tryCompare(node1, "value", 1.0);
+
+            // The writes are spaced wider than the publishing interval, so the server reports each of them.
+            // The rate limit of two updates per second delivers fewer changes than written.
+            node1ValueSpy.clear();
+            deliveryTimes = [];
+            var writes = 6;
+            for (var i = 0; i < writes; ++i) {
+                node2.value = 2.0 + i;
+                wait(150);
+            }
+            var lastValue = 2.0 + writes - 1;
+
+            // The last value of a burst of changes is always delivered
+            tryCompare(node1, "value", lastValue);
+            tryVerify(function() { return node1ValueSpy.count > 0 && node1ValueSpy.signalArguments[node1ValueSpy.count - 1][0] === lastValue; });
+            verify(node1ValueSpy.count < writes, "Expected fewer than " + writes + " updates, got " + node1ValueSpy.count);
+            compare(deliveryTimes.length, node1ValueSpy.count);
+
+            // The burst is longer than the rate limit, so there are at least two updates.
+            // The last value waits for the rate limit, 1 ms of tolerance covers the different clocks.
+            verify(deliveryTimes.length > 1);
+            var minimumInterval = 1000 / node1.maximumUpdateRate;
+            var interval = deliveryTimes[deliveryTimes.length - 1] - deliveryTimes[deliveryTimes.length - 2];
+            verify(interval >= minimumInterval - 1, "The last update came " + interval + " ms after the previous one");
+
+            // Switching to immediate mode delivers changes without delay
+            node1.updateMode = QtOpcUa.ValueNode.Immediate;
+            node1ValueSpy.clear();
+            node2.value = 1.0;
+            node1ValueSpy.wait();
+            compare(node1.value, 1.0);
+            compare(node1ValueSpy.count, 1);
+
+            node1.updateMode = QtOpcUa.ValueNode.Coalesced;
+        }
+
+        SignalSpy {
+            id: node1ValueSpy
+            target: node1
+            signalName: "valueChanged"
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "http://qt-project.org"
+                identifier: "s=Demo.Static.Scalar.Double"
+            }
+            id: node1
+            updateMode: QtOpcUa.ValueNode.Coalesced
+            maximumUpdateRate: 2
+            onValueChanged: coalescedTestCase.deliveryTimes.push(Date.now())
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "http://qt-project.org"
+                identifier: "s=Demo.Static.Scalar.Double"
+            }
+            id: node2
+            monitored: false
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.3
+import QtTest 1.0
+import QtOpcUa 5.15 as QtOpcUa
+
+Item {
+    property string backendName
+    property int completedTestCases: 0
+    property int availableTestCases: 0
+    property bool completed: completedTestCases == availableTestCases && availableTestCases > 0
+    property bool shouldRun: false
+
+    onShouldRunChanged: {
+        if (shouldRun)
+            console.log("Running", parent.testName, "with", backendName);
+    }
+
+    QtOpcUa.Connection {
+        id: connection
+        backend: backendName
+        defaultConnection: true
+    }
+
+    QtOpcUa.ServerDiscovery {
+        id: serverDiscovery
+        onServersChanged: {
+            if (!count)
+                return;
+            endpointDiscovery.serverUrl = at(0).discoveryUrls[0];
+        }
+
+        Binding on discoveryUrl {
+            when: shouldRun && Component.completed
+            value: OPCUA_DISCOVERY_URL
+        }
+    }
+
+    QtOpcUa.EndpointDiscovery {
+        id: endpointDiscovery
+        onEndpointsChanged: {
+            if (!count)
+                return;
+            connection.connectToEndpoint(at(0));
+        }
+    }
+
+    Component.onCompleted: {
+        for (var i in children) {
+            if (children[i].objectName == "TestCase")
+                availableTestCases += 1;
+        }
+    }
+
+    CompletionLoggingTestCase {
+        name: parent.parent.testName + ": " + backendName + ": Tag Model"
+        when: writeNode.readyToUse && shouldRun
+
+        function test_tagModel() {
+            compare(tagModel.count, 3);
+            compare(tagModel.publishingInterval, 50);
+            tryCompare(delegates, "count", 3);
+            compare(delegates.itemAt(0).tagNodeId, "ns=2;s=Demo.Static.Scalar.Double");
+
+            tryVerify(function() { return delegates.itemAt(1).tagValue !== undefined; });
+            tryCompare(delegates.itemAt(2), "tagStatus", QtOpcUa.Status.BadNodeIdUnknown);
+
+            writeNode.value = 21.0;
+            tryCompare(delegates.itemAt(0), "tagValue", 21.0);
+            compare(delegates.itemAt(0).tagStatus, QtOpcUa.Status.Good);
+
+            tagModel.nodeIds = [ "ns=2;s=Demo.Static.Scalar.Double" ];
+            compare(tagModel.count, 1);
+            tryCompare(delegates, "count", 1);
+            tryCompare(delegates.itemAt(0), "tagValue", 21.0);
+        }
+
+        QtOpcUa.TagModel {
+            id: tagModel
+            connection: connection
+            publishingInterval: 50
+            nodeIds: [ "ns=2;s=Demo.Static.Scalar.Double",
+                       "ns=2;s=Demo.Static.Scalar.Int32",
+                       "ns=2;s=Demo.Static.Scalar.DoesNotExist" ]
+        }
+
+        Repeater {
+            id: delegates
+            model: tagModel
+            delegate: Item {
+                property string tagNodeId: nodeId
+                property var tagValue: value
+                property int tagStatus: statusCode.status
+            }
+        }
+
+        QtOpcUa.ValueNode {
+            connection: connection
+            nodeId: QtOpcUa.NodeId {
+                ns: "http://qt-project.org"
+                identifier: "s=Demo.Static.Scalar.Double"
+            }
+            id: writeNode
+            monitored: false
+        }
+    }
+}
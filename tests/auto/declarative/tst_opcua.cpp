@@ -119,6 +119,17 @@ public slots:
 #endif
         engine->rootContext()->setContextProperty("SERVER_SUPPORTS_SECURITY", value);
         engine->rootContext()->setContextProperty("OPCUA_DISCOVERY_URL", m_opcuaDiscoveryUrl);
+        engine->rootContext()->setContextProperty("testSetup", this);
+    }
+    // Returns a statistics property of the node registry of a QML connection
+    QVariant nodeRegistryProperty(QObject *connection, const QString &name) const {
+        if (!connection)
+            return QVariant();
+        for (const QObject *child : connection->children()) {
+            if (qstrcmp(child->metaObject()->className(), "OpcUaNodeRegistry") == 0)
+                return child->property(name.toLatin1().constData());
+        }
+        return QVariant();
     }
     void cleanupTestCase() {
         if (m_serverProcess.state() == QProcess::Running) {
@@ -0,0 +1,10 @@
+TARGET = tst_nodesetgenerator
+
+QT += testlib opcua
+QT -= gui
+CONFIG += testcase qtopcua_nodeset
+
+OPCUA_NODESETS += Fixture.NodeSet2.xml
+
+SOURCES += \
+    tst_nodesetgenerator.cpp
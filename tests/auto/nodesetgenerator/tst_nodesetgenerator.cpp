@@ -0,0 +1,215 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "fixture_nodeset.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuaextensionobjectdecoderregistry.h>
+
+#include <QtTest/QtTest>
+
+// The header is generated from Fixture.NodeSet2.xml by qtopcua-nodesetgenerator at build time
+class Tst_NodeSetGenerator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void structureRoundTrip();
+    void selfReferencingStructure();
+    void decoderRegistration();
+    void namespaceMapping();
+    void unknownNamespace();
+
+private:
+    Fixture::Polygon createPolygon() const;
+};
+
+Fixture::Polygon Tst_NodeSetGenerator::createPolygon() const
+{
+    Fixture::Polygon polygon;
+    polygon.name = QStringLiteral("Square");
+    polygon.shape = Fixture::Shape::Square;
+    for (const auto &coordinates : {qMakePair(0.0, 0.0), qMakePair(1.0, 0.0), qMakePair(1.0, 1.0), qMakePair(0.0, 1.0)}) {
+        Fixture::Point point;
+        point.x = coordinates.first;
+        point.y = coordinates.second;
+        polygon.vertices.push_back(point);
+    }
+    polygon.comment = QStringLiteral("c");
+    polygon.commentSpecified = true;
+    return polygon;
+}
+
+void Tst_NodeSetGenerator::structureRoundTrip()
+{
+    const Fixture::Polygon polygon = createPolygon();
+
+    QByteArray data;
+    QOpcUaBinaryDataEncoding encoder(&data);
+    QVERIFY(encoder.encode<Fixture::Polygon>(polygon));
+
+    // Encoding mask, name, four points, enumeration value and the optional comment
+    QCOMPARE(data.size(), 4 + (4 + 6) + (4 + 4 * 16) + 4 + (4 + 1));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize<Fixture::Polygon>(polygon), qint64(data.size()));
+
+    bool success = false;
+    QOpcUaBinaryDataEncoding decoder(&data);
+    const Fixture::Polygon decoded = decoder.decode<Fixture::Polygon>(success);
+    QVERIFY(success);
+    QCOMPARE(decoder.offset(), data.size());
+    QCOMPARE(decoded.name, polygon.name);
+    QCOMPARE(decoded.shape, Fixture::Shape::Square);
+    QCOMPARE(decoded.vertices.size(), polygon.vertices.size());
+    for (int i = 0; i < polygon.vertices.size(); ++i) {
+        QCOMPARE(decoded.vertices.at(i).x, polygon.vertices.at(i).x);
+        QCOMPARE(decoded.vertices.at(i).y, polygon.vertices.at(i).y);
+    }
+    QVERIFY(decoded.commentSpecified);
+    QCOMPARE(decoded.comment, polygon.comment);
+
+    // Without the optional field, the encoding mask is zero and the comment is omitted
+    Fixture::Polygon withoutComment = polygon;
+    withoutComment.commentSpecified = false;
+    data.clear();
+    QOpcUaBinaryDataEncoding encoder2(&data);
+    QVERIFY(encoder2.encode<Fixture::Polygon>(withoutComment));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize<Fixture::Polygon>(withoutComment), qint64(data.size()));
+    QOpcUaBinaryDataEncoding decoder2(&data);
+    QVERIFY(!decoder2.decode<Fixture::Polygon>(success).commentSpecified);
+    QVERIFY(success);
+
+    // Truncated data must fail
+    data.chop(1);
+    QOpcUaBinaryDataEncoding decoder3(&data);
+    decoder3.decode<Fixture::Polygon>(success);
+    QVERIFY(!success);
+}
+
+void Tst_NodeSetGenerator::selfReferencingStructure()
+{
+    Fixture::TreeNode root;
+    root.value = 1;
+    Fixture::TreeNode child;
+    child.value = 2;
+    root.children.push_back(child);
+
+    QByteArray data;
+    QOpcUaBinaryDataEncoding encoder(&data);
+    QVERIFY(encoder.encode<Fixture::TreeNode>(root));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize<Fixture::TreeNode>(root), qint64(data.size()));
+
+    bool success = false;
+    QOpcUaBinaryDataEncoding decoder(&data);
+    const Fixture::TreeNode decoded = decoder.decode<Fixture::TreeNode>(success);
+    QVERIFY(success);
+    QCOMPARE(decoded.value, 1);
+    QCOMPARE(decoded.children.size(), 1);
+    QCOMPARE(decoded.children.at(0).value, 2);
+    QVERIFY(decoded.children.at(0).children.isEmpty());
+}
+
+void Tst_NodeSetGenerator::decoderRegistration()
+{
+    const QStringList namespaceArray = {QStringLiteral("http://opcfoundation.org/UA/"),
+                                        QStringLiteral("http://qt-project.org/opcua/tests/fixture/")};
+    const Fixture::Namespaces namespaces(namespaceArray);
+    Fixture::registerDecoders(namespaces);
+
+    const QString encodingId = namespaces.nodeId(Fixture::NodeIds::Polygon_Encoding_DefaultBinary);
+    QCOMPARE(encodingId, QStringLiteral("ns=1;i=5001"));
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::hasDecoder(encodingId));
+
+    QByteArray data;
+    QOpcUaBinaryDataEncoding encoder(&data);
+    QVERIFY(encoder.encode<Fixture::Polygon>(createPolygon()));
+
+    bool success = false;
+    const QVariant result = QOpcUaExtensionObjectDecoderRegistry::decode(encodingId, data, &success);
+    QVERIFY(success);
+    QVERIFY(result.canConvert<Fixture::Polygon>());
+    QCOMPARE(result.value<Fixture::Polygon>().vertices.size(), 4);
+
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(encodingId));
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(namespaces.nodeId(Fixture::NodeIds::Point_Encoding_DefaultBinary)));
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(namespaces.nodeId(Fixture::NodeIds::TreeNode_Encoding_DefaultBinary)));
+}
+
+void Tst_NodeSetGenerator::namespaceMapping()
+{
+    const QStringList namespaceArray = {QStringLiteral("http://opcfoundation.org/UA/"),
+                                        QStringLiteral("urn:server"),
+                                        QStringLiteral("http://qt-project.org/opcua/tests/fixture/"),
+                                        QStringLiteral("http://qt-project.org/opcua/tests/fixture/extra/")};
+    const Fixture::Namespaces namespaces(namespaceArray);
+    QVERIFY(namespaces.isValid());
+    QCOMPARE(namespaces.namespaceIndex(1), 2);
+    QCOMPARE(namespaces.namespaceIndex(2), 3);
+
+    QCOMPARE(namespaces.nodeId(Fixture::NodeIds::Machine), QStringLiteral("ns=2;i=6001"));
+    QCOMPARE(namespaces.nodeId(Fixture::NodeIds::Machine_Outline), QStringLiteral("ns=2;s=Machine.Outline"));
+
+    QCOMPARE(namespaces.startNodeId(Fixture::BrowsePaths::Machine_Outline), QStringLiteral("ns=0;i=85"));
+    const auto path = namespaces.relativePath(Fixture::BrowsePaths::Machine_Outline);
+    QCOMPARE(path.size(), 2);
+    QCOMPARE(path.at(0).targetName(), QOpcUaQualifiedName(2, QStringLiteral("Machine")));
+    QCOMPARE(path.at(0).referenceTypeId(), QStringLiteral("ns=0;i=35"));
+    QCOMPARE(path.at(1).targetName(), QOpcUaQualifiedName(3, QStringLiteral("Outline")));
+    QCOMPARE(path.at(1).referenceTypeId(), QStringLiteral("ns=0;i=47"));
+}
+
+void Tst_NodeSetGenerator::unknownNamespace()
+{
+    // The second namespace of the nodeset is missing, its local index maps to -1
+    const QStringList namespaceArray = {QStringLiteral("http://opcfoundation.org/UA/"),
+                                        QStringLiteral("http://qt-project.org/opcua/tests/fixture/")};
+    const Fixture::Namespaces namespaces(namespaceArray);
+    QVERIFY(!namespaces.isValid());
+    QCOMPARE(namespaces.namespaceIndex(2), -1);
+
+    // Node ids in a known namespace still work
+    QCOMPARE(namespaces.nodeId(Fixture::NodeIds::Machine_Outline), QStringLiteral("ns=1;s=Machine.Outline"));
+
+    // The browse name of Outline can't be resolved, no path with a namespace index of -1 is created
+    QVERIFY(namespaces.relativePath(Fixture::BrowsePaths::Machine_Outline).isEmpty());
+    QCOMPARE(namespaces.relativePath(Fixture::BrowsePaths::Machine).size(), 1);
+
+    const Fixture::NodeId unknown = {2, 1, nullptr};
+    QVERIFY(namespaces.nodeId(unknown).isEmpty());
+}
+
+QTEST_GUILESS_MAIN(Tst_NodeSetGenerator)
+
+#include "tst_nodesetgenerator.moc"
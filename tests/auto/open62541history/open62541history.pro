@@ -0,0 +1,20 @@
+TARGET = tst_open62541history
+
+QT += testlib opcua-private
+QT -= gui
+CONFIG += testcase
+
+INCLUDEPATH += \
+    $$PWD/../../../src/plugins/opcua/open62541
+
+qtConfig(open62541):!qtConfig(system-open62541) {
+    include($$PWD/../../../src/3rdparty/open62541.pri)
+} else {
+    QMAKE_USE_PRIVATE += open62541
+}
+
+SOURCES += \
+    tst_open62541history.cpp \
+    $$PWD/../../../src/plugins/opcua/open62541/qopen62541historytypes.cpp \
+    $$PWD/../../../src/plugins/opcua/open62541/qopen62541utils.cpp \
+    $$PWD/../../../src/plugins/opcua/open62541/qopen62541valueconverter.cpp
@@ -0,0 +1,216 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541historytypes.h"
+
+#include <QtOpcUa/qopcuadatavalue.h>
+
+#include <QtTest/QtTest>
+
+using namespace QOpen62541HistoryTypes;
+
+// 2019-03-04T12:13:14.1234567Z in OPC UA DateTime ticks
+static const UA_DateTime sourceTicks = UA_DateTime(131961751941234567);
+static const UA_DateTime serverTicks = sourceTicks + 1;
+
+static void setDataValue(UA_DataValue *target, UA_Double value, UA_StatusCode status, UA_DateTime sourceTimestamp)
+{
+    UA_Variant_setScalarCopy(&target->value, &value, &UA_TYPES[UA_TYPES_DOUBLE]);
+    target->hasValue = true;
+    target->status = status;
+    target->hasStatus = true;
+    target->sourceTimestamp = sourceTimestamp;
+    target->hasSourceTimestamp = true;
+    target->serverTimestamp = sourceTimestamp + 1;
+    target->hasServerTimestamp = true;
+}
+
+class Tst_Open62541History : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void typeIdentity();
+    void convertHistoryData();
+    void convertHistoryModifiedData();
+    void convertUnexpectedType();
+    void convertProcessedHistoryData();
+};
+
+void Tst_Open62541History::typeIdentity()
+{
+    // open62541 may decode into a copy of the type description, only the ids are relevant
+    const UA_DataType copy = types[HistoryDataType];
+    QVERIFY(isType(&types[HistoryDataType], HistoryDataType));
+    QVERIFY(isType(&copy, HistoryDataType));
+    QVERIFY(!isType(&copy, HistoryModifiedDataType));
+    QVERIFY(!isType(&UA_TYPES[UA_TYPES_DATAVALUE], HistoryDataType));
+    QVERIFY(!isType(nullptr, HistoryDataType));
+}
+
+void Tst_Open62541History::convertHistoryData()
+{
+    const UA_DataType typeCopy = types[HistoryDataType];
+
+    HistoryData data;
+    UA_init(&data, &types[HistoryDataType]);
+    data.dataValuesSize = 2;
+    data.dataValues = static_cast<UA_DataValue *>(UA_Array_new(2, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    setDataValue(&data.dataValues[0], 1.5, UA_STATUSCODE_GOOD, sourceTicks);
+    setDataValue(&data.dataValues[1], 2.5, UA_STATUSCODE_BADSENSORFAILURE, sourceTicks + 10000000);
+
+    UA_ExtensionObject obj;
+    UA_ExtensionObject_init(&obj);
+    obj.encoding = UA_EXTENSIONOBJECT_DECODED;
+    obj.content.decoded.type = &typeCopy;
+    obj.content.decoded.data = &data;
+
+    QOpcUaHistoryData result(QStringLiteral("ns=2;s=TestNode"));
+    QOpen62541HistoryTypes::convertHistoryData(obj, result);
+    UA_deleteMembers(&data, &types[HistoryDataType]);
+
+    QCOMPARE(result.count(), 2);
+    QCOMPARE(result.result().at(0).value().toDouble(), 1.5);
+    QCOMPARE(result.result().at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(result.result().at(0).sourceTimestampTicks(), qint64(sourceTicks));
+    QCOMPARE(result.result().at(0).serverTimestampTicks(), qint64(serverTicks));
+    QCOMPARE(result.result().at(1).value().toDouble(), 2.5);
+    QCOMPARE(result.result().at(1).statusCode(), QOpcUa::UaStatusCode::BadSensorFailure);
+    QCOMPARE(result.result().at(1).sourceTimestampTicks(), qint64(sourceTicks + 10000000));
+}
+
+void Tst_Open62541History::convertHistoryModifiedData()
+{
+    const UA_DataType typeCopy = types[HistoryModifiedDataType];
+
+    HistoryModifiedData data;
+    UA_init(&data, &types[HistoryModifiedDataType]);
+    data.dataValuesSize = 1;
+    data.dataValues = static_cast<UA_DataValue *>(UA_Array_new(1, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    setDataValue(&data.dataValues[0], 42, UA_STATUSCODE_GOOD, sourceTicks);
+    data.modificationInfosSize = 1;
+    data.modificationInfos = static_cast<ModificationInfo *>(UA_Array_new(1, &types[ModificationInfoType]));
+    data.modificationInfos[0].modificationTime = serverTicks;
+    data.modificationInfos[0].userName = UA_STRING_ALLOC("user1");
+
+    UA_ExtensionObject obj;
+    UA_ExtensionObject_init(&obj);
+    obj.encoding = UA_EXTENSIONOBJECT_DECODED;
+    obj.content.decoded.type = &typeCopy;
+    obj.content.decoded.data = &data;
+
+    QOpcUaHistoryData result(QStringLiteral("ns=2;s=TestNode"));
+    QOpen62541HistoryTypes::convertHistoryData(obj, result);
+    UA_deleteMembers(&data, &types[HistoryModifiedDataType]);
+
+    QCOMPARE(result.count(), 1);
+    QCOMPARE(result.result().at(0).value().toDouble(), 42.0);
+    QCOMPARE(result.result().at(0).sourceTimestampTicks(), qint64(sourceTicks));
+}
+
+void Tst_Open62541History::convertUnexpectedType()
+{
+    ModificationInfo info;
+    UA_init(&info, &types[ModificationInfoType]);
+
+    UA_ExtensionObject obj;
+    UA_ExtensionObject_init(&obj);
+    obj.encoding = UA_EXTENSIONOBJECT_DECODED;
+    obj.content.decoded.type = &types[ModificationInfoType];
+    obj.content.decoded.data = &info;
+
+    QOpcUaHistoryData result(QStringLiteral("ns=2;s=TestNode"));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("Unable to decode history data")));
+    QOpen62541HistoryTypes::convertHistoryData(obj, result);
+    QCOMPARE(result.count(), 0);
+
+    // An empty body is a valid result without values
+    UA_ExtensionObject_init(&obj);
+    QOpen62541HistoryTypes::convertHistoryData(obj, result);
+    QCOMPARE(result.count(), 0);
+}
+
+void Tst_Open62541History::convertProcessedHistoryData()
+{
+    const UA_DataType typeCopy = types[HistoryDataType];
+
+    HistoryData data;
+    UA_init(&data, &types[HistoryDataType]);
+    data.dataValuesSize = 3;
+    data.dataValues = static_cast<UA_DataValue *>(UA_Array_new(3, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    setDataValue(&data.dataValues[0], 1.5, UA_STATUSCODE_GOOD, sourceTicks);
+    // An aggregate without a value and source timestamp, the server timestamp is used
+    data.dataValues[1].status = UA_STATUSCODE_BADNODATA;
+    data.dataValues[1].hasStatus = true;
+    data.dataValues[1].serverTimestamp = sourceTicks + 36000000000;
+    data.dataValues[1].hasServerTimestamp = true;
+    // Non numeric values are stored as NaN
+    UA_String text = UA_STRING_ALLOC("text");
+    UA_Variant_setScalar(&data.dataValues[2].value, &text, &UA_TYPES[UA_TYPES_STRING]);
+    data.dataValues[2].hasValue = true;
+    data.dataValues[2].sourceTimestamp = sourceTicks + 72000000000;
+    data.dataValues[2].hasSourceTimestamp = true;
+
+    UA_ExtensionObject obj;
+    UA_ExtensionObject_init(&obj);
+    obj.encoding = UA_EXTENSIONOBJECT_DECODED;
+    obj.content.decoded.type = &typeCopy;
+    obj.content.decoded.data = &data;
+
+    QOpcUaProcessedHistoryData result(QStringLiteral("ns=2;s=TestNode"), QStringLiteral("i=2342"));
+    QOpen62541HistoryTypes::convertProcessedHistoryData(obj, result);
+    UA_deleteMembers(&data, &types[HistoryDataType]);
+
+    QCOMPARE(result.count(), 3);
+    // The timestamps keep their 100 ns precision
+    QCOMPARE(result.timestamps(), QVector<qint64>({sourceTicks, sourceTicks + 36000000000, sourceTicks + 72000000000}));
+    QCOMPARE(result.timestamp(0), QDateTime(QDate(2019, 3, 4), QTime(12, 13, 14, 123), Qt::UTC));
+    QCOMPARE(result.value(0), 1.5);
+    QCOMPARE(result.statusCode(0), QOpcUa::UaStatusCode::Good);
+    QVERIFY(qIsNaN(result.value(1)));
+    QCOMPARE(result.statusCode(1), QOpcUa::UaStatusCode::BadNoData);
+    QVERIFY(qIsNaN(result.value(2)));
+    QCOMPARE(result.statusCode(2), QOpcUa::UaStatusCode::Good);
+}
+
+QT_BEGIN_NAMESPACE
+// Warnings from the plugin sources compiled into the test
+Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
+QT_END_NAMESPACE
+
+QTEST_GUILESS_MAIN(Tst_Open62541History)
+
+#include "tst_open62541history.moc"
@@ -41,10 +41,25 @@
 #include <QtOpcUa/QOpcUaNode>
 #include <QtOpcUa/QOpcUaProvider>
 #include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuabrowseresult.h>
+#include <QtOpcUa/qopcuaextensionobjectdecoderregistry.h>
 #include <QtOpcUa/qopcuamultidimensionalarray.h>
+#include <QtOpcUa/qopcuamultidimensionalarrayview.h>
+#include <QtOpcUa/qopcuastructurecodec.h>
+#include <private/qopcuaclient_p.h>
+#include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuaclientsidefilterstage_p.h>
+#include <private/qopcuadatachangequeue_p.h>
+#include <private/qopcuaconditioncache_p.h>
+#include <private/qopcuaeventrecord_p.h>
+#include <private/qopcuamethodcallitem_p.h>
+#include <private/qopcuastringpool_p.h>
+#include <private/qopcuatagmodel_p.h>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDeadlineTimer>
 #include <QtCore/QProcess>
+#include <QtCore/QScopeGuard>
 #include <QtCore/QScopedPointer>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -57,6 +72,20 @@
 
 const int signalSpyTimeout = 10000;
 
+// A user type which only provides an encode() specialization
+struct EncodeOnlyType
+{
+    quint16 value;
+};
+
+QT_BEGIN_NAMESPACE
+template <>
+inline bool QOpcUaBinaryDataEncoding::encode<EncodeOnlyType>(const EncodeOnlyType &src)
+{
+    return encode<quint16>(src.value);
+}
+QT_END_NAMESPACE
+
 class OpcuaConnector
 {
 public:
@@ -392,6 +421,30 @@ private slots:
     void addAndRemoveVariableNode();
     defineDataMethod(addAndRemoveReference_data)
     void addAndRemoveReference();
+    defineDataMethod(addAndRemoveMultipleNodes_data)
+    void addAndRemoveMultipleNodes();
+    defineDataMethod(readHistoryData_data)
+    void readHistoryData();
+    defineDataMethod(readHistoryProcessed_data)
+    void readHistoryProcessed();
+    defineDataMethod(dataChangeQueueOverflow_data)
+    void dataChangeQueueOverflow();
+    defineDataMethod(extensionObjectDecoder_data)
+    void extensionObjectDecoder();
+    defineDataMethod(namespace0Node_data)
+    void namespace0Node();
+    defineDataMethod(stringInterning_data)
+    void stringInterning();
+    defineDataMethod(columnarBrowse_data)
+    void columnarBrowse();
+    defineDataMethod(subscriptionSharding_data)
+    void subscriptionSharding();
+    defineDataMethod(triggeredMonitoredItems_data)
+    void triggeredMonitoredItems();
+    defineDataMethod(modifyMonitoringOfMultipleNodes_data)
+    void modifyMonitoringOfMultipleNodes();
+    defineDataMethod(tagModel_data)
+    void tagModel();
 
     defineDataMethod(dataChangeSubscription_data)
     void dataChangeSubscription();
@@ -403,6 +456,8 @@ private slots:
     void methodCall();
     defineDataMethod(methodCallInvalid_data)
     void methodCallInvalid();
+    defineDataMethod(methodCallBatch_data)
+    void methodCallBatch();
     defineDataMethod(readMethodArguments_data)
     void readMethodArguments();
     defineDataMethod(malformedNodeString_data)
@@ -472,6 +527,10 @@ private slots:
 
     void fixedTimestamp();
     defineDataMethod(fixedTimestamp_data)
+    defineDataMethod(monitoredValueStatus_data)
+    void monitoredValueStatus();
+    defineDataMethod(clientSideFilterMonitoring_data)
+    void clientSideFilterMonitoring();
 
     defineDataMethod(resolveBrowsePath_data)
     void resolveBrowsePath();
@@ -479,6 +538,21 @@ private slots:
     defineDataMethod(extensionObjectWithGuid_data)
     void extensionObjectWithGuid();
 
+    void arithmeticArrayEncoding();
+    void encodedSize();
+    void structureCodec();
+    void extensionObjectDecoderRegistry();
+    void namespace0IdNames();
+    void stringPool();
+    void browseResult();
+    void multiDimensionalArrayTypedStorage();
+    void multiDimensionalArrayView();
+    void clientSideFilterStage();
+    void eventRecord();
+    void conditionCache();
+    void tagModelChangedRanges();
+    void processedHistoryData();
+
     void statusStrings();
 
     // This test case restarts the server. It must be run last to avoid
@@ -1404,6 +1478,765 @@ void Tst_QOpcUaClient::addAndRemoveReference()
     }
 }
 
+void Tst_QOpcUaClient::addAndRemoveMultipleNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("Bulk node management is not implemented in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const int nodeCount = 25;
+    const quint16 namespaceIndex = 3;
+
+    QOpcUaExpandedNodeId parent;
+    parent.setNodeId(QStringLiteral("ns=3;s=TestFolder"));
+
+    QVector<QOpcUaAddNodeItem> nodesToAdd;
+    QStringList nodeIds;
+    for (int i = 0; i < nodeCount; ++i) {
+        const QString name = QStringLiteral("DynamicBulkNode_%1_%2").arg(opcuaClient->backend()).arg(i);
+
+        QOpcUaNodeCreationAttributes attributes;
+        attributes.setDisplayName(QOpcUaLocalizedText("en", name));
+        attributes.setValue(double(i), QOpcUa::Types::Double);
+        attributes.setDataTypeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Double));
+
+        QOpcUaAddNodeItem nodeInfo;
+        nodeInfo.setParentNodeId(parent);
+        nodeInfo.setReferenceTypeId(QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+        nodeInfo.setRequestedNewNodeId(QOpcUaExpandedNodeId(QString(), QStringLiteral("ns=3;s=%1").arg(name)));
+        nodeInfo.setBrowseName(QOpcUaQualifiedName(namespaceIndex, name));
+        nodeInfo.setNodeClass(QOpcUa::NodeClass::Variable);
+        nodeInfo.setNodeAttributes(attributes);
+        nodesToAdd.push_back(nodeInfo);
+        nodeIds.push_back(nodeInfo.requestedNewNodeId().nodeId());
+    }
+
+    QSignalSpy addNodesSpy(opcuaClient, &QOpcUaClient::addNodesFinished);
+    QVERIFY(opcuaClient->addNodes(nodesToAdd));
+    addNodesSpy.wait(signalSpyTimeout);
+    QCOMPARE(addNodesSpy.size(), 1);
+    QCOMPARE(addNodesSpy.at(0).at(3).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const auto assignedNodeIds = addNodesSpy.at(0).at(1).value<QStringList>();
+    const auto addResults = addNodesSpy.at(0).at(2).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(addNodesSpy.at(0).at(0).value<QVector<QOpcUaAddNodeItem>>().size(), nodeCount);
+    QCOMPARE(assignedNodeIds, nodeIds);
+    QCOMPARE(addResults.size(), nodeCount);
+    for (const auto result : addResults)
+        QCOMPARE(result, QOpcUa::UaStatusCode::Good);
+
+    // Add a second reference to each node and remove it again
+    QOpcUaExpandedNodeId referenceSource;
+    referenceSource.setNodeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder));
+    QVector<QOpcUaAddReferenceItem> referencesToAdd;
+    QVector<QOpcUaDeleteReferenceItem> referencesToDelete;
+    for (const auto &nodeId : qAsConst(nodeIds)) {
+        QOpcUaAddReferenceItem refInfo;
+        refInfo.setSourceNodeId(referenceSource.nodeId());
+        refInfo.setReferenceTypeId(QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+        refInfo.setIsForwardReference(true);
+        refInfo.setTargetNodeId(QOpcUaExpandedNodeId(QString(), nodeId));
+        refInfo.setTargetNodeClass(QOpcUa::NodeClass::Variable);
+        referencesToAdd.push_back(refInfo);
+
+        QOpcUaDeleteReferenceItem refDelInfo;
+        refDelInfo.setSourceNodeId(referenceSource.nodeId());
+        refDelInfo.setReferenceTypeId(QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+        refDelInfo.setIsForwardReference(true);
+        refDelInfo.setTargetNodeId(QOpcUaExpandedNodeId(QString(), nodeId));
+        refDelInfo.setDeleteBidirectional(true);
+        referencesToDelete.push_back(refDelInfo);
+    }
+
+    QSignalSpy addReferencesSpy(opcuaClient, &QOpcUaClient::addReferencesFinished);
+    QVERIFY(opcuaClient->addReferences(referencesToAdd));
+    addReferencesSpy.wait(signalSpyTimeout);
+    QCOMPARE(addReferencesSpy.size(), 1);
+    QCOMPARE(addReferencesSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    auto referenceResults = addReferencesSpy.at(0).at(1).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(referenceResults.size(), nodeCount);
+    for (const auto result : qAsConst(referenceResults))
+        QCOMPARE(result, QOpcUa::UaStatusCode::Good);
+
+    QSignalSpy deleteReferencesSpy(opcuaClient, &QOpcUaClient::deleteReferencesFinished);
+    QVERIFY(opcuaClient->deleteReferences(referencesToDelete));
+    deleteReferencesSpy.wait(signalSpyTimeout);
+    QCOMPARE(deleteReferencesSpy.size(), 1);
+    QCOMPARE(deleteReferencesSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    referenceResults = deleteReferencesSpy.at(0).at(1).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(referenceResults.size(), nodeCount);
+    for (const auto result : qAsConst(referenceResults))
+        QCOMPARE(result, QOpcUa::UaStatusCode::Good);
+
+    // Delete all nodes and an additional node which doesn't exist
+    QStringList nodesToDelete = nodeIds;
+    nodesToDelete.push_back(QStringLiteral("ns=3;s=DoesNotExist"));
+
+    QSignalSpy deleteNodesSpy(opcuaClient, &QOpcUaClient::deleteNodesFinished);
+    QVERIFY(opcuaClient->deleteNodes(nodesToDelete, true));
+    deleteNodesSpy.wait(signalSpyTimeout);
+    QCOMPARE(deleteNodesSpy.size(), 1);
+    QCOMPARE(deleteNodesSpy.at(0).at(0).value<QStringList>(), nodesToDelete);
+    QCOMPARE(deleteNodesSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const auto deleteResults = deleteNodesSpy.at(0).at(1).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(deleteResults.size(), nodeCount + 1);
+    for (int i = 0; i < nodeCount; ++i)
+        QCOMPARE(deleteResults.at(i), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(deleteResults.last(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+    // An empty request is rejected by the backend
+    QSignalSpy emptyDeleteSpy(opcuaClient, &QOpcUaClient::deleteNodesFinished);
+    QVERIFY(opcuaClient->deleteNodes(QStringList()));
+    emptyDeleteSpy.wait(signalSpyTimeout);
+    QCOMPARE(emptyDeleteSpy.size(), 1);
+    QCOMPARE(emptyDeleteSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
+void Tst_QOpcUaClient::readHistoryData()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("History access is not implemented in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QDateTime endTime = QDateTime::currentDateTimeUtc();
+    const QDateTime startTime = endTime.addDays(-1);
+
+    // An empty request is rejected by the backend
+    QSignalSpy emptyReadSpy(opcuaClient, &QOpcUaClient::readHistoryDataFinished);
+    QVERIFY(opcuaClient->readHistoryData(QVector<QOpcUaHistoryReadItem>(), startTime, endTime));
+    emptyReadSpy.wait(signalSpyTimeout);
+    QCOMPARE(emptyReadSpy.size(), 1);
+    QCOMPARE(emptyReadSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+
+    // The test server stores 25 samples and returns them in chunks of numValuesPerNode values
+    const int sampleCount = 25;
+    const quint32 numValuesPerNode = 7;
+    const QVector<QOpcUaHistoryReadItem> nodesToRead = {
+        QOpcUaHistoryReadItem(QStringLiteral("ns=3;s=Test.History.Double"))
+    };
+
+    // All continuation points must be either followed to the end or released
+    QScopedPointer<QOpcUaNode> continuationPointsNode(opcuaClient->node(QStringLiteral("ns=3;s=Test.History.ContinuationPoints")));
+    QVERIFY(continuationPointsNode != nullptr);
+    const auto readContinuationPointCount = [&continuationPointsNode]() {
+        QSignalSpy attributeReadSpy(continuationPointsNode.data(), &QOpcUaNode::attributeRead);
+        continuationPointsNode->readValueAttribute();
+        attributeReadSpy.wait(signalSpyTimeout);
+        return attributeReadSpy.size() == 1 ? continuationPointsNode->valueAttribute().toInt() : -1;
+    };
+    const int initialContinuationPoints = readContinuationPointCount();
+    QVERIFY(initialContinuationPoints >= 0);
+
+    QSignalSpy dataSpy(opcuaClient, &QOpcUaClient::historyDataAvailable);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::readHistoryDataFinished);
+    QVERIFY(opcuaClient->readHistoryData(nodesToRead, startTime, endTime, numValuesPerNode));
+    finishedSpy.wait(signalSpyTimeout);
+    QCOMPARE(finishedSpy.size(), 1);
+
+    const auto requestedNodes = finishedSpy.at(0).at(0).value<QVector<QOpcUaHistoryReadItem>>();
+    QCOMPARE(requestedNodes.size(), nodesToRead.size());
+    QCOMPARE(requestedNodes.at(0).nodeId(), nodesToRead.at(0).nodeId());
+
+    const auto serviceResult = finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>();
+    if (serviceResult == QOpcUa::UaStatusCode::BadServiceUnsupported)
+        QSKIP("The server does not support the HistoryRead service");
+    QCOMPARE(serviceResult, QOpcUa::UaStatusCode::Good);
+
+    // Each continuation point results in another chunk
+    QCOMPARE(dataSpy.size(), (sampleCount + static_cast<int>(numValuesPerNode) - 1) / static_cast<int>(numValuesPerNode));
+    QVector<QOpcUaDataValue> values;
+    for (const auto &signal : qAsConst(dataSpy)) {
+        const auto chunk = signal.at(0).value<QVector<QOpcUaHistoryData>>();
+        QCOMPARE(chunk.size(), 1);
+        QCOMPARE(chunk.at(0).nodeId(), nodesToRead.at(0).nodeId());
+        QCOMPARE(chunk.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+        QVERIFY(chunk.at(0).count() <= static_cast<int>(numValuesPerNode));
+        values.append(chunk.at(0).result());
+    }
+    QCOMPARE(values.size(), sampleCount);
+    for (int i = 0; i < values.size(); ++i) {
+        QCOMPARE(values.at(i).value().toDouble(), static_cast<double>(i));
+        QVERIFY(values.at(i).sourceTimestamp() >= startTime);
+        QVERIFY(values.at(i).sourceTimestamp() <= endTime);
+        if (i > 0)
+            QVERIFY(values.at(i).sourceTimestamp() > values.at(i - 1).sourceTimestamp());
+    }
+    QCOMPARE(readContinuationPointCount(), initialContinuationPoints);
+
+    // The server fails to continue the read, the backend must release the continuation point
+    const QVector<QOpcUaHistoryReadItem> failingNodes = {
+        QOpcUaHistoryReadItem(QStringLiteral("ns=3;s=Test.History.FailingDouble"))
+    };
+    dataSpy.clear();
+    finishedSpy.clear();
+    QVERIFY(opcuaClient->readHistoryData(failingNodes, startTime, endTime, numValuesPerNode));
+    finishedSpy.wait(signalSpyTimeout);
+    QCOMPARE(finishedSpy.size(), 1);
+    QCOMPARE(finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadInternalError);
+    QCOMPARE(dataSpy.size(), 1);
+    QCOMPARE(dataSpy.at(0).at(0).value<QVector<QOpcUaHistoryData>>().at(0).count(), static_cast<int>(numValuesPerNode));
+    QCOMPARE(readContinuationPointCount(), initialContinuationPoints);
+}
+
+void Tst_QOpcUaClient::readHistoryProcessed()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("History access is not implemented in the uacpp backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QDateTime endTime = QDateTime::currentDateTimeUtc();
+    const QDateTime startTime = endTime.addDays(-1);
+
+    // An empty request is rejected by the backend
+    QSignalSpy emptyReadSpy(opcuaClient, &QOpcUaClient::readHistoryDataFinished);
+    QVERIFY(opcuaClient->readHistoryProcessed(QVector<QOpcUaHistoryReadItem>(), startTime, endTime, 3600000));
+    emptyReadSpy.wait(signalSpyTimeout);
+    QCOMPARE(emptyReadSpy.size(), 1);
+    QCOMPARE(emptyReadSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+
+    QOpcUaHistoryReadItem item(QStringLiteral("ns=3;s=Test.History.Double"));
+    item.setAggregateType(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average));
+    const QVector<QOpcUaHistoryReadItem> nodesToRead = { item };
+
+    // The test server returns at most 10 values per response
+    const double processingInterval = 3600000;
+    const int intervalCount = static_cast<int>(startTime.msecsTo(endTime) / processingInterval);
+
+    QSignalSpy dataSpy(opcuaClient, &QOpcUaClient::processedHistoryDataAvailable);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::readHistoryDataFinished);
+    QVERIFY(opcuaClient->readHistoryProcessed(nodesToRead, startTime, endTime, processingInterval));
+    finishedSpy.wait(signalSpyTimeout);
+    QCOMPARE(finishedSpy.size(), 1);
+
+    const auto serviceResult = finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>();
+    if (serviceResult == QOpcUa::UaStatusCode::BadServiceUnsupported)
+        QSKIP("The server does not support the HistoryRead service");
+    QCOMPARE(serviceResult, QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(dataSpy.size() > 1);
+    int valueCount = 0;
+    int goodValueCount = 0;
+    for (const auto &signal : qAsConst(dataSpy)) {
+        const auto chunk = signal.at(0).value<QVector<QOpcUaProcessedHistoryData>>();
+        QCOMPARE(chunk.size(), 1);
+        QCOMPARE(chunk.at(0).nodeId(), item.nodeId());
+        QCOMPARE(chunk.at(0).aggregateType(), item.aggregateType());
+        QCOMPARE(chunk.at(0).timestamps().size(), chunk.at(0).count());
+        QCOMPARE(chunk.at(0).values().size(), chunk.at(0).count());
+        QCOMPARE(chunk.at(0).statusCodes().size(), chunk.at(0).count());
+        for (int i = 0; i < chunk.at(0).count(); ++i) {
+            QVERIFY(chunk.at(0).timestamp(i) >= startTime);
+            QVERIFY(chunk.at(0).timestamp(i) <= endTime);
+            if (chunk.at(0).statusCode(i) == QOpcUa::UaStatusCode::Good) {
+                // The stored samples have the values 0 to 24
+                QVERIFY(chunk.at(0).value(i) >= 0 && chunk.at(0).value(i) <= 24);
+                ++goodValueCount;
+            }
+        }
+        valueCount += chunk.at(0).count();
+    }
+    QCOMPARE(valueCount, intervalCount);
+    QVERIFY(goodValueCount > 0);
+}
+
+// Polls condition in the current thread without processing events
+template <typename Condition>
+static bool waitWithoutEvents(Condition condition, int timeout = signalSpyTimeout)
+{
+    QDeadlineTimer deadline(timeout);
+    while (!condition()) {
+        if (deadline.hasExpired())
+            return false;
+        QThread::msleep(10);
+    }
+    return true;
+}
+
+void Tst_QOpcUaClient::dataChangeQueueOverflow()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QCOMPARE(opcuaClient->dataChangeQueueLimit(), 0);
+    QCOMPARE(opcuaClient->dataChangeOverflowPolicy(), QOpcUaClient::DataChangeOverflowPolicy::DropOldest);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100, QOpcUaMonitoringParameters::SubscriptionType::Exclusive));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QTRY_COMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 0.0);
+
+    opcuaClient->setDataChangeQueueLimit(1);
+    opcuaClient->setDataChangeOverflowPolicy(QOpcUaClient::DataChangeOverflowPolicy::KeepLatest);
+    const quint64 overflowCount = opcuaClient->dataChangeOverflowCount();
+
+    const auto clientPrivate = static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(opcuaClient));
+    const QSharedPointer<QOpcUaDataChangeQueue> queue = clientPrivate->m_impl->m_dataChangeQueue;
+
+    // Stall the client thread while the backend receives several data changes for the same item.
+    // The next value is only written after the previous one has reached the queue, so the server
+    // can't merge them into one sample.
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    node->writeAttribute(QOpcUa::NodeAttribute::Value, 1.0, QOpcUa::Types::Double);
+    QVERIFY(waitWithoutEvents([&queue]() { return queue->pendingCount() == 1; }));
+    node->writeAttribute(QOpcUa::NodeAttribute::Value, 2.0, QOpcUa::Types::Double);
+    QVERIFY(waitWithoutEvents([&queue, overflowCount]() { return queue->overflowCount() == overflowCount + 1; }));
+    node->writeAttribute(QOpcUa::NodeAttribute::Value, 3.0, QOpcUa::Types::Double);
+    QVERIFY(waitWithoutEvents([&queue, overflowCount]() { return queue->overflowCount() == overflowCount + 2; }));
+    QCOMPARE(queue->pendingCount(), 1);
+
+    QTRY_VERIFY2(dataChangeSpy.size() >= 1, "No data change received");
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 3.0);
+    QCOMPARE(opcuaClient->dataChangeOverflowCount(), overflowCount + 2);
+
+    opcuaClient->setDataChangeQueueLimit(0);
+    opcuaClient->setDataChangeOverflowPolicy(QOpcUaClient::DataChangeOverflowPolicy::DropOldest);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::extensionObjectDecoder()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("The uacpp SDK decodes structures of namespace 0 before they reach the backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString encodingId = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::EUInformation_Encoding_DefaultBinary);
+    QAtomicPointer<QThread> decoderThread;
+    QOpcUaExtensionObjectDecoderRegistry::registerDecoder(encodingId, [&decoderThread](QOpcUaBinaryDataEncoding &decoder, bool &success) {
+        decoderThread.storeRelease(QThread::currentThread());
+        return QVariant(decoder.decode<QOpcUaEUInformation>(success).description().text());
+    });
+    const auto cleanup = qScopeGuard([&encodingId]() {
+        QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(encodingId);
+    });
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node("ns=2;s=Demo.Static.Scalar.EUInformation"));
+    QVERIFY(node != nullptr);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    // The registered decoder replaces the built-in decoding and runs in the backend thread
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toString(), testEUInfos[0].description().text());
+    QVERIFY(decoderThread.loadAcquire() != nullptr);
+    QVERIFY(decoderThread.loadAcquire() != QThread::currentThread());
+}
+
+void Tst_QOpcUaClient::namespace0Node()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QVERIFY(opcuaClient->node(QOpcUa::NodeIds::Namespace0::Unknown) == nullptr);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(QOpcUa::NodeIds::Namespace0::Server_NamespaceArray));
+    QVERIFY(node != nullptr);
+    QCOMPARE(node->nodeId(), QStringLiteral("ns=0;i=2255"));
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    const QStringList namespaces = node->attribute(QOpcUa::NodeAttribute::Value).toStringList();
+    QVERIFY(namespaces.size() > 1);
+    QCOMPARE(namespaces.at(0), QStringLiteral("http://opcfoundation.org/UA/"));
+}
+
+void Tst_QOpcUaClient::stringInterning()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() == QLatin1String("uacpp"))
+        QSKIP("String interning is not supported by the uacpp backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("enableStringInterning"), true);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node(QOpcUa::NodeIds::Namespace0::RootFolder));
+    QVERIFY(node != nullptr);
+    QSignalSpy columnarSpy(node.data(), &QOpcUaNode::columnarBrowseFinished);
+    QSignalSpy spy(node.data(), &QOpcUaNode::browseFinished);
+    node->browseChildren(QOpcUa::ReferenceTypeId::Organizes, QOpcUa::NodeClass::Object);
+    spy.wait(signalSpyTimeout);
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(spy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const auto results = spy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+    QVERIFY(results.size() > 1);
+
+    // The reference type ids of all results share the same string data
+    const QString organizes = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Organizes);
+    for (const auto &result : results) {
+        QCOMPARE(result.refTypeId(), organizes);
+        QCOMPARE(result.refTypeId().constData(), results.at(0).refTypeId().constData());
+    }
+
+    // The columnar result hands out the same interned strings
+    QCOMPARE(columnarSpy.size(), 1);
+    const auto columnar = columnarSpy.at(0).at(0).value<QOpcUaBrowseResult>();
+    QCOMPARE(columnar.size(), results.size());
+    for (int i = 0; i < columnar.size(); ++i) {
+        QCOMPARE(columnar.refTypeId(i).constData(), results.at(0).refTypeId().constData());
+        QCOMPARE(columnar.targetNodeId(i).nodeId(), results.at(i).targetNodeId().nodeId());
+    }
+}
+
+void Tst_QOpcUaClient::columnarBrowse()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node("ns=1;s=Large.Folder"));
+    QVERIFY(node != nullptr);
+    QSignalSpy columnarSpy(node.data(), &QOpcUaNode::columnarBrowseFinished);
+    QSignalSpy spy(node.data(), &QOpcUaNode::browseFinished);
+    node->browseChildren(QOpcUa::ReferenceTypeId::HierarchicalReferences, QOpcUa::NodeClass::Object);
+    spy.wait(signalSpyTimeout);
+    QCOMPARE(columnarSpy.size(), 1);
+    QCOMPARE(spy.size(), 1);
+    QCOMPARE(columnarSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const auto result = columnarSpy.at(0).at(0).value<QOpcUaBrowseResult>();
+    const auto ref = spy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+    QCOMPARE(result.size(), 100);
+    QCOMPARE(ref.size(), result.size());
+
+    for (int i = 0; i < result.size(); ++i) {
+        QCOMPARE(result.nodeClass(i), QOpcUa::NodeClass::Object);
+        QCOMPARE(result.targetNodeId(i).nodeId(), ref.at(i).targetNodeId().nodeId());
+        QCOMPARE(result.refTypeId(i), ref.at(i).refTypeId());
+        QCOMPARE(result.browseName(i), ref.at(i).browseName());
+        QCOMPARE(result.displayName(i), ref.at(i).displayName());
+        QCOMPARE(result.isForwardReference(i), true);
+    }
+}
+
+void Tst_QOpcUaClient::subscriptionSharding()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("maximumItemsPerSubscription"), 2);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int16"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt16")
+    };
+
+    QVector<QOpcUaNode *> nodes;
+    const auto nodeCleanup = qScopeGuard([&nodes]() { qDeleteAll(nodes); });
+    const auto enableMonitoring = [&](const QString &nodeId) -> quint32 {
+        QOpcUaNode *node = client->node(nodeId);
+        if (!node)
+            return 0;
+        nodes.append(node);
+        QSignalSpy monitoringEnabledSpy(node, &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+        monitoringEnabledSpy.wait(signalSpyTimeout);
+        if (monitoringEnabledSpy.size() != 1 || node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode() != QOpcUa::UaStatusCode::Good)
+            return 0;
+        return node->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId();
+    };
+
+    // Five items with the same interval are spread over three subscriptions
+    QHash<quint32, int> itemsPerSubscription;
+    for (int i = 0; i < 5; ++i) {
+        const quint32 subscriptionId = enableMonitoring(nodeIds.at(i));
+        QVERIFY(subscriptionId != 0);
+        ++itemsPerSubscription[subscriptionId];
+    }
+    QCOMPARE(itemsPerSubscription.size(), 3);
+    for (const int count : qAsConst(itemsPerSubscription))
+        QVERIFY(count <= 2);
+
+    // A free slot in an existing subscription is used instead of creating a new subscription
+    QOpcUaNode *first = nodes.first();
+    const quint32 firstSubscriptionId = first->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId();
+    QSignalSpy monitoringDisabledSpy(first, &QOpcUaNode::disableMonitoringFinished);
+    first->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+    --itemsPerSubscription[firstSubscriptionId];
+
+    const quint32 subscriptionId = enableMonitoring(nodeIds.at(5));
+    QVERIFY(itemsPerSubscription.contains(subscriptionId));
+    QCOMPARE(itemsPerSubscription.value(subscriptionId), 1);
+}
+
+void Tst_QOpcUaClient::triggeredMonitoredItems()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> trigger(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32")));
+    QVERIFY(trigger != nullptr);
+    QScopedPointer<QOpcUaNode> tag(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")));
+    QVERIFY(tag != nullptr);
+
+    WRITE_VALUE_ATTRIBUTE(trigger, QVariant(qint32(0)), QOpcUa::Types::Int32);
+    WRITE_VALUE_ATTRIBUTE(tag, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QVERIFY(!trigger->setTriggering(QOpcUa::NodeAttribute::Value, QVector<quint32>()));
+
+    QSignalSpy triggerEnabledSpy(trigger.data(), &QOpcUaNode::enableMonitoringFinished);
+    trigger->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100, QOpcUaMonitoringParameters::SubscriptionType::Exclusive));
+    triggerEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(triggerEnabledSpy.size(), 1);
+    QCOMPARE(trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    // The linked item only samples and must be in the subscription of the triggering item
+    QOpcUaMonitoringParameters p(100, QOpcUaMonitoringParameters::SubscriptionType::Shared,
+                                 trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId());
+    p.setMonitoringMode(QOpcUaMonitoringParameters::MonitoringMode::Sampling);
+    QSignalSpy tagEnabledSpy(tag.data(), &QOpcUaNode::enableMonitoringFinished);
+    tag->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    tagEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(tagEnabledSpy.size(), 1);
+    QCOMPARE(tag->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(tag->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId(),
+             trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId());
+    const quint32 tagItemId = tag->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoredItemId();
+
+    QSignalSpy triggeringSpy(trigger.data(), &QOpcUaNode::setTriggeringFinished);
+    QVERIFY(trigger->setTriggering(QOpcUa::NodeAttribute::Value, {tagItemId}));
+    triggeringSpy.wait(signalSpyTimeout);
+    QCOMPARE(triggeringSpy.size(), 1);
+    QCOMPARE(triggeringSpy.at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+
+    const auto serviceResult = triggeringSpy.at(0).at(3).value<QOpcUa::UaStatusCode>();
+    if (serviceResult == QOpcUa::UaStatusCode::BadServiceUnsupported)
+        QSKIP("The server does not support the SetTriggering service");
+    QCOMPARE(serviceResult, QOpcUa::UaStatusCode::Good);
+    const auto addResults = triggeringSpy.at(0).at(1).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(addResults.size(), 1);
+    QCOMPARE(addResults.at(0), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).triggeredItemIds(), QVector<quint32>({tagItemId}));
+
+    // A changed value of the sampling item is only reported after the trigger has fired
+    QSignalSpy tagDataChangeSpy(tag.data(), &QOpcUaNode::dataChangeOccurred);
+    WRITE_VALUE_ATTRIBUTE(tag, QVariant(double(23)), QOpcUa::Types::Double);
+    tagDataChangeSpy.wait(1000);
+    QCOMPARE(tagDataChangeSpy.size(), 0);
+
+    WRITE_VALUE_ATTRIBUTE(trigger, QVariant(qint32(42)), QOpcUa::Types::Int32);
+    tagDataChangeSpy.wait(signalSpyTimeout);
+    QVERIFY(tagDataChangeSpy.size() >= 1);
+    QCOMPARE(tagDataChangeSpy.last().at(1), QVariant(double(23)));
+
+    triggeringSpy.clear();
+    QVERIFY(trigger->setTriggering(QOpcUa::NodeAttribute::Value, QVector<quint32>(), {tagItemId}));
+    triggeringSpy.wait(signalSpyTimeout);
+    QCOMPARE(triggeringSpy.size(), 1);
+    QCOMPARE(triggeringSpy.at(0).at(3).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const auto removeResults = triggeringSpy.at(0).at(2).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(removeResults.size(), 1);
+    QCOMPARE(removeResults.at(0), QOpcUa::UaStatusCode::Good);
+    QVERIFY(trigger->monitoringStatus(QOpcUa::NodeAttribute::Value).triggeredItemIds().isEmpty());
+}
+
+void Tst_QOpcUaClient::modifyMonitoringOfMultipleNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float")
+    };
+
+    QVector<QOpcUaNode *> nodes;
+    const auto nodeCleanup = qScopeGuard([&nodes]() { qDeleteAll(nodes); });
+    for (int i = 0; i < nodeIds.size(); ++i) {
+        QOpcUaNode *node = opcuaClient->node(nodeIds.at(i));
+        QVERIFY(node != nullptr);
+        nodes.append(node);
+
+        // The items are spread over two subscriptions
+        QSignalSpy monitoringEnabledSpy(node, &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(i % 2 ? 100 : 200));
+        monitoringEnabledSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringEnabledSpy.size(), 1);
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    }
+
+    QVERIFY(!opcuaClient->modifyMonitoring(QVector<QOpcUaNode *>(), QOpcUa::NodeAttribute::Value,
+                                           QOpcUaMonitoringParameters::Parameter::SamplingInterval, 50.0));
+
+    const auto modifyAll = [&](QOpcUaMonitoringParameters::Parameter item, const QVariant &value,
+                               QOpcUa::UaStatusCode expectedStatus = QOpcUa::UaStatusCode::Good) {
+        QVector<QSignalSpy *> spies;
+        const auto spyCleanup = qScopeGuard([&spies]() { qDeleteAll(spies); });
+        for (QOpcUaNode *node : qAsConst(nodes))
+            spies.append(new QSignalSpy(node, &QOpcUaNode::monitoringStatusChanged));
+
+        QVERIFY(opcuaClient->modifyMonitoring(nodes, QOpcUa::NodeAttribute::Value, item, value));
+
+        for (QSignalSpy *spy : qAsConst(spies)) {
+            if (spy->isEmpty())
+                spy->wait(signalSpyTimeout);
+            QCOMPARE(spy->size(), 1);
+            QCOMPARE(spy->at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+            QVERIFY(spy->at(0).at(1).value<QOpcUaMonitoringParameters::Parameters>() & item);
+            QCOMPARE(spy->at(0).at(2).value<QOpcUa::UaStatusCode>(), expectedStatus);
+        }
+    };
+
+    modifyAll(QOpcUaMonitoringParameters::Parameter::MonitoringMode,
+              QVariant::fromValue(QOpcUaMonitoringParameters::MonitoringMode::Disabled));
+    for (QOpcUaNode *node : qAsConst(nodes))
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoringMode(), QOpcUaMonitoringParameters::MonitoringMode::Disabled);
+
+    modifyAll(QOpcUaMonitoringParameters::Parameter::MonitoringMode,
+              QVariant::fromValue(QOpcUaMonitoringParameters::MonitoringMode::Reporting));
+    for (QOpcUaNode *node : qAsConst(nodes))
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoringMode(), QOpcUaMonitoringParameters::MonitoringMode::Reporting);
+
+    modifyAll(QOpcUaMonitoringParameters::Parameter::SamplingInterval, 50.0);
+
+    const QOpcUaMonitoringParameters::DataChangeFilter filter(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::StatusOrValue,
+                                                              QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute, 1.0);
+    modifyAll(QOpcUaMonitoringParameters::Parameter::Filter, QVariant::fromValue(filter));
+    for (QOpcUaNode *node : qAsConst(nodes))
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).filter().value<QOpcUaMonitoringParameters::DataChangeFilter>(), filter);
+
+    // A failed modification of a subscription parameter is reported to every node, not only the first one
+    modifyAll(QOpcUaMonitoringParameters::Parameter::PublishingInterval, QStringLiteral("invalid"),
+              QOpcUa::UaStatusCode::BadTypeMismatch);
+}
+
+void Tst_QOpcUaClient::tagModel()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.DoesNotExist"),
+        QStringLiteral("InvalidNodeId")
+    };
+
+    QVERIFY(!opcuaClient->enableMonitoring(QVector<QOpcUaNode *>(), QOpcUa::NodeAttribute::Value,
+                                           QOpcUaMonitoringParameters(100)));
+
+    QOpcUaTagModel model;
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+    model.setNodeIds(nodeIds);
+    QCOMPARE(model.rowCount(), nodeIds.size());
+    QCOMPARE(model.nodeIds(), nodeIds);
+    model.setClient(opcuaClient);
+
+    const auto statusCode = [&model](int row) {
+        return model.data(model.index(row), QOpcUaTagModel::StatusCodeRole).value<QOpcUa::UaStatusCode>();
+    };
+
+    for (int row = 0; row < 4; ++row)
+        QTRY_VERIFY_WITH_TIMEOUT(model.data(model.index(row), QOpcUaTagModel::ValueRole).isValid(), signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(statusCode(4), QOpcUa::UaStatusCode::BadNodeIdUnknown, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(statusCode(5), QOpcUa::UaStatusCode::BadNodeIdInvalid, signalSpyTimeout);
+
+    for (int row = 0; row < 4; ++row) {
+        QCOMPARE(statusCode(row), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(model.data(model.index(row), QOpcUaTagModel::NodeIdRole).toString(), nodeIds.at(row));
+        QVERIFY(model.data(model.index(row), QOpcUaTagModel::ServerTimestampRole).toDateTime().isValid());
+    }
+
+    // The rows use monitored item handles of the client instead of one QOpcUaNode each
+    auto d = QOpcUaTagModelPrivate::get(&model);
+    for (int row = 0; row < 5; ++row)
+        QVERIFY(d->m_tags.at(row).handle != 0);
+    QCOMPARE(d->m_tags.at(5).handle, quint64(0));
+    QCOMPARE(d->m_rows.size(), 5);
+
+    QVERIFY(!dataChangedSpy.isEmpty());
+
+    // All dataChanged() signals of one flush are emitted synchronously, a queued call closes the batch
+    QVector<QVector<QPair<int, int>>> batches;
+    bool batchOpen = false;
+    const auto batchConnection = connect(&model, &QAbstractItemModel::dataChanged, this, [&](const QModelIndex &topLeft, const QModelIndex &bottomRight) {
+        if (!batchOpen) {
+            batchOpen = true;
+            batches.push_back({});
+            QMetaObject::invokeMethod(this, [&batchOpen]() { batchOpen = false; }, Qt::QueuedConnection);
+        }
+        batches.back().push_back(qMakePair(topLeft.row(), bottomRight.row()));
+    });
+
+    // A burst of writes to rows 0, 1 and 3
+    const int rounds = 5;
+    for (int i = 1; i <= rounds; ++i) {
+        QVector<QOpcUaWriteItem> request;
+        request.append(QOpcUaWriteItem(nodeIds.at(0), QOpcUa::NodeAttribute::Value, i, QOpcUa::Types::Int32));
+        request.append(QOpcUaWriteItem(nodeIds.at(1), QOpcUa::NodeAttribute::Value, i, QOpcUa::Types::UInt32));
+        request.append(QOpcUaWriteItem(nodeIds.at(3), QOpcUa::NodeAttribute::Value, float(i), QOpcUa::Types::Float));
+        QVERIFY(opcuaClient->writeNodeAttributes(request));
+    }
+    QTRY_COMPARE_WITH_TIMEOUT(model.data(model.index(0)).toInt(), rounds, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(model.data(model.index(1)).toUInt(), quint32(rounds), signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(model.data(model.index(3)).toFloat(), float(rounds), signalSpyTimeout);
+    QTRY_VERIFY(!batchOpen);
+    disconnect(batchConnection);
+
+    // The ranges of one flush are sorted, don't overlap and adjacent rows are merged
+    QSet<int> changedRows;
+    QVERIFY(!batches.isEmpty());
+    for (const auto &ranges : qAsConst(batches)) {
+        for (int i = 0; i < ranges.size(); ++i) {
+            QVERIFY(ranges.at(i).first <= ranges.at(i).second);
+            if (i > 0)
+                QVERIFY(ranges.at(i).first > ranges.at(i - 1).second + 1);
+            for (int row = ranges.at(i).first; row <= ranges.at(i).second; ++row)
+                changedRows.insert(row);
+        }
+    }
+    QVERIFY(changedRows.contains(0));
+    QVERIFY(changedRows.contains(1));
+    QVERIFY(changedRows.contains(3));
+    QVERIFY(!changedRows.contains(2));
+    QVERIFY(!changedRows.contains(4));
+    QVERIFY(!changedRows.contains(5));
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(nodeIds.at(2)));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(42)), QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(model.data(model.index(2)).toDouble(), 42.0, signalSpyTimeout);
+
+    model.setClient(nullptr);
+    QVERIFY(!model.data(model.index(2)).isValid());
+    QVERIFY(d->m_rows.isEmpty());
+}
+
 void Tst_QOpcUaClient::dataChangeSubscription()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -1443,6 +2276,14 @@ void Tst_QOpcUaClient::dataChangeSubscription()
     QCOMPARE(dataChangeSpy.at(index).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
     QCOMPARE(dataChangeSpy.at(index).at(1), double(42));
 
+    // The cached data value keeps the raw timestamps, the QDateTime is derived from them
+    const QOpcUaDataValue dataValue = node->dataValue(QOpcUa::NodeAttribute::Value);
+    QCOMPARE(dataValue.value(), QVariant(double(42)));
+    QVERIFY(dataValue.serverTimestampTicks() != 0);
+    QCOMPARE(node->serverTimestamp(QOpcUa::NodeAttribute::Value), QOpcUaDataValue::ticksToDateTime(dataValue.serverTimestampTicks()));
+    QCOMPARE(QOpcUaDataValue::dateTimeToTicks(node->serverTimestamp(QOpcUa::NodeAttribute::Value)) / 10000,
+             dataValue.serverTimestampTicks() / 10000);
+
     monitoringEnabledSpy.clear();
     dataChangeSpy.clear();
 
@@ -1682,6 +2523,46 @@ void Tst_QOpcUaClient::methodCallInvalid()
     QCOMPARE(methodSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadArgumentsMissing);
 }
 
+void Tst_QOpcUaClient::methodCallBatch()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QVector<QOpcUa::TypedVariant> args(2, QOpcUa::TypedVariant(double(4), QOpcUa::Double));
+    QVector<QOpcUaMethodCallItem> calls;
+    calls.push_back({QStringLiteral("ns=3;s=TestFolder"), QStringLiteral("ns=3;s=Test.Method.Multiply"), args});
+    calls.push_back({QStringLiteral("ns=3;s=TestFolder"), QStringLiteral("ns=3;s=Test.Method.Divide"), args}); // Does not exist
+    calls.push_back({QStringLiteral("ns=3;s=TestFolder"), QStringLiteral("ns=3;s=Test.Method.Multiply"), args.mid(0, 1)});
+
+    const auto clientPrivate = static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(opcuaClient));
+    QOpcUaClientImpl *impl = clientPrivate->m_impl.data();
+    QSignalSpy callSpy(impl, &QOpcUaClientImpl::callMethodsFinished);
+
+    const quint64 requestId = 42;
+    if (!impl->callMethods(requestId, calls))
+        QSKIP("Batched method calls are not supported by this backend");
+
+    callSpy.wait(signalSpyTimeout);
+    QCOMPARE(callSpy.size(), 1);
+    QCOMPARE(callSpy.at(0).at(0).value<quint64>(), requestId);
+    QCOMPARE(callSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // Each method has its own result, a failed method doesn't affect the others
+    const auto results = callSpy.at(0).at(1).value<QVector<QOpcUa::UaStatusCode>>();
+    QCOMPARE(results.size(), calls.size());
+    QCOMPARE(results.at(0), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(QOpcUa::errorCategory(results.at(1)), QOpcUa::ErrorCategory::NodeError);
+    QCOMPARE(results.at(2), QOpcUa::UaStatusCode::BadArgumentsMissing);
+
+    // An empty batch is rejected by the backend
+    callSpy.clear();
+    QVERIFY(impl->callMethods(requestId + 1, QVector<QOpcUaMethodCallItem>()));
+    callSpy.wait(signalSpyTimeout);
+    QCOMPARE(callSpy.size(), 1);
+    QCOMPARE(callSpy.at(0).at(0).value<quint64>(), requestId + 1);
+    QCOMPARE(callSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
 void Tst_QOpcUaClient::readMethodArguments()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -3633,6 +4514,983 @@ void Tst_QOpcUaClient::extensionObjectWithGuid()
     QCOMPARE(decodedNodeId, sampleNodeId);
 }
 
+void Tst_QOpcUaClient::arithmeticArrayEncoding()
+{
+    const QVector<qint32> intArray = {1, -2, 0x12345678};
+    const QVector<double> doubleArray = {1.5, -0.25};
+
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+    QVERIFY(encoder.encodeArray<qint32>(intArray));
+    QVERIFY(encoder.encodeArray<double>(doubleArray));
+    QVERIFY(encoder.encodeArray<qint32>(QVector<qint32>()));
+
+    // Array length and elements are little endian
+    QCOMPARE(buffer.toHex(), QByteArray("03000000" "01000000" "feffffff" "78563412"
+                                        "02000000" "000000000000f83f" "000000000000d0bf"
+                                        "00000000"));
+
+    QOpcUaBinaryDataEncoding decoder(&buffer);
+    bool success = false;
+    QCOMPARE(decoder.decodeArray<qint32>(success), intArray);
+    QVERIFY(success);
+    QCOMPARE(decoder.decodeArray<double>(success), doubleArray);
+    QVERIFY(success);
+    QCOMPARE(decoder.decodeArray<qint32>(success), QVector<qint32>());
+    QVERIFY(success);
+    QCOMPARE(decoder.offset(), buffer.size());
+
+    // The array length must not exceed the remaining data
+    QByteArray truncated = buffer.left(10);
+    QOpcUaBinaryDataEncoding truncatedDecoder(&truncated);
+    QVERIFY(truncatedDecoder.decodeArray<qint32>(success).isEmpty());
+    QVERIFY(!success);
+
+    QByteArray invalidLength = QByteArray::fromHex("ffffff7f00000000");
+    QOpcUaBinaryDataEncoding invalidLengthDecoder(&invalidLength);
+    QVERIFY(invalidLengthDecoder.decodeArray<double>(success).isEmpty());
+    QVERIFY(!success);
+}
+
+void Tst_QOpcUaClient::encodedSize()
+{
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+
+    // Multi byte UTF-8 sequences, a surrogate pair and an unpaired surrogate
+    const QString text = QStringLiteral("a\u00e4\u20ac\U0001F600") + QChar(0xd800);
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(text), qint64(4 + text.toUtf8().size()));
+    QVERIFY(encoder.encode<QString>(text));
+    QCOMPARE(buffer.size(), 4 + text.toUtf8().size());
+
+    // A single byte ByteString must not lose its content
+    buffer.clear();
+    QVERIFY(encoder.encode<QByteArray>(QByteArray("x")));
+    QCOMPARE(buffer.toHex(), QByteArray("0100000078"));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(QByteArray("x")), qint64(5));
+
+    const QStringList nodeIds = {QLatin1String("ns=0;i=85"), QLatin1String("ns=1;i=1000"), QLatin1String("ns=300;i=100000"),
+                                 QLatin1String("ns=2;s=Demo.Static"), QLatin1String("ns=3;g=08081e75-8e5e-319b-954f-f3a7613dc29b"),
+                                 QLatin1String("ns=3;b=UXQgZnR3IQ==")};
+    for (const auto &nodeId : nodeIds) {
+        buffer.clear();
+        QVERIFY(encoder.encode<QString, QOpcUa::Types::NodeId>(nodeId));
+        QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize<QString, QOpcUa::Types::NodeId>(nodeId), qint64(buffer.size()));
+    }
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize<QString, QOpcUa::Types::NodeId>(QLatin1String("ns=0;x=invalid")), qint64(-1));
+
+    const QOpcUaExpandedNodeId expandedNodeId(QLatin1String("urn:example.org"), QLatin1String("ns=1;s=Test"), 3);
+    buffer.clear();
+    QVERIFY(encoder.encode<QOpcUaExpandedNodeId>(expandedNodeId));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(expandedNodeId), qint64(buffer.size()));
+    QCOMPARE(quint8(buffer.at(0)), quint8(0xC3));
+
+    QOpcUaArgument argument(QLatin1String("Argument"), QLatin1String("ns=0;i=11"), -1, {2, 3},
+                            QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Description")));
+    buffer.clear();
+    QVERIFY(encoder.encode<QOpcUaArgument>(argument));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(argument), qint64(buffer.size()));
+
+    // A failed encode of a structure leaves the buffer untouched
+    argument.setDataTypeId(QLatin1String("invalid"));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(argument), qint64(-1));
+    const QByteArray oldBuffer = buffer;
+    QVERIFY(!encoder.encode<QOpcUaArgument>(argument));
+    QCOMPARE(buffer, oldBuffer);
+
+    QOpcUaApplicationRecordDataType record;
+    record.setApplicationId(QLatin1String("ns=2;i=1"));
+    record.setApplicationUri(QLatin1String("urn:example.org:Application"));
+    record.setApplicationNames({QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Application"))});
+    record.setDiscoveryUrls({QLatin1String("opc.tcp://localhost:4840")});
+    const QVector<QOpcUaApplicationRecordDataType> records(3, record);
+    buffer.clear();
+    QVERIFY(encoder.encodeArray<QOpcUaApplicationRecordDataType>(records));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedArraySize(records), qint64(buffer.size()));
+
+    const QOpcUaAxisInformation axis(QOpcUaEUInformation(QLatin1String("http://www.opcfoundation.org/UA/units/un/cefact"), 4408652,
+                                                         QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Cel")),
+                                                         QOpcUaLocalizedText()),
+                                     QOpcUaRange(0, 100), QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Temperature")),
+                                     QOpcUa::AxisScale::Linear, {1.0, 2.0, 3.0});
+    buffer.clear();
+    QVERIFY(encoder.encode<QOpcUaAxisInformation>(axis));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedSize(axis), qint64(buffer.size()));
+    QCOMPARE(QOpcUaBinaryDataEncoding::encodedArraySize(QVector<double>(5)), qint64(4 + 5 * 8));
+
+    // Arrays of types without encodedSize() specialization are encoded without reserving the buffer
+    buffer.clear();
+    QVERIFY(encoder.encodeArray<EncodeOnlyType>({{1}, {2}}));
+    QCOMPARE(buffer.toHex(), QByteArray("0200000001000200"));
+}
+
+void Tst_QOpcUaClient::structureCodec()
+{
+    const QByteArray dictionary =
+            "<opc:TypeDictionary xmlns:opc=\"http://opcfoundation.org/BinarySchema/\" xmlns:ua=\"http://opcfoundation.org/UA/\""
+            "                    xmlns:tns=\"urn:qtopcua:test\" TargetNamespace=\"urn:qtopcua:test\" DefaultByteOrder=\"LittleEndian\">"
+            "  <opc:Import Namespace=\"http://opcfoundation.org/UA/\"/>"
+            "  <opc:EnumeratedType Name=\"Mode\" LengthInBits=\"32\">"
+            "    <opc:EnumeratedValue Name=\"Off\" Value=\"0\"/>"
+            "    <opc:EnumeratedValue Name=\"On\" Value=\"1\"/>"
+            "  </opc:EnumeratedType>"
+            "  <opc:StructuredType Name=\"Point\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"X\" TypeName=\"opc:Double\"/>"
+            "    <opc:Field Name=\"Y\" TypeName=\"opc:Double\"/>"
+            "  </opc:StructuredType>"
+            "  <opc:StructuredType Name=\"Measurement\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"CommentSpecified\" TypeName=\"opc:Bit\"/>"
+            "    <opc:Field Name=\"Reserved1\" TypeName=\"opc:Bit\" Length=\"31\"/>"
+            "    <opc:Field Name=\"Name\" TypeName=\"opc:String\"/>"
+            "    <opc:Field Name=\"Mode\" TypeName=\"tns:Mode\"/>"
+            "    <opc:Field Name=\"Position\" TypeName=\"tns:Point\"/>"
+            "    <opc:Field Name=\"NoOfValues\" TypeName=\"opc:Int32\"/>"
+            "    <opc:Field Name=\"Values\" TypeName=\"opc:Double\" LengthField=\"NoOfValues\"/>"
+            "    <opc:Field Name=\"Comment\" TypeName=\"ua:LocalizedText\" SwitchField=\"CommentSpecified\"/>"
+            "  </opc:StructuredType>"
+            "</opc:TypeDictionary>";
+
+    const QString measurementEncodingId = QStringLiteral("ns=2;i=5001");
+    const QString pointEncodingId = QStringLiteral("ns=2;i=5002");
+
+    QOpcUaStructureCodec codec;
+    QVERIFY(!codec.addTypeDictionary("<invalid"));
+    QVERIFY(codec.addTypeDictionary(dictionary));
+    QVERIFY(!codec.registerEncodingId(QStringLiteral("ns=2;i=5003"), QStringLiteral("Unknown")));
+    QVERIFY(codec.registerEncodingId(measurementEncodingId, QStringLiteral("Measurement")));
+    QVERIFY(codec.registerEncodingId(pointEncodingId, QStringLiteral("Point"), QStringLiteral("urn:qtopcua:test")));
+    QVERIFY(codec.hasEncodingId(measurementEncodingId));
+    QVERIFY(!codec.hasEncodingId(QStringLiteral("ns=2;i=5003")));
+
+    QVariantMap measurement;
+    measurement[QStringLiteral("Name")] = QStringLiteral("A");
+    measurement[QStringLiteral("Mode")] = 1;
+    measurement[QStringLiteral("Position")] = QVariantMap({{QStringLiteral("X"), 1.0}, {QStringLiteral("Y"), 2.0}});
+    measurement[QStringLiteral("Values")] = QVariantList({0.5});
+
+    QOpcUaExtensionObject object;
+    QVERIFY(codec.encode(measurementEncodingId, measurement, object));
+    QCOMPARE(object.encodingTypeId(), measurementEncodingId);
+    QCOMPARE(object.encoding(), QOpcUaExtensionObject::Encoding::ByteString);
+    // Switch and padding bits, name, mode, position, length and elements of the array
+    QCOMPARE(object.encodedBody().toHex(), QByteArray("00000000" "0100000041" "01000000" "000000000000f03f" "0000000000000040"
+                                                      "01000000" "000000000000e03f"));
+
+    bool success = false;
+    QCOMPARE(codec.decode(object, &success).toMap(), measurement);
+    QVERIFY(success);
+
+    // Optional field
+    measurement[QStringLiteral("Comment")] = QVariant::fromValue(QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Comment")));
+    QVERIFY(codec.encode(measurementEncodingId, measurement, object));
+    QCOMPARE(object.encodedBody().at(0), '\x01');
+    const QVariantMap decoded = codec.decode(object, &success).toMap();
+    QVERIFY(success);
+    QCOMPARE(decoded.value(QStringLiteral("Comment")).value<QOpcUaLocalizedText>(), QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Comment")));
+    QCOMPARE(decoded.value(QStringLiteral("Values")), measurement.value(QStringLiteral("Values")));
+
+    // Truncated body
+    object.setEncodedBody(object.encodedBody().left(10));
+    codec.decode(object, &success);
+    QVERIFY(!success);
+
+    // Missing mandatory field
+    measurement.remove(QStringLiteral("Name"));
+    QVERIFY(!codec.encode(measurementEncodingId, measurement, object));
+
+    // Registered C++ type
+    QVERIFY(codec.registerType<QPointF>(pointEncodingId,
+                                        [](const QVariantMap &map) {
+                                            return QPointF(map.value(QStringLiteral("X")).toDouble(), map.value(QStringLiteral("Y")).toDouble());
+                                        },
+                                        [](const QPointF &point) {
+                                            return QVariantMap({{QStringLiteral("X"), point.x()}, {QStringLiteral("Y"), point.y()}});
+                                        }));
+    QOpcUaExtensionObject pointObject;
+    QVERIFY(codec.encode(QPointF(3, 4), pointObject));
+    QCOMPARE(pointObject.encodingTypeId(), pointEncodingId);
+    QCOMPARE(codec.decode(pointObject, &success).toPointF(), QPointF(3, 4));
+    QVERIFY(success);
+
+    pointObject.setEncodingTypeId(QStringLiteral("ns=2;i=5003"));
+    QVERIFY(!codec.decode(pointObject, &success).isValid());
+    QVERIFY(!success);
+
+    const QByteArray limitsDictionary =
+            "<opc:TypeDictionary xmlns:opc=\"http://opcfoundation.org/BinarySchema/\" xmlns:ua=\"http://opcfoundation.org/UA/\""
+            "                    xmlns:tns=\"urn:qtopcua:limits\" TargetNamespace=\"urn:qtopcua:limits\" DefaultByteOrder=\"LittleEndian\">"
+            "  <opc:Import Namespace=\"http://opcfoundation.org/UA/\"/>"
+            "  <opc:StructuredType Name=\"TreeNode\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"ChildSpecified\" TypeName=\"opc:Bit\"/>"
+            "    <opc:Field Name=\"Reserved1\" TypeName=\"opc:Bit\" Length=\"31\"/>"
+            "    <opc:Field Name=\"Child\" TypeName=\"tns:TreeNode\" SwitchField=\"ChildSpecified\"/>"
+            "  </opc:StructuredType>"
+            "  <opc:StructuredType Name=\"WithVariant\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"Id\" TypeName=\"opc:Int32\"/>"
+            "    <opc:Field Name=\"Value\" TypeName=\"ua:Variant\"/>"
+            "  </opc:StructuredType>"
+            "  <opc:StructuredType Name=\"WithDataValue\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"Value\" TypeName=\"ua:DataValue\"/>"
+            "  </opc:StructuredType>"
+            "  <opc:StructuredType Name=\"WithDiagnosticInfo\" BaseType=\"ua:ExtensionObject\">"
+            "    <opc:Field Name=\"Info\" TypeName=\"ua:DiagnosticInfo\"/>"
+            "  </opc:StructuredType>"
+            "</opc:TypeDictionary>";
+
+    QOpcUaStructureCodec limitsCodec;
+    QVERIFY(limitsCodec.addTypeDictionary(limitsDictionary));
+
+    // Unsupported built-in types are rejected when the type is compiled
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("unsupported type .*Variant")));
+    QVERIFY(!limitsCodec.registerEncodingId(QStringLiteral("ns=2;i=5011"), QStringLiteral("WithVariant")));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("unsupported type .*DataValue")));
+    QVERIFY(!limitsCodec.registerEncodingId(QStringLiteral("ns=2;i=5012"), QStringLiteral("WithDataValue")));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("unsupported type .*DiagnosticInfo")));
+    QVERIFY(!limitsCodec.registerEncodingId(QStringLiteral("ns=2;i=5013"), QStringLiteral("WithDiagnosticInfo")));
+    QVERIFY(!limitsCodec.hasEncodingId(QStringLiteral("ns=2;i=5011")));
+
+    // Recursive structures are decoded up to the nesting limit
+    const QString treeEncodingId = QStringLiteral("ns=2;i=5010");
+    QVERIFY(limitsCodec.registerEncodingId(treeEncodingId, QStringLiteral("TreeNode")));
+
+    const auto treeBody = [](int depth) {
+        QByteArray body;
+        for (int i = 0; i < depth; ++i)
+            body.append(QByteArray::fromHex("01000000"));
+        body.append(QByteArray::fromHex("00000000"));
+        return body;
+    };
+
+    QOpcUaExtensionObject treeObject;
+    treeObject.setEncodingTypeId(treeEncodingId);
+    treeObject.setEncoding(QOpcUaExtensionObject::Encoding::ByteString);
+    treeObject.setEncodedBody(treeBody(100));
+    QVariantMap tree = limitsCodec.decode(treeObject, &success).toMap();
+    QVERIFY(success);
+    int depth = 0;
+    while (tree.contains(QStringLiteral("Child"))) {
+        tree = tree.value(QStringLiteral("Child")).toMap();
+        ++depth;
+    }
+    QCOMPARE(depth, 100);
+
+    treeObject.setEncodedBody(treeBody(101));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("maximum nesting depth")));
+    QVERIFY(!limitsCodec.decode(treeObject, &success).isValid());
+    QVERIFY(!success);
+
+    QVariantMap deepTree;
+    for (int i = 0; i < 101; ++i)
+        deepTree = QVariantMap({{QStringLiteral("Child"), deepTree}});
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("maximum nesting depth")));
+    QVERIFY(!limitsCodec.encode(treeEncodingId, deepTree, treeObject));
+}
+
+void Tst_QOpcUaClient::extensionObjectDecoderRegistry()
+{
+    const QString encodingId = QStringLiteral("ns=2;i=6001");
+    QVERIFY(!QOpcUaExtensionObjectDecoderRegistry::hasDecoder(encodingId));
+
+    QOpcUaExtensionObjectDecoderRegistry::registerType<QOpcUaRange>(encodingId);
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::hasDecoder(encodingId));
+    QVERIFY(!QOpcUaExtensionObjectDecoderRegistry::isEmpty());
+
+    QByteArray body;
+    QOpcUaBinaryDataEncoding encoder(&body);
+    QVERIFY(encoder.encode<QOpcUaRange>(QOpcUaRange(-1, 1)));
+
+    bool success = false;
+    QCOMPARE(QOpcUaExtensionObjectDecoderRegistry::decode(encodingId, body, &success).value<QOpcUaRange>(), QOpcUaRange(-1, 1));
+    QVERIFY(success);
+
+    QVERIFY(!QOpcUaExtensionObjectDecoderRegistry::decode(encodingId, body.left(4), &success).isValid());
+    QVERIFY(!success);
+
+    QVERIFY(QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(encodingId));
+    QVERIFY(!QOpcUaExtensionObjectDecoderRegistry::unregisterDecoder(encodingId));
+    QVERIFY(!QOpcUaExtensionObjectDecoderRegistry::decode(encodingId, body, &success).isValid());
+    QVERIFY(!success);
+}
+
+void Tst_QOpcUaClient::namespace0IdNames()
+{
+    if (QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Boolean).isEmpty())
+        QSKIP("Qt OPC UA has been configured without namespace 0 id names");
+
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Boolean), QStringLiteral("Boolean"));
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::RootFolder), QStringLiteral("RootFolder"));
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace),
+             QStringLiteral("Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace"));
+    QVERIFY(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Unknown).isEmpty());
+    QVERIFY(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0(42)).isEmpty());
+    QVERIFY(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0(0xFFFFFFFF)).isEmpty());
+
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=84")), QOpcUa::NodeIds::Namespace0::RootFolder);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=42")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=4294967295")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=1;i=84")), QOpcUa::NodeIds::Namespace0::Unknown);
+
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("Boolean")), QOpcUa::NodeIds::Namespace0::Boolean);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("RootFolder")), QOpcUa::NodeIds::Namespace0::RootFolder);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace")),
+             QOpcUa::NodeIds::Namespace0::Server_Namespaces_OPCUANamespaceUri_NamespaceFile_ExportNamespace);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("Unknown")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("rootfolder")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QString()), QOpcUa::NodeIds::Namespace0::Unknown);
+
+    // Every name must map back to its id
+    const auto enumerator = QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>();
+    for (int i = 0; i < enumerator.keyCount(); ++i) {
+        const auto id = QOpcUa::NodeIds::Namespace0(enumerator.value(i));
+        if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+            continue;
+        const QString name = QString::fromLatin1(enumerator.key(i));
+        QCOMPARE(QOpcUa::namespace0IdName(id), name);
+        QCOMPARE(QOpcUa::namespace0IdFromName(name), id);
+    }
+}
+
+void Tst_QOpcUaClient::stringPool()
+{
+    QOpcUaStringPool pool(8, 4);
+
+    const QByteArray value("Value");
+    const QString first = pool.fromUtf8(value.constData(), value.size());
+    const QString second = pool.fromUtf8(value.constData(), value.size());
+    QCOMPARE(first, QStringLiteral("Value"));
+    QCOMPARE(second.constData(), first.constData());
+    QCOMPARE(pool.count(), 1);
+
+    // Long strings are not pooled
+    const QByteArray longValue("EngineeringUnits");
+    QCOMPARE(pool.fromUtf8(longValue.constData(), longValue.size()), QStringLiteral("EngineeringUnits"));
+    QCOMPARE(pool.count(), 1);
+
+    const QString nodeId = pool.numericNodeId(0, 46);
+    QCOMPARE(nodeId, QStringLiteral("ns=0;i=46"));
+    QCOMPARE(pool.numericNodeId(0, 46).constData(), nodeId.constData());
+    QCOMPARE(pool.numericNodeId(2, 46), QStringLiteral("ns=2;i=46"));
+
+    const QString internedLocale = pool.intern(QStringLiteral("en"));
+    QCOMPARE(pool.intern(QString::fromLatin1("en")).constData(), internedLocale.constData());
+    QCOMPARE(pool.count(), 4);
+
+    // The pool is cleared when the maximum count is reached
+    QCOMPARE(pool.intern(QStringLiteral("de")), QStringLiteral("de"));
+    QCOMPARE(pool.count(), 1);
+
+    QVERIFY(!QOpcUaStringPool::forCurrentThread());
+    QOpcUaStringPool::setEnabledForCurrentThread(true);
+    QVERIFY(QOpcUaStringPool::forCurrentThread());
+    QCOMPARE(QOpcUaStringPool::utf8ToString(value.constData(), value.size()).constData(),
+             QOpcUaStringPool::utf8ToString(value.constData(), value.size()).constData());
+    QOpcUaStringPool::setEnabledForCurrentThread(false);
+    QVERIFY(!QOpcUaStringPool::forCurrentThread());
+}
+
+void Tst_QOpcUaClient::browseResult()
+{
+    QOpcUaBrowseResult result;
+    QVERIFY(result.isEmpty());
+
+    QOpcUaReferenceDescription first;
+    first.setRefTypeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Organizes));
+    first.setTargetNodeId(QOpcUaExpandedNodeId(QStringLiteral("ns=2;i=1234")));
+    first.setTypeDefinition(QOpcUaExpandedNodeId(QStringLiteral("http://qt-project.org"), QStringLiteral("ns=0;i=63"), 1));
+    first.setBrowseName(QOpcUaQualifiedName(2, QStringLiteral("First")));
+    first.setDisplayName(QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("First node")));
+    first.setNodeClass(QOpcUa::NodeClass::Variable);
+    first.setIsForwardReference(true);
+
+    QOpcUaReferenceDescription second;
+    second.setRefTypeId(QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::HasComponent));
+    second.setTargetNodeId(QOpcUaExpandedNodeId(QStringLiteral("ns=3;s=Gr\u00fc\u00dfe")));
+    second.setTypeDefinition(QOpcUaExpandedNodeId(QStringLiteral("ns=1;g=08081e75-8e5e-319b-954f-f3a7613dc29b")));
+    second.setBrowseName(QOpcUaQualifiedName(3, QStringLiteral("Second")));
+    second.setDisplayName(QOpcUaLocalizedText(QString(), QStringLiteral("Second node")));
+    second.setNodeClass(QOpcUa::NodeClass::Object);
+    second.setIsForwardReference(false);
+
+    result.append(first);
+    result.append(second);
+    QCOMPARE(result.size(), 2);
+
+    QCOMPARE(result.refTypeId(0), first.refTypeId());
+    QCOMPARE(result.targetNodeId(0), first.targetNodeId());
+    QCOMPARE(result.typeDefinition(0), first.typeDefinition());
+    QCOMPARE(result.browseName(0), first.browseName());
+    QCOMPARE(result.displayName(0), first.displayName());
+    QCOMPARE(result.nodeClass(0), QOpcUa::NodeClass::Variable);
+    QCOMPARE(result.isForwardReference(0), true);
+    QCOMPARE(result.targetNodeId(1).nodeId(), second.targetNodeId().nodeId());
+    QCOMPARE(result.typeDefinition(1).nodeId(), second.typeDefinition().nodeId());
+    QCOMPARE(result.isForwardReference(1), false);
+
+    const auto references = result.toReferenceDescriptions();
+    QCOMPARE(references.size(), 2);
+    for (int i = 0; i < references.size(); ++i) {
+        const QOpcUaReferenceDescription &expected = i ? second : first;
+        QCOMPARE(references.at(i).refTypeId(), expected.refTypeId());
+        QCOMPARE(references.at(i).targetNodeId(), expected.targetNodeId());
+        QCOMPARE(references.at(i).typeDefinition(), expected.typeDefinition());
+        QCOMPARE(references.at(i).browseName(), expected.browseName());
+        QCOMPARE(references.at(i).displayName(), expected.displayName());
+        QCOMPARE(references.at(i).nodeClass(), expected.nodeClass());
+        QCOMPARE(references.at(i).isForwardReference(), expected.isForwardReference());
+    }
+
+    // Copies are not affected by changes to the original
+    const QOpcUaBrowseResult copy = result;
+    result.clear();
+    QVERIFY(result.isEmpty());
+    QCOMPARE(copy.size(), 2);
+    QCOMPARE(copy.at(1).browseName(), second.browseName());
+}
+
+static void releaseTestArray(void *info)
+{
+    *static_cast<bool *>(info) = true;
+}
+
+void Tst_QOpcUaClient::multiDimensionalArrayTypedStorage()
+{
+    QVERIFY(QOpcUaMultiDimensionalArray::isTypedStorageSupported(QOpcUa::Float));
+    QVERIFY(!QOpcUaMultiDimensionalArray::isTypedStorageSupported(QOpcUa::String));
+
+    QOpcUaMultiDimensionalArray arr(QOpcUa::Float, {2, 3});
+    QVERIFY(arr.isValid());
+    QVERIFY(arr.hasTypedStorage());
+    QCOMPARE(arr.elementType(), QOpcUa::Float);
+    QCOMPARE(arr.value({1, 2}), QVariant(0.0f));
+
+    QVERIFY(arr.setValue({1, 2}, 5.5));
+    QVERIFY(!arr.setValue({2, 0}, 1.0));
+    QVERIFY(!arr.setValue({0, 0}, QVariant::fromValue(QOpcUaLocalizedText())));
+    QCOMPARE(arr.typedData<float>()[5], 5.5f);
+    QCOMPARE(arr.value({1, 2}).userType(), static_cast<int>(QMetaType::Float));
+    QCOMPARE(arr.value({1, 2}).toFloat(), 5.5f);
+
+    // Copies share the data until they are modified
+    QOpcUaMultiDimensionalArray copy = arr;
+    QCOMPARE(copy.constData(), arr.constData());
+    QVERIFY(copy.setValue({0, 0}, 1.0f));
+    QVERIFY(copy.constData() != arr.constData());
+    QCOMPARE(arr.value({0, 0}).toFloat(), 0.0f);
+
+    // Typed and list storage with the same values are equal
+    const QOpcUaMultiDimensionalArray list({0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 5.5f}, {2, 3});
+    QVERIFY(!list.hasTypedStorage());
+    QVERIFY(arr == list);
+    QCOMPARE(arr.valueArray(), list.valueArray());
+    QVERIFY(!(arr == copy));
+
+    // Requesting a reference to the list converts the storage
+    QVariantList &values = copy.valueArrayRef();
+    QVERIFY(!copy.hasTypedStorage());
+    QCOMPARE(values.size(), 6);
+    QCOMPARE(values.at(0).toFloat(), 1.0f);
+    QVERIFY(copy.isValid());
+
+    // External data is used without copying and released with the last copy
+    bool released = false;
+    double external[] = {1.0, 2.0, 3.0, 4.0};
+    {
+        QOpcUaMultiDimensionalArray adopted(QOpcUa::Double, external, {2, 2}, &releaseTestArray, &released);
+        QVERIFY(adopted.isValid());
+        QCOMPARE(adopted.typedData<double>(), static_cast<const double *>(external));
+        QCOMPARE(adopted.value({1, 0}).toDouble(), 3.0);
+        const QOpcUaMultiDimensionalArray second = adopted;
+        adopted = QOpcUaMultiDimensionalArray();
+        QVERIFY(!released);
+        QCOMPARE(second.value({1, 1}).toDouble(), 4.0);
+    }
+    QVERIFY(released);
+
+    released = false;
+    QOpcUaMultiDimensionalArray unsupported(QOpcUa::String, external, {2, 2}, &releaseTestArray, &released);
+    QVERIFY(released);
+    QVERIFY(!unsupported.hasTypedStorage());
+    QVERIFY(!unsupported.isValid());
+}
+
+void Tst_QOpcUaClient::multiDimensionalArrayView()
+{
+    QOpcUaMultiDimensionalArray arr(QOpcUa::Int32, {3, 4});
+    for (quint32 i = 0; i < 3; ++i) {
+        for (quint32 j = 0; j < 4; ++j)
+            arr.setValue({i, j}, static_cast<qint32>(i * 10 + j));
+    }
+
+    const QOpcUaMultiDimensionalArrayView view = arr.view();
+    QVERIFY(view.isValid());
+    QVERIFY(view.isContiguous());
+    QCOMPARE(view.size(), 12u);
+    QCOMPARE(view.strides(), QVector<quint32>({4, 1}));
+    QCOMPARE(view.typedValue<qint32>({2, 3}), 23);
+    QCOMPARE(view.constData(), arr.constData());
+
+    // Rows are contiguous, columns are not
+    const QOpcUaMultiDimensionalArrayView row = view.slice(0, 1);
+    QCOMPARE(row.arrayDimensions(), QVector<quint32>({4}));
+    QVERIFY(row.isContiguous());
+    QCOMPARE(row.offset(), 4u);
+    QCOMPARE(row.value({2}), QVariant(12));
+
+    const QOpcUaMultiDimensionalArrayView column = view.slice(1, 2);
+    QCOMPARE(column.arrayDimensions(), QVector<quint32>({3}));
+    QVERIFY(!column.isContiguous());
+    QCOMPARE(column.typedValue<qint32>({2}), 22);
+    QCOMPARE(column.toArray().valueArray(), QVariantList({2, 12, 22}));
+    QCOMPARE(column.constData(), arr.constData());
+
+    const QOpcUaMultiDimensionalArrayView element = row.slice(0, 3);
+    QVERIFY(element.arrayDimensions().isEmpty());
+    QCOMPARE(element.value({}), QVariant(13));
+
+    // Every second column of the last two rows
+    const QOpcUaMultiDimensionalArrayView sub = view.subArray({1, 0}, {2, 2}, {1, 2});
+    QVERIFY(sub.isValid());
+    QCOMPARE(sub.arrayDimensions(), QVector<quint32>({2, 2}));
+    QCOMPARE(sub.strides(), QVector<quint32>({4, 2}));
+    const QOpcUaMultiDimensionalArray subArray = sub.toArray();
+    QVERIFY(subArray.hasTypedStorage());
+    QCOMPARE(subArray.arrayDimensions(), QVector<quint32>({2, 2}));
+    QCOMPARE(subArray.valueArray(), QVariantList({10, 12, 20, 22}));
+
+    QVERIFY(!view.subArray({1, 0}, {2, 3}, {1, 2}).isValid());
+    QVERIFY(!view.subArray({3, 0}, {1, 1}).isValid());
+    QVERIFY(!view.slice(2, 0).isValid());
+    QVERIFY(!view.slice(0, 3).isValid());
+    QCOMPARE(sub.arrayIndex({2, 0}), -1);
+
+    // Views on arrays with list storage
+    const QOpcUaMultiDimensionalArray list({QStringLiteral("a"), QStringLiteral("b"), QStringLiteral("c"), QStringLiteral("d")}, {2, 2});
+    const QOpcUaMultiDimensionalArrayView listColumn = list.view().slice(1, 1);
+    QVERIFY(!listColumn.constData());
+    QCOMPARE(listColumn.value({1}), QVariant(QStringLiteral("d")));
+    QCOMPARE(listColumn.toArray(), QOpcUaMultiDimensionalArray({QStringLiteral("b"), QStringLiteral("d")}, {2}));
+
+    QVERIFY(!QOpcUaMultiDimensionalArray({1, 2, 3}, {2, 2}).view().isValid());
+}
+
+void Tst_QOpcUaClient::clientSideFilterStage()
+{
+    using Filter = QOpcUaMonitoringParameters::DataChangeFilter;
+    const auto attr = QOpcUa::NodeAttribute::Value;
+
+    const auto dataValue = [](const QVariant &value, QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good, qint64 sourceTicks = 0) {
+        QOpcUaDataValue result;
+        result.setValue(value);
+        result.setStatusCode(status);
+        result.setSourceTimestampTicks(sourceTicks);
+        return result;
+    };
+
+    QOpcUaClientSideFilterStage stage;
+    QVERIFY(stage.isEmpty());
+    // Items without a filter are not affected
+    QVERIFY(stage.process(1, attr, dataValue(1.0), 0));
+
+    // Absolute deadband
+    stage.setFilter(1, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValue,
+                                                                          Filter::DeadbandType::Absolute, 0.5));
+    QVERIFY(!stage.isEmpty());
+    QVERIFY(stage.process(1, attr, dataValue(10.0), 0));
+    QVERIFY(!stage.process(1, attr, dataValue(10.4), 0));
+    QVERIFY(!stage.process(1, attr, dataValue(9.6), 0));
+    QVERIFY(stage.process(1, attr, dataValue(10.6), 0));
+    // A status change is always reported
+    QVERIFY(stage.process(1, attr, dataValue(10.6, QOpcUa::UaStatusCode::UncertainLastUsableValue), 0));
+    // Timestamps are ignored for StatusOrValue
+    QVERIFY(!stage.process(1, attr, dataValue(10.6, QOpcUa::UaStatusCode::UncertainLastUsableValue, 1000), 0));
+
+    // Percent deadband relative to the EURange, 5% of 0..200 is 10
+    QOpcUaMonitoringParameters::ClientSideFilter percent(Filter::DataChangeTrigger::StatusOrValue, Filter::DeadbandType::Percent, 5);
+    percent.setEuRange(QOpcUaRange(0, 200));
+    stage.setFilter(2, attr, percent);
+    QVERIFY(stage.process(2, attr, dataValue(100), 0));
+    QVERIFY(!stage.process(2, attr, dataValue(109), 0));
+    QVERIFY(stage.process(2, attr, dataValue(111), 0));
+
+    // Without a valid EURange, every change is reported
+    stage.setFilter(3, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValue,
+                                                                          Filter::DeadbandType::Percent, 5));
+    QVERIFY(stage.process(3, attr, dataValue(100), 0));
+    QVERIFY(!stage.process(3, attr, dataValue(100), 0));
+    QVERIFY(stage.process(3, attr, dataValue(100.5), 0));
+
+    // Status trigger ignores value changes, StatusOrValueOrTimestamp reports timestamp changes
+    stage.setFilter(4, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::Status,
+                                                                          Filter::DeadbandType::None, 0));
+    QVERIFY(stage.process(4, attr, dataValue(1), 0));
+    QVERIFY(!stage.process(4, attr, dataValue(2), 0));
+    QVERIFY(stage.process(4, attr, dataValue(2, QOpcUa::UaStatusCode::BadNoCommunication), 0));
+    stage.setFilter(5, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValueOrTimestamp,
+                                                                          Filter::DeadbandType::None, 0));
+    QVERIFY(stage.process(5, attr, dataValue(1, QOpcUa::UaStatusCode::Good, 1000), 0));
+    QVERIFY(!stage.process(5, attr, dataValue(1, QOpcUa::UaStatusCode::Good, 1000), 0));
+    QVERIFY(stage.process(5, attr, dataValue(1, QOpcUa::UaStatusCode::Good, 2000), 0));
+
+    // Non numeric values and lists
+    stage.setFilter(6, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValue,
+                                                                          Filter::DeadbandType::Absolute, 1));
+    QVERIFY(stage.process(6, attr, dataValue(QStringLiteral("a")), 0));
+    QVERIFY(!stage.process(6, attr, dataValue(QStringLiteral("a")), 0));
+    QVERIFY(stage.process(6, attr, dataValue(QStringLiteral("b")), 0));
+    QVERIFY(stage.process(6, attr, dataValue(QVariantList({1.0, 2.0})), 0));
+    QVERIFY(!stage.process(6, attr, dataValue(QVariantList({1.5, 2.5})), 0));
+    QVERIFY(stage.process(6, attr, dataValue(QVariantList({1.0, 3.5})), 0));
+    QVERIFY(stage.process(6, attr, dataValue(QVariantList({1.0, 3.5, 4.0})), 0));
+
+    // Arrays with typed storage, the change is located after the first comparison block
+    QOpcUaMultiDimensionalArray array(QOpcUa::Double, {10, 20});
+    stage.setFilter(7, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValue,
+                                                                          Filter::DeadbandType::Absolute, 0.5));
+    QVERIFY(stage.process(7, attr, dataValue(QVariant::fromValue(array)), 0));
+    QOpcUaMultiDimensionalArray noise(QOpcUa::Double, {10, 20});
+    noise.setValue({9, 19}, 0.4);
+    QVERIFY(!stage.process(7, attr, dataValue(QVariant::fromValue(noise)), 0));
+    QOpcUaMultiDimensionalArray changed(QOpcUa::Double, {10, 20});
+    changed.setValue({9, 19}, 0.6);
+    QVERIFY(stage.process(7, attr, dataValue(QVariant::fromValue(changed)), 0));
+    // Different dimensions are always a change
+    QVERIFY(stage.process(7, attr, dataValue(QVariant::fromValue(QOpcUaMultiDimensionalArray(QOpcUa::Double, {20, 10}))), 0));
+
+    // Without deadband, every modified element of an integer array is a change
+    QOpcUaMultiDimensionalArray intArray(QOpcUa::Int16, {100});
+    stage.setFilter(8, attr, QOpcUaMonitoringParameters::ClientSideFilter());
+    QVERIFY(stage.process(8, attr, dataValue(QVariant::fromValue(intArray)), 0));
+    QVERIFY(!stage.process(8, attr, dataValue(QVariant::fromValue(intArray)), 0));
+    intArray.setValue({99}, static_cast<qint16>(1));
+    QVERIFY(stage.process(8, attr, dataValue(QVariant::fromValue(intArray)), 0));
+
+    // Minimum reporting interval
+    stage.setFilter(9, attr, QOpcUaMonitoringParameters::ClientSideFilter(Filter::DataChangeTrigger::StatusOrValue,
+                                                                          Filter::DeadbandType::None, 0, 100));
+    QCOMPARE(stage.nextDue(), qint64(-1));
+    QVERIFY(stage.process(9, attr, dataValue(1), 1000));
+    QVERIFY(!stage.process(9, attr, dataValue(2), 1010));
+    QVERIFY(!stage.process(9, attr, dataValue(3), 1020));
+    QCOMPARE(stage.nextDue(), qint64(1100));
+    QCOMPARE(stage.nextDue(9, attr), qint64(1100));
+    QVERIFY(stage.takeDue(1050).isEmpty());
+    auto due = stage.takeDue(1100);
+    QCOMPARE(due.size(), 1);
+    QCOMPARE(due.at(0).handle, quint64(9));
+    QCOMPARE(due.at(0).value.value(), QVariant(3));
+    QCOMPARE(stage.nextDue(), qint64(-1));
+    // The last reported value is now 3, a return to it discards the pending value
+    QVERIFY(!stage.process(9, attr, dataValue(4), 1150));
+    QVERIFY(!stage.process(9, attr, dataValue(3), 1160));
+    QCOMPARE(stage.nextDue(), qint64(-1));
+    QVERIFY(stage.takeDue(1300).isEmpty());
+    QVERIFY(stage.process(9, attr, dataValue(5), 1300));
+
+    // Removing the filter discards the state
+    stage.removeFilter(9, attr);
+    QVERIFY(stage.process(9, attr, dataValue(5), 1300));
+
+    for (quint64 handle = 1; handle <= 8; ++handle)
+        stage.removeFilter(handle, attr);
+    QVERIFY(stage.isEmpty());
+
+    QOpcUaMonitoringParameters p;
+    QVERIFY(!p.clientSideFilter().isValid());
+    p.setClientSideFilter(percent);
+    QCOMPARE(p.clientSideFilter().value<QOpcUaMonitoringParameters::ClientSideFilter>(), percent);
+    p.clearClientSideFilter();
+    QVERIFY(!p.clientSideFilter().isValid());
+}
+
+void Tst_QOpcUaClient::eventRecord()
+{
+    class CountingSource : public QOpcUaEventFieldSource
+    {
+    public:
+        CountingSource(const QVariantList &fields, QVector<int> *conversions)
+            : m_fields(fields)
+            , m_conversions(conversions)
+        {}
+        int size() const override { return m_fields.size(); }
+        QVariant field(int index) const override
+        {
+            ++(*m_conversions)[index];
+            return m_fields.at(index);
+        }
+
+    private:
+        QVariantList m_fields;
+        QVector<int> *m_conversions;
+    };
+
+    QOpcUaMonitoringParameters::EventFilter filter;
+    filter << QOpcUaSimpleAttributeOperand("Severity");
+    filter << QOpcUaSimpleAttributeOperand("Message");
+    QOpcUaSimpleAttributeOperand enabledStateId;
+    enabledStateId.setBrowsePath({QOpcUaQualifiedName(0, QStringLiteral("EnabledState")), QOpcUaQualifiedName(0, QStringLiteral("Id"))});
+    filter << enabledStateId;
+    filter << QOpcUaSimpleAttributeOperand(QOpcUa::NodeAttribute::NodeId, QStringLiteral("ns=0;i=2782")); // ConditionType
+
+    const auto layout = QOpcUaEventRecordLayout::fromFilter(QVariant::fromValue(filter));
+    QVERIFY(layout);
+    QVERIFY(!QOpcUaEventRecordLayout::fromFilter(QVariant::fromValue(QOpcUaMonitoringParameters::DataChangeFilter())));
+
+    const QVariantList values({quint16(700), QStringLiteral("Overpressure"), true, QStringLiteral("ns=2;s=Condition")});
+    QVector<int> conversions(values.size(), 0);
+    const QOpcUaEventRecord record = QOpcUaEventRecordPrivate::create(layout, new CountingSource(values, &conversions));
+
+    QCOMPARE(record.size(), 4);
+    QVERIFY(!record.isEmpty());
+    QCOMPARE(record.selectClauses(), filter.selectClauses());
+    QCOMPARE(record.fieldNames(), QStringList({QStringLiteral("Severity"), QStringLiteral("Message"),
+                                              QStringLiteral("EnabledState/Id"), QStringLiteral("#NodeId")}));
+    QCOMPARE(record.indexOf(QStringLiteral("Message")), 1);
+    QCOMPARE(record.indexOf(QStringLiteral("Time")), -1);
+    QVERIFY(record.contains(QStringLiteral("#NodeId")));
+
+    // Fields are converted on first access and only once, also for copies of the record
+    QCOMPARE(conversions, QVector<int>({0, 0, 0, 0}));
+    QCOMPARE(record.field(QStringLiteral("Severity")).value<quint16>(), quint16(700));
+    QCOMPARE(record.field(0).value<quint16>(), quint16(700));
+    const QOpcUaEventRecord copy = record;
+    QCOMPARE(copy.field(QStringLiteral("EnabledState/Id")), QVariant(true));
+    QCOMPARE(conversions, QVector<int>({1, 0, 1, 0}));
+    QCOMPARE(record.toVariantList(), values);
+    QCOMPARE(conversions, QVector<int>({1, 1, 1, 1}));
+
+    QVERIFY(!record.field(4).isValid());
+    QVERIFY(!record.field(-1).isValid());
+    QVERIFY(!record.field(QStringLiteral("Time")).isValid());
+
+    // Records from already converted values
+    const QOpcUaEventRecord converted(filter.selectClauses(), values);
+    QCOMPARE(converted.size(), 4);
+    QCOMPARE(converted.field(QStringLiteral("Message")), QVariant(QStringLiteral("Overpressure")));
+    QCOMPARE(converted.toVariantList(), values);
+
+    // More fields than select clause elements, e.g. after a modification of the filter
+    const QOpcUaEventRecord extra({QOpcUaSimpleAttributeOperand("Severity")}, {quint16(100), 42});
+    QCOMPARE(extra.size(), 2);
+    QCOMPARE(extra.fieldNames().size(), 1);
+    QCOMPARE(extra.field(1), QVariant(42));
+
+    const QOpcUaEventRecord empty;
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(empty.indexOf(QStringLiteral("Severity")), -1);
+    QVERIFY(empty.toVariantList().isEmpty());
+}
+
+void Tst_QOpcUaClient::conditionCache()
+{
+    QOpcUaConditionCache cache(nullptr);
+    auto d = QOpcUaConditionCachePrivate::get(&cache);
+    const auto selectClauses = cache.selectClauses();
+    QCOMPARE(selectClauses.size(), int(QOpcUaConditionCachePrivate::FieldCount));
+
+    const QString conditionEvent = QStringLiteral("ns=0;i=2915"); // AlarmConditionType
+    const QString refreshStart = QStringLiteral("ns=0;i=2787");
+    const QString refreshEnd = QStringLiteral("ns=0;i=2788");
+
+    const auto event = [&](const QString &eventType, const QString &conditionId, bool retain,
+                           quint16 severity = 500, const QString &branchId = QStringLiteral("ns=0;i=0")) {
+        QVariantList fields;
+        for (int i = 0; i < QOpcUaConditionCachePrivate::FieldCount; ++i)
+            fields.push_back(QVariant());
+        fields[QOpcUaConditionCachePrivate::EventId] = conditionId.toUtf8() + QByteArray::number(severity);
+        fields[QOpcUaConditionCachePrivate::EventType] = eventType;
+        fields[QOpcUaConditionCachePrivate::Severity] = severity;
+        fields[QOpcUaConditionCachePrivate::ConditionId] = conditionId;
+        fields[QOpcUaConditionCachePrivate::BranchId] = branchId;
+        fields[QOpcUaConditionCachePrivate::Retain] = retain;
+        return QOpcUaEventRecord(selectClauses, fields);
+    };
+
+    QSignalSpy changedSpy(&cache, &QOpcUaConditionCache::conditionsChanged);
+    QSignalSpy refreshStartedSpy(&cache, &QOpcUaConditionCache::refreshStarted);
+    QSignalSpy refreshFinishedSpy(&cache, &QOpcUaConditionCache::refreshFinished);
+
+    const QString a = QStringLiteral("ns=2;s=A");
+    const QString b = QStringLiteral("ns=2;s=B");
+    const QString c = QStringLiteral("ns=2;s=C");
+
+    // One signal per batch, a condition added and removed in the same batch is not reported
+    d->processEvents({event(conditionEvent, a, true), event(conditionEvent, b, true),
+                      event(conditionEvent, a, true, 700), event(conditionEvent, c, true), event(conditionEvent, c, false)});
+    QCOMPARE(changedSpy.size(), 1);
+    QStringList added = changedSpy.at(0).at(0).toStringList();
+    added.sort();
+    QCOMPARE(added, QStringList({a, b}));
+    QVERIFY(changedSpy.at(0).at(1).toStringList().isEmpty());
+    QVERIFY(changedSpy.at(0).at(2).toStringList().isEmpty());
+    QCOMPARE(cache.size(), 2);
+    QCOMPARE(cache.condition(a).field(QStringLiteral("Severity")).value<quint16>(), quint16(700));
+    QVERIFY(!cache.contains(c));
+    QVERIFY(cache.condition(c).isEmpty());
+
+    // Branches and events without a condition are ignored
+    changedSpy.clear();
+    d->processEvents({event(conditionEvent, a, true, 100, QStringLiteral("ns=2;i=17")), event(conditionEvent, QString(), true)});
+    QCOMPARE(changedSpy.size(), 0);
+    QCOMPARE(cache.condition(a).field(QStringLiteral("Severity")).value<quint16>(), quint16(700));
+
+    // A removed and re-added condition is reported as changed
+    d->processEvents({event(conditionEvent, b, false), event(conditionEvent, b, true, 300)});
+    QCOMPARE(changedSpy.size(), 1);
+    QVERIFY(changedSpy.at(0).at(0).toStringList().isEmpty());
+    QCOMPARE(changedSpy.at(0).at(1).toStringList(), QStringList({b}));
+    QVERIFY(changedSpy.at(0).at(2).toStringList().isEmpty());
+
+    // Conditions which are not part of a refresh are removed at its end
+    changedSpy.clear();
+    d->processEvents({event(refreshStart, QString(), false), event(conditionEvent, a, true, 800)});
+    QCOMPARE(refreshStartedSpy.size(), 1);
+    QVERIFY(cache.isRefreshing());
+    QCOMPARE(changedSpy.size(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).toStringList(), QStringList({a}));
+    d->processEvents({event(conditionEvent, c, true), event(refreshEnd, QString(), false)});
+    QCOMPARE(refreshFinishedSpy.size(), 1);
+    QVERIFY(!cache.isRefreshing());
+    QCOMPARE(changedSpy.size(), 2);
+    QCOMPARE(changedSpy.at(1).at(0).toStringList(), QStringList({c}));
+    QCOMPARE(changedSpy.at(1).at(2).toStringList(), QStringList({b}));
+    QStringList ids = cache.conditionIds();
+    ids.sort();
+    QCOMPARE(ids, QStringList({a, c}));
+
+    // Without a client, nothing can be enabled or called
+    QVERIFY(!cache.enable());
+    QVERIFY(!cache.isEnabled());
+    QVERIFY(!cache.refresh());
+    QVERIFY(!cache.acknowledge(a, QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Seen"))));
+
+    // A failed enable disables the cache, it can be enabled again
+    QSignalSpy enableFinishedSpy(&cache, &QOpcUaConditionCache::enableFinished);
+    d->m_enabled = true;
+    d->handleEnableMonitoringFinished(QOpcUa::NodeAttribute::EventNotifier, QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    QCOMPARE(enableFinishedSpy.size(), 1);
+    QCOMPARE(enableFinishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    QVERIFY(!cache.isEnabled());
+    QCOMPARE(cache.size(), 2);
+
+    changedSpy.clear();
+    cache.disable();
+    QCOMPARE(cache.size(), 0);
+    QCOMPARE(changedSpy.size(), 1);
+    ids = changedSpy.at(0).at(2).toStringList();
+    ids.sort();
+    QCOMPARE(ids, QStringList({a, c}));
+}
+
+void Tst_QOpcUaClient::tagModelChangedRanges()
+{
+    QOpcUaTagModel model;
+    QCOMPARE(model.monitoringParameters().publishingInterval(), 100.0);
+
+    QStringList nodeIds;
+    for (int i = 0; i < 10; ++i)
+        nodeIds.append(QStringLiteral("ns=1;i=%1").arg(i));
+    model.setNodeIds(nodeIds);
+    QCOMPARE(model.rowCount(), 10);
+    QCOMPARE(model.roleNames().value(QOpcUaTagModel::ValueRole), QByteArray("value"));
+
+    auto d = QOpcUaTagModelPrivate::get(&model);
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+
+    const auto value = [](double v) {
+        QOpcUaDataValue dv;
+        dv.setValue(v);
+        dv.setStatusCode(QOpcUa::UaStatusCode::Good);
+        return dv;
+    };
+
+    const auto ranges = [&dataChangedSpy]() {
+        QVector<QPair<int, int>> result;
+        for (const auto &args : qAsConst(dataChangedSpy))
+            result.push_back(qMakePair(args.at(0).toModelIndex().row(), args.at(1).toModelIndex().row()));
+        return result;
+    };
+
+    // Updates of the same row are merged, adjacent rows form one range regardless of their order
+    for (int row : {7, 3, 2, 9, 4, 3, 8, 0})
+        d->updateValue(row, value(row));
+    QVERIFY(dataChangedSpy.isEmpty());
+
+    d->flushChanges();
+    QCOMPARE(ranges(), (QVector<QPair<int, int>>{{0, 0}, {2, 4}, {7, 9}}));
+    QCOMPARE(dataChangedSpy.at(0).at(2).value<QVector<int>>().contains(QOpcUaTagModel::ValueRole), true);
+    QCOMPARE(model.data(model.index(4)).toDouble(), 4.0);
+    QCOMPARE(model.data(model.index(4), QOpcUaTagModel::StatusCodeRole).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(model.data(model.index(4), QOpcUaTagModel::NodeIdRole).toString(), QStringLiteral("ns=1;i=4"));
+
+    // Nothing is emitted if there are no new changes
+    dataChangedSpy.clear();
+    d->flushChanges();
+    QVERIFY(dataChangedSpy.isEmpty());
+
+    // An unchanged status code does not mark the row
+    d->updateStatusCode(4, QOpcUa::UaStatusCode::Good);
+    d->updateStatusCode(5, QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    d->flushChanges();
+    QCOMPARE(ranges(), (QVector<QPair<int, int>>{{5, 5}}));
+
+    // The pending changes are delivered by the event loop
+    dataChangedSpy.clear();
+    for (int row = 0; row < 10; ++row)
+        d->updateValue(row, value(row * 2));
+    QTRY_COMPARE(dataChangedSpy.size(), 1);
+    QCOMPARE(ranges(), (QVector<QPair<int, int>>{{0, 9}}));
+
+    // Resetting the node ids discards pending changes
+    dataChangedSpy.clear();
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    d->updateValue(1, value(1));
+    model.setNodeIds(nodeIds.mid(0, 2));
+    QCOMPARE(resetSpy.size(), 1);
+    QCOMPARE(model.rowCount(), 2);
+    QVERIFY(!model.data(model.index(1)).isValid());
+    d->flushChanges();
+    QVERIFY(dataChangedSpy.isEmpty());
+}
+
+void Tst_QOpcUaClient::processedHistoryData()
+{
+    const QString aggregate = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average);
+    QOpcUaProcessedHistoryData data(QStringLiteral("ns=3;s=Test.History.Double"), aggregate);
+    QCOMPARE(data.count(), 0);
+    QCOMPARE(data.aggregateType(), aggregate);
+
+    const QDateTime start(QDate(2019, 3, 4), QTime(12, 13, 14, 123), Qt::UTC);
+    // 456.7 microseconds after start, not representable by QDateTime
+    const qint64 startTicks = QOpcUaDataValue::dateTimeToTicks(start) + 4567;
+
+    data.reserve(3);
+    data.append(startTicks, 1.5, QOpcUa::UaStatusCode::Good);
+    data.append(startTicks + 36000000000, std::numeric_limits<double>::quiet_NaN(), QOpcUa::UaStatusCode::BadNoData);
+    data.append(startTicks + 72000000000, 2.5, QOpcUa::UaStatusCode::UncertainDataSubNormal);
+
+    QCOMPARE(data.count(), 3);
+    QCOMPARE(data.timestamps(), QVector<qint64>({startTicks, startTicks + 36000000000, startTicks + 72000000000}));
+    QCOMPARE(data.timestampTicks(0), startTicks);
+    QCOMPARE(data.timestamp(0), start);
+    QCOMPARE(data.timestamp(1), start.addSecs(3600));
+    QCOMPARE(data.value(0), 1.5);
+    QVERIFY(qIsNaN(data.value(1)));
+    QCOMPARE(data.statusCode(1), QOpcUa::UaStatusCode::BadNoData);
+    QCOMPARE(data.statusCode(2), QOpcUa::UaStatusCode::UncertainDataSubNormal);
+
+    // Out of range access
+    QVERIFY(!data.timestamp(3).isValid());
+    QCOMPARE(data.timestampTicks(-1), Q_INT64_C(0));
+    QVERIFY(qIsNaN(data.value(3)));
+    QCOMPARE(data.statusCode(3), QOpcUa::UaStatusCode::BadNoData);
+
+    // Copies are implicitly shared and detach on modification
+    QOpcUaProcessedHistoryData copy = data;
+    copy.append(startTicks + 108000000000, 3.5, QOpcUa::UaStatusCode::Good);
+    QCOMPARE(copy.count(), 4);
+    QCOMPARE(data.count(), 3);
+}
+
 void Tst_QOpcUaClient::statusStrings()
 {
     QCOMPARE(statusToString(QOpcUa::Good), "Good");
@@ -3716,6 +5574,133 @@ void Tst_QOpcUaClient::fixedTimestamp()
     QCOMPARE(value.toDateTime(), QDateTime(QDate(2012, 12, 19), QTime(13, 37)));
 }
 
+void Tst_QOpcUaClient::monitoredValueStatus()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    // The server delivers the value of this node with BadSensorFailure and a fixed source timestamp
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node("ns=2;s=Demo.Static.BadStatus"));
+    QVERIFY(node != nullptr);
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 23.0);
+
+    QCOMPARE(node->valueAttributeError(), QOpcUa::UaStatusCode::BadSensorFailure);
+    QCOMPARE(node->sourceTimestamp(QOpcUa::NodeAttribute::Value), QDateTime(QDate(2012, 12, 19), QTime(13, 37), Qt::UTC));
+    QVERIFY(node->serverTimestamp(QOpcUa::NodeAttribute::Value).isValid());
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::clientSideFilterMonitoring()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    using Filter = QOpcUaMonitoringParameters::DataChangeFilter;
+    using ClientSideFilter = QOpcUaMonitoringParameters::ClientSideFilter;
+
+    QScopedPointer<QOpcUaNode> doubleNode(opcuaClient->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(doubleNode != nullptr);
+    WRITE_VALUE_ATTRIBUTE(doubleNode, 10.0, QOpcUa::Types::Double);
+
+    QSignalSpy monitoringEnabledSpy(doubleNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy monitoringDisabledSpy(doubleNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    QSignalSpy dataChangeSpy(doubleNode.data(), &QOpcUaNode::dataChangeOccurred);
+
+    // The server reports every change, the client drops the changes below the deadband
+    QOpcUaMonitoringParameters p(100);
+    const ClientSideFilter deadband(Filter::DataChangeTrigger::StatusOrValue, Filter::DeadbandType::Absolute, 1.0);
+    p.setClientSideFilter(deadband);
+    doubleNode->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(doubleNode->monitoringStatus(QOpcUa::NodeAttribute::Value).clientSideFilter().value<ClientSideFilter>(), deadband);
+
+    // The initial value is always reported
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 10.0);
+    dataChangeSpy.clear();
+
+    WRITE_VALUE_ATTRIBUTE(doubleNode, 10.5, QOpcUa::Types::Double);
+    dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 0); // The delta is < 1
+
+    // The deadband is relative to the last reported value 10.0, not to the dropped value 10.5
+    WRITE_VALUE_ATTRIBUTE(doubleNode, 11.2, QOpcUa::Types::Double);
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 11.2);
+    QCOMPARE(doubleNode->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 11.2);
+    dataChangeSpy.clear();
+
+    doubleNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+
+    // The Status trigger only reports the initial value and changes of the status code
+    const ClientSideFilter statusOnly(Filter::DataChangeTrigger::Status, Filter::DeadbandType::None, 0);
+    p.setClientSideFilter(statusOnly);
+
+    QScopedPointer<QOpcUaNode> badStatusNode(opcuaClient->node("ns=2;s=Demo.Static.BadStatus"));
+    QVERIFY(badStatusNode != nullptr);
+    QSignalSpy badStatusEnabledSpy(badStatusNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy badStatusDataChangeSpy(badStatusNode.data(), &QOpcUaNode::dataChangeOccurred);
+    badStatusNode->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    badStatusEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(badStatusEnabledSpy.size(), 1);
+    QCOMPARE(badStatusEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    if (badStatusDataChangeSpy.isEmpty())
+        badStatusDataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(badStatusDataChangeSpy.size(), 1);
+    QCOMPARE(badStatusDataChangeSpy.at(0).at(1).toDouble(), 23.0);
+    QCOMPARE(badStatusNode->valueAttributeError(), QOpcUa::UaStatusCode::BadSensorFailure);
+
+    monitoringEnabledSpy.clear();
+    doubleNode->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(monitoringEnabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 11.2);
+    dataChangeSpy.clear();
+
+    // Value changes with a good status are dropped
+    WRITE_VALUE_ATTRIBUTE(doubleNode, 42.0, QOpcUa::Types::Double);
+    dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 0);
+    QCOMPARE(badStatusDataChangeSpy.size(), 1);
+
+    monitoringDisabledSpy.clear();
+    doubleNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+
+    QSignalSpy badStatusDisabledSpy(badStatusNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    badStatusNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    badStatusDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(badStatusDisabledSpy.size(), 1);
+}
+
 void Tst_QOpcUaClient::connectionLost()
 {
     // Restart the test server if necessary
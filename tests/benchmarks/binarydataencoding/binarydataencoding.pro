@@ -0,0 +1,8 @@
+TARGET = tst_bench_binarydataencoding
+
+QT += testlib opcua
+QT -= gui
+CONFIG += release
+
+SOURCES += \
+    tst_bench_binarydataencoding.cpp
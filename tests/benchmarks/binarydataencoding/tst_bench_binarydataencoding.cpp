@@ -0,0 +1,174 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+
+#include <QtTest/QtTest>
+
+class Tst_BenchBinaryDataEncoding : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void decodeDoubleArray();
+    void decodeInt32Array();
+    void encodeDoubleArray();
+    void encodeInt32Array();
+    void encodeApplicationRecordArray();
+    void encodeAxisInformationArray();
+
+private:
+    template <typename T>
+    static QByteArray encodedArray(int size);
+};
+
+static const int arraySize = 1000000;
+static const int structureArraySize = 10000;
+
+template <typename T>
+QByteArray Tst_BenchBinaryDataEncoding::encodedArray(int size)
+{
+    QVector<T> values(size);
+    for (int i = 0; i < size; ++i)
+        values[i] = static_cast<T>(i);
+
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+    encoder.encodeArray<T>(values);
+    return buffer;
+}
+
+void Tst_BenchBinaryDataEncoding::decodeDoubleArray()
+{
+    QByteArray buffer = encodedArray<double>(arraySize);
+    QVector<double> result;
+
+    QBENCHMARK {
+        QOpcUaBinaryDataEncoding decoder(&buffer);
+        bool success = false;
+        result = decoder.decodeArray<double>(success);
+        QVERIFY(success);
+    }
+
+    QCOMPARE(result.size(), arraySize);
+    QCOMPARE(result.last(), double(arraySize - 1));
+}
+
+void Tst_BenchBinaryDataEncoding::decodeInt32Array()
+{
+    QByteArray buffer = encodedArray<qint32>(arraySize);
+    QVector<qint32> result;
+
+    QBENCHMARK {
+        QOpcUaBinaryDataEncoding decoder(&buffer);
+        bool success = false;
+        result = decoder.decodeArray<qint32>(success);
+        QVERIFY(success);
+    }
+
+    QCOMPARE(result.size(), arraySize);
+    QCOMPARE(result.last(), qint32(arraySize - 1));
+}
+
+void Tst_BenchBinaryDataEncoding::encodeDoubleArray()
+{
+    const QVector<double> values(arraySize, 42.0);
+
+    QBENCHMARK {
+        QByteArray buffer;
+        QOpcUaBinaryDataEncoding encoder(&buffer);
+        QVERIFY(encoder.encodeArray<double>(values));
+    }
+}
+
+void Tst_BenchBinaryDataEncoding::encodeInt32Array()
+{
+    const QVector<qint32> values(arraySize, 42);
+
+    QBENCHMARK {
+        QByteArray buffer;
+        QOpcUaBinaryDataEncoding encoder(&buffer);
+        QVERIFY(encoder.encodeArray<qint32>(values));
+    }
+}
+
+void Tst_BenchBinaryDataEncoding::encodeApplicationRecordArray()
+{
+    QOpcUaApplicationRecordDataType record;
+    record.setApplicationId(QLatin1String("ns=2;s=Application"));
+    record.setApplicationUri(QLatin1String("urn:example.org:Application"));
+    record.setApplicationType(QOpcUaApplicationDescription::ApplicationType::Server);
+    record.setApplicationNames({QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Application")),
+                                QOpcUaLocalizedText(QLatin1String("de"), QLatin1String("Anwendung"))});
+    record.setProductUri(QLatin1String("urn:example.org:Product"));
+    record.setDiscoveryUrls({QLatin1String("opc.tcp://localhost:4840"), QLatin1String("opc.tcp://127.0.0.1:4840")});
+    record.setServerCapabilityIdentifiers({QLatin1String("DA"), QLatin1String("HD")});
+    const QVector<QOpcUaApplicationRecordDataType> values(structureArraySize, record);
+
+    const qint64 expectedSize = QOpcUaBinaryDataEncoding::encodedArraySize(values);
+    QVERIFY(expectedSize > 0);
+
+    QBENCHMARK {
+        QByteArray buffer;
+        QOpcUaBinaryDataEncoding encoder(&buffer);
+        QVERIFY(encoder.encodeArray<QOpcUaApplicationRecordDataType>(values));
+        QCOMPARE(qint64(buffer.size()), expectedSize);
+    }
+}
+
+void Tst_BenchBinaryDataEncoding::encodeAxisInformationArray()
+{
+    const QOpcUaEUInformation engineeringUnits(QLatin1String("http://www.opcfoundation.org/UA/units/un/cefact"), 4408652,
+                                               QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Cel")),
+                                               QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("degree Celsius")));
+    const QOpcUaAxisInformation axis(engineeringUnits, QOpcUaRange(-40, 120), QOpcUaLocalizedText(QLatin1String("en"), QLatin1String("Temperature")),
+                                     QOpcUa::AxisScale::Linear, QVector<double>(16, 10.0));
+    const QVector<QOpcUaAxisInformation> values(structureArraySize, axis);
+
+    const qint64 expectedSize = QOpcUaBinaryDataEncoding::encodedArraySize(values);
+    QVERIFY(expectedSize > 0);
+
+    QBENCHMARK {
+        QByteArray buffer;
+        QOpcUaBinaryDataEncoding encoder(&buffer);
+        QVERIFY(encoder.encodeArray<QOpcUaAxisInformation>(values));
+        QCOMPARE(qint64(buffer.size()), expectedSize);
+    }
+}
+
+QTEST_GUILESS_MAIN(Tst_BenchBinaryDataEncoding)
+
+#include "tst_bench_binarydataencoding.moc"
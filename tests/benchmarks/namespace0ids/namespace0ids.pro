@@ -0,0 +1,8 @@
+TARGET = tst_bench_namespace0ids
+
+QT += testlib opcua
+QT -= gui
+CONFIG += release
+
+SOURCES += \
+    tst_bench_namespace0ids.cpp
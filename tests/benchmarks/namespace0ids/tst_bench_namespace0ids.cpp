@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qmetaobject.h>
+#include <QtTest/QtTest>
+
+class Tst_BenchNamespace0Ids : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void namespace0IdName();
+    void namespace0IdNameMetaEnum();
+    void namespace0IdFromNodeId();
+    void namespace0IdFromName();
+    void namespace0IdFromNameMetaEnum();
+
+private:
+    QVector<QOpcUa::NodeIds::Namespace0> m_ids;
+    QStringList m_nodeIds;
+    QStringList m_names;
+};
+
+void Tst_BenchNamespace0Ids::initTestCase()
+{
+#ifdef QT_OPCUA_NO_NS0IDNAMES
+    QSKIP("Qt OPC UA has been configured without namespace 0 id names");
+#else
+    const auto enumerator = QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>();
+    for (int i = 0; i < enumerator.keyCount(); ++i) {
+        const auto id = QOpcUa::NodeIds::Namespace0(enumerator.value(i));
+        if (id == QOpcUa::NodeIds::Namespace0::Unknown)
+            continue;
+        m_ids.push_back(id);
+        m_nodeIds.push_back(QOpcUa::namespace0Id(id));
+        m_names.push_back(QString::fromLatin1(enumerator.key(i)));
+    }
+    QVERIFY(!m_ids.isEmpty());
+#endif
+}
+
+void Tst_BenchNamespace0Ids::namespace0IdName()
+{
+    QBENCHMARK {
+        for (const auto id : qAsConst(m_ids))
+            QOpcUa::namespace0IdName(id);
+    }
+}
+
+// The previous implementation for comparison
+void Tst_BenchNamespace0Ids::namespace0IdNameMetaEnum()
+{
+    const auto enumerator = QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>();
+
+    QBENCHMARK {
+        for (const auto id : qAsConst(m_ids))
+            QString::fromUtf8(enumerator.valueToKey(quint32(id)));
+    }
+}
+
+void Tst_BenchNamespace0Ids::namespace0IdFromNodeId()
+{
+    QBENCHMARK {
+        for (const auto &nodeId : qAsConst(m_nodeIds))
+            QOpcUa::namespace0IdFromNodeId(nodeId);
+    }
+}
+
+void Tst_BenchNamespace0Ids::namespace0IdFromName()
+{
+    QBENCHMARK {
+        for (const auto &name : qAsConst(m_names))
+            QOpcUa::namespace0IdFromName(name);
+    }
+}
+
+void Tst_BenchNamespace0Ids::namespace0IdFromNameMetaEnum()
+{
+    const auto enumerator = QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>();
+
+    QBENCHMARK {
+        for (const auto &name : qAsConst(m_names))
+            enumerator.keyToValue(name.toLatin1().constData());
+    }
+}
+
+QTEST_GUILESS_MAIN(Tst_BenchNamespace0Ids)
+
+#include "tst_bench_namespace0ids.moc"
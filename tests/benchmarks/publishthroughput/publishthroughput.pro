@@ -0,0 +1,8 @@
+TARGET = tst_bench_publishthroughput
+
+QT += testlib opcua network
+QT -= gui
+CONFIG += release
+
+SOURCES += \
+    tst_bench_publishthroughput.cpp
@@ -0,0 +1,292 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt OPC UA module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QProcess>
+#include <QtCore/QQueue>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QTimer>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+#include <QtTest/QtTest>
+
+// Forwards the data of one direction of a connection after a fixed delay
+class DelayedPipe : public QObject
+{
+public:
+    DelayedPipe(QTcpSocket *source, QTcpSocket *target, int delay)
+        : QObject(source)
+        , m_target(target)
+        , m_delay(delay)
+    {
+        m_clock.start();
+        m_timer.setSingleShot(true);
+        m_timer.setTimerType(Qt::PreciseTimer);
+        QObject::connect(source, &QTcpSocket::readyRead, this, [this, source]() {
+            m_pending.enqueue(qMakePair(m_clock.elapsed() + m_delay, source->readAll()));
+            if (!m_timer.isActive())
+                m_timer.start(m_delay);
+        });
+        QObject::connect(&m_timer, &QTimer::timeout, this, &DelayedPipe::flush);
+    }
+
+private:
+    void flush()
+    {
+        const qint64 now = m_clock.elapsed();
+        while (!m_pending.isEmpty() && m_pending.head().first <= now)
+            m_target->write(m_pending.dequeue().second);
+        if (!m_pending.isEmpty())
+            m_timer.start(static_cast<int>(m_pending.head().first - now));
+    }
+
+    QTcpSocket *m_target;
+    int m_delay;
+    QElapsedTimer m_clock;
+    QTimer m_timer;
+    QQueue<QPair<qint64, QByteArray>> m_pending;
+};
+
+// A TCP proxy which simulates a link with a round trip time of twice the delay
+class DelayedLinkProxy : public QTcpServer
+{
+public:
+    DelayedLinkProxy(const QString &targetHost, quint16 targetPort, int delay)
+        : m_targetHost(targetHost)
+        , m_targetPort(targetPort)
+        , m_delay(delay)
+    {}
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override
+    {
+        auto client = new QTcpSocket(this);
+        client->setSocketDescriptor(socketDescriptor);
+        auto server = new QTcpSocket(client);
+        server->connectToHost(m_targetHost, m_targetPort);
+
+        new DelayedPipe(client, server, m_delay);
+        new DelayedPipe(server, client, m_delay);
+
+        QObject::connect(client, &QTcpSocket::disconnected, server, &QTcpSocket::disconnectFromHost);
+        QObject::connect(server, &QTcpSocket::disconnected, client, &QTcpSocket::disconnectFromHost);
+        QObject::connect(client, &QTcpSocket::disconnected, client, &QObject::deleteLater);
+    }
+
+private:
+    QString m_targetHost;
+    quint16 m_targetPort;
+    int m_delay;
+};
+
+class Tst_BenchPublishThroughput : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void notificationsPerSecond_data();
+    void notificationsPerSecond();
+
+private:
+    QOpcUaProvider m_provider;
+    QProcess m_serverProcess;
+    QScopedPointer<DelayedLinkProxy> m_proxy;
+    QScopedPointer<QOpcUaClient> m_writer;
+    QOpcUaEndpointDescription m_endpoint;
+};
+
+static const int linkDelay = 40; // Milliseconds per direction
+static const int measurementDuration = 5000;
+static const int signalSpyTimeout = 10000;
+
+static const QVector<QPair<QString, QOpcUa::Types>> monitoredNodes = {
+    {QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"), QOpcUa::Types::Double},
+    {QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"), QOpcUa::Types::Float},
+    {QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"), QOpcUa::Types::Int32},
+    {QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32"), QOpcUa::Types::UInt32}
+};
+
+void Tst_BenchPublishThroughput::initTestCase()
+{
+    if (!QOpcUaProvider::availableBackends().contains(QLatin1String("open62541")))
+        QSKIP("The open62541 backend is not available");
+
+    const quint16 defaultPort = 43344;
+    QString host = qEnvironmentVariable("OPCUA_HOST");
+    quint16 port = static_cast<quint16>(qEnvironmentVariableIntValue("OPCUA_PORT"));
+
+    if (host.isEmpty() && !port) {
+        const QString serverPath = qApp->applicationDirPath()
+#if defined(Q_OS_MACOS)
+                + QLatin1String("/../../open62541-testserver/open62541-testserver.app/Contents/MacOS/open62541-testserver");
+#elif defined(Q_OS_WIN)
+                + QLatin1String("/../../../open62541-testserver/open62541-testserver.exe");
+#else
+                + QLatin1String("/../../open62541-testserver/open62541-testserver");
+#endif
+        if (!QFile::exists(serverPath))
+            QSKIP("This benchmark relies on the open62541-based test server");
+
+        m_serverProcess.start(serverPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+
+        QTcpSocket socket;
+        QTRY_VERIFY_WITH_TIMEOUT((socket.connectToHost(QHostAddress::LocalHost, defaultPort),
+                                  socket.waitForConnected(500)), signalSpyTimeout);
+        socket.disconnectFromHost();
+    }
+    if (host.isEmpty())
+        host = QHostAddress(QHostAddress::LocalHost).toString();
+    if (!port)
+        port = defaultPort;
+
+    m_proxy.reset(new DelayedLinkProxy(host, port, linkDelay));
+    QVERIFY(m_proxy->listen(QHostAddress::LocalHost));
+
+    // The writer is connected directly and changes the values as fast as possible
+    m_writer.reset(m_provider.createClient(QLatin1String("open62541")));
+    QVERIFY(m_writer != nullptr);
+
+    QSignalSpy endpointSpy(m_writer.data(), &QOpcUaClient::endpointsRequestFinished);
+    m_writer->requestEndpoints(QUrl(QStringLiteral("opc.tcp://%1:%2").arg(host).arg(port)));
+    QVERIFY(endpointSpy.wait(signalSpyTimeout));
+    const auto endpoints = endpointSpy.at(0).at(0).value<QVector<QOpcUaEndpointDescription>>();
+    QVERIFY(!endpoints.isEmpty());
+    m_endpoint = endpoints.first();
+
+    m_writer->connectToEndpoint(m_endpoint);
+    QTRY_COMPARE_WITH_TIMEOUT(m_writer->state(), QOpcUaClient::Connected, signalSpyTimeout);
+}
+
+void Tst_BenchPublishThroughput::cleanupTestCase()
+{
+    if (m_writer) {
+        m_writer->disconnectFromEndpoint();
+        QTRY_COMPARE_WITH_TIMEOUT(m_writer->state(), QOpcUaClient::Disconnected, signalSpyTimeout);
+    }
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void Tst_BenchPublishThroughput::notificationsPerSecond_data()
+{
+    QTest::addColumn<int>("outstandingPublishRequests");
+    QTest::addColumn<bool>("adaptive");
+
+    QTest::newRow("1 request") << 1 << false;
+    QTest::newRow("3 requests") << 3 << false;
+    QTest::newRow("10 requests") << 10 << false;
+    QTest::newRow("adaptive") << 20 << true;
+}
+
+void Tst_BenchPublishThroughput::notificationsPerSecond()
+{
+    QFETCH(int, outstandingPublishRequests);
+    QFETCH(bool, adaptive);
+
+    QVariantMap backendProperties;
+    backendProperties.insert(QLatin1String("outstandingPublishRequests"), outstandingPublishRequests);
+    backendProperties.insert(QLatin1String("adaptivePublishRequests"), adaptive);
+    QScopedPointer<QOpcUaClient> client(m_provider.createClient(QLatin1String("open62541"), backendProperties));
+    QVERIFY(client != nullptr);
+
+    QOpcUaEndpointDescription endpoint = m_endpoint;
+    endpoint.setEndpointUrl(QStringLiteral("opc.tcp://127.0.0.1:%1").arg(m_proxy->serverPort()));
+    client->connectToEndpoint(endpoint);
+    QTRY_COMPARE_WITH_TIMEOUT(client->state(), QOpcUaClient::Connected, signalSpyTimeout);
+
+    QVector<QOpcUaNode *> monitored;
+    QVector<QOpcUaNode *> written;
+    const auto cleanup = qScopeGuard([&]() {
+        qDeleteAll(monitored);
+        qDeleteAll(written);
+        client->disconnectFromEndpoint();
+        QTRY_COMPARE_WITH_TIMEOUT(client->state(), QOpcUaClient::Disconnected, signalSpyTimeout);
+    });
+
+    quint64 notifications = 0;
+    for (const auto &entry : monitoredNodes) {
+        QOpcUaNode *node = client->node(entry.first);
+        QVERIFY(node != nullptr);
+        monitored.append(node);
+        QObject::connect(node, &QOpcUaNode::dataChangeOccurred, [&notifications]() { ++notifications; });
+
+        // One subscription per node with a short publishing interval
+        QSignalSpy monitoringSpy(node, &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value,
+                               QOpcUaMonitoringParameters(10, QOpcUaMonitoringParameters::SubscriptionType::Exclusive));
+        QVERIFY(monitoringSpy.wait(signalSpyTimeout));
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+        QOpcUaNode *writerNode = m_writer->node(entry.first);
+        QVERIFY(writerNode != nullptr);
+        written.append(writerNode);
+    }
+
+    quint32 counter = 0;
+    QTimer writeTimer;
+    writeTimer.setInterval(2);
+    QObject::connect(&writeTimer, &QTimer::timeout, [&]() {
+        ++counter;
+        for (int i = 0; i < written.size(); ++i)
+            written.at(i)->writeValueAttribute(QVariant(counter % 1000), monitoredNodes.at(i).second);
+    });
+
+    writeTimer.start();
+    QTest::qWait(1000); // Let the number of outstanding publish requests settle
+    notifications = 0;
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+    QTest::qWait(measurementDuration);
+    const qint64 duration = elapsed.elapsed();
+    writeTimer.stop();
+
+    QVERIFY(notifications > 0);
+    QTest::setBenchmarkResult(notifications * 1000.0 / duration, QTest::Events);
+}
+
+QTEST_MAIN(Tst_BenchPublishThroughput)
+
+#include "tst_bench_publishthroughput.moc"
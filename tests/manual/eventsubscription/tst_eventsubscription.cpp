@@ -186,6 +186,7 @@ void EventsubscriptionTest::eventSubscription()
 
     QSignalSpy enabledSpy(serverNode.data(), &QOpcUaNode::enableMonitoringFinished);
     QSignalSpy eventSpy(serverNode.data(), &QOpcUaNode::eventOccurred);
+    QSignalSpy eventsSpy(serverNode.data(), &QOpcUaNode::eventsOccurred);
 
     QOpcUaMonitoringParameters::EventFilter filter;
     filter << QOpcUaSimpleAttributeOperand("Severity");
@@ -231,9 +232,16 @@ void EventsubscriptionTest::eventSubscription()
     QCOMPARE(severity, 100);
     QCOMPARE(message, QOpcUaLocalizedText("en-US", "An event has been generated."));
 
+    QCOMPARE(eventsSpy.size(), 1);
+    auto records = eventsSpy.at(0).at(0).value<QVector<QOpcUaEventRecord>>();
+    QCOMPARE(records.size(), 1);
+    QCOMPARE(records.at(0).field(QStringLiteral("Severity")).value<quint16>(), severity);
+    QCOMPARE(records.at(0).field(QStringLiteral("Message")).value<QOpcUaLocalizedText>(), message);
+
     qDebug() << "Modifying event filter...";
 
     eventSpy.clear();
+    eventsSpy.clear();
 
     QSignalSpy modifySpy(serverNode.data(), &QOpcUaNode::monitoringStatusChanged);
     filter << QOpcUaSimpleAttributeOperand("SourceNode");
@@ -264,6 +272,12 @@ void EventsubscriptionTest::eventSubscription()
     QCOMPARE(message, QOpcUaLocalizedText("en-US", "An event has been generated."));
     QCOMPARE(sourceNode, QStringLiteral("ns=0;i=2253"));
 
+    QCOMPARE(eventsSpy.size(), 1);
+    records = eventsSpy.at(0).at(0).value<QVector<QOpcUaEventRecord>>();
+    QCOMPARE(records.size(), 1);
+    QCOMPARE(records.at(0).indexOf(QStringLiteral("SourceNode")), 2);
+    QCOMPARE(records.at(0).field(QStringLiteral("SourceNode")).toString(), sourceNode);
+
     QSignalSpy disabledSpy(serverNode.data(), &QOpcUaNode::disableMonitoringFinished);
     serverNode->disableMonitoring(QOpcUa::NodeAttribute::EventNotifier);
     disabledSpy.wait();
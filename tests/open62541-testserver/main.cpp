@@ -203,6 +203,12 @@ int main(int argc, char **argv)
     server.addVariable(testFolder, "ns=2;s=Demo.Static.Scalar.ExtensionObject", "ExtensionObjectScalarTest",
                                                     QOpcUaExtensionObject(), QOpcUa::Types::ExtensionObject);
     server.addNodeWithFixedTimestamp(testFolder, "ns=2;s=Demo.Static.FixedTimestamp", "FixedTimestamp");
+    server.addNodeWithBadStatus(testFolder, "ns=2;s=Demo.Static.BadStatus", "BadStatus");
+
+    // The HistoryRead service is served by the test server, see TestServer::historyReadService()
+    server.addHistorizingVariable(testFolder, "ns=3;s=Test.History.Double", "HistorizingDouble");
+    server.addHistorizingVariable(testFolder, "ns=3;s=Test.History.FailingDouble", "HistorizingFailingDouble", true);
+    server.addContinuationPointCountVariable(testFolder, "ns=3;s=Test.History.ContinuationPoints", "HistoryContinuationPoints");
 
     // Create folders containing child nodes with string, guid and opaque node ids
     UA_NodeId testStringIdsFolder = server.addFolder("ns=3;s=testStringIdsFolder", "testStringIdsFolder");
@@ -29,6 +29,7 @@ QMAKE_CFLAGS_RELEASE_WITH_DEBUGINFO -= -O2
 SOURCES += \
            main.cpp \
            testserver.cpp \
+           $$PWD/../../src/plugins/opcua/open62541/qopen62541historytypes.cpp \
            $$PWD/../../src/plugins/opcua/open62541/qopen62541utils.cpp \
            $$PWD/../../src/plugins/opcua/open62541/qopen62541valueconverter.cpp
 
@@ -45,6 +45,7 @@
 #include <QFile>
 
 #include <cstring>
+#include <limits>
 
 QT_BEGIN_NAMESPACE
 
@@ -244,6 +245,19 @@ bool TestServer::init()
     if (!success || !m_config)
         return false;
 
+#if defined UA_QT_ENABLE_CUSTOM_SERVICES
+    // The bundled open62541 is built without UA_ENABLE_HISTORIZING, the HistoryRead
+    // service is served by historyReadService() using the type descriptions of the plugin
+    m_config->customDataTypes = &QOpen62541HistoryTypes::dataTypeArray;
+
+    m_historyReadService.requestEncodingId = UA_NS0ID_HISTORYREADREQUEST_ENCODING_DEFAULTBINARY;
+    m_historyReadService.requestType = &QOpen62541HistoryTypes::types[QOpen62541HistoryTypes::HistoryReadRequestType];
+    m_historyReadService.responseType = &QOpen62541HistoryTypes::types[QOpen62541HistoryTypes::HistoryReadResponseType];
+    m_historyReadService.service = &TestServer::historyReadService;
+    m_historyReadService.serviceContext = this;
+    UA_Server_setCustomServices(m_server, &m_historyReadService, 1);
+#endif
+
     return true;
 }
 
@@ -760,4 +774,287 @@ UA_NodeId TestServer::addNodeWithFixedTimestamp(const UA_NodeId &folder, const Q
     return resultId;
 }
 
+UA_NodeId TestServer::addHistorizingVariable(const UA_NodeId &folder, const QString &nodeId, const QString &displayName,
+                                             bool failOnContinuation)
+{
+    UA_NodeId variableNodeId = Open62541Utils::nodeIdFromQString(nodeId);
+
+    UA_VariableAttributes attr = UA_VariableAttributes_default;
+    attr.value = QOpen62541ValueConverter::toOpen62541Variant(0.0, QOpcUa::Double);
+    attr.displayName = UA_LOCALIZEDTEXT_ALLOC("en_US", displayName.toUtf8().constData());
+    attr.dataType = attr.value.type->typeId;
+    attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE | UA_ACCESSLEVELMASK_HISTORYREAD;
+    attr.userAccessLevel = attr.accessLevel;
+    attr.historizing = true;
+
+    UA_QualifiedName variableName;
+    variableName.namespaceIndex = variableNodeId.namespaceIndex;
+    variableName.name = attr.displayName.text;
+
+    UA_NodeId resultId;
+    UA_StatusCode result = UA_Server_addVariableNode(m_server,
+                                                     variableNodeId,
+                                                     folder,
+                                                     UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                                     variableName,
+                                                     UA_NODEID_NULL,
+                                                     attr,
+                                                     nullptr,
+                                                     &resultId);
+
+    UA_NodeId_deleteMembers(&variableNodeId);
+    UA_VariableAttributes_deleteMembers(&attr);
+
+    if (result != UA_STATUSCODE_GOOD) {
+        qWarning() << "Could not add historizing variable:" << result;
+        return UA_NODEID_NULL;
+    }
+
+#if defined UA_QT_ENABLE_CUSTOM_SERVICES
+    // 25 samples with a distance of 30 minutes, the last one half an hour before the server start
+    const int sampleCount = 25;
+    const UA_DateTime now = UA_DateTime_now();
+    QVector<HistorySample> &samples = m_history[nodeId];
+    samples.reserve(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+        samples.push_back({now - (sampleCount - i) * 30 * 60 * UA_DATETIME_SEC, static_cast<double>(i)});
+
+    if (failOnContinuation)
+        m_failingHistoryNodes.insert(nodeId);
+#else
+    Q_UNUSED(failOnContinuation);
+#endif
+
+    return resultId;
+}
+
+UA_NodeId TestServer::addContinuationPointCountVariable(const UA_NodeId &folder, const QString &nodeId,
+                                                        const QString &displayName)
+{
+#if defined UA_QT_ENABLE_CUSTOM_SERVICES
+    m_continuationPointCountNode = nodeId;
+#endif
+    return addVariable(folder, nodeId, displayName, static_cast<quint32>(0), QOpcUa::Types::UInt32);
+}
+
+#if defined UA_QT_ENABLE_CUSTOM_SERVICES
+/*
+    Answers HistoryRead requests from the samples of the variables added by addHistorizingVariable().
+    Raw reads return the samples in the requested time range, processed reads support the Average aggregate.
+    At most maxValuesPerResponse values are returned per node and response, the remaining values are
+    available via a continuation point.
+*/
+void TestServer::historyReadService(UA_Server *server, const UA_NodeId *sessionId, void *serviceContext,
+                                    const void *request, void *response)
+{
+    Q_UNUSED(server);
+    Q_UNUSED(sessionId);
+
+    using namespace QOpen62541HistoryTypes;
+
+    const auto testServer = static_cast<TestServer *>(serviceContext);
+    const auto req = static_cast<const HistoryReadRequest *>(request);
+    const auto res = static_cast<HistoryReadResponse *>(response);
+
+    const UA_ExtensionObject &details = req->historyReadDetails;
+    if (details.encoding != UA_EXTENSIONOBJECT_DECODED ||
+            (!isType(details.content.decoded.type, ReadRawModifiedDetailsType) &&
+             !isType(details.content.decoded.type, ReadProcessedDetailsType))) {
+        res->responseHeader.serviceResult = UA_STATUSCODE_BADHISTORYOPERATIONINVALID;
+        return;
+    }
+
+    if (!req->nodesToReadSize) {
+        res->responseHeader.serviceResult = UA_STATUSCODE_BADNOTHINGTODO;
+        return;
+    }
+
+    if (isType(details.content.decoded.type, ReadProcessedDetailsType) &&
+            static_cast<const ReadProcessedDetails *>(details.content.decoded.data)->aggregateTypeSize != req->nodesToReadSize) {
+        res->responseHeader.serviceResult = UA_STATUSCODE_BADAGGREGATELISTMISMATCH;
+        return;
+    }
+
+    // Simulates a server which is unable to continue a read, the continuation points stay valid
+    if (!req->releaseContinuationPoints) {
+        for (size_t i = 0; i < req->nodesToReadSize; ++i) {
+            if (req->nodesToRead[i].continuationPoint.length &&
+                    testServer->m_failingHistoryNodes.contains(Open62541Utils::nodeIdToQString(req->nodesToRead[i].nodeId))) {
+                res->responseHeader.serviceResult = UA_STATUSCODE_BADINTERNALERROR;
+                return;
+            }
+        }
+    }
+
+    res->results = static_cast<HistoryReadResult *>(UA_Array_new(req->nodesToReadSize, &types[HistoryReadResultType]));
+    res->resultsSize = req->nodesToReadSize;
+    for (size_t i = 0; i < req->nodesToReadSize; ++i)
+        testServer->readHistory(req, i, &res->results[i]);
+
+    testServer->updateContinuationPointCount();
+}
+
+void TestServer::readHistory(const QOpen62541HistoryTypes::HistoryReadRequest *request, size_t index,
+                             QOpen62541HistoryTypes::HistoryReadResult *result)
+{
+    using namespace QOpen62541HistoryTypes;
+
+    const int maxValuesPerResponse = 10;
+    const HistoryReadValueId &nodeToRead = request->nodesToRead[index];
+
+    int position = 0;
+    if (nodeToRead.continuationPoint.length) {
+        const auto continuationPoint = QOpen62541ValueConverter::scalarToQt<QByteArray, UA_ByteString>(&nodeToRead.continuationPoint);
+        const auto it = m_historyContinuationPoints.find(continuationPoint);
+        if (it == m_historyContinuationPoints.end()) {
+            result->statusCode = UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+            return;
+        }
+        position = it.value();
+        m_historyContinuationPoints.erase(it);
+    }
+
+    if (request->releaseContinuationPoints) {
+        result->statusCode = UA_STATUSCODE_GOOD;
+        return;
+    }
+
+    const auto history = m_history.constFind(Open62541Utils::nodeIdToQString(nodeToRead.nodeId));
+    if (history == m_history.constEnd()) {
+        result->statusCode = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+        return;
+    }
+
+    QVector<UA_DataValue> values;
+    int maxValues = maxValuesPerResponse;
+
+    if (isType(request->historyReadDetails.content.decoded.type, ReadRawModifiedDetailsType)) {
+        const auto details = static_cast<const ReadRawModifiedDetails *>(request->historyReadDetails.content.decoded.data);
+        if (details->isReadModified) {
+            result->statusCode = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+            return;
+        }
+
+        if (details->numValuesPerNode)
+            maxValues = qMin(maxValues, static_cast<int>(details->numValuesPerNode));
+
+        const UA_DateTime endTime = details->endTime ? details->endTime : std::numeric_limits<UA_DateTime>::max();
+        for (const auto &sample : history.value()) {
+            if (sample.timestamp < details->startTime || sample.timestamp > endTime)
+                continue;
+            UA_DataValue value;
+            UA_DataValue_init(&value);
+            UA_Variant_setScalarCopy(&value.value, &sample.value, &UA_TYPES[UA_TYPES_DOUBLE]);
+            value.hasValue = true;
+            value.sourceTimestamp = value.serverTimestamp = sample.timestamp;
+            value.hasSourceTimestamp = value.hasServerTimestamp = true;
+            values.push_back(value);
+        }
+    } else {
+        const auto details = static_cast<const ReadProcessedDetails *>(request->historyReadDetails.content.decoded.data);
+        const UA_NodeId average = UA_NODEID_NUMERIC(0, UA_NS0ID_AGGREGATEFUNCTION_AVERAGE);
+        if (!UA_NodeId_equal(&details->aggregateType[index], &average)) {
+            result->statusCode = UA_STATUSCODE_BADAGGREGATENOTSUPPORTED;
+            return;
+        }
+
+        const UA_DateTime interval = details->processingInterval > 0
+                ? static_cast<UA_DateTime>(details->processingInterval * UA_DATETIME_MSEC)
+                : details->endTime - details->startTime;
+        for (UA_DateTime start = details->startTime; interval > 0 && start < details->endTime; start += interval) {
+            double sum = 0;
+            int count = 0;
+            for (const auto &sample : history.value()) {
+                if (sample.timestamp >= start && sample.timestamp < start + interval) {
+                    sum += sample.value;
+                    ++count;
+                }
+            }
+            UA_DataValue value;
+            UA_DataValue_init(&value);
+            if (count) {
+                const double average = sum / count;
+                UA_Variant_setScalarCopy(&value.value, &average, &UA_TYPES[UA_TYPES_DOUBLE]);
+                value.hasValue = true;
+            } else {
+                value.status = UA_STATUSCODE_BADNODATA;
+                value.hasStatus = true;
+            }
+            value.sourceTimestamp = start;
+            value.hasSourceTimestamp = true;
+            values.push_back(value);
+        }
+    }
+
+    const int count = qBound(0, values.size() - position, maxValues);
+    auto data = static_cast<HistoryData *>(UA_new(&types[HistoryDataType]));
+    data->dataValues = static_cast<UA_DataValue *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_DATAVALUE]));
+    data->dataValuesSize = count;
+    for (int i = 0; i < values.size(); ++i) {
+        // The values of the current response are moved, all others are deleted
+        if (i >= position && i < position + count)
+            data->dataValues[i - position] = values.at(i);
+        else
+            UA_DataValue_deleteMembers(&values[i]);
+    }
+
+    result->historyData.encoding = UA_EXTENSIONOBJECT_DECODED;
+    result->historyData.content.decoded.type = &types[HistoryDataType];
+    result->historyData.content.decoded.data = data;
+    result->statusCode = UA_STATUSCODE_GOOD;
+
+    if (position + count < values.size()) {
+        const QByteArray continuationPoint = QByteArray::number(++m_lastContinuationPoint);
+        m_historyContinuationPoints.insert(continuationPoint, position + count);
+        QOpen62541ValueConverter::scalarFromQt<UA_ByteString, QByteArray>(continuationPoint, &result->continuationPoint);
+    }
+}
+
+// Continuation points of sessions which have been closed during a read are never removed
+void TestServer::updateContinuationPointCount()
+{
+    if (m_continuationPointCountNode.isEmpty())
+        return;
+
+    UA_NodeId nodeId = Open62541Utils::nodeIdFromQString(m_continuationPointCountNode);
+    UA_Variant value = QOpen62541ValueConverter::toOpen62541Variant(static_cast<quint32>(m_historyContinuationPoints.size()),
+                                                                  QOpcUa::Types::UInt32);
+    const UA_StatusCode result = UA_Server_writeValue(m_server, nodeId, value);
+    if (result != UA_STATUSCODE_GOOD)
+        qWarning() << "Could not update the number of continuation points:" << result;
+    UA_NodeId_deleteMembers(&nodeId);
+    UA_Variant_deleteMembers(&value);
+}
+#endif
+
+UA_NodeId TestServer::addNodeWithBadStatus(const UA_NodeId &folder, const QString &nodeId, const QString &displayName)
+{
+    const UA_NodeId variableNodeId = addVariable(folder, nodeId, displayName, 23.0, QOpcUa::Types::Double);
+    if (UA_NodeId_isNull(&variableNodeId))
+        return UA_NODEID_NULL;
+
+    // The value keeps its last known state but is marked as coming from a failed sensor
+    UA_WriteValue wv;
+    UA_WriteValue_init(&wv);
+    wv.nodeId = variableNodeId;
+    wv.attributeId = UA_ATTRIBUTEID_VALUE;
+    UA_DataValue_init(&wv.value);
+    wv.value.value = QOpen62541ValueConverter::toOpen62541Variant(23.0, QOpcUa::Double);
+    wv.value.hasValue = true;
+    wv.value.status = UA_STATUSCODE_BADSENSORFAILURE;
+    wv.value.hasStatus = true;
+    wv.value.sourceTimestamp = UA_DateTime_fromUnixTime(1355924220); // 2012-12-19T13:37:00Z
+    wv.value.hasSourceTimestamp = true;
+
+    const UA_StatusCode result = UA_Server_write(m_server, &wv);
+    UA_Variant_deleteMembers(&wv.value.value);
+
+    if (result != UA_STATUSCODE_GOOD) {
+        qWarning() << "Could not set the status of" << nodeId << ":" << result;
+        return UA_NODEID_NULL;
+    }
+
+    return variableNodeId;
+}
+
 QT_END_NAMESPACE
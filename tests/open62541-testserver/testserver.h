@@ -38,10 +38,13 @@
 #define TESTSERVER_H
 
 #include <qopen62541.h>
+#include <qopen62541historytypes.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/QDateTime>
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QTimer>
 #include <QtCore/QVariant>
 #include <QtCore/QVector>
@@ -74,6 +77,10 @@ public:
     UA_NodeId addMultipleOutputArgumentsMethod(const UA_NodeId &folder, const QString &variableNode, const QString &description);
     UA_NodeId addAddNamespaceMethod(const UA_NodeId &folder, const QString &variableNode, const QString &description);
     UA_NodeId addNodeWithFixedTimestamp(const UA_NodeId &folder, const QString &nodeId, const QString &displayName);
+    UA_NodeId addHistorizingVariable(const UA_NodeId &folder, const QString &nodeId, const QString &displayName,
+                                     bool failOnContinuation = false);
+    UA_NodeId addContinuationPointCountVariable(const UA_NodeId &folder, const QString &nodeId, const QString &displayName);
+    UA_NodeId addNodeWithBadStatus(const UA_NodeId &folder, const QString &nodeId, const QString &displayName);
 
     static UA_StatusCode multiplyMethod(UA_Server *server, const UA_NodeId *sessionId, void *sessionHandle,
                                             const UA_NodeId *methodId, void *methodContext,
@@ -92,6 +99,25 @@ public:
                                             void *objectContext, size_t inputSize, const UA_Variant *input, size_t outputSize,
                                             UA_Variant *output);
 
+#if defined UA_QT_ENABLE_CUSTOM_SERVICES
+    static void historyReadService(UA_Server *server, const UA_NodeId *sessionId, void *serviceContext,
+                                   const void *request, void *response);
+    void readHistory(const QOpen62541HistoryTypes::HistoryReadRequest *request, size_t index,
+                     QOpen62541HistoryTypes::HistoryReadResult *result);
+    void updateContinuationPointCount();
+
+    struct HistorySample {
+        UA_DateTime timestamp;
+        double value;
+    };
+
+    UA_Server_CustomService m_historyReadService;
+    QHash<QString, QVector<HistorySample>> m_history;
+    QSet<QString> m_failingHistoryNodes;
+    QHash<QByteArray, int> m_historyContinuationPoints; // Continuation point -> index of the next value
+    quint32 m_lastContinuationPoint{0};
+    QString m_continuationPointCountNode;
+#endif
 
     UA_ServerConfig *m_config{nullptr};
     UA_Server *m_server{nullptr};
@@ -38,6 +38,9 @@
 #include <QCoreApplication>
 #include <QDebug>
 #include <QFile>
+#include <QVector>
+
+#include <algorithm>
 
 
 /*
@@ -128,7 +131,7 @@ void createSourceHeader(QTextStream &output)
 {
     createLicenseHeader(output);
     output << "\n\n";
-    output << "#include \"qopcuanodeids.h\"" << "\n\n";
+    output << "#include \"qopcuanodeids_p.h\"" << "\n\n";
     output << "QT_BEGIN_NAMESPACE" << "\n\n";
     output << R"(/*!
     \namespace QOpcUa::NodeIds
@@ -153,13 +156,73 @@ void createSourceHeader(QTextStream &output)
     output << "    " << "\\value Unknown" << "\n";
 }
 
-void createSourceFooter(QTextStream &output)
+using NodeIdEntry = QPair<quint32, QString>;
+
+void writeIndexArray(QTextStream &output, const char *name, const QVector<quint16> &indices)
+{
+    output << "const quint16 QOpcUaNodeIdsPrivate::" << name << "[] = {";
+    for (int i = 0; i < indices.size(); ++i) {
+        output << (i % 16 ? " " : "\n    ") << indices.at(i);
+        if (i + 1 < indices.size())
+            output << ",";
+    }
+    output << "\n};\n\n";
+}
+
+/*
+ * The name tables allow lookups without QMetaEnum, which has to do a linear search
+ * over several thousand enum values for each conversion.
+ */
+bool createLookupTables(QTextStream &output, QVector<NodeIdEntry> entries)
+{
+    if (entries.size() >= 0xFFFF) {
+        qDebug() << "Too many node ids for 16 bit table indices";
+        return false;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const NodeIdEntry &a, const NodeIdEntry &b) {
+        return a.first < b.first;
+    });
+
+    const quint32 maxId = entries.isEmpty() ? 0 : entries.last().first;
+
+    output << "#ifndef QT_OPCUA_NO_NS0IDNAMES" << "\n\n";
+    output << "const QOpcUaNodeIdsPrivate::Namespace0Name QOpcUaNodeIdsPrivate::namespace0Names[] = {" << "\n";
+    for (int i = 0; i < entries.size(); ++i) {
+        output << "    " << QStringLiteral("{%1, \"%2\"}").arg(entries.at(i).first).arg(entries.at(i).second);
+        output << (i + 1 < entries.size() ? "," : "") << "\n";
+    }
+    output << "};" << "\n\n";
+    output << "const int QOpcUaNodeIdsPrivate::namespace0NameCount = " << entries.size() << ";\n";
+    output << "const quint32 QOpcUaNodeIdsPrivate::namespace0MaxId = " << maxId << ";\n\n";
+
+    // Maps each id to the index of its entry + 1, 0 marks unknown ids
+    QVector<quint16> idIndices(int(maxId) + 1, 0);
+    for (int i = 0; i < entries.size(); ++i)
+        idIndices[int(entries.at(i).first)] = quint16(i + 1);
+    writeIndexArray(output, "namespace0IdIndices", idIndices);
+
+    QVector<quint16> nameOrder(entries.size());
+    for (int i = 0; i < entries.size(); ++i)
+        nameOrder[i] = quint16(i);
+    std::sort(nameOrder.begin(), nameOrder.end(), [&entries](quint16 a, quint16 b) {
+        return entries.at(a).second < entries.at(b).second;
+    });
+    writeIndexArray(output, "namespace0NameOrder", nameOrder);
+
+    output << "#endif" << "\n\n";
+    return true;
+}
+
+bool createSourceFooter(QTextStream &output, const QVector<NodeIdEntry> &entries)
 {
     output << "*/" << "\n\n";
+    const bool success = createLookupTables(output, entries);
     output << "QT_END_NAMESPACE" << "\n";
+    return success;
 }
 
-bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream &outputSource)
+bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream &outputSource, QVector<NodeIdEntry> &entries)
 {
     QStringList parts = line.trimmed().split(QLatin1String(","));
 
@@ -172,6 +235,7 @@ bool nodeIdFromLine(const QString &line, QTextStream &outputHeader, QTextStream
 
     outputHeader << "            " << QStringLiteral("%1 = %2,").arg(parts.at(0)).arg(identifier) << "\n";
     outputSource << "    " << QStringLiteral("\\value %1").arg(parts.at(0)) << "\n";
+    entries.push_back(qMakePair(quint32(identifier), parts.at(0)));
     return true;
 }
 
@@ -224,19 +288,20 @@ int main(int argc, char *argv[])
     QTextStream outSourceStream(&outSource);
     createHeader(outHeaderStream);
     createSourceHeader(outSourceStream);
-    nodeIdFromLine(currentLine, outHeaderStream, outSourceStream);
+    QVector<NodeIdEntry> entries;
+    nodeIdFromLine(currentLine, outHeaderStream, outSourceStream, entries);
 
     while (!inputFile.atEnd()) {
         currentLine = inputFile.readLine();
-        nodeIdFromLine(currentLine, outHeaderStream, outSourceStream);
+        nodeIdFromLine(currentLine, outHeaderStream, outSourceStream, entries);
     }
 
     createFooter(outHeaderStream);
-    createSourceFooter(outSourceStream);
+    const bool success = createSourceFooter(outSourceStream, entries);
 
     inputFile.close();
     outHeader.close();
     outSource.close();
 
-    return EXIT_SUCCESS;
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,125 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "nodesetgenerator.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+/*
+ * This generator creates a header with typed accessors for the nodes of a NodeSet2 XML file.
+ *
+ * The header contains
+ * - constexpr node ids for all nodes of the nodeset
+ * - relative path descriptors for all instance nodes which are reachable from a node outside of the nodeset
+ * - C++ enums and structs for the enumerated and structured data types with a binary DataTypeDefinition
+ * - QOpcUaBinaryDataEncoding specializations for the generated structs
+ * - a registerDecoders() function which adds the structs to QOpcUaExtensionObjectDecoderRegistry
+ *
+ * The node ids in the header use the namespace indices of the nodeset, the Namespaces class maps them
+ * to the namespace indices of a server using the content of the server's namespace array.
+ *
+ * Usage:
+ * qtopcua-nodesetgenerator -i Machine.NodeSet2.xml -o machine_nodeset.h -n Machine
+ *
+ * qmake projects can use the generator with CONFIG += qtopcua_nodeset and OPCUA_NODESETS += Machine.NodeSet2.xml,
+ * CMake projects with qt5_opcua_generate_nodeset().
+*/
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.setApplicationDescription("\nThis application generates a C++ header with node ids, browse paths and structure codecs from a NodeSet2 XML file.");
+    parser.addOption(QCommandLineOption("i", "The NodeSet2 XML file", "input file"));
+    parser.addOption(QCommandLineOption("o", "The generated header file, defaults to <input base name>_nodeset.h", "output file"));
+    parser.addOption(QCommandLineOption("n", "The C++ namespace of the generated code, defaults to the input base name", "namespace"));
+    parser.process(app);
+
+    if (!parser.isSet("i")) {
+        qDebug() << "Error: No input file specified";
+        return EXIT_FAILURE;
+    }
+
+    QFile inputFile(parser.value("i"));
+
+    if (!inputFile.open(QFile::ReadOnly)) {
+        qDebug() << "Failed to open file" << inputFile.fileName();
+        return EXIT_FAILURE;
+    }
+
+    NodeSetGenerator generator;
+    if (!generator.parse(&inputFile)) {
+        qDebug() << generator.errorString();
+        return EXIT_FAILURE;
+    }
+    inputFile.close();
+
+    // Machine.NodeSet2.xml has the base name "Machine"
+    const QString baseName = QFileInfo(inputFile.fileName()).fileName().section(QLatin1Char('.'), 0, 0);
+    const QString outputName = parser.isSet("o") ? parser.value("o") : baseName.toLower() + QLatin1String("_nodeset.h");
+    QString cppNamespace = parser.isSet("n") ? parser.value("n") : baseName;
+    cppNamespace.remove(QRegularExpression(QLatin1String("[^A-Za-z0-9_]")));
+    if (cppNamespace.isEmpty() || cppNamespace.at(0).isDigit())
+        cppNamespace.prepend(QLatin1String("NodeSet"));
+
+    QString headerGuard = QFileInfo(outputName).fileName().toUpper();
+    headerGuard.replace(QRegularExpression(QLatin1String("[^A-Z0-9_]")), QLatin1String("_"));
+
+    QFile outHeader(outputName);
+    if (!outHeader.open(QFile::WriteOnly | QFile::Text | QFile::Truncate)) {
+        qDebug() << "Failed to open output file" << outHeader.fileName();
+        return EXIT_FAILURE;
+    }
+
+    QTextStream outHeaderStream(&outHeader);
+    outHeaderStream.setCodec("UTF-8");
+    if (!generator.generate(outHeaderStream, cppNamespace, headerGuard)) {
+        qDebug() << generator.errorString();
+        outHeader.close();
+        outHeader.remove();
+        return EXIT_FAILURE;
+    }
+
+    outHeader.close();
+
+    return EXIT_SUCCESS;
+}
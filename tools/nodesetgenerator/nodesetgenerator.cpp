@@ -0,0 +1,992 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "nodesetgenerator.h"
+
+#include <QtCore/qxmlstream.h>
+
+#include <functional>
+
+namespace {
+
+const QLatin1String nodeSetNamespace("http://opcfoundation.org/UA/2011/03/UANodeSet.xsd");
+
+// Namespace 0 identifiers used by the generator
+enum : quint32 {
+    Structure = 22,
+    Enumeration = 29,
+    HierarchicalReferences = 33,
+    HasChild = 34,
+    Organizes = 35,
+    HasEventSource = 36,
+    HasEncoding = 38,
+    Aggregates = 44,
+    HasSubtype = 45,
+    HasProperty = 46,
+    HasComponent = 47,
+    HasNotifier = 48,
+    HasOrderedComponent = 49,
+    HasAddIn = 17604
+};
+
+struct BuiltinType {
+    const char *cppType;
+    const char *overlay;
+};
+
+// Data types of namespace 0 which are supported by QOpcUaBinaryDataEncoding
+const QHash<quint32, BuiltinType> &builtinTypes()
+{
+    static const QHash<quint32, BuiltinType> types = {
+        {1, {"bool", nullptr}},
+        {2, {"qint8", nullptr}},
+        {3, {"quint8", nullptr}},
+        {4, {"qint16", nullptr}},
+        {5, {"quint16", nullptr}},
+        {6, {"qint32", nullptr}},
+        {7, {"quint32", nullptr}},
+        {8, {"qint64", nullptr}},
+        {9, {"quint64", nullptr}},
+        {10, {"float", nullptr}},
+        {11, {"double", nullptr}},
+        {12, {"QString", nullptr}},
+        {13, {"QDateTime", nullptr}},
+        {14, {"QUuid", nullptr}},
+        {15, {"QByteArray", nullptr}},
+        {17, {"QString", "QOpcUa::Types::NodeId"}},
+        {18, {"QOpcUaExpandedNodeId", nullptr}},
+        {19, {"QOpcUa::UaStatusCode", nullptr}},
+        {20, {"QOpcUaQualifiedName", nullptr}},
+        {21, {"QOpcUaLocalizedText", nullptr}},
+        {22, {"QOpcUaExtensionObject", nullptr}},
+        {288, {"quint32", nullptr}}, // IntegerId
+        {289, {"quint32", nullptr}}, // Counter
+        {290, {"double", nullptr}}, // Duration
+        {291, {"QString", nullptr}}, // NumericRange
+        {292, {"QString", nullptr}}, // Time
+        {294, {"QDateTime", nullptr}}, // UtcTime
+        {295, {"QString", nullptr}}, // LocaleId
+        {296, {"QOpcUaArgument", nullptr}},
+        {884, {"QOpcUaRange", nullptr}},
+        {887, {"QOpcUaEUInformation", nullptr}},
+        {12079, {"QOpcUaAxisInformation", nullptr}},
+        {12080, {"QOpcUaXValue", nullptr}},
+        {12171, {"QOpcUaComplexNumber", nullptr}},
+        {12172, {"QOpcUaDoubleComplexNumber", nullptr}}
+    };
+    return types;
+}
+
+// Names which may be used without alias definition in the nodeset
+const QHash<QString, quint32> &builtinNames()
+{
+    static const QHash<QString, quint32> names = {
+        {QStringLiteral("Boolean"), 1}, {QStringLiteral("SByte"), 2}, {QStringLiteral("Byte"), 3},
+        {QStringLiteral("Int16"), 4}, {QStringLiteral("UInt16"), 5}, {QStringLiteral("Int32"), 6},
+        {QStringLiteral("UInt32"), 7}, {QStringLiteral("Int64"), 8}, {QStringLiteral("UInt64"), 9},
+        {QStringLiteral("Float"), 10}, {QStringLiteral("Double"), 11}, {QStringLiteral("String"), 12},
+        {QStringLiteral("DateTime"), 13}, {QStringLiteral("Guid"), 14}, {QStringLiteral("ByteString"), 15},
+        {QStringLiteral("NodeId"), 17}, {QStringLiteral("ExpandedNodeId"), 18}, {QStringLiteral("StatusCode"), 19},
+        {QStringLiteral("QualifiedName"), 20}, {QStringLiteral("LocalizedText"), 21}, {QStringLiteral("Structure"), 22},
+        {QStringLiteral("Enumeration"), 29},
+        {QStringLiteral("HierarchicalReferences"), HierarchicalReferences}, {QStringLiteral("HasChild"), HasChild},
+        {QStringLiteral("Organizes"), Organizes}, {QStringLiteral("HasEventSource"), HasEventSource},
+        {QStringLiteral("HasEncoding"), HasEncoding}, {QStringLiteral("Aggregates"), Aggregates},
+        {QStringLiteral("HasSubtype"), HasSubtype}, {QStringLiteral("HasProperty"), HasProperty},
+        {QStringLiteral("HasComponent"), HasComponent}, {QStringLiteral("HasNotifier"), HasNotifier},
+        {QStringLiteral("HasOrderedComponent"), HasOrderedComponent}, {QStringLiteral("HasAddIn"), HasAddIn}
+    };
+    return names;
+}
+
+bool isHierarchical(quint32 referenceType)
+{
+    switch (referenceType) {
+    case HierarchicalReferences:
+    case HasChild:
+    case Organizes:
+    case HasEventSource:
+    case Aggregates:
+    case HasProperty:
+    case HasComponent:
+    case HasNotifier:
+    case HasOrderedComponent:
+    case HasAddIn:
+        return true;
+    default:
+        return false;
+    }
+}
+
+const QSet<QString> &cppKeywords()
+{
+    static const QSet<QString> keywords = {
+        QStringLiteral("alignas"), QStringLiteral("alignof"), QStringLiteral("and"), QStringLiteral("auto"),
+        QStringLiteral("bool"), QStringLiteral("break"), QStringLiteral("case"), QStringLiteral("catch"),
+        QStringLiteral("char"), QStringLiteral("class"), QStringLiteral("const"), QStringLiteral("constexpr"),
+        QStringLiteral("continue"), QStringLiteral("default"), QStringLiteral("delete"), QStringLiteral("do"),
+        QStringLiteral("double"), QStringLiteral("else"), QStringLiteral("enum"), QStringLiteral("explicit"),
+        QStringLiteral("export"), QStringLiteral("extern"), QStringLiteral("false"), QStringLiteral("float"),
+        QStringLiteral("for"), QStringLiteral("friend"), QStringLiteral("goto"), QStringLiteral("if"),
+        QStringLiteral("inline"), QStringLiteral("int"), QStringLiteral("long"), QStringLiteral("mutable"),
+        QStringLiteral("namespace"), QStringLiteral("new"), QStringLiteral("not"), QStringLiteral("nullptr"),
+        QStringLiteral("operator"), QStringLiteral("or"), QStringLiteral("private"), QStringLiteral("protected"),
+        QStringLiteral("public"), QStringLiteral("register"), QStringLiteral("return"), QStringLiteral("short"),
+        QStringLiteral("signed"), QStringLiteral("sizeof"), QStringLiteral("static"), QStringLiteral("struct"),
+        QStringLiteral("switch"), QStringLiteral("template"), QStringLiteral("this"), QStringLiteral("throw"),
+        QStringLiteral("true"), QStringLiteral("try"), QStringLiteral("typedef"), QStringLiteral("typename"),
+        QStringLiteral("union"), QStringLiteral("unsigned"), QStringLiteral("using"), QStringLiteral("virtual"),
+        QStringLiteral("void"), QStringLiteral("volatile"), QStringLiteral("while"), QStringLiteral("signals"),
+        QStringLiteral("slots"), QStringLiteral("emit")
+    };
+    return keywords;
+}
+
+} // namespace
+
+NodeSetGenerator::NodeId NodeSetGenerator::parseNodeId(const QString &nodeId)
+{
+    NodeId result;
+
+    QString identifier = nodeId;
+    if (identifier.startsWith(QLatin1String("ns="))) {
+        const int separator = identifier.indexOf(QLatin1Char(';'));
+        if (separator < 0)
+            return result;
+        bool ok = false;
+        result.namespaceIndex = identifier.midRef(3, separator - 3).toInt(&ok);
+        if (!ok || result.namespaceIndex < 0)
+            return result;
+        identifier = identifier.mid(separator + 1);
+    }
+
+    if (identifier.startsWith(QLatin1String("i="))) {
+        bool ok = false;
+        result.numericIdentifier = identifier.midRef(2).toUInt(&ok);
+        result.isValid = ok;
+    } else if (identifier.startsWith(QLatin1String("s="))) {
+        result.stringIdentifier = identifier.mid(2);
+        result.isNumeric = false;
+        result.isValid = !result.stringIdentifier.isEmpty();
+    }
+
+    return result;
+}
+
+// Creates a C++ identifier from a browse name
+QString NodeSetGenerator::sanitize(const QString &name)
+{
+    QString result;
+    result.reserve(name.size());
+    for (const QChar c : name) {
+        if ((c >= QLatin1Char('a') && c <= QLatin1Char('z')) || (c >= QLatin1Char('A') && c <= QLatin1Char('Z'))
+                || (c >= QLatin1Char('0') && c <= QLatin1Char('9')) || c == QLatin1Char('_'))
+            result.append(c);
+    }
+
+    if (result.isEmpty())
+        return QStringLiteral("Unnamed");
+    if (result.at(0).isDigit())
+        result.prepend(QLatin1Char('_'));
+    if (cppKeywords().contains(result))
+        result.append(QLatin1Char('_'));
+    return result;
+}
+
+QString NodeSetGenerator::memberName(const QString &name)
+{
+    QString result = sanitize(name);
+    if (result.at(0).isUpper()) {
+        // Lower the leading uppercase letters, "EURange" becomes "euRange"
+        int i = 0;
+        while (i < result.size() && result.at(i).isUpper())
+            ++i;
+        const int count = (i > 1 && i < result.size()) ? i - 1 : i;
+        for (int j = 0; j < count; ++j)
+            result[j] = result.at(j).toLower();
+    }
+    if (cppKeywords().contains(result))
+        result.append(QLatin1Char('_'));
+    return result;
+}
+
+QString NodeSetGenerator::cppString(const QString &value)
+{
+    QString result = QStringLiteral("\"");
+    const QByteArray utf8 = value.toUtf8();
+    for (const char c : utf8) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            result += QLatin1Char('\\') + QLatin1Char(c);
+        } else if (byte < 0x20 || byte >= 0x7f) {
+            // Octal escapes don't consume following hex digits like \x does
+            result += QStringLiteral("\\%1").arg(byte, 3, 8, QLatin1Char('0'));
+        } else {
+            result += QLatin1Char(c);
+        }
+    }
+    result += QLatin1Char('"');
+    return result;
+}
+
+bool NodeSetGenerator::parse(QIODevice *device)
+{
+    QXmlStreamReader reader(device);
+    Node *currentNode = nullptr;
+    Reference currentReference;
+    bool inReferences = false;
+    QString currentAlias;
+
+    while (!reader.atEnd()) {
+        reader.readNext();
+
+        if (reader.isStartElement()) {
+            if (reader.namespaceUri() != nodeSetNamespace)
+                continue;
+
+            const auto attributes = reader.attributes();
+            const auto name = reader.name();
+
+            if (name == QLatin1String("Uri")) {
+                m_namespaceUris.append(reader.readElementText().trimmed());
+            } else if (name == QLatin1String("Alias")) {
+                const QString alias = attributes.value(QLatin1String("Alias")).toString();
+                m_aliases.insert(alias, reader.readElementText().trimmed());
+            } else if (name.startsWith(QLatin1String("UA")) && attributes.hasAttribute(QLatin1String("NodeId"))) {
+                Node node;
+                node.nodeClass = name.mid(2).toString();
+                node.nodeId = attributes.value(QLatin1String("NodeId")).toString();
+                node.parsedNodeId = parseNodeId(node.nodeId);
+                node.symbolicName = attributes.value(QLatin1String("SymbolicName")).toString();
+                node.parentNodeId = attributes.value(QLatin1String("ParentNodeId")).toString();
+
+                const QString browseName = attributes.value(QLatin1String("BrowseName")).toString();
+                const int separator = browseName.indexOf(QLatin1Char(':'));
+                bool ok = false;
+                const int index = separator > 0 ? browseName.leftRef(separator).toInt(&ok) : 0;
+                node.browseNameIndex = ok ? index : 0;
+                node.browseName = ok ? browseName.mid(separator + 1) : browseName;
+
+                m_nodeIndices.insert(node.nodeId, m_nodes.size());
+                m_nodes.push_back(node);
+                currentNode = &m_nodes.last();
+            } else if (currentNode && name == QLatin1String("References")) {
+                inReferences = true;
+            } else if (currentNode && inReferences && name == QLatin1String("Reference")) {
+                Reference reference;
+                reference.referenceType = attributes.value(QLatin1String("ReferenceType")).toString();
+                reference.isForward = attributes.value(QLatin1String("IsForward")) != QLatin1String("false");
+                reference.target = reader.readElementText().trimmed();
+                currentNode->references.push_back(reference);
+            } else if (currentNode && name == QLatin1String("Definition")) {
+                currentNode->hasDefinition = true;
+                currentNode->isUnion = attributes.value(QLatin1String("IsUnion")) == QLatin1String("true");
+                currentNode->isOptionSet = attributes.value(QLatin1String("IsOptionSet")) == QLatin1String("true");
+            } else if (currentNode && currentNode->hasDefinition && name == QLatin1String("Field")) {
+                Field field;
+                field.name = attributes.value(QLatin1String("Name")).toString();
+                field.dataType = attributes.value(QLatin1String("DataType")).toString();
+                if (attributes.hasAttribute(QLatin1String("ValueRank")))
+                    field.valueRank = attributes.value(QLatin1String("ValueRank")).toInt();
+                field.isOptional = attributes.value(QLatin1String("IsOptional")) == QLatin1String("true");
+                if (attributes.hasAttribute(QLatin1String("Value"))) {
+                    field.hasValue = true;
+                    field.value = attributes.value(QLatin1String("Value")).toLongLong();
+                }
+                currentNode->fields.push_back(field);
+            }
+        } else if (reader.isEndElement()) {
+            if (reader.name() == QLatin1String("References"))
+                inReferences = false;
+            else if (currentNode && reader.name().startsWith(QLatin1String("UA")))
+                currentNode = nullptr;
+        }
+    }
+
+    if (reader.hasError()) {
+        m_errorString = QStringLiteral("Failed to parse the nodeset: %1 (line %2)").arg(reader.errorString()).arg(reader.lineNumber());
+        return false;
+    }
+
+    // Index the forward hierarchical references to find the parents of nodes without ParentNodeId
+    for (const auto &node : qAsConst(m_nodes)) {
+        for (const auto &reference : node.references) {
+            if (!reference.isForward)
+                continue;
+            const quint32 type = referenceTypeId(reference.referenceType);
+            if (isHierarchical(type) || type == HasEncoding) {
+                Parent parent;
+                parent.nodeId = node.nodeId;
+                parent.referenceType = type;
+                parent.isEncoding = type == HasEncoding;
+                m_forwardParents.insert(resolveAlias(reference.target), parent);
+            }
+        }
+    }
+
+    return true;
+}
+
+QString NodeSetGenerator::errorString() const
+{
+    return m_errorString;
+}
+
+QString NodeSetGenerator::resolveAlias(const QString &value) const
+{
+    const auto alias = m_aliases.constFind(value);
+    if (alias != m_aliases.constEnd())
+        return alias.value();
+
+    const auto builtin = builtinNames().constFind(value);
+    if (builtin != builtinNames().constEnd())
+        return QStringLiteral("i=%1").arg(builtin.value());
+
+    return value;
+}
+
+// Returns the numeric identifier of a namespace 0 reference type or 0
+quint32 NodeSetGenerator::referenceTypeId(const QString &referenceType) const
+{
+    const NodeId nodeId = parseNodeId(resolveAlias(referenceType));
+    if (!nodeId.isValid || !nodeId.isNumeric || nodeId.namespaceIndex != 0)
+        return 0;
+    return nodeId.numericIdentifier;
+}
+
+bool NodeSetGenerator::isModelNode(const QString &nodeId) const
+{
+    return m_nodeIndices.contains(nodeId) && parseNodeId(nodeId).namespaceIndex > 0;
+}
+
+bool NodeSetGenerator::isTypeNode(const Node &node) const
+{
+    return node.nodeClass.endsWith(QLatin1String("Type"));
+}
+
+QString NodeSetGenerator::superType(const Node &node) const
+{
+    for (const auto &reference : node.references) {
+        if (!reference.isForward && referenceTypeId(reference.referenceType) == HasSubtype)
+            return resolveAlias(reference.target);
+    }
+    return QString();
+}
+
+bool NodeSetGenerator::isSubtypeOf(const QString &nodeId, quint32 baseType) const
+{
+    const QString base = QStringLiteral("i=%1").arg(baseType);
+    QString current = nodeId;
+    // The depth limit protects against cyclic type hierarchies
+    for (int depth = 0; depth < 64 && !current.isEmpty(); ++depth) {
+        if (current == base)
+            return true;
+        const auto index = m_nodeIndices.constFind(current);
+        if (index == m_nodeIndices.constEnd())
+            return false;
+        current = superType(m_nodes.at(index.value()));
+    }
+    return false;
+}
+
+NodeSetGenerator::Parent NodeSetGenerator::parentOf(const Node &node) const
+{
+    Parent result;
+
+    for (const auto &reference : node.references) {
+        if (reference.isForward)
+            continue;
+        const quint32 type = referenceTypeId(reference.referenceType);
+        const QString target = resolveAlias(reference.target);
+        if (type == HasEncoding || (isHierarchical(type) && (node.parentNodeId.isEmpty() || target == node.parentNodeId))) {
+            result.nodeId = target;
+            result.referenceType = type;
+            result.isEncoding = type == HasEncoding;
+            return result;
+        }
+    }
+
+    const auto forwardParent = m_forwardParents.constFind(node.nodeId);
+    if (forwardParent != m_forwardParents.constEnd())
+        return forwardParent.value();
+
+    if (!node.parentNodeId.isEmpty()) {
+        result.nodeId = node.parentNodeId;
+        result.referenceType = HierarchicalReferences;
+    }
+
+    return result;
+}
+
+// Creates a name following the convention of NodeIds.csv, for example "MachineType_Speed"
+QString NodeSetGenerator::constantName(const QString &nodeId)
+{
+    const auto existing = m_constantNames.constFind(nodeId);
+    if (existing != m_constantNames.constEnd())
+        return existing.value();
+
+    const Node &node = m_nodes.at(m_nodeIndices.value(nodeId));
+    QString name = sanitize(node.symbolicName.isEmpty() ? node.browseName : node.symbolicName);
+
+    // Insert a placeholder to stop recursion for cyclic parent relations
+    m_constantNames.insert(nodeId, name);
+
+    const Parent parent = isTypeNode(node) ? Parent() : parentOf(node);
+    if (isModelNode(parent.nodeId)) {
+        const QString parentName = constantName(parent.nodeId);
+        name = parentName + (parent.isEncoding ? QLatin1String("_Encoding_") : QLatin1String("_")) + name;
+    }
+
+    if (m_usedConstantNames.contains(name)) {
+        const NodeId id = node.parsedNodeId;
+        name += QLatin1Char('_') + (id.isNumeric ? QString::number(id.numericIdentifier) : sanitize(id.stringIdentifier));
+    }
+
+    m_usedConstantNames.insert(name);
+    m_constantNames.insert(nodeId, name);
+    return name;
+}
+
+QString NodeSetGenerator::typeName(const QString &nodeId) const
+{
+    return sanitize(m_nodes.at(m_nodeIndices.value(nodeId)).browseName);
+}
+
+bool NodeSetGenerator::scalarType(const QString &dataType, QString &cppType, QString &overlay) const
+{
+    const QString resolved = resolveAlias(dataType);
+    const NodeId nodeId = parseNodeId(resolved);
+    overlay.clear();
+
+    if (nodeId.isValid && nodeId.namespaceIndex == 0 && nodeId.isNumeric) {
+        const auto builtin = builtinTypes().constFind(nodeId.numericIdentifier);
+        if (builtin == builtinTypes().constEnd())
+            return false;
+        cppType = QLatin1String(builtin->cppType);
+        if (builtin->overlay)
+            overlay = QLatin1String(builtin->overlay);
+        return true;
+    }
+
+    if (m_enumerations.contains(resolved) || m_structures.contains(resolved)) {
+        cppType = typeName(resolved);
+        return true;
+    }
+
+    return false;
+}
+
+bool NodeSetGenerator::collectStructures()
+{
+    QStringList candidates;
+
+    for (const auto &node : qAsConst(m_nodes)) {
+        if (node.nodeClass != QLatin1String("DataType") || !isModelNode(node.nodeId) || !node.hasDefinition)
+            continue;
+
+        if (isSubtypeOf(node.nodeId, Enumeration)) {
+            m_enumerations.append(node.nodeId);
+        } else if (isSubtypeOf(node.nodeId, Structure)) {
+            if (node.isUnion) {
+                qWarning("Skipping union %s, unions are not supported", qPrintable(node.browseName));
+                continue;
+            }
+            candidates.append(node.nodeId);
+        }
+
+        for (const auto &reference : node.references) {
+            if (reference.isForward && referenceTypeId(reference.referenceType) == HasEncoding) {
+                const QString target = resolveAlias(reference.target);
+                const auto encoding = m_nodeIndices.constFind(target);
+                if (encoding != m_nodeIndices.constEnd() && m_nodes.at(encoding.value()).browseName == QLatin1String("Default Binary"))
+                    m_binaryEncodings.insert(node.nodeId, target);
+            }
+        }
+    }
+
+    for (const auto &node : qAsConst(m_nodes)) {
+        if (node.nodeClass != QLatin1String("Object") || node.browseName != QLatin1String("Default Binary"))
+            continue;
+        const Parent parent = parentOf(node);
+        if (parent.isEncoding && !m_binaryEncodings.contains(parent.nodeId))
+            m_binaryEncodings.insert(parent.nodeId, node.nodeId);
+    }
+
+    // Structures are ordered so that the types of inline encoded fields are defined first.
+    // Structures with unsupported fields are removed until no more structures are dropped.
+    QStringList supported = candidates;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        m_structures = supported;
+        for (const auto &nodeId : qAsConst(m_structures)) {
+            const Node &node = m_nodes.at(m_nodeIndices.value(nodeId));
+            for (const auto &field : node.fields) {
+                QString cppType;
+                QString overlay;
+                if (!scalarType(field.dataType, cppType, overlay) || field.valueRank < -1 || field.valueRank > 1) {
+                    qWarning("Skipping structure %s, the field %s has an unsupported type",
+                             qPrintable(node.browseName), qPrintable(field.name));
+                    supported.removeAll(nodeId);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Array fields are ordered as well, QVector<T> members need a complete type in most cases.
+    // Only cyclic references through arrays depend on the forward declarations of writeStructures().
+    QStringList ordered;
+    QSet<QString> visiting;
+    std::function<void(const QString &)> visit = [&](const QString &nodeId) {
+        if (ordered.contains(nodeId) || visiting.contains(nodeId))
+            return;
+        visiting.insert(nodeId);
+        for (const auto &field : m_nodes.at(m_nodeIndices.value(nodeId)).fields) {
+            const QString type = resolveAlias(field.dataType);
+            if (m_structures.contains(type))
+                visit(type);
+        }
+        ordered.append(nodeId);
+    };
+    for (const auto &nodeId : qAsConst(m_structures))
+        visit(nodeId);
+    m_structures = ordered;
+
+    return true;
+}
+
+void NodeSetGenerator::writeNodeIds(QTextStream &output)
+{
+    output << "namespace NodeIds {\n";
+    for (const auto &node : qAsConst(m_nodes)) {
+        if (!isModelNode(node.nodeId) || !node.parsedNodeId.isValid)
+            continue;
+        const NodeId &id = node.parsedNodeId;
+        output << "constexpr NodeId " << constantName(node.nodeId) << " = {" << id.namespaceIndex << ", ";
+        if (id.isNumeric)
+            output << id.numericIdentifier << ", nullptr";
+        else
+            output << "0, " << cppString(id.stringIdentifier);
+        output << "};\n";
+    }
+    output << "} // namespace NodeIds\n\n";
+}
+
+void NodeSetGenerator::writeBrowsePaths(QTextStream &output)
+{
+    output << "namespace BrowsePaths {\n";
+
+    for (const auto &node : qAsConst(m_nodes)) {
+        if (!isModelNode(node.nodeId) || isTypeNode(node) || !node.parsedNodeId.isValid)
+            continue;
+
+        // Walk up to the first node outside of the model, paths through types are instance declarations
+        QVector<const Node *> chain;
+        QVector<quint32> referenceTypes;
+        const Node *current = &node;
+        QString startNode;
+        bool valid = true;
+        while (valid) {
+            const Parent parent = parentOf(*current);
+            if (parent.nodeId.isEmpty() || parent.isEncoding || chain.size() > 64) {
+                valid = false;
+                break;
+            }
+            chain.prepend(current);
+            referenceTypes.prepend(parent.referenceType ? parent.referenceType : HierarchicalReferences);
+            if (!isModelNode(parent.nodeId)) {
+                startNode = parent.nodeId;
+                break;
+            }
+            current = &m_nodes.at(m_nodeIndices.value(parent.nodeId));
+            if (isTypeNode(*current))
+                valid = false;
+        }
+
+        const NodeId start = parseNodeId(startNode);
+        if (!valid || !start.isValid)
+            continue;
+
+        const QString name = constantName(node.nodeId);
+        output << "constexpr PathElement " << name << "_Elements[] = {\n";
+        for (int i = 0; i < chain.size(); ++i) {
+            output << "    {" << referenceTypes.at(i) << ", " << chain.at(i)->browseNameIndex << ", "
+                   << cppString(chain.at(i)->browseName) << "}" << (i + 1 < chain.size() ? "," : "") << "\n";
+        }
+        output << "};\n";
+        output << "constexpr BrowsePath " << name << " = {{" << start.namespaceIndex << ", ";
+        if (start.isNumeric)
+            output << start.numericIdentifier << ", nullptr";
+        else
+            output << "0, " << cppString(start.stringIdentifier);
+        output << "}, " << name << "_Elements, " << chain.size() << "};\n";
+    }
+
+    output << "} // namespace BrowsePaths\n\n";
+}
+
+void NodeSetGenerator::writeEnumerations(QTextStream &output)
+{
+    for (const auto &nodeId : qAsConst(m_enumerations)) {
+        const Node &node = m_nodes.at(m_nodeIndices.value(nodeId));
+        output << "enum class " << typeName(nodeId) << " : qint32 {\n";
+        for (int i = 0; i < node.fields.size(); ++i) {
+            const auto &field = node.fields.at(i);
+            output << "    " << sanitize(field.name) << " = " << (field.hasValue ? field.value : i)
+                   << (i + 1 < node.fields.size() ? "," : "") << "\n";
+        }
+        output << "};\n\n";
+    }
+}
+
+void NodeSetGenerator::writeStructures(QTextStream &output)
+{
+    for (const auto &nodeId : qAsConst(m_structures))
+        output << "struct " << typeName(nodeId) << ";\n";
+    if (!m_structures.isEmpty())
+        output << "\n";
+
+    for (const auto &nodeId : qAsConst(m_structures)) {
+        const Node &node = m_nodes.at(m_nodeIndices.value(nodeId));
+        output << "struct " << typeName(nodeId) << " {\n";
+        for (const auto &field : node.fields) {
+            QString cppType;
+            QString overlay;
+            scalarType(field.dataType, cppType, overlay);
+            const QString member = memberName(field.name);
+            const QString type = resolveAlias(field.dataType);
+
+            if (field.valueRank != -1)
+                output << "    QVector<" << cppType << "> " << member << ";\n";
+            else if (m_enumerations.contains(type))
+                output << "    " << cppType << " " << member << " = static_cast<" << cppType << ">(0);\n";
+            else if (cppType.startsWith(QLatin1Char('q')) || cppType == QLatin1String("bool")
+                     || cppType == QLatin1String("float") || cppType == QLatin1String("double"))
+                output << "    " << cppType << " " << member << " = 0;\n";
+            else
+                output << "    " << cppType << " " << member << ";\n";
+
+            if (field.isOptional)
+                output << "    bool " << member << "Specified = false;\n";
+        }
+        output << "};\n\n";
+    }
+}
+
+void NodeSetGenerator::writeCodecs(QTextStream &output, const QString &cppNamespace)
+{
+    if (m_structures.isEmpty())
+        return;
+
+    output << "QT_BEGIN_NAMESPACE\n\n";
+
+    // Declare all specializations first to allow structures which reference each other
+    for (const auto &nodeId : qAsConst(m_structures)) {
+        const QString type = cppNamespace + QLatin1String("::") + typeName(nodeId);
+        output << "template <>\ninline " << type << " QOpcUaBinaryDataEncoding::decode<" << type << ">(bool &success);\n";
+        output << "template <>\ninline bool QOpcUaBinaryDataEncoding::encode<" << type << ">(const " << type << " &src);\n";
+        output << "template <>\ninline qint64 QOpcUaBinaryDataEncoding::encodedSize<" << type << ">(const " << type << " &src);\n";
+        output << "template <>\nstruct QOpcUaBinaryDataEncoding::hasEncodedSize<" << type << "> : std::true_type {};\n";
+    }
+    output << "\n";
+
+    for (const auto &nodeId : qAsConst(m_structures)) {
+        const Node &node = m_nodes.at(m_nodeIndices.value(nodeId));
+        const QString type = cppNamespace + QLatin1String("::") + typeName(nodeId);
+
+        struct FieldCode {
+            QString member;
+            QString templateArguments;
+            bool isArray;
+            bool isEnumeration;
+            int optionalBit;
+        };
+        QVector<FieldCode> fields;
+        int optionalCount = 0;
+        for (const auto &field : node.fields) {
+            QString cppType;
+            QString overlay;
+            scalarType(field.dataType, cppType, overlay);
+            const QString resolved = resolveAlias(field.dataType);
+            FieldCode code;
+            code.member = memberName(field.name);
+            code.isEnumeration = m_enumerations.contains(resolved);
+            if (code.isEnumeration)
+                code.templateArguments = QStringLiteral("qint32");
+            else if (m_structures.contains(resolved))
+                code.templateArguments = cppNamespace + QLatin1String("::") + cppType;
+            else
+                code.templateArguments = overlay.isEmpty() ? cppType : cppType + QLatin1String(", ") + overlay;
+            code.isArray = field.valueRank != -1;
+            code.optionalBit = field.isOptional ? optionalCount++ : -1;
+            fields.push_back(code);
+        }
+
+        // decode
+        output << "template <>\ninline " << type << " QOpcUaBinaryDataEncoding::decode<" << type << ">(bool &success)\n{\n";
+        output << "    " << type << " temp;\n";
+        if (optionalCount) {
+            output << "    const quint32 encodingMask = decode<quint32>(success);\n";
+            output << "    if (!success)\n        return " << type << "();\n";
+        }
+        for (const auto &field : qAsConst(fields)) {
+            QString indent = QStringLiteral("    ");
+            if (field.optionalBit >= 0) {
+                output << "    if (encodingMask & (1u << " << field.optionalBit << ")) {\n";
+                output << "        temp." << field.member << "Specified = true;\n";
+                indent += QLatin1String("    ");
+            }
+            if (field.isArray && field.isEnumeration) {
+                output << indent << "const auto " << field.member << "Values = decodeArray<qint32>(success);\n";
+                output << indent << "for (const auto value : " << field.member << "Values)\n";
+                output << indent << "    temp." << field.member << ".push_back(static_cast<decltype(temp." << field.member
+                       << ")::value_type>(value));\n";
+            } else if (field.isArray) {
+                output << indent << "temp." << field.member << " = decodeArray<" << field.templateArguments << ">(success);\n";
+            } else if (field.isEnumeration) {
+                output << indent << "temp." << field.member << " = static_cast<decltype(temp." << field.member
+                       << ")>(decode<qint32>(success));\n";
+            } else {
+                output << indent << "temp." << field.member << " = decode<" << field.templateArguments << ">(success);\n";
+            }
+            output << indent << "if (!success)\n" << indent << "    return " << type << "();\n";
+            if (field.optionalBit >= 0)
+                output << "    }\n";
+        }
+        output << "    return temp;\n}\n\n";
+
+        // encode
+        output << "template <>\ninline bool QOpcUaBinaryDataEncoding::encode<" << type << ">(const " << type << " &src)\n{\n";
+        if (optionalCount) {
+            output << "    quint32 encodingMask = 0;\n";
+            for (const auto &field : qAsConst(fields)) {
+                if (field.optionalBit >= 0)
+                    output << "    if (src." << field.member << "Specified)\n        encodingMask |= (1u << " << field.optionalBit << ");\n";
+            }
+            output << "    if (!encode<quint32>(encodingMask))\n        return false;\n";
+        }
+        for (const auto &field : qAsConst(fields)) {
+            QString call;
+            if (field.isArray && field.isEnumeration) {
+                output << "    QVector<qint32> " << field.member << "Values;\n";
+                output << "    for (const auto value : src." << field.member << ")\n";
+                output << "        " << field.member << "Values.push_back(static_cast<qint32>(value));\n";
+                call = QStringLiteral("encodeArray<qint32>(%1Values)").arg(field.member);
+            } else if (field.isArray) {
+                call = QStringLiteral("encodeArray<%1>(src.%2)").arg(field.templateArguments, field.member);
+            } else if (field.isEnumeration) {
+                call = QStringLiteral("encode<qint32>(static_cast<qint32>(src.%1))").arg(field.member);
+            } else {
+                call = QStringLiteral("encode<%1>(src.%2)").arg(field.templateArguments, field.member);
+            }
+            if (field.optionalBit >= 0)
+                output << "    if (src." << field.member << "Specified && !" << call << ")\n";
+            else
+                output << "    if (!" << call << ")\n";
+            output << "        return false;\n";
+        }
+        output << "    return true;\n}\n\n";
+
+        // encodedSize
+        output << "template <>\ninline qint64 QOpcUaBinaryDataEncoding::encodedSize<" << type << ">(const " << type << " &src)\n{\n";
+        if (fields.isEmpty())
+            output << "    Q_UNUSED(src);\n";
+        output << "    return sumOfSizes({";
+        QStringList sizes;
+        if (optionalCount)
+            sizes.append(QStringLiteral("static_cast<qint64>(sizeof(quint32))"));
+        for (const auto &field : qAsConst(fields)) {
+            QString size;
+            if (field.isArray && field.isEnumeration)
+                size = QStringLiteral("static_cast<qint64>(sizeof(qint32)) * (src.%1.size() + 1)").arg(field.member);
+            else if (field.isArray)
+                size = QStringLiteral("encodedArraySize<%1>(src.%2)").arg(field.templateArguments, field.member);
+            else if (field.isEnumeration)
+                size = QStringLiteral("static_cast<qint64>(sizeof(qint32))");
+            else
+                size = QStringLiteral("encodedSize<%1>(src.%2)").arg(field.templateArguments, field.member);
+            if (field.optionalBit >= 0)
+                size = QStringLiteral("src.%1Specified ? %2 : 0").arg(field.member, size);
+            sizes.append(size);
+        }
+        output << sizes.join(QLatin1String(",\n                       ")) << "});\n}\n\n";
+    }
+
+    output << "QT_END_NAMESPACE\n\n";
+}
+
+bool NodeSetGenerator::generate(QTextStream &output, const QString &cppNamespace, const QString &headerGuard)
+{
+    if (!collectStructures())
+        return false;
+
+    output << "// This file was generated by qtopcua-nodesetgenerator. Do not edit.\n\n";
+    output << "#ifndef " << headerGuard << "\n";
+    output << "#define " << headerGuard << "\n\n";
+    output << "#include <QtOpcUa/qopcuabinarydataencoding.h>\n";
+    output << "#include <QtOpcUa/qopcuaextensionobjectdecoderregistry.h>\n";
+    output << "#include <QtOpcUa/qopcuaqualifiedname.h>\n";
+    output << "#include <QtOpcUa/qopcuarelativepathelement.h>\n\n";
+    output << "#include <QtCore/qmetatype.h>\n";
+    output << "#include <QtCore/qstringlist.h>\n";
+    output << "#include <QtCore/qvector.h>\n\n";
+
+    output << "namespace " << cppNamespace << " {\n\n";
+
+    output << "// Namespace URIs of the nodeset, the local namespace index n refers to namespaceUris[n - 1]\n";
+    output << "constexpr int namespaceCount = " << m_namespaceUris.size() << ";\n";
+    if (!m_namespaceUris.isEmpty()) {
+        output << "constexpr const char *namespaceUris[] = {\n";
+        for (int i = 0; i < m_namespaceUris.size(); ++i)
+            output << "    " << cppString(m_namespaceUris.at(i)) << (i + 1 < m_namespaceUris.size() ? "," : "") << "\n";
+        output << "};\n";
+    }
+    output << "\n";
+
+    output << R"(struct NodeId {
+    int namespaceIndex; // Local namespace index
+    quint32 numericIdentifier;
+    const char *stringIdentifier; // nullptr for numeric node ids
+};
+
+struct PathElement {
+    quint32 referenceType; // Numeric identifier of a reference type in namespace 0
+    int namespaceIndex; // Local namespace index of the browse name
+    const char *name;
+};
+
+struct BrowsePath {
+    NodeId startNode;
+    const PathElement *elements;
+    int size;
+};
+
+// Maps the local namespace indices of the nodeset to the namespace indices of a server
+class Namespaces
+{
+public:
+    explicit Namespaces(const QStringList &namespaceArray)
+    {
+        m_indices.push_back(0);
+)";
+    if (!m_namespaceUris.isEmpty()) {
+        output << R"(        for (const char *uri : namespaceUris)
+            m_indices.push_back(namespaceArray.indexOf(QString::fromUtf8(uri)));
+)";
+    } else {
+        output << "        Q_UNUSED(namespaceArray);\n";
+    }
+    output << R"(    }
+
+    bool isValid() const { return !m_indices.contains(-1); }
+    int namespaceIndex(int localIndex) const { return m_indices.value(localIndex, -1); }
+
+    QString nodeId(const NodeId &id) const
+    {
+        const int index = namespaceIndex(id.namespaceIndex);
+        if (index < 0)
+            return QString();
+        if (id.stringIdentifier)
+            return QStringLiteral("ns=%1;s=%2").arg(index).arg(QString::fromUtf8(id.stringIdentifier));
+        return QStringLiteral("ns=%1;i=%2").arg(index).arg(id.numericIdentifier);
+    }
+
+    QString startNodeId(const BrowsePath &path) const
+    {
+        return nodeId(path.startNode);
+    }
+
+    // Returns an empty path if the namespace of a browse name is unknown to the server
+    QVector<QOpcUaRelativePathElement> relativePath(const BrowsePath &path) const
+    {
+        QVector<QOpcUaRelativePathElement> result;
+        result.reserve(path.size);
+        for (int i = 0; i < path.size; ++i) {
+            const PathElement &element = path.elements[i];
+            const int index = namespaceIndex(element.namespaceIndex);
+            if (index < 0)
+                return QVector<QOpcUaRelativePathElement>();
+            QOpcUaRelativePathElement temp(QOpcUaQualifiedName(index, QString::fromUtf8(element.name)),
+                                           QStringLiteral("ns=0;i=%1").arg(element.referenceType));
+            temp.setIncludeSubtypes(true);
+            result.push_back(temp);
+        }
+        return result;
+    }
+
+private:
+    QVector<int> m_indices;
+};
+
+)";
+
+    writeNodeIds(output);
+    writeBrowsePaths(output);
+    writeEnumerations(output);
+    writeStructures(output);
+
+    output << "} // namespace " << cppNamespace << "\n\n";
+
+    for (const auto &nodeId : qAsConst(m_structures))
+        output << "Q_DECLARE_METATYPE(" << cppNamespace << "::" << typeName(nodeId) << ")\n";
+    if (!m_structures.isEmpty())
+        output << "\n";
+
+    writeCodecs(output, cppNamespace);
+
+    output << "namespace " << cppNamespace << " {\n\n";
+    output << "// Registers decoders for the structures of the nodeset which are called by the backend\n";
+    output << "inline void registerDecoders(const Namespaces &namespaces)\n{\n";
+    bool hasDecoder = false;
+    for (const auto &nodeId : qAsConst(m_structures)) {
+        const QString encoding = m_binaryEncodings.value(nodeId);
+        if (encoding.isEmpty() || !isModelNode(encoding))
+            continue;
+        hasDecoder = true;
+        output << "    QOpcUaExtensionObjectDecoderRegistry::registerType<" << typeName(nodeId)
+               << ">(namespaces.nodeId(NodeIds::" << constantName(encoding) << "));\n";
+    }
+    if (!hasDecoder)
+        output << "    Q_UNUSED(namespaces);\n";
+    output << "}\n\n";
+    output << "} // namespace " << cppNamespace << "\n\n";
+
+    output << "#endif // " << headerGuard << "\n";
+
+    return true;
+}
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef NODESETGENERATOR_H
+#define NODESETGENERATOR_H
+
+#include <QtCore/qhash.h>
+#include <QtCore/qset.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qtextstream.h>
+#include <QtCore/qvector.h>
+
+class NodeSetGenerator
+{
+public:
+    bool parse(QIODevice *device);
+    bool generate(QTextStream &output, const QString &cppNamespace, const QString &headerGuard);
+
+    QString errorString() const;
+
+private:
+    struct NodeId {
+        int namespaceIndex = 0;
+        quint32 numericIdentifier = 0;
+        QString stringIdentifier;
+        bool isNumeric = true;
+        bool isValid = false;
+    };
+
+    struct Reference {
+        QString referenceType;
+        QString target;
+        bool isForward = true;
+    };
+
+    struct Field {
+        QString name;
+        QString dataType;
+        int valueRank = -1;
+        bool isOptional = false;
+        bool hasValue = false;
+        qint64 value = 0;
+    };
+
+    struct Node {
+        QString nodeClass;
+        QString nodeId;
+        NodeId parsedNodeId;
+        QString browseName;
+        int browseNameIndex = 0;
+        QString symbolicName;
+        QString parentNodeId;
+        QVector<Reference> references;
+        bool hasDefinition = false;
+        bool isUnion = false;
+        bool isOptionSet = false;
+        QVector<Field> fields;
+    };
+
+    struct Parent {
+        QString nodeId;
+        quint32 referenceType = 0;
+        bool isEncoding = false;
+    };
+
+    static NodeId parseNodeId(const QString &nodeId);
+    static QString sanitize(const QString &name);
+    static QString memberName(const QString &name);
+    static QString cppString(const QString &value);
+
+    QString resolveAlias(const QString &value) const;
+    quint32 referenceTypeId(const QString &referenceType) const;
+    bool isModelNode(const QString &nodeId) const;
+    bool isTypeNode(const Node &node) const;
+    QString superType(const Node &node) const;
+    bool isSubtypeOf(const QString &nodeId, quint32 baseType) const;
+    Parent parentOf(const Node &node) const;
+    QString constantName(const QString &nodeId);
+    QString typeName(const QString &nodeId) const;
+    bool scalarType(const QString &dataType, QString &cppType, QString &overlay) const;
+    bool collectStructures();
+
+    void writeNodeIds(QTextStream &output);
+    void writeBrowsePaths(QTextStream &output);
+    void writeEnumerations(QTextStream &output);
+    void writeStructures(QTextStream &output);
+    void writeCodecs(QTextStream &output, const QString &cppNamespace);
+
+    QStringList m_namespaceUris;
+    QHash<QString, QString> m_aliases;
+    QVector<Node> m_nodes;
+    QHash<QString, int> m_nodeIndices;
+    QHash<QString, Parent> m_forwardParents; // Child -> parent from forward references of the parent
+
+    QHash<QString, QString> m_constantNames;
+    QSet<QString> m_usedConstantNames;
+    QStringList m_enumerations; // Node ids of enumerated data types
+    QStringList m_structures; // Node ids of structured data types in dependency order
+    QHash<QString, QString> m_binaryEncodings; // Data type -> default binary encoding node
+
+    QString m_errorString;
+};
+
+#endif // NODESETGENERATOR_H
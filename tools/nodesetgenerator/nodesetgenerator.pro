@@ -0,0 +1,14 @@
+QT -= gui
+
+CONFIG += c++11
+
+SOURCES += \
+        main.cpp \
+        nodesetgenerator.cpp
+
+HEADERS += \
+        nodesetgenerator.h
+
+TARGET = qtopcua-nodesetgenerator
+
+load(qt_tool)
@@ -5,3 +5,7 @@ QT_FOR_CONFIG += opcua-private
 qtConfig(ns0idgenerator): {
     SUBDIRS += defaultnodeidsgenerator
 }
+
+qtConfig(nodesetgenerator): {
+    SUBDIRS += nodesetgenerator
+}